@@ -1,10 +1,28 @@
 #pragma once
 
+#include <type_traits>
 #include "../Type/Types.hpp"
+#include "RenderTypes.hpp"
 
 inline namespace neoxops {
     namespace graphics {
+        /// @brief 메모리상의 픽셀 바이트 순서
+        enum class ColorOrder : uint8_t {
+            ARGB,                               ///< Color 구조체
+            RGBA,                               ///< DXGI_FORMAT_R8G8B8A8_UNORM, SoftwareRenderDevice
+            BGRA                                ///< DXGI_FORMAT_B8G8R8A8_UNORM, 리틀 엔디언 색상 코드 (0xAARRGGBB)
+        };
+
+        /// @brief 텍스처 형식의 픽셀 바이트 순서를 취득합니다.
+        /// @param format 텍스처 형식
+        /// @return 바이트 순서
+        [[nodiscard]] constexpr ColorOrder GetColorOrder(TextureFormat format) noexcept {
+            return (format == TextureFormat::BGRA8) ? ColorOrder::BGRA : ColorOrder::RGBA;
+        }
+
         /// @brief 색상 구조체
+        /// @note 픽셀 배열 일괄 처리(순서 변환, 알파 곱, sRGB 변환, 블렌딩)는 Color 배열과 uint32_t 배열 모두에 사용할 수 있으며,
+        ///       빌드 대상에 따라 AVX2(8픽셀), SSE2(4픽셀), 스칼라 중 하나로 처리됩니다. 모든 경로의 결과는 같습니다.
         struct Color final {
             byte_t A;            ///< Alpha
             byte_t R;            ///< Red
@@ -14,12 +32,22 @@ inline namespace neoxops {
             Color() noexcept;
             Color(int32_t, int32_t, int32_t, int32_t a = 255) noexcept;
             Color(uint32_t) noexcept;
-            Color(const Color&) noexcept;
-            Color(Color&&) noexcept = delete;
+            Color(const Color&) noexcept = default;
+            Color(Color&&) noexcept = default;
 
             [[nodiscard]] static uint32_t GetColorCode(int32_t, int32_t, int32_t, int32_t a = 255) noexcept;
             [[nodiscard]] uint32_t GetColorCode() const noexcept;
 
+            static void Convert(const void*, ColorOrder, void*, ColorOrder, size_t) noexcept;
+            static void PremultiplyAlpha(const void*, void*, ColorOrder, size_t) noexcept;
+            static void SrgbToLinear(const void*, void*, ColorOrder, size_t) noexcept;
+            static void LinearToSrgb(const void*, void*, ColorOrder, size_t) noexcept;
+            static void BlendOver(const void*, void*, ColorOrder, size_t) noexcept;
+            static void BlendOverPremultiplied(const void*, void*, ColorOrder, size_t) noexcept;
+
+            Color& operator=(const Color&) noexcept = default;
+            Color& operator=(Color&&) noexcept = default;
+
             /// @brief == 연산자 오버로딩
             /// @param lhs Color
             /// @param rhs Color
@@ -179,5 +207,7 @@ inline namespace neoxops {
             static constexpr uint32_t Yellow                = 0xFFFFFF00;
             static constexpr uint32_t YellowGreen           = 0xFF9ACD32;
         };
+
+        static_assert(sizeof(Color) == 4U && std::is_trivially_copyable_v<Color>, "Color must stay a 4-byte trivially copyable pixel");
     }
 }
@@ -1,62 +1,136 @@
-#pragma once
-
-// #define ENABLE_SOFTWARE_RENDER          ///< CPU 기반 소프트웨어 렌더링 활성화
-
-#include <d3d11.h>
-#include <directxmath.h>
-#include <dxgi.h>
-#include <wrl/client.h>
-
-// If you are uisng MinGw, you'll need to add the option to your compiler.
-// Example: -ld3d11 -ldxgi -ld3dcompiler
-#if defined(_MSC_VER)
-    #pragma comment(lib, "d3d11.lib")
-    #pragma comment(lib, "dxgi.lib")
-    #pragma comment(lib, "d3dcompiler.lib")
-#endif
-
-inline namespace neoxops {
-    namespace graphics {
-        /// @brief Direct3D 그래픽 클래스
-        class D3DGraphics final {
-        private:
-            Microsoft::WRL::ComPtr<ID3D11Device> m_Device;
-            Microsoft::WRL::ComPtr<ID3D11DeviceContext> m_DeviceContext;
-            Microsoft::WRL::ComPtr<IDXGISwapChain> m_SwapChain;
-
-            Microsoft::WRL::ComPtr<ID3D11RenderTargetView> m_RenderTargetView;
-            Microsoft::WRL::ComPtr<ID3D11Texture2D> m_DepthStencilBuffer;
-            Microsoft::WRL::ComPtr<ID3D11DepthStencilState> m_DepthStencilState;
-            Microsoft::WRL::ComPtr<ID3D11DepthStencilView> m_DepthStencilView;
-            Microsoft::WRL::ComPtr<ID3D11RasterizerState> m_RasterState;
-
-            D3D11_VIEWPORT m_ViewPort;
-
-            bool m_VSyncEnabled;
-
-        public:
-            D3DGraphics() noexcept;
-            D3DGraphics(const D3DGraphics&) noexcept = delete;
-            D3DGraphics(D3DGraphics&&) noexcept = delete;
-            ~D3DGraphics() noexcept;
-
-            [[nodiscard]] bool Initialize(HWND, int32_t, int32_t, bool, bool) noexcept;
-            [[nodiscard]] bool IsVSyncEnabled() const noexcept;
-
-            void BeginFrame(float color[4]) noexcept;
-            void EndFrame() noexcept;
-
-            [[nodiscard]] bool Resize(int32_t, int32_t) noexcept;
-
-            void SetVSync(bool) noexcept;
-
-            [[nodiscard]] ID3D11Device* GetDevice() const noexcept;
-            [[nodiscard]] ID3D11DeviceContext* GetDeviceContext() const noexcept;
-            [[nodiscard]] ID3D11RenderTargetView* GetRenderTargetView() const noexcept;
-            [[nodiscard]] ID3D11DepthStencilView* GetDepthStencilView() const noexcept;
-
-            D3DGraphics& operator=(const D3DGraphics&) noexcept = delete;
-            D3DGraphics& operator=(D3DGraphics&&) noexcept = delete;
-        };
-    }
+#pragma once
+
+// #define ENABLE_SOFTWARE_RENDER          ///< CPU 기반 소프트웨어 렌더링 활성화
+
+#include <d3d11.h>
+#include <directxmath.h>
+#include <dxgi.h>
+#include <wrl/client.h>
+#include "IRenderDevice.hpp"
+#include "ResourceTable.hpp"
+
+// If you are uisng MinGw, you'll need to add the option to your compiler.
+// Example: -ld3d11 -ldxgi -ld3dcompiler
+#if defined(_MSC_VER)
+    #pragma comment(lib, "d3d11.lib")
+    #pragma comment(lib, "dxgi.lib")
+    #pragma comment(lib, "d3dcompiler.lib")
+#endif
+
+inline namespace neoxops {
+    namespace graphics {
+        /// @brief Direct3D 그래픽 클래스
+        class D3DGraphics final : public IRenderDevice {
+        private:
+            /// @brief Direct3D 버퍼 리소스
+            struct D3DBuffer final {
+                Microsoft::WRL::ComPtr<ID3D11Buffer> Buffer;                ///< 버퍼
+                BufferDesc Desc;                                            ///< 버퍼 설명
+            };
+
+            /// @brief Direct3D 텍스처 리소스
+            struct D3DTexture final {
+                Microsoft::WRL::ComPtr<ID3D11Texture2D> Texture;            ///< 텍스처
+                Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> View;      ///< 셰이더 리소스 뷰
+                TextureDesc Desc;                                           ///< 텍스처 설명
+            };
+
+            /// @brief Direct3D 셰이더 리소스
+            struct D3DShader final {
+                Microsoft::WRL::ComPtr<ID3D11VertexShader> VertexShader;    ///< 정점 셰이더
+                Microsoft::WRL::ComPtr<ID3D11PixelShader> PixelShader;      ///< 픽셀 셰이더
+                Microsoft::WRL::ComPtr<ID3D11InputLayout> InputLayout;      ///< 정점 입력 배치 (정점 셰이더 전용, 입력이 없으면 nullptr)
+                ShaderDesc Desc;                                            ///< 셰이더 설명
+            };
+
+            Microsoft::WRL::ComPtr<ID3D11Device> m_Device;
+            Microsoft::WRL::ComPtr<ID3D11DeviceContext> m_DeviceContext;
+            Microsoft::WRL::ComPtr<IDXGISwapChain> m_SwapChain;
+
+            Microsoft::WRL::ComPtr<ID3D11RenderTargetView> m_RenderTargetView;
+            Microsoft::WRL::ComPtr<ID3D11Texture2D> m_DepthStencilBuffer;
+            Microsoft::WRL::ComPtr<ID3D11DepthStencilState> m_DepthStencilState;
+            Microsoft::WRL::ComPtr<ID3D11DepthStencilView> m_DepthStencilView;
+            Microsoft::WRL::ComPtr<ID3D11RasterizerState> m_RasterState;
+
+            ResourceTable<D3DBuffer> m_Buffers;                             ///< 버퍼 목록
+            ResourceTable<D3DTexture> m_Textures;                           ///< 텍스처 목록
+            ResourceTable<D3DShader> m_Shaders;                             ///< 셰이더 목록
+            ResourceTable<Microsoft::WRL::ComPtr<ID3D11BlendState>> m_BlendStates;                  ///< 블렌드 상태 목록
+            ResourceTable<Microsoft::WRL::ComPtr<ID3D11DepthStencilState>> m_DepthStencilStates;    ///< 깊이 스텐실 상태 목록
+            ResourceTable<Microsoft::WRL::ComPtr<ID3D11RasterizerState>> m_RasterizerStates;        ///< 래스터라이저 상태 목록
+            ResourceTable<Microsoft::WRL::ComPtr<ID3D11SamplerState>> m_Samplers;                   ///< 샘플러 목록
+
+            RenderStats m_FrameStats;                                       ///< 집계 중인 프레임의 통계
+            RenderStats m_LastFrameStats;                                   ///< 마지막으로 완료된 프레임의 통계
+
+            D3D11_VIEWPORT m_ViewPort;
+
+            bool m_VSyncEnabled;
+
+        public:
+            D3DGraphics() noexcept;
+            D3DGraphics(const D3DGraphics&) noexcept = delete;
+            D3DGraphics(D3DGraphics&&) noexcept = delete;
+            ~D3DGraphics() noexcept override;
+
+            [[nodiscard]] bool Initialize(void*, int32_t, int32_t, bool, bool) noexcept override;
+            [[nodiscard]] bool IsVSyncEnabled() const noexcept override;
+
+            void BeginFrame(float color[4]) noexcept override;
+            void EndFrame() noexcept override;
+
+            [[nodiscard]] bool Resize(int32_t, int32_t) noexcept override;
+
+            void SetVSync(bool) noexcept override;
+
+            [[nodiscard]] BufferHandle CreateBuffer(const BufferDesc&, const void*) noexcept override;
+            [[nodiscard]] bool UpdateBuffer(BufferHandle, const void*, uint32_t) noexcept override;
+            void DestroyBuffer(BufferHandle) noexcept override;
+
+            [[nodiscard]] TextureHandle CreateTexture(const TextureDesc&, const void*) noexcept override;
+            void DestroyTexture(TextureHandle) noexcept override;
+            [[nodiscard]] bool IsTextureFormatSupported(TextureFormat) const noexcept override;
+
+            [[nodiscard]] ShaderHandle CreateShader(const ShaderDesc&, const void*, size_t) noexcept override;
+            void DestroyShader(ShaderHandle) noexcept override;
+
+            [[nodiscard]] BlendStateHandle CreateBlendState(const BlendDesc&) noexcept override;
+            [[nodiscard]] DepthStencilStateHandle CreateDepthStencilState(const DepthStencilDesc&) noexcept override;
+            [[nodiscard]] RasterizerStateHandle CreateRasterizerState(const RasterizerDesc&) noexcept override;
+            [[nodiscard]] SamplerHandle CreateSampler(const SamplerDesc&) noexcept override;
+            void DestroyBlendState(BlendStateHandle) noexcept override;
+            void DestroyDepthStencilState(DepthStencilStateHandle) noexcept override;
+            void DestroyRasterizerState(RasterizerStateHandle) noexcept override;
+            void DestroySampler(SamplerHandle) noexcept override;
+
+            [[nodiscard]] TextureDesc GetBackBufferDesc() const noexcept override;
+            [[nodiscard]] bool CopyBackBufferToTexture(TextureHandle) noexcept override;
+            [[nodiscard]] bool CopyTextureToBackBuffer(TextureHandle) noexcept override;
+
+            void SetVertexBuffer(BufferHandle) noexcept override;
+            void SetIndexBuffer(BufferHandle, IndexFormat) noexcept override;
+            void SetConstantBuffer(uint32_t, BufferHandle) noexcept override;
+            void SetTexture(uint32_t, TextureHandle) noexcept override;
+            void SetSampler(uint32_t, SamplerHandle) noexcept override;
+            void SetShader(ShaderStage, ShaderHandle) noexcept override;
+            void SetBlendState(BlendStateHandle) noexcept override;
+            void SetDepthStencilState(DepthStencilStateHandle) noexcept override;
+            void SetRasterizerState(RasterizerStateHandle) noexcept override;
+            void SetPrimitiveTopology(PrimitiveTopology) noexcept override;
+
+            void Draw(uint32_t, uint32_t) noexcept override;
+            void DrawIndexed(uint32_t, uint32_t, int32_t) noexcept override;
+
+            [[nodiscard]] const RenderStats& GetFrameStats() const noexcept override;
+
+            [[nodiscard]] ID3D11Device* GetDevice() const noexcept;
+            [[nodiscard]] ID3D11DeviceContext* GetDeviceContext() const noexcept;
+            [[nodiscard]] ID3D11RenderTargetView* GetRenderTargetView() const noexcept;
+            [[nodiscard]] ID3D11DepthStencilView* GetDepthStencilView() const noexcept;
+
+            D3DGraphics& operator=(const D3DGraphics&) noexcept = delete;
+            D3DGraphics& operator=(D3DGraphics&&) noexcept = delete;
+        };
+    }
 }
\ No newline at end of file
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "MeshOptimizer.hpp"
+#include "../System/Json.hpp"
+#include "../System/MappedFile.hpp"
+#include "../Type/Matrix4x4F.hpp"
+
+inline namespace neoxops {
+    namespace graphics {
+        /// @brief glTF 성분 형식
+        enum class GltfComponentType : uint16_t {
+            Unknown         = 0,
+            Byte            = 5120,
+            UnsignedByte    = 5121,
+            Short           = 5122,
+            UnsignedShort   = 5123,
+            UnsignedInt     = 5125,
+            Float           = 5126
+        };
+
+        /// @brief glTF 버퍼 뷰
+        struct GltfBufferView final {
+            std::span<const byte_t> Data;       ///< 내용 (매핑된 파일을 그대로 가리킴, 범위 밖이면 비어있음)
+            uint32_t Stride;                    ///< 요소 간격 (0: 빈틈없이 연속)
+        };
+
+        /// @brief glTF 접근자
+        /// @note 요소 i는 Data.data() + i * Stride 위치에 성분 Components개가 ComponentType 형식으로 있습니다.
+        struct GltfAccessor final {
+            std::span<const byte_t> Data;       ///< 첫 요소부터 마지막 요소 끝까지 (검증 실패, 희소 접근자는 비어있음)
+            uint32_t Count;                     ///< 요소 수
+            uint32_t Stride;                    ///< 요소 간격 (바이트 단위)
+            GltfComponentType ComponentType;    ///< 성분 형식
+            uint8_t Components;                 ///< 요소당 성분 수 (SCALAR 1 ~ VEC4 4)
+            bool Normalized;                    ///< 정수 성분을 [0, 1] 또는 [-1, 1]로 정규화할지 여부
+        };
+
+        /// @brief glTF 프리미티브
+        struct GltfPrimitive final {
+            int32_t Position;                   ///< POSITION 접근자 (-1: 없음)
+            int32_t Normal;                     ///< NORMAL 접근자 (-1: 없음)
+            int32_t TexCoord;                   ///< TEXCOORD_0 접근자 (-1: 없음)
+            int32_t Indices;                    ///< 인덱스 접근자 (-1: 인덱스 없이 순서대로)
+            int32_t Material;                   ///< 재질 (-1: 없음)
+            uint8_t Mode;                       ///< 토폴로지 (4: 삼각형 목록, 5: 스트립, 6: 팬, 나머지는 BuildMesh에서 무시)
+        };
+
+        /// @brief glTF 메시
+        struct GltfMesh final {
+            std::string_view Name;              ///< 이름
+            uint32_t FirstPrimitive;            ///< 첫 프리미티브 (GetPrimitives 기준)
+            uint32_t PrimitiveCount;            ///< 프리미티브 수
+        };
+
+        /// @brief glTF 재질
+        struct GltfMaterial final {
+            std::string_view Name;              ///< 이름
+            float BaseColor[4];                 ///< 기본 색상 (선형 RGBA)
+            int32_t BaseColorImage;             ///< 기본 색상 이미지 (-1: 없음)
+        };
+
+        /// @brief glTF 이미지
+        struct GltfImage final {
+            std::span<const byte_t> Data;       ///< 버퍼 뷰에 들어있는 이미지 내용 (외부 파일이면 비어있음)
+            std::string_view Uri;               ///< 외부 파일 경로 (버퍼 뷰에 들어있으면 비어있음)
+            std::string_view MimeType;          ///< MIME 형식
+        };
+
+        /// @brief glTF 노드
+        struct GltfNode final {
+            std::string_view Name;              ///< 이름
+            Matrix4x4F Local;                   ///< 부모 기준 변환 (glTF 좌표계 그대로, 행 벡터 규약)
+            int32_t Parent;                     ///< 부모 노드 (-1: 루트)
+            int32_t Mesh;                       ///< 메시 (-1: 없음)
+        };
+
+        /// @brief 메시 변환 옵션
+        struct GltfMeshOptions final {
+            bool LeftHanded             = true;     ///< 왼손 좌표계로 바꿀지 여부 (Z 반전, 반시계 방향 앞면을 시계 방향 앞면으로 뒤집음)
+            bool OptimizeVertexCache    = true;     ///< 정점 캐시, 정점 가져오기 최적화 여부
+        };
+
+        /// @brief glTF 2.0 모델 (GLB, .gltf)
+        /// @note 파일을 메모리 매핑하고 JSON 청크만 파싱하며, 버퍼 뷰와 접근자는 매핑된 바이너리를 복사 없이 가리킵니다.
+        ///       이름 등 문자열도 JSON 원문을 가리키므로 모델이 살아있는 동안만 유효합니다.
+        ///       .gltf의 외부 버퍼는 같은 폴더의 파일을 매핑합니다. data URI(Base64) 버퍼와 희소 접근자는 지원하지 않습니다.
+        class GlbModel final {
+        public:
+            static constexpr uint32_t MAGIC         = 0x46546C67U;      ///< 'glTF'
+            static constexpr uint32_t VERSION       = 2U;               ///< 지원 버전
+            static constexpr uint32_t CHUNK_JSON    = 0x4E4F534AU;      ///< 'JSON'
+            static constexpr uint32_t CHUNK_BIN     = 0x004E4942U;      ///< 'BIN\0'
+
+        private:
+            system::MappedFile m_File;                      ///< 모델 파일
+            std::vector<system::MappedFile> m_ExternalFiles;///< 외부 버퍼 파일
+            system::JsonDocument m_Json;                    ///< JSON 청크
+            std::vector<std::span<const byte_t>> m_Buffers; ///< 버퍼
+            std::vector<GltfBufferView> m_BufferViews;      ///< 버퍼 뷰
+            std::vector<GltfAccessor> m_Accessors;          ///< 접근자
+            std::vector<GltfPrimitive> m_Primitives;        ///< 프리미티브 (메시 순)
+            std::vector<GltfMesh> m_Meshes;                 ///< 메시
+            std::vector<GltfMaterial> m_Materials;          ///< 재질
+            std::vector<GltfImage> m_Images;                ///< 이미지
+            std::vector<GltfNode> m_Nodes;                  ///< 노드
+
+            [[nodiscard]] bool parse(const byte_t*, size_t, const std::string&) noexcept;
+            void parseBuffers(const system::JsonValue&, std::span<const byte_t>, const std::string&) noexcept;
+            void parseAccessors(const system::JsonValue&) noexcept;
+            void parseMeshes(const system::JsonValue&) noexcept;
+            void parseMaterials(const system::JsonValue&) noexcept;
+            void parseNodes(const system::JsonValue&) noexcept;
+
+        public:
+            GlbModel() noexcept;
+            GlbModel(const GlbModel&) noexcept = delete;
+            GlbModel(GlbModel&&) noexcept = default;
+            ~GlbModel() noexcept = default;
+
+            [[nodiscard]] bool Load(const std::string&) noexcept;
+            [[nodiscard]] bool Parse(const void*, size_t) noexcept;
+            void Clear() noexcept;
+
+            [[nodiscard]] bool BuildMesh(uint32_t, MeshData&, const GltfMeshOptions& = {}) const noexcept;
+
+            /// @brief 버퍼 뷰 목록을 취득합니다.
+            /// @return 버퍼 뷰
+            [[nodiscard]] std::span<const GltfBufferView> GetBufferViews() const noexcept { return m_BufferViews; }
+
+            /// @brief 접근자 목록을 취득합니다.
+            /// @return 접근자
+            [[nodiscard]] std::span<const GltfAccessor> GetAccessors() const noexcept { return m_Accessors; }
+
+            /// @brief 프리미티브 목록을 취득합니다.
+            /// @return 프리미티브
+            [[nodiscard]] std::span<const GltfPrimitive> GetPrimitives() const noexcept { return m_Primitives; }
+
+            /// @brief 메시 목록을 취득합니다.
+            /// @return 메시
+            [[nodiscard]] std::span<const GltfMesh> GetMeshes() const noexcept { return m_Meshes; }
+
+            /// @brief 재질 목록을 취득합니다.
+            /// @return 재질
+            [[nodiscard]] std::span<const GltfMaterial> GetMaterials() const noexcept { return m_Materials; }
+
+            /// @brief 이미지 목록을 취득합니다.
+            /// @return 이미지
+            [[nodiscard]] std::span<const GltfImage> GetImages() const noexcept { return m_Images; }
+
+            /// @brief 노드 목록을 취득합니다.
+            /// @return 노드
+            [[nodiscard]] std::span<const GltfNode> GetNodes() const noexcept { return m_Nodes; }
+
+            GlbModel& operator=(const GlbModel&) noexcept = delete;
+            GlbModel& operator=(GlbModel&&) noexcept = default;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "RenderTypes.hpp"
+
+inline namespace neoxops {
+    namespace graphics {
+        /// @brief 렌더 디바이스 인터페이스
+        /// @note Direct3D 11 구현(D3DGraphics)과 헤드리스용 NullRenderDevice가 이 인터페이스를 구현합니다.
+        ///       장면은 그래픽 API를 직접 다루지 않고 이 인터페이스로 리소스 생성과 드로우를 제출합니다.
+        class IRenderDevice {
+        public:
+            virtual ~IRenderDevice() noexcept = default;
+
+            [[nodiscard]] virtual bool Initialize(void*, int32_t, int32_t, bool, bool) noexcept = 0;
+            [[nodiscard]] virtual bool IsVSyncEnabled() const noexcept = 0;
+
+            virtual void BeginFrame(float color[4]) noexcept = 0;
+            virtual void EndFrame() noexcept = 0;
+
+            [[nodiscard]] virtual bool Resize(int32_t, int32_t) noexcept = 0;
+
+            virtual void SetVSync(bool) noexcept = 0;
+
+            [[nodiscard]] virtual BufferHandle CreateBuffer(const BufferDesc&, const void*) noexcept = 0;
+            [[nodiscard]] virtual bool UpdateBuffer(BufferHandle, const void*, uint32_t) noexcept = 0;
+            virtual void DestroyBuffer(BufferHandle) noexcept = 0;
+
+            [[nodiscard]] virtual TextureHandle CreateTexture(const TextureDesc&, const void*) noexcept = 0;
+            virtual void DestroyTexture(TextureHandle) noexcept = 0;
+            [[nodiscard]] virtual bool IsTextureFormatSupported(TextureFormat) const noexcept = 0;
+
+            [[nodiscard]] virtual ShaderHandle CreateShader(const ShaderDesc&, const void*, size_t) noexcept = 0;
+            virtual void DestroyShader(ShaderHandle) noexcept = 0;
+
+            [[nodiscard]] virtual BlendStateHandle CreateBlendState(const BlendDesc&) noexcept = 0;
+            [[nodiscard]] virtual DepthStencilStateHandle CreateDepthStencilState(const DepthStencilDesc&) noexcept = 0;
+            [[nodiscard]] virtual RasterizerStateHandle CreateRasterizerState(const RasterizerDesc&) noexcept = 0;
+            [[nodiscard]] virtual SamplerHandle CreateSampler(const SamplerDesc&) noexcept = 0;
+            virtual void DestroyBlendState(BlendStateHandle) noexcept = 0;
+            virtual void DestroyDepthStencilState(DepthStencilStateHandle) noexcept = 0;
+            virtual void DestroyRasterizerState(RasterizerStateHandle) noexcept = 0;
+            virtual void DestroySampler(SamplerHandle) noexcept = 0;
+
+            [[nodiscard]] virtual TextureDesc GetBackBufferDesc() const noexcept = 0;
+            [[nodiscard]] virtual bool CopyBackBufferToTexture(TextureHandle) noexcept = 0;
+            [[nodiscard]] virtual bool CopyTextureToBackBuffer(TextureHandle) noexcept = 0;
+
+            virtual void SetVertexBuffer(BufferHandle) noexcept = 0;
+            virtual void SetIndexBuffer(BufferHandle, IndexFormat) noexcept = 0;
+            virtual void SetConstantBuffer(uint32_t, BufferHandle) noexcept = 0;
+            virtual void SetTexture(uint32_t, TextureHandle) noexcept = 0;
+            virtual void SetSampler(uint32_t, SamplerHandle) noexcept = 0;
+            virtual void SetShader(ShaderStage, ShaderHandle) noexcept = 0;
+            virtual void SetBlendState(BlendStateHandle) noexcept = 0;
+            virtual void SetDepthStencilState(DepthStencilStateHandle) noexcept = 0;
+            virtual void SetRasterizerState(RasterizerStateHandle) noexcept = 0;
+            virtual void SetPrimitiveTopology(PrimitiveTopology) noexcept = 0;
+
+            virtual void Draw(uint32_t, uint32_t) noexcept = 0;
+            virtual void DrawIndexed(uint32_t, uint32_t, int32_t) noexcept = 0;
+
+            [[nodiscard]] virtual const RenderStats& GetFrameStats() const noexcept = 0;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <vector>
+#include "MeshOptimizer.hpp"
+#include "RenderTypes.hpp"
+
+inline namespace neoxops {
+    namespace graphics {
+        /// @brief 메시 쿠킹 옵션
+        struct MeshCookOptions final {
+            uint32_t LodCount           = 4U;       ///< 최대 LOD 단계 수 (0단계 포함, 더 줄일 수 없으면 일찍 멈춤)
+            float LodReduction          = 0.5f;     ///< 단계마다 남길 삼각형 비율
+            float LodMaxError           = 0.02f;    ///< 단계마다 허용할 최대 오차 (메시 크기에 대한 비율)
+            bool OptimizeOverdraw       = true;     ///< 오버드로 최적화 여부
+            float OverdrawThreshold     = 1.05f;    ///< 오버드로 최적화에 내줄 ACMR 증가 비율
+        };
+
+        /// @brief 쿠킹된 메시 정점 (16바이트)
+        /// @note 입력 레이아웃은 R16G16B16A16_UNORM(위치), R10G10B10A2_UNORM(노멀), R16G16_FLOAT(텍스처 좌표)입니다.
+        ///       위치는 헤더의 PositionOffset + 값 * PositionScale로 되돌립니다. (셰이더 또는 월드 행렬에 합쳐서)
+        struct CookedMeshVertex final {
+            uint16_t X, Y, Z, W;                ///< 위치 (경계 상자 기준 UNORM16, W는 항상 0xFFFF)
+            uint32_t Normal;                    ///< 노멀 (n * 0.5 + 0.5, 10-10-10-2 UNORM)
+            uint16_t U, V;                      ///< 텍스처 좌표 (반정밀도 부동소수점)
+        };
+
+        /// @brief 쿠킹된 메시 LOD 단계
+        struct CookedMeshLod final {
+            uint32_t FirstSubset;               ///< 첫 범위 (범위 배열 기준)
+            uint32_t SubsetCount;               ///< 범위 수
+            float Error;                        ///< 원본 대비 최대 오차 (메시 크기에 대한 비율)
+            uint32_t IndexCount;                ///< 단계 전체 인덱스 수
+        };
+
+        /// @brief 쿠킹된 메시 파일 헤더
+        /// @note 헤더 뒤로 정점, 인덱스, LOD, 범위(MeshSubset) 배열이 각각 DATA_ALIGNMENT 정렬된 위치에 이어집니다.
+        ///       모든 LOD는 정점 버퍼 하나와 인덱스 버퍼 하나를 공유하므로, 파일을 한 번에 읽거나 메모리 매핑한 뒤
+        ///       정점, 인덱스 위치를 그대로 IRenderDevice::CreateBuffer에 넘기고 LOD별 범위로 그리면 됩니다.
+        struct CookedMeshHeader final {
+            uint32_t Magic;                     ///< 식별자 (MAGIC)
+            uint32_t Version;                   ///< 형식 버전 (VERSION)
+            uint32_t VertexCount;               ///< 정점 수
+            uint32_t VertexStride;              ///< 정점 크기 (sizeof(CookedMeshVertex))
+            uint32_t IndexCount;                ///< 인덱스 수 (모든 LOD 합)
+            uint32_t IndexFormat;               ///< 인덱스 형식 (IndexFormat, 정점이 65536개 이하면 16비트)
+            uint32_t LodCount;                  ///< LOD 단계 수
+            uint32_t SubsetCount;               ///< 범위 수 (모든 LOD 합)
+            float PositionOffset[3];            ///< 위치 복원 오프셋 (경계 상자 최소 좌표)
+            float PositionScale[3];             ///< 위치 복원 배율 (경계 상자 크기 / 65535)
+            uint64_t VertexOffset;              ///< 정점 위치 (파일 시작 기준)
+            uint64_t IndexOffset;               ///< 인덱스 위치
+            uint64_t LodOffset;                 ///< LOD 위치
+            uint64_t SubsetOffset;              ///< 범위 위치
+        };
+
+        /// @brief 메시 쿠커
+        /// @note 정점 캐시, 오버드로 순서로 삼각형을 정렬하고, 모서리 접기로 LOD 단계를 만든 뒤
+        ///       정점을 처음 쓰이는 순서로 배치하고 속성을 양자화하여(32바이트 -> 16바이트) 한 파일로 씁니다.
+        ///       오프라인(ModelCooker 도구)에서 한 번만 수행하고, 실행 중에는 ReadHeader로 검증한 뒤 그대로 올립니다.
+        class MeshCooker final {
+        public:
+            static constexpr uint32_t MAGIC             = 0x534D584EU;      ///< 'NXMS'
+            static constexpr uint32_t VERSION           = 1U;               ///< 형식 버전 (배치가 바뀌면 올림)
+            static constexpr uint32_t DATA_ALIGNMENT    = 64U;              ///< 배열 정렬 (캐시 라인)
+            static constexpr uint32_t MAX_LODS          = 8U;               ///< 최대 LOD 단계 수
+
+        public:
+            MeshCooker() noexcept = delete;
+
+            [[nodiscard]] static bool Cook(const MeshData&, const MeshCookOptions&, std::vector<byte_t>&) noexcept;
+            [[nodiscard]] static bool ReadHeader(const void*, size_t, CookedMeshHeader&) noexcept;
+
+            [[nodiscard]] static CookedMeshVertex EncodeVertex(const MeshVertex&, const float*, const float*) noexcept;
+            [[nodiscard]] static MeshVertex DecodeVertex(const CookedMeshVertex&, const CookedMeshHeader&) noexcept;
+        };
+    }
+}
\ No newline at end of file
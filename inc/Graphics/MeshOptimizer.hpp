@@ -0,0 +1,53 @@
+#pragma once
+
+#include <vector>
+#include "../Type/Types.hpp"
+#include "../Type/Vector3F.hpp"
+
+inline namespace neoxops {
+    namespace graphics {
+        /// @brief 메시 정점 (위치, 노멀, 텍스처 좌표를 교차 배치한 32바이트)
+        struct MeshVertex final {
+            float X, Y, Z;                      ///< 위치
+            float NX, NY, NZ;                   ///< 노멀
+            float U, V;                         ///< 텍스처 좌표
+        };
+
+        /// @brief 같은 재질을 쓰는 연속된 인덱스 범위
+        struct MeshSubset final {
+            uint32_t StartIndex;                ///< 시작 인덱스
+            uint32_t IndexCount;                ///< 인덱스 수
+            int32_t Material;                   ///< 재질 인덱스 (-1: 재질 없음)
+        };
+
+        /// @brief 업로드 준비가 끝난 메시
+        struct MeshData final {
+            std::vector<MeshVertex> Vertices;   ///< 정점
+            std::vector<uint32_t> Indices;      ///< 인덱스 (삼각형 목록)
+            std::vector<MeshSubset> Subsets;    ///< 재질별 범위
+            Vector3F Min;                       ///< 경계 상자 최소 좌표
+            Vector3F Max;                       ///< 경계 상자 최대 좌표
+        };
+
+        /// @brief 메시 최적화
+        /// @note 정점 캐시 최적화는 Forsyth의 선형 시간 알고리즘으로, 최근 쓴 정점을 공유하는 삼각형을 먼저 내보내
+        ///       GPU 정점 셰이더 캐시 적중률을 높입니다. 정점 가져오기 최적화는 정점을 처음 쓰이는 순서로 다시 배치하여
+        ///       정점 버퍼를 앞에서부터 순서대로 읽게 만듭니다. 두 최적화 모두 그려지는 결과는 바꾸지 않습니다.
+        ///       오버드로 최적화와 단순화(LOD 생성)는 시간이 걸리므로 MeshCooker에서 오프라인으로 수행합니다.
+        class MeshOptimizer final {
+        public:
+            static constexpr uint32_t CACHE_SIZE = 32U;     ///< 가정하는 정점 캐시 크기 (LRU)
+
+        public:
+            MeshOptimizer() noexcept = delete;
+
+            static void OptimizeVertexCache(uint32_t*, size_t, size_t) noexcept;
+            static void OptimizeOverdraw(uint32_t*, size_t, const MeshVertex*, size_t, float = 1.05f) noexcept;
+            [[nodiscard]] static size_t OptimizeVertexFetch(void*, size_t, size_t, uint32_t*, size_t) noexcept;
+            [[nodiscard]] static size_t Simplify(uint32_t*, const uint32_t*, size_t, const MeshVertex*, size_t, size_t, float, float* = nullptr) noexcept;
+            static void Optimize(MeshData&) noexcept;
+
+            [[nodiscard]] static float GetACMR(const uint32_t*, size_t, uint32_t = 16U) noexcept;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "IRenderDevice.hpp"
+#include "ResourceTable.hpp"
+
+inline namespace neoxops {
+    namespace graphics {
+        /// @brief 헤드리스 렌더 디바이스 클래스
+        /// @note GPU 없이 메인 루프를 구동하기 위한 기록용 구현입니다.
+        ///       실제로 그리지 않고 드로우 호출, 상태 변경, 업로드 바이트 수만 프레임 단위로 집계하므로
+        ///       CPU 측 제출 비용을 헤드리스 환경에서 측정할 수 있습니다.
+        class NullRenderDevice final : public IRenderDevice {
+        private:
+            ResourceTable<BufferDesc> m_Buffers;                        ///< 버퍼 목록
+            ResourceTable<TextureDesc> m_Textures;                      ///< 텍스처 목록
+            ResourceTable<ShaderDesc> m_Shaders;                        ///< 셰이더 목록
+            ResourceTable<BlendDesc> m_BlendStates;                     ///< 블렌드 상태 목록
+            ResourceTable<DepthStencilDesc> m_DepthStencilStates;       ///< 깊이 스텐실 상태 목록
+            ResourceTable<RasterizerDesc> m_RasterizerStates;           ///< 래스터라이저 상태 목록
+            ResourceTable<SamplerDesc> m_Samplers;                      ///< 샘플러 목록
+
+            RenderStats m_FrameStats;           ///< 집계 중인 프레임의 통계
+            RenderStats m_LastFrameStats;       ///< 마지막으로 완료된 프레임의 통계
+            RenderStats m_TotalStats;           ///< 누적 통계
+
+            int32_t m_Width;                    ///< 너비
+            int32_t m_Height;                   ///< 높이
+            uint64_t m_FrameCount;              ///< 제출된 프레임 수
+            bool m_VSyncEnabled;                ///< 수직 동기화 활성화 유무
+            bool m_InFrame;                     ///< 프레임 진행 중 여부
+
+        public:
+            NullRenderDevice() noexcept;
+            NullRenderDevice(const NullRenderDevice&) noexcept = delete;
+            NullRenderDevice(NullRenderDevice&&) noexcept = delete;
+            ~NullRenderDevice() noexcept override;
+
+            [[nodiscard]] bool Initialize(void*, int32_t, int32_t, bool, bool) noexcept override;
+            [[nodiscard]] bool IsVSyncEnabled() const noexcept override;
+
+            void BeginFrame(float color[4]) noexcept override;
+            void EndFrame() noexcept override;
+
+            [[nodiscard]] bool Resize(int32_t, int32_t) noexcept override;
+
+            void SetVSync(bool) noexcept override;
+
+            [[nodiscard]] BufferHandle CreateBuffer(const BufferDesc&, const void*) noexcept override;
+            [[nodiscard]] bool UpdateBuffer(BufferHandle, const void*, uint32_t) noexcept override;
+            void DestroyBuffer(BufferHandle) noexcept override;
+
+            [[nodiscard]] TextureHandle CreateTexture(const TextureDesc&, const void*) noexcept override;
+            void DestroyTexture(TextureHandle) noexcept override;
+            [[nodiscard]] bool IsTextureFormatSupported(TextureFormat) const noexcept override;
+
+            [[nodiscard]] ShaderHandle CreateShader(const ShaderDesc&, const void*, size_t) noexcept override;
+            void DestroyShader(ShaderHandle) noexcept override;
+
+            [[nodiscard]] BlendStateHandle CreateBlendState(const BlendDesc&) noexcept override;
+            [[nodiscard]] DepthStencilStateHandle CreateDepthStencilState(const DepthStencilDesc&) noexcept override;
+            [[nodiscard]] RasterizerStateHandle CreateRasterizerState(const RasterizerDesc&) noexcept override;
+            [[nodiscard]] SamplerHandle CreateSampler(const SamplerDesc&) noexcept override;
+            void DestroyBlendState(BlendStateHandle) noexcept override;
+            void DestroyDepthStencilState(DepthStencilStateHandle) noexcept override;
+            void DestroyRasterizerState(RasterizerStateHandle) noexcept override;
+            void DestroySampler(SamplerHandle) noexcept override;
+
+            [[nodiscard]] TextureDesc GetBackBufferDesc() const noexcept override;
+            [[nodiscard]] bool CopyBackBufferToTexture(TextureHandle) noexcept override;
+            [[nodiscard]] bool CopyTextureToBackBuffer(TextureHandle) noexcept override;
+
+            void SetVertexBuffer(BufferHandle) noexcept override;
+            void SetIndexBuffer(BufferHandle, IndexFormat) noexcept override;
+            void SetConstantBuffer(uint32_t, BufferHandle) noexcept override;
+            void SetTexture(uint32_t, TextureHandle) noexcept override;
+            void SetSampler(uint32_t, SamplerHandle) noexcept override;
+            void SetShader(ShaderStage, ShaderHandle) noexcept override;
+            void SetBlendState(BlendStateHandle) noexcept override;
+            void SetDepthStencilState(DepthStencilStateHandle) noexcept override;
+            void SetRasterizerState(RasterizerStateHandle) noexcept override;
+            void SetPrimitiveTopology(PrimitiveTopology) noexcept override;
+
+            void Draw(uint32_t, uint32_t) noexcept override;
+            void DrawIndexed(uint32_t, uint32_t, int32_t) noexcept override;
+
+            [[nodiscard]] const RenderStats& GetFrameStats() const noexcept override;
+            [[nodiscard]] const RenderStats& GetTotalStats() const noexcept;
+            [[nodiscard]] uint64_t GetFrameCount() const noexcept;
+            [[nodiscard]] uint32_t GetBufferCount() const noexcept;
+            [[nodiscard]] uint32_t GetTextureCount() const noexcept;
+
+            NullRenderDevice& operator=(const NullRenderDevice&) noexcept = delete;
+            NullRenderDevice& operator=(NullRenderDevice&&) noexcept = delete;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <unordered_map>
+#include "IRenderDevice.hpp"
+
+inline namespace neoxops {
+    namespace graphics {
+        /// @brief 파이프라인 상태 설명
+        struct PipelineDesc final {
+            ShaderHandle VertexShader;                                      ///< 정점 셰이더
+            ShaderHandle PixelShader;                                       ///< 픽셀 셰이더
+            BlendDesc Blend;                                                ///< 블렌드 상태
+            DepthStencilDesc DepthStencil;                                  ///< 깊이 스텐실 상태
+            RasterizerDesc Rasterizer;                                      ///< 래스터라이저 상태
+            PrimitiveTopology Topology = PrimitiveTopology::TriangleList;   ///< 프리미티브 토폴로지
+        };
+
+        /// @brief 생성이 끝난 파이프라인 상태
+        /// @note 상태 객체는 캐시가 소유하므로 값으로 복사해 보관해도 되며, 캐시가 살아있는 동안 유효합니다.
+        struct PipelineState final {
+            ShaderHandle VertexShader;                                      ///< 정점 셰이더
+            ShaderHandle PixelShader;                                       ///< 픽셀 셰이더
+            BlendStateHandle Blend;                                         ///< 블렌드 상태
+            DepthStencilStateHandle DepthStencil;                           ///< 깊이 스텐실 상태
+            RasterizerStateHandle Rasterizer;                               ///< 래스터라이저 상태
+            PrimitiveTopology Topology = PrimitiveTopology::TriangleList;   ///< 프리미티브 토폴로지
+        };
+
+        /// @brief 파이프라인 상태 캐시 통계
+        struct PipelineCacheStats final {
+            uint64_t Hits = 0ULL;               ///< 기존 상태 객체를 재사용한 횟수
+            uint64_t Misses = 0ULL;             ///< 상태 객체를 새로 만든 횟수
+            uint64_t Failures = 0ULL;           ///< 생성에 실패한 횟수
+            uint32_t StateCount = 0U;           ///< 보관 중인 상태 객체 수
+        };
+
+        /// @brief 변경 불가 파이프라인 상태 캐시
+        /// @note 블렌드, 깊이 스텐실, 래스터라이저, 샘플러 상태를 설명으로 요청하면 처음 한 번만 디바이스에서 만들고 이후에는 같은 핸들을 돌려줍니다.
+        ///       설명은 64비트 키로 빈틈없이 압축되므로 해시 충돌 없이 설명이 같으면 키도 같습니다.
+        ///       상태 객체는 종류마다 수십 개 수준이므로 해제하지 않고 캐시가 소멸할 때 한꺼번에 해제합니다.
+        ///       디바이스를 쓰므로 렌더 스레드에서만 호출해주세요.
+        class PipelineStateCache final {
+        private:
+            IRenderDevice& m_Device;                                                    ///< 렌더 디바이스
+            std::unordered_map<uint64_t, BlendStateHandle> m_BlendStates;               ///< 키 → 블렌드 상태
+            std::unordered_map<uint64_t, DepthStencilStateHandle> m_DepthStencilStates; ///< 키 → 깊이 스텐실 상태
+            std::unordered_map<uint64_t, RasterizerStateHandle> m_RasterizerStates;     ///< 키 → 래스터라이저 상태
+            std::unordered_map<uint64_t, SamplerHandle> m_Samplers;                     ///< 키 → 샘플러
+            uint64_t m_Hits;                                                            ///< 재사용 횟수
+            uint64_t m_Misses;                                                          ///< 생성 횟수
+            uint64_t m_Failures;                                                        ///< 실패 횟수
+
+        public:
+            explicit PipelineStateCache(IRenderDevice&) noexcept;
+            PipelineStateCache(const PipelineStateCache&) noexcept = delete;
+            PipelineStateCache(PipelineStateCache&&) noexcept = delete;
+            ~PipelineStateCache() noexcept;
+
+            [[nodiscard]] BlendStateHandle GetBlendState(const BlendDesc&) noexcept;
+            [[nodiscard]] DepthStencilStateHandle GetDepthStencilState(const DepthStencilDesc&) noexcept;
+            [[nodiscard]] RasterizerStateHandle GetRasterizerState(const RasterizerDesc&) noexcept;
+            [[nodiscard]] SamplerHandle GetSampler(const SamplerDesc&) noexcept;
+            [[nodiscard]] bool GetPipeline(const PipelineDesc&, PipelineState&) noexcept;
+
+            [[nodiscard]] PipelineCacheStats GetStats() const noexcept;
+
+            static void Bind(IRenderDevice&, const PipelineState&) noexcept;
+
+            PipelineStateCache& operator=(const PipelineStateCache&) noexcept = delete;
+            PipelineStateCache& operator=(PipelineStateCache&&) noexcept = delete;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "IRenderDevice.hpp"
+
+inline namespace neoxops {
+    namespace graphics {
+        /// @brief 바인딩 필터 통계
+        struct RenderContextStats final {
+            uint32_t Issued = 0U;               ///< 디바이스로 전달한 바인딩 호출 수
+            uint32_t Filtered = 0U;             ///< 이미 바인딩되어 있어 걸러낸 호출 수
+        };
+
+        /// @brief 중복 바인딩을 걸러내는 렌더 디바이스 래퍼
+        /// @note 디바이스에 바인딩된 상태의 사본을 들고 있다가, 이미 바인딩된 버퍼, 텍스처, 셰이더, 상태 객체를 다시 바인딩하는 호출은 디바이스로 전달하지 않습니다.
+        ///       나머지 호출은 그대로 전달하므로 장면은 IRenderDevice로 그대로 쓰면 되며, 백엔드와 관계없이 같은 결과를 얻습니다.
+        ///       사본은 BeginFrame마다 비우므로 프레임의 첫 바인딩은 항상 전달됩니다.
+        ///       래퍼를 거치지 않고 디바이스를 직접 바인딩했다면 Invalidate를 호출해주세요.
+        ///       걸러내서 아끼는 시간은 바인딩 비용이 있는 D3D11 디바이스에서만 생깁니다. NullRenderDevice는 바인딩 수만 세고
+        ///       SoftwareRenderDevice는 샘플러와 블렌드, 깊이, 래스터라이저 상태 객체를 무시하므로, 두 디바이스에서는 비교 비용만 더해집니다.
+        class RenderContext final : public IRenderDevice {
+        public:
+            static constexpr uint32_t MAX_CONSTANT_BUFFERS  = 14U;      ///< 추적하는 상수 버퍼 슬롯 수 (D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT)
+            static constexpr uint32_t MAX_TEXTURES          = 16U;      ///< 추적하는 텍스처 슬롯 수 (이후 슬롯은 걸러내지 않음)
+            static constexpr uint32_t MAX_SAMPLERS          = 16U;      ///< 추적하는 샘플러 슬롯 수 (D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT)
+
+        private:
+            static constexpr uint32_t UNKNOWN = 0xFFFFFFFFU;            ///< 알 수 없는 바인딩 (ResourceTable이 만들지 않는 식별자)
+
+            IRenderDevice& m_Device;                                    ///< 렌더 디바이스
+
+            uint32_t m_VertexBuffer;                                    ///< 바인딩된 정점 버퍼
+            uint32_t m_IndexBuffer;                                     ///< 바인딩된 인덱스 버퍼
+            uint32_t m_IndexFormat;                                     ///< 바인딩된 인덱스 형식
+            uint32_t m_ConstantBuffers[MAX_CONSTANT_BUFFERS];           ///< 바인딩된 상수 버퍼
+            uint32_t m_Textures[MAX_TEXTURES];                          ///< 바인딩된 텍스처
+            uint32_t m_Samplers[MAX_SAMPLERS];                          ///< 바인딩된 샘플러
+            uint32_t m_VertexShader;                                    ///< 바인딩된 정점 셰이더
+            uint32_t m_PixelShader;                                     ///< 바인딩된 픽셀 셰이더
+            uint32_t m_BlendState;                                      ///< 바인딩된 블렌드 상태
+            uint32_t m_DepthStencilState;                               ///< 바인딩된 깊이 스텐실 상태
+            uint32_t m_RasterizerState;                                 ///< 바인딩된 래스터라이저 상태
+            uint32_t m_Topology;                                        ///< 바인딩된 프리미티브 토폴로지
+
+            RenderContextStats m_FrameStats;                            ///< 집계 중인 프레임의 통계
+            RenderContextStats m_LastFrameStats;                        ///< 마지막으로 완료된 프레임의 통계
+
+            [[nodiscard]] bool filter(uint32_t&, uint32_t) noexcept;
+
+        public:
+            explicit RenderContext(IRenderDevice&) noexcept;
+            RenderContext(const RenderContext&) noexcept = delete;
+            RenderContext(RenderContext&&) noexcept = delete;
+            ~RenderContext() noexcept override = default;
+
+            [[nodiscard]] bool Initialize(void*, int32_t, int32_t, bool, bool) noexcept override;
+            [[nodiscard]] bool IsVSyncEnabled() const noexcept override;
+
+            void BeginFrame(float color[4]) noexcept override;
+            void EndFrame() noexcept override;
+
+            [[nodiscard]] bool Resize(int32_t, int32_t) noexcept override;
+
+            void SetVSync(bool) noexcept override;
+
+            [[nodiscard]] BufferHandle CreateBuffer(const BufferDesc&, const void*) noexcept override;
+            [[nodiscard]] bool UpdateBuffer(BufferHandle, const void*, uint32_t) noexcept override;
+            void DestroyBuffer(BufferHandle) noexcept override;
+
+            [[nodiscard]] TextureHandle CreateTexture(const TextureDesc&, const void*) noexcept override;
+            void DestroyTexture(TextureHandle) noexcept override;
+            [[nodiscard]] bool IsTextureFormatSupported(TextureFormat) const noexcept override;
+
+            [[nodiscard]] ShaderHandle CreateShader(const ShaderDesc&, const void*, size_t) noexcept override;
+            void DestroyShader(ShaderHandle) noexcept override;
+
+            [[nodiscard]] BlendStateHandle CreateBlendState(const BlendDesc&) noexcept override;
+            [[nodiscard]] DepthStencilStateHandle CreateDepthStencilState(const DepthStencilDesc&) noexcept override;
+            [[nodiscard]] RasterizerStateHandle CreateRasterizerState(const RasterizerDesc&) noexcept override;
+            [[nodiscard]] SamplerHandle CreateSampler(const SamplerDesc&) noexcept override;
+            void DestroyBlendState(BlendStateHandle) noexcept override;
+            void DestroyDepthStencilState(DepthStencilStateHandle) noexcept override;
+            void DestroyRasterizerState(RasterizerStateHandle) noexcept override;
+            void DestroySampler(SamplerHandle) noexcept override;
+
+            [[nodiscard]] TextureDesc GetBackBufferDesc() const noexcept override;
+            [[nodiscard]] bool CopyBackBufferToTexture(TextureHandle) noexcept override;
+            [[nodiscard]] bool CopyTextureToBackBuffer(TextureHandle) noexcept override;
+
+            void SetVertexBuffer(BufferHandle) noexcept override;
+            void SetIndexBuffer(BufferHandle, IndexFormat) noexcept override;
+            void SetConstantBuffer(uint32_t, BufferHandle) noexcept override;
+            void SetTexture(uint32_t, TextureHandle) noexcept override;
+            void SetSampler(uint32_t, SamplerHandle) noexcept override;
+            void SetShader(ShaderStage, ShaderHandle) noexcept override;
+            void SetBlendState(BlendStateHandle) noexcept override;
+            void SetDepthStencilState(DepthStencilStateHandle) noexcept override;
+            void SetRasterizerState(RasterizerStateHandle) noexcept override;
+            void SetPrimitiveTopology(PrimitiveTopology) noexcept override;
+
+            void Draw(uint32_t, uint32_t) noexcept override;
+            void DrawIndexed(uint32_t, uint32_t, int32_t) noexcept override;
+
+            [[nodiscard]] const RenderStats& GetFrameStats() const noexcept override;
+
+            void Invalidate() noexcept;
+
+            /// @brief 마지막으로 완료된 프레임의 바인딩 필터 통계를 취득합니다.
+            /// @return 통계
+            [[nodiscard]] const RenderContextStats& GetFilterStats() const noexcept { return m_LastFrameStats; }
+
+            /// @brief 감싼 렌더 디바이스를 취득합니다.
+            /// @return 렌더 디바이스
+            [[nodiscard]] IRenderDevice& GetDevice() const noexcept { return m_Device; }
+
+            RenderContext& operator=(const RenderContext&) noexcept = delete;
+            RenderContext& operator=(RenderContext&&) noexcept = delete;
+        };
+    }
+}
\ No newline at end of file
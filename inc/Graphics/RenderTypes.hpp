@@ -0,0 +1,380 @@
+#pragma once
+
+#include "../Type/Types.hpp"
+
+inline namespace neoxops {
+    namespace graphics {
+        /// @brief 버퍼 핸들
+        struct BufferHandle final {
+            uint32_t ID = 0U;                   ///< 식별자 (0: 무효)
+
+            /// @brief 유효성 검사
+            /// @return 유효(true), 무효(false)
+            [[nodiscard]] constexpr bool IsValid() const noexcept { return ID != 0U; }
+
+            friend constexpr bool operator==(const BufferHandle& lhs, const BufferHandle& rhs) noexcept { return lhs.ID == rhs.ID; }
+            friend constexpr bool operator!=(const BufferHandle& lhs, const BufferHandle& rhs) noexcept { return lhs.ID != rhs.ID; }
+        };
+
+        /// @brief 텍스처 핸들
+        struct TextureHandle final {
+            uint32_t ID = 0U;                   ///< 식별자 (0: 무효)
+
+            /// @brief 유효성 검사
+            /// @return 유효(true), 무효(false)
+            [[nodiscard]] constexpr bool IsValid() const noexcept { return ID != 0U; }
+
+            friend constexpr bool operator==(const TextureHandle& lhs, const TextureHandle& rhs) noexcept { return lhs.ID == rhs.ID; }
+            friend constexpr bool operator!=(const TextureHandle& lhs, const TextureHandle& rhs) noexcept { return lhs.ID != rhs.ID; }
+        };
+
+        /// @brief 셰이더 핸들
+        struct ShaderHandle final {
+            uint32_t ID = 0U;                   ///< 식별자 (0: 무효)
+
+            /// @brief 유효성 검사
+            /// @return 유효(true), 무효(false)
+            [[nodiscard]] constexpr bool IsValid() const noexcept { return ID != 0U; }
+
+            friend constexpr bool operator==(const ShaderHandle& lhs, const ShaderHandle& rhs) noexcept { return lhs.ID == rhs.ID; }
+            friend constexpr bool operator!=(const ShaderHandle& lhs, const ShaderHandle& rhs) noexcept { return lhs.ID != rhs.ID; }
+        };
+
+        /// @brief 블렌드 상태 핸들
+        struct BlendStateHandle final {
+            uint32_t ID = 0U;                   ///< 식별자 (0: 무효)
+
+            /// @brief 유효성 검사
+            /// @return 유효(true), 무효(false)
+            [[nodiscard]] constexpr bool IsValid() const noexcept { return ID != 0U; }
+
+            friend constexpr bool operator==(const BlendStateHandle& lhs, const BlendStateHandle& rhs) noexcept { return lhs.ID == rhs.ID; }
+            friend constexpr bool operator!=(const BlendStateHandle& lhs, const BlendStateHandle& rhs) noexcept { return lhs.ID != rhs.ID; }
+        };
+
+        /// @brief 깊이 스텐실 상태 핸들
+        struct DepthStencilStateHandle final {
+            uint32_t ID = 0U;                   ///< 식별자 (0: 무효)
+
+            /// @brief 유효성 검사
+            /// @return 유효(true), 무효(false)
+            [[nodiscard]] constexpr bool IsValid() const noexcept { return ID != 0U; }
+
+            friend constexpr bool operator==(const DepthStencilStateHandle& lhs, const DepthStencilStateHandle& rhs) noexcept { return lhs.ID == rhs.ID; }
+            friend constexpr bool operator!=(const DepthStencilStateHandle& lhs, const DepthStencilStateHandle& rhs) noexcept { return lhs.ID != rhs.ID; }
+        };
+
+        /// @brief 래스터라이저 상태 핸들
+        struct RasterizerStateHandle final {
+            uint32_t ID = 0U;                   ///< 식별자 (0: 무효)
+
+            /// @brief 유효성 검사
+            /// @return 유효(true), 무효(false)
+            [[nodiscard]] constexpr bool IsValid() const noexcept { return ID != 0U; }
+
+            friend constexpr bool operator==(const RasterizerStateHandle& lhs, const RasterizerStateHandle& rhs) noexcept { return lhs.ID == rhs.ID; }
+            friend constexpr bool operator!=(const RasterizerStateHandle& lhs, const RasterizerStateHandle& rhs) noexcept { return lhs.ID != rhs.ID; }
+        };
+
+        /// @brief 샘플러 핸들
+        struct SamplerHandle final {
+            uint32_t ID = 0U;                   ///< 식별자 (0: 무효)
+
+            /// @brief 유효성 검사
+            /// @return 유효(true), 무효(false)
+            [[nodiscard]] constexpr bool IsValid() const noexcept { return ID != 0U; }
+
+            friend constexpr bool operator==(const SamplerHandle& lhs, const SamplerHandle& rhs) noexcept { return lhs.ID == rhs.ID; }
+            friend constexpr bool operator!=(const SamplerHandle& lhs, const SamplerHandle& rhs) noexcept { return lhs.ID != rhs.ID; }
+        };
+
+        /// @brief 버퍼 종류
+        enum class BufferType : uint8_t {
+            Vertex,                             ///< 정점 버퍼
+            Index,                              ///< 인덱스 버퍼
+            Constant                            ///< 상수 버퍼
+        };
+
+        /// @brief 버퍼 사용 방식
+        enum class BufferUsage : uint8_t {
+            Immutable,                          ///< 생성 후 변경 불가
+            Default,                            ///< 가끔 갱신 (UpdateSubresource)
+            Dynamic                             ///< 매 프레임 갱신 (Map/Discard)
+        };
+
+        /// @brief 인덱스 형식
+        enum class IndexFormat : uint8_t {
+            UInt16,
+            UInt32
+        };
+
+        /// @brief 텍스처 형식
+        enum class TextureFormat : uint8_t {
+            RGBA8,                              ///< DXGI_FORMAT_R8G8B8A8_UNORM
+            BGRA8,                              ///< DXGI_FORMAT_B8G8R8A8_UNORM
+            BC1,                                ///< DXGI_FORMAT_BC1_UNORM (4x4 블록당 8바이트, 1비트 알파)
+            BC3,                                ///< DXGI_FORMAT_BC3_UNORM (4x4 블록당 16바이트, 8비트 알파)
+            BC7                                 ///< DXGI_FORMAT_BC7_UNORM (4x4 블록당 16바이트, 고품질)
+        };
+
+        /// @brief 프리미티브 토폴로지
+        enum class PrimitiveTopology : uint8_t {
+            TriangleList,
+            TriangleStrip,
+            LineList,
+            PointList
+        };
+
+        /// @brief 블렌드 계수
+        enum class BlendFactor : uint8_t {
+            Zero,
+            One,
+            SrcColor,
+            InvSrcColor,
+            SrcAlpha,
+            InvSrcAlpha,
+            DestColor,
+            InvDestColor,
+            DestAlpha,
+            InvDestAlpha
+        };
+
+        /// @brief 블렌드 연산
+        enum class BlendOp : uint8_t {
+            Add,
+            Subtract,
+            ReverseSubtract,
+            Min,
+            Max
+        };
+
+        /// @brief 비교 함수
+        enum class CompareFunc : uint8_t {
+            Never,
+            Less,
+            Equal,
+            LessEqual,
+            Greater,
+            NotEqual,
+            GreaterEqual,
+            Always
+        };
+
+        /// @brief 채우기 방식
+        enum class FillMode : uint8_t {
+            Solid,
+            Wireframe
+        };
+
+        /// @brief 컬링 방식
+        enum class CullMode : uint8_t {
+            None,
+            Front,
+            Back
+        };
+
+        /// @brief 텍스처 필터
+        enum class TextureFilter : uint8_t {
+            Point,
+            Linear,
+            Anisotropic
+        };
+
+        /// @brief 텍스처 주소 지정 방식
+        enum class TextureAddress : uint8_t {
+            Wrap,
+            Mirror,
+            Clamp
+        };
+
+        /// @brief 셰이더 단계
+        enum class ShaderStage : uint8_t {
+            Vertex,                             ///< 정점 셰이더
+            Pixel                               ///< 픽셀 셰이더
+        };
+
+        /// @brief 정점 입력 배치 (정점 셰이더 전용)
+        enum class VertexLayout : uint8_t {
+            None,                               ///< 입력 없음 (SV_VertexID로 생성)
+            PositionColorUV,                    ///< POSITION(float3), COLOR(R8G8B8A8_UNORM), TEXCOORD(float2) 24바이트 (SoftwareVertex, WorldVertex)
+            Mesh,                               ///< POSITION(float3), NORMAL(float3), TEXCOORD(float2) 32바이트 (MeshVertex)
+            CookedMesh                          ///< POSITION(R16G16B16A16_UNORM), NORMAL(R10G10B10A2_UNORM), TEXCOORD(R16G16_FLOAT) 16바이트 (CookedMeshVertex)
+        };
+
+        /// @brief 버퍼 설명
+        struct BufferDesc final {
+            BufferType Type     = BufferType::Vertex;       ///< 버퍼 종류
+            BufferUsage Usage   = BufferUsage::Default;     ///< 사용 방식
+            uint32_t Size       = 0U;                       ///< 크기 (바이트 단위)
+            uint32_t Stride     = 0U;                       ///< 요소 하나의 크기 (정점 버퍼 전용)
+        };
+
+        /// @brief 텍스처 설명
+        struct TextureDesc final {
+            int32_t Width           = 0;                        ///< 너비
+            int32_t Height          = 0;                        ///< 높이
+            TextureFormat Format    = TextureFormat::RGBA8;     ///< 형식
+            uint32_t MipLevels      = 1U;                       ///< 밉맵 단계 수 (초기 데이터는 0단계부터 행 간격 없이 연속)
+        };
+
+        /// @brief 셰이더 설명
+        /// @note 셰이더 코드는 오프라인에서 컴파일한 바이트 코드(Direct3D 11: DXBC)로 넘깁니다.
+        struct ShaderDesc final {
+            ShaderStage Stage       = ShaderStage::Vertex;      ///< 단계
+            VertexLayout Layout     = VertexLayout::None;       ///< 정점 입력 배치 (정점 셰이더 전용)
+        };
+
+        /// @brief 블렌드 상태 설명 (렌더 타깃 0)
+        struct BlendDesc final {
+            bool BlendEnabled       = false;                    ///< 블렌드 활성화 유무
+            BlendFactor SrcColor    = BlendFactor::One;         ///< 원본 색상 계수
+            BlendFactor DestColor   = BlendFactor::Zero;        ///< 대상 색상 계수
+            BlendOp ColorOp         = BlendOp::Add;             ///< 색상 연산
+            BlendFactor SrcAlpha    = BlendFactor::One;         ///< 원본 알파 계수
+            BlendFactor DestAlpha   = BlendFactor::Zero;        ///< 대상 알파 계수
+            BlendOp AlphaOp         = BlendOp::Add;             ///< 알파 연산
+            uint8_t WriteMask       = 0x0FU;                    ///< 쓰기 마스크 (R: 0x01, G: 0x02, B: 0x04, A: 0x08)
+        };
+
+        /// @brief 깊이 스텐실 상태 설명
+        /// @note 스텐실은 사용하지 않습니다. (무효 핸들을 바인딩하면 디바이스의 기본 상태로 돌아감)
+        struct DepthStencilDesc final {
+            bool DepthEnabled       = true;                     ///< 깊이 검사 활성화 유무
+            bool DepthWriteEnabled  = true;                     ///< 깊이 쓰기 활성화 유무
+            CompareFunc DepthFunc   = CompareFunc::Less;        ///< 깊이 비교 함수
+        };
+
+        /// @brief 래스터라이저 상태 설명
+        struct RasterizerDesc final {
+            FillMode Fill               = FillMode::Solid;      ///< 채우기 방식
+            CullMode Cull               = CullMode::Back;       ///< 컬링 방식
+            bool FrontCounterClockwise  = false;                ///< 반시계 방향을 앞면으로 취급
+            bool DepthClipEnabled       = true;                 ///< 깊이 클리핑 활성화 유무
+            bool ScissorEnabled         = false;                ///< 시저 검사 활성화 유무
+            int32_t DepthBias           = 0;                    ///< 깊이 바이어스
+        };
+
+        /// @brief 샘플러 설명
+        struct SamplerDesc final {
+            TextureFilter Filter        = TextureFilter::Linear;    ///< 필터
+            TextureAddress AddressU     = TextureAddress::Wrap;     ///< U 방향 주소 지정 방식
+            TextureAddress AddressV     = TextureAddress::Wrap;     ///< V 방향 주소 지정 방식
+            uint8_t MaxAnisotropy       = 1U;                       ///< 최대 비등방성 (1 ~ 16, Anisotropic 전용)
+        };
+
+        /// @brief 프레임 단위 렌더링 통계
+        struct RenderStats final {
+            uint32_t DrawCalls          = 0U;       ///< 드로우 호출 수
+            uint64_t Vertices           = 0ULL;     ///< 제출된 정점(인덱스) 수
+            uint32_t StateChanges       = 0U;       ///< 상태 변경 호출 수 (버퍼, 텍스처, 셰이더, 상태 객체, 토폴로지 바인딩)
+            uint64_t BytesUploaded      = 0ULL;     ///< 업로드된 바이트 수 (생성, 갱신 포함)
+            uint32_t BuffersCreated     = 0U;       ///< 생성된 버퍼 수
+            uint32_t TexturesCreated    = 0U;       ///< 생성된 텍스처 수
+            uint32_t ShadersCreated     = 0U;       ///< 생성된 셰이더 수
+            uint32_t StatesCreated      = 0U;       ///< 생성된 상태 객체 수 (블렌드, 깊이 스텐실, 래스터라이저, 샘플러)
+        };
+
+        /// @brief 블록 압축 형식인지 확인합니다.
+        /// @param format 텍스처 형식
+        /// @return 블록 압축(true), 픽셀 단위(false)
+        [[nodiscard]] constexpr bool IsBlockCompressed(TextureFormat format) noexcept {
+            return format == TextureFormat::BC1 || format == TextureFormat::BC3 || format == TextureFormat::BC7;
+        }
+
+        /// @brief 텍스처 형식의 픽셀당 바이트 수를 취득합니다.
+        /// @param format 텍스처 형식
+        /// @return 바이트 수 (블록 압축 형식은 0)
+        [[nodiscard]] constexpr uint32_t GetBytesPerPixel(TextureFormat format) noexcept {
+            switch (format) {
+                case TextureFormat::RGBA8:
+                case TextureFormat::BGRA8:
+                    return 4U;
+                case TextureFormat::BC1:
+                case TextureFormat::BC3:
+                case TextureFormat::BC7:
+                    return 0U;
+            }
+
+            return 0U;
+        }
+
+        /// @brief 행 하나(블록 압축 형식은 4픽셀 높이의 블록 행 하나)의 바이트 수를 취득합니다.
+        /// @param format 텍스처 형식
+        /// @param width 너비
+        /// @return 바이트 수
+        [[nodiscard]] constexpr uint32_t GetRowPitch(TextureFormat format, int32_t width) noexcept {
+            const uint32_t w = (width > 0) ? static_cast<uint32_t>(width) : 0U;
+            switch (format) {
+                case TextureFormat::BC1:
+                    return ((w + 3U) / 4U) * 8U;
+                case TextureFormat::BC3:
+                case TextureFormat::BC7:
+                    return ((w + 3U) / 4U) * 16U;
+                default:
+                    return w * GetBytesPerPixel(format);
+            }
+        }
+
+        /// @brief 행(블록 압축 형식은 블록 행) 수를 취득합니다.
+        /// @param format 텍스처 형식
+        /// @param height 높이
+        /// @return 행 수
+        [[nodiscard]] constexpr uint32_t GetRowCount(TextureFormat format, int32_t height) noexcept {
+            const uint32_t h = (height > 0) ? static_cast<uint32_t>(height) : 0U;
+            return IsBlockCompressed(format) ? (h + 3U) / 4U : h;
+        }
+
+        /// @brief 밉맵 단계의 크기(너비 또는 높이)를 취득합니다.
+        /// @param size 0단계 크기
+        /// @param level 밉맵 단계
+        /// @return 크기 (최소 1)
+        [[nodiscard]] constexpr int32_t GetMipSize(int32_t size, uint32_t level) noexcept {
+            const int32_t mip = (level < 31U) ? (size >> level) : 0;
+            return (mip > 0) ? mip : 1;
+        }
+
+        /// @brief 전체 밉맵 단계 수를 취득합니다. (1x1까지)
+        /// @param width 너비
+        /// @param height 높이
+        /// @return 밉맵 단계 수
+        [[nodiscard]] constexpr uint32_t GetFullMipLevels(int32_t width, int32_t height) noexcept {
+            int32_t size = (width > height) ? width : height;
+            uint32_t levels = 1U;
+            while (size > 1) {
+                size >>= 1;
+                ++levels;
+            }
+            return levels;
+        }
+
+        /// @brief 텍스처 전체(모든 밉맵 단계)의 초기 데이터 크기를 취득합니다.
+        /// @param desc 텍스처 설명
+        /// @return 바이트 수
+        [[nodiscard]] constexpr uint64_t GetTextureDataSize(const TextureDesc& desc) noexcept {
+            uint64_t size = 0ULL;
+            for (uint32_t level = 0U; level < desc.MipLevels; ++level) {
+                size += static_cast<uint64_t>(GetRowPitch(desc.Format, GetMipSize(desc.Width, level))) * GetRowCount(desc.Format, GetMipSize(desc.Height, level));
+            }
+            return size;
+        }
+
+        constexpr int32_t MAX_TEXTURE_SIZE = 16384;     ///< 텍스처 한 변의 최대 크기 (Direct3D 11 한도, 행 바이트 수가 32비트를 넘지 않음)
+
+        /// @brief 텍스처 설명이 유효한지 확인합니다.
+        /// @param desc 텍스처 설명
+        /// @return 유효(true), 무효(false)
+        /// @note 블록 압축 형식은 Direct3D 11과 같이 0단계 너비와 높이가 4의 배수여야 합니다.
+        [[nodiscard]] constexpr bool IsValidTextureDesc(const TextureDesc& desc) noexcept {
+            if (desc.Width <= 0 || desc.Height <= 0 || desc.Width > MAX_TEXTURE_SIZE || desc.Height > MAX_TEXTURE_SIZE) {
+                return false;
+            }
+            if (desc.MipLevels == 0U || desc.MipLevels > GetFullMipLevels(desc.Width, desc.Height)) {
+                return false;
+            }
+            if (IsBlockCompressed(desc.Format) && ((desc.Width % 4) != 0 || (desc.Height % 4) != 0)) {
+                return false;
+            }
+            return true;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "IRenderDevice.hpp"
+
+inline namespace neoxops {
+    namespace graphics {
+        /// @brief GPU 리소스 사용량
+        struct ResourceUsage final {
+            uint64_t TextureBytes = 0ULL;       ///< 텍스처 크기 합 (해제 대기 포함)
+            uint64_t BufferBytes = 0ULL;        ///< 버퍼 크기 합 (해제 대기 포함)
+            uint64_t ShaderBytes = 0ULL;        ///< 셰이더 바이트 코드 크기 합 (해제 대기 포함)
+            uint64_t PendingBytes = 0ULL;       ///< 해제 대기 중인 크기 합
+            uint64_t SharedBytes = 0ULL;        ///< 중복 제거로 업로드하지 않은 크기 합 (누적)
+            uint32_t TextureCount = 0U;         ///< 텍스처 수
+            uint32_t BufferCount = 0U;          ///< 버퍼 수
+            uint32_t ShaderCount = 0U;          ///< 셰이더 수
+            uint32_t PendingCount = 0U;         ///< 해제 대기 중인 리소스 수
+            uint64_t SharedCount = 0ULL;        ///< 기존 리소스를 공유한 횟수 (누적, 해제 대기 중 되살린 경우 포함)
+            uint64_t CollisionCount = 0ULL;     ///< 키는 같지만 내용이 달라 공유하지 않은 횟수 (누적, 내용 검증을 켰을 때만 셈)
+            uint64_t DestroyedCount = 0ULL;     ///< 디바이스에서 해제한 횟수 (누적)
+        };
+
+        /// @brief 참조 카운트 기반 GPU 리소스 관리자
+        /// @note 텍스처, 변경 불가 버퍼, 셰이더는 설명과 내용의 해시로 중복을 제거하므로, 같은 내용을 여러 번 요청해도 디바이스에는 한 번만 올라갑니다.
+        ///       키는 64비트 해시이므로 서로 다른 내용 N개 중 하나라도 충돌할 확률은 약 N^2 / 2^65 (10만 개에서 약 3 * 10^-10)입니다.
+        ///       호출자가 넘긴 내용 키가 틀린 경우까지 잡으려면 SetVerifyContent로 내용 사본을 두고 공유 전에 바이트 단위로 비교합니다.
+        ///       참조가 0이 된 리소스는 바로 해제하지 않고 FRAME_LATENCY 프레임 동안 대기시키므로, 이미 제출된 프레임이나
+        ///       렌더 스냅샷이 들고 있는 핸들이 그리는 도중 무효가 되지 않으며, 대기 중에 다시 요청하면 업로드 없이 되살립니다.
+        ///       EndFrame은 렌더 스레드에서만 호출하고, AddRef와 Release는 어느 스레드에서나 호출할 수 있습니다.
+        ///       Acquire는 IRenderDevice가 스레드 안전한 리소스 생성 여부를 알려줄 수 있게 될 때까지 메인 스레드(장면의 OnCreate 등)에서만
+        ///       호출합니다. 디바이스 리소스는 잠금 밖에서 만들므로 업로드 중에도 AddRef, Release를 호출하는 다른 스레드가 기다리지 않으며,
+        ///       등록 직전에 키를 다시 찾아 그 사이 같은 내용이 등록되었으면 새로 만든 리소스를 해제하고 기존 리소스를 공유합니다.
+        class ResourceManager final {
+        public:
+            static constexpr uint32_t FRAME_LATENCY = 3U;   ///< 해제 대기 프레임 수 (DXGI 기본 최대 프레임 지연)
+
+        private:
+            /// @brief 리소스 종류
+            enum class Kind : uint8_t {
+                Texture,
+                Buffer,
+                Shader,
+                Count
+            };
+
+            /// @brief 관리 중인 리소스
+            struct Entry final {
+                uint64_t Key;                   ///< 중복 제거 키 (0: 공유하지 않음)
+                uint64_t Bytes;                 ///< 크기
+                uint64_t ReleaseFrame;          ///< 마지막으로 참조가 0이 된 프레임
+                uint32_t RefCount;              ///< 참조 카운트
+                std::vector<byte_t> Content;    ///< 내용 사본 (내용 검증을 켰을 때 공유하는 리소스만)
+            };
+
+            /// @brief 종류별 리소스 목록
+            struct Pool final {
+                std::unordered_map<uint64_t, uint32_t> Keys;    ///< 키 → 핸들 식별자
+                std::unordered_map<uint32_t, Entry> Entries;    ///< 핸들 식별자 → 리소스
+                uint64_t Bytes = 0ULL;                          ///< 크기 합
+            };
+
+            /// @brief 해제 대기 항목
+            struct Pending final {
+                Kind Type;                      ///< 종류
+                uint32_t ID;                    ///< 핸들 식별자
+                uint64_t Frame;                 ///< 참조가 0이 된 프레임
+            };
+
+            IRenderDevice& m_Device;            ///< 렌더 디바이스
+            Pool m_Pools[static_cast<size_t>(Kind::Count)];     ///< 종류별 리소스 목록
+            std::vector<Pending> m_Pending;     ///< 해제 대기 목록 (프레임 오름차순)
+            mutable std::mutex m_Mutex;         ///< 목록 보호
+            uint64_t m_Frame;                   ///< 완료된 프레임 수
+            uint64_t m_PendingBytes;            ///< 해제 대기 중인 크기 합
+            uint64_t m_SharedBytes;             ///< 중복 제거로 업로드하지 않은 크기 합
+            uint64_t m_SharedCount;             ///< 공유 횟수
+            uint64_t m_CollisionCount;          ///< 충돌 횟수
+            uint64_t m_DestroyedCount;          ///< 해제 횟수
+            bool m_VerifyContent;               ///< 공유 전 내용 비교 여부
+
+            [[nodiscard]] uint32_t find(Kind, uint64_t, const void*, uint64_t, bool&) noexcept;
+            [[nodiscard]] uint32_t insert(Kind, uint32_t, uint64_t, const void*, uint64_t) noexcept;
+            [[nodiscard]] bool addRef(Kind, uint32_t) noexcept;
+            void release(Kind, uint32_t) noexcept;
+            void destroy(Kind, uint32_t) noexcept;
+
+        public:
+            explicit ResourceManager(IRenderDevice&) noexcept;
+            ResourceManager(const ResourceManager&) noexcept = delete;
+            ResourceManager(ResourceManager&&) noexcept = delete;
+            ~ResourceManager() noexcept;
+
+            [[nodiscard]] TextureHandle AcquireTexture(const TextureDesc&, const void*, uint64_t = 0ULL) noexcept;
+            [[nodiscard]] BufferHandle AcquireBuffer(const BufferDesc&, const void*, uint64_t = 0ULL) noexcept;
+            [[nodiscard]] ShaderHandle AcquireShader(const ShaderDesc&, const void*, size_t) noexcept;
+
+            [[nodiscard]] bool AddRef(TextureHandle) noexcept;
+            [[nodiscard]] bool AddRef(BufferHandle) noexcept;
+            [[nodiscard]] bool AddRef(ShaderHandle) noexcept;
+
+            void Release(TextureHandle) noexcept;
+            void Release(BufferHandle) noexcept;
+            void Release(ShaderHandle) noexcept;
+
+            void EndFrame() noexcept;
+            void FlushPending() noexcept;
+
+            void SetVerifyContent(bool) noexcept;
+
+            [[nodiscard]] ResourceUsage GetUsage() const noexcept;
+
+            ResourceManager& operator=(const ResourceManager&) noexcept = delete;
+            ResourceManager& operator=(ResourceManager&&) noexcept = delete;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+#include "../Type/Types.hpp"
+
+inline namespace neoxops {
+    namespace graphics {
+        /// @brief 핸들 기반 리소스 테이블
+        /// @tparam T 리소스 형식
+        /// @note 식별자는 하위 20비트에 (슬롯 인덱스 + 1), 상위 12비트에 세대를 담습니다.
+        ///       해제된 슬롯은 세대를 올려 재사용하므로 오래된 핸들은 Get에서 걸러집니다.
+        template <typename T>
+        class ResourceTable final {
+        private:
+            static constexpr uint32_t INDEX_BITS        = 20U;
+            static constexpr uint32_t INDEX_MASK        = (1U << INDEX_BITS) - 1U;
+            static constexpr uint32_t GENERATION_MASK   = (1U << (32U - INDEX_BITS)) - 1U;
+
+            /// @brief 슬롯
+            struct Slot final {
+                T Resource;                     ///< 리소스
+                uint32_t Generation;            ///< 세대
+                bool Alive;                     ///< 사용 중 여부
+            };
+
+            std::vector<Slot> m_Slots;                  ///< 슬롯 목록
+            std::vector<uint32_t> m_FreeList;           ///< 비어있는 슬롯의 인덱스
+            uint32_t m_Count;                           ///< 사용 중인 슬롯 수
+
+            /// @brief 식별자로부터 슬롯을 찾습니다.
+            /// @param id 식별자
+            /// @return 슬롯 (없으면 nullptr)
+            Slot* find(uint32_t id) noexcept {
+                const uint32_t index = (id & INDEX_MASK);
+                if (index == 0U || index > m_Slots.size()) {
+                    return nullptr;
+                }
+
+                Slot& slot = m_Slots[index - 1U];
+                if (!slot.Alive || slot.Generation != (id >> INDEX_BITS)) {
+                    return nullptr;
+                }
+
+                return &slot;
+            }
+
+        public:
+            ResourceTable() noexcept : m_Count(0U) {}
+            ResourceTable(const ResourceTable&) noexcept = delete;
+            ResourceTable(ResourceTable&&) noexcept = delete;
+            ~ResourceTable() noexcept = default;
+
+            /// @brief 리소스를 추가합니다.
+            /// @param resource 리소스
+            /// @return 식별자 (실패 시 0)
+            [[nodiscard]] uint32_t Add(T&& resource) noexcept {
+                uint32_t index = 0U;
+
+                if (!m_FreeList.empty()) {
+                    index = m_FreeList.back();
+                    m_FreeList.pop_back();
+                } else {
+                    if (m_Slots.size() >= INDEX_MASK) {
+                        return 0U;
+                    }
+
+                    m_Slots.push_back({ T{}, 0U, false });
+                    index = static_cast<uint32_t>(m_Slots.size() - 1U);
+                }
+
+                Slot& slot      = m_Slots[index];
+                slot.Resource   = std::move(resource);
+                slot.Alive      = true;
+                ++m_Count;
+
+                return (slot.Generation << INDEX_BITS) | (index + 1U);
+            }
+
+            /// @brief 리소스를 취득합니다.
+            /// @param id 식별자
+            /// @return 리소스 (없으면 nullptr)
+            [[nodiscard]] T* Get(uint32_t id) noexcept {
+                Slot* slot = find(id);
+                return slot ? &slot->Resource : nullptr;
+            }
+
+            /// @brief 리소스를 제거합니다.
+            /// @param id 식별자
+            /// @return 성공(true), 실패(false)
+            bool Remove(uint32_t id) noexcept {
+                Slot* slot = find(id);
+                if (!slot) {
+                    return false;
+                }
+
+                slot->Resource      = T{};
+                slot->Alive         = false;
+                slot->Generation    = (slot->Generation + 1U) & GENERATION_MASK;
+                m_FreeList.push_back((id & INDEX_MASK) - 1U);
+                --m_Count;
+
+                return true;
+            }
+
+            /// @brief 모든 리소스를 제거합니다.
+            void Clear() noexcept {
+                m_Slots.clear();
+                m_FreeList.clear();
+                m_Count = 0U;
+            }
+
+            /// @brief 사용 중인 리소스 수를 취득합니다.
+            /// @return 리소스 수
+            [[nodiscard]] uint32_t GetCount() const noexcept {
+                return m_Count;
+            }
+
+            ResourceTable& operator=(const ResourceTable&) noexcept = delete;
+            ResourceTable& operator=(ResourceTable&&) noexcept = delete;
+        };
+    }
+}
\ No newline at end of file
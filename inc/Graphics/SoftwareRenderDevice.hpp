@@ -0,0 +1,212 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "IRenderDevice.hpp"
+#include "ResourceTable.hpp"
+
+inline namespace neoxops {
+    namespace graphics {
+        /// @brief 소프트웨어 렌더러의 정점 형식
+        /// @note 정점 버퍼의 Stride에 따라 앞에서부터 필요한 만큼만 읽습니다.
+        ///       Stride >= 12: 위치, Stride >= 16: 색상 (R8G8B8A8, 없으면 흰색), Stride >= 24: 텍스처 좌표
+        struct SoftwareVertex final {
+            float X, Y, Z;                      ///< 위치
+            uint32_t Color;                     ///< 색상 (메모리 순서 R, G, B, A)
+            float U, V;                         ///< 텍스처 좌표
+        };
+
+        /// @brief 소프트웨어 래스터라이저 통계
+        struct SoftwareRasterStats final {
+            uint32_t TrianglesSubmitted = 0U;       ///< 제출된 삼각형 수
+            uint32_t TrianglesCulled    = 0U;       ///< 후면 또는 화면 밖이라 버려진 삼각형 수
+            uint32_t TrianglesBinned    = 0U;       ///< 타일에 배정된 삼각형 수 (클리핑으로 늘어난 수 포함)
+            uint32_t TileBinEntries     = 0U;       ///< 타일 빈에 들어간 항목 수
+            uint32_t ThreadCount        = 0U;       ///< 래스터화에 참여한 스레드 수
+            double SetupTime            = 0.0;      ///< 삼각형 설정 및 비닝 시간 (초 단위)
+            double RasterTime           = 0.0;      ///< 타일 래스터화 및 리졸브 시간 (초 단위)
+        };
+
+        /// @brief 소프트웨어 렌더 디바이스 클래스
+        /// @note GPU가 없는 환경을 위한 CPU 렌더러입니다.
+        ///       삼각형은 제출 스레드에서 변환, 클리핑, 설정 후 64x64 타일에 비닝되고,
+        ///       EndFrame에서 모든 코어가 타일 단위로 나누어 에지 함수 래스터화, 깊이 테스트, 셰이딩을 수행합니다.
+        ///       상수 버퍼 슬롯 0에 64바이트 이상의 버퍼가 바인딩되어 있으면 행 우선 4x4 행렬(v * M)로 정점을 변환하고,
+        ///       텍스처 슬롯 0의 텍스처를 최근접 샘플링하여 정점 색상과 곱합니다.
+        ///       깊이 버퍼는 D24S8과 같은 배치(하위 24비트 깊이, 상위 8비트 스텐실)이며 LESS 비교, 후면 컬링을 사용합니다.
+        class SoftwareRenderDevice final : public IRenderDevice {
+        private:
+            static constexpr int32_t TILE_SIZE      = 64;               ///< 타일 한 변의 픽셀 수
+            static constexpr int32_t TILE_PIXELS    = TILE_SIZE * TILE_SIZE;
+            static constexpr int32_t SUBPIXEL_BITS  = 4;                ///< 고정 소수점 부화소 비트 수
+            static constexpr float GUARD_BAND       = 4096.0f;          ///< 가드 밴드 (픽셀 단위)
+
+            /// @brief 버퍼 리소스
+            struct Buffer final {
+                std::vector<byte_t> Data;           ///< 데이터
+                BufferDesc Desc;                    ///< 버퍼 설명
+            };
+
+            /// @brief 텍스처 리소스
+            struct Texture final {
+                std::vector<uint32_t> Texels;       ///< 텍셀 (R8G8B8A8)
+                int32_t Width;                      ///< 너비
+                int32_t Height;                     ///< 높이
+            };
+
+            /// @brief 평면 방정식 (v = C + DX * (x - X0) + DY * (y - Y0))
+            struct Plane final {
+                float C;
+                float DX;
+                float DY;
+            };
+
+            /// @brief 설정이 끝난 삼각형
+            struct Triangle final {
+                int32_t MinX, MinY, MaxX, MaxY;     ///< 픽셀 경계 상자 (포함)
+                int32_t A[3];                       ///< 에지 함수 계수 (고정 소수점)
+                int32_t B[3];                       ///< 에지 함수 계수 (고정 소수점)
+                int64_t C[3];                       ///< 에지 함수 상수 (좌상단 규칙 바이어스 포함)
+                float X0, Y0;                       ///< 평면 방정식 기준점
+                Plane Z;                            ///< 깊이
+                Plane InvW;                         ///< 1 / w
+                Plane Attr[6];                      ///< R, G, B, A, U, V (각각 / w)
+                uint32_t TextureID;                 ///< 텍스처 (없으면 0)
+            };
+
+            /// @brief 클립 공간 정점
+            struct ClipVertex final {
+                float P[4];                         ///< X, Y, Z, W
+                float Attr[6];                      ///< R, G, B, A, U, V
+            };
+
+            ResourceTable<Buffer> m_Buffers;                ///< 버퍼 목록
+            ResourceTable<Texture> m_Textures;              ///< 텍스처 목록
+            ResourceTable<ShaderDesc> m_Shaders;            ///< 셰이더 목록 (고정 기능으로 그리므로 설명만 보관)
+            ResourceTable<BlendDesc> m_BlendStates;         ///< 블렌드 상태 목록 (설명만 보관)
+            ResourceTable<DepthStencilDesc> m_DepthStencilStates;   ///< 깊이 스텐실 상태 목록 (설명만 보관)
+            ResourceTable<RasterizerDesc> m_RasterizerStates;       ///< 래스터라이저 상태 목록 (설명만 보관)
+            ResourceTable<SamplerDesc> m_Samplers;          ///< 샘플러 목록 (설명만 보관)
+
+            std::vector<uint32_t> m_ColorBuffer;            ///< 리졸브된 색상 버퍼 (R8G8B8A8, 행 우선)
+            std::vector<uint32_t> m_TileColor;              ///< 타일 배치 색상 버퍼
+            std::vector<uint32_t> m_TileDepth;              ///< 타일 배치 깊이 스텐실 버퍼 (D24S8)
+            std::vector<std::vector<uint32_t>> m_Bins;      ///< 타일별 삼각형 인덱스
+            std::vector<Triangle> m_Triangles;              ///< 이번 프레임의 삼각형
+            std::vector<uint32_t> m_IndexScratch;           ///< 드로우 호출의 인덱스 임시 버퍼
+
+            int32_t m_Width;                                ///< 너비
+            int32_t m_Height;                               ///< 높이
+            int32_t m_TilesX;                               ///< 가로 타일 수
+            int32_t m_TilesY;                               ///< 세로 타일 수
+            uint32_t m_ClearColor;                          ///< 클리어 색상
+            bool m_VSyncEnabled;                            ///< 수직 동기화 활성화 유무
+            bool m_LoadTiles;                               ///< 타일을 클리어하지 않고 이어서 그림 (프레임 중간 플러시, 백 버퍼 복사 이후)
+            bool m_InFrame;                                 ///< BeginFrame 이후 EndFrame 전까지 참
+
+            uint32_t m_VertexBuffer;                        ///< 바인딩된 정점 버퍼
+            uint32_t m_IndexBuffer;                         ///< 바인딩된 인덱스 버퍼
+            IndexFormat m_IndexFormat;                      ///< 인덱스 형식
+            uint32_t m_ConstantBuffer;                      ///< 슬롯 0에 바인딩된 상수 버퍼
+            uint32_t m_Texture;                             ///< 슬롯 0에 바인딩된 텍스처
+            PrimitiveTopology m_Topology;                   ///< 프리미티브 토폴로지
+
+            RenderStats m_FrameStats;                       ///< 집계 중인 프레임의 통계
+            RenderStats m_LastFrameStats;                   ///< 마지막으로 완료된 프레임의 통계
+            SoftwareRasterStats m_RasterStats;              ///< 집계 중인 래스터 통계
+            SoftwareRasterStats m_LastRasterStats;          ///< 마지막으로 완료된 래스터 통계
+
+            std::vector<std::thread> m_Workers;             ///< 작업 스레드
+            std::mutex m_Mutex;                             ///< 작업 스레드 동기화
+            std::condition_variable m_WakeCondition;        ///< 작업 시작 알림
+            std::condition_variable m_DoneCondition;        ///< 작업 완료 알림
+            std::atomic<int32_t> m_NextTile;                ///< 다음으로 처리할 타일
+            uint64_t m_Dispatch;                            ///< 작업 배포 세대
+            uint32_t m_BusyWorkers;                         ///< 작업 중인 스레드 수
+            bool m_Shutdown;                                ///< 종료 요청
+
+            void startWorkers(uint32_t) noexcept;
+            void stopWorkers() noexcept;
+            void workerMain() noexcept;
+            void flushTiles() noexcept;
+            void processTiles() noexcept;
+            void rasterizeTile(int32_t) noexcept;
+            void resolveTile(int32_t) noexcept;
+
+            void submitTriangles(const uint32_t*, uint32_t, bool) noexcept;
+            void fetchVertex(const Buffer&, const float*, uint32_t, ClipVertex&) const noexcept;
+            void setupTriangle(const ClipVertex&, const ClipVertex&, const ClipVertex&, uint32_t) noexcept;
+
+        public:
+            SoftwareRenderDevice(uint32_t threadCount = 0U) noexcept;
+            SoftwareRenderDevice(const SoftwareRenderDevice&) noexcept = delete;
+            SoftwareRenderDevice(SoftwareRenderDevice&&) noexcept = delete;
+            ~SoftwareRenderDevice() noexcept override;
+
+            [[nodiscard]] bool Initialize(void*, int32_t, int32_t, bool, bool) noexcept override;
+            [[nodiscard]] bool IsVSyncEnabled() const noexcept override;
+
+            void BeginFrame(float color[4]) noexcept override;
+            void EndFrame() noexcept override;
+
+            [[nodiscard]] bool Resize(int32_t, int32_t) noexcept override;
+
+            void SetVSync(bool) noexcept override;
+
+            [[nodiscard]] BufferHandle CreateBuffer(const BufferDesc&, const void*) noexcept override;
+            [[nodiscard]] bool UpdateBuffer(BufferHandle, const void*, uint32_t) noexcept override;
+            void DestroyBuffer(BufferHandle) noexcept override;
+
+            [[nodiscard]] TextureHandle CreateTexture(const TextureDesc&, const void*) noexcept override;
+            void DestroyTexture(TextureHandle) noexcept override;
+            [[nodiscard]] bool IsTextureFormatSupported(TextureFormat) const noexcept override;
+
+            [[nodiscard]] ShaderHandle CreateShader(const ShaderDesc&, const void*, size_t) noexcept override;
+            void DestroyShader(ShaderHandle) noexcept override;
+
+            [[nodiscard]] BlendStateHandle CreateBlendState(const BlendDesc&) noexcept override;
+            [[nodiscard]] DepthStencilStateHandle CreateDepthStencilState(const DepthStencilDesc&) noexcept override;
+            [[nodiscard]] RasterizerStateHandle CreateRasterizerState(const RasterizerDesc&) noexcept override;
+            [[nodiscard]] SamplerHandle CreateSampler(const SamplerDesc&) noexcept override;
+            void DestroyBlendState(BlendStateHandle) noexcept override;
+            void DestroyDepthStencilState(DepthStencilStateHandle) noexcept override;
+            void DestroyRasterizerState(RasterizerStateHandle) noexcept override;
+            void DestroySampler(SamplerHandle) noexcept override;
+
+            [[nodiscard]] TextureDesc GetBackBufferDesc() const noexcept override;
+            [[nodiscard]] bool CopyBackBufferToTexture(TextureHandle) noexcept override;
+            [[nodiscard]] bool CopyTextureToBackBuffer(TextureHandle) noexcept override;
+
+            void SetVertexBuffer(BufferHandle) noexcept override;
+            void SetIndexBuffer(BufferHandle, IndexFormat) noexcept override;
+            void SetConstantBuffer(uint32_t, BufferHandle) noexcept override;
+            void SetTexture(uint32_t, TextureHandle) noexcept override;
+            void SetSampler(uint32_t, SamplerHandle) noexcept override;
+            void SetShader(ShaderStage, ShaderHandle) noexcept override;
+            void SetBlendState(BlendStateHandle) noexcept override;
+            void SetDepthStencilState(DepthStencilStateHandle) noexcept override;
+            void SetRasterizerState(RasterizerStateHandle) noexcept override;
+            void SetPrimitiveTopology(PrimitiveTopology) noexcept override;
+
+            void Draw(uint32_t, uint32_t) noexcept override;
+            void DrawIndexed(uint32_t, uint32_t, int32_t) noexcept override;
+
+            [[nodiscard]] const RenderStats& GetFrameStats() const noexcept override;
+            [[nodiscard]] const SoftwareRasterStats& GetRasterStats() const noexcept;
+
+            [[nodiscard]] bool SetThreadCount(uint32_t) noexcept;
+            [[nodiscard]] uint32_t GetThreadCount() const noexcept;
+
+            [[nodiscard]] const uint32_t* GetColorBuffer() const noexcept;
+            [[nodiscard]] int32_t GetWidth() const noexcept;
+            [[nodiscard]] int32_t GetHeight() const noexcept;
+            [[nodiscard]] bool SaveBMP(const char*) const noexcept;
+
+            SoftwareRenderDevice& operator=(const SoftwareRenderDevice&) noexcept = delete;
+            SoftwareRenderDevice& operator=(SoftwareRenderDevice&&) noexcept = delete;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <vector>
+#include "IRenderDevice.hpp"
+#include "TextureCooker.hpp"
+#include "../System/MappedFile.hpp"
+
+inline namespace neoxops {
+    namespace graphics {
+        /// @brief GPU에 올릴 준비가 끝난 텍스처
+        /// @note 캐시 파일을 메모리 매핑한 상태로 데이터를 가리키므로, 객체가 살아있는 동안만 Data가 유효합니다.
+        struct CookedTexture final {
+            system::MappedFile File;            ///< 매핑된 캐시 파일
+            std::vector<byte_t> Memory;         ///< 캐시 파일을 쓸 수 없을 때 보관하는 쿠킹 결과
+            TextureDesc Desc;                   ///< 텍스처 설명
+            const byte_t* Data = nullptr;       ///< 데이터 (File 또는 Memory 내부)
+        };
+
+        /// @brief 텍스처 캐시 통계
+        struct TextureCacheStats final {
+            uint64_t Hits = 0ULL;               ///< 캐시 파일을 그대로 사용한 횟수
+            uint64_t Cooks = 0ULL;              ///< 새로 쿠킹한 횟수
+            uint64_t Failures = 0ULL;           ///< 원본이 없거나 디코딩에 실패한 횟수
+        };
+
+        /// @brief 쿠킹된 텍스처 캐시
+        /// @note 캐시 파일 이름은 원본 내용과 쿠킹 옵션의 해시이므로, 원본이 바뀌면 자동으로 다시 쿠킹되고
+        ///       경로가 다르더라도 내용이 같은 원본은 캐시 파일 하나를 공유합니다.
+        ///       두 번째 실행부터는 원본 해시 계산과 캐시 파일 매핑만 수행하며, 디코딩이나 중간 복사 없이 매핑된 데이터가 디바이스로 전달됩니다.
+        class TextureCache final {
+        private:
+            std::string m_Directory;                    ///< 캐시 디렉터리
+            std::atomic<uint64_t> m_Hits;               ///< 캐시 적중 횟수
+            std::atomic<uint64_t> m_Cooks;              ///< 쿠킹 횟수
+            std::atomic<uint64_t> m_Failures;           ///< 실패 횟수
+
+            [[nodiscard]] std::string getCachePath(uint64_t) const noexcept;
+            [[nodiscard]] bool writeCacheFile(const std::string&, const std::vector<byte_t>&) const noexcept;
+
+        public:
+            explicit TextureCache(std::string) noexcept;
+            TextureCache(const TextureCache&) noexcept = delete;
+            TextureCache(TextureCache&&) noexcept = delete;
+            ~TextureCache() noexcept = default;
+
+            [[nodiscard]] bool Prepare(const std::string&, const TextureCookOptions&, CookedTexture&) noexcept;
+            [[nodiscard]] static TextureHandle Create(IRenderDevice&, const CookedTexture&) noexcept;
+            [[nodiscard]] TextureHandle Load(IRenderDevice&, const std::string&, TextureCookOptions = {}) noexcept;
+
+            [[nodiscard]] TextureCacheStats GetStats() const noexcept;
+
+            TextureCache& operator=(const TextureCache&) noexcept = delete;
+            TextureCache& operator=(TextureCache&&) noexcept = delete;
+        };
+    }
+}
\ No newline at end of file
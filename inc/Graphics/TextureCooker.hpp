@@ -0,0 +1,75 @@
+#pragma once
+
+#include <vector>
+#include "RenderTypes.hpp"
+
+inline namespace neoxops {
+    namespace graphics {
+        /// @brief 텍스처 압축 방식
+        enum class TextureCompression : uint8_t {
+            None,                               ///< 압축하지 않음 (RGBA8)
+            BC1,                                ///< BC1 (불투명 또는 1비트 알파)
+            BC3,                                ///< BC3 (8비트 알파)
+            BC7,                                ///< BC7 (고품질)
+            Auto                                ///< 알파에 따라 BC1 또는 BC3
+        };
+
+        /// @brief 텍스처 쿠킹 옵션
+        /// @note 옵션은 캐시 키에 포함되므로, 옵션이 바뀌면 다시 쿠킹됩니다.
+        struct TextureCookOptions final {
+            TextureCompression Compression  = TextureCompression::None;     ///< 압축 방식 (0단계가 4의 배수가 아니면 압축하지 않음)
+            bool GenerateMips               = true;                         ///< 밉맵 생성 여부 (1x1까지)
+            bool SrgbMips                   = true;                         ///< 밉맵을 선형 공간에서 평균할지 여부 (색상 텍스처는 true, 노멀맵 등 데이터 텍스처는 false)
+        };
+
+        /// @brief 디코딩된 이미지 (R8G8B8A8, 행 간격 없이 연속)
+        struct Image final {
+            std::vector<byte_t> Pixels;         ///< 픽셀
+            int32_t Width   = 0;                ///< 너비
+            int32_t Height  = 0;                ///< 높이
+        };
+
+        /// @brief 쿠킹된 텍스처 파일 헤더
+        /// @note 헤더 뒤 DataOffset 위치부터 TextureDesc와 같은 배치(0단계부터 모든 밉맵 단계가 행 간격 없이 연속)로 데이터가 이어집니다.
+        ///       따라서 파일을 메모리 매핑한 뒤 데이터 위치를 그대로 IRenderDevice::CreateTexture에 넘길 수 있습니다.
+        struct CookedTextureHeader final {
+            uint32_t Magic;                     ///< 식별자 (MAGIC)
+            uint32_t Version;                   ///< 형식 버전 (VERSION)
+            uint64_t Key;                       ///< 캐시 키 (원본 내용과 옵션의 해시)
+            int32_t Width;                      ///< 너비
+            int32_t Height;                     ///< 높이
+            uint32_t MipLevels;                 ///< 밉맵 단계 수
+            uint32_t Format;                    ///< 텍스처 형식 (TextureFormat)
+            uint64_t DataOffset;                ///< 데이터 위치 (파일 시작 기준, DATA_ALIGNMENT 정렬)
+            uint64_t DataSize;                  ///< 데이터 크기
+        };
+
+        /// @brief 텍스처 쿠커
+        /// @note 원본 이미지(BMP, DDS, Windows에서는 WIC를 통해 JPEG, PNG 등)를 디코딩하고 밉맵 생성, 블록 압축을 거쳐
+        ///       GPU에 바로 올릴 수 있는 형태로 만듭니다. 한 번만 수행하고 결과는 TextureCache가 파일로 보관합니다.
+        ///       블록 압축된 DDS(BC1, BC3, BC7)는 다시 압축하지 않고 그대로 사용합니다.
+        class TextureCooker final {
+        public:
+            static constexpr uint32_t MAGIC             = 0x5854584EU;      ///< 'NXTX'
+            static constexpr uint32_t VERSION           = 1U;               ///< 형식 버전 (인코더가 바뀌면 올려서 기존 캐시를 무효화)
+            static constexpr uint32_t DATA_ALIGNMENT    = 64U;              ///< 데이터 정렬 (캐시 라인)
+
+        private:
+            static void compressBC1(const byte_t*, int32_t, int32_t, byte_t*) noexcept;
+            static void compressBC3(const byte_t*, int32_t, int32_t, byte_t*) noexcept;
+            static void compressBC7(const byte_t*, int32_t, int32_t, byte_t*) noexcept;
+
+        public:
+            TextureCooker() noexcept = delete;
+
+            [[nodiscard]] static uint64_t GetCacheKey(const void*, size_t, const TextureCookOptions&) noexcept;
+
+            [[nodiscard]] static bool Decode(const void*, size_t, Image&) noexcept;
+            [[nodiscard]] static bool Cook(const void*, size_t, const TextureCookOptions&, std::vector<byte_t>&) noexcept;
+            [[nodiscard]] static bool ReadHeader(const void*, size_t, CookedTextureHeader&) noexcept;
+
+            static void GenerateMip(const byte_t*, int32_t, int32_t, byte_t*, bool) noexcept;
+            static void Compress(const byte_t*, int32_t, int32_t, TextureFormat, byte_t*) noexcept;
+        };
+    }
+}
\ No newline at end of file
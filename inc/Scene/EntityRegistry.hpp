@@ -0,0 +1,299 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../System/JobSystem.hpp"
+#include "../Type/Types.hpp"
+
+inline namespace neoxops {
+    namespace scene {
+        /// @brief 개체 핸들
+        /// @note 식별자는 하위 20비트에 (슬롯 인덱스 + 1), 상위 12비트에 세대를 담습니다. (graphics::ResourceTable과 같음)
+        struct Entity final {
+            uint32_t ID = 0U;                   ///< 식별자 (0: 무효)
+
+            static constexpr uint32_t INDEX_BITS        = 20U;
+            static constexpr uint32_t INDEX_MASK        = (1U << INDEX_BITS) - 1U;
+            static constexpr uint32_t GENERATION_MASK   = (1U << (32U - INDEX_BITS)) - 1U;
+
+            /// @brief 유효성 검사
+            /// @return 유효(true), 무효(false)
+            [[nodiscard]] constexpr bool IsValid() const noexcept { return ID != 0U; }
+
+            /// @brief 슬롯 인덱스를 취득합니다.
+            /// @return 슬롯 인덱스 (무효 핸들이면 UINT32_MAX)
+            [[nodiscard]] constexpr uint32_t GetIndex() const noexcept { return (ID & INDEX_MASK) - 1U; }
+
+            /// @brief 세대를 취득합니다.
+            /// @return 세대
+            [[nodiscard]] constexpr uint32_t GetGeneration() const noexcept { return ID >> INDEX_BITS; }
+
+            friend constexpr bool operator==(const Entity& lhs, const Entity& rhs) noexcept { return lhs.ID == rhs.ID; }
+            friend constexpr bool operator!=(const Entity& lhs, const Entity& rhs) noexcept { return lhs.ID != rhs.ID; }
+        };
+
+        /// @brief 컴포넌트 풀 기반 클래스 (개체 파괴 시 형식을 모르고 제거하기 위함)
+        class ComponentPoolBase {
+        public:
+            virtual ~ComponentPoolBase() noexcept = default;
+
+            virtual bool Remove(uint32_t) noexcept = 0;
+            virtual void Clear() noexcept = 0;
+        };
+
+        /// @brief 컴포넌트 풀 (희소 집합)
+        /// @tparam T 컴포넌트 형식
+        /// @note 컴포넌트는 빈틈 없는 연속 배열(조밀 배열)에 보관하고, 개체 슬롯 인덱스 → 조밀 배열 위치를 희소 배열로 찾습니다.
+        ///       제거는 마지막 요소로 빈자리를 채우므로 O(1)이며 순서는 바뀝니다.
+        template <typename T>
+        class ComponentPool final : public ComponentPoolBase {
+            static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>, "components must be nothrow movable");
+
+        public:
+            static constexpr uint32_t NO_INDEX = UINT32_MAX;    ///< 컴포넌트 없음
+
+        private:
+            std::vector<uint32_t> m_Sparse;             ///< 개체 슬롯 인덱스 → 조밀 배열 위치
+            std::vector<Entity> m_Entities;             ///< 조밀 배열 위치 → 개체
+            std::vector<T> m_Components;                ///< 컴포넌트 (조밀 배열)
+
+        public:
+            ComponentPool() noexcept = default;
+            ComponentPool(const ComponentPool&) noexcept = delete;
+            ComponentPool(ComponentPool&&) noexcept = delete;
+            ~ComponentPool() noexcept override = default;
+
+            /// @brief 컴포넌트를 추가합니다.
+            /// @param entity 개체 (살아있는 개체여야 함)
+            /// @param args 생성자 인수
+            /// @return 컴포넌트 (이미 있었다면 새 값으로 교체)
+            template <typename... Args>
+            T& Emplace(Entity entity, Args&&... args) noexcept {
+                const uint32_t index = entity.GetIndex();
+                if (index >= m_Sparse.size()) {
+                    m_Sparse.resize(static_cast<size_t>(index) + 1U, NO_INDEX);
+                }
+
+                uint32_t& dense = m_Sparse[index];
+                if (dense != NO_INDEX) {
+                    m_Entities[dense] = entity;
+                    m_Components[dense] = T(std::forward<Args>(args)...);
+                    return m_Components[dense];
+                }
+
+                dense = static_cast<uint32_t>(m_Components.size());
+                m_Entities.push_back(entity);
+                m_Components.emplace_back(std::forward<Args>(args)...);
+                return m_Components.back();
+            }
+
+            /// @brief 컴포넌트를 제거합니다.
+            /// @param index 개체 슬롯 인덱스
+            /// @return 성공(true), 없음(false)
+            bool Remove(uint32_t index) noexcept override {
+                if (!Has(index)) {
+                    return false;
+                }
+
+                const uint32_t dense = m_Sparse[index];
+                const uint32_t last = static_cast<uint32_t>(m_Components.size() - 1U);
+                if (dense != last) {
+                    m_Components[dense] = std::move(m_Components[last]);
+                    m_Entities[dense] = m_Entities[last];
+                    m_Sparse[m_Entities[dense].GetIndex()] = dense;
+                }
+
+                m_Components.pop_back();
+                m_Entities.pop_back();
+                m_Sparse[index] = NO_INDEX;
+                return true;
+            }
+
+            /// @brief 모든 컴포넌트를 제거합니다.
+            void Clear() noexcept override {
+                m_Sparse.clear();
+                m_Entities.clear();
+                m_Components.clear();
+            }
+
+            /// @brief 컴포넌트 보유 여부를 확인합니다.
+            /// @param index 개체 슬롯 인덱스
+            /// @return 있음(true), 없음(false)
+            [[nodiscard]] bool Has(uint32_t index) const noexcept { return index < m_Sparse.size() && m_Sparse[index] != NO_INDEX; }
+
+            /// @brief 컴포넌트를 찾습니다.
+            /// @param index 개체 슬롯 인덱스
+            /// @return 컴포넌트 (없으면 nullptr)
+            [[nodiscard]] T* Find(uint32_t index) noexcept { return Has(index) ? &m_Components[m_Sparse[index]] : nullptr; }
+            [[nodiscard]] const T* Find(uint32_t index) const noexcept { return Has(index) ? &m_Components[m_Sparse[index]] : nullptr; }
+
+            /// @brief 컴포넌트를 취득합니다. (보유 여부를 확인하지 않음)
+            /// @param index 개체 슬롯 인덱스
+            /// @return 컴포넌트
+            [[nodiscard]] T& Get(uint32_t index) noexcept { return m_Components[m_Sparse[index]]; }
+
+            /// @brief 컴포넌트 수를 취득합니다.
+            /// @return 컴포넌트 수
+            [[nodiscard]] uint32_t GetSize() const noexcept { return static_cast<uint32_t>(m_Components.size()); }
+
+            [[nodiscard]] T* GetData() noexcept { return m_Components.data(); }
+            [[nodiscard]] const T* GetData() const noexcept { return m_Components.data(); }
+            [[nodiscard]] const Entity* GetEntities() const noexcept { return m_Entities.data(); }
+
+            ComponentPool& operator=(const ComponentPool&) noexcept = delete;
+            ComponentPool& operator=(ComponentPool&&) noexcept = delete;
+        };
+
+        /// @brief 개체, 컴포넌트 저장소
+        /// @note 장면이 소유하며, 컴포넌트 형식마다 희소 집합(ComponentPool) 하나를 둡니다.
+        ///       Each, ParallelEach는 첫 번째 컴포넌트의 조밀 배열을 순서대로 훑으므로 가장 적은 컴포넌트를 첫 번째로 지정합니다.
+        ///       순회 중에는 개체 생성, 파괴와 컴포넌트 추가, 제거를 하면 안 됩니다. (모아 두었다가 순회 뒤에 처리)
+        class EntityRegistry final {
+        private:
+            std::vector<uint32_t> m_Generations;                            ///< 슬롯별 세대
+            std::vector<byte_t> m_Alive;                                    ///< 슬롯별 생존 여부
+            std::vector<uint32_t> m_FreeList;                               ///< 비어있는 슬롯의 인덱스
+            std::vector<std::unique_ptr<ComponentPoolBase>> m_Pools;        ///< 컴포넌트 형식 번호별 풀
+            uint32_t m_Count;                                               ///< 살아있는 개체 수
+
+            [[nodiscard]] static uint32_t nextTypeID() noexcept;
+
+            /// @brief 컴포넌트 형식 번호를 취득합니다.
+            /// @return 형식 번호 (처음 사용한 순서대로 0부터)
+            template <typename T>
+            [[nodiscard]] static uint32_t getTypeID() noexcept {
+                static const uint32_t id = nextTypeID();
+                return id;
+            }
+
+            /// @brief 범위 안의 개체에 함수를 호출합니다.
+            /// @param first 첫 번째 컴포넌트 풀 (순회 기준)
+            /// @param begin 시작 위치 (첫 번째 풀의 조밀 배열 기준)
+            /// @param end 끝 위치 (포함하지 않음)
+            /// @param function 함수 (Entity, First&, Rest&...)
+            /// @param rest 나머지 컴포넌트 풀
+            template <typename First, typename... Rest, typename Function>
+            static void eachRange(ComponentPool<First>& first, uint32_t begin, uint32_t end, Function& function, ComponentPool<Rest>&... rest) noexcept {
+                const Entity* entities = first.GetEntities();
+                First* components = first.GetData();
+                for (uint32_t i = begin; i < end; ++i) {
+                    if constexpr (sizeof...(Rest) == 0U) {
+                        function(entities[i], components[i]);
+                    }
+                    else {
+                        const uint32_t index = entities[i].GetIndex();
+                        if ((rest.Has(index) && ...)) {
+                            function(entities[i], components[i], rest.Get(index)...);
+                        }
+                    }
+                }
+            }
+
+        public:
+            EntityRegistry() noexcept;
+            EntityRegistry(const EntityRegistry&) noexcept = delete;
+            EntityRegistry(EntityRegistry&&) noexcept = default;
+            ~EntityRegistry() noexcept = default;
+
+            [[nodiscard]] Entity Create() noexcept;
+            bool Destroy(Entity) noexcept;
+            [[nodiscard]] bool IsAlive(Entity) const noexcept;
+            void Clear() noexcept;
+
+            /// @brief 살아있는 개체 수를 취득합니다.
+            /// @return 개체 수
+            [[nodiscard]] uint32_t GetCount() const noexcept { return m_Count; }
+
+            /// @brief 컴포넌트 풀을 취득합니다.
+            /// @return 풀 (한 번도 추가되지 않은 형식이면 nullptr)
+            template <typename T>
+            [[nodiscard]] ComponentPool<T>* GetPool() const noexcept {
+                const uint32_t id = getTypeID<T>();
+                return (id < m_Pools.size()) ? static_cast<ComponentPool<T>*>(m_Pools[id].get()) : nullptr;
+            }
+
+            /// @brief 컴포넌트를 추가합니다.
+            /// @param entity 개체
+            /// @param args 생성자 인수
+            /// @return 컴포넌트 (개체가 죽었으면 nullptr)
+            template <typename T, typename... Args>
+            T* AddComponent(Entity entity, Args&&... args) noexcept {
+                if (!IsAlive(entity)) {
+                    return nullptr;
+                }
+
+                const uint32_t id = getTypeID<T>();
+                if (id >= m_Pools.size()) {
+                    m_Pools.resize(static_cast<size_t>(id) + 1U);
+                }
+                if (!m_Pools[id]) {
+                    m_Pools[id] = std::make_unique<ComponentPool<T>>();
+                }
+                return &static_cast<ComponentPool<T>*>(m_Pools[id].get())->Emplace(entity, std::forward<Args>(args)...);
+            }
+
+            /// @brief 컴포넌트를 제거합니다.
+            /// @param entity 개체
+            /// @return 성공(true), 없음(false)
+            template <typename T>
+            bool RemoveComponent(Entity entity) noexcept {
+                ComponentPool<T>* pool = GetPool<T>();
+                return pool && IsAlive(entity) && pool->Remove(entity.GetIndex());
+            }
+
+            /// @brief 컴포넌트를 취득합니다.
+            /// @param entity 개체
+            /// @return 컴포넌트 (개체가 죽었거나 없으면 nullptr)
+            template <typename T>
+            [[nodiscard]] T* GetComponent(Entity entity) const noexcept {
+                ComponentPool<T>* pool = GetPool<T>();
+                return (pool && IsAlive(entity)) ? pool->Find(entity.GetIndex()) : nullptr;
+            }
+
+            /// @brief 컴포넌트 보유 여부를 확인합니다.
+            /// @param entity 개체
+            /// @return 있음(true), 없음(false)
+            template <typename T>
+            [[nodiscard]] bool HasComponent(Entity entity) const noexcept {
+                return GetComponent<T>(entity) != nullptr;
+            }
+
+            /// @brief 지정한 컴포넌트를 모두 가진 개체마다 함수를 호출합니다.
+            /// @param function 함수 (Entity, First&, Rest&...)
+            template <typename First, typename... Rest, typename Function>
+            void Each(Function&& function) noexcept {
+                ComponentPool<First>* first = GetPool<First>();
+                if (!first || ((GetPool<Rest>() == nullptr) || ...)) {
+                    return;
+                }
+                eachRange<First, Rest...>(*first, 0U, first->GetSize(), function, *GetPool<Rest>()...);
+            }
+
+            /// @brief 지정한 컴포넌트를 모두 가진 개체마다 함수를 여러 스레드에서 나누어 호출합니다.
+            /// @param jobs 작업 시스템 (nullptr이면 호출한 스레드에서 Each와 같이 처리)
+            /// @param function 함수 (Entity, First&, Rest&...), 자신이 받은 컴포넌트만 고쳐야 합니다.
+            /// @param grain 작업 하나가 처리할 개체 수 (0: 자동)
+            /// @note 첫 번째 풀의 조밀 배열을 연속 구간으로 나누므로 작업마다 메모리를 순서대로 읽습니다. 모든 구간이 끝나야 반환합니다.
+            template <typename First, typename... Rest, typename Function>
+            void ParallelEach(system::JobSystem* jobs, Function&& function, uint32_t grain = 0U) noexcept {
+                ComponentPool<First>* first = GetPool<First>();
+                if (!first || ((GetPool<Rest>() == nullptr) || ...)) {
+                    return;
+                }
+                if (!jobs) {
+                    eachRange<First, Rest...>(*first, 0U, first->GetSize(), function, *GetPool<Rest>()...);
+                    return;
+                }
+
+                jobs->ParallelFor(0U, first->GetSize(), grain, [&](uint32_t begin, uint32_t end) {
+                    eachRange<First, Rest...>(*first, begin, end, function, *GetPool<Rest>()...);
+                });
+            }
+
+            EntityRegistry& operator=(const EntityRegistry&) noexcept = delete;
+            EntityRegistry& operator=(EntityRegistry&&) noexcept = default;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,19 @@
+#pragma once
+
+inline namespace neoxops {
+    namespace graphics {
+        class IRenderDevice;
+    }
+
+    namespace scene {
+        /// @brief 렌더 스냅샷 기반 클래스
+        /// @note 파이프라인 모드에서 시뮬레이션 스레드가 채우고 렌더 스레드가 그리는, 한 프레임의 불변 렌더링 데이터입니다.
+        ///       렌더 스레드에서 사용되는 동안 장면이 파괴될 수 있으므로 장면을 가리키는 포인터를 담으면 안 됩니다.
+        class RenderSnapshot {
+        public:
+            virtual ~RenderSnapshot() noexcept = default;
+
+            virtual void Render(graphics::IRenderDevice*) noexcept = 0;
+        };
+    }
+}
\ No newline at end of file
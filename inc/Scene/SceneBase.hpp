@@ -1,28 +1,74 @@
-#pragma once
-
-inline namespace neoxops {
-    namespace scene {
-        /// @brief 장면 기반 클래스
-        class SceneBase {
-        protected:
-            virtual void onPreRender()  noexcept = 0;
-            virtual void onRender3D()   noexcept = 0;
-            virtual void onRender2D()   noexcept = 0;
-            virtual void onPostRender() noexcept = 0;
-
-        public:
-            virtual ~SceneBase()        noexcept = default;
-
-            virtual bool OnCreate()     noexcept = 0;
-            virtual void OnDestroy()    noexcept = 0;
-            virtual void OnEnter()      noexcept = 0;
-            virtual void OnExit()       noexcept = 0;
-            virtual void OnPause()      noexcept = 0;
-            virtual void OnResume()     noexcept = 0;
-
-            virtual void Input()        noexcept = 0;
-            virtual void Update(double) noexcept = 0;
-            virtual void Render()       noexcept = 0;
-        };
-    }
+#pragma once
+
+#include <memory>
+#include "EntityRegistry.hpp"
+#include "RenderSnapshot.hpp"
+#include "SceneLoadContext.hpp"
+
+inline namespace neoxops {
+    namespace scene {
+        // 전방 선언
+        class SceneManager;
+
+        /// @brief 장면 기반 클래스
+        class SceneBase {
+        private:
+            friend class SceneManager;
+
+            SceneManager* m_SceneMgr = nullptr;     ///< 장면을 소유한 장면 관리자 (OnCreate 이전에 설정됨)
+            EntityRegistry m_Entities;              ///< 장면이 소유한 개체, 컴포넌트 저장소
+
+        protected:
+            virtual void onPreRender()  noexcept = 0;
+            virtual void onRender3D()   noexcept = 0;
+            virtual void onRender2D()   noexcept = 0;
+            virtual void onPostRender() noexcept = 0;
+
+        public:
+            virtual ~SceneBase()        noexcept = default;
+
+            /// @brief 백그라운드 로딩 단계 (LoadSceneAsync 전용)
+            /// @param context 진행률 보고 및 취소 확인
+            /// @return 성공(true), 실패 또는 취소(false)
+            /// @note 로딩 스레드에서 OnCreate보다 먼저 호출됩니다. 파일 읽기, 디코딩 등 무거운 작업을 여기서 수행하고,
+            ///       렌더 디바이스 등 메인 스레드 전용 자원은 OnCreate에서 만들어야 합니다.
+            virtual bool OnLoadAsync(SceneLoadContext&) noexcept { return true; }
+
+            virtual bool OnCreate()     noexcept = 0;
+            virtual void OnDestroy()    noexcept = 0;
+            virtual void OnEnter()      noexcept = 0;
+            virtual void OnExit()       noexcept = 0;
+            virtual void OnPause()      noexcept = 0;
+            virtual void OnResume()     noexcept = 0;
+
+            /// @brief 생성된 상태 그대로 초기 상태로 되돌립니다.
+            /// @return 성공(true), 미지원 또는 실패(false: 파괴 후 다시 생성됨)
+            /// @note OnExit 이후, OnEnter 이전에 호출됩니다. 텍스처나 모델 같은 무거운 자원은 유지하고 게임 상태만 초기화해야 합니다.
+            ///       ReloadScene과 장면 풀에서 꺼낸 인스턴스에 OnCreate 대신 사용됩니다.
+            virtual bool OnReset()      noexcept { return false; }
+
+            virtual void Input()        noexcept = 0;
+            virtual void Update(double) noexcept = 0;
+            virtual void Render()       noexcept = 0;
+
+            /// @brief 파이프라인 모드에서 사용할 빈 렌더 스냅샷을 생성합니다.
+            /// @return 스냅샷 (nullptr이면 파이프라인을 지원하지 않으며, 시뮬레이션이 끝난 뒤 Render가 호출됩니다.)
+            /// @note 장면마다 최대 3개까지 생성되어 재사용됩니다.
+            virtual std::unique_ptr<RenderSnapshot> CreateSnapshot() noexcept { return nullptr; }
+
+            /// @brief 현재 상태를 렌더 스냅샷에 기록합니다.
+            /// @param snapshot CreateSnapshot으로 생성된 스냅샷 (이전 내용은 오래된 프레임의 것이므로 전부 덮어써야 합니다.)
+            /// @note 파이프라인 모드에서 Update 직후 시뮬레이션 스레드에서 호출됩니다.
+            virtual void WriteSnapshot(RenderSnapshot&) noexcept {}
+
+            /// @brief 장면을 소유한 장면 관리자를 취득합니다.
+            /// @return 장면 관리자
+            [[nodiscard]] SceneManager* GetSceneManager() const noexcept { return m_SceneMgr; }
+
+            /// @brief 장면의 개체, 컴포넌트 저장소를 취득합니다.
+            /// @return 개체 저장소 (장면이 파괴될 때 함께 비워지며, OnReset에서는 장면이 직접 Clear해야 합니다.)
+            [[nodiscard]] EntityRegistry& GetEntities() noexcept { return m_Entities; }
+            [[nodiscard]] const EntityRegistry& GetEntities() const noexcept { return m_Entities; }
+        };
+    }
 }
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+
+inline namespace neoxops {
+    namespace scene {
+        /// @brief 비동기 장면 로딩 상태
+        /// @note 로딩 스레드의 장면이 진행률을 보고하고 취소 여부를 확인하며, 메인 스레드가 이를 읽습니다.
+        class SceneLoadContext final {
+        private:
+            std::atomic<float> m_Progress;          ///< 진행률 (0.0 ~ 1.0)
+            std::atomic<bool> m_Cancelled;          ///< 취소 요청
+
+        public:
+            SceneLoadContext() noexcept : m_Progress(0.0f), m_Cancelled(false) {}
+            SceneLoadContext(const SceneLoadContext&) noexcept = delete;
+            SceneLoadContext(SceneLoadContext&&) noexcept = delete;
+            ~SceneLoadContext() noexcept = default;
+
+            /// @brief 진행률을 설정합니다.
+            /// @param progress 진행률 (0.0 ~ 1.0)
+            void SetProgress(float progress) noexcept { m_Progress.store(std::clamp(progress, 0.0f, 1.0f), std::memory_order_relaxed); }
+
+            /// @brief 진행률을 취득합니다.
+            /// @return 진행률 (0.0 ~ 1.0)
+            [[nodiscard]] float GetProgress() const noexcept { return m_Progress.load(std::memory_order_relaxed); }
+
+            /// @brief 취소를 요청합니다.
+            void Cancel() noexcept { m_Cancelled.store(true, std::memory_order_relaxed); }
+
+            /// @brief 취소 요청 여부를 확인합니다.
+            /// @return 취소 요청됨(true), 계속(false)
+            /// @note OnLoadAsync는 주기적으로 확인하여 취소되었다면 false를 반환해야 합니다.
+            [[nodiscard]] bool IsCancelled() const noexcept { return m_Cancelled.load(std::memory_order_relaxed); }
+
+            SceneLoadContext& operator=(const SceneLoadContext&) noexcept = delete;
+            SceneLoadContext& operator=(SceneLoadContext&&) noexcept = delete;
+        };
+    }
+}
\ No newline at end of file
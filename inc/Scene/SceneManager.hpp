@@ -1,51 +1,226 @@
-#pragma once
-
-#include <functional>
-#include <memory>
-#include <string>
-#include <string_view>
-#include <unordered_map>
-#include <vector>
-#include "SceneBase.hpp"
-
-inline namespace neoxops {
-    namespace scene {
-        /// @brief 장면 관리자 클래스
-        class SceneManager final {
-        private:
-            /// @brief 장면 엔트리
-            struct SceneEntry final {
-                std::string Name;                       ///< 장면의 이름
-                std::unique_ptr<SceneBase> Scene;       ///< 장면
-                bool IsPause;                           ///< 일시정지
-            };
-        
-            std::unordered_map<std::string, std::function<std::unique_ptr<SceneBase>()>> m_SceneRegistry;           ///< 장면 등록 레지스트리
-            std::vector<SceneEntry> m_SceneStack;                                                                   ///< 장면 스택
-        
-        public:
-            SceneManager() noexcept;
-            SceneManager(const SceneManager&) noexcept = delete;
-            SceneManager(SceneManager&&) noexcept = delete;
-            ~SceneManager() noexcept;
-
-            [[nodiscard]] bool AddScene(std::string_view, std::function<std::unique_ptr<SceneBase>()>) noexcept;
-            [[nodiscard]] bool LoadScene(std::string_view) noexcept;
-            [[nodiscard]] bool RemoveScene(std::string_view) noexcept;
-            [[nodiscard]] bool ChangeScene(std::string_view) noexcept;
-            [[nodiscard]] bool ReloadScene() noexcept;
-
-            [[nodiscard]] bool Pause() noexcept;
-            [[nodiscard]] bool Resume() noexcept;
-
-            [[nodiscard]] SceneBase* GetCurrentScene() const noexcept;
-
-            void Input() noexcept;
-            void Update(double) noexcept;
-            void Render() noexcept;
-
-            SceneManager& operator=(const SceneManager&) noexcept = delete;
-            SceneManager& operator=(SceneManager&&) noexcept = delete;
-        };
-    }
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "SceneBase.hpp"
+#include "../Graphics/RenderTypes.hpp"
+#include "../System/TripleBuffer.hpp"
+#include "../Type/Types.hpp"
+
+inline namespace neoxops {
+    namespace graphics {
+        class IRenderDevice;
+        class PipelineStateCache;
+        class ResourceManager;
+    }
+
+    namespace system {
+        class FileSystem;
+        class JobSystem;
+    }
+
+    namespace scene {
+        /// @brief 비동기 로딩이 끝난 장면을 스택에 넣는 방식
+        enum class SceneLoadMode : uint8_t {
+            Change,                                     ///< 현재 장면을 파괴하고 교체 (ChangeScene)
+            Push                                        ///< 현재 장면을 일시 정지하고 위에 쌓음 (LoadScene)
+        };
+
+        /// @brief 장면 레이어 플래그
+        /// @note 위에 쌓이는 장면(오버레이)에 지정하며, 바로 아래 장면에 대한 처리를 결정합니다.
+        ///       플래그가 연속된 만큼 여러 단계 아래까지 적용됩니다. 입력은 항상 최상위 장면만 받습니다.
+        enum class SceneLayer : uint8_t {
+            None            = 0x00U,
+            RenderThrough   = 0x01U,                    ///< 아래 장면을 먼저 그림 (HUD, 반투명 메뉴)
+            UpdateThrough   = 0x02U,                    ///< 아래 장면을 일시 정지하지 않고 계속 갱신
+            CacheBelow      = 0x04U                     ///< 아래 장면이 모두 일시 정지된 동안 마지막 화면을 텍스처로 보관하여 재사용 (RenderThrough와 함께 사용)
+        };
+
+        [[nodiscard]] constexpr SceneLayer operator|(SceneLayer lhs, SceneLayer rhs) noexcept {
+            return static_cast<SceneLayer>(static_cast<uint8_t>(lhs) | static_cast<uint8_t>(rhs));
+        }
+
+        /// @brief 레이어 플래그 포함 여부를 확인합니다.
+        /// @param layer 레이어 플래그
+        /// @param flag 확인할 플래그
+        /// @return 포함(true), 미포함(false)
+        [[nodiscard]] constexpr bool HasSceneLayer(SceneLayer layer, SceneLayer flag) noexcept {
+            return (static_cast<uint8_t>(layer) & static_cast<uint8_t>(flag)) != 0U;
+        }
+
+        /// @brief 장면별 재사용 정책
+        struct ScenePolicy final {
+            uint32_t PoolSize = 0U;                     ///< 스택에서 빠진 뒤 파괴하지 않고 보관할 인스턴스 수 (OnReset 지원 장면 전용)
+        };
+
+        /// @brief 장면별 생성 통계
+        struct SceneStats final {
+            uint64_t Builds = 0ULL;                     ///< 생성 함수와 OnCreate로 새로 만든 횟수
+            uint64_t Resets = 0ULL;                     ///< ReloadScene에서 OnReset으로 재시작한 횟수
+            uint64_t PoolHits = 0ULL;                   ///< 풀에 보관된 인스턴스를 재사용한 횟수
+            uint32_t Pooled = 0U;                       ///< 현재 풀에 보관된 인스턴스 수
+        };
+
+        /// @brief 장면 관리자 클래스
+        class SceneManager final {
+        private:
+            /// @brief 장면 엔트리
+            struct SceneEntry final {
+                std::string Name;                       ///< 장면의 이름
+                std::unique_ptr<SceneBase> Scene;       ///< 장면
+                bool IsPause;                           ///< 일시정지
+                uint64_t Serial;                        ///< 장면 인스턴스의 일련번호
+                SceneLayer Layer;                       ///< 아래 장면에 대한 레이어 플래그
+            };
+
+            /// @brief 가려진 레이어의 화면 캐시
+            struct LayerCache final {
+                graphics::TextureHandle Texture;                            ///< 캐시 텍스처 (백 버퍼와 같은 크기, 형식)
+                graphics::TextureDesc Desc;                                 ///< 캐시 텍스처 설명
+                std::vector<uint64_t> Serials;                              ///< 캐시된 레이어들의 일련번호 (아래부터)
+                bool Valid = false;                                         ///< 유효 여부
+            };
+
+            /// @brief 레이어 스냅샷
+            struct LayerSnapshot final {
+                std::unique_ptr<RenderSnapshot> Snapshot;                   ///< 스냅샷
+                uint64_t Serial = 0ULL;                                     ///< 스냅샷을 생성한 장면의 일련번호
+            };
+
+            /// @brief 등록된 장면
+            struct SceneRegistration final {
+                std::function<std::unique_ptr<SceneBase>()> Factory;        ///< 장면 생성 함수
+                ScenePolicy Policy;                                         ///< 재사용 정책
+                std::vector<std::unique_ptr<SceneBase>> Pool;               ///< 보관된 인스턴스 (OnExit까지 호출된 상태)
+                SceneStats Stats;                                           ///< 생성 통계
+            };
+
+            /// @brief 진행 중인 비동기 로딩
+            struct PendingLoad final {
+                std::string Name;                                           ///< 불러오는 장면의 이름
+                std::string LoadingSceneName;                               ///< 로딩 중에 표시하는 장면의 이름 (비어있으면 없음)
+                SceneLoadMode Mode;                                         ///< 스택에 넣는 방식
+                std::function<std::unique_ptr<SceneBase>()> Factory;        ///< 장면 생성 함수 (복사본)
+                std::unique_ptr<SceneBase> Scene;                           ///< 로딩 스레드가 만든 장면
+                SceneLoadContext Context;                                   ///< 진행률, 취소
+                std::atomic<bool> Finished{ false };                        ///< 로딩 스레드 종료 여부
+                bool Succeeded = false;                                     ///< OnLoadAsync 성공 여부
+                bool Pooled = false;                                        ///< 풀에서 꺼낸 인스턴스 (OnReset으로 초기화)
+                std::thread Thread;                                         ///< 로딩 스레드
+            };
+
+            /// @brief 미뤄진 스택 변경의 종류
+            enum class StackChange : uint8_t {
+                Load,                                                       ///< LoadScene
+                Change,                                                     ///< ChangeScene
+                Remove,                                                     ///< RemoveScene
+                Reload,                                                     ///< ReloadScene
+                ClearPool                                                   ///< ClearScenePool
+            };
+
+            /// @brief Update에서 요청되어 다음 ProcessPendingLoad로 미뤄진 스택 변경
+            struct PendingChange final {
+                StackChange Kind;                                           ///< 변경 종류
+                std::string Name;                                           ///< 장면의 이름
+                SceneLayer Layer;                                           ///< 레이어 플래그 (Load 전용)
+            };
+
+            /// @brief 렌더 스냅샷 슬롯
+            struct SnapshotSlot final {
+                std::vector<LayerSnapshot> Layers;          ///< 그릴 레이어의 스냅샷 (아래부터)
+                size_t CacheLayer = 0U;                     ///< 이 인덱스 아래의 레이어는 캐시 대상 (0: 캐시 안 함)
+                bool Valid = false;                         ///< 이번 발행에서 기록되었는지 여부
+            };
+        
+            std::unordered_map<std::string, SceneRegistration> m_SceneRegistry;                                     ///< 장면 등록 레지스트리
+            std::vector<SceneEntry> m_SceneStack;                                                                   ///< 장면 스택
+            graphics::IRenderDevice* m_RenderDevice;                                                                ///< 렌더 디바이스
+            graphics::PipelineStateCache* m_PipelineCache;                                                          ///< 파이프라인 상태 캐시
+            graphics::ResourceManager* m_ResourceMgr;                                                               ///< 리소스 관리자
+            system::JobSystem* m_JobSystem;                                                                         ///< 작업 시스템
+            system::FileSystem* m_FileSystem;                                                                       ///< 파일 시스템
+            double m_InterpolationAlpha;                                                                            ///< 렌더링 보간 계수
+            uint64_t m_NextSerial;                                                                                  ///< 다음 장면 인스턴스의 일련번호
+            system::TripleBuffer<SnapshotSlot> m_Snapshots;                                                         ///< 시뮬레이션 → 렌더 스냅샷 전달 버퍼
+            std::unique_ptr<PendingLoad> m_PendingLoad;                                                             ///< 진행 중인 비동기 로딩
+            LayerCache m_LayerCache;                                                                                ///< 가려진 레이어의 화면 캐시
+            std::vector<uint64_t> m_LayerSerials;                                                                   ///< 캐시 대상 레이어 일련번호 (임시)
+            std::vector<PendingChange> m_PendingChanges;                                                            ///< 메인 스레드에서 반영할 스택 변경
+            bool m_Updating;                                                                                        ///< Update 실행 중 여부
+
+            [[nodiscard]] std::unique_ptr<SceneBase> createScene(const std::function<std::unique_ptr<SceneBase>()>&) noexcept;
+            [[nodiscard]] bool initializeScene(SceneBase*) noexcept;
+            [[nodiscard]] std::unique_ptr<SceneBase> acquireScene(SceneRegistration&) noexcept;
+            [[nodiscard]] std::unique_ptr<SceneBase> takePooledScene(SceneRegistration&) noexcept;
+            void releaseScene(std::string_view, std::unique_ptr<SceneBase>) noexcept;
+            void pushScene(std::string_view, std::unique_ptr<SceneBase>, SceneLayer) noexcept;
+            void popScene() noexcept;
+            void syncPauseStates() noexcept;
+            [[nodiscard]] size_t getLayerBase(SceneLayer) const noexcept;
+            [[nodiscard]] size_t getCacheLayer(size_t) const noexcept;
+            [[nodiscard]] bool restoreLayerCache() noexcept;
+            void captureLayerCache() noexcept;
+            void releaseLayerCache() noexcept;
+            void finishPendingLoad() noexcept;
+            [[nodiscard]] bool deferChange(StackChange, std::string_view, SceneLayer = SceneLayer::None) noexcept;
+            void applyPendingChanges() noexcept;
+        
+        public:
+            SceneManager() noexcept;
+            SceneManager(const SceneManager&) noexcept = delete;
+            SceneManager(SceneManager&&) noexcept = delete;
+            ~SceneManager() noexcept;
+
+            [[nodiscard]] bool AddScene(std::string_view, std::function<std::unique_ptr<SceneBase>()>, ScenePolicy = {}) noexcept;
+            [[nodiscard]] bool LoadScene(std::string_view, SceneLayer = SceneLayer::None) noexcept;
+            [[nodiscard]] bool RemoveScene(std::string_view) noexcept;
+            [[nodiscard]] bool ChangeScene(std::string_view) noexcept;
+            [[nodiscard]] bool ReloadScene() noexcept;
+            [[nodiscard]] bool SetSceneLayer(std::string_view, SceneLayer) noexcept;
+            void InvalidateLayerCache() noexcept;
+
+            [[nodiscard]] bool LoadSceneAsync(std::string_view, SceneLoadMode = SceneLoadMode::Change, std::string_view = {}) noexcept;
+            void CancelLoad() noexcept;
+            void ProcessPendingLoad() noexcept;
+            [[nodiscard]] bool IsLoading() const noexcept;
+            [[nodiscard]] float GetLoadProgress() const noexcept;
+
+            [[nodiscard]] SceneStats GetSceneStats(std::string_view) const noexcept;
+            void ClearScenePool(std::string_view = {}) noexcept;
+
+            [[nodiscard]] bool Pause() noexcept;
+            [[nodiscard]] bool Resume() noexcept;
+
+            [[nodiscard]] SceneBase* GetCurrentScene() const noexcept;
+            [[nodiscard]] graphics::IRenderDevice* GetRenderDevice() const noexcept;
+            [[nodiscard]] graphics::PipelineStateCache* GetPipelineStateCache() const noexcept;
+            [[nodiscard]] graphics::ResourceManager* GetResourceManager() const noexcept;
+            [[nodiscard]] system::JobSystem* GetJobSystem() const noexcept;
+            [[nodiscard]] system::FileSystem* GetFileSystem() const noexcept;
+            [[nodiscard]] double GetInterpolationAlpha() const noexcept;
+
+            void SetRenderDevice(graphics::IRenderDevice*) noexcept;
+            void SetPipelineStateCache(graphics::PipelineStateCache*) noexcept;
+            void SetResourceManager(graphics::ResourceManager*) noexcept;
+            void SetJobSystem(system::JobSystem*) noexcept;
+            void SetFileSystem(system::FileSystem*) noexcept;
+            void SetInterpolationAlpha(double) noexcept;
+
+            void Input() noexcept;
+            void Update(double) noexcept;
+            void Render() noexcept;
+
+            void PublishSnapshot() noexcept;
+            [[nodiscard]] bool AcquireSnapshot() noexcept;
+            void RenderFromSnapshot() noexcept;
+
+            SceneManager& operator=(const SceneManager&) noexcept = delete;
+            SceneManager& operator=(SceneManager&&) noexcept = delete;
+        };
+    }
 }
\ No newline at end of file
@@ -1,46 +1,116 @@
-#pragma once
-
-#define WIN32_LEAN_AND_MEAN
-#include <windows.h>
-
-inline namespace neoxops {
-    namespace graphics {
-        class D3DGraphics;
-    }
-
-    namespace scene {
-        class SceneManager;
-    }
-    
-    namespace system {
-        // 전방 선언
-        class FPSLimiter;
-        class Window;
-
-        /// @brief 응용 프로그램 클래스
-        class Application final {
-        private:
-            HINSTANCE m_hInstance;                          ///< 응용 프로그램의 인스턴스 핸들
-            FPSLimiter* m_FPSLimiter;                       ///< FPSLimiter 객체
-            Window* m_Window;                               ///< Window 객체
-            graphics::D3DGraphics* m_D3DGraphics;           ///< D3DGraphics 객체
-            scene::SceneManager* m_SceneMgr;                ///< SceneManager 객체
-
-            void input() noexcept;
-            void update() noexcept;
-            void render() noexcept;
-
-        public:
-            Application() noexcept;
-            Application(const Application&) noexcept = delete;
-            Application(Application&&) noexcept = delete;
-            ~Application() noexcept;
-
-            [[nodiscard]] bool Initialize(HINSTANCE) noexcept;
-            void Run() noexcept;
-
-            Application& operator=(const Application&) noexcept = delete;
-            Application& operator=(Application&&) noexcept = delete;
-        };
-    }
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "../Type/Types.hpp"
+
+inline namespace neoxops {
+    namespace graphics {
+        class IRenderDevice;
+        class PipelineStateCache;
+        class RenderContext;
+        class ResourceManager;
+    }
+
+    namespace scene {
+        class SceneManager;
+    }
+
+    namespace system {
+        // 전방 선언
+        class FileSystem;
+        class FPSLimiter;
+        class IWindow;
+        class JobSystem;
+
+        /// @brief 렌더러 종류
+        enum class RenderBackend : uint8_t {
+            Auto,                                           ///< 환경에 따라 선택 (Win32: Direct3D 11, 헤드리스 또는 그 외: Null)
+            Direct3D11,                                     ///< Direct3D 11 (Win32 전용)
+            Software,                                       ///< CPU 소프트웨어 래스터라이저
+            Null                                            ///< 그리지 않고 통계만 기록
+        };
+
+        /// @brief 응용 프로그램 설정
+        struct ApplicationDesc final {
+            void* Instance              = nullptr;              ///< 응용 프로그램의 인스턴스 핸들 (Win32: HINSTANCE)
+            const char* Title           = "NeoXOPS";            ///< 타이틀
+            int32_t Width               = 640;                  ///< 너비
+            int32_t Height              = 480;                  ///< 높이
+            uint32_t MaxFPS             = 60U;                  ///< 최대 제한 FPS (0: 무제한)
+            double FixedTimeStep        = 0.0;                  ///< 고정 시뮬레이션 간격 (초 단위, 0: 프레임마다 가변 간격)
+            uint32_t MaxSimulationSteps = 5U;                   ///< 한 프레임에서 수행할 최대 시뮬레이션 횟수 (고정 간격 전용)
+            uint64_t MaxFrames          = 0ULL;                 ///< 구동할 최대 프레임 수 (0: 무제한)
+            bool FullscreenEnabled      = false;                ///< 전체화면 활성화 유무
+            bool VSyncEnabled           = false;                ///< 수직 동기화 활성화 유무
+            bool Headless               = false;                ///< 헤드리스 모드 (윈도우 없이 구동)
+            RenderBackend Renderer      = RenderBackend::Auto;  ///< 렌더러 종류
+            uint32_t RenderThreads      = 0U;                   ///< 소프트웨어 렌더러의 스레드 수 (0: 하드웨어 스레드 수)
+            bool Pipelined              = false;                ///< 시뮬레이션과 렌더링을 다른 스레드에서 겹쳐 수행 (1 프레임 지연)
+            uint32_t WorkerThreads      = 0U;                   ///< 작업 시스템의 작업 스레드 수 (메인 스레드 제외, 0: 하드웨어 스레드 수 - 1)
+            const char* DataPack        = nullptr;              ///< 자산 팩 경로 (nullptr: 팩 없음)
+            const char* DataDirectory   = nullptr;              ///< 자산 디렉터리 경로 (팩보다 우선하는 개발용 덮어쓰기, nullptr: 없음)
+        };
+
+        /// @brief 응용 프로그램 클래스
+        class Application final {
+        private:
+            static constexpr auto MAIN_JOB_POLL_INTERVAL = std::chrono::microseconds(500);  ///< 시뮬레이션을 기다리는 동안 메인 스레드 전용 작업을 확인하는 간격
+
+            FPSLimiter* m_FPSLimiter;                       ///< FPSLimiter 객체
+            IWindow* m_Window;                              ///< Window 객체
+            graphics::IRenderDevice* m_RenderDevice;        ///< 렌더 디바이스 객체
+            graphics::RenderContext* m_RenderContext;       ///< RenderContext 객체 (장면은 디바이스 대신 이 객체로 제출)
+            graphics::PipelineStateCache* m_PipelineCache;  ///< PipelineStateCache 객체
+            graphics::ResourceManager* m_ResourceMgr;       ///< ResourceManager 객체
+            scene::SceneManager* m_SceneMgr;                ///< SceneManager 객체
+            JobSystem* m_JobSystem;                         ///< JobSystem 객체
+            FileSystem* m_FileSystem;                       ///< FileSystem 객체
+            uint64_t m_MaxFrames;                           ///< 구동할 최대 프레임 수 (0: 무제한)
+            uint64_t m_FrameIndex;                          ///< 구동한 프레임 수
+
+            bool m_Pipelined;                               ///< 파이프라인 모드
+            std::thread m_SimThread;                        ///< 시뮬레이션 스레드 (파이프라인 모드)
+            std::mutex m_SimMutex;                          ///< 시뮬레이션 스레드 동기화
+            std::condition_variable m_SimCondition;         ///< 시뮬레이션 요청, 완료 알림
+            bool m_SimRequested;                            ///< 시뮬레이션 요청 여부
+            bool m_SimShutdown;                             ///< 시뮬레이션 스레드 종료 요청
+
+            void input() noexcept;
+            void update() noexcept;
+            void render() noexcept;
+            void renderSnapshot() noexcept;
+
+            void simulationMain() noexcept;
+            void startSimulation() noexcept;
+            void waitSimulation() noexcept;
+            void stopSimulationThread() noexcept;
+
+        public:
+            Application() noexcept;
+            Application(const Application&) noexcept = delete;
+            Application(Application&&) noexcept = delete;
+            ~Application() noexcept;
+
+            [[nodiscard]] bool Initialize(const ApplicationDesc&) noexcept;
+            void Run() noexcept;
+            void Quit() noexcept;
+
+            [[nodiscard]] uint64_t GetFrameIndex() const noexcept;
+            [[nodiscard]] bool IsPipelined() const noexcept;
+            [[nodiscard]] FPSLimiter* GetFPSLimiter() const noexcept;
+            [[nodiscard]] graphics::IRenderDevice* GetRenderDevice() const noexcept;
+            [[nodiscard]] graphics::RenderContext* GetRenderContext() const noexcept;
+            [[nodiscard]] graphics::PipelineStateCache* GetPipelineStateCache() const noexcept;
+            [[nodiscard]] graphics::ResourceManager* GetResourceManager() const noexcept;
+            [[nodiscard]] scene::SceneManager* GetSceneManager() const noexcept;
+            [[nodiscard]] JobSystem* GetJobSystem() const noexcept;
+            [[nodiscard]] FileSystem* GetFileSystem() const noexcept;
+
+            Application& operator=(const Application&) noexcept = delete;
+            Application& operator=(Application&&) noexcept = delete;
+        };
+    }
 }
\ No newline at end of file
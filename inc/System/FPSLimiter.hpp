@@ -1,44 +1,107 @@
-#pragma once
-
-#include <chrono>
-#include "../Type/Types.hpp"
-
-inline namespace neoxops {
-    namespace system {
-        /// @brief FPS 관리 클래스
-        class FPSLimiter final {
-        private:
-            static constexpr double FPS_UPDATE_INTERVAL = 1.0;                          ///< FPS 계산을 위한 업데이트 간격 (초 단위)
-            static constexpr auto MAX_DRIFT = std::chrono::milliseconds(10);            ///< 최대 드리프트(시간 지연) 허용 시간
-
-            std::chrono::steady_clock::time_point m_SleepUntil;
-            std::chrono::steady_clock::time_point m_StartTime;                          ///< 전체 FPS 계산 시간
-            std::chrono::steady_clock::time_point m_EndTime;                            ///< 이전 프레임의 종료 시간
-            std::chrono::steady_clock::time_point m_FrameStartTime;                     ///< 현재 프레임의 시작 시간
-            std::chrono::steady_clock::time_point m_LastFPSTime;                        ///< 마지막으로 FPS를 업데이트한 시간
-
-            uint32_t    m_FrameCount;                                                   ///< FPS 계산을 위한 프레임 카운트
-            uint32_t    m_MaxFPS;                                                       ///< 최대 제한 FPS
-            double      m_FPS;                                                          ///< 측정된 FPS
-            double      m_DeltaTime;                                                    ///< 마지막 프레임이 완료되기 까지 걸린 시간 (델타 타임)
-
-        public:
-            FPSLimiter(uint32_t maxFPS = 60) noexcept;
-            FPSLimiter(const FPSLimiter&) noexcept = delete;
-            FPSLimiter(FPSLimiter&&) noexcept = delete;
-            ~FPSLimiter() noexcept;
-
-            void StartFrame() noexcept;
-            void EndFrame(bool) noexcept;
-
-            [[nodiscard]] uint32_t GetFrameCount() const noexcept;
-            [[nodiscard]] double GetFPS() const noexcept;
-            [[nodiscard]] double GetDeltaTime() const noexcept;
-
-            void SetMaxFPS(uint32_t) noexcept;
-
-            FPSLimiter& operator=(const FPSLimiter&) noexcept = delete;
-            FPSLimiter& operator=(FPSLimiter&&) noexcept = delete;
-        };
-    }
+#pragma once
+
+#include <array>
+#include <chrono>
+#include "../Type/Types.hpp"
+
+inline namespace neoxops {
+    namespace system {
+        /// @brief 프레임 시간 통계 (최근 FRAME_TIME_WINDOW 프레임 기준, 초 단위)
+        struct FrameTimeStats final {
+            double Mean                 = 0.0;      ///< 평균 프레임 시간
+            double P50                  = 0.0;      ///< 50 백분위 프레임 시간
+            double P95                  = 0.0;      ///< 95 백분위 프레임 시간
+            double P99                  = 0.0;      ///< 99 백분위 프레임 시간
+            double Max                  = 0.0;      ///< 최대 프레임 시간
+            double WakeErrorP99         = 0.0;      ///< 목표 시각 대비 기상 지연의 99 백분위 (실제로 대기한 프레임만)
+            double WakeErrorMax         = 0.0;      ///< 목표 시각 대비 기상 지연의 최댓값 (실제로 대기한 프레임만)
+            double SleepOvershoot       = 0.0;      ///< 보정된 sleep 초과 시간 추정치 (이보다 짧게 남으면 스핀)
+            uint32_t SampleCount        = 0U;       ///< 프레임 시간 표본 수
+            uint32_t WakeSampleCount    = 0U;       ///< 기상 지연 표본 수
+        };
+
+        /// @brief FPS 관리 클래스
+        /// @note 대기는 보정된 초과 시간만큼 남을 때까지 짧게 잠든 뒤, 나머지를 양보하며 스핀하는 하이브리드 방식입니다.
+        class FPSLimiter final {
+        public:
+            static constexpr uint32_t FRAME_TIME_WINDOW     = 1024U;                    ///< 통계에 사용하는 최근 프레임 수
+            static constexpr uint32_t HISTOGRAM_BIN_COUNT   = 256U;                     ///< 히스토그램 구간 수 (마지막 구간은 그 이상 전부)
+            static constexpr double HISTOGRAM_BIN_WIDTH     = 0.00025;                  ///< 히스토그램 구간 폭 (초 단위, 0.25ms)
+
+        private:
+            static constexpr double FPS_UPDATE_INTERVAL = 1.0;                          ///< FPS 계산을 위한 업데이트 간격 (초 단위)
+            static constexpr auto MAX_DRIFT = std::chrono::milliseconds(10);            ///< 최대 드리프트(시간 지연) 허용 시간
+            static constexpr double MAX_DELTA_TIME = 0.25;                              ///< 델타 타임 상한 (디버거 정지, 창 드래그 등으로 인한 급증 방지)
+            static constexpr auto SLEEP_QUANTUM = std::chrono::milliseconds(1);         ///< 하이브리드 대기에서 한 번에 잠드는 시간
+
+            std::chrono::steady_clock::time_point m_SleepUntil;
+            std::chrono::steady_clock::time_point m_StartTime;                          ///< 전체 FPS 계산 시간
+            std::chrono::steady_clock::time_point m_EndTime;                            ///< 이전 프레임의 종료 시간
+            std::chrono::steady_clock::time_point m_FrameStartTime;                     ///< 현재 프레임의 시작 시간
+            std::chrono::steady_clock::time_point m_LastFPSTime;                        ///< 마지막으로 FPS를 업데이트한 시간
+
+            uint32_t    m_FrameCount;                                                   ///< FPS 계산을 위한 프레임 카운트
+            uint32_t    m_MaxFPS;                                                       ///< 최대 제한 FPS (0: 무제한)
+            double      m_FPS;                                                          ///< 측정된 FPS
+            double      m_DeltaTime;                                                    ///< 이전 프레임 시작부터 현재 프레임 시작까지의 시간 (델타 타임)
+
+            double      m_FixedTimeStep;                                                ///< 고정 시뮬레이션 간격 (초 단위, 0: 가변 간격)
+            double      m_Accumulator;                                                  ///< 아직 시뮬레이션되지 않은 시간
+            double      m_DroppedTime;                                                  ///< 따라잡기 상한으로 버린 누적 시간
+            uint32_t    m_MaxSimulationSteps;                                           ///< 한 프레임에서 수행할 최대 시뮬레이션 횟수
+            uint32_t    m_SimulationSteps;                                              ///< 현재 프레임에서 수행한 시뮬레이션 횟수
+
+            bool        m_HybridWaitEnabled;                                            ///< 하이브리드 대기 사용 유무 (false: sleep_until만 사용)
+            double      m_OvershootMean;                                                ///< sleep 초과 시간의 지수 이동 평균
+            double      m_OvershootVariance;                                            ///< sleep 초과 시간의 지수 이동 분산
+            double      m_WakeError;                                                    ///< 직전 대기의 목표 시각 대비 기상 지연
+
+            std::array<float, FRAME_TIME_WINDOW> m_FrameTimes;                          ///< 최근 프레임 시간 (원형 버퍼)
+            std::array<float, FRAME_TIME_WINDOW> m_WakeErrors;                          ///< 최근 기상 지연 (원형 버퍼)
+            std::array<uint32_t, HISTOGRAM_BIN_COUNT> m_Histogram;                      ///< 최근 프레임 시간 히스토그램
+            uint32_t    m_SampleIndex;                                                  ///< 다음 표본 위치
+            uint32_t    m_SampleCount;                                                  ///< 표본 수
+            uint32_t    m_WakeErrorIndex;                                               ///< 다음 기상 지연 표본 위치
+            uint32_t    m_WakeErrorCount;                                               ///< 기상 지연 표본 수
+            bool        m_FirstFrame;                                                   ///< 첫 프레임 여부 (생성 시점부터 잰 시간이라 통계에서 제외)
+            FrameTimeStats m_FrameTimeStats;                                            ///< 마지막으로 계산한 프레임 시간 통계
+
+            void waitUntil(std::chrono::steady_clock::time_point) noexcept;
+            void recordFrameTime(double) noexcept;
+            void recordWakeError(double) noexcept;
+
+        public:
+            FPSLimiter(uint32_t maxFPS = 60) noexcept;
+            FPSLimiter(const FPSLimiter&) noexcept = delete;
+            FPSLimiter(FPSLimiter&&) noexcept = delete;
+            ~FPSLimiter() noexcept;
+
+            void StartFrame() noexcept;
+            void EndFrame(bool) noexcept;
+
+            [[nodiscard]] uint32_t GetFrameCount() const noexcept;
+            [[nodiscard]] double GetFPS() const noexcept;
+            [[nodiscard]] double GetDeltaTime() const noexcept;
+
+            [[nodiscard]] bool StepSimulation() noexcept;
+            [[nodiscard]] bool IsFixedTimeStep() const noexcept;
+            [[nodiscard]] double GetFixedTimeStep() const noexcept;
+            [[nodiscard]] double GetInterpolationAlpha() const noexcept;
+            [[nodiscard]] uint32_t GetSimulationSteps() const noexcept;
+            [[nodiscard]] double GetDroppedTime() const noexcept;
+
+            [[nodiscard]] const FrameTimeStats& GetFrameTimeStats() const noexcept;
+            [[nodiscard]] const std::array<uint32_t, HISTOGRAM_BIN_COUNT>& GetFrameTimeHistogram() const noexcept;
+            [[nodiscard]] bool IsHybridWaitEnabled() const noexcept;
+
+            void SetMaxFPS(uint32_t) noexcept;
+            void SetFixedTimeStep(double, uint32_t = 5U) noexcept;
+            void SetHybridWaitEnabled(bool) noexcept;
+            void UpdateFrameTimeStats() noexcept;
+            void ResetFrameTimeStats() noexcept;
+
+            FPSLimiter& operator=(const FPSLimiter&) noexcept = delete;
+            FPSLimiter& operator=(FPSLimiter&&) noexcept = delete;
+        };
+    }
 }
\ No newline at end of file
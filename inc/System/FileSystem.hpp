@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "MappedFile.hpp"
+#include "PackFile.hpp"
+
+inline namespace neoxops {
+    namespace system {
+        /// @brief 읽은 파일
+        /// @note 압축하지 않은 팩 항목과 개별 파일은 매핑된 데이터를 그대로 가리키고, 압축된 팩 항목만 Memory에 풀어둡니다.
+        ///       객체가 살아있는 동안(팩 항목은 파일 시스템에서 팩이 해제되기 전까지) Data가 유효합니다.
+        struct FileData final {
+            MappedFile File;                    ///< 매핑된 개별 파일
+            std::vector<byte_t> Memory;         ///< 압축을 푼 내용
+            const byte_t* Data = nullptr;       ///< 내용 (팩, File 또는 Memory 내부, 빈 파일이면 nullptr)
+            size_t Size = 0U;                   ///< 크기
+        };
+
+        /// @brief 파일 시스템 통계
+        struct FileSystemStats final {
+            uint64_t PackReads = 0ULL;          ///< 팩에서 읽은 횟수
+            uint64_t LooseReads = 0ULL;         ///< 개별 파일로 읽은 횟수
+            uint64_t Misses = 0ULL;             ///< 어디에도 없던 횟수
+            uint64_t Failures = 0ULL;           ///< 압축 해제 또는 내용 검증에 실패한 횟수
+            uint64_t DecompressedBytes = 0ULL;  ///< 압축을 푼 크기 합
+        };
+
+        /// @brief 가상 파일 시스템
+        /// @note 팩과 디렉터리를 층으로 쌓고, 나중에 마운트한 층부터 찾습니다. 배포판은 팩 하나만 마운트하고,
+        ///       개발 중에는 그 위에 자산 디렉터리를 마운트하면 수정한 파일이 팩을 다시 만들지 않아도 우선 적용됩니다.
+        ///       경로는 대소문자와 구분자 종류를 구분하지 않습니다. (디렉터리 층은 운영체제 규칙을 따름)
+        ///       마운트는 로딩 전에 메인 스레드에서 끝내야 하며, 이후 Read와 Exists는 여러 스레드에서 동시에 호출해도 안전합니다.
+        class FileSystem final {
+        private:
+            /// @brief 마운트된 층 (팩 또는 디렉터리)
+            struct Layer final {
+                std::unique_ptr<PackFile> Pack;     ///< 팩 (디렉터리 층이면 nullptr)
+                std::string Directory;              ///< 디렉터리 (팩 층이면 비어있음)
+            };
+
+            std::vector<Layer> m_Layers;                    ///< 층 (마운트한 순서)
+            bool m_VerifyContent;                           ///< 팩에서 읽은 내용의 해시 검증 여부
+            std::atomic<uint64_t> m_PackReads;              ///< 팩에서 읽은 횟수
+            std::atomic<uint64_t> m_LooseReads;             ///< 개별 파일로 읽은 횟수
+            std::atomic<uint64_t> m_Misses;                 ///< 찾지 못한 횟수
+            std::atomic<uint64_t> m_Failures;               ///< 실패 횟수
+            std::atomic<uint64_t> m_DecompressedBytes;      ///< 압축을 푼 크기 합
+
+            [[nodiscard]] bool readPack(const PackFile&, const PackEntry&, FileData&) noexcept;
+            [[nodiscard]] static bool readLoose(const std::string&, std::string_view, FileData&) noexcept;
+
+        public:
+            FileSystem() noexcept;
+            FileSystem(const FileSystem&) noexcept = delete;
+            FileSystem(FileSystem&&) noexcept = delete;
+            ~FileSystem() noexcept = default;
+
+            [[nodiscard]] bool MountPack(const std::string&) noexcept;
+            [[nodiscard]] bool MountDirectory(const std::string&) noexcept;
+            void UnmountAll() noexcept;
+
+            [[nodiscard]] bool Exists(std::string_view) const noexcept;
+            [[nodiscard]] bool Read(std::string_view, FileData&) noexcept;
+
+            void SetVerifyContent(bool) noexcept;
+            [[nodiscard]] FileSystemStats GetStats() const noexcept;
+
+            FileSystem& operator=(const FileSystem&) noexcept = delete;
+            FileSystem& operator=(FileSystem&&) noexcept = delete;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "../Type/Types.hpp"
+
+inline namespace neoxops {
+    namespace system {
+        /// @brief 윈도우 인터페이스
+        /// @note 플랫폼별 윈도우(Win32 등)와 헤드리스용 NullWindow가 이 인터페이스를 구현합니다.
+        class IWindow {
+        public:
+            virtual ~IWindow() noexcept = default;
+
+            [[nodiscard]] virtual bool Create(const char*, int32_t, int32_t, bool) noexcept = 0;
+            virtual void Show() noexcept = 0;
+            virtual void Close() noexcept = 0;
+            [[nodiscard]] virtual bool ProcessMessages() noexcept = 0;
+
+            virtual void SetPosition(int32_t, int32_t) noexcept = 0;
+            virtual void SetSize(int32_t, int32_t) noexcept = 0;
+            virtual void SetTitle(const char*) noexcept = 0;
+
+            [[nodiscard]] virtual void* GetNativeHandle() const noexcept = 0;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../Type/Types.hpp"
+
+inline namespace neoxops {
+    namespace system {
+        /// @brief 작업 완료 카운터
+        /// @note 작업을 예약할 때 1 증가하고, 작업이 끝나면 1 감소합니다.
+        ///       실행 중인 작업이 같은 카운터로 자식 작업을 예약하면 부모를 기다리는 쪽은 자식까지 모두 기다리게 됩니다. (fork-join)
+        struct JobCounter final {
+            std::atomic<int32_t> Value{ 0 };        ///< 남은 작업 수
+
+            /// @brief 모든 작업이 끝났는지 확인합니다.
+            /// @return 완료(true), 진행 중(false)
+            [[nodiscard]] bool IsDone() const noexcept { return Value.load(std::memory_order_acquire) == 0; }
+        };
+
+        /// @brief 작업 훔치기(work-stealing) 기반 작업 시스템
+        /// @note 작업 스레드마다 덱을 두고, 자신의 덱은 LIFO로 꺼내며 비면 다른 스레드의 덱에서 FIFO로 훔칩니다.
+        ///       Initialize를 호출한 스레드가 메인 스레드(인덱스 0)로 등록되며 Wait 중에는 함께 작업을 처리합니다.
+        ///       등록되지 않은 스레드(예: 시뮬레이션 스레드)에서 예약한 작업은 전역 큐를 거칩니다.
+        class JobSystem final {
+        public:
+            using JobFunction = std::function<void()>;
+            using RangeFunction = std::function<void(uint32_t, uint32_t)>;
+
+        private:
+            /// @brief 작업
+            struct Job final {
+                JobFunction Function;               ///< 실행할 함수
+                JobCounter* Counter;                ///< 완료 시 감소시킬 카운터 (nullptr 가능)
+            };
+
+            /// @brief 작업 덱 (Chase-Lev)
+            /// @note 소유 스레드만 Push, Pop을 호출하며 Steal은 모든 스레드에서 호출할 수 있습니다.
+            class WorkQueue final {
+            private:
+                static constexpr int64_t CAPACITY = 4096;       ///< 용량 (2의 거듭제곱)
+
+                std::atomic<int64_t> m_Top;                     ///< 훔치는 쪽 위치
+                std::atomic<int64_t> m_Bottom;                  ///< 소유자 쪽 위치
+                std::unique_ptr<std::atomic<Job*>[]> m_Jobs;    ///< 원형 버퍼
+
+            public:
+                WorkQueue() noexcept;
+
+                [[nodiscard]] bool Push(Job*) noexcept;
+                [[nodiscard]] Job* Pop() noexcept;
+                [[nodiscard]] Job* Steal() noexcept;
+            };
+
+            std::vector<std::unique_ptr<WorkQueue>> m_Queues;   ///< 스레드별 작업 덱 (0: 메인 스레드)
+            std::vector<std::thread> m_Workers;                 ///< 작업 스레드
+
+            std::mutex m_GlobalMutex;                           ///< 전역 큐 동기화
+            std::deque<Job*> m_GlobalQueue;                     ///< 등록되지 않은 스레드가 예약한 작업
+            std::mutex m_MainMutex;                             ///< 메인 스레드 큐 동기화
+            std::deque<Job*> m_MainQueue;                       ///< 메인 스레드 전용 작업
+
+            std::mutex m_SleepMutex;                            ///< 대기 동기화
+            std::condition_variable m_SleepCondition;           ///< 작업 도착 알림
+            std::atomic<int32_t> m_PendingJobs;                 ///< 아직 실행되지 않은 작업 수 (메인 스레드 전용 작업 제외)
+            std::atomic<int32_t> m_SleepingWorkers;             ///< 잠들었거나 잠들려는 작업 스레드 수
+            std::atomic<bool> m_Shutdown;                       ///< 종료 요청
+            std::thread::id m_MainThreadID;                     ///< 메인 스레드 식별자
+
+            void workerMain(uint32_t) noexcept;
+            void submit(Job*) noexcept;
+            [[nodiscard]] Job* findJob() noexcept;
+            void execute(Job*) noexcept;
+
+        public:
+            JobSystem() noexcept;
+            JobSystem(const JobSystem&) noexcept = delete;
+            JobSystem(JobSystem&&) noexcept = delete;
+            ~JobSystem() noexcept;
+
+            [[nodiscard]] bool Initialize(uint32_t = 0U) noexcept;
+            void Shutdown() noexcept;
+
+            void Run(JobFunction, JobCounter* = nullptr) noexcept;
+            void RunOnMainThread(JobFunction, JobCounter* = nullptr) noexcept;
+            void Wait(JobCounter&) noexcept;
+            void ParallelFor(uint32_t, uint32_t, uint32_t, const RangeFunction&) noexcept;
+
+            [[nodiscard]] uint32_t ProcessMainThreadJobs() noexcept;
+
+            [[nodiscard]] uint32_t GetThreadCount() const noexcept;
+            [[nodiscard]] bool IsMainThread() const noexcept;
+
+            JobSystem& operator=(const JobSystem&) noexcept = delete;
+            JobSystem& operator=(JobSystem&&) noexcept = delete;
+        };
+    }
+}
\ No newline at end of file
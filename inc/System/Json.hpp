@@ -0,0 +1,116 @@
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include <vector>
+#include "../Type/Types.hpp"
+
+inline namespace neoxops {
+    namespace system {
+        /// @brief JSON 값 종류
+        enum class JsonType : uint8_t {
+            Null,
+            Bool,
+            Number,
+            String,
+            Array,
+            Object
+        };
+
+        // 전방 선언
+        struct JsonMember;
+
+        /// @brief JSON 값
+        /// @note JsonDocument의 아레나에 있으며 문서가 살아있는 동안만 유효합니다.
+        ///       없는 멤버나 범위 밖 요소를 찾으면 Null 값을 돌려주므로 검사 없이 이어서 찾을 수 있습니다.
+        struct JsonValue final {
+            JsonType Type;                      ///< 종류
+            uint32_t Count;                     ///< 문자열 길이, 배열 요소 수, 객체 멤버 수
+            union {
+                bool Bool;                      ///< Bool 값
+                double Number;                  ///< Number 값
+                const char* String;             ///< String 값 (널 문자로 끝나지 않음)
+                const JsonValue* Items;         ///< Array 요소
+                const JsonMember* Members;      ///< Object 멤버
+            };
+
+            [[nodiscard]] static const JsonValue& GetNull() noexcept;
+
+            [[nodiscard]] bool IsNull() const noexcept { return Type == JsonType::Null; }
+            [[nodiscard]] bool IsBool() const noexcept { return Type == JsonType::Bool; }
+            [[nodiscard]] bool IsNumber() const noexcept { return Type == JsonType::Number; }
+            [[nodiscard]] bool IsString() const noexcept { return Type == JsonType::String; }
+            [[nodiscard]] bool IsArray() const noexcept { return Type == JsonType::Array; }
+            [[nodiscard]] bool IsObject() const noexcept { return Type == JsonType::Object; }
+
+            [[nodiscard]] bool GetBool(bool = false) const noexcept;
+            [[nodiscard]] double GetNumber(double = 0.0) const noexcept;
+            [[nodiscard]] float GetFloat(float = 0.0f) const noexcept;
+            [[nodiscard]] int32_t GetInt(int32_t = 0) const noexcept;
+            [[nodiscard]] uint32_t GetUint(uint32_t = 0U) const noexcept;
+            [[nodiscard]] std::string_view GetString(std::string_view = {}) const noexcept;
+
+            [[nodiscard]] uint32_t GetSize() const noexcept;
+            [[nodiscard]] const JsonValue& operator[](size_t) const noexcept;
+            [[nodiscard]] const JsonValue& operator[](std::string_view) const noexcept;
+            [[nodiscard]] const JsonValue* Find(std::string_view) const noexcept;
+            [[nodiscard]] const JsonMember& GetMember(size_t) const noexcept;
+        };
+
+        /// @brief JSON 객체 멤버
+        struct JsonMember final {
+            std::string_view Name;              ///< 이름
+            JsonValue Value;                    ///< 값
+        };
+
+        /// @brief JSON 문서
+        /// @note 원문을 한 번만 훑으며 값을 바로 만드는 재귀 하강 파서입니다. 토큰 목록을 따로 만들지 않습니다.
+        ///       값, 배열, 멤버는 큰 블록 단위로 할당하는 아레나에 두므로 문서 전체가 할당 몇 번으로 끝나고 한 번에 해제됩니다.
+        ///       이스케이프가 없는 문자열(대부분)은 원문을 가리키기만 하므로, 원문은 문서보다 오래 살아있어야 합니다.
+        class JsonDocument final {
+        public:
+            static constexpr size_t BLOCK_SIZE      = 64U * 1024U;  ///< 아레나 블록 크기
+            static constexpr uint32_t MAX_DEPTH     = 256U;         ///< 최대 중첩 깊이
+
+        private:
+            std::vector<std::unique_ptr<byte_t[]>> m_Blocks;        ///< 아레나 블록
+            size_t m_BlockOffset;                                   ///< 마지막 블록에서 사용한 크기
+            size_t m_BlockSize;                                     ///< 마지막 블록의 크기
+            size_t m_ArenaSize;                                     ///< 모든 블록의 크기 합
+            std::vector<JsonValue> m_ValueStack;                    ///< 파싱 중인 배열 요소 (재사용)
+            std::vector<JsonMember> m_MemberStack;                  ///< 파싱 중인 객체 멤버 (재사용)
+            JsonValue m_Root;                                       ///< 루트 값
+
+            const char* m_Cursor;                                   ///< 파싱 위치
+            const char* m_End;                                      ///< 원문 끝
+
+            [[nodiscard]] void* allocate(size_t, size_t) noexcept;
+            void skipWhitespace() noexcept;
+            [[nodiscard]] bool parseValue(JsonValue&, uint32_t) noexcept;
+            [[nodiscard]] bool parseString(std::string_view&) noexcept;
+            [[nodiscard]] bool parseNumber(JsonValue&) noexcept;
+            [[nodiscard]] bool parseArray(JsonValue&, uint32_t) noexcept;
+            [[nodiscard]] bool parseObject(JsonValue&, uint32_t) noexcept;
+
+        public:
+            JsonDocument() noexcept;
+            JsonDocument(const JsonDocument&) noexcept = delete;
+            JsonDocument(JsonDocument&&) noexcept = default;
+            ~JsonDocument() noexcept = default;
+
+            [[nodiscard]] bool Parse(const char*, size_t) noexcept;
+            void Clear() noexcept;
+
+            /// @brief 루트 값을 취득합니다.
+            /// @return 루트 값 (파싱 전이거나 실패했으면 Null)
+            [[nodiscard]] const JsonValue& GetRoot() const noexcept { return m_Root; }
+
+            /// @brief 아레나가 사용 중인 메모리를 취득합니다.
+            /// @return 크기 (바이트 단위)
+            [[nodiscard]] size_t GetArenaSize() const noexcept { return m_ArenaSize; }
+
+            JsonDocument& operator=(const JsonDocument&) noexcept = delete;
+            JsonDocument& operator=(JsonDocument&&) noexcept = default;
+        };
+    }
+}
\ No newline at end of file
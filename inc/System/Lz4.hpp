@@ -0,0 +1,20 @@
+#pragma once
+
+#include "../Type/Types.hpp"
+
+inline namespace neoxops {
+    namespace system {
+        /// @brief LZ4 블록 압축
+        /// @note LZ4 블록 형식(프레임 헤더 없음)과 호환됩니다. 압축은 해시 테이블 하나만 쓰는 탐욕적 방식이라 빠르고,
+        ///       해제는 입력과 출력 범위를 모두 검사하므로 손상된 데이터를 넣어도 범위 밖을 읽거나 쓰지 않습니다.
+        ///       압축 결과에는 원본 크기가 들어있지 않으므로 호출하는 쪽에서 따로 보관해야 합니다.
+        class Lz4 final {
+        public:
+            Lz4() noexcept = delete;
+
+            [[nodiscard]] static size_t GetMaxCompressedSize(size_t) noexcept;
+            [[nodiscard]] static size_t Compress(const void*, size_t, void*, size_t) noexcept;
+            [[nodiscard]] static bool Decompress(const void*, size_t, void*, size_t) noexcept;
+        };
+    }
+}
\ No newline at end of file
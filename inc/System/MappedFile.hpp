@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+#include "../Type/Types.hpp"
+
+inline namespace neoxops {
+    namespace system {
+        /// @brief 읽기 전용 메모리 매핑 파일
+        /// @note 파일 내용을 복사하지 않고 가상 메모리에 매핑하므로, 읽은 페이지만 운영체제 페이지 캐시에서 올라옵니다.
+        ///       같은 파일을 여러 번 열어도 물리 메모리는 공유됩니다.
+        class MappedFile final {
+        private:
+            const byte_t* m_Data;               ///< 매핑된 내용 (비어있으면 nullptr)
+            size_t m_Size;                      ///< 크기 (바이트 단위)
+            void* m_Handle;                     ///< 매핑 핸들 (Windows 전용)
+
+        public:
+            MappedFile() noexcept;
+            MappedFile(const MappedFile&) noexcept = delete;
+            MappedFile(MappedFile&&) noexcept;
+            ~MappedFile() noexcept;
+
+            [[nodiscard]] bool Open(const std::string&) noexcept;
+            void Close() noexcept;
+
+            /// @brief 열려 있는지 확인합니다.
+            /// @return 열림(true), 닫힘(false)
+            [[nodiscard]] bool IsOpen() const noexcept { return m_Data != nullptr; }
+
+            /// @brief 매핑된 내용을 취득합니다.
+            /// @return 내용 (열려 있지 않으면 nullptr)
+            [[nodiscard]] const byte_t* GetData() const noexcept { return m_Data; }
+
+            /// @brief 크기를 취득합니다.
+            /// @return 크기 (바이트 단위)
+            [[nodiscard]] size_t GetSize() const noexcept { return m_Size; }
+
+            MappedFile& operator=(const MappedFile&) noexcept = delete;
+            MappedFile& operator=(MappedFile&&) noexcept;
+        };
+    }
+}
\ No newline at end of file
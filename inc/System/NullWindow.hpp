@@ -0,0 +1,36 @@
+#pragma once
+
+#include "IWindow.hpp"
+
+inline namespace neoxops {
+    namespace system {
+        /// @brief 헤드리스 윈도우 클래스
+        /// @note 디스플레이 없이 메인 루프를 구동하기 위한 빈 구현입니다.
+        class NullWindow final : public IWindow {
+        private:
+            int32_t m_Width;                    ///< 너비
+            int32_t m_Height;                   ///< 높이
+            bool m_QuitRequested;               ///< 종료 요청 여부
+
+        public:
+            NullWindow() noexcept;
+            NullWindow(const NullWindow&) noexcept = delete;
+            NullWindow(NullWindow&&) noexcept = delete;
+            ~NullWindow() noexcept override;
+
+            [[nodiscard]] bool Create(const char*, int32_t, int32_t, bool) noexcept override;
+            void Show() noexcept override;
+            void Close() noexcept override;
+            [[nodiscard]] bool ProcessMessages() noexcept override;
+
+            void SetPosition(int32_t, int32_t) noexcept override;
+            void SetSize(int32_t, int32_t) noexcept override;
+            void SetTitle(const char*) noexcept override;
+
+            [[nodiscard]] void* GetNativeHandle() const noexcept override;
+
+            NullWindow& operator=(const NullWindow&) noexcept = delete;
+            NullWindow& operator=(NullWindow&&) noexcept = delete;
+        };
+    }
+}
\ No newline at end of file
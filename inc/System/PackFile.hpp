@@ -0,0 +1,141 @@
+#pragma once
+
+#include <fstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "MappedFile.hpp"
+
+inline namespace neoxops {
+    namespace system {
+        /// @brief 팩 파일 헤더
+        /// @note 헤더 뒤로 파일 데이터가 이어지고, 끝에 디렉터리(PackEntry 배열), 청크 크기 배열, 경로 문자열 테이블이 놓입니다.
+        ///       헤더는 모든 내용을 기록한 뒤 마지막에 쓰므로, 기록이 중간에 끊긴 팩은 식별자가 맞지 않아 열리지 않습니다.
+        struct PackHeader final {
+            uint32_t Magic;                     ///< 식별자 (PackFile::MAGIC)
+            uint32_t Version;                   ///< 형식 버전 (PackFile::VERSION)
+            uint32_t EntryCount;                ///< 파일 수
+            uint32_t ChunkCount;                ///< 청크 수 (압축된 파일 전체 합)
+            uint32_t ChunkSize;                 ///< 청크 크기 (압축 전 기준, PackFile::CHUNK_SIZE)
+            uint32_t NameSize;                  ///< 경로 문자열 테이블 크기
+            uint64_t EntryOffset;               ///< 디렉터리 위치 (파일 시작 기준)
+            uint64_t ChunkOffset;               ///< 청크 크기 배열 위치
+            uint64_t NameOffset;                ///< 경로 문자열 테이블 위치
+        };
+
+        /// @brief 팩 디렉터리 항목
+        /// @note 디렉터리는 PathHash 오름차순으로 정렬되어 있어 이진 탐색으로 찾습니다.
+        ///       내용이 같은 파일은 데이터를 한 번만 기록하고 여러 항목이 같은 위치를 가리킵니다.
+        struct PackEntry final {
+            uint64_t PathHash;                  ///< 정규화한 경로의 해시
+            uint64_t ContentHash;               ///< 원본 내용의 해시 (Hash64)
+            uint64_t Offset;                    ///< 데이터 위치 (파일 시작 기준, DATA_ALIGNMENT 정렬)
+            uint64_t Size;                      ///< 원본 크기
+            uint64_t PackedSize;                ///< 팩에 기록된 크기 (Size와 같으면 압축하지 않고 그대로 보관)
+            uint32_t FirstChunk;                ///< 첫 청크 (청크 크기 배열 기준, 압축된 파일 전용)
+            uint32_t NameOffset;                ///< 경로 위치 (경로 문자열 테이블 기준, 널 종료)
+        };
+
+        /// @brief 읽기 전용 자산 팩
+        /// @note 팩 전체를 메모리 매핑하므로 여는 데 파일 하나의 시스템 호출만 들고, 읽은 페이지만 운영체제 페이지 캐시에서 올라옵니다.
+        ///       압축된 파일은 CHUNK_SIZE 단위로 나눠 각각 LZ4로 압축되어 있으며, 줄어들지 않는 청크는 그대로 보관됩니다.
+        ///       모든 청크가 그대로 보관된 파일은 매핑된 데이터를 복사 없이 바로 가리킬 수 있습니다.
+        ///       Open 이후에는 상태를 바꾸지 않으므로 여러 스레드에서 동시에 읽어도 안전합니다.
+        class PackFile final {
+        public:
+            static constexpr uint32_t MAGIC             = 0x4B50584EU;      ///< 'NXPK'
+            static constexpr uint32_t VERSION           = 1U;               ///< 형식 버전 (배치가 바뀌면 올림)
+            static constexpr uint32_t DATA_ALIGNMENT    = 64U;              ///< 파일 데이터 정렬 (캐시 라인, 쿠킹된 자산의 배열 정렬과 같음)
+            static constexpr uint32_t CHUNK_SIZE        = 65536U;           ///< 압축 청크 크기 (압축 전 기준)
+            static constexpr uint32_t CHUNK_RAW         = 0x80000000U;      ///< 청크 크기에 붙는 압축하지 않음 표시
+            static constexpr uint32_t MAX_PATH_LENGTH   = 512U;             ///< 최대 경로 길이 (바이트 단위)
+
+        private:
+            MappedFile m_File;                  ///< 매핑된 팩 파일
+            const PackEntry* m_Entries;         ///< 디렉터리 (PathHash 오름차순)
+            const uint32_t* m_Chunks;           ///< 청크 크기 배열
+            const char* m_Names;                ///< 경로 문자열 테이블
+            uint32_t m_EntryCount;              ///< 파일 수
+
+            [[nodiscard]] bool validate(const PackHeader&) const noexcept;
+
+        public:
+            PackFile() noexcept;
+            PackFile(const PackFile&) noexcept = delete;
+            PackFile(PackFile&&) noexcept = delete;
+            ~PackFile() noexcept = default;
+
+            [[nodiscard]] bool Open(const std::string&) noexcept;
+            void Close() noexcept;
+
+            [[nodiscard]] const PackEntry* Find(uint64_t) const noexcept;
+            [[nodiscard]] const PackEntry* Find(std::string_view) const noexcept;
+            [[nodiscard]] std::string_view GetPath(const PackEntry&) const noexcept;
+            [[nodiscard]] const byte_t* GetStoredData(const PackEntry&) const noexcept;
+            [[nodiscard]] bool Read(const PackEntry&, void*) const noexcept;
+
+            /// @brief 열려 있는지 확인합니다.
+            /// @return 열림(true), 닫힘(false)
+            [[nodiscard]] bool IsOpen() const noexcept { return m_File.IsOpen(); }
+
+            /// @brief 디렉터리를 취득합니다.
+            /// @return 항목 (PathHash 오름차순)
+            [[nodiscard]] std::span<const PackEntry> GetEntries() const noexcept { return { m_Entries, m_EntryCount }; }
+
+            [[nodiscard]] static bool ReadHeader(const void*, size_t, PackHeader&) noexcept;
+            [[nodiscard]] static size_t NormalizePath(std::string_view, char*) noexcept;
+            [[nodiscard]] static uint64_t GetPathHash(std::string_view) noexcept;
+
+            PackFile& operator=(const PackFile&) noexcept = delete;
+            PackFile& operator=(PackFile&&) noexcept = delete;
+        };
+
+        /// @brief 팩 기록 통계
+        struct PackWriterStats final {
+            uint64_t FileCount = 0ULL;          ///< 추가한 파일 수
+            uint64_t DuplicateCount = 0ULL;     ///< 내용이 같아 데이터를 공유한 파일 수
+            uint64_t StoredCount = 0ULL;        ///< 압축하지 않고 그대로 보관한 파일 수
+            uint64_t SourceBytes = 0ULL;        ///< 원본 크기 합
+            uint64_t PackedBytes = 0ULL;        ///< 기록한 데이터 크기 합 (공유한 데이터는 한 번만)
+        };
+
+        /// @brief 자산 팩 기록기 (오프라인 PackBuilder 도구용)
+        /// @note 파일 데이터는 추가하는 즉시 기록하고 디렉터리만 메모리에 모아두므로, 팩 크기와 관계없이 파일 하나 분량의 메모리만 씁니다.
+        ///       내용을 공유하기 전에 기록한 데이터를 다시 읽어 비교하므로 팩 파일은 읽기/쓰기로 엽니다.
+        class PackWriter final {
+        private:
+            std::fstream m_File;                                    ///< 기록 중인 팩 파일
+            std::vector<PackEntry> m_Entries;                       ///< 디렉터리 (추가한 순서)
+            std::vector<uint32_t> m_Chunks;                         ///< 청크 크기 배열
+            std::string m_Names;                                    ///< 경로 문자열 테이블
+            std::unordered_map<uint64_t, uint32_t> m_PathIndex;     ///< 경로 해시 → 항목 (중복 검사)
+            std::unordered_multimap<uint64_t, uint32_t> m_ContentIndex; ///< 내용 해시 → 항목 (데이터 공유 후보, 해시 충돌 시 여러 개)
+            std::vector<byte_t> m_Buffer;                           ///< 청크 압축 버퍼
+            std::vector<byte_t> m_CompareBuffer;                    ///< 공유 후보 청크 압축 해제 버퍼
+            uint64_t m_Offset;                                      ///< 다음 기록 위치
+            PackWriterStats m_Stats;                                ///< 통계
+
+            [[nodiscard]] bool writePadded(const void*, size_t) noexcept;
+            [[nodiscard]] bool matches(const PackEntry&, const void*) noexcept;
+
+        public:
+            PackWriter() noexcept;
+            PackWriter(const PackWriter&) noexcept = delete;
+            PackWriter(PackWriter&&) noexcept = delete;
+            ~PackWriter() noexcept = default;
+
+            [[nodiscard]] bool Create(const std::string&) noexcept;
+            [[nodiscard]] bool Add(std::string_view, const void*, size_t, bool = true) noexcept;
+            [[nodiscard]] bool Finish() noexcept;
+
+            /// @brief 통계를 취득합니다.
+            /// @return 통계
+            [[nodiscard]] const PackWriterStats& GetStats() const noexcept { return m_Stats; }
+
+            PackWriter& operator=(const PackWriter&) noexcept = delete;
+            PackWriter& operator=(PackWriter&&) noexcept = delete;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include "../Type/Types.hpp"
+
+inline namespace neoxops {
+    namespace system {
+        /// @brief 잠금 없는 삼중 버퍼
+        /// @tparam T 버퍼 형식
+        /// @note 생산자 스레드 하나와 소비자 스레드 하나 사이의 최신 값 전달용입니다.
+        ///       생산자는 쓰기 버퍼를 채운 뒤 Publish하고, 소비자는 Acquire로 가장 최근에 발행된 버퍼를 읽기 버퍼로 가져옵니다.
+        ///       양쪽 모두 대기하지 않으며, 소비자가 가져가지 않은 중간 결과는 다음 발행으로 덮어쓰입니다.
+        ///       Publish 후의 쓰기 버퍼는 이전 내용이 아닌 오래된 버퍼이므로, 생산자는 매번 전체 내용을 다시 써야 합니다.
+        template <typename T>
+        class TripleBuffer final {
+        private:
+            static constexpr uint8_t INDEX_MASK = 0x03U;        ///< 버퍼 인덱스
+            static constexpr uint8_t DIRTY_BIT  = 0x04U;        ///< 소비자가 아직 가져가지 않은 발행 여부
+
+            std::array<T, 3> m_Buffers;                         ///< 버퍼
+            std::atomic<uint8_t> m_Middle;                      ///< 교환용 버퍼 인덱스 (| DIRTY_BIT)
+            uint8_t m_Write;                                    ///< 생산자 전용 버퍼 인덱스
+            uint8_t m_Read;                                     ///< 소비자 전용 버퍼 인덱스
+
+        public:
+            TripleBuffer() noexcept : m_Middle(1U), m_Write(0U), m_Read(2U) {}
+            TripleBuffer(const TripleBuffer&) noexcept = delete;
+            TripleBuffer(TripleBuffer&&) noexcept = delete;
+            ~TripleBuffer() noexcept = default;
+
+            /// @brief 생산자의 쓰기 버퍼를 취득합니다.
+            /// @return 쓰기 버퍼
+            [[nodiscard]] T& GetWriteBuffer() noexcept {
+                return m_Buffers[m_Write];
+            }
+
+            /// @brief 쓰기 버퍼를 발행합니다. (생산자 전용)
+            void Publish() noexcept {
+                const uint8_t previous = m_Middle.exchange(static_cast<uint8_t>(m_Write | DIRTY_BIT), std::memory_order_acq_rel);
+                m_Write = (previous & INDEX_MASK);
+            }
+
+            /// @brief 가장 최근에 발행된 버퍼를 읽기 버퍼로 가져옵니다. (소비자 전용)
+            /// @return 새 버퍼를 가져옴(true), 새로 발행된 버퍼 없음(false)
+            bool Acquire() noexcept {
+                if ((m_Middle.load(std::memory_order_relaxed) & DIRTY_BIT) == 0U) {
+                    return false;
+                }
+
+                const uint8_t previous = m_Middle.exchange(m_Read, std::memory_order_acq_rel);
+                m_Read = (previous & INDEX_MASK);
+                return true;
+            }
+
+            /// @brief 소비자의 읽기 버퍼를 취득합니다.
+            /// @return 읽기 버퍼
+            [[nodiscard]] T& GetReadBuffer() noexcept {
+                return m_Buffers[m_Read];
+            }
+
+            /// @brief 소비자의 읽기 버퍼를 취득합니다.
+            /// @return 읽기 버퍼
+            [[nodiscard]] const T& GetReadBuffer() const noexcept {
+                return m_Buffers[m_Read];
+            }
+
+            TripleBuffer& operator=(const TripleBuffer&) noexcept = delete;
+            TripleBuffer& operator=(TripleBuffer&&) noexcept = delete;
+        };
+    }
+}
\ No newline at end of file
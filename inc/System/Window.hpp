@@ -1,34 +1,39 @@
-#pragma once
-
-#define WIN32_LEAN_AND_MEAN
-#include <windows.h>
-#include "../Type/Types.hpp"
-
-inline namespace neoxops {
-    namespace system {        
-        /// @brief Window 클래스
-        class Window final {
-        private:
-            HWND m_hWnd;                        ///!< 윈도우의 핸들
-
-        public:
-            Window() noexcept;
-            Window(const Window&) noexcept = delete;
-            Window(Window&&) noexcept = delete;
-            ~Window() noexcept;
-
-            [[nodiscard]] bool Create(HINSTANCE, const char*, int32_t, int32_t, bool) noexcept;
-            LRESULT MessageHandler(UINT, WPARAM, LPARAM) noexcept;
-
-            void SetPosition(int32_t, int32_t) noexcept;
-            void SetSize(int32_t, int32_t) noexcept;
-            void SetTitle(const char*) noexcept;
-            void SetHandle(HWND) noexcept;
-            
-            [[nodiscard]] HWND GetHandle() const noexcept;
-
-            Window& operator=(const Window&) noexcept = delete;
-            Window& operator=(Window&&) noexcept = delete;
-        };
-    }
+#pragma once
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include "IWindow.hpp"
+
+inline namespace neoxops {
+    namespace system {
+        /// @brief Window 클래스
+        class Window final : public IWindow {
+        private:
+            HINSTANCE m_hInstance;              ///!< 응용 프로그램의 인스턴스 핸들
+            HWND m_hWnd;                        ///!< 윈도우의 핸들
+
+        public:
+            Window(HINSTANCE) noexcept;
+            Window(const Window&) noexcept = delete;
+            Window(Window&&) noexcept = delete;
+            ~Window() noexcept override;
+
+            [[nodiscard]] bool Create(const char*, int32_t, int32_t, bool) noexcept override;
+            void Show() noexcept override;
+            void Close() noexcept override;
+            [[nodiscard]] bool ProcessMessages() noexcept override;
+            LRESULT MessageHandler(UINT, WPARAM, LPARAM) noexcept;
+
+            void SetPosition(int32_t, int32_t) noexcept override;
+            void SetSize(int32_t, int32_t) noexcept override;
+            void SetTitle(const char*) noexcept override;
+            void SetHandle(HWND) noexcept;
+
+            [[nodiscard]] HWND GetHandle() const noexcept;
+            [[nodiscard]] void* GetNativeHandle() const noexcept override;
+
+            Window& operator=(const Window&) noexcept = delete;
+            Window& operator=(Window&&) noexcept = delete;
+        };
+    }
 }
\ No newline at end of file
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Types.hpp"
+
+inline namespace neoxops {
+    /// @brief 64비트 비암호화 해시 (xxHash64 알고리즘)
+    /// @note 캐시 키, 내용 기반 중복 제거처럼 충돌 확률이 낮고 빨라야 하는 곳에 사용합니다. 보안 용도로는 사용하지 마십시오.
+    ///       결과는 플랫폼과 관계없이 같으므로 파일에 기록해도 됩니다.
+    /// @param data 데이터
+    /// @param size 크기 (바이트 단위)
+    /// @param seed 초깃값
+    /// @return 해시
+    [[nodiscard]] uint64_t Hash64(const void* data, size_t size, uint64_t seed = 0ULL) noexcept;
+
+    /// @brief 두 해시를 결합합니다.
+    /// @param hash 기존 해시
+    /// @param value 결합할 값
+    /// @return 결합된 해시
+    [[nodiscard]] constexpr uint64_t HashCombine(uint64_t hash, uint64_t value) noexcept {
+        hash ^= value + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+        return hash;
+    }
+}
\ No newline at end of file
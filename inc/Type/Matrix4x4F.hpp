@@ -0,0 +1,349 @@
+#pragma once
+
+#include <cmath>
+#include "SIMD.hpp"
+#include "Types.hpp"
+#include "Vector3F.hpp"
+#include "Vector4F.hpp"
+
+inline namespace neoxops {
+    /// @brief 4x4 행렬 (행 우선, 행 벡터)
+    /// @note 벡터는 행 벡터로 취급하여 v * M 순서로 곱합니다. (DirectXMath, HLSL mul(v, M)과 같은 규약)
+    ///       따라서 A * B는 "A를 먼저 적용한 뒤 B를 적용"하며, 이동 성분은 4번째 행(M[3])에 있습니다.
+    ///       16바이트 정렬되어 각 행을 SSE/NEON 레지스터 하나로 읽고 쓰며, 곱셈과 변환은 SIMD로 처리됩니다.
+    struct alignas(16) Matrix4x4F final {
+        float M[4][4];      ///< 성분 [행][열]
+
+        constexpr Matrix4x4F() noexcept : M{ { 1.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 1.0f } } {}
+        constexpr Matrix4x4F(const Vector4F& r0, const Vector4F& r1, const Vector4F& r2, const Vector4F& r3) noexcept
+            : M{ { r0.X, r0.Y, r0.Z, r0.W }, { r1.X, r1.Y, r1.Z, r1.W }, { r2.X, r2.Y, r2.Z, r2.W }, { r3.X, r3.Y, r3.Z, r3.W } } {}
+        constexpr Matrix4x4F(const Matrix4x4F&) noexcept = default;
+        constexpr Matrix4x4F(Matrix4x4F&&) noexcept = default;
+
+        /// @brief 단위 행렬
+        /// @return Matrix4x4F
+        static constexpr Matrix4x4F Identity() noexcept { return {}; }
+
+        /// @brief 이동 행렬
+        /// @param offset 이동량
+        /// @return Matrix4x4F
+        static constexpr Matrix4x4F Translation(const Vector3F& offset) noexcept {
+            return {
+                { 1.0f, 0.0f, 0.0f, 0.0f },
+                { 0.0f, 1.0f, 0.0f, 0.0f },
+                { 0.0f, 0.0f, 1.0f, 0.0f },
+                { offset, 1.0f }
+            };
+        }
+
+        /// @brief 크기 행렬
+        /// @param scale 축별 배율
+        /// @return Matrix4x4F
+        static constexpr Matrix4x4F Scaling(const Vector3F& scale) noexcept {
+            return {
+                { scale.X, 0.0f, 0.0f, 0.0f },
+                { 0.0f, scale.Y, 0.0f, 0.0f },
+                { 0.0f, 0.0f, scale.Z, 0.0f },
+                { 0.0f, 0.0f, 0.0f, 1.0f }
+            };
+        }
+
+        /// @brief X축 회전 행렬
+        /// @param radians 회전각 (라디안, X축 양의 방향에서 봤을 때 시계 방향)
+        /// @return Matrix4x4F
+        static Matrix4x4F RotationX(float radians) noexcept {
+            float s = std::sin(radians);
+            float c = std::cos(radians);
+            return {
+                { 1.0f, 0.0f, 0.0f, 0.0f },
+                { 0.0f,    c,    s, 0.0f },
+                { 0.0f,   -s,    c, 0.0f },
+                { 0.0f, 0.0f, 0.0f, 1.0f }
+            };
+        }
+
+        /// @brief Y축 회전 행렬
+        /// @param radians 회전각 (라디안)
+        /// @return Matrix4x4F
+        static Matrix4x4F RotationY(float radians) noexcept {
+            float s = std::sin(radians);
+            float c = std::cos(radians);
+            return {
+                {    c, 0.0f,   -s, 0.0f },
+                { 0.0f, 1.0f, 0.0f, 0.0f },
+                {    s, 0.0f,    c, 0.0f },
+                { 0.0f, 0.0f, 0.0f, 1.0f }
+            };
+        }
+
+        /// @brief Z축 회전 행렬
+        /// @param radians 회전각 (라디안)
+        /// @return Matrix4x4F
+        static Matrix4x4F RotationZ(float radians) noexcept {
+            float s = std::sin(radians);
+            float c = std::cos(radians);
+            return {
+                {    c,    s, 0.0f, 0.0f },
+                {   -s,    c, 0.0f, 0.0f },
+                { 0.0f, 0.0f, 1.0f, 0.0f },
+                { 0.0f, 0.0f, 0.0f, 1.0f }
+            };
+        }
+
+        /// @brief 뷰 행렬 (왼손 좌표계)
+        /// @param eye 카메라 위치
+        /// @param target 바라보는 지점
+        /// @param up 상방 (eye -> target 방향과 평행하면 안 됩니다.)
+        /// @return Matrix4x4F
+        static Matrix4x4F LookAtLH(const Vector3F& eye, const Vector3F& target, const Vector3F& up) noexcept {
+            return LookToLH(eye, target - eye, up);
+        }
+
+        /// @brief 뷰 행렬 (왼손 좌표계)
+        /// @param eye 카메라 위치
+        /// @param direction 바라보는 방향
+        /// @param up 상방 (direction과 평행하면 안 됩니다.)
+        /// @return Matrix4x4F
+        static Matrix4x4F LookToLH(const Vector3F& eye, const Vector3F& direction, const Vector3F& up) noexcept {
+            Vector3F zAxis = direction.Normalize();
+            Vector3F xAxis = Vector3F::Cross(up, zAxis).Normalize();
+            Vector3F yAxis = Vector3F::Cross(zAxis, xAxis);
+
+            return {
+                { xAxis.X, yAxis.X, zAxis.X, 0.0f },
+                { xAxis.Y, yAxis.Y, zAxis.Y, 0.0f },
+                { xAxis.Z, yAxis.Z, zAxis.Z, 0.0f },
+                { -Vector3F::Dot(xAxis, eye), -Vector3F::Dot(yAxis, eye), -Vector3F::Dot(zAxis, eye), 1.0f }
+            };
+        }
+
+        /// @brief 원근 투영 행렬 (왼손 좌표계, 깊이 0 ~ 1)
+        /// @param fovY 세로 시야각 (라디안)
+        /// @param aspect 종횡비 (너비 / 높이)
+        /// @param nearZ 근평면 거리 (0보다 커야 합니다.)
+        /// @param farZ 원평면 거리
+        /// @return Matrix4x4F
+        static Matrix4x4F PerspectiveFovLH(float fovY, float aspect, float nearZ, float farZ) noexcept {
+            float h = 1.0f / std::tan(fovY * 0.5f);
+            float w = h / aspect;
+            float range = farZ / (farZ - nearZ);
+
+            return {
+                {    w, 0.0f,            0.0f, 0.0f },
+                { 0.0f,    h,            0.0f, 0.0f },
+                { 0.0f, 0.0f,           range, 1.0f },
+                { 0.0f, 0.0f, -range * nearZ, 0.0f }
+            };
+        }
+
+        /// @brief 직교 투영 행렬 (왼손 좌표계, 깊이 0 ~ 1)
+        /// @param width 뷰 너비
+        /// @param height 뷰 높이
+        /// @param nearZ 근평면 거리
+        /// @param farZ 원평면 거리
+        /// @return Matrix4x4F
+        static constexpr Matrix4x4F OrthographicLH(float width, float height, float nearZ, float farZ) noexcept {
+            float range = 1.0f / (farZ - nearZ);
+
+            return {
+                { 2.0f / width, 0.0f, 0.0f, 0.0f },
+                { 0.0f, 2.0f / height, 0.0f, 0.0f },
+                { 0.0f, 0.0f, range, 0.0f },
+                { 0.0f, 0.0f, -range * nearZ, 1.0f }
+            };
+        }
+
+        /// @brief 근사 비교
+        /// @param lhs Matrix4x4F
+        /// @param rhs Matrix4x4F
+        /// @param epsilon 허용 오차
+        /// @return 근사(true), 비근사(false)
+        static bool NearlyEquals(const Matrix4x4F& lhs, const Matrix4x4F& rhs, float epsilon = 1e-5f) noexcept {
+            for (int32_t row = 0; row < 4; ++row) {
+                for (int32_t col = 0; col < 4; ++col) {
+                    if (std::fabs(lhs.M[row][col] - rhs.M[row][col]) > epsilon) {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        /// @brief 행렬 곱 (lhs를 먼저 적용한 뒤 rhs를 적용)
+        /// @param lhs Matrix4x4F
+        /// @param rhs Matrix4x4F
+        /// @return lhs * rhs
+        static Matrix4x4F Multiply(const Matrix4x4F& lhs, const Matrix4x4F& rhs) noexcept {
+            Matrix4x4F result;
+            for (int32_t row = 0; row < 4; ++row) {
+                transformRow(lhs.M[row], rhs, result.M[row]);
+            }
+
+            return result;
+        }
+
+        /// @brief 여러 행렬에 같은 행렬을 곱합니다. (본 팔레트, 월드 행렬 일괄 갱신 등)
+        /// @param src 원본 배열
+        /// @param rhs 뒤에 곱할 행렬
+        /// @param dst 결과 배열 (src와 같아도 됩니다.)
+        /// @param count 행렬 수
+        static void Multiply(const Matrix4x4F* src, const Matrix4x4F& rhs, Matrix4x4F* dst, size_t count) noexcept;
+
+        /// @brief 벡터 변환 (v * M)
+        /// @param vec Vector4F
+        /// @return Vector4F
+        Vector4F Transform(const Vector4F& vec) const noexcept {
+            Vector4F result;
+            transformRow(&vec.X, *this, &result.X);
+            return result;
+        }
+
+        /// @brief 점 변환 (W = 1, 원근 나눗셈 없음)
+        /// @param point 점
+        /// @return Vector3F
+        /// @note 아핀 변환(월드, 뷰) 전용입니다. 투영 행렬에는 TransformCoord를 사용합니다.
+        Vector3F TransformPoint(const Vector3F& point) const noexcept {
+            return Transform({ point, 1.0f }).ToVector3F();
+        }
+
+        /// @brief 좌표 변환 (W = 1, 결과를 W로 나눔)
+        /// @param point 점
+        /// @return Vector3F
+        Vector3F TransformCoord(const Vector3F& point) const noexcept {
+            return Transform({ point, 1.0f }).Project();
+        }
+
+        /// @brief 방향 변환 (W = 0, 이동 성분 무시)
+        /// @param normal 방향
+        /// @return Vector3F
+        /// @note 비균등 크기가 포함된 행렬로 법선을 변환할 때는 역행렬의 전치를 사용해야 합니다.
+        Vector3F TransformNormal(const Vector3F& normal) const noexcept {
+            return Transform({ normal, 0.0f }).ToVector3F();
+        }
+
+        /// @brief 여러 벡터를 변환합니다. (v * M)
+        /// @param matrix 변환 행렬
+        /// @param src 원본 배열
+        /// @param dst 결과 배열 (src와 같아도 됩니다.)
+        /// @param count 벡터 수
+        static void Transform(const Matrix4x4F& matrix, const Vector4F* src, Vector4F* dst, size_t count) noexcept;
+
+        /// @brief 여러 점을 변환합니다. (W = 1, 원근 나눗셈 없음)
+        /// @param matrix 변환 행렬
+        /// @param src 원본 배열
+        /// @param dst 결과 배열 (src와 같아도 됩니다.)
+        /// @param count 점 수
+        /// @note 수천 개 이상이면 Vector3FStream::Transform(SoA)이 더 빠릅니다.
+        static void TransformPoints(const Matrix4x4F& matrix, const Vector3F* src, Vector3F* dst, size_t count) noexcept;
+
+        /// @brief 전치 행렬
+        /// @return Matrix4x4F
+        constexpr Matrix4x4F Transpose() const noexcept {
+            return {
+                { M[0][0], M[1][0], M[2][0], M[3][0] },
+                { M[0][1], M[1][1], M[2][1], M[3][1] },
+                { M[0][2], M[1][2], M[2][2], M[3][2] },
+                { M[0][3], M[1][3], M[2][3], M[3][3] }
+            };
+        }
+
+        /// @brief 행렬식
+        /// @return 행렬식
+        float Determinant() const noexcept;
+
+        /// @brief 역행렬
+        /// @param result 역행렬 (실패 시 변경하지 않음)
+        /// @return 성공(true), 특이 행렬(false)
+        [[nodiscard]] bool Inverse(Matrix4x4F& result) const noexcept;
+
+        /// @brief 행의 취득
+        /// @param row 행 번호 (0 ~ 3)
+        /// @return Vector4F
+        constexpr Vector4F GetRow(int32_t row) const noexcept {
+            return { M[row][0], M[row][1], M[row][2], M[row][3] };
+        }
+
+        /// @brief 이동 성분의 취득
+        /// @return Vector3F
+        constexpr Vector3F GetTranslation() const noexcept {
+            return { M[3][0], M[3][1], M[3][2] };
+        }
+
+        /// @brief 성분 배열의 취득 (행 우선 16개)
+        /// @return 성분 배열
+        /// @note 상수 버퍼 업로드나 Vector3FStream::Transform에 그대로 넘길 수 있습니다.
+        const float* GetData() const noexcept { return &M[0][0]; }
+
+        Matrix4x4F& operator=(const Matrix4x4F&) noexcept = default;
+        Matrix4x4F& operator=(Matrix4x4F&&) noexcept = default;
+
+        /// @brief * 연산자 오버로딩
+        /// @param mat Matrix4x4F
+        /// @return Matrix4x4F
+        Matrix4x4F operator*(const Matrix4x4F& mat) const noexcept {
+            return Multiply(*this, mat);
+        }
+
+        /// @brief *= 연산자 오버로딩
+        /// @param mat Matrix4x4F
+        /// @return Matrix4x4F
+        Matrix4x4F& operator*=(const Matrix4x4F& mat) noexcept {
+            *this = Multiply(*this, mat);
+            return *this;
+        }
+
+        /// @brief == 연산자 오버로딩
+        /// @param lhs Matrix4x4F
+        /// @param rhs Matrix4x4F
+        /// @return 같다(true), 다르다(false)
+        friend constexpr bool operator==(const Matrix4x4F& lhs, const Matrix4x4F& rhs) noexcept {
+            for (int32_t row = 0; row < 4; ++row) {
+                for (int32_t col = 0; col < 4; ++col) {
+                    if (lhs.M[row][col] != rhs.M[row][col]) {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        /// @brief != 연산자 오버로딩
+        /// @param lhs Matrix4x4F
+        /// @param rhs Matrix4x4F
+        /// @return 다르다(true), 같다(false)
+        friend constexpr bool operator!=(const Matrix4x4F& lhs, const Matrix4x4F& rhs) noexcept {
+            return !(lhs == rhs);
+        }
+
+    private:
+        /// @brief 행 벡터 하나를 행렬로 변환합니다. (out = v * M)
+        /// @param v 16바이트 정렬된 4개 성분
+        /// @param mat 행렬
+        /// @param out 16바이트 정렬된 결과 (v와 같아도 됩니다.)
+        /// @note 모든 경로가 ((x*M0 + y*M1) + z*M2) + w*M3 순서로 더하므로 명령어 집합과 관계없이 결과가 같습니다.
+        static void transformRow(const float* v, const Matrix4x4F& mat, float* out) noexcept {
+#if defined(NEOXOPS_SIMD_SSE2)
+            __m128 vec = _mm_load_ps(v);
+            __m128 result = _mm_mul_ps(_mm_shuffle_ps(vec, vec, _MM_SHUFFLE(0, 0, 0, 0)), _mm_load_ps(mat.M[0]));
+            result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vec, vec, _MM_SHUFFLE(1, 1, 1, 1)), _mm_load_ps(mat.M[1])));
+            result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vec, vec, _MM_SHUFFLE(2, 2, 2, 2)), _mm_load_ps(mat.M[2])));
+            result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vec, vec, _MM_SHUFFLE(3, 3, 3, 3)), _mm_load_ps(mat.M[3])));
+            _mm_store_ps(out, result);
+#elif defined(NEOXOPS_SIMD_NEON)
+            float32x4_t vec = vld1q_f32(v);
+            float32x4_t result = vmulq_n_f32(vld1q_f32(mat.M[0]), vgetq_lane_f32(vec, 0));
+            result = vaddq_f32(result, vmulq_n_f32(vld1q_f32(mat.M[1]), vgetq_lane_f32(vec, 1)));
+            result = vaddq_f32(result, vmulq_n_f32(vld1q_f32(mat.M[2]), vgetq_lane_f32(vec, 2)));
+            result = vaddq_f32(result, vmulq_n_f32(vld1q_f32(mat.M[3]), vgetq_lane_f32(vec, 3)));
+            vst1q_f32(out, result);
+#else
+            float x = v[0], y = v[1], z = v[2], w = v[3];
+            for (int32_t col = 0; col < 4; ++col) {
+                out[col] = ((x * mat.M[0][col] + y * mat.M[1][col]) + z * mat.M[2][col]) + w * mat.M[3][col];
+            }
+#endif
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,256 @@
+#pragma once
+
+#include <cmath>
+#include "SIMD.hpp"
+#include "Types.hpp"
+#include "Vector3F.hpp"
+#include "Matrix4x4F.hpp"
+
+inline namespace neoxops {
+    /// @brief 회전 사원수
+    /// @note Matrix4x4F와 같은 규약으로, a * b는 "a를 먼저 적용한 뒤 b를 적용"합니다.
+    ///       즉 (a * b).ToMatrix() == a.ToMatrix() * b.ToMatrix() 입니다.
+    struct alignas(16) QuaternionF final {
+        float X;            ///< 벡터부 X
+        float Y;            ///< 벡터부 Y
+        float Z;            ///< 벡터부 Z
+        float W;            ///< 스칼라부
+
+        constexpr QuaternionF() noexcept : X(0.0f), Y(0.0f), Z(0.0f), W(1.0f) {}
+        constexpr QuaternionF(float x, float y, float z, float w) noexcept : X(x), Y(y), Z(z), W(w) {}
+        constexpr QuaternionF(const QuaternionF&) noexcept = default;
+        constexpr QuaternionF(QuaternionF&&) noexcept = default;
+
+        /// @brief 회전 없음
+        /// @return QuaternionF
+        static constexpr QuaternionF Identity() noexcept { return {}; }
+
+        /// @brief 축-각 회전
+        /// @param axis 회전축 (정규화되어 있지 않아도 됩니다.)
+        /// @param radians 회전각 (라디안)
+        /// @return QuaternionF
+        static QuaternionF FromAxisAngle(const Vector3F& axis, float radians) noexcept {
+            Vector3F n = axis.Normalize();
+            float s = std::sin(radians * 0.5f);
+            return { n.X * s, n.Y * s, n.Z * s, std::cos(radians * 0.5f) };
+        }
+
+        /// @brief 오일러 각 회전 (Z축 roll -> X축 pitch -> Y축 yaw 순서로 적용)
+        /// @param pitch X축 회전각 (라디안)
+        /// @param yaw Y축 회전각 (라디안)
+        /// @param roll Z축 회전각 (라디안)
+        /// @return QuaternionF
+        static QuaternionF FromEuler(float pitch, float yaw, float roll) noexcept {
+            return FromAxisAngle(Vector3F::Forward(), roll)
+                * FromAxisAngle(Vector3F::Right(), pitch)
+                * FromAxisAngle(Vector3F::Up(), yaw);
+        }
+
+        /// @brief 내적
+        /// @param lhs QuaternionF
+        /// @param rhs QuaternionF
+        /// @return 내적
+        static constexpr float Dot(const QuaternionF& lhs, const QuaternionF& rhs) noexcept {
+            return (lhs.X * rhs.X) + (lhs.Y * rhs.Y) + (lhs.Z * rhs.Z) + (lhs.W * rhs.W);
+        }
+
+        /// @brief 근사 비교 (q와 -q는 같은 회전으로 취급)
+        /// @param lhs QuaternionF
+        /// @param rhs QuaternionF
+        /// @return 근사(true), 비근사(false)
+        static bool NearlyEquals(const QuaternionF& lhs, const QuaternionF& rhs) noexcept {
+            return std::fabs(Dot(lhs, rhs)) >= 1.0f - 1e-5f;
+        }
+
+        /// @brief 곱 (lhs를 먼저 적용한 뒤 rhs를 적용)
+        /// @param lhs QuaternionF
+        /// @param rhs QuaternionF
+        /// @return QuaternionF
+        static QuaternionF Multiply(const QuaternionF& lhs, const QuaternionF& rhs) noexcept {
+            // 해밀턴 곱 p ⊗ q (p = rhs, q = lhs)를 p의 성분별로 4번의 곱셈-덧셈으로 계산합니다.
+            QuaternionF result;
+#if defined(NEOXOPS_SIMD_SSE2)
+            __m128 q = _mm_load_ps(&lhs.X);
+            __m128 p = _mm_load_ps(&rhs.X);
+            __m128 r = _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 3, 3)), q);
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(0, 1, 2, 3))), _mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f)));
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(1, 0, 3, 2))), _mm_setr_ps(1.0f, 1.0f, -1.0f, -1.0f)));
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 2, 2)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(2, 3, 0, 1))), _mm_setr_ps(-1.0f, 1.0f, 1.0f, -1.0f)));
+            _mm_store_ps(&result.X, r);
+#else
+            result.X = ((rhs.W * lhs.X + rhs.X * lhs.W) + rhs.Y * lhs.Z) - rhs.Z * lhs.Y;
+            result.Y = ((rhs.W * lhs.Y - rhs.X * lhs.Z) + rhs.Y * lhs.W) + rhs.Z * lhs.X;
+            result.Z = ((rhs.W * lhs.Z + rhs.X * lhs.Y) - rhs.Y * lhs.X) + rhs.Z * lhs.W;
+            result.W = ((rhs.W * lhs.W - rhs.X * lhs.X) - rhs.Y * lhs.Y) - rhs.Z * lhs.Z;
+#endif
+            return result;
+        }
+
+        /// @brief 구면 선형 보간 (최단 경로)
+        /// @param start 시작 회전 (단위 사원수)
+        /// @param end 끝 회전 (단위 사원수)
+        /// @param t 보간 계수 (0.0 ~ 1.0)
+        /// @return QuaternionF
+        /// @note acos/sin 대신 다항식 근사(Eberly, 최대 오차 약 2e-5)를 사용하므로 분기 없이 일괄 처리할 수 있습니다.
+        static QuaternionF Slerp(const QuaternionF& start, const QuaternionF& end, float t) noexcept {
+            float cosTheta = Dot(start, end);
+            float sign = (cosTheta < 0.0f) ? -1.0f : 1.0f;
+            float startWeight = slerpWeight(1.0f - t, sign * cosTheta - 1.0f);
+            float endWeight = slerpWeight(t, sign * cosTheta - 1.0f) * sign;
+
+            return {
+                start.X * startWeight + end.X * endWeight,
+                start.Y * startWeight + end.Y * endWeight,
+                start.Z * startWeight + end.Z * endWeight,
+                start.W * startWeight + end.W * endWeight
+            };
+        }
+
+        /// @brief 여러 회전을 같은 계수로 구면 선형 보간합니다. (애니메이션 블렌딩 등)
+        /// @param start 시작 회전 배열
+        /// @param end 끝 회전 배열
+        /// @param t 보간 계수 (0.0 ~ 1.0)
+        /// @param dst 결과 배열 (start 또는 end와 같아도 됩니다.)
+        /// @param count 사원수 수
+        /// @note 4개씩 SIMD로 처리하며 결과는 Slerp와 같습니다.
+        static void Slerp(const QuaternionF* start, const QuaternionF* end, float t, QuaternionF* dst, size_t count) noexcept;
+
+        /// @brief 정규화 선형 보간 (최단 경로)
+        /// @param start 시작 회전
+        /// @param end 끝 회전
+        /// @param t 보간 계수 (0.0 ~ 1.0)
+        /// @return QuaternionF
+        /// @note Slerp보다 빠르지만 각속도가 일정하지 않습니다.
+        static QuaternionF Nlerp(const QuaternionF& start, const QuaternionF& end, float t) noexcept {
+            float endWeight = (Dot(start, end) < 0.0f) ? -t : t;
+            float startWeight = 1.0f - t;
+
+            return QuaternionF(
+                start.X * startWeight + end.X * endWeight,
+                start.Y * startWeight + end.Y * endWeight,
+                start.Z * startWeight + end.Z * endWeight,
+                start.W * startWeight + end.W * endWeight
+            ).Normalize();
+        }
+
+        /// @brief 정규화
+        /// @return QuaternionF (길이가 0에 가까우면 Identity)
+        QuaternionF Normalize() const noexcept {
+            float length = Length();
+            if (length <= 1e-6f) {
+                return Identity();
+            }
+
+            float inv = 1.0f / length;
+            return { X * inv, Y * inv, Z * inv, W * inv };
+        }
+
+        /// @brief 길이
+        /// @return 길이
+        float Length() const noexcept {
+            return std::sqrt(Dot(*this, *this));
+        }
+
+        /// @brief 켤레 (단위 사원수의 역회전)
+        /// @return QuaternionF
+        constexpr QuaternionF Conjugate() const noexcept {
+            return { -X, -Y, -Z, W };
+        }
+
+        /// @brief 역원
+        /// @return QuaternionF (길이가 0에 가까우면 Identity)
+        constexpr QuaternionF Inverse() const noexcept {
+            float lengthSquared = Dot(*this, *this);
+            if (lengthSquared <= 1e-12f) {
+                return Identity();
+            }
+
+            return { -X / lengthSquared, -Y / lengthSquared, -Z / lengthSquared, W / lengthSquared };
+        }
+
+        /// @brief 벡터 회전
+        /// @param vec Vector3F
+        /// @return Vector3F
+        constexpr Vector3F Rotate(const Vector3F& vec) const noexcept {
+            // v' = v + W * t + (q x t), t = 2 * (q x v)
+            Vector3F axis(X, Y, Z);
+            Vector3F t = Vector3F::Cross(axis, vec) * 2.0f;
+            return vec + t * W + Vector3F::Cross(axis, t);
+        }
+
+        /// @brief 회전 행렬
+        /// @return Matrix4x4F
+        constexpr Matrix4x4F ToMatrix() const noexcept {
+            float xx = X * X, yy = Y * Y, zz = Z * Z;
+            float xy = X * Y, xz = X * Z, yz = Y * Z;
+            float wx = W * X, wy = W * Y, wz = W * Z;
+
+            return {
+                { 1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy), 0.0f },
+                { 2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx), 0.0f },
+                { 2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy), 0.0f },
+                { 0.0f, 0.0f, 0.0f, 1.0f }
+            };
+        }
+
+        QuaternionF& operator=(const QuaternionF&) noexcept = default;
+        QuaternionF& operator=(QuaternionF&&) noexcept = default;
+
+        /// @brief * 연산자 오버로딩
+        /// @param quat QuaternionF
+        /// @return QuaternionF
+        QuaternionF operator*(const QuaternionF& quat) const noexcept {
+            return Multiply(*this, quat);
+        }
+
+        /// @brief *= 연산자 오버로딩
+        /// @param quat QuaternionF
+        /// @return QuaternionF
+        QuaternionF& operator*=(const QuaternionF& quat) noexcept {
+            *this = Multiply(*this, quat);
+            return *this;
+        }
+
+        /// @brief == 연산자 오버로딩
+        /// @param lhs QuaternionF
+        /// @param rhs QuaternionF
+        /// @return 같다(true), 다르다(false)
+        friend constexpr bool operator==(const QuaternionF& lhs, const QuaternionF& rhs) noexcept {
+            return (lhs.X == rhs.X) && (lhs.Y == rhs.Y) && (lhs.Z == rhs.Z) && (lhs.W == rhs.W);
+        }
+
+        /// @brief != 연산자 오버로딩
+        /// @param lhs QuaternionF
+        /// @param rhs QuaternionF
+        /// @return 다르다(true), 같다(false)
+        friend constexpr bool operator!=(const QuaternionF& lhs, const QuaternionF& rhs) noexcept {
+            return !(lhs == rhs);
+        }
+
+    private:
+        static constexpr float SLERP_MU = 1.85298109240830f;      ///< 마지막 항 보정 계수
+        static constexpr float SLERP_U[8] = {                       ///< 1 / (i * (2i + 1))
+            1.0f / (1.0f * 3.0f), 1.0f / (2.0f * 5.0f), 1.0f / (3.0f * 7.0f), 1.0f / (4.0f * 9.0f),
+            1.0f / (5.0f * 11.0f), 1.0f / (6.0f * 13.0f), 1.0f / (7.0f * 15.0f), SLERP_MU / (8.0f * 17.0f)
+        };
+        static constexpr float SLERP_V[8] = {                       ///< i / (2i + 1)
+            1.0f / 3.0f, 2.0f / 5.0f, 3.0f / 7.0f, 4.0f / 9.0f,
+            5.0f / 11.0f, 6.0f / 13.0f, 7.0f / 15.0f, SLERP_MU * 8.0f / 17.0f
+        };
+
+        /// @brief Slerp 가중치 sin(t * θ) / sin(θ)의 다항식 근사
+        /// @param t 보간 계수
+        /// @param cosMinusOne cos(θ) - 1 (-1 ~ 0)
+        /// @return 가중치
+        /// @note D. Eberly, "A Fast and Accurate Algorithm for Computing SLERP" (n = 8)
+        static constexpr float slerpWeight(float t, float cosMinusOne) noexcept {
+            float tt = t * t;
+            float weight = 1.0f;
+            for (int32_t i = 7; i >= 0; --i) {
+                weight = 1.0f + (SLERP_U[i] * tt - SLERP_V[i]) * cosMinusOne * weight;
+            }
+
+            return t * weight;
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+
+// #define NEOXOPS_DISABLE_SIMD            ///< SIMD 경로를 끄고 스칼라 구현만 사용 (디버깅, 결과 비교용)
+
+// 컴파일 시점에 대상 명령어 집합을 선택합니다.
+// AVX2는 -mavx2 (GCC/Clang) 또는 /arch:AVX2 (MSVC)로 빌드했을 때만 활성화됩니다.
+#if !defined(NEOXOPS_DISABLE_SIMD)
+    #if defined(__AVX2__)
+        #define NEOXOPS_SIMD_AVX2
+    #endif
+
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define NEOXOPS_SIMD_SSE2
+    #endif
+
+    #if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+        #define NEOXOPS_SIMD_NEON
+    #endif
+#endif
+
+#if defined(NEOXOPS_SIMD_SSE2) || defined(NEOXOPS_SIMD_AVX2)
+    #include <immintrin.h>
+#endif
+
+#if defined(NEOXOPS_SIMD_NEON)
+    #include <arm_neon.h>
+#endif
\ No newline at end of file
@@ -1,4 +1,9 @@
 #pragma once
 
 #include <cstdint>
-#include <cstddef>
\ No newline at end of file
+#include <cstddef>
+#include <cstdlib>      // system 이름공간과 ::system() 충돌 방지를 위해 먼저 포함
+
+inline namespace neoxops {
+    using byte_t = std::uint8_t;            ///< 바이트
+}
\ No newline at end of file
@@ -2,30 +2,19 @@
 
 #include <algorithm>
 #include <cmath>
+#include <type_traits>
 #include "Types.hpp"
 
 inline namespace neoxops {
     /// @brief Vector2F
+    /// @note 생성자가 없는 자명한(trivial) 집합체(aggregate)로, 복사와 std::vector 재할당이 memcpy/memmove로 처리됩니다.
+    ///       Vector2F{ x, y } 또는 Vector2F(x, y)로 생성하며 생략한 성분은 0입니다.
+    ///       기본 초기화(Vector2F vec;)는 성분을 채우지 않으므로 0이 필요하면 Vector2F{} 또는 Zero()를 사용합니다.
+    ///       sqrt, sin, cos를 쓰는 멤버(Length, Distance, Normalize, Rotate)는 상수 평가가 보장되지 않으므로 constexpr가 아닙니다.
     struct Vector2F final {
         float X;            ///< X 좌표
         float Y;            ///< Y 좌표
 
-        /// @brief 기본 생성자
-        constexpr Vector2F() noexcept : X(0.0f), Y(0.0f) {}
-
-        /// @brief 생성자
-        /// @param x X 좌표
-        /// @param y Y 좌표
-        constexpr Vector2F(float x, float y) noexcept : X(x), Y(y) {}
-
-        /// @brief 복사 생성자
-        /// @param vec Vector2F
-        constexpr Vector2F(const Vector2F& vec) noexcept = default;
-
-        /// @brief 이동 생성자
-        /// @note 제거
-        Vector2F(Vector2F&&) noexcept = delete;
-        
         /// @brief Zero
         /// @return Vector2F
         static constexpr Vector2F Zero() { return { 0.0f, 0.0f }; }
@@ -56,7 +45,7 @@ inline namespace neoxops {
         /// @return 근사(true), 근사하지 않음(false)
         /// @note 소수점 오차로 인해 존재하는 함수
         static constexpr bool NearlyEquals(const Vector2F& lhs, const Vector2F& rhs) noexcept {
-            return (std::fabs(lhs.X - rhs.X) <= 1e-5) && (std::fabs(lhs.Y - rhs.Y) <= 1e-5);
+            return isNearlyZero(lhs.X - rhs.X, 1e-5f) && isNearlyZero(lhs.Y - rhs.Y, 1e-5f);
         }
 
         /// @brief 내적
@@ -71,11 +60,11 @@ inline namespace neoxops {
         /// @param lhs Vector2F
         /// @param rhs Vector2F
         /// @return 거리(길이)
-        static constexpr float Distance(const Vector2F& lhs, const Vector2F& rhs) noexcept {
+        static float Distance(const Vector2F& lhs, const Vector2F& rhs) noexcept {
             float dx = lhs.X - rhs.X;
             float dy = lhs.Y - rhs.Y;
 
-            return std::sqrtf((dx * dx) + (dy * dy));
+            return std::sqrt((dx * dx) + (dy * dy));
         }
 
         /// @brief 거리(길이) 제곱
@@ -123,15 +112,15 @@ inline namespace neoxops {
 
 		/// @brief 정규화
 		/// @return Vector2F
-		constexpr Vector2F Normalize() const noexcept {
-			float length = std::sqrtf((X*X) + (Y*Y));
+		Vector2F Normalize() const noexcept {
+			float length = std::sqrt((X*X) + (Y*Y));
 			return (length > 1e-6f) ? (*this / length) : Vector2F{ 0.0f, 0.0f };
 		}
 
 		/// @brief 길이
 		/// @return 길이
-		constexpr float Length() const noexcept {
-			return std::sqrtf((X * X) + (Y * Y));
+		float Length() const noexcept {
+			return std::sqrt((X * X) + (Y * Y));
 		}
 
 		/// @brief 길이 제곱
@@ -143,19 +132,13 @@ inline namespace neoxops {
         /// @brief 회전
         /// @param rad 각도 (라디안 단위)
         /// @return Vector2F
-        constexpr Vector2F Rotate(float rad) noexcept {
-            float c = std::cosf(rad);        // X축은 Cos
-            float s = std::sinf(rad);        // Y축은 Sin
+        Vector2F Rotate(float rad) const noexcept {
+            float c = std::cos(rad);        // X축은 Cos
+            float s = std::sin(rad);        // Y축은 Sin
 
             return { X * c - Y * s, X * s + Y * c };
         }
 
-		/// @brief 복사 대입 연산자 오버로딩
-		Vector2F& operator=(const Vector2F&) noexcept = default;
-
-		/// @brief 이동 대입 연산자 제거
-		Vector2F& operator=(Vector2F&&) noexcept = delete;
-
         /// @brief + 단항 연산자 오버로딩
         constexpr Vector2F operator+() const noexcept { return *this; }
 
@@ -188,8 +171,8 @@ inline namespace neoxops {
         /// @return Vector2F
         /// @note 0으로 나누지 않도록 주의
         constexpr Vector2F operator/(const Vector2F& vec) const noexcept {
-            float nx = std::fabs(vec.X) <= 1e-6f ? 0.0f : (X / vec.X);
-            float ny = std::fabs(vec.Y) <= 1e-6f ? 0.0f : (Y / vec.Y);
+            float nx = isNearlyZero(vec.X) ? 0.0f : (X / vec.X);
+            float ny = isNearlyZero(vec.Y) ? 0.0f : (Y / vec.Y);
 
             return { nx, ny };
         }
@@ -219,8 +202,8 @@ inline namespace neoxops {
         /// @param value 값
         /// @return Vector2F
         constexpr Vector2F operator/(float value) const noexcept {
-            float nx = std::fabs(value) <= 1e-6f ? 0.0f : (X / value);
-            float ny = std::fabs(value) <= 1e-6f ? 0.0f : (Y / value);
+            float nx = isNearlyZero(value) ? 0.0f : (X / value);
+            float ny = isNearlyZero(value) ? 0.0f : (Y / value);
 
             return { nx, ny };
         }
@@ -228,7 +211,7 @@ inline namespace neoxops {
         /// @brief += 연산자 오버로딩
         /// @param vec Vector2F
         /// @return Vector2F
-        Vector2F& operator+=(const Vector2F& vec) noexcept {
+        constexpr Vector2F& operator+=(const Vector2F& vec) noexcept {
             X += vec.X;
             Y += vec.Y;
 
@@ -238,7 +221,7 @@ inline namespace neoxops {
         /// @brief -= 연산자 오버로딩
         /// @param vec Vector2F
         /// @return Vector2F
-        Vector2F& operator-=(const Vector2F& vec) noexcept {
+        constexpr Vector2F& operator-=(const Vector2F& vec) noexcept {
             X -= vec.X;
             Y -= vec.Y;
 
@@ -248,7 +231,7 @@ inline namespace neoxops {
         /// @brief *= 연산자 오버로딩
         /// @param vec Vector2F
         /// @return Vector2F
-        Vector2F& operator*=(const Vector2F& vec) noexcept {
+        constexpr Vector2F& operator*=(const Vector2F& vec) noexcept {
             X *= vec.X;
             Y *= vec.Y;
 
@@ -258,9 +241,9 @@ inline namespace neoxops {
         /// @brief /= 연산자 오버로딩
         /// @param vec Vector2F
         /// @return Vector2F
-        Vector2F& operator/=(const Vector2F& vec) noexcept {
-            if (std::fabs(vec.X) > 1e-6f) { X /= vec.X; } else { X = 0.0f; }
-            if (std::fabs(vec.Y) > 1e-6f) { Y /= vec.Y; } else { Y = 0.0f; }
+        constexpr Vector2F& operator/=(const Vector2F& vec) noexcept {
+            if (!isNearlyZero(vec.X)) { X /= vec.X; } else { X = 0.0f; }
+            if (!isNearlyZero(vec.Y)) { Y /= vec.Y; } else { Y = 0.0f; }
 
             return *this;
         }
@@ -268,7 +251,7 @@ inline namespace neoxops {
         /// @brief += 연산자 오버로딩
         /// @param value 값
         /// @return Vector2F
-        Vector2F& operator+=(float value) noexcept {
+        constexpr Vector2F& operator+=(float value) noexcept {
             X += value;
             Y += value;
 
@@ -278,7 +261,7 @@ inline namespace neoxops {
         /// @brief -= 연산자 오버로딩
         /// @param value 값
         /// @return Vector2F
-        Vector2F& operator-=(float value) noexcept {
+        constexpr Vector2F& operator-=(float value) noexcept {
             X -= value;
             Y -= value;
 
@@ -288,7 +271,7 @@ inline namespace neoxops {
         /// @brief *= 연산자 오버로딩
         /// @param value 값
         /// @return Vector2F
-        Vector2F& operator*=(float value) noexcept {
+        constexpr Vector2F& operator*=(float value) noexcept {
             X *= value;
             Y *= value;
 
@@ -298,9 +281,9 @@ inline namespace neoxops {
         /// @brief /= 연산자 오버로딩
         /// @param value 값
         /// @return Vector2F
-        Vector2F& operator/=(float value) noexcept {
-            if (std::fabs(value) > 1e-6f) { X /= value; } else { X = 0.0f; }
-            if (std::fabs(value) > 1e-6f) { Y /= value; } else { Y = 0.0f; }
+        constexpr Vector2F& operator/=(float value) noexcept {
+            if (!isNearlyZero(value)) { X /= value; } else { X = 0.0f; }
+            if (!isNearlyZero(value)) { Y /= value; } else { Y = 0.0f; }
 
             return *this;
         }
@@ -352,5 +335,28 @@ inline namespace neoxops {
         friend constexpr bool operator>=(const Vector2F& lhs, const Vector2F& rhs) noexcept {
             return (lhs > rhs) || (lhs == rhs);
         }
+
+    private:
+        /// @brief 0 근사 여부 (상수 평가 가능한 std::fabs(value) <= epsilon)
+        /// @param value 값
+        /// @param epsilon 허용 오차
+        /// @return 근사(true), 비근사(false)
+        static constexpr bool isNearlyZero(float value, float epsilon = 1e-6f) noexcept {
+            return (value >= -epsilon) && (value <= epsilon);
+        }
     };
+
+    static_assert(std::is_trivial_v<Vector2F> && std::is_aggregate_v<Vector2F>, "Vector2F must stay a trivial aggregate");
+    static_assert(sizeof(Vector2F) == sizeof(float) * 2, "Vector2F must stay tightly packed");
+    static_assert(Vector2F::Dot({ 1.0f, 2.0f }, { 3.0f, 4.0f }) == 11.0f);
+    static_assert(Vector2F::DistanceSquared(Vector2F::Zero(), { 3.0f, 4.0f }) == 25.0f);
+    static_assert(Vector2F::Lerp(Vector2F::Zero(), { 2.0f, 4.0f }, 0.5f) == Vector2F{ 1.0f, 2.0f });
+    static_assert(Vector2F{ 1.0f, 2.0f } / 0.0f == Vector2F::Zero());
+    static_assert([] {
+        Vector2F vec{ 1.0f, 2.0f };
+        vec += Vector2F::One();
+        vec *= 2.0f;
+        vec /= Vector2F{ 4.0f, 0.0f };
+        return vec;
+    }() == Vector2F{ 1.0f, 0.0f });
 }
@@ -2,20 +2,20 @@
 
 #include <algorithm>
 #include <cmath>
+#include <type_traits>
 #include "Types.hpp"
 
 inline namespace neoxops {
     /// @brief Vector3F
+    /// @note 생성자가 없는 자명한(trivial) 집합체(aggregate)로, 복사와 std::vector 재할당이 memcpy/memmove로 처리됩니다.
+    ///       Vector3F{ x, y, z } 또는 Vector3F(x, y, z)로 생성하며 생략한 성분은 0입니다.
+    ///       기본 초기화(Vector3F vec;)는 성분을 채우지 않으므로 0이 필요하면 Vector3F{} 또는 Zero()를 사용합니다.
+    ///       sqrt를 쓰는 멤버(Length, Distance, Normalize)는 상수 평가가 보장되지 않으므로 constexpr가 아닙니다.
     struct Vector3F final {
         float X;            ///< X 좌표
         float Y;            ///< Y 좌표
         float Z;            ///< Z 좌표
 
-        constexpr Vector3F() noexcept : X(0.0f), Y(0.0f), Z(0.0f) {}
-        constexpr Vector3F(float x, float y, float z) noexcept : X(x), Y(y), Z(z) {}
-        constexpr Vector3F(const Vector3F& vec) noexcept = default;
-        Vector3F(Vector3F&&) noexcept = delete;
-        
         /// @brief Zero
         /// @return Vector3F
         static constexpr Vector3F Zero() { return { 0.0f, 0.0f, 0.0f }; }
@@ -53,7 +53,7 @@ inline namespace neoxops {
         /// @param rhs Vector3F
         /// @return 근사(true), 비근사(false)
         static constexpr bool NearlyEquals(const Vector3F& lhs, const Vector3F& rhs) noexcept {
-            return (std::fabs(lhs.X - rhs.X) <= 1e-5f) && (std::fabs(lhs.Y - rhs.Y) <= 1e-5f) && (std::fabs(lhs.Z - rhs.Z) <= 1e-5f);
+            return isNearlyZero(lhs.X - rhs.X, 1e-5f) && isNearlyZero(lhs.Y - rhs.Y, 1e-5f) && isNearlyZero(lhs.Z - rhs.Z, 1e-5f);
         }
 
         /// @brief 내적
@@ -61,7 +61,7 @@ inline namespace neoxops {
         /// @param rhs Vector3F
         /// @return 내적
         static constexpr float Dot(const Vector3F& lhs, const Vector3F& rhs) noexcept {
-            return (lhs.X * lhs.Y) + (lhs.Y * rhs.Y) + (lhs.Z * rhs.Z);
+            return (lhs.X * rhs.X) + (lhs.Y * rhs.Y) + (lhs.Z * rhs.Z);
         }
 
         /// @brief 외적
@@ -80,12 +80,12 @@ inline namespace neoxops {
         /// @param lhs Vector3F
         /// @param rhs Vector3F
         /// @return 거리
-        static constexpr float Distance(const Vector3F& lhs, const Vector3F& rhs) noexcept {
+        static float Distance(const Vector3F& lhs, const Vector3F& rhs) noexcept {
             float dx = lhs.X - rhs.X;
             float dy = lhs.Y - rhs.Y;
             float dz = lhs.Z - rhs.Z;
 
-            return std::sqrtf((dx*dx) + (dy*dy) + (dz*dz));
+            return std::sqrt((dx*dx) + (dy*dy) + (dz*dz));
         }
 
         /// @brief 거리 제곱
@@ -140,15 +140,15 @@ inline namespace neoxops {
 
         /// @brief 정규화
         /// @return Vector3F
-        constexpr Vector3F Normalize() const noexcept {
+        Vector3F Normalize() const noexcept {
             float length = Length();
             return (length > 1e-6f) ? (*this / length) : Vector3F::Zero();
         }
 
         /// @brief 길이
         /// @return 길이
-        constexpr float Length() const noexcept {
-            return std::sqrtf((X*X) + (Y*Y) + (Z*Z));
+        float Length() const noexcept {
+            return std::sqrt((X*X) + (Y*Y) + (Z*Z));
         }
 
         /// @brief 길이 제곱
@@ -157,18 +157,15 @@ inline namespace neoxops {
             return ((X*X) + (Y*Y) + (Z*Z));
         }
 
-        Vector3F& operator=(const Vector3F&) noexcept = default;
-        Vector3F& operator=(Vector3F&&) noexcept = delete;
-
         /// @brief + 단항 연산자 오버로딩
         /// @return Vector3F
-        const Vector3F operator+() const noexcept {
+        constexpr Vector3F operator+() const noexcept {
             return *this;
         }
 
         /// @brief - 단항 연산자 오버로딩
         /// @return Vector3F
-        const Vector3F operator-() const noexcept {
+        constexpr Vector3F operator-() const noexcept {
             return { -X, -Y, -Z };
         }
 
@@ -198,9 +195,9 @@ inline namespace neoxops {
         /// @return Vector3F
         constexpr Vector3F operator/(const Vector3F& vec) const noexcept {
             return {
-                std::fabs(vec.X) <= 1e-6f ? 0.0f : (X / vec.X),
-                std::fabs(vec.Y) <= 1e-6f ? 0.0f : (Y / vec.Y),
-                std::fabs(vec.Z) <= 1e-6f ? 0.0f : (Z / vec.Z)
+                isNearlyZero(vec.X) ? 0.0f : (X / vec.X),
+                isNearlyZero(vec.Y) ? 0.0f : (Y / vec.Y),
+                isNearlyZero(vec.Z) ? 0.0f : (Z / vec.Z)
             };
         }
 
@@ -230,16 +227,16 @@ inline namespace neoxops {
         /// @return Vector3F
         constexpr Vector3F operator/(float value) const noexcept {
             return {
-                std::fabs(value) <= 1e-6f ? 0.0f : (X / value),
-                std::fabs(value) <= 1e-6f ? 0.0f : (Y / value),
-                std::fabs(value) <= 1e-6f ? 0.0f : (Z / value)
+                isNearlyZero(value) ? 0.0f : (X / value),
+                isNearlyZero(value) ? 0.0f : (Y / value),
+                isNearlyZero(value) ? 0.0f : (Z / value)
             };
         }
 
         /// @brief += 연산자 오버로딩
         /// @param vec Vector3F
         /// @return Vector3F
-        Vector3F& operator+=(const Vector3F& vec) noexcept {
+        constexpr Vector3F& operator+=(const Vector3F& vec) noexcept {
             X += vec.X;
             Y += vec.Y;
             Z += vec.Z;
@@ -250,7 +247,7 @@ inline namespace neoxops {
         /// @brief -= 연산자 오버로딩
         /// @param vec Vector3F
         /// @return Vector3F
-        Vector3F& operator-=(const Vector3F& vec) noexcept {
+        constexpr Vector3F& operator-=(const Vector3F& vec) noexcept {
             X -= vec.X;
             Y -= vec.Y;
             Z -= vec.Z;
@@ -261,7 +258,7 @@ inline namespace neoxops {
         /// @brief *= 연산자 오버로딩
         /// @param vec Vector3F
         /// @return Vector3F
-        Vector3F& operator*=(const Vector3F& vec) noexcept {
+        constexpr Vector3F& operator*=(const Vector3F& vec) noexcept {
             X *= vec.X;
             Y *= vec.Y;
             Z *= vec.Z;
@@ -272,10 +269,10 @@ inline namespace neoxops {
         /// @brief /= 연산자 오버로딩
         /// @param vec Vector3F
         /// @return Vector3F
-        Vector3F& operator/=(const Vector3F& vec) noexcept {
-            X = (std::fabs(vec.X) < 1e-6f) ? 0.0f : X / vec.X;
-            Y = (std::fabs(vec.Y) < 1e-6f) ? 0.0f : Y / vec.Y;
-            Z = (std::fabs(vec.Z) < 1e-6f) ? 0.0f : Z / vec.Z;
+        constexpr Vector3F& operator/=(const Vector3F& vec) noexcept {
+            X = isNearlyZero(vec.X) ? 0.0f : X / vec.X;
+            Y = isNearlyZero(vec.Y) ? 0.0f : Y / vec.Y;
+            Z = isNearlyZero(vec.Z) ? 0.0f : Z / vec.Z;
 
             return *this;
         }
@@ -283,7 +280,7 @@ inline namespace neoxops {
         /// @brief += 연산자 오버로딩
         /// @param value 값
         /// @return Vector3F
-        Vector3F& operator+=(float value) noexcept {
+        constexpr Vector3F& operator+=(float value) noexcept {
             X += value;
             Y += value;
             Z += value;
@@ -294,7 +291,7 @@ inline namespace neoxops {
         /// @brief -= 연산자 오버로딩
         /// @param value 값
         /// @return Vector3F
-        Vector3F& operator-=(float value) noexcept {
+        constexpr Vector3F& operator-=(float value) noexcept {
             X -= value;
             Y -= value;
             Z -= value;
@@ -305,7 +302,7 @@ inline namespace neoxops {
         /// @brief *= 연산자 오버로딩
         /// @param value 값
         /// @return Vector3F
-        Vector3F& operator*=(float value) noexcept {
+        constexpr Vector3F& operator*=(float value) noexcept {
             X *= value;
             Y *= value;
             Z *= value;
@@ -316,10 +313,10 @@ inline namespace neoxops {
         /// @brief /= 연산자 오버로딩
         /// @param value 값
         /// @return Vector3F
-        Vector3F& operator/=(float value) noexcept {
-            X = (std::fabs(value) < 1e-6f) ? 0.0f : X / value;
-            Y = (std::fabs(value) < 1e-6f) ? 0.0f : Y / value;
-            Z = (std::fabs(value) < 1e-6f) ? 0.0f : Z / value;
+        constexpr Vector3F& operator/=(float value) noexcept {
+            X = isNearlyZero(value) ? 0.0f : X / value;
+            Y = isNearlyZero(value) ? 0.0f : Y / value;
+            Z = isNearlyZero(value) ? 0.0f : Z / value;
 
             return *this;
         }
@@ -372,5 +369,28 @@ inline namespace neoxops {
         friend constexpr bool operator>=(const Vector3F &lhs, const Vector3F &rhs) noexcept { 
             return (lhs > rhs) || (lhs == rhs); 
         }
+
+    private:
+        /// @brief 0 근사 여부 (상수 평가 가능한 std::fabs(value) <= epsilon)
+        /// @param value 값
+        /// @param epsilon 허용 오차
+        /// @return 근사(true), 비근사(false)
+        static constexpr bool isNearlyZero(float value, float epsilon = 1e-6f) noexcept {
+            return (value >= -epsilon) && (value <= epsilon);
+        }
     };
+
+    static_assert(std::is_trivial_v<Vector3F> && std::is_aggregate_v<Vector3F>, "Vector3F must stay a trivial aggregate");
+    static_assert(sizeof(Vector3F) == sizeof(float) * 3, "Vector3F must stay tightly packed");
+    static_assert(Vector3F::Dot({ 1.0f, 2.0f, 3.0f }, { 4.0f, 5.0f, 6.0f }) == 32.0f);
+    static_assert(Vector3F::Cross(Vector3F::Right(), Vector3F::Up()) == Vector3F::Forward());
+    static_assert(Vector3F::Lerp(Vector3F::Zero(), { 2.0f, 4.0f, 6.0f }, 0.5f) == Vector3F{ 1.0f, 2.0f, 3.0f });
+    static_assert(Vector3F{ 1.0f, 2.0f, 3.0f } / 0.0f == Vector3F::Zero());
+    static_assert([] {
+        Vector3F vec{ 1.0f, 2.0f, 3.0f };
+        vec += Vector3F::One();
+        vec *= 2.0f;
+        vec /= Vector3F{ 4.0f, 0.0f, 2.0f };
+        return vec;
+    }() == Vector3F{ 1.0f, 0.0f, 4.0f });
 }
\ No newline at end of file
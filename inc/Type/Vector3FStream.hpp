@@ -0,0 +1,116 @@
+#pragma once
+
+#include <vector>
+#include "Types.hpp"
+#include "Vector3F.hpp"
+
+inline namespace neoxops {
+    // 전방 선언
+    struct Matrix4x4F;
+
+    /// @brief Vector3F 배열의 SoA(Structure of Arrays) 컨테이너
+    /// @note X, Y, Z 성분을 각각 연속된 배열로 보관하여 일괄 연산 커널이 한 번에 여러 요소(SIMD 레인)를 처리할 수 있게 합니다.
+    ///       탄환, 파티클, AI처럼 수천 개의 요소를 매 프레임 같은 연산으로 처리할 때 사용합니다.
+    ///       커널은 빌드 대상에 따라 AVX2(8), SSE2/NEON(4), 스칼라(1) 중 하나가 선택되며 나머지 요소는 스칼라로 처리됩니다.
+    class Vector3FStream final {
+    private:
+        std::vector<float> m_X;             ///< X 성분
+        std::vector<float> m_Y;             ///< Y 성분
+        std::vector<float> m_Z;             ///< Z 성분
+
+    public:
+        Vector3FStream() noexcept = default;
+        Vector3FStream(const Vector3FStream&) = default;
+        Vector3FStream(Vector3FStream&&) noexcept = default;
+        ~Vector3FStream() noexcept = default;
+
+        /// @brief 용량을 예약합니다.
+        /// @param capacity 요소 수
+        void Reserve(size_t capacity) noexcept {
+            m_X.reserve(capacity);
+            m_Y.reserve(capacity);
+            m_Z.reserve(capacity);
+        }
+
+        /// @brief 크기를 변경합니다.
+        /// @param size 요소 수 (늘어난 요소는 Zero)
+        void Resize(size_t size) noexcept {
+            m_X.resize(size, 0.0f);
+            m_Y.resize(size, 0.0f);
+            m_Z.resize(size, 0.0f);
+        }
+
+        /// @brief 모든 요소를 제거합니다.
+        void Clear() noexcept {
+            m_X.clear();
+            m_Y.clear();
+            m_Z.clear();
+        }
+
+        /// @brief 요소를 추가합니다.
+        /// @param vec Vector3F
+        void PushBack(const Vector3F& vec) noexcept {
+            m_X.push_back(vec.X);
+            m_Y.push_back(vec.Y);
+            m_Z.push_back(vec.Z);
+        }
+
+        /// @brief 요소를 제거하고 마지막 요소로 빈자리를 채웁니다.
+        /// @param index 인덱스
+        /// @note 순서가 바뀌지만 O(1)입니다.
+        void SwapRemove(size_t index) noexcept {
+            m_X[index] = m_X.back();
+            m_Y[index] = m_Y.back();
+            m_Z[index] = m_Z.back();
+
+            m_X.pop_back();
+            m_Y.pop_back();
+            m_Z.pop_back();
+        }
+
+        /// @brief 요소를 취득합니다.
+        /// @param index 인덱스
+        /// @return Vector3F
+        [[nodiscard]] Vector3F Get(size_t index) const noexcept {
+            return { m_X[index], m_Y[index], m_Z[index] };
+        }
+
+        /// @brief 요소를 설정합니다.
+        /// @param index 인덱스
+        /// @param vec Vector3F
+        void Set(size_t index, const Vector3F& vec) noexcept {
+            m_X[index] = vec.X;
+            m_Y[index] = vec.Y;
+            m_Z[index] = vec.Z;
+        }
+
+        /// @brief 요소 수를 취득합니다.
+        /// @return 요소 수
+        [[nodiscard]] size_t GetSize() const noexcept { return m_X.size(); }
+
+        /// @brief 비어있는지 확인합니다.
+        /// @return 비어있음(true), 요소 있음(false)
+        [[nodiscard]] bool IsEmpty() const noexcept { return m_X.empty(); }
+
+        [[nodiscard]] float* GetX() noexcept { return m_X.data(); }
+        [[nodiscard]] float* GetY() noexcept { return m_Y.data(); }
+        [[nodiscard]] float* GetZ() noexcept { return m_Z.data(); }
+        [[nodiscard]] const float* GetX() const noexcept { return m_X.data(); }
+        [[nodiscard]] const float* GetY() const noexcept { return m_Y.data(); }
+        [[nodiscard]] const float* GetZ() const noexcept { return m_Z.data(); }
+
+        static void Transform(const Vector3FStream&, const float*, Vector3FStream&) noexcept;
+        static void TransformNormal(const Vector3FStream&, const float*, Vector3FStream&) noexcept;
+        static void Transform(const Vector3FStream&, const Matrix4x4F&, Vector3FStream&) noexcept;
+        static void TransformNormal(const Vector3FStream&, const Matrix4x4F&, Vector3FStream&) noexcept;
+        static void Normalize(const Vector3FStream&, Vector3FStream&) noexcept;
+        static void Dot(const Vector3FStream&, const Vector3FStream&, float*) noexcept;
+        static void Dot(const Vector3FStream&, const Vector3F&, float*) noexcept;
+        static void DistanceSquared(const Vector3FStream&, const Vector3F&, float*) noexcept;
+        static void AddScaled(Vector3FStream&, const Vector3FStream&, float) noexcept;
+        static size_t ContainedInAABB(const Vector3FStream&, const Vector3F&, const Vector3F&, byte_t*) noexcept;
+
+        Vector3FStream& operator=(const Vector3FStream&) = default;
+        Vector3FStream& operator=(Vector3FStream&&) noexcept = default;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include "Types.hpp"
+#include "Vector3F.hpp"
+
+inline namespace neoxops {
+    /// @brief Vector4F
+    /// @note 16바이트 정렬되어 SSE/NEON 레지스터로 한 번에 읽고 쓸 수 있습니다. (Matrix4x4F의 행, 동차 좌표)
+    struct alignas(16) Vector4F final {
+        float X;            ///< X 좌표
+        float Y;            ///< Y 좌표
+        float Z;            ///< Z 좌표
+        float W;            ///< W 좌표
+
+        constexpr Vector4F() noexcept : X(0.0f), Y(0.0f), Z(0.0f), W(0.0f) {}
+        constexpr Vector4F(float x, float y, float z, float w) noexcept : X(x), Y(y), Z(z), W(w) {}
+        constexpr Vector4F(const Vector3F& vec, float w) noexcept : X(vec.X), Y(vec.Y), Z(vec.Z), W(w) {}
+        constexpr Vector4F(const Vector4F&) noexcept = default;
+        constexpr Vector4F(Vector4F&&) noexcept = default;
+
+        /// @brief Zero
+        /// @return Vector4F
+        static constexpr Vector4F Zero() { return { 0.0f, 0.0f, 0.0f, 0.0f }; }
+
+        /// @brief One
+        /// @return Vector4F
+        static constexpr Vector4F One() { return { 1.0f, 1.0f, 1.0f, 1.0f }; }
+
+        /// @brief 근사 비교
+        /// @param lhs Vector4F
+        /// @param rhs Vector4F
+        /// @return 근사(true), 비근사(false)
+        static bool NearlyEquals(const Vector4F& lhs, const Vector4F& rhs) noexcept {
+            return (std::fabs(lhs.X - rhs.X) <= 1e-5f) && (std::fabs(lhs.Y - rhs.Y) <= 1e-5f)
+                && (std::fabs(lhs.Z - rhs.Z) <= 1e-5f) && (std::fabs(lhs.W - rhs.W) <= 1e-5f);
+        }
+
+        /// @brief 내적
+        /// @param lhs Vector4F
+        /// @param rhs Vector4F
+        /// @return 내적
+        static constexpr float Dot(const Vector4F& lhs, const Vector4F& rhs) noexcept {
+            return (lhs.X * rhs.X) + (lhs.Y * rhs.Y) + (lhs.Z * rhs.Z) + (lhs.W * rhs.W);
+        }
+
+        /// @brief 선형 보간
+        /// @param start Vector4F
+        /// @param end Vector4F
+        /// @param t 보간 계수 (0.0 ~ 1.0)
+        /// @return Vector4F
+        static constexpr Vector4F Lerp(const Vector4F& start, const Vector4F& end, float t) noexcept {
+            t = std::clamp(t, 0.0f, 1.0f);
+            return {
+                start.X + (end.X - start.X) * t,
+                start.Y + (end.Y - start.Y) * t,
+                start.Z + (end.Z - start.Z) * t,
+                start.W + (end.W - start.W) * t
+            };
+        }
+
+        /// @brief 최솟값
+        /// @param lhs Vector4F
+        /// @param rhs Vector4F
+        /// @return Vector4F
+        static constexpr Vector4F Min(const Vector4F& lhs, const Vector4F& rhs) noexcept {
+            return {
+                lhs.X < rhs.X ? lhs.X : rhs.X,
+                lhs.Y < rhs.Y ? lhs.Y : rhs.Y,
+                lhs.Z < rhs.Z ? lhs.Z : rhs.Z,
+                lhs.W < rhs.W ? lhs.W : rhs.W
+            };
+        }
+
+        /// @brief 최댓값
+        /// @param lhs Vector4F
+        /// @param rhs Vector4F
+        /// @return Vector4F
+        static constexpr Vector4F Max(const Vector4F& lhs, const Vector4F& rhs) noexcept {
+            return {
+                lhs.X > rhs.X ? lhs.X : rhs.X,
+                lhs.Y > rhs.Y ? lhs.Y : rhs.Y,
+                lhs.Z > rhs.Z ? lhs.Z : rhs.Z,
+                lhs.W > rhs.W ? lhs.W : rhs.W
+            };
+        }
+
+        /// @brief 정규화
+        /// @return Vector4F
+        Vector4F Normalize() const noexcept {
+            float length = Length();
+            return (length > 1e-6f) ? (*this / length) : Vector4F::Zero();
+        }
+
+        /// @brief 길이
+        /// @return 길이
+        float Length() const noexcept {
+            return std::sqrt((X*X) + (Y*Y) + (Z*Z) + (W*W));
+        }
+
+        /// @brief 길이 제곱
+        /// @return 길이 제곱
+        constexpr float LengthSquared() const noexcept {
+            return ((X*X) + (Y*Y) + (Z*Z) + (W*W));
+        }
+
+        /// @brief XYZ 성분
+        /// @return Vector3F
+        constexpr Vector3F ToVector3F() const noexcept {
+            return { X, Y, Z };
+        }
+
+        /// @brief W로 나눈 XYZ 성분 (원근 나눗셈)
+        /// @return Vector3F (W가 0에 가까우면 XYZ 그대로)
+        Vector3F Project() const noexcept {
+            return (std::fabs(W) > 1e-6f) ? Vector3F(X / W, Y / W, Z / W) : Vector3F(X, Y, Z);
+        }
+
+        Vector4F& operator=(const Vector4F&) noexcept = default;
+        Vector4F& operator=(Vector4F&&) noexcept = default;
+
+        /// @brief + 단항 연산자 오버로딩
+        /// @return Vector4F
+        constexpr Vector4F operator+() const noexcept {
+            return *this;
+        }
+
+        /// @brief - 단항 연산자 오버로딩
+        /// @return Vector4F
+        constexpr Vector4F operator-() const noexcept {
+            return { -X, -Y, -Z, -W };
+        }
+
+        /// @brief + 연산자 오버로딩
+        /// @param vec Vector4F
+        /// @return Vector4F
+        constexpr Vector4F operator+(const Vector4F& vec) const noexcept {
+            return { X + vec.X, Y + vec.Y, Z + vec.Z, W + vec.W };
+        }
+
+        /// @brief - 연산자 오버로딩
+        /// @param vec Vector4F
+        /// @return Vector4F
+        constexpr Vector4F operator-(const Vector4F& vec) const noexcept {
+            return { X - vec.X, Y - vec.Y, Z - vec.Z, W - vec.W };
+        }
+
+        /// @brief * 연산자 오버로딩
+        /// @param vec Vector4F
+        /// @return Vector4F
+        constexpr Vector4F operator*(const Vector4F& vec) const noexcept {
+            return { X * vec.X, Y * vec.Y, Z * vec.Z, W * vec.W };
+        }
+
+        /// @brief * 연산자 오버로딩
+        /// @param value 값
+        /// @return Vector4F
+        constexpr Vector4F operator*(float value) const noexcept {
+            return { X * value, Y * value, Z * value, W * value };
+        }
+
+        /// @brief / 연산자 오버로딩
+        /// @param value 값
+        /// @return Vector4F
+        constexpr Vector4F operator/(float value) const noexcept {
+            if ((value >= -1e-6f) && (value <= 1e-6f)) {
+                return Vector4F::Zero();
+            }
+
+            return { X / value, Y / value, Z / value, W / value };
+        }
+
+        /// @brief += 연산자 오버로딩
+        /// @param vec Vector4F
+        /// @return Vector4F
+        constexpr Vector4F& operator+=(const Vector4F& vec) noexcept {
+            X += vec.X;
+            Y += vec.Y;
+            Z += vec.Z;
+            W += vec.W;
+
+            return *this;
+        }
+
+        /// @brief -= 연산자 오버로딩
+        /// @param vec Vector4F
+        /// @return Vector4F
+        constexpr Vector4F& operator-=(const Vector4F& vec) noexcept {
+            X -= vec.X;
+            Y -= vec.Y;
+            Z -= vec.Z;
+            W -= vec.W;
+
+            return *this;
+        }
+
+        /// @brief *= 연산자 오버로딩
+        /// @param value 값
+        /// @return Vector4F
+        constexpr Vector4F& operator*=(float value) noexcept {
+            X *= value;
+            Y *= value;
+            Z *= value;
+            W *= value;
+
+            return *this;
+        }
+
+        /// @brief == 연산자 오버로딩
+        /// @param lhs Vector4F
+        /// @param rhs Vector4F
+        /// @return 같다(true), 다르다(false)
+        friend constexpr bool operator==(const Vector4F& lhs, const Vector4F& rhs) noexcept {
+            return (lhs.X == rhs.X) && (lhs.Y == rhs.Y) && (lhs.Z == rhs.Z) && (lhs.W == rhs.W);
+        }
+
+        /// @brief != 연산자 오버로딩
+        /// @param lhs Vector4F
+        /// @param rhs Vector4F
+        /// @return 다르다(true), 같다(false)
+        friend constexpr bool operator!=(const Vector4F& lhs, const Vector4F& rhs) noexcept {
+            return !(lhs == rhs);
+        }
+    };
+}
\ No newline at end of file
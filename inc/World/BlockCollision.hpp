@@ -0,0 +1,103 @@
+#pragma once
+
+#include <vector>
+#include "BlockData.hpp"
+#include "../Type/Vector3FStream.hpp"
+
+inline namespace neoxops {
+    namespace world {
+        /// @brief 광선 충돌 결과
+        struct RayHit final {
+            float Distance;                     ///< 광선 시작점으로부터의 거리 (맞지 않았으면 최대 거리)
+            Vector3F Position;                  ///< 충돌 위치
+            Vector3F Normal;                    ///< 충돌한 면의 법선 (광선 쪽을 향함)
+            uint32_t Block;                     ///< 블록 인덱스 (맞지 않았으면 BlockCollision::NO_BLOCK)
+            uint32_t Face;                      ///< 면 인덱스 (0 ~ 5)
+        };
+
+        /// @brief 겹침 검사 접촉 정보
+        struct CollisionContact final {
+            Vector3F Position;                  ///< 면 위에서 도형과 가장 가까운 점
+            Vector3F Normal;                    ///< 면에서 도형 쪽을 향하는 밀어낼 방향 (단위 벡터)
+            float Depth;                        ///< 겹친 깊이 (Normal 방향으로 이만큼 밀어내면 떨어짐)
+            uint32_t Block;                     ///< 블록 인덱스
+            uint32_t Face;                      ///< 면 인덱스 (0 ~ 5)
+        };
+
+        /// @brief 블록 맵 충돌 검사
+        /// @note 블록 면을 삼각형으로 나누어 SAH(표면적 휴리스틱)로 나눈 4갈래 BVH를 구성합니다.
+        ///       노드는 자식 4개의 경계 상자를, 리프는 삼각형 최대 4개를 성분별로 모아 두므로 SIMD 한 번으로 자식 4개 또는 삼각형 4개를 검사합니다.
+        ///       구성한 뒤에는 읽기만 하므로 검사 함수는 여러 스레드에서 동시에 호출할 수 있습니다. (예: JobSystem::ParallelFor로 일괄 검사를 나눔)
+        class BlockCollision final {
+        public:
+            static constexpr uint32_t NO_BLOCK      = UINT32_MAX;       ///< 맞지 않음
+            static constexpr uint32_t NO_CHILD      = UINT32_MAX;       ///< 비어 있는 자식
+            static constexpr uint32_t LEAF_FLAG     = 0x80000000U;      ///< 자식이 리프(삼각형 묶음)임을 나타내는 비트
+            static constexpr uint32_t MAX_DEPTH     = 48U;              ///< 최대 트리 깊이 (절반을 넘으면 SAH 대신 개수로 반씩 나눔)
+            static constexpr uint32_t STACK_SIZE    = MAX_DEPTH * 3U + 4U;      ///< 순회 스택 크기
+
+            /// @brief 4갈래 BVH 노드 (자식 경계 상자를 성분별로 보관)
+            struct Node final {
+                alignas(16) float MinX[4];      ///< 자식 경계 상자 최소 X
+                alignas(16) float MinY[4];      ///< 자식 경계 상자 최소 Y
+                alignas(16) float MinZ[4];      ///< 자식 경계 상자 최소 Z
+                alignas(16) float MaxX[4];      ///< 자식 경계 상자 최대 X
+                alignas(16) float MaxY[4];      ///< 자식 경계 상자 최대 Y
+                alignas(16) float MaxZ[4];      ///< 자식 경계 상자 최대 Z
+                uint32_t Child[4];              ///< 자식 (노드 인덱스, LEAF_FLAG | 묶음 인덱스, NO_CHILD)
+                uint32_t ChildCount;            ///< 자식 수 (앞에서부터 채움)
+            };
+
+            /// @brief 리프 삼각형 묶음 (꼭짓점 하나와 두 변을 성분별로 보관)
+            struct TriangleGroup final {
+                alignas(16) float V0X[4];       ///< 꼭짓점 0 X
+                alignas(16) float V0Y[4];       ///< 꼭짓점 0 Y
+                alignas(16) float V0Z[4];       ///< 꼭짓점 0 Z
+                alignas(16) float E1X[4];       ///< 변 (꼭짓점 1 - 꼭짓점 0) X
+                alignas(16) float E1Y[4];       ///< 변 (꼭짓점 1 - 꼭짓점 0) Y
+                alignas(16) float E1Z[4];       ///< 변 (꼭짓점 1 - 꼭짓점 0) Z
+                alignas(16) float E2X[4];       ///< 변 (꼭짓점 2 - 꼭짓점 0) X
+                alignas(16) float E2Y[4];       ///< 변 (꼭짓점 2 - 꼭짓점 0) Y
+                alignas(16) float E2Z[4];       ///< 변 (꼭짓점 2 - 꼭짓점 0) Z
+                uint16_t Block[4];              ///< 블록 인덱스
+                uint8_t Face[4];                ///< 면 인덱스
+                uint32_t Count;                 ///< 유효한 삼각형 수 (나머지는 넓이 0)
+            };
+
+        private:
+            std::vector<Node> m_Nodes;                  ///< 노드 (0: 루트)
+            std::vector<TriangleGroup> m_Groups;        ///< 리프 삼각형 묶음
+            uint32_t m_TriangleCount;                   ///< 삼각형 수
+
+            [[nodiscard]] bool rayCast(const Vector3F&, const Vector3F&, float, bool, RayHit&) const noexcept;
+            [[nodiscard]] uint32_t overlap(const Vector3F&, const Vector3F&, float, CollisionContact*, uint32_t) const noexcept;
+
+        public:
+            BlockCollision() noexcept;
+            BlockCollision(const BlockCollision&) noexcept = delete;
+            BlockCollision(BlockCollision&&) noexcept = default;
+            ~BlockCollision() noexcept = default;
+
+            void Build(const BlockData&) noexcept;
+            void Clear() noexcept;
+
+            [[nodiscard]] bool RayCast(const Vector3F&, const Vector3F&, float, RayHit&) const noexcept;
+            [[nodiscard]] bool RayTest(const Vector3F&, const Vector3F&, float) const noexcept;
+            [[nodiscard]] uint32_t RayCastBatch(const Vector3FStream&, const Vector3FStream&, const float*, size_t, size_t, RayHit*) const noexcept;
+            [[nodiscard]] uint32_t RayTestBatch(const Vector3FStream&, const Vector3FStream&, const float*, size_t, size_t, byte_t*) const noexcept;
+
+            [[nodiscard]] uint32_t OverlapSphere(const Vector3F&, float, CollisionContact*, uint32_t) const noexcept;
+            [[nodiscard]] uint32_t OverlapCapsule(const Vector3F&, const Vector3F&, float, CollisionContact*, uint32_t) const noexcept;
+
+            /// @brief 삼각형 수를 취득합니다.
+            /// @return 삼각형 수 (넓이 0인 면은 제외)
+            [[nodiscard]] uint32_t GetTriangleCount() const noexcept { return m_TriangleCount; }
+
+            [[nodiscard]] const std::vector<Node>& GetNodes() const noexcept { return m_Nodes; }
+            [[nodiscard]] const std::vector<TriangleGroup>& GetGroups() const noexcept { return m_Groups; }
+
+            BlockCollision& operator=(const BlockCollision&) noexcept = delete;
+            BlockCollision& operator=(BlockCollision&&) noexcept = default;
+        };
+    }
+}
\ No newline at end of file
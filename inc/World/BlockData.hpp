@@ -0,0 +1,100 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "../Type/Types.hpp"
+#include "../Type/Vector3F.hpp"
+
+inline namespace neoxops {
+    namespace world {
+        /// @brief BD1 블록 맵 데이터
+        /// @note OpenXOPS의 BD1 형식(텍스처 이름 10개, 블록 최대 160개, 블록마다 꼭짓점 8개와 면 6개)을 읽고 씁니다.
+        ///       모든 값은 블록 순서대로 성분별 연속 배열(SoA)에 고정 크기로 보관하므로 불러올 때 힙 할당이 없으며,
+        ///       블록 하나의 꼭짓점 8개가 X, Y, Z 배열에서 각각 연속(32바이트)하므로 충돌 검사와 정점 버퍼 구성에서 그대로 SIMD로 읽을 수 있습니다.
+        ///       파일 형식은 리틀 엔디언입니다.
+        class BlockData final {
+        public:
+            static constexpr uint32_t MAX_BLOCKS            = 160U;     ///< 최대 블록 수
+            static constexpr uint32_t TEXTURE_COUNT         = 10U;      ///< 텍스처 이름 수
+            static constexpr uint32_t TEXTURE_NAME_LENGTH   = 31U;      ///< 텍스처 이름 길이 (파일 내 고정 길이, 널 문자 포함)
+            static constexpr uint32_t VERTEX_COUNT          = 8U;       ///< 블록당 꼭짓점 수
+            static constexpr uint32_t FACE_COUNT            = 6U;       ///< 블록당 면 수
+            static constexpr uint32_t FACE_VERTEX_COUNT     = 4U;       ///< 면당 꼭짓점 수
+            static constexpr uint32_t UV_COUNT              = FACE_COUNT * FACE_VERTEX_COUNT;     ///< 블록당 UV 수
+
+            static constexpr size_t HEADER_SIZE             = TEXTURE_COUNT * TEXTURE_NAME_LENGTH + 2U;        ///< 파일 헤더 크기 (텍스처 이름 + 블록 수)
+            static constexpr size_t BLOCK_SIZE              = (VERTEX_COUNT * 3U + UV_COUNT * 2U + FACE_COUNT + 1U) * sizeof(float);   ///< 파일 내 블록 하나의 크기
+
+            /// @brief 면을 이루는 꼭짓점 인덱스 (OpenXOPS와 같은 순서, 0 ~ 3: 윗면 둘레, 4 ~ 7: 아랫면 둘레)
+            /// @note 면 f의 k번째 꼭짓점 UV는 GetU()[block * UV_COUNT + f * FACE_VERTEX_COUNT + k]입니다.
+            static constexpr uint8_t FACE_VERTEX_INDEX[FACE_COUNT][FACE_VERTEX_COUNT] = {
+                { 1U, 0U, 3U, 2U },
+                { 5U, 6U, 7U, 4U },
+                { 1U, 5U, 4U, 0U },
+                { 2U, 6U, 5U, 1U },
+                { 3U, 7U, 6U, 2U },
+                { 0U, 4U, 7U, 3U }
+            };
+
+        private:
+            alignas(32) float m_X[MAX_BLOCKS * VERTEX_COUNT];           ///< 꼭짓점 X (블록마다 8개씩 연속)
+            alignas(32) float m_Y[MAX_BLOCKS * VERTEX_COUNT];           ///< 꼭짓점 Y
+            alignas(32) float m_Z[MAX_BLOCKS * VERTEX_COUNT];           ///< 꼭짓점 Z
+            alignas(32) float m_U[MAX_BLOCKS * UV_COUNT];               ///< 면 꼭짓점 U (블록마다 24개씩 연속)
+            alignas(32) float m_V[MAX_BLOCKS * UV_COUNT];               ///< 면 꼭짓점 V
+            int32_t m_TextureIndex[MAX_BLOCKS * FACE_COUNT];            ///< 면 텍스처 인덱스 (블록마다 6개씩 연속)
+            float m_Flags[MAX_BLOCKS];                                  ///< 블록 플래그 (사용하지 않지만 저장할 때 그대로 기록)
+            char m_TextureNames[TEXTURE_COUNT][TEXTURE_NAME_LENGTH + 1U];   ///< 텍스처 이름 (파일의 31바이트를 그대로 보관 + 널 문자)
+            uint32_t m_BlockCount;                                      ///< 블록 수
+
+        public:
+            BlockData() noexcept;
+            BlockData(const BlockData&) noexcept = default;
+            BlockData(BlockData&&) noexcept = default;
+            ~BlockData() noexcept = default;
+
+            [[nodiscard]] bool Load(const std::string&) noexcept;
+            [[nodiscard]] bool Parse(const void*, size_t) noexcept;
+            [[nodiscard]] bool Save(const std::string&) const noexcept;
+            void Serialize(std::vector<byte_t>&) const noexcept;
+            void Clear() noexcept;
+
+            void GetBounds(uint32_t, Vector3F&, Vector3F&) const noexcept;
+            void GetBounds(Vector3F&, Vector3F&) const noexcept;
+
+            /// @brief 블록 수를 취득합니다.
+            /// @return 블록 수
+            [[nodiscard]] uint32_t GetBlockCount() const noexcept { return m_BlockCount; }
+
+            /// @brief 블록의 꼭짓점을 취득합니다.
+            /// @param block 블록 인덱스
+            /// @param vertex 꼭짓점 인덱스 (0 ~ 7)
+            /// @return 꼭짓점
+            [[nodiscard]] Vector3F GetVertex(uint32_t block, uint32_t vertex) const noexcept {
+                const uint32_t i = block * VERTEX_COUNT + vertex;
+                return { m_X[i], m_Y[i], m_Z[i] };
+            }
+
+            /// @brief 면의 텍스처 인덱스를 취득합니다.
+            /// @param block 블록 인덱스
+            /// @param face 면 인덱스 (0 ~ 5)
+            /// @return 텍스처 인덱스 (0 ~ 9 이외의 값은 텍스처 없음)
+            [[nodiscard]] int32_t GetTextureIndex(uint32_t block, uint32_t face) const noexcept { return m_TextureIndex[block * FACE_COUNT + face]; }
+
+            /// @brief 텍스처 이름을 취득합니다.
+            /// @param index 텍스처 인덱스 (0 ~ 9)
+            /// @return 텍스처 이름 (비어있으면 "")
+            [[nodiscard]] const char* GetTextureName(uint32_t index) const noexcept { return m_TextureNames[index]; }
+
+            [[nodiscard]] const float* GetX() const noexcept { return m_X; }
+            [[nodiscard]] const float* GetY() const noexcept { return m_Y; }
+            [[nodiscard]] const float* GetZ() const noexcept { return m_Z; }
+            [[nodiscard]] const float* GetU() const noexcept { return m_U; }
+            [[nodiscard]] const float* GetV() const noexcept { return m_V; }
+            [[nodiscard]] const int32_t* GetTextureIndices() const noexcept { return m_TextureIndex; }
+
+            BlockData& operator=(const BlockData&) noexcept = default;
+            BlockData& operator=(BlockData&&) noexcept = default;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <vector>
+#include "../Type/Types.hpp"
+#include "../Type/Vector3F.hpp"
+
+inline namespace neoxops {
+    namespace world {
+        /// @brief 동적 개체 근접 검색용 균일 공간 해시 격자
+        /// @note 공간을 한 변이 셀 크기인 정육면체 칸으로 나누고, 칸 좌표의 해시로 버킷을 정해 개체를 보관합니다.
+        ///       버킷은 위치와 값을 연속 배열로 들고 있으므로 검색은 주변 칸의 버킷을 순서대로 읽기만 합니다.
+        ///       개체는 점으로 취급하므로, 크기가 있는 개체는 검색 반경을 최대 개체 반경만큼 키워서 검색합니다.
+        ///       검색 결과는 호출자가 준 버퍼에 쓰며 할당하지 않습니다. 삽입, 이동은 버킷이 커질 때만 할당합니다.
+        class SpatialGrid final {
+        public:
+            static constexpr uint32_t INVALID_PROXY     = UINT32_MAX;   ///< 유효하지 않은 개체 식별자
+            static constexpr uint32_t MAX_QUERY_CELLS   = 256U;         ///< 칸 단위로 검색할 최대 칸 수 (넘으면 모든 버킷을 검사)
+
+        private:
+            /// @brief 버킷 항목
+            struct Entry final {
+                float X, Y, Z;                  ///< 위치
+                uint32_t UserData;              ///< 값
+                uint32_t Proxy;                 ///< 개체 식별자
+            };
+
+            /// @brief 개체
+            struct Proxy final {
+                uint32_t Bucket;                ///< 버킷 인덱스 (INVALID_PROXY: 빈 슬롯, 이때 Index는 다음 빈 슬롯)
+                uint32_t Index;                 ///< 버킷 안의 위치
+            };
+
+            std::vector<std::vector<Entry>> m_Buckets;      ///< 버킷 (개수는 2의 거듭제곱)
+            std::vector<Proxy> m_Proxies;                   ///< 개체 (식별자 = 인덱스)
+            float m_CellSize;                               ///< 칸 크기
+            float m_InverseCellSize;                        ///< 칸 크기의 역수
+            uint32_t m_BucketMask;                          ///< 버킷 인덱스 마스크
+            uint32_t m_FreeProxy;                           ///< 빈 슬롯 목록의 처음
+            uint32_t m_Count;                               ///< 개체 수
+
+            [[nodiscard]] int32_t toCell(float) const noexcept;
+            [[nodiscard]] uint32_t getBucket(int32_t, int32_t, int32_t) const noexcept;
+            [[nodiscard]] uint32_t getBucket(const Vector3F&) const noexcept;
+            template <typename Predicate>
+            [[nodiscard]] uint32_t query(const Vector3F&, const Vector3F&, const Predicate&, uint32_t*, uint32_t) const noexcept;
+
+        public:
+            SpatialGrid(float = 8.0f, uint32_t = 4096U) noexcept;
+            SpatialGrid(const SpatialGrid&) noexcept = delete;
+            SpatialGrid(SpatialGrid&&) noexcept = default;
+            ~SpatialGrid() noexcept = default;
+
+            [[nodiscard]] uint32_t Insert(const Vector3F&, uint32_t) noexcept;
+            void Remove(uint32_t) noexcept;
+            void Move(uint32_t, const Vector3F&) noexcept;
+            void Clear() noexcept;
+
+            [[nodiscard]] uint32_t QueryRadius(const Vector3F&, float, uint32_t*, uint32_t) const noexcept;
+            [[nodiscard]] uint32_t QueryAABB(const Vector3F&, const Vector3F&, uint32_t*, uint32_t) const noexcept;
+
+            [[nodiscard]] Vector3F GetPosition(uint32_t) const noexcept;
+            [[nodiscard]] uint32_t GetUserData(uint32_t) const noexcept;
+
+            /// @brief 개체 수를 취득합니다.
+            /// @return 개체 수
+            [[nodiscard]] uint32_t GetCount() const noexcept { return m_Count; }
+
+            /// @brief 칸 크기를 취득합니다.
+            /// @return 칸 크기
+            [[nodiscard]] float GetCellSize() const noexcept { return m_CellSize; }
+
+            SpatialGrid& operator=(const SpatialGrid&) noexcept = delete;
+            SpatialGrid& operator=(SpatialGrid&&) noexcept = default;
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <vector>
+#include "BlockData.hpp"
+#include "../Graphics/IRenderDevice.hpp"
+#include "../Type/Matrix4x4F.hpp"
+
+inline namespace neoxops {
+    namespace world {
+        /// @brief 월드 지오메트리 정점
+        /// @note graphics::SoftwareVertex와 같은 배치(24바이트)이므로 소프트웨어 렌더 디바이스에서도 그대로 그릴 수 있습니다.
+        struct WorldVertex final {
+            float X, Y, Z;                      ///< 위치
+            uint32_t Color;                     ///< 색상 (메모리 순서 R, G, B, A)
+            float U, V;                         ///< 텍스처 좌표
+        };
+
+        /// @brief 같은 텍스처를 쓰는 연속된 인덱스 범위
+        struct WorldDrawRange final {
+            int32_t TextureIndex;               ///< 텍스처 인덱스 (-1: 텍스처 없음)
+            uint32_t StartIndex;                ///< 시작 인덱스
+            uint32_t IndexCount;                ///< 인덱스 수
+            uint32_t FirstSubRange;             ///< 클러스터별 하위 범위의 시작 (GetSubRanges 기준)
+            uint32_t SubRangeCount;             ///< 클러스터별 하위 범위 수
+        };
+
+        /// @brief 텍스처 범위 안에서 한 클러스터에 속한 인덱스 범위
+        struct WorldSubRange final {
+            uint32_t Cluster;                   ///< 클러스터 인덱스
+            uint32_t StartIndex;                ///< 시작 인덱스
+            uint32_t IndexCount;                ///< 인덱스 수
+        };
+
+        /// @brief 컬링 단위가 되는 공간 격자 칸
+        struct WorldCluster final {
+            Vector3F Min;                       ///< 경계 상자 최소 좌표
+            Vector3F Max;                       ///< 경계 상자 최대 좌표
+        };
+
+        /// @brief 월드 지오메트리 구성 옵션
+        struct WorldGeometryOptions final {
+            float ClusterSize           = 0.0f;     ///< 클러스터 격자 크기 (0 이하: 맵 전체가 클러스터 하나)
+            bool SkipUntextured         = false;    ///< 텍스처 인덱스가 범위(0 ~ 9) 밖인 면을 제외할지 여부
+        };
+
+        /// @brief 정적 월드 지오메트리
+        /// @note 맵의 모든 블록 면을 정점 버퍼 하나, 인덱스 버퍼 하나로 합치고 인덱스를 (텍스처, 클러스터) 순으로 정렬합니다.
+        ///       따라서 전부 보일 때는 텍스처마다 드로우 한 번, 일부 클러스터만 보일 때는 텍스처마다 보이는 연속 구간 수만큼만 그립니다.
+        ///       넓이가 0인 면(꼭짓점이 겹친 블록)은 구성할 때 제외됩니다.
+        ///       업로드한 버퍼는 디바이스 없이 해제할 수 없으므로 소멸자가 아닌 Release로 해제하며,
+        ///       이동하면 버퍼 소유권이 대상으로 넘어가고 이동 대입은 대상의 버퍼를 해제할 수 없어 막습니다.
+        class WorldGeometry final {
+        private:
+            std::vector<WorldVertex> m_Vertices;            ///< 정점
+            std::vector<uint16_t> m_Indices;                ///< 인덱스 (블록 최대 160개 x 정점 24개이므로 16비트)
+            std::vector<WorldDrawRange> m_Ranges;           ///< 텍스처별 범위 (텍스처 인덱스 순)
+            std::vector<WorldSubRange> m_SubRanges;         ///< 텍스처별, 클러스터별 범위
+            std::vector<WorldCluster> m_Clusters;           ///< 클러스터
+
+            graphics::BufferHandle m_VertexBuffer;          ///< 업로드된 정점 버퍼
+            graphics::BufferHandle m_IndexBuffer;           ///< 업로드된 인덱스 버퍼
+
+        public:
+            WorldGeometry() noexcept = default;
+            WorldGeometry(const WorldGeometry&) noexcept = delete;
+            WorldGeometry(WorldGeometry&&) noexcept;
+            ~WorldGeometry() noexcept = default;
+
+            void Build(const BlockData&, const WorldGeometryOptions& = {}) noexcept;
+
+            [[nodiscard]] bool Upload(graphics::IRenderDevice&) noexcept;
+            void Release(graphics::IRenderDevice&) noexcept;
+
+            void CullClusters(const Matrix4x4F&, byte_t*) const noexcept;
+            [[nodiscard]] uint32_t Draw(graphics::IRenderDevice&, const graphics::TextureHandle*, const byte_t* = nullptr) const noexcept;
+
+            [[nodiscard]] const std::vector<WorldVertex>& GetVertices() const noexcept { return m_Vertices; }
+            [[nodiscard]] const std::vector<uint16_t>& GetIndices() const noexcept { return m_Indices; }
+            [[nodiscard]] const std::vector<WorldDrawRange>& GetRanges() const noexcept { return m_Ranges; }
+            [[nodiscard]] const std::vector<WorldSubRange>& GetSubRanges() const noexcept { return m_SubRanges; }
+            [[nodiscard]] const std::vector<WorldCluster>& GetClusters() const noexcept { return m_Clusters; }
+
+            WorldGeometry& operator=(const WorldGeometry&) noexcept = delete;
+            WorldGeometry& operator=(WorldGeometry&&) noexcept = delete;
+        };
+
+        static_assert(sizeof(WorldVertex) == 24U, "WorldVertex must match the SoftwareVertex layout");
+    }
+}
\ No newline at end of file
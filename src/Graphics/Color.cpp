@@ -1,4 +1,300 @@
 #include "Graphics/Color.hpp"
+#include "Type/SIMD.hpp"
+#include <array>
+#include <cmath>
+#include <cstring>
+
+namespace {
+    /// @brief 채널별 바이트 위치
+    struct ChannelOffset final {
+        uint32_t R, G, B, A;
+    };
+
+    /// @brief 바이트 순서별 채널의 바이트 위치 (ColorOrder 순)
+    constexpr ChannelOffset CHANNEL_OFFSET[3] = {
+        { 1U, 2U, 3U, 0U },     // ARGB
+        { 0U, 1U, 2U, 3U },     // RGBA
+        { 2U, 1U, 0U, 3U }      // BGRA
+    };
+
+    /// @brief 채널별 바이트 위치를 취득합니다.
+    inline const ChannelOffset& getOffset(graphics::ColorOrder order) noexcept {
+        return CHANNEL_OFFSET[static_cast<uint32_t>(order)];
+    }
+
+    /// @brief 픽셀 내 바이트 재배치 계획
+    /// @note 같은 거리만큼 움직이는 바이트끼리 묶어 (시프트 + 마스크) 한 번으로 옮깁니다. (회전 2회, 뒤집기 4회, R/B 교환 3회)
+    struct SwizzlePlan final {
+        uint32_t Count = 0U;        ///< 묶음 수
+        uint32_t Mask[4];           ///< 결과 바이트 마스크
+        int32_t Shift[4];           ///< 이동량 (비트, 양수: 왼쪽)
+    };
+
+    /// @brief 바이트 재배치 계획을 만듭니다.
+    /// @param source 결과 바이트별 원본 바이트 위치
+    SwizzlePlan makeSwizzlePlan(const uint32_t (&source)[4]) noexcept {
+        SwizzlePlan plan;
+        for (uint32_t b = 0U; b < 4U; ++b) {
+            const int32_t shift = static_cast<int32_t>(b * 8U) - static_cast<int32_t>(source[b] * 8U);
+
+            uint32_t group = 0U;
+            while (group < plan.Count && plan.Shift[group] != shift) {
+                ++group;
+            }
+            if (group == plan.Count) {
+                plan.Shift[plan.Count] = shift;
+                plan.Mask[plan.Count++] = 0U;
+            }
+            plan.Mask[group] |= 0xFFU << (b * 8U);
+        }
+        return plan;
+    }
+
+    /// @brief 픽셀 하나에 바이트 재배치 계획을 적용합니다.
+    inline uint32_t applySwizzle(uint32_t pixel, const SwizzlePlan& plan) noexcept {
+        uint32_t result = 0U;
+        for (uint32_t group = 0U; group < plan.Count; ++group) {
+            const int32_t shift = plan.Shift[group];
+            result |= ((shift >= 0) ? (pixel << shift) : (pixel >> -shift)) & plan.Mask[group];
+        }
+        return result;
+    }
+
+    /// @brief 0 ~ 65025를 255로 나누고 반올림합니다. (SIMD 경로와 같은 정수 연산)
+    inline uint32_t div255(uint32_t value) noexcept {
+        value += 128U;
+        return (value + (value >> 8)) >> 8;
+    }
+
+    /// @brief 픽셀을 읽습니다. (정렬되지 않은 Color 배열 허용)
+    inline uint32_t loadPixel(const byte_t* p) noexcept {
+        uint32_t pixel;
+        std::memcpy(&pixel, p, sizeof(pixel));
+        return pixel;
+    }
+
+    /// @brief 픽셀을 씁니다.
+    inline void storePixel(byte_t* p, uint32_t pixel) noexcept {
+        std::memcpy(p, &pixel, sizeof(pixel));
+    }
+
+    /// @brief sRGB -> 선형 변환표
+    const std::array<byte_t, 256>& getSrgbToLinearTable() noexcept {
+        static const std::array<byte_t, 256> table = [] {
+            std::array<byte_t, 256> result{};
+            for (uint32_t i = 0U; i < 256U; ++i) {
+                double c = i / 255.0;
+                double linear = (c <= 0.04045) ? (c / 12.92) : std::pow((c + 0.055) / 1.055, 2.4);
+                result[i] = static_cast<byte_t>(linear * 255.0 + 0.5);
+            }
+            return result;
+        }();
+
+        return table;
+    }
+
+    /// @brief 선형 -> sRGB 변환표
+    const std::array<byte_t, 256>& getLinearToSrgbTable() noexcept {
+        static const std::array<byte_t, 256> table = [] {
+            std::array<byte_t, 256> result{};
+            for (uint32_t i = 0U; i < 256U; ++i) {
+                double c = i / 255.0;
+                double srgb = (c <= 0.0031308) ? (c * 12.92) : (1.055 * std::pow(c, 1.0 / 2.4) - 0.055);
+                result[i] = static_cast<byte_t>(srgb * 255.0 + 0.5);
+            }
+            return result;
+        }();
+
+        return table;
+    }
+
+    /// @brief 한 번에 처리하는 픽셀 묶음 (레인)
+    /// @note 빌드 대상에 따라 AVX2(8), SSE2(4) 중 하나가 선택되며, 그 외(NEON 포함)에는 스칼라 경로만 사용합니다.
+    ///       8비트 채널은 16비트로 펼쳐 곱한 뒤 div255와 같은 방식으로 반올림하고 다시 포화 압축합니다.
+#if defined(NEOXOPS_SIMD_AVX2)
+    struct Lanes final {
+        static constexpr size_t COUNT = 8U;
+        using I = __m256i;
+
+        static I Load(const byte_t* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+        static void Store(byte_t* p, I v) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+        static I Set32(uint32_t v) noexcept { return _mm256_set1_epi32(static_cast<int32_t>(v)); }
+        static I Set16(uint16_t v) noexcept { return _mm256_set1_epi16(static_cast<int16_t>(v)); }
+        static I And(I a, I b) noexcept { return _mm256_and_si256(a, b); }
+        static I Or(I a, I b) noexcept { return _mm256_or_si256(a, b); }
+        static I AndNot(I a, I b) noexcept { return _mm256_andnot_si256(a, b); }
+        static I UnpackLo(I v) noexcept { return _mm256_unpacklo_epi8(v, _mm256_setzero_si256()); }
+        static I UnpackHi(I v) noexcept { return _mm256_unpackhi_epi8(v, _mm256_setzero_si256()); }
+        static I Pack(I lo, I hi) noexcept { return _mm256_packus_epi16(lo, hi); }
+        static I Add16(I a, I b) noexcept { return _mm256_add_epi16(a, b); }
+        static I Sub16(I a, I b) noexcept { return _mm256_sub_epi16(a, b); }
+        static I Mul16(I a, I b) noexcept { return _mm256_mullo_epi16(a, b); }
+        static I Srl16(I a) noexcept { return _mm256_srli_epi16(a, 8); }
+        template<int32_t ALPHA>
+        static I BroadcastAlpha(I v) noexcept { return _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(v, ALPHA * 0x55), ALPHA * 0x55); }
+
+        /// @brief 픽셀 내 바이트 재배치 제어값
+        struct Swizzle final {
+            I Control;
+        };
+
+        static Swizzle MakeSwizzle(const uint32_t (&source)[4]) noexcept {
+            alignas(32) byte_t control[32];
+            for (uint32_t i = 0U; i < 32U; ++i) {
+                control[i] = static_cast<byte_t>((i & 12U) + source[i & 3U]);
+            }
+            return { _mm256_load_si256(reinterpret_cast<const __m256i*>(control)) };
+        }
+
+        static I Apply(I v, const Swizzle& swizzle) noexcept { return _mm256_shuffle_epi8(v, swizzle.Control); }
+    };
+#elif defined(NEOXOPS_SIMD_SSE2)
+    struct Lanes final {
+        static constexpr size_t COUNT = 4U;
+        using I = __m128i;
+
+        static I Load(const byte_t* p) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+        static void Store(byte_t* p, I v) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+        static I Set32(uint32_t v) noexcept { return _mm_set1_epi32(static_cast<int32_t>(v)); }
+        static I Set16(uint16_t v) noexcept { return _mm_set1_epi16(static_cast<int16_t>(v)); }
+        static I And(I a, I b) noexcept { return _mm_and_si128(a, b); }
+        static I Or(I a, I b) noexcept { return _mm_or_si128(a, b); }
+        static I AndNot(I a, I b) noexcept { return _mm_andnot_si128(a, b); }
+        static I UnpackLo(I v) noexcept { return _mm_unpacklo_epi8(v, _mm_setzero_si128()); }
+        static I UnpackHi(I v) noexcept { return _mm_unpackhi_epi8(v, _mm_setzero_si128()); }
+        static I Pack(I lo, I hi) noexcept { return _mm_packus_epi16(lo, hi); }
+        static I Add16(I a, I b) noexcept { return _mm_add_epi16(a, b); }
+        static I Sub16(I a, I b) noexcept { return _mm_sub_epi16(a, b); }
+        static I Mul16(I a, I b) noexcept { return _mm_mullo_epi16(a, b); }
+        static I Srl16(I a) noexcept { return _mm_srli_epi16(a, 8); }
+        template<int32_t ALPHA>
+        static I BroadcastAlpha(I v) noexcept { return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, ALPHA * 0x55), ALPHA * 0x55); }
+
+        /// @brief 픽셀 내 바이트 재배치 제어값 (SSE2에는 바이트 셔플이 없으므로 묶음마다 시프트와 마스크로 옮깁니다.)
+        struct Swizzle final {
+            uint32_t Count;         ///< 묶음 수
+            I Mask[4];              ///< 결과 바이트 마스크
+            I Left[4];              ///< 왼쪽 시프트 (사용하지 않으면 32: 결과 0)
+            I Right[4];             ///< 오른쪽 시프트 (사용하지 않으면 32: 결과 0)
+        };
+
+        static Swizzle MakeSwizzle(const uint32_t (&source)[4]) noexcept {
+            const SwizzlePlan plan = makeSwizzlePlan(source);
+
+            Swizzle swizzle;
+            swizzle.Count = plan.Count;
+            for (uint32_t group = 0U; group < plan.Count; ++group) {
+                const int32_t shift = plan.Shift[group];
+                swizzle.Mask[group] = Set32(plan.Mask[group]);
+                swizzle.Left[group] = _mm_cvtsi32_si128((shift >= 0) ? shift : 32);
+                swizzle.Right[group] = _mm_cvtsi32_si128((shift <= 0) ? -shift : 32);
+            }
+            return swizzle;
+        }
+
+        static I Apply(I v, const Swizzle& swizzle) noexcept {
+            I result = _mm_setzero_si128();
+            for (uint32_t group = 0U; group < swizzle.Count; ++group) {
+                I moved = _mm_or_si128(_mm_sll_epi32(v, swizzle.Left[group]), _mm_srl_epi32(v, swizzle.Right[group]));
+                result = _mm_or_si128(result, _mm_and_si128(moved, swizzle.Mask[group]));
+            }
+            return result;
+        }
+    };
+#endif
+
+#if defined(NEOXOPS_SIMD_SSE2) || defined(NEOXOPS_SIMD_AVX2)
+    /// @brief 16비트 레인의 div255 (반올림)
+    inline Lanes::I div255(Lanes::I value) noexcept {
+        value = Lanes::Add16(value, Lanes::Set16(128U));
+        return Lanes::Srl16(Lanes::Add16(value, Lanes::Srl16(value)));
+    }
+
+    /// @brief 알파 바이트만 원본에서 가져옵니다.
+    inline Lanes::I keepAlpha(Lanes::I color, Lanes::I alphaSource, Lanes::I alphaMask) noexcept {
+        return Lanes::Or(Lanes::AndNot(alphaMask, color), Lanes::And(alphaMask, alphaSource));
+    }
+
+    template<int32_t ALPHA>
+    size_t premultiplyLanes(const byte_t* src, byte_t* dst, size_t count) noexcept {
+        const Lanes::I alphaMask = Lanes::Set32(0xFFU << (ALPHA * 8));
+
+        size_t i = 0U;
+        for (; i + Lanes::COUNT <= count; i += Lanes::COUNT) {
+            Lanes::I pixels = Lanes::Load(src + i * 4U);
+            Lanes::I lo = Lanes::UnpackLo(pixels);
+            Lanes::I hi = Lanes::UnpackHi(pixels);
+
+            lo = div255(Lanes::Mul16(lo, Lanes::BroadcastAlpha<ALPHA>(lo)));
+            hi = div255(Lanes::Mul16(hi, Lanes::BroadcastAlpha<ALPHA>(hi)));
+            Lanes::Store(dst + i * 4U, keepAlpha(Lanes::Pack(lo, hi), pixels, alphaMask));
+        }
+        return i;
+    }
+
+    template<int32_t ALPHA>
+    size_t blendOverLanes(const byte_t* src, byte_t* dst, size_t count) noexcept {
+        const Lanes::I alphaMask = Lanes::Set32(0xFFU << (ALPHA * 8));
+        const Lanes::I full = Lanes::Set16(255U);
+
+        size_t i = 0U;
+        for (; i + Lanes::COUNT <= count; i += Lanes::COUNT) {
+            Lanes::I source = Lanes::Load(src + i * 4U);
+            Lanes::I dest = Lanes::Load(dst + i * 4U);
+
+            Lanes::I sLo = Lanes::UnpackLo(source), sHi = Lanes::UnpackHi(source);
+            Lanes::I dLo = Lanes::UnpackLo(dest),   dHi = Lanes::UnpackHi(dest);
+            Lanes::I aLo = Lanes::BroadcastAlpha<ALPHA>(sLo), aHi = Lanes::BroadcastAlpha<ALPHA>(sHi);
+            Lanes::I invLo = Lanes::Sub16(full, aLo), invHi = Lanes::Sub16(full, aHi);
+
+            // 색상: (s * a + d * (255 - a)) / 255, 알파: a + da * (255 - a) / 255
+            Lanes::I color = Lanes::Pack(
+                div255(Lanes::Add16(Lanes::Mul16(sLo, aLo), Lanes::Mul16(dLo, invLo))),
+                div255(Lanes::Add16(Lanes::Mul16(sHi, aHi), Lanes::Mul16(dHi, invHi))));
+            Lanes::I alpha = Lanes::Pack(
+                Lanes::Add16(sLo, div255(Lanes::Mul16(dLo, invLo))),
+                Lanes::Add16(sHi, div255(Lanes::Mul16(dHi, invHi))));
+            Lanes::Store(dst + i * 4U, keepAlpha(color, alpha, alphaMask));
+        }
+        return i;
+    }
+
+    template<int32_t ALPHA>
+    size_t blendOverPremultipliedLanes(const byte_t* src, byte_t* dst, size_t count) noexcept {
+        const Lanes::I full = Lanes::Set16(255U);
+
+        size_t i = 0U;
+        for (; i + Lanes::COUNT <= count; i += Lanes::COUNT) {
+            Lanes::I source = Lanes::Load(src + i * 4U);
+            Lanes::I dest = Lanes::Load(dst + i * 4U);
+
+            Lanes::I sLo = Lanes::UnpackLo(source), sHi = Lanes::UnpackHi(source);
+            Lanes::I invLo = Lanes::Sub16(full, Lanes::BroadcastAlpha<ALPHA>(sLo));
+            Lanes::I invHi = Lanes::Sub16(full, Lanes::BroadcastAlpha<ALPHA>(sHi));
+
+            // s + d * (255 - a) / 255 (255를 넘으면 포화)
+            Lanes::Store(dst + i * 4U, Lanes::Pack(
+                Lanes::Add16(sLo, div255(Lanes::Mul16(Lanes::UnpackLo(dest), invLo))),
+                Lanes::Add16(sHi, div255(Lanes::Mul16(Lanes::UnpackHi(dest), invHi)))));
+        }
+        return i;
+    }
+#endif
+
+    /// @brief 알파를 제외한 채널을 변환표로 바꿉니다.
+    void applyTable(const byte_t* src, byte_t* dst, graphics::ColorOrder order, size_t count, const std::array<byte_t, 256>& table) noexcept {
+        const ChannelOffset& offset = getOffset(order);
+        for (size_t i = 0U; i < count; ++i) {
+            const byte_t* s = src + i * 4U;
+            byte_t* d = dst + i * 4U;
+
+            d[offset.R] = table[s[offset.R]];
+            d[offset.G] = table[s[offset.G]];
+            d[offset.B] = table[s[offset.B]];
+            d[offset.A] = s[offset.A];
+        }
+    }
+}
 
 using namespace graphics;
 
@@ -28,15 +324,6 @@ Color::Color(uint32_t colorCode) noexcept {
     B = (colorCode)       & 0xFF;
 }
 
-/// @brief 생성자
-/// @param clr Color
-Color::Color(const Color& clr) noexcept {
-    A = clr.A;
-    R = clr.R;
-    G = clr.G;
-    B = clr.B;
-}
-
 /// @brief 정수 색상 코드를 취득합니다.
 /// @param r Red (0 ~ 255)
 /// @param g Green (0 ~ 255)
@@ -52,3 +339,147 @@ uint32_t Color::GetColorCode(int32_t r, int32_t g, int32_t b, int32_t a) noexcep
 uint32_t Color::GetColorCode() const noexcept {
     return ((A & 0xFF) << 24) | ((R & 0xFF) << 16) | ((G & 0xFF) << 8) | (B & 0xFF);
 }
+
+/// @brief 픽셀 배열의 바이트 순서를 변환합니다.
+/// @param src 원본 (Color 또는 uint32_t 배열)
+/// @param srcOrder 원본 바이트 순서
+/// @param dst 결과 (src와 같아도 됨)
+/// @param dstOrder 결과 바이트 순서
+/// @param count 픽셀 수
+void Color::Convert(const void* src, ColorOrder srcOrder, void* dst, ColorOrder dstOrder, size_t count) noexcept {
+    const byte_t* s = static_cast<const byte_t*>(src);
+    byte_t* d = static_cast<byte_t*>(dst);
+
+    if (srcOrder == dstOrder) {
+        if (s != d && count != 0U) {
+            std::memmove(d, s, count * 4U);
+        }
+        return;
+    }
+
+    // 결과의 각 바이트가 원본의 어느 바이트에서 오는지 계산합니다.
+    const ChannelOffset& from = getOffset(srcOrder);
+    const ChannelOffset& to = getOffset(dstOrder);
+
+    uint32_t source[4];
+    source[to.R] = from.R;
+    source[to.G] = from.G;
+    source[to.B] = from.B;
+    source[to.A] = from.A;
+
+    size_t i = 0U;
+#if defined(NEOXOPS_SIMD_SSE2) || defined(NEOXOPS_SIMD_AVX2)
+    const Lanes::Swizzle swizzle = Lanes::MakeSwizzle(source);
+    for (; i + Lanes::COUNT <= count; i += Lanes::COUNT) {
+        Lanes::Store(d + i * 4U, Lanes::Apply(Lanes::Load(s + i * 4U), swizzle));
+    }
+#endif
+
+    const SwizzlePlan plan = makeSwizzlePlan(source);
+    for (; i < count; ++i) {
+        storePixel(d + i * 4U, applySwizzle(loadPixel(s + i * 4U), plan));
+    }
+}
+
+/// @brief 색상 채널에 알파를 곱합니다. (직선 알파 -> 미리 곱한 알파)
+/// @param src 원본
+/// @param dst 결과 (src와 같아도 됨)
+/// @param order 바이트 순서
+/// @param count 픽셀 수
+void Color::PremultiplyAlpha(const void* src, void* dst, ColorOrder order, size_t count) noexcept {
+    const byte_t* s = static_cast<const byte_t*>(src);
+    byte_t* d = static_cast<byte_t*>(dst);
+    const ChannelOffset& offset = getOffset(order);
+
+    size_t i = 0U;
+#if defined(NEOXOPS_SIMD_SSE2) || defined(NEOXOPS_SIMD_AVX2)
+    i = (offset.A == 0U) ? premultiplyLanes<0>(s, d, count) : premultiplyLanes<3>(s, d, count);
+#endif
+
+    for (; i < count; ++i) {
+        const byte_t* sp = s + i * 4U;
+        byte_t* dp = d + i * 4U;
+
+        const uint32_t a = sp[offset.A];
+        dp[offset.R] = static_cast<byte_t>(div255(sp[offset.R] * a));
+        dp[offset.G] = static_cast<byte_t>(div255(sp[offset.G] * a));
+        dp[offset.B] = static_cast<byte_t>(div255(sp[offset.B] * a));
+        dp[offset.A] = static_cast<byte_t>(a);
+    }
+}
+
+/// @brief sRGB 색상을 선형 색상으로 변환합니다. (알파 제외, 256단계 변환표)
+/// @param src 원본
+/// @param dst 결과 (src와 같아도 됨)
+/// @param order 바이트 순서
+/// @param count 픽셀 수
+/// @note 8비트 선형 값은 어두운 영역의 정밀도가 낮으므로 합성 중간 결과용으로만 사용합니다.
+void Color::SrgbToLinear(const void* src, void* dst, ColorOrder order, size_t count) noexcept {
+    applyTable(static_cast<const byte_t*>(src), static_cast<byte_t*>(dst), order, count, getSrgbToLinearTable());
+}
+
+/// @brief 선형 색상을 sRGB 색상으로 변환합니다. (알파 제외, 256단계 변환표)
+/// @param src 원본
+/// @param dst 결과 (src와 같아도 됨)
+/// @param order 바이트 순서
+/// @param count 픽셀 수
+void Color::LinearToSrgb(const void* src, void* dst, ColorOrder order, size_t count) noexcept {
+    applyTable(static_cast<const byte_t*>(src), static_cast<byte_t*>(dst), order, count, getLinearToSrgbTable());
+}
+
+/// @brief 직선 알파 원본을 결과 위에 합성합니다.
+/// @param src 원본
+/// @param dst 결과 (합성 대상)
+/// @param order 바이트 순서 (원본, 결과 공통)
+/// @param count 픽셀 수
+/// @note 색상 = s * a + d * (1 - a), 알파 = a + da * (1 - a) (D3D의 SrcAlpha/InvSrcAlpha, One/InvSrcAlpha 블렌드와 같음)
+void Color::BlendOver(const void* src, void* dst, ColorOrder order, size_t count) noexcept {
+    const byte_t* s = static_cast<const byte_t*>(src);
+    byte_t* d = static_cast<byte_t*>(dst);
+    const ChannelOffset& offset = getOffset(order);
+
+    size_t i = 0U;
+#if defined(NEOXOPS_SIMD_SSE2) || defined(NEOXOPS_SIMD_AVX2)
+    i = (offset.A == 0U) ? blendOverLanes<0>(s, d, count) : blendOverLanes<3>(s, d, count);
+#endif
+
+    for (; i < count; ++i) {
+        const byte_t* sp = s + i * 4U;
+        byte_t* dp = d + i * 4U;
+
+        const uint32_t a = sp[offset.A];
+        const uint32_t inv = 255U - a;
+        dp[offset.R] = static_cast<byte_t>(div255(sp[offset.R] * a + dp[offset.R] * inv));
+        dp[offset.G] = static_cast<byte_t>(div255(sp[offset.G] * a + dp[offset.G] * inv));
+        dp[offset.B] = static_cast<byte_t>(div255(sp[offset.B] * a + dp[offset.B] * inv));
+        dp[offset.A] = static_cast<byte_t>(a + div255(dp[offset.A] * inv));
+    }
+}
+
+/// @brief 미리 곱한 알파 원본을 결과 위에 합성합니다.
+/// @param src 원본 (미리 곱한 알파)
+/// @param dst 결과 (미리 곱한 알파, 합성 대상)
+/// @param order 바이트 순서 (원본, 결과 공통)
+/// @param count 픽셀 수
+/// @note 모든 채널 = s + d * (1 - a) (255에서 포화)
+void Color::BlendOverPremultiplied(const void* src, void* dst, ColorOrder order, size_t count) noexcept {
+    const byte_t* s = static_cast<const byte_t*>(src);
+    byte_t* d = static_cast<byte_t*>(dst);
+    const ChannelOffset& offset = getOffset(order);
+
+    size_t i = 0U;
+#if defined(NEOXOPS_SIMD_SSE2) || defined(NEOXOPS_SIMD_AVX2)
+    i = (offset.A == 0U) ? blendOverPremultipliedLanes<0>(s, d, count) : blendOverPremultipliedLanes<3>(s, d, count);
+#endif
+
+    for (; i < count; ++i) {
+        const byte_t* sp = s + i * 4U;
+        byte_t* dp = d + i * 4U;
+
+        const uint32_t inv = 255U - sp[offset.A];
+        for (uint32_t c = 0U; c < 4U; ++c) {
+            const uint32_t value = sp[c] + div255(dp[c] * inv);
+            dp[c] = static_cast<byte_t>((value > 255U) ? 255U : value);
+        }
+    }
+}
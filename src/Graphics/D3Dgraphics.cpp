@@ -1,337 +1,1056 @@
-#include "Graphics/D3DGraphics.hpp"
-
-using namespace graphics;
-
-/// @brief 기본 생성자
-D3DGraphics::D3DGraphics() noexcept {
-    m_ViewPort      = {};
-    m_VSyncEnabled  = true;
-}
-
-/// @brief 소멸자
-D3DGraphics::~D3DGraphics() noexcept {
-    if (m_SwapChain) {
-        m_SwapChain->SetFullscreenState(FALSE, nullptr);
-    }
-}
-
-/// @brief Direct3D 초기화를 수행합니다.
-/// @param hWnd 윈도우의 핸들
-/// @param width 너비
-/// @param height 높이
-/// @param fullscreenEnabled 전체화면 활성화 유무
-/// @param vsyncEnabled 수직 동기화 활성화 유무
-/// @return 성공(true), 실패(false)
-bool D3DGraphics::Initialize(HWND hWnd, int32_t width, int32_t height, bool fullscreenEnabled, bool vsyncEnabled) noexcept {
-    // V-Sync
-    m_VSyncEnabled = vsyncEnabled;
-
-    // 디스플레이 정보 취득
-    Microsoft::WRL::ComPtr<IDXGIFactory> factory;
-    if (FAILED(CreateDXGIFactory(__uuidof(IDXGIFactory), reinterpret_cast<void**>(factory.GetAddressOf())))) {
-        return false;
-    }
-
-    Microsoft::WRL::ComPtr<IDXGIAdapter> adapter;
-    if (FAILED(factory->EnumAdapters(0, adapter.GetAddressOf()))) {
-        return false;
-    }
-
-    Microsoft::WRL::ComPtr<IDXGIOutput> adapterOutput;
-    if (FAILED(adapter->EnumOutputs(0, adapterOutput.GetAddressOf()))) {
-        return false;
-    }
-
-    // 출력 디스플레이의 모드 목록 취득
-    UINT numModes = 0U;
-    if (FAILED(adapterOutput->GetDisplayModeList(DXGI_FORMAT_R8G8B8A8_UNORM, 0, &numModes, nullptr))) {
-        return false;
-    }
-
-    DXGI_MODE_DESC* modeList = new DXGI_MODE_DESC[numModes];
-    if (!modeList) {
-        return false;
-    }
-    if (FAILED(adapterOutput->GetDisplayModeList(DXGI_FORMAT_R8G8B8A8_UNORM, 0, &numModes, modeList))) {
-        return false;
-    }
-
-    DXGI_RATIONAL refreshRate = { 0, 1 };
-    for (int i = 0; i < (int)numModes; ++i) {
-        if (modeList[i].Width == width && modeList[i].Height == height) {
-            refreshRate = modeList[i].RefreshRate;
-            break;
-        }
-    }
-
-    delete[] modeList;
-    modeList = nullptr;
-
-    // 스왑 체인 설명
-    DXGI_SWAP_CHAIN_DESC swapChainDesc                  = {};
-    swapChainDesc.BufferCount                           = 2;
-    swapChainDesc.BufferDesc.Width                      = width;
-    swapChainDesc.BufferDesc.Height                     = height;
-    swapChainDesc.BufferDesc.Format                     = DXGI_FORMAT_R8G8B8A8_UNORM;
-    swapChainDesc.BufferDesc.RefreshRate.Numerator      = vsyncEnabled ? refreshRate.Numerator : 0;
-    swapChainDesc.BufferDesc.RefreshRate.Denominator    = vsyncEnabled ? refreshRate.Denominator : 1;
-    swapChainDesc.BufferUsage                           = DXGI_USAGE_RENDER_TARGET_OUTPUT;
-    swapChainDesc.OutputWindow                          = hWnd;
-    swapChainDesc.SampleDesc.Count                      = 1;
-    swapChainDesc.SampleDesc.Quality                    = 0;
-    swapChainDesc.Windowed                              = !fullscreenEnabled;
-    swapChainDesc.SwapEffect                            = DXGI_SWAP_EFFECT_FLIP_DISCARD;
-    swapChainDesc.Flags                                 = DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH | DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;      // 일부 드라이버 또는 OS 환경에 따라 강제로 프레임을 제한할 수 있어 방지하기 위해 이 플래그를 사용.
-
-    // 디바이스 플래그
-    UINT createDeviceFlags = 0U;
-#if defined(_DEBUG) || defined(DEBUG)
-    createDeviceFlags |= D3D11_CREATE_DEVICE_DEBUG;
-#endif
-
-    // 피쳐 레벨
-    const D3D_FEATURE_LEVEL featureLevels[] = {
-        D3D_FEATURE_LEVEL_11_1,
-        D3D_FEATURE_LEVEL_11_0
-    };
-    D3D_FEATURE_LEVEL featureLevel;
-
-    // 디바이스 생성    
-    if (FAILED(D3D11CreateDeviceAndSwapChain(
-        nullptr,
-        D3D_DRIVER_TYPE_HARDWARE,
-        nullptr,
-        createDeviceFlags,
-        featureLevels,
-        _countof(featureLevels),
-        D3D11_SDK_VERSION,
-        &swapChainDesc,
-        m_SwapChain.GetAddressOf(),
-        m_Device.GetAddressOf(),
-        &featureLevel,
-        m_DeviceContext.GetAddressOf()
-    ))) {
-#if defined(ENABLE_SOFTWARE_RENDER)
-        if (FAILED(D3D11CreateDeviceAndSwapChain(
-            nullptr,
-            D3D_DRIVER_TYPE_WARP,
-            nullptr,
-            createDeviceFlags,
-            featureLevels,
-            _countof(featureLevels),
-            D3D11_SDK_VERSION,
-            &swapChainDesc,
-            m_SwapChain.ReleaseAndGetAddressOf(),
-            m_Device.ReleaseAndGetAddressOf(),
-            &featureLevel,
-            m_DeviceContext.ReleaseAndGetAddressOf()
-        ))) {
-            return false;
-        }
-#else
-        return false;
-#endif
-    }
-
-    // 백 버퍼로 부터 렌더 타겟 뷰 생성
-    Microsoft::WRL::ComPtr<ID3D11Texture2D> backBuffer;
-    if (FAILED(m_SwapChain->GetBuffer(0, IID_PPV_ARGS(&backBuffer)))) {
-        return false;
-    }
-    if (FAILED(m_Device->CreateRenderTargetView(backBuffer.Get(), nullptr, m_RenderTargetView.GetAddressOf()))) {
-        return false;
-    }
-
-    // 깊이 스텐실 버퍼와 뷰 생성
-    D3D11_TEXTURE2D_DESC depthBufferDesc    = {};
-    depthBufferDesc.Width                   = width;
-    depthBufferDesc.Height                  = height;
-    depthBufferDesc.MipLevels               = 1;
-    depthBufferDesc.ArraySize               = 1;
-    depthBufferDesc.Format                  = DXGI_FORMAT_D24_UNORM_S8_UINT;
-    depthBufferDesc.SampleDesc.Count        = 1;
-    depthBufferDesc.SampleDesc.Quality      = 0;
-    depthBufferDesc.Usage                   = D3D11_USAGE_DEFAULT;
-    depthBufferDesc.BindFlags               = D3D11_BIND_DEPTH_STENCIL;
-
-    if (FAILED(m_Device->CreateTexture2D(&depthBufferDesc, nullptr, m_DepthStencilBuffer.GetAddressOf()))) {
-        return false;
-    }
-
-    D3D11_DEPTH_STENCIL_DESC depthStencilDesc       = {};
-    depthStencilDesc.DepthEnable                    = TRUE;
-    depthStencilDesc.DepthWriteMask                 = D3D11_DEPTH_WRITE_MASK_ALL;
-    depthStencilDesc.DepthFunc                      = D3D11_COMPARISON_LESS;
-    depthStencilDesc.StencilEnable                  = TRUE;
-    depthStencilDesc.StencilReadMask                = 0xFF;
-    depthStencilDesc.StencilWriteMask               = 0xFF;
-    depthStencilDesc.FrontFace.StencilFailOp        = D3D11_STENCIL_OP_KEEP;
-    depthStencilDesc.FrontFace.StencilDepthFailOp   = D3D11_STENCIL_OP_INCR;
-    depthStencilDesc.FrontFace.StencilPassOp        = D3D11_STENCIL_OP_KEEP;
-    depthStencilDesc.FrontFace.StencilFunc          = D3D11_COMPARISON_ALWAYS;
-    depthStencilDesc.BackFace.StencilFailOp         = D3D11_STENCIL_OP_KEEP;
-    depthStencilDesc.BackFace.StencilDepthFailOp    = D3D11_STENCIL_OP_DECR;
-    depthStencilDesc.BackFace.StencilPassOp         = D3D11_STENCIL_OP_KEEP;
-    depthStencilDesc.BackFace.StencilFunc           = D3D11_COMPARISON_ALWAYS;
-
-    if (FAILED(m_Device->CreateDepthStencilState(&depthStencilDesc, m_DepthStencilState.GetAddressOf()))) {
-        return false;
-    }
-    m_DeviceContext->OMSetDepthStencilState(m_DepthStencilState.Get(), 1);
-
-    D3D11_DEPTH_STENCIL_VIEW_DESC depthStencilViewDesc  = {};
-    depthStencilViewDesc.Format                         = DXGI_FORMAT_D24_UNORM_S8_UINT;
-    depthStencilViewDesc.ViewDimension                  = D3D11_DSV_DIMENSION_TEXTURE2D;
-    depthStencilViewDesc.Texture2D.MipSlice             = 0;
-
-    if (FAILED(m_Device->CreateDepthStencilView(m_DepthStencilBuffer.Get(), &depthStencilViewDesc, m_DepthStencilView.GetAddressOf()))) {
-        return false;
-    }
-    m_DeviceContext->OMSetRenderTargets(1, m_RenderTargetView.GetAddressOf(), m_DepthStencilView.Get());
-
-    // 래스터라이저 상태
-    D3D11_RASTERIZER_DESC rasterDesc    = {};
-    rasterDesc.AntialiasedLineEnable    = FALSE;
-    rasterDesc.CullMode                 = D3D11_CULL_BACK;
-    rasterDesc.DepthBias                = 0;
-    rasterDesc.DepthBiasClamp           = 0.0f;
-    rasterDesc.DepthClipEnable          = TRUE;
-    rasterDesc.FillMode                 = D3D11_FILL_SOLID;
-    rasterDesc.FrontCounterClockwise    = FALSE;
-    rasterDesc.MultisampleEnable        = FALSE;
-    rasterDesc.ScissorEnable            = FALSE;
-    rasterDesc.SlopeScaledDepthBias     = 0.0f;
-    
-    if (FAILED(m_Device->CreateRasterizerState(&rasterDesc, m_RasterState.GetAddressOf()))) {
-        return false;
-    }
-    m_DeviceContext->RSSetState(m_RasterState.Get());
-
-    // 뷰포트
-    m_ViewPort.Width    = static_cast<float>(width);
-    m_ViewPort.Height   = static_cast<float>(height);
-    m_ViewPort.MinDepth = 0.0f;
-    m_ViewPort.MaxDepth = 1.0f;
-    m_ViewPort.TopLeftX = 0.0f;
-    m_ViewPort.TopLeftY = 0.0f;
-
-    m_DeviceContext->RSSetViewports(1, &m_ViewPort);
-    
-    return true;
-}
-
-/// @brief V-Sync 활성화 유무를 취득합니다.
-/// @return 활성화(true), 비활성화(false)
-bool D3DGraphics::IsVSyncEnabled() const noexcept {
-    return m_VSyncEnabled;
-}
-
-/// @brief 렌더 타겟과 깊이 버퍼를 초기화합니다.
-/// @param color 색상
-void D3DGraphics::BeginFrame(float color[4]) noexcept {
-    // 렌더 타겟을 설정한 색상으로 클리어
-    m_DeviceContext->ClearRenderTargetView(m_RenderTargetView.Get(), color);
-
-    // 깊이 스텐실 버퍼 초기화
-    m_DeviceContext->ClearDepthStencilView(m_DepthStencilView.Get(), D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
-}
-
-/// @brief 화면에 출력합니다.
-void D3DGraphics::EndFrame() noexcept {
-    m_SwapChain->Present(m_VSyncEnabled ? 1 : 0, 0);
-}
-
-/// @brief 화면의 크기를 변경합니다.
-/// @param width 너비
-/// @param height 높이
-bool D3DGraphics::Resize(int32_t width, int32_t height) noexcept {
-    if (!m_Device || !m_DeviceContext || !m_SwapChain) {
-        return false;
-    }
-
-    // 렌더 타겟과 깊이 스텐실 뷰의 바인딩을 해제
-    m_DeviceContext->OMSetRenderTargets(0, nullptr, nullptr);
-
-    // 기존의 리소스 해제
-    m_RenderTargetView.Reset();
-    m_DepthStencilView.Reset();
-    m_DepthStencilBuffer.Reset();
-
-    // 스왑 체인의 버퍼 크기 조정
-    if (FAILED(m_SwapChain->ResizeBuffers(0, width, height, DXGI_FORMAT_UNKNOWN, 0))) {
-        return false;
-    }
-
-    // 백 버퍼로부터 렌더 타겟 뷰 생성
-    Microsoft::WRL::ComPtr<ID3D11Texture2D> backBuffer;
-    if (FAILED(m_SwapChain->GetBuffer(0, IID_PPV_ARGS(&backBuffer)))) {
-        return false;
-    }
-    if (FAILED(m_Device->CreateRenderTargetView(backBuffer.Get(), nullptr, m_RenderTargetView.GetAddressOf()))) {
-        return false;
-    }
-
-    // 깊이 스텐실 버퍼 생성
-    D3D11_TEXTURE2D_DESC depthBufferDesc    = {};
-    depthBufferDesc.Width                   = width;
-    depthBufferDesc.Height                  = height;
-    depthBufferDesc.MipLevels               = 1;
-    depthBufferDesc.ArraySize               = 1;
-    depthBufferDesc.Format                  = DXGI_FORMAT_D24_UNORM_S8_UINT;
-    depthBufferDesc.SampleDesc.Count        = 1;
-    depthBufferDesc.SampleDesc.Quality      = 0;
-    depthBufferDesc.Usage                   = D3D11_USAGE_DEFAULT;
-    depthBufferDesc.BindFlags               = D3D11_BIND_DEPTH_STENCIL;
-
-    if (FAILED(m_Device->CreateTexture2D(&depthBufferDesc, nullptr, m_DepthStencilBuffer.GetAddressOf()))) {
-        return false;
-    }
-    if (FAILED(m_Device->CreateDepthStencilView(m_DepthStencilBuffer.Get(), nullptr, m_DepthStencilView.GetAddressOf()))) {
-        return false;
-    }
-    m_DeviceContext->OMSetRenderTargets(1, m_RenderTargetView.GetAddressOf(), m_DepthStencilView.Get());
-    
-    // 뷰포트
-    m_ViewPort.Width    = static_cast<float>(width);
-    m_ViewPort.Height   = static_cast<float>(height);
-    m_ViewPort.MinDepth = 0.0f;
-    m_ViewPort.MaxDepth = 1.0f;
-    m_ViewPort.TopLeftX = 0.0f;
-    m_ViewPort.TopLeftY = 0.0f;
-
-    m_DeviceContext->RSSetViewports(1, &m_ViewPort);
-
-    return true;
-}
-
-/// @brief V-Sync 활성화를 설정합니다.
-/// @param enabled 활성화 유무
-void D3DGraphics::SetVSync(bool enabled) noexcept {
-    m_VSyncEnabled = enabled;
-}
-
-/// @brief Direct3D 디바이스를 취득합니다.
-/// @return Direct3D 디바이스
-ID3D11Device* D3DGraphics::GetDevice() const noexcept {
-    return m_Device.Get();
-}
-
-/// @brief Direct3D 디바이스 컨텍스트를 취득합니다.
-/// @return Direct3D 디바이스 컨텍스트
-ID3D11DeviceContext* D3DGraphics::GetDeviceContext() const noexcept {
-    return m_DeviceContext.Get();
-}
-
-/// @brief 렌더 타겟 뷰를 취득합니다.
-/// @return 렌더 타겟 뷰
-ID3D11RenderTargetView* D3DGraphics::GetRenderTargetView() const noexcept
-{
-    return m_RenderTargetView.Get();
-}
-
-/// @brief 깊이 스텐실 뷰를 취득합니다.
-/// @return 깊이 스텐실 뷰
-ID3D11DepthStencilView* D3DGraphics::GetDepthStencilView() const noexcept
-{
-    return m_DepthStencilView.Get();
-}
\ No newline at end of file
+#if defined(_WIN32)
+
+#include "Graphics/D3DGraphics.hpp"
+#include <algorithm>
+#include <cstring>
+
+using namespace graphics;
+
+namespace {
+    /// @brief 텍스처 형식을 DXGI 형식으로 변환합니다.
+    /// @param format 텍스처 형식
+    /// @return DXGI 형식
+    DXGI_FORMAT toDXGIFormat(TextureFormat format) noexcept {
+        switch (format) {
+            case TextureFormat::RGBA8:  return DXGI_FORMAT_R8G8B8A8_UNORM;
+            case TextureFormat::BGRA8:  return DXGI_FORMAT_B8G8R8A8_UNORM;
+            case TextureFormat::BC1:    return DXGI_FORMAT_BC1_UNORM;
+            case TextureFormat::BC3:    return DXGI_FORMAT_BC3_UNORM;
+            case TextureFormat::BC7:    return DXGI_FORMAT_BC7_UNORM;
+        }
+        return DXGI_FORMAT_UNKNOWN;
+    }
+
+    /// @brief 블렌드 계수를 Direct3D 형식으로 변환합니다.
+    /// @param factor 블렌드 계수
+    /// @return Direct3D 블렌드 계수
+    D3D11_BLEND toD3DBlend(BlendFactor factor) noexcept {
+        switch (factor) {
+            case BlendFactor::Zero:         return D3D11_BLEND_ZERO;
+            case BlendFactor::One:          return D3D11_BLEND_ONE;
+            case BlendFactor::SrcColor:     return D3D11_BLEND_SRC_COLOR;
+            case BlendFactor::InvSrcColor:  return D3D11_BLEND_INV_SRC_COLOR;
+            case BlendFactor::SrcAlpha:     return D3D11_BLEND_SRC_ALPHA;
+            case BlendFactor::InvSrcAlpha:  return D3D11_BLEND_INV_SRC_ALPHA;
+            case BlendFactor::DestColor:    return D3D11_BLEND_DEST_COLOR;
+            case BlendFactor::InvDestColor: return D3D11_BLEND_INV_DEST_COLOR;
+            case BlendFactor::DestAlpha:    return D3D11_BLEND_DEST_ALPHA;
+            case BlendFactor::InvDestAlpha: return D3D11_BLEND_INV_DEST_ALPHA;
+        }
+        return D3D11_BLEND_ONE;
+    }
+
+    /// @brief 블렌드 연산을 Direct3D 형식으로 변환합니다.
+    /// @param op 블렌드 연산
+    /// @return Direct3D 블렌드 연산
+    D3D11_BLEND_OP toD3DBlendOp(BlendOp op) noexcept {
+        switch (op) {
+            case BlendOp::Add:              return D3D11_BLEND_OP_ADD;
+            case BlendOp::Subtract:         return D3D11_BLEND_OP_SUBTRACT;
+            case BlendOp::ReverseSubtract:  return D3D11_BLEND_OP_REV_SUBTRACT;
+            case BlendOp::Min:              return D3D11_BLEND_OP_MIN;
+            case BlendOp::Max:              return D3D11_BLEND_OP_MAX;
+        }
+        return D3D11_BLEND_OP_ADD;
+    }
+
+    /// @brief 비교 함수를 Direct3D 형식으로 변환합니다.
+    /// @param func 비교 함수
+    /// @return Direct3D 비교 함수
+    D3D11_COMPARISON_FUNC toD3DComparison(CompareFunc func) noexcept {
+        switch (func) {
+            case CompareFunc::Never:        return D3D11_COMPARISON_NEVER;
+            case CompareFunc::Less:         return D3D11_COMPARISON_LESS;
+            case CompareFunc::Equal:        return D3D11_COMPARISON_EQUAL;
+            case CompareFunc::LessEqual:    return D3D11_COMPARISON_LESS_EQUAL;
+            case CompareFunc::Greater:      return D3D11_COMPARISON_GREATER;
+            case CompareFunc::NotEqual:     return D3D11_COMPARISON_NOT_EQUAL;
+            case CompareFunc::GreaterEqual: return D3D11_COMPARISON_GREATER_EQUAL;
+            case CompareFunc::Always:       return D3D11_COMPARISON_ALWAYS;
+        }
+        return D3D11_COMPARISON_LESS;
+    }
+
+    /// @brief 텍스처 주소 지정 방식을 Direct3D 형식으로 변환합니다.
+    /// @param address 텍스처 주소 지정 방식
+    /// @return Direct3D 텍스처 주소 지정 방식
+    D3D11_TEXTURE_ADDRESS_MODE toD3DAddress(TextureAddress address) noexcept {
+        switch (address) {
+            case TextureAddress::Wrap:      return D3D11_TEXTURE_ADDRESS_WRAP;
+            case TextureAddress::Mirror:    return D3D11_TEXTURE_ADDRESS_MIRROR;
+            case TextureAddress::Clamp:     return D3D11_TEXTURE_ADDRESS_CLAMP;
+        }
+        return D3D11_TEXTURE_ADDRESS_WRAP;
+    }
+
+    /// @brief POSITION(float3), COLOR(R8G8B8A8_UNORM), TEXCOORD(float2) 입력 배치
+    constexpr D3D11_INPUT_ELEMENT_DESC POSITION_COLOR_UV_LAYOUT[] = {
+        { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT,    0,  0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+        { "COLOR",    0, DXGI_FORMAT_R8G8B8A8_UNORM,     0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+        { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT,       0, 16, D3D11_INPUT_PER_VERTEX_DATA, 0 }
+    };
+
+    /// @brief POSITION(float3), NORMAL(float3), TEXCOORD(float2) 입력 배치
+    constexpr D3D11_INPUT_ELEMENT_DESC MESH_LAYOUT[] = {
+        { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT,    0,  0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+        { "NORMAL",   0, DXGI_FORMAT_R32G32B32_FLOAT,    0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+        { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT,       0, 24, D3D11_INPUT_PER_VERTEX_DATA, 0 }
+    };
+
+    /// @brief 쿠킹된 메시 입력 배치 (위치는 경계 상자 기준이므로 정점 셰이더에서 복원)
+    constexpr D3D11_INPUT_ELEMENT_DESC COOKED_MESH_LAYOUT[] = {
+        { "POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0,  0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+        { "NORMAL",   0, DXGI_FORMAT_R10G10B10A2_UNORM,  0,  8, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+        { "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT,       0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 }
+    };
+}
+
+/// @brief 기본 생성자
+D3DGraphics::D3DGraphics() noexcept {
+    m_ViewPort      = {};
+    m_VSyncEnabled  = true;
+}
+
+/// @brief 소멸자
+D3DGraphics::~D3DGraphics() noexcept {
+    if (m_SwapChain) {
+        m_SwapChain->SetFullscreenState(FALSE, nullptr);
+    }
+}
+
+/// @brief Direct3D 초기화를 수행합니다.
+/// @param nativeHandle 윈도우의 핸들 (HWND)
+/// @param width 너비
+/// @param height 높이
+/// @param fullscreenEnabled 전체화면 활성화 유무
+/// @param vsyncEnabled 수직 동기화 활성화 유무
+/// @return 성공(true), 실패(false)
+bool D3DGraphics::Initialize(void* nativeHandle, int32_t width, int32_t height, bool fullscreenEnabled, bool vsyncEnabled) noexcept {
+    HWND hWnd = static_cast<HWND>(nativeHandle);
+    if (!hWnd) {
+        return false;
+    }
+
+    // V-Sync
+    m_VSyncEnabled = vsyncEnabled;
+
+    // 디스플레이 정보 취득
+    Microsoft::WRL::ComPtr<IDXGIFactory> factory;
+    if (FAILED(CreateDXGIFactory(__uuidof(IDXGIFactory), reinterpret_cast<void**>(factory.GetAddressOf())))) {
+        return false;
+    }
+
+    Microsoft::WRL::ComPtr<IDXGIAdapter> adapter;
+    if (FAILED(factory->EnumAdapters(0, adapter.GetAddressOf()))) {
+        return false;
+    }
+
+    Microsoft::WRL::ComPtr<IDXGIOutput> adapterOutput;
+    if (FAILED(adapter->EnumOutputs(0, adapterOutput.GetAddressOf()))) {
+        return false;
+    }
+
+    // 출력 디스플레이의 모드 목록 취득
+    UINT numModes = 0U;
+    if (FAILED(adapterOutput->GetDisplayModeList(DXGI_FORMAT_R8G8B8A8_UNORM, 0, &numModes, nullptr))) {
+        return false;
+    }
+
+    DXGI_MODE_DESC* modeList = new DXGI_MODE_DESC[numModes];
+    if (!modeList) {
+        return false;
+    }
+    if (FAILED(adapterOutput->GetDisplayModeList(DXGI_FORMAT_R8G8B8A8_UNORM, 0, &numModes, modeList))) {
+        return false;
+    }
+
+    DXGI_RATIONAL refreshRate = { 0, 1 };
+    for (int i = 0; i < (int)numModes; ++i) {
+        if (modeList[i].Width == width && modeList[i].Height == height) {
+            refreshRate = modeList[i].RefreshRate;
+            break;
+        }
+    }
+
+    delete[] modeList;
+    modeList = nullptr;
+
+    // 스왑 체인 설명
+    DXGI_SWAP_CHAIN_DESC swapChainDesc                  = {};
+    swapChainDesc.BufferCount                           = 2;
+    swapChainDesc.BufferDesc.Width                      = width;
+    swapChainDesc.BufferDesc.Height                     = height;
+    swapChainDesc.BufferDesc.Format                     = DXGI_FORMAT_R8G8B8A8_UNORM;
+    swapChainDesc.BufferDesc.RefreshRate.Numerator      = vsyncEnabled ? refreshRate.Numerator : 0;
+    swapChainDesc.BufferDesc.RefreshRate.Denominator    = vsyncEnabled ? refreshRate.Denominator : 1;
+    swapChainDesc.BufferUsage                           = DXGI_USAGE_RENDER_TARGET_OUTPUT;
+    swapChainDesc.OutputWindow                          = hWnd;
+    swapChainDesc.SampleDesc.Count                      = 1;
+    swapChainDesc.SampleDesc.Quality                    = 0;
+    swapChainDesc.Windowed                              = !fullscreenEnabled;
+    swapChainDesc.SwapEffect                            = DXGI_SWAP_EFFECT_FLIP_DISCARD;
+    swapChainDesc.Flags                                 = DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH | DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;      // 일부 드라이버 또는 OS 환경에 따라 강제로 프레임을 제한할 수 있어 방지하기 위해 이 플래그를 사용.
+
+    // 디바이스 플래그
+    UINT createDeviceFlags = 0U;
+#if defined(_DEBUG) || defined(DEBUG)
+    createDeviceFlags |= D3D11_CREATE_DEVICE_DEBUG;
+#endif
+
+    // 피쳐 레벨
+    const D3D_FEATURE_LEVEL featureLevels[] = {
+        D3D_FEATURE_LEVEL_11_1,
+        D3D_FEATURE_LEVEL_11_0
+    };
+    D3D_FEATURE_LEVEL featureLevel;
+
+    // 디바이스 생성    
+    if (FAILED(D3D11CreateDeviceAndSwapChain(
+        nullptr,
+        D3D_DRIVER_TYPE_HARDWARE,
+        nullptr,
+        createDeviceFlags,
+        featureLevels,
+        _countof(featureLevels),
+        D3D11_SDK_VERSION,
+        &swapChainDesc,
+        m_SwapChain.GetAddressOf(),
+        m_Device.GetAddressOf(),
+        &featureLevel,
+        m_DeviceContext.GetAddressOf()
+    ))) {
+#if defined(ENABLE_SOFTWARE_RENDER)
+        if (FAILED(D3D11CreateDeviceAndSwapChain(
+            nullptr,
+            D3D_DRIVER_TYPE_WARP,
+            nullptr,
+            createDeviceFlags,
+            featureLevels,
+            _countof(featureLevels),
+            D3D11_SDK_VERSION,
+            &swapChainDesc,
+            m_SwapChain.ReleaseAndGetAddressOf(),
+            m_Device.ReleaseAndGetAddressOf(),
+            &featureLevel,
+            m_DeviceContext.ReleaseAndGetAddressOf()
+        ))) {
+            return false;
+        }
+#else
+        return false;
+#endif
+    }
+
+    // 백 버퍼로 부터 렌더 타겟 뷰 생성
+    Microsoft::WRL::ComPtr<ID3D11Texture2D> backBuffer;
+    if (FAILED(m_SwapChain->GetBuffer(0, IID_PPV_ARGS(&backBuffer)))) {
+        return false;
+    }
+    if (FAILED(m_Device->CreateRenderTargetView(backBuffer.Get(), nullptr, m_RenderTargetView.GetAddressOf()))) {
+        return false;
+    }
+
+    // 깊이 스텐실 버퍼와 뷰 생성
+    D3D11_TEXTURE2D_DESC depthBufferDesc    = {};
+    depthBufferDesc.Width                   = width;
+    depthBufferDesc.Height                  = height;
+    depthBufferDesc.MipLevels               = 1;
+    depthBufferDesc.ArraySize               = 1;
+    depthBufferDesc.Format                  = DXGI_FORMAT_D24_UNORM_S8_UINT;
+    depthBufferDesc.SampleDesc.Count        = 1;
+    depthBufferDesc.SampleDesc.Quality      = 0;
+    depthBufferDesc.Usage                   = D3D11_USAGE_DEFAULT;
+    depthBufferDesc.BindFlags               = D3D11_BIND_DEPTH_STENCIL;
+
+    if (FAILED(m_Device->CreateTexture2D(&depthBufferDesc, nullptr, m_DepthStencilBuffer.GetAddressOf()))) {
+        return false;
+    }
+
+    D3D11_DEPTH_STENCIL_DESC depthStencilDesc       = {};
+    depthStencilDesc.DepthEnable                    = TRUE;
+    depthStencilDesc.DepthWriteMask                 = D3D11_DEPTH_WRITE_MASK_ALL;
+    depthStencilDesc.DepthFunc                      = D3D11_COMPARISON_LESS;
+    depthStencilDesc.StencilEnable                  = TRUE;
+    depthStencilDesc.StencilReadMask                = 0xFF;
+    depthStencilDesc.StencilWriteMask               = 0xFF;
+    depthStencilDesc.FrontFace.StencilFailOp        = D3D11_STENCIL_OP_KEEP;
+    depthStencilDesc.FrontFace.StencilDepthFailOp   = D3D11_STENCIL_OP_INCR;
+    depthStencilDesc.FrontFace.StencilPassOp        = D3D11_STENCIL_OP_KEEP;
+    depthStencilDesc.FrontFace.StencilFunc          = D3D11_COMPARISON_ALWAYS;
+    depthStencilDesc.BackFace.StencilFailOp         = D3D11_STENCIL_OP_KEEP;
+    depthStencilDesc.BackFace.StencilDepthFailOp    = D3D11_STENCIL_OP_DECR;
+    depthStencilDesc.BackFace.StencilPassOp         = D3D11_STENCIL_OP_KEEP;
+    depthStencilDesc.BackFace.StencilFunc           = D3D11_COMPARISON_ALWAYS;
+
+    if (FAILED(m_Device->CreateDepthStencilState(&depthStencilDesc, m_DepthStencilState.GetAddressOf()))) {
+        return false;
+    }
+    m_DeviceContext->OMSetDepthStencilState(m_DepthStencilState.Get(), 1);
+
+    D3D11_DEPTH_STENCIL_VIEW_DESC depthStencilViewDesc  = {};
+    depthStencilViewDesc.Format                         = DXGI_FORMAT_D24_UNORM_S8_UINT;
+    depthStencilViewDesc.ViewDimension                  = D3D11_DSV_DIMENSION_TEXTURE2D;
+    depthStencilViewDesc.Texture2D.MipSlice             = 0;
+
+    if (FAILED(m_Device->CreateDepthStencilView(m_DepthStencilBuffer.Get(), &depthStencilViewDesc, m_DepthStencilView.GetAddressOf()))) {
+        return false;
+    }
+    m_DeviceContext->OMSetRenderTargets(1, m_RenderTargetView.GetAddressOf(), m_DepthStencilView.Get());
+
+    // 래스터라이저 상태
+    D3D11_RASTERIZER_DESC rasterDesc    = {};
+    rasterDesc.AntialiasedLineEnable    = FALSE;
+    rasterDesc.CullMode                 = D3D11_CULL_BACK;
+    rasterDesc.DepthBias                = 0;
+    rasterDesc.DepthBiasClamp           = 0.0f;
+    rasterDesc.DepthClipEnable          = TRUE;
+    rasterDesc.FillMode                 = D3D11_FILL_SOLID;
+    rasterDesc.FrontCounterClockwise    = FALSE;
+    rasterDesc.MultisampleEnable        = FALSE;
+    rasterDesc.ScissorEnable            = FALSE;
+    rasterDesc.SlopeScaledDepthBias     = 0.0f;
+    
+    if (FAILED(m_Device->CreateRasterizerState(&rasterDesc, m_RasterState.GetAddressOf()))) {
+        return false;
+    }
+    m_DeviceContext->RSSetState(m_RasterState.Get());
+
+    // 뷰포트
+    m_ViewPort.Width    = static_cast<float>(width);
+    m_ViewPort.Height   = static_cast<float>(height);
+    m_ViewPort.MinDepth = 0.0f;
+    m_ViewPort.MaxDepth = 1.0f;
+    m_ViewPort.TopLeftX = 0.0f;
+    m_ViewPort.TopLeftY = 0.0f;
+
+    m_DeviceContext->RSSetViewports(1, &m_ViewPort);
+    
+    return true;
+}
+
+/// @brief V-Sync 활성화 유무를 취득합니다.
+/// @return 활성화(true), 비활성화(false)
+bool D3DGraphics::IsVSyncEnabled() const noexcept {
+    return m_VSyncEnabled;
+}
+
+/// @brief 렌더 타겟과 깊이 버퍼를 초기화합니다.
+/// @param color 색상
+void D3DGraphics::BeginFrame(float color[4]) noexcept {
+    // 렌더 타겟을 설정한 색상으로 클리어
+    m_DeviceContext->ClearRenderTargetView(m_RenderTargetView.Get(), color);
+
+    // 깊이 스텐실 버퍼 초기화
+    m_DeviceContext->ClearDepthStencilView(m_DepthStencilView.Get(), D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
+}
+
+/// @brief 화면에 출력합니다.
+void D3DGraphics::EndFrame() noexcept {
+    m_SwapChain->Present(m_VSyncEnabled ? 1 : 0, 0);
+
+    m_LastFrameStats = m_FrameStats;
+    m_FrameStats = {};
+}
+
+/// @brief 화면의 크기를 변경합니다.
+/// @param width 너비
+/// @param height 높이
+bool D3DGraphics::Resize(int32_t width, int32_t height) noexcept {
+    if (!m_Device || !m_DeviceContext || !m_SwapChain) {
+        return false;
+    }
+
+    // 렌더 타겟과 깊이 스텐실 뷰의 바인딩을 해제
+    m_DeviceContext->OMSetRenderTargets(0, nullptr, nullptr);
+
+    // 기존의 리소스 해제
+    m_RenderTargetView.Reset();
+    m_DepthStencilView.Reset();
+    m_DepthStencilBuffer.Reset();
+
+    // 스왑 체인의 버퍼 크기 조정
+    if (FAILED(m_SwapChain->ResizeBuffers(0, width, height, DXGI_FORMAT_UNKNOWN, 0))) {
+        return false;
+    }
+
+    // 백 버퍼로부터 렌더 타겟 뷰 생성
+    Microsoft::WRL::ComPtr<ID3D11Texture2D> backBuffer;
+    if (FAILED(m_SwapChain->GetBuffer(0, IID_PPV_ARGS(&backBuffer)))) {
+        return false;
+    }
+    if (FAILED(m_Device->CreateRenderTargetView(backBuffer.Get(), nullptr, m_RenderTargetView.GetAddressOf()))) {
+        return false;
+    }
+
+    // 깊이 스텐실 버퍼 생성
+    D3D11_TEXTURE2D_DESC depthBufferDesc    = {};
+    depthBufferDesc.Width                   = width;
+    depthBufferDesc.Height                  = height;
+    depthBufferDesc.MipLevels               = 1;
+    depthBufferDesc.ArraySize               = 1;
+    depthBufferDesc.Format                  = DXGI_FORMAT_D24_UNORM_S8_UINT;
+    depthBufferDesc.SampleDesc.Count        = 1;
+    depthBufferDesc.SampleDesc.Quality      = 0;
+    depthBufferDesc.Usage                   = D3D11_USAGE_DEFAULT;
+    depthBufferDesc.BindFlags               = D3D11_BIND_DEPTH_STENCIL;
+
+    if (FAILED(m_Device->CreateTexture2D(&depthBufferDesc, nullptr, m_DepthStencilBuffer.GetAddressOf()))) {
+        return false;
+    }
+    if (FAILED(m_Device->CreateDepthStencilView(m_DepthStencilBuffer.Get(), nullptr, m_DepthStencilView.GetAddressOf()))) {
+        return false;
+    }
+    m_DeviceContext->OMSetRenderTargets(1, m_RenderTargetView.GetAddressOf(), m_DepthStencilView.Get());
+    
+    // 뷰포트
+    m_ViewPort.Width    = static_cast<float>(width);
+    m_ViewPort.Height   = static_cast<float>(height);
+    m_ViewPort.MinDepth = 0.0f;
+    m_ViewPort.MaxDepth = 1.0f;
+    m_ViewPort.TopLeftX = 0.0f;
+    m_ViewPort.TopLeftY = 0.0f;
+
+    m_DeviceContext->RSSetViewports(1, &m_ViewPort);
+
+    return true;
+}
+
+/// @brief V-Sync 활성화를 설정합니다.
+/// @param enabled 활성화 유무
+void D3DGraphics::SetVSync(bool enabled) noexcept {
+    m_VSyncEnabled = enabled;
+}
+
+/// @brief Direct3D 디바이스를 취득합니다.
+/// @return Direct3D 디바이스
+/// @note 백엔드 전용 기능이 필요할 때만 사용하고, 그 외에는 IRenderDevice 인터페이스를 사용해주세요.
+ID3D11Device* D3DGraphics::GetDevice() const noexcept {
+    return m_Device.Get();
+}
+
+/// @brief Direct3D 디바이스 컨텍스트를 취득합니다.
+/// @return Direct3D 디바이스 컨텍스트
+/// @note 백엔드 전용 기능이 필요할 때만 사용하고, 그 외에는 IRenderDevice 인터페이스를 사용해주세요.
+ID3D11DeviceContext* D3DGraphics::GetDeviceContext() const noexcept {
+    return m_DeviceContext.Get();
+}
+
+/// @brief 렌더 타겟 뷰를 취득합니다.
+/// @return 렌더 타겟 뷰
+ID3D11RenderTargetView* D3DGraphics::GetRenderTargetView() const noexcept
+{
+    return m_RenderTargetView.Get();
+}
+
+/// @brief 깊이 스텐실 뷰를 취득합니다.
+/// @return 깊이 스텐실 뷰
+ID3D11DepthStencilView* D3DGraphics::GetDepthStencilView() const noexcept
+{
+    return m_DepthStencilView.Get();
+}
+
+/// @brief 버퍼를 생성합니다.
+/// @param desc 버퍼 설명
+/// @param data 초기 데이터 (nullptr 가능, Immutable은 필수)
+/// @return 버퍼 핸들 (실패 시 무효 핸들)
+BufferHandle D3DGraphics::CreateBuffer(const BufferDesc& desc, const void* data) noexcept {
+    if (!m_Device || desc.Size == 0U || (desc.Usage == BufferUsage::Immutable && !data)) {
+        return {};
+    }
+
+    // 버퍼 설명
+    D3D11_BUFFER_DESC bufferDesc    = {};
+    bufferDesc.ByteWidth            = desc.Size;
+    bufferDesc.StructureByteStride  = 0;
+    bufferDesc.MiscFlags            = 0;
+
+    switch (desc.Type) {
+        case BufferType::Vertex:    bufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;   break;
+        case BufferType::Index:     bufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;    break;
+        case BufferType::Constant:  bufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER; break;
+    }
+
+    switch (desc.Usage) {
+        case BufferUsage::Immutable: {
+            bufferDesc.Usage            = D3D11_USAGE_IMMUTABLE;
+            bufferDesc.CPUAccessFlags   = 0;
+        } break;
+
+        case BufferUsage::Default: {
+            bufferDesc.Usage            = D3D11_USAGE_DEFAULT;
+            bufferDesc.CPUAccessFlags   = 0;
+        } break;
+
+        case BufferUsage::Dynamic: {
+            bufferDesc.Usage            = D3D11_USAGE_DYNAMIC;
+            bufferDesc.CPUAccessFlags   = D3D11_CPU_ACCESS_WRITE;
+        } break;
+    }
+
+    D3D11_SUBRESOURCE_DATA initData = {};
+    initData.pSysMem                = data;
+
+    D3DBuffer resource;
+    if (FAILED(m_Device->CreateBuffer(&bufferDesc, data ? &initData : nullptr, resource.Buffer.GetAddressOf()))) {
+        return {};
+    }
+    resource.Desc = desc;
+
+    const uint32_t id = m_Buffers.Add(std::move(resource));
+    if (id == 0U) {
+        return {};
+    }
+
+    ++m_FrameStats.BuffersCreated;
+    m_FrameStats.BytesUploaded += data ? desc.Size : 0U;
+
+    return { id };
+}
+
+/// @brief 버퍼의 내용을 갱신합니다.
+/// @param handle 버퍼 핸들
+/// @param data 데이터
+/// @param size 크기 (바이트 단위)
+/// @return 성공(true), 실패(false)
+bool D3DGraphics::UpdateBuffer(BufferHandle handle, const void* data, uint32_t size) noexcept {
+    D3DBuffer* resource = m_Buffers.Get(handle.ID);
+    if (!resource || !data || size == 0U || size > resource->Desc.Size) {
+        return false;
+    }
+
+    switch (resource->Desc.Usage) {
+        case BufferUsage::Immutable: {
+            return false;
+        }
+
+        case BufferUsage::Default: {
+            // 상수 버퍼는 부분 갱신이 불가하므로 전체 크기로 갱신해야 함
+            if (resource->Desc.Type == BufferType::Constant) {
+                if (size != resource->Desc.Size) {
+                    return false;
+                }
+
+                m_DeviceContext->UpdateSubresource(resource->Buffer.Get(), 0, nullptr, data, 0, 0);
+            } else {
+                const D3D11_BOX box = { 0U, 0U, 0U, size, 1U, 1U };
+                m_DeviceContext->UpdateSubresource(resource->Buffer.Get(), 0, &box, data, 0, 0);
+            }
+        } break;
+
+        case BufferUsage::Dynamic: {
+            D3D11_MAPPED_SUBRESOURCE mapped = {};
+            if (FAILED(m_DeviceContext->Map(resource->Buffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped))) {
+                return false;
+            }
+
+            std::memcpy(mapped.pData, data, size);
+            m_DeviceContext->Unmap(resource->Buffer.Get(), 0);
+        } break;
+    }
+
+    m_FrameStats.BytesUploaded += size;
+    return true;
+}
+
+/// @brief 버퍼를 해제합니다.
+/// @param handle 버퍼 핸들
+void D3DGraphics::DestroyBuffer(BufferHandle handle) noexcept {
+    m_Buffers.Remove(handle.ID);
+}
+
+/// @brief 텍스처를 생성합니다.
+/// @param desc 텍스처 설명
+/// @param data 초기 데이터 (0단계부터 모든 밉맵 단계가 행 간격 없이 연속, nullptr 가능)
+/// @return 텍스처 핸들 (실패 시 무효 핸들)
+/// @note 초기 데이터는 복사되지 않고 바로 디바이스로 전달되므로, 메모리 매핑된 파일을 그대로 넘길 수 있습니다.
+TextureHandle D3DGraphics::CreateTexture(const TextureDesc& desc, const void* data) noexcept {
+    if (!m_Device || !IsValidTextureDesc(desc)) {
+        return {};
+    }
+
+    // 텍스처 설명
+    D3D11_TEXTURE2D_DESC textureDesc    = {};
+    textureDesc.Width                   = static_cast<UINT>(desc.Width);
+    textureDesc.Height                  = static_cast<UINT>(desc.Height);
+    textureDesc.MipLevels               = desc.MipLevels;
+    textureDesc.ArraySize               = 1;
+    textureDesc.Format                  = toDXGIFormat(desc.Format);
+    textureDesc.SampleDesc.Count        = 1;
+    textureDesc.SampleDesc.Quality      = 0;
+    textureDesc.Usage                   = D3D11_USAGE_DEFAULT;
+    textureDesc.BindFlags               = D3D11_BIND_SHADER_RESOURCE;
+
+    // 밉맵 단계별 초기 데이터
+    D3D11_SUBRESOURCE_DATA initData[D3D11_REQ_MIP_LEVELS] = {};
+    const byte_t* level = static_cast<const byte_t*>(data);
+    for (uint32_t i = 0U; level && i < desc.MipLevels; ++i) {
+        const uint32_t rowPitch = GetRowPitch(desc.Format, GetMipSize(desc.Width, i));
+        initData[i].pSysMem     = level;
+        initData[i].SysMemPitch = rowPitch;
+        level += static_cast<size_t>(rowPitch) * GetRowCount(desc.Format, GetMipSize(desc.Height, i));
+    }
+
+    D3DTexture resource;
+    if (FAILED(m_Device->CreateTexture2D(&textureDesc, data ? initData : nullptr, resource.Texture.GetAddressOf()))) {
+        return {};
+    }
+    if (FAILED(m_Device->CreateShaderResourceView(resource.Texture.Get(), nullptr, resource.View.GetAddressOf()))) {
+        return {};
+    }
+    resource.Desc = desc;
+
+    const uint32_t id = m_Textures.Add(std::move(resource));
+    if (id == 0U) {
+        return {};
+    }
+
+    ++m_FrameStats.TexturesCreated;
+    m_FrameStats.BytesUploaded += data ? GetTextureDataSize(desc) : 0ULL;
+
+    return { id };
+}
+
+/// @brief 텍스처를 해제합니다.
+/// @param handle 텍스처 핸들
+void D3DGraphics::DestroyTexture(TextureHandle handle) noexcept {
+    m_Textures.Remove(handle.ID);
+}
+
+/// @brief 텍스처 형식을 지원하는지 확인합니다.
+/// @param format 텍스처 형식
+/// @return 지원(true), 미지원(false)
+/// @note 기능 수준 10.0 이상의 Direct3D 11 디바이스는 BC1 ~ BC3를, 11.0 이상은 BC7을 지원합니다.
+bool D3DGraphics::IsTextureFormatSupported(TextureFormat format) const noexcept {
+    if (!m_Device) {
+        return false;
+    }
+
+    UINT support = 0;
+    if (FAILED(m_Device->CheckFormatSupport(toDXGIFormat(format), &support))) {
+        return false;
+    }
+    return (support & D3D11_FORMAT_SUPPORT_TEXTURE2D) != 0;
+}
+
+/// @brief 셰이더를 생성합니다.
+/// @param desc 셰이더 설명
+/// @param code 컴파일된 바이트 코드 (DXBC)
+/// @param size 바이트 코드 크기
+/// @return 셰이더 핸들 (실패 시 무효 핸들)
+/// @note 정점 셰이더는 입력 배치를 바이트 코드의 입력 서명과 대조해 함께 생성합니다.
+ShaderHandle D3DGraphics::CreateShader(const ShaderDesc& desc, const void* code, size_t size) noexcept {
+    if (!m_Device || !code || size == 0U) {
+        return {};
+    }
+
+    D3DShader resource;
+    if (desc.Stage == ShaderStage::Vertex) {
+        if (FAILED(m_Device->CreateVertexShader(code, size, nullptr, resource.VertexShader.GetAddressOf()))) {
+            return {};
+        }
+
+        const D3D11_INPUT_ELEMENT_DESC* elements = nullptr;
+        UINT elementCount = 0;
+        switch (desc.Layout) {
+            case VertexLayout::None:            break;
+            case VertexLayout::PositionColorUV: elements = POSITION_COLOR_UV_LAYOUT;    elementCount = ARRAYSIZE(POSITION_COLOR_UV_LAYOUT); break;
+            case VertexLayout::Mesh:            elements = MESH_LAYOUT;                 elementCount = ARRAYSIZE(MESH_LAYOUT);              break;
+            case VertexLayout::CookedMesh:      elements = COOKED_MESH_LAYOUT;          elementCount = ARRAYSIZE(COOKED_MESH_LAYOUT);       break;
+        }
+        if (elements && FAILED(m_Device->CreateInputLayout(elements, elementCount, code, size, resource.InputLayout.GetAddressOf()))) {
+            return {};
+        }
+    } else if (FAILED(m_Device->CreatePixelShader(code, size, nullptr, resource.PixelShader.GetAddressOf()))) {
+        return {};
+    }
+    resource.Desc = desc;
+
+    const uint32_t id = m_Shaders.Add(std::move(resource));
+    if (id == 0U) {
+        return {};
+    }
+
+    ++m_FrameStats.ShadersCreated;
+
+    return { id };
+}
+
+/// @brief 셰이더를 해제합니다.
+/// @param handle 셰이더 핸들
+void D3DGraphics::DestroyShader(ShaderHandle handle) noexcept {
+    m_Shaders.Remove(handle.ID);
+}
+
+/// @brief 블렌드 상태를 생성합니다.
+/// @param desc 블렌드 상태 설명
+/// @return 블렌드 상태 핸들 (실패 시 무효 핸들)
+BlendStateHandle D3DGraphics::CreateBlendState(const BlendDesc& desc) noexcept {
+    if (!m_Device) {
+        return {};
+    }
+
+    D3D11_BLEND_DESC blendDesc                      = {};
+    blendDesc.AlphaToCoverageEnable                 = FALSE;
+    blendDesc.IndependentBlendEnable                = FALSE;
+    blendDesc.RenderTarget[0].BlendEnable           = desc.BlendEnabled ? TRUE : FALSE;
+    blendDesc.RenderTarget[0].SrcBlend              = toD3DBlend(desc.SrcColor);
+    blendDesc.RenderTarget[0].DestBlend             = toD3DBlend(desc.DestColor);
+    blendDesc.RenderTarget[0].BlendOp               = toD3DBlendOp(desc.ColorOp);
+    blendDesc.RenderTarget[0].SrcBlendAlpha         = toD3DBlend(desc.SrcAlpha);
+    blendDesc.RenderTarget[0].DestBlendAlpha        = toD3DBlend(desc.DestAlpha);
+    blendDesc.RenderTarget[0].BlendOpAlpha          = toD3DBlendOp(desc.AlphaOp);
+    blendDesc.RenderTarget[0].RenderTargetWriteMask = desc.WriteMask & D3D11_COLOR_WRITE_ENABLE_ALL;
+
+    Microsoft::WRL::ComPtr<ID3D11BlendState> state;
+    if (FAILED(m_Device->CreateBlendState(&blendDesc, state.GetAddressOf()))) {
+        return {};
+    }
+
+    const uint32_t id = m_BlendStates.Add(std::move(state));
+    if (id == 0U) {
+        return {};
+    }
+
+    ++m_FrameStats.StatesCreated;
+
+    return { id };
+}
+
+/// @brief 깊이 스텐실 상태를 생성합니다.
+/// @param desc 깊이 스텐실 상태 설명
+/// @return 깊이 스텐실 상태 핸들 (실패 시 무효 핸들)
+DepthStencilStateHandle D3DGraphics::CreateDepthStencilState(const DepthStencilDesc& desc) noexcept {
+    if (!m_Device) {
+        return {};
+    }
+
+    D3D11_DEPTH_STENCIL_DESC depthStencilDesc   = {};
+    depthStencilDesc.DepthEnable                = desc.DepthEnabled ? TRUE : FALSE;
+    depthStencilDesc.DepthWriteMask             = desc.DepthWriteEnabled ? D3D11_DEPTH_WRITE_MASK_ALL : D3D11_DEPTH_WRITE_MASK_ZERO;
+    depthStencilDesc.DepthFunc                  = toD3DComparison(desc.DepthFunc);
+    depthStencilDesc.StencilEnable              = FALSE;
+
+    Microsoft::WRL::ComPtr<ID3D11DepthStencilState> state;
+    if (FAILED(m_Device->CreateDepthStencilState(&depthStencilDesc, state.GetAddressOf()))) {
+        return {};
+    }
+
+    const uint32_t id = m_DepthStencilStates.Add(std::move(state));
+    if (id == 0U) {
+        return {};
+    }
+
+    ++m_FrameStats.StatesCreated;
+
+    return { id };
+}
+
+/// @brief 래스터라이저 상태를 생성합니다.
+/// @param desc 래스터라이저 상태 설명
+/// @return 래스터라이저 상태 핸들 (실패 시 무효 핸들)
+RasterizerStateHandle D3DGraphics::CreateRasterizerState(const RasterizerDesc& desc) noexcept {
+    if (!m_Device) {
+        return {};
+    }
+
+    D3D11_RASTERIZER_DESC rasterDesc    = {};
+    rasterDesc.FillMode                 = (desc.Fill == FillMode::Wireframe) ? D3D11_FILL_WIREFRAME : D3D11_FILL_SOLID;
+    rasterDesc.CullMode                 = (desc.Cull == CullMode::None) ? D3D11_CULL_NONE : (desc.Cull == CullMode::Front) ? D3D11_CULL_FRONT : D3D11_CULL_BACK;
+    rasterDesc.FrontCounterClockwise    = desc.FrontCounterClockwise ? TRUE : FALSE;
+    rasterDesc.DepthBias                = desc.DepthBias;
+    rasterDesc.DepthBiasClamp           = 0.0f;
+    rasterDesc.SlopeScaledDepthBias     = 0.0f;
+    rasterDesc.DepthClipEnable          = desc.DepthClipEnabled ? TRUE : FALSE;
+    rasterDesc.ScissorEnable            = desc.ScissorEnabled ? TRUE : FALSE;
+    rasterDesc.MultisampleEnable        = FALSE;
+    rasterDesc.AntialiasedLineEnable    = FALSE;
+
+    Microsoft::WRL::ComPtr<ID3D11RasterizerState> state;
+    if (FAILED(m_Device->CreateRasterizerState(&rasterDesc, state.GetAddressOf()))) {
+        return {};
+    }
+
+    const uint32_t id = m_RasterizerStates.Add(std::move(state));
+    if (id == 0U) {
+        return {};
+    }
+
+    ++m_FrameStats.StatesCreated;
+
+    return { id };
+}
+
+/// @brief 샘플러를 생성합니다.
+/// @param desc 샘플러 설명
+/// @return 샘플러 핸들 (실패 시 무효 핸들)
+SamplerHandle D3DGraphics::CreateSampler(const SamplerDesc& desc) noexcept {
+    if (!m_Device) {
+        return {};
+    }
+
+    D3D11_SAMPLER_DESC samplerDesc  = {};
+    switch (desc.Filter) {
+        case TextureFilter::Point:          samplerDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_POINT;    break;
+        case TextureFilter::Linear:         samplerDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;   break;
+        case TextureFilter::Anisotropic:    samplerDesc.Filter = D3D11_FILTER_ANISOTROPIC;          break;
+    }
+    samplerDesc.AddressU            = toD3DAddress(desc.AddressU);
+    samplerDesc.AddressV            = toD3DAddress(desc.AddressV);
+    samplerDesc.AddressW            = D3D11_TEXTURE_ADDRESS_CLAMP;
+    samplerDesc.MipLODBias          = 0.0f;
+    samplerDesc.MaxAnisotropy       = std::clamp<UINT>(desc.MaxAnisotropy, 1U, D3D11_REQ_MAXANISOTROPY);
+    samplerDesc.ComparisonFunc      = D3D11_COMPARISON_NEVER;
+    samplerDesc.MinLOD              = 0.0f;
+    samplerDesc.MaxLOD              = D3D11_FLOAT32_MAX;
+
+    Microsoft::WRL::ComPtr<ID3D11SamplerState> state;
+    if (FAILED(m_Device->CreateSamplerState(&samplerDesc, state.GetAddressOf()))) {
+        return {};
+    }
+
+    const uint32_t id = m_Samplers.Add(std::move(state));
+    if (id == 0U) {
+        return {};
+    }
+
+    ++m_FrameStats.StatesCreated;
+
+    return { id };
+}
+
+/// @brief 블렌드 상태를 해제합니다.
+/// @param handle 블렌드 상태 핸들
+void D3DGraphics::DestroyBlendState(BlendStateHandle handle) noexcept {
+    m_BlendStates.Remove(handle.ID);
+}
+
+/// @brief 깊이 스텐실 상태를 해제합니다.
+/// @param handle 깊이 스텐실 상태 핸들
+void D3DGraphics::DestroyDepthStencilState(DepthStencilStateHandle handle) noexcept {
+    m_DepthStencilStates.Remove(handle.ID);
+}
+
+/// @brief 래스터라이저 상태를 해제합니다.
+/// @param handle 래스터라이저 상태 핸들
+void D3DGraphics::DestroyRasterizerState(RasterizerStateHandle handle) noexcept {
+    m_RasterizerStates.Remove(handle.ID);
+}
+
+/// @brief 샘플러를 해제합니다.
+/// @param handle 샘플러 핸들
+void D3DGraphics::DestroySampler(SamplerHandle handle) noexcept {
+    m_Samplers.Remove(handle.ID);
+}
+
+/// @brief 백 버퍼의 설명을 취득합니다.
+/// @return 텍스처 설명 (백 버퍼와 같은 크기, 형식)
+TextureDesc D3DGraphics::GetBackBufferDesc() const noexcept {
+    TextureDesc desc;
+
+    DXGI_SWAP_CHAIN_DESC swapChainDesc = {};
+    if (m_SwapChain && SUCCEEDED(m_SwapChain->GetDesc(&swapChainDesc))) {
+        desc.Width  = static_cast<int32_t>(swapChainDesc.BufferDesc.Width);
+        desc.Height = static_cast<int32_t>(swapChainDesc.BufferDesc.Height);
+        desc.Format = (swapChainDesc.BufferDesc.Format == DXGI_FORMAT_B8G8R8A8_UNORM) ? TextureFormat::BGRA8 : TextureFormat::RGBA8;
+    }
+
+    return desc;
+}
+
+/// @brief 백 버퍼의 내용을 텍스처로 복사합니다.
+/// @param handle 텍스처 핸들 (백 버퍼와 같은 크기, 형식)
+/// @return 성공(true), 실패(false)
+bool D3DGraphics::CopyBackBufferToTexture(TextureHandle handle) noexcept {
+    D3DTexture* resource = m_Textures.Get(handle.ID);
+    if (!resource || !m_SwapChain) {
+        return false;
+    }
+
+    const TextureDesc desc = GetBackBufferDesc();
+    if (resource->Desc.Width != desc.Width || resource->Desc.Height != desc.Height || resource->Desc.Format != desc.Format || resource->Desc.MipLevels != desc.MipLevels) {
+        return false;
+    }
+
+    Microsoft::WRL::ComPtr<ID3D11Texture2D> backBuffer;
+    if (FAILED(m_SwapChain->GetBuffer(0, IID_PPV_ARGS(&backBuffer)))) {
+        return false;
+    }
+
+    m_DeviceContext->CopyResource(resource->Texture.Get(), backBuffer.Get());
+    return true;
+}
+
+/// @brief 텍스처의 내용을 백 버퍼로 복사합니다.
+/// @param handle 텍스처 핸들 (백 버퍼와 같은 크기, 형식)
+/// @return 성공(true), 실패(false)
+/// @note 깊이 스텐실 버퍼는 변경하지 않습니다.
+bool D3DGraphics::CopyTextureToBackBuffer(TextureHandle handle) noexcept {
+    D3DTexture* resource = m_Textures.Get(handle.ID);
+    if (!resource || !m_SwapChain) {
+        return false;
+    }
+
+    const TextureDesc desc = GetBackBufferDesc();
+    if (resource->Desc.Width != desc.Width || resource->Desc.Height != desc.Height || resource->Desc.Format != desc.Format || resource->Desc.MipLevels != desc.MipLevels) {
+        return false;
+    }
+
+    Microsoft::WRL::ComPtr<ID3D11Texture2D> backBuffer;
+    if (FAILED(m_SwapChain->GetBuffer(0, IID_PPV_ARGS(&backBuffer)))) {
+        return false;
+    }
+
+    m_DeviceContext->CopyResource(backBuffer.Get(), resource->Texture.Get());
+    return true;
+}
+
+/// @brief 정점 버퍼를 바인딩합니다.
+/// @param handle 버퍼 핸들 (무효 핸들이면 바인딩 해제)
+void D3DGraphics::SetVertexBuffer(BufferHandle handle) noexcept {
+    D3DBuffer* resource = m_Buffers.Get(handle.ID);
+
+    ID3D11Buffer* buffer    = resource ? resource->Buffer.Get() : nullptr;
+    const UINT stride       = resource ? resource->Desc.Stride : 0U;
+    const UINT offset       = 0U;
+
+    m_DeviceContext->IASetVertexBuffers(0, 1, &buffer, &stride, &offset);
+    ++m_FrameStats.StateChanges;
+}
+
+/// @brief 인덱스 버퍼를 바인딩합니다.
+/// @param handle 버퍼 핸들 (무효 핸들이면 바인딩 해제)
+/// @param format 인덱스 형식
+void D3DGraphics::SetIndexBuffer(BufferHandle handle, IndexFormat format) noexcept {
+    D3DBuffer* resource = m_Buffers.Get(handle.ID);
+
+    m_DeviceContext->IASetIndexBuffer(
+        resource ? resource->Buffer.Get() : nullptr,
+        (format == IndexFormat::UInt16) ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT,
+        0
+    );
+    ++m_FrameStats.StateChanges;
+}
+
+/// @brief 상수 버퍼를 정점/픽셀 셰이더에 바인딩합니다.
+/// @param slot 슬롯
+/// @param handle 버퍼 핸들 (무효 핸들이면 바인딩 해제)
+void D3DGraphics::SetConstantBuffer(uint32_t slot, BufferHandle handle) noexcept {
+    D3DBuffer* resource = m_Buffers.Get(handle.ID);
+    ID3D11Buffer* buffer = resource ? resource->Buffer.Get() : nullptr;
+
+    m_DeviceContext->VSSetConstantBuffers(slot, 1, &buffer);
+    m_DeviceContext->PSSetConstantBuffers(slot, 1, &buffer);
+    ++m_FrameStats.StateChanges;
+}
+
+/// @brief 텍스처를 픽셀 셰이더에 바인딩합니다.
+/// @param slot 슬롯
+/// @param handle 텍스처 핸들 (무효 핸들이면 바인딩 해제)
+void D3DGraphics::SetTexture(uint32_t slot, TextureHandle handle) noexcept {
+    D3DTexture* resource = m_Textures.Get(handle.ID);
+    ID3D11ShaderResourceView* view = resource ? resource->View.Get() : nullptr;
+
+    m_DeviceContext->PSSetShaderResources(slot, 1, &view);
+    ++m_FrameStats.StateChanges;
+}
+
+/// @brief 샘플러를 픽셀 셰이더에 바인딩합니다.
+/// @param slot 슬롯
+/// @param handle 샘플러 핸들 (무효 핸들이면 바인딩 해제)
+void D3DGraphics::SetSampler(uint32_t slot, SamplerHandle handle) noexcept {
+    auto* resource = m_Samplers.Get(handle.ID);
+    ID3D11SamplerState* sampler = resource ? resource->Get() : nullptr;
+
+    m_DeviceContext->PSSetSamplers(slot, 1, &sampler);
+    ++m_FrameStats.StateChanges;
+}
+
+/// @brief 셰이더를 바인딩합니다.
+/// @param stage 단계
+/// @param handle 셰이더 핸들 (무효 핸들이면 바인딩 해제, 단계가 다른 셰이더도 해제로 취급)
+/// @note 정점 셰이더는 입력 배치도 함께 바인딩합니다.
+void D3DGraphics::SetShader(ShaderStage stage, ShaderHandle handle) noexcept {
+    D3DShader* resource = m_Shaders.Get(handle.ID);
+    if (resource && resource->Desc.Stage != stage) {
+        resource = nullptr;
+    }
+
+    if (stage == ShaderStage::Vertex) {
+        m_DeviceContext->VSSetShader(resource ? resource->VertexShader.Get() : nullptr, nullptr, 0);
+        m_DeviceContext->IASetInputLayout(resource ? resource->InputLayout.Get() : nullptr);
+    } else {
+        m_DeviceContext->PSSetShader(resource ? resource->PixelShader.Get() : nullptr, nullptr, 0);
+    }
+    ++m_FrameStats.StateChanges;
+}
+
+/// @brief 블렌드 상태를 바인딩합니다.
+/// @param handle 블렌드 상태 핸들 (무효 핸들이면 기본 상태: 블렌드 없음)
+void D3DGraphics::SetBlendState(BlendStateHandle handle) noexcept {
+    auto* resource = m_BlendStates.Get(handle.ID);
+
+    m_DeviceContext->OMSetBlendState(resource ? resource->Get() : nullptr, nullptr, 0xFFFFFFFF);
+    ++m_FrameStats.StateChanges;
+}
+
+/// @brief 깊이 스텐실 상태를 바인딩합니다.
+/// @param handle 깊이 스텐실 상태 핸들 (무효 핸들이면 초기화 때 만든 기본 상태)
+void D3DGraphics::SetDepthStencilState(DepthStencilStateHandle handle) noexcept {
+    auto* resource = m_DepthStencilStates.Get(handle.ID);
+
+    m_DeviceContext->OMSetDepthStencilState(resource ? resource->Get() : m_DepthStencilState.Get(), 1);
+    ++m_FrameStats.StateChanges;
+}
+
+/// @brief 래스터라이저 상태를 바인딩합니다.
+/// @param handle 래스터라이저 상태 핸들 (무효 핸들이면 초기화 때 만든 기본 상태)
+void D3DGraphics::SetRasterizerState(RasterizerStateHandle handle) noexcept {
+    auto* resource = m_RasterizerStates.Get(handle.ID);
+
+    m_DeviceContext->RSSetState(resource ? resource->Get() : m_RasterState.Get());
+    ++m_FrameStats.StateChanges;
+}
+
+/// @brief 프리미티브 토폴로지를 설정합니다.
+/// @param topology 프리미티브 토폴로지
+void D3DGraphics::SetPrimitiveTopology(PrimitiveTopology topology) noexcept {
+    D3D11_PRIMITIVE_TOPOLOGY d3dTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+    switch (topology) {
+        case PrimitiveTopology::TriangleList:   d3dTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;  break;
+        case PrimitiveTopology::TriangleStrip:  d3dTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP; break;
+        case PrimitiveTopology::LineList:       d3dTopology = D3D11_PRIMITIVE_TOPOLOGY_LINELIST;      break;
+        case PrimitiveTopology::PointList:      d3dTopology = D3D11_PRIMITIVE_TOPOLOGY_POINTLIST;     break;
+    }
+
+    m_DeviceContext->IASetPrimitiveTopology(d3dTopology);
+    ++m_FrameStats.StateChanges;
+}
+
+/// @brief 드로우를 제출합니다.
+/// @param vertexCount 정점 수
+/// @param startVertex 시작 정점
+void D3DGraphics::Draw(uint32_t vertexCount, uint32_t startVertex) noexcept {
+    m_DeviceContext->Draw(vertexCount, startVertex);
+
+    ++m_FrameStats.DrawCalls;
+    m_FrameStats.Vertices += vertexCount;
+}
+
+/// @brief 인덱스 드로우를 제출합니다.
+/// @param indexCount 인덱스 수
+/// @param startIndex 시작 인덱스
+/// @param baseVertex 기준 정점
+void D3DGraphics::DrawIndexed(uint32_t indexCount, uint32_t startIndex, int32_t baseVertex) noexcept {
+    m_DeviceContext->DrawIndexed(indexCount, startIndex, baseVertex);
+
+    ++m_FrameStats.DrawCalls;
+    m_FrameStats.Vertices += indexCount;
+}
+
+/// @brief 마지막으로 완료된 프레임의 통계를 취득합니다.
+/// @return 렌더링 통계
+const RenderStats& D3DGraphics::GetFrameStats() const noexcept {
+    return m_LastFrameStats;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,545 @@
+#include "Graphics/GlbModel.hpp"
+#include "Type/QuaternionF.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+#include <utility>
+
+using namespace graphics;
+using namespace system;
+
+namespace {
+    /// @brief 정렬되지 않은 위치에서 값을 읽습니다.
+    /// @tparam T 값 형식
+    /// @param data 위치
+    /// @return 값
+    template <typename T>
+    T load(const byte_t* data) noexcept {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        return value;
+    }
+
+    /// @brief 성분 크기를 취득합니다.
+    /// @param type 성분 형식
+    /// @return 크기 (바이트 단위, 알 수 없으면 0)
+    uint32_t componentSize(GltfComponentType type) noexcept {
+        switch (type) {
+        case GltfComponentType::Byte:
+        case GltfComponentType::UnsignedByte:
+            return 1U;
+        case GltfComponentType::Short:
+        case GltfComponentType::UnsignedShort:
+            return 2U;
+        case GltfComponentType::UnsignedInt:
+        case GltfComponentType::Float:
+            return 4U;
+        default:
+            return 0U;
+        }
+    }
+
+    /// @brief 요소 종류 문자열을 성분 수로 바꿉니다.
+    /// @param type 요소 종류 ("SCALAR", "VEC2", "VEC3", "VEC4")
+    /// @return 성분 수 (행렬 등 지원하지 않으면 0)
+    uint8_t componentCount(std::string_view type) noexcept {
+        if (type == "SCALAR") {
+            return 1U;
+        }
+        if (type.size() == 4U && type.substr(0U, 3U) == "VEC" && type[3] >= '2' && type[3] <= '4') {
+            return static_cast<uint8_t>(type[3] - '0');
+        }
+        return 0U;
+    }
+
+    /// @brief 접근자 요소를 float로 읽습니다.
+    /// @param accessor 접근자
+    /// @param index 요소 인덱스
+    /// @param out 결과 (성분 count개, 접근자 성분이 부족하면 나머지는 0)
+    /// @param count 읽을 성분 수
+    void readFloats(const GltfAccessor& accessor, uint32_t index, float* out, uint32_t count) noexcept {
+        const byte_t* element = accessor.Data.data() + static_cast<size_t>(index) * accessor.Stride;
+        const uint32_t available = std::min<uint32_t>(count, accessor.Components);
+        for (uint32_t c = 0U; c < available; ++c) {
+            switch (accessor.ComponentType) {
+            case GltfComponentType::Float:
+                out[c] = load<float>(element + c * 4U);
+                break;
+            case GltfComponentType::Byte: {
+                const float value = static_cast<float>(load<int8_t>(element + c));
+                out[c] = accessor.Normalized ? std::max(value / 127.0f, -1.0f) : value;
+                break;
+            }
+            case GltfComponentType::UnsignedByte: {
+                const float value = static_cast<float>(load<uint8_t>(element + c));
+                out[c] = accessor.Normalized ? value / 255.0f : value;
+                break;
+            }
+            case GltfComponentType::Short: {
+                const float value = static_cast<float>(load<int16_t>(element + c * 2U));
+                out[c] = accessor.Normalized ? std::max(value / 32767.0f, -1.0f) : value;
+                break;
+            }
+            case GltfComponentType::UnsignedShort: {
+                const float value = static_cast<float>(load<uint16_t>(element + c * 2U));
+                out[c] = accessor.Normalized ? value / 65535.0f : value;
+                break;
+            }
+            case GltfComponentType::UnsignedInt:
+                out[c] = static_cast<float>(load<uint32_t>(element + c * 4U));
+                break;
+            default:
+                out[c] = 0.0f;
+                break;
+            }
+        }
+        for (uint32_t c = available; c < count; ++c) {
+            out[c] = 0.0f;
+        }
+    }
+
+    /// @brief 인덱스 접근자 요소를 읽습니다.
+    /// @param accessor 접근자 (UNSIGNED_BYTE, UNSIGNED_SHORT, UNSIGNED_INT 스칼라)
+    /// @param index 요소 인덱스
+    /// @return 인덱스
+    uint32_t readIndex(const GltfAccessor& accessor, uint32_t index) noexcept {
+        const byte_t* element = accessor.Data.data() + static_cast<size_t>(index) * accessor.Stride;
+        switch (accessor.ComponentType) {
+        case GltfComponentType::UnsignedByte:
+            return load<uint8_t>(element);
+        case GltfComponentType::UnsignedShort:
+            return load<uint16_t>(element);
+        default:
+            return load<uint32_t>(element);
+        }
+    }
+
+    /// @brief 접근자가 쓸 수 있는 상태인지 확인합니다.
+    /// @param accessors 접근자 목록
+    /// @param index 접근자 인덱스
+    /// @param count 필요한 요소 수 (0: 검사하지 않음)
+    /// @return 접근자 (쓸 수 없으면 nullptr)
+    const GltfAccessor* findAccessor(std::span<const GltfAccessor> accessors, int32_t index, uint32_t count) noexcept {
+        if (index < 0 || static_cast<size_t>(index) >= accessors.size()) {
+            return nullptr;
+        }
+        const GltfAccessor& accessor = accessors[static_cast<size_t>(index)];
+        if (accessor.Data.empty() || (count != 0U && accessor.Count != count)) {
+            return nullptr;
+        }
+        return &accessor;
+    }
+
+    /// @brief JSON 인덱스 값을 읽습니다.
+    /// @param value 값
+    /// @return 인덱스 (없으면 -1)
+    int32_t toIndex(const JsonValue& value) noexcept {
+        return value.GetInt(-1);
+    }
+}
+
+/// @brief 생성자
+GlbModel::GlbModel() noexcept : m_File(), m_ExternalFiles(), m_Json(), m_Buffers(), m_BufferViews(), m_Accessors(), m_Primitives(), m_Meshes(), m_Materials(), m_Images(), m_Nodes() {
+
+}
+
+/// @brief 버퍼와 버퍼 뷰를 읽습니다.
+/// @param root JSON 루트
+/// @param bin GLB 바이너리 청크 (.gltf면 비어있음)
+/// @param directory 외부 버퍼를 찾을 폴더 (끝에 구분자 포함, 비어있으면 현재 폴더)
+void GlbModel::parseBuffers(const JsonValue& root, std::span<const byte_t> bin, const std::string& directory) noexcept {
+    const JsonValue& buffers = root["buffers"];
+    m_Buffers.resize(buffers.GetSize());
+    for (uint32_t i = 0U; i < buffers.GetSize(); ++i) {
+        const JsonValue& buffer = buffers[i];
+        const size_t length = static_cast<size_t>(buffer["byteLength"].GetNumber());
+        const std::string_view uri = buffer["uri"].GetString();
+
+        std::span<const byte_t> data;
+        if (uri.empty()) {
+            data = bin;
+        }
+        else if (uri.substr(0U, 5U) != "data:") {
+            MappedFile file;
+            if (file.Open(directory + std::string(uri))) {
+                data = { file.GetData(), file.GetSize() };
+                m_ExternalFiles.push_back(std::move(file));
+            }
+        }
+        m_Buffers[i] = (length <= data.size()) ? data.first(length) : std::span<const byte_t>();
+    }
+
+    const JsonValue& views = root["bufferViews"];
+    m_BufferViews.resize(views.GetSize());
+    for (uint32_t i = 0U; i < views.GetSize(); ++i) {
+        const JsonValue& view = views[i];
+        const int32_t buffer = toIndex(view["buffer"]);
+        const size_t offset = static_cast<size_t>(view["byteOffset"].GetNumber());
+        const size_t length = static_cast<size_t>(view["byteLength"].GetNumber());
+
+        GltfBufferView& result = m_BufferViews[i];
+        result.Stride = view["byteStride"].GetUint();
+        if (buffer >= 0 && static_cast<size_t>(buffer) < m_Buffers.size() && offset <= m_Buffers[buffer].size() && length <= m_Buffers[buffer].size() - offset) {
+            result.Data = m_Buffers[buffer].subspan(offset, length);
+        }
+    }
+}
+
+/// @brief 접근자를 읽습니다.
+/// @param root JSON 루트
+/// @note 요소 범위가 버퍼 뷰를 벗어나면 Data를 비워서, 이후에는 범위 검사 없이 읽을 수 있게 합니다.
+void GlbModel::parseAccessors(const JsonValue& root) noexcept {
+    const JsonValue& accessors = root["accessors"];
+    m_Accessors.resize(accessors.GetSize());
+    for (uint32_t i = 0U; i < accessors.GetSize(); ++i) {
+        const JsonValue& accessor = accessors[i];
+        GltfAccessor& result = m_Accessors[i];
+        result.Count = accessor["count"].GetUint();
+        result.ComponentType = static_cast<GltfComponentType>(accessor["componentType"].GetUint());
+        result.Components = componentCount(accessor["type"].GetString());
+        result.Normalized = accessor["normalized"].GetBool();
+
+        const uint32_t elementSize = componentSize(result.ComponentType) * result.Components;
+        const int32_t view = toIndex(accessor["bufferView"]);
+        if (elementSize == 0U || result.Count == 0U || view < 0 || static_cast<size_t>(view) >= m_BufferViews.size() || !accessor["sparse"].IsNull()) {
+            continue;
+        }
+
+        const GltfBufferView& bufferView = m_BufferViews[view];
+        result.Stride = (bufferView.Stride != 0U) ? bufferView.Stride : elementSize;
+        const size_t offset = static_cast<size_t>(accessor["byteOffset"].GetNumber());
+        const size_t span = static_cast<size_t>(result.Count - 1U) * result.Stride + elementSize;
+        if (offset <= bufferView.Data.size() && span <= bufferView.Data.size() - offset) {
+            result.Data = bufferView.Data.subspan(offset, span);
+        }
+    }
+}
+
+/// @brief 메시와 프리미티브를 읽습니다.
+/// @param root JSON 루트
+void GlbModel::parseMeshes(const JsonValue& root) noexcept {
+    const JsonValue& meshes = root["meshes"];
+    m_Meshes.resize(meshes.GetSize());
+    for (uint32_t i = 0U; i < meshes.GetSize(); ++i) {
+        const JsonValue& mesh = meshes[i];
+        const JsonValue& primitives = mesh["primitives"];
+        m_Meshes[i] = { mesh["name"].GetString(), static_cast<uint32_t>(m_Primitives.size()), primitives.GetSize() };
+
+        for (uint32_t p = 0U; p < primitives.GetSize(); ++p) {
+            const JsonValue& primitive = primitives[p];
+            const JsonValue& attributes = primitive["attributes"];
+            m_Primitives.push_back({
+                toIndex(attributes["POSITION"]),
+                toIndex(attributes["NORMAL"]),
+                toIndex(attributes["TEXCOORD_0"]),
+                toIndex(primitive["indices"]),
+                toIndex(primitive["material"]),
+                static_cast<uint8_t>(primitive["mode"].GetUint(4U))
+            });
+        }
+    }
+}
+
+/// @brief 재질과 이미지를 읽습니다.
+/// @param root JSON 루트
+void GlbModel::parseMaterials(const JsonValue& root) noexcept {
+    const JsonValue& images = root["images"];
+    m_Images.resize(images.GetSize());
+    for (uint32_t i = 0U; i < images.GetSize(); ++i) {
+        const JsonValue& image = images[i];
+        GltfImage& result = m_Images[i];
+        result.Uri = image["uri"].GetString();
+        result.MimeType = image["mimeType"].GetString();
+
+        const int32_t view = toIndex(image["bufferView"]);
+        if (view >= 0 && static_cast<size_t>(view) < m_BufferViews.size()) {
+            result.Data = m_BufferViews[view].Data;
+        }
+    }
+
+    const JsonValue& textures = root["textures"];
+    const JsonValue& materials = root["materials"];
+    m_Materials.resize(materials.GetSize());
+    for (uint32_t i = 0U; i < materials.GetSize(); ++i) {
+        const JsonValue& material = materials[i];
+        const JsonValue& pbr = material["pbrMetallicRoughness"];
+        const JsonValue& color = pbr["baseColorFactor"];
+
+        GltfMaterial& result = m_Materials[i];
+        result.Name = material["name"].GetString();
+        for (uint32_t c = 0U; c < 4U; ++c) {
+            result.BaseColor[c] = color[c].GetFloat(1.0f);
+        }
+
+        // 재질은 텍스처를, 텍스처는 이미지를 가리키므로 이미지 인덱스까지 풀어둡니다.
+        const int32_t texture = toIndex(pbr["baseColorTexture"]["index"]);
+        const int32_t image = (texture >= 0) ? toIndex(textures[static_cast<size_t>(texture)]["source"]) : -1;
+        result.BaseColorImage = (image >= 0 && static_cast<size_t>(image) < m_Images.size()) ? image : -1;
+    }
+}
+
+/// @brief 노드를 읽습니다.
+/// @param root JSON 루트
+/// @note glTF 행렬은 열 우선 열 벡터 규약이므로, 원소를 순서대로 읽으면 그대로 행 우선 행 벡터 규약의 행렬이 됩니다.
+void GlbModel::parseNodes(const JsonValue& root) noexcept {
+    const JsonValue& nodes = root["nodes"];
+    m_Nodes.resize(nodes.GetSize());
+    for (GltfNode& node : m_Nodes) {
+        node.Parent = -1;
+    }
+
+    for (uint32_t i = 0U; i < nodes.GetSize(); ++i) {
+        const JsonValue& node = nodes[i];
+        GltfNode& result = m_Nodes[i];
+        result.Name = node["name"].GetString();
+        result.Mesh = toIndex(node["mesh"]);
+
+        const JsonValue& matrix = node["matrix"];
+        if (matrix.GetSize() == 16U) {
+            for (uint32_t k = 0U; k < 16U; ++k) {
+                result.Local.M[k / 4U][k % 4U] = matrix[k].GetFloat();
+            }
+        }
+        else {
+            // 행 벡터 규약에서 T * R * S 순서는 S * R * T가 됩니다.
+            const JsonValue& s = node["scale"];
+            const JsonValue& r = node["rotation"];
+            const JsonValue& t = node["translation"];
+            const QuaternionF rotation(r[0].GetFloat(0.0f), r[1].GetFloat(0.0f), r[2].GetFloat(0.0f), r[3].GetFloat(1.0f));
+            result.Local = Matrix4x4F::Scaling({ s[0].GetFloat(1.0f), s[1].GetFloat(1.0f), s[2].GetFloat(1.0f) })
+                * rotation.ToMatrix()
+                * Matrix4x4F::Translation({ t[0].GetFloat(), t[1].GetFloat(), t[2].GetFloat() });
+        }
+
+        const JsonValue& children = node["children"];
+        for (uint32_t c = 0U; c < children.GetSize(); ++c) {
+            const int32_t child = toIndex(children[c]);
+            if (child >= 0 && static_cast<size_t>(child) < m_Nodes.size()) {
+                m_Nodes[child].Parent = static_cast<int32_t>(i);
+            }
+        }
+    }
+}
+
+/// @brief GLB 또는 .gltf 내용을 파싱합니다.
+/// @param data 내용
+/// @param size 크기
+/// @param directory 외부 버퍼를 찾을 폴더
+/// @return 성공(true), 실패(false)
+bool GlbModel::parse(const byte_t* data, size_t size, const std::string& directory) noexcept {
+    const char* json = reinterpret_cast<const char*>(data);
+    size_t jsonSize = size;
+    std::span<const byte_t> bin;
+
+    if (size >= 12U && load<uint32_t>(data) == MAGIC) {
+        // 헤더(12) + JSON 청크 헤더(8) + JSON, 그 뒤 4바이트 정렬된 위치에 선택적인 BIN 청크가 옵니다.
+        const uint32_t length = load<uint32_t>(data + 8U);
+        if (load<uint32_t>(data + 4U) != VERSION || length > size || length < 20U) {
+            return false;
+        }
+
+        const uint32_t jsonLength = load<uint32_t>(data + 12U);
+        if (load<uint32_t>(data + 16U) != CHUNK_JSON || jsonLength > length - 20U) {
+            return false;
+        }
+        json = reinterpret_cast<const char*>(data + 20U);
+        jsonSize = jsonLength;
+
+        const size_t binOffset = 20U + ((static_cast<size_t>(jsonLength) + 3U) & ~static_cast<size_t>(3U));
+        if (binOffset + 8U <= length && load<uint32_t>(data + binOffset + 4U) == CHUNK_BIN) {
+            const uint32_t binLength = load<uint32_t>(data + binOffset);
+            if (binLength <= length - binOffset - 8U) {
+                bin = { data + binOffset + 8U, binLength };
+            }
+        }
+    }
+
+    if (!m_Json.Parse(json, jsonSize)) {
+        return false;
+    }
+    const JsonValue& root = m_Json.GetRoot();
+    if (root["asset"]["version"].GetString().substr(0U, 2U) != "2.") {
+        return false;
+    }
+
+    parseBuffers(root, bin, directory);
+    parseAccessors(root);
+    parseMeshes(root);
+    parseMaterials(root);
+    parseNodes(root);
+    return true;
+}
+
+/// @brief 파일을 매핑하여 모델을 읽습니다.
+/// @param path 파일 경로 (.glb 또는 .gltf)
+/// @return 성공(true), 실패(false: 모델은 비워짐)
+bool GlbModel::Load(const std::string& path) noexcept {
+    Clear();
+    if (!m_File.Open(path)) {
+        return false;
+    }
+
+    const size_t separator = path.find_last_of("/\\");
+    const std::string directory = (separator == std::string::npos) ? std::string() : path.substr(0U, separator + 1U);
+    if (!parse(m_File.GetData(), m_File.GetSize(), directory)) {
+        Clear();
+        return false;
+    }
+    return true;
+}
+
+/// @brief 메모리에 있는 모델을 읽습니다.
+/// @param data 내용 (모델보다 오래 살아있어야 함)
+/// @param size 크기
+/// @return 성공(true), 실패(false: 모델은 비워짐)
+bool GlbModel::Parse(const void* data, size_t size) noexcept {
+    Clear();
+    if (!parse(static_cast<const byte_t*>(data), size, {})) {
+        Clear();
+        return false;
+    }
+    return true;
+}
+
+/// @brief 모델을 비웁니다.
+void GlbModel::Clear() noexcept {
+    m_Nodes.clear();
+    m_Images.clear();
+    m_Materials.clear();
+    m_Meshes.clear();
+    m_Primitives.clear();
+    m_Accessors.clear();
+    m_BufferViews.clear();
+    m_Buffers.clear();
+    m_Json.Clear();
+    m_ExternalFiles.clear();
+    m_File.Close();
+}
+
+/// @brief 메시를 업로드할 수 있는 형태로 변환합니다.
+/// @param meshIndex 메시 인덱스
+/// @param mesh 결과 (정점 교차 배치, 32비트 삼각형 목록, 프리미티브마다 범위 하나)
+/// @param options 변환 옵션
+/// @return 성공(true), 실패(false: 메시가 없거나 그릴 삼각형이 없거나 인덱스가 범위를 벗어남)
+/// @note 위치가 없거나 삼각형이 아닌 프리미티브는 건너뜁니다. 노멀, 텍스처 좌표가 없으면 0으로 채웁니다.
+bool GlbModel::BuildMesh(uint32_t meshIndex, MeshData& mesh, const GltfMeshOptions& options) const noexcept {
+    mesh.Vertices.clear();
+    mesh.Indices.clear();
+    mesh.Subsets.clear();
+    mesh.Min = { FLT_MAX, FLT_MAX, FLT_MAX };
+    mesh.Max = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+    if (meshIndex >= m_Meshes.size()) {
+        return false;
+    }
+
+    const float flip = options.LeftHanded ? -1.0f : 1.0f;
+    std::vector<uint32_t> source;
+    const GltfMesh& gltfMesh = m_Meshes[meshIndex];
+    for (uint32_t p = gltfMesh.FirstPrimitive; p < gltfMesh.FirstPrimitive + gltfMesh.PrimitiveCount; ++p) {
+        const GltfPrimitive& primitive = m_Primitives[p];
+        const GltfAccessor* position = findAccessor(m_Accessors, primitive.Position, 0U);
+        if (primitive.Mode < 4U || primitive.Mode > 6U || !position || position->Components < 3U) {
+            continue;
+        }
+
+        const uint32_t vertexCount = position->Count;
+        const GltfAccessor* normal = findAccessor(m_Accessors, primitive.Normal, vertexCount);
+        const GltfAccessor* texCoord = findAccessor(m_Accessors, primitive.TexCoord, vertexCount);
+
+        // 인덱스를 먼저 읽어 범위를 검사합니다.
+        source.clear();
+        if (primitive.Indices >= 0) {
+            const GltfAccessor* indices = findAccessor(m_Accessors, primitive.Indices, 0U);
+            if (!indices || indices->Components != 1U || indices->ComponentType == GltfComponentType::Float || indices->ComponentType == GltfComponentType::Byte || indices->ComponentType == GltfComponentType::Short) {
+                return false;
+            }
+            source.resize(indices->Count);
+            for (uint32_t i = 0U; i < indices->Count; ++i) {
+                source[i] = readIndex(*indices, i);
+                if (source[i] >= vertexCount) {
+                    return false;
+                }
+            }
+        }
+        else {
+            source.resize(vertexCount);
+            for (uint32_t i = 0U; i < vertexCount; ++i) {
+                source[i] = i;
+            }
+        }
+
+        const uint32_t base = static_cast<uint32_t>(mesh.Vertices.size());
+        const uint32_t start = static_cast<uint32_t>(mesh.Indices.size());
+        const size_t count = source.size();
+        if (primitive.Mode == 4U) {
+            for (size_t i = 0U; i + 2U < count; i += 3U) {
+                mesh.Indices.insert(mesh.Indices.end(), { base + source[i], base + source[i + 1U], base + source[i + 2U] });
+            }
+        }
+        else if (primitive.Mode == 5U) {
+            // 스트립은 홀수 번째 삼각형의 감는 방향이 반대이므로 앞 두 정점을 바꿔 맞춥니다.
+            for (size_t i = 0U; i + 2U < count; ++i) {
+                const uint32_t a = source[i + (i & 1U)];
+                const uint32_t b = source[i + 1U - (i & 1U)];
+                mesh.Indices.insert(mesh.Indices.end(), { base + a, base + b, base + source[i + 2U] });
+            }
+        }
+        else {
+            for (size_t i = 1U; i + 1U < count; ++i) {
+                mesh.Indices.insert(mesh.Indices.end(), { base + source[0], base + source[i], base + source[i + 1U] });
+            }
+        }
+
+        const uint32_t indexCount = static_cast<uint32_t>(mesh.Indices.size()) - start;
+        if (indexCount == 0U) {
+            continue;
+        }
+        if (options.LeftHanded) {
+            // Z를 뒤집어도 화면에 보이는 감는 방향은 그대로이므로, 시계 방향 앞면(D3D 기본)에 맞게 뒤집습니다.
+            for (uint32_t i = start; i < start + indexCount; i += 3U) {
+                std::swap(mesh.Indices[i + 1U], mesh.Indices[i + 2U]);
+            }
+        }
+        mesh.Subsets.push_back({ start, indexCount, primitive.Material });
+
+        mesh.Vertices.resize(base + vertexCount);
+        for (uint32_t v = 0U; v < vertexCount; ++v) {
+            MeshVertex& vertex = mesh.Vertices[base + v];
+            float value[3];
+            readFloats(*position, v, value, 3U);
+            vertex.X = value[0];
+            vertex.Y = value[1];
+            vertex.Z = value[2] * flip;
+
+            if (normal) {
+                readFloats(*normal, v, value, 3U);
+                vertex.NX = value[0];
+                vertex.NY = value[1];
+                vertex.NZ = value[2] * flip;
+            }
+            else {
+                vertex.NX = vertex.NY = vertex.NZ = 0.0f;
+            }
+
+            if (texCoord) {
+                readFloats(*texCoord, v, value, 2U);
+                vertex.U = value[0];
+                vertex.V = value[1];
+            }
+            else {
+                vertex.U = vertex.V = 0.0f;
+            }
+
+            mesh.Min = { std::min(mesh.Min.X, vertex.X), std::min(mesh.Min.Y, vertex.Y), std::min(mesh.Min.Z, vertex.Z) };
+            mesh.Max = { std::max(mesh.Max.X, vertex.X), std::max(mesh.Max.Y, vertex.Y), std::max(mesh.Max.Z, vertex.Z) };
+        }
+    }
+
+    if (mesh.Indices.empty()) {
+        return false;
+    }
+    if (options.OptimizeVertexCache) {
+        MeshOptimizer::Optimize(mesh);
+    }
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,305 @@
+#include "Graphics/MeshCooker.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace graphics;
+
+namespace {
+    /// @brief 정수 크기를 정렬합니다.
+    inline uint64_t alignUp(uint64_t value, uint64_t alignment) noexcept {
+        return (value + alignment - 1U) & ~(alignment - 1U);
+    }
+
+    /// @brief float를 반정밀도 부동소수점으로 바꿉니다. (가장 가까운 값으로 반올림, 범위를 넘으면 최댓값)
+    /// @param value 값
+    /// @return 반정밀도 값
+    uint16_t toHalf(float value) noexcept {
+        uint32_t bits = 0U;
+        std::memcpy(&bits, &value, sizeof(bits));
+        const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000U);
+        const uint32_t magnitude = bits & 0x7FFFFFFFU;
+        if (magnitude > 0x7F800000U) {
+            return sign | 0x7E00U;
+        }
+        if (magnitude == 0x7F800000U) {
+            return sign | 0x7C00U;
+        }
+
+        const int32_t exponent = static_cast<int32_t>(magnitude >> 23) - 127 + 15;
+        uint32_t mantissa = magnitude & 0x7FFFFFU;
+        if (exponent >= 31) {
+            return sign | 0x7BFFU;
+        }
+        if (exponent <= 0) {
+            // 비정규 수
+            if (exponent < -10) {
+                return sign;
+            }
+            mantissa |= 0x800000U;
+            const uint32_t shift = static_cast<uint32_t>(14 - exponent);
+            const uint32_t half = (mantissa >> shift) + ((mantissa >> (shift - 1U)) & 1U);
+            return sign | static_cast<uint16_t>(half);
+        }
+
+        // 반올림 자리올림이 지수로 넘어가도 올바른 값이 되며, 최댓값을 넘으면 최댓값으로 둡니다.
+        const uint32_t half = ((static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13)) + ((mantissa >> 12) & 1U);
+        return sign | static_cast<uint16_t>(std::min(half, 0x7BFFU));
+    }
+
+    /// @brief 반정밀도 부동소수점을 float로 바꿉니다.
+    /// @param half 반정밀도 값
+    /// @return 값
+    float fromHalf(uint16_t half) noexcept {
+        const uint32_t sign = static_cast<uint32_t>(half & 0x8000U) << 16;
+        const uint32_t exponent = (half >> 10) & 0x1FU;
+        const uint32_t mantissa = half & 0x3FFU;
+
+        float value = 0.0f;
+        if (exponent == 0U) {
+            value = std::ldexp(static_cast<float>(mantissa), -24);
+        }
+        else if (exponent == 31U) {
+            value = (mantissa == 0U) ? INFINITY : NAN;
+        }
+        else {
+            value = std::ldexp(static_cast<float>(mantissa | 0x400U), static_cast<int32_t>(exponent) - 25);
+        }
+
+        uint32_t bits = 0U;
+        std::memcpy(&bits, &value, sizeof(bits));
+        bits |= sign;
+        std::memcpy(&value, &bits, sizeof(bits));
+        return value;
+    }
+
+    /// @brief [-1, 1] 값을 10비트 UNORM으로 바꿉니다.
+    /// @param value 값
+    /// @return 10비트 값
+    uint32_t toUnorm10(float value) noexcept {
+        return static_cast<uint32_t>(std::lround((std::clamp(value, -1.0f, 1.0f) * 0.5f + 0.5f) * 1023.0f));
+    }
+}
+
+/// @brief 정점을 양자화합니다.
+/// @param vertex 정점
+/// @param offset 위치 오프셋 (경계 상자 최소 좌표, 3개)
+/// @param inverseScale 위치 배율의 역수 (65535 / 경계 상자 크기, 3개)
+/// @return 쿠킹된 정점
+CookedMeshVertex MeshCooker::EncodeVertex(const MeshVertex& vertex, const float* offset, const float* inverseScale) noexcept {
+    const auto quantize = [](float value, float base, float inverse) noexcept {
+        return static_cast<uint16_t>(std::clamp(std::lround((value - base) * inverse), 0L, 65535L));
+    };
+
+    CookedMeshVertex result;
+    result.X        = quantize(vertex.X, offset[0], inverseScale[0]);
+    result.Y        = quantize(vertex.Y, offset[1], inverseScale[1]);
+    result.Z        = quantize(vertex.Z, offset[2], inverseScale[2]);
+    result.W        = 0xFFFFU;
+    result.Normal   = toUnorm10(vertex.NX) | (toUnorm10(vertex.NY) << 10) | (toUnorm10(vertex.NZ) << 20) | (3U << 30);
+    result.U        = toHalf(vertex.U);
+    result.V        = toHalf(vertex.V);
+    return result;
+}
+
+/// @brief 쿠킹된 정점을 되돌립니다.
+/// @param vertex 쿠킹된 정점
+/// @param header 파일 헤더
+/// @return 정점 (노멀은 양자화 오차로 길이가 1이 아닐 수 있음)
+MeshVertex MeshCooker::DecodeVertex(const CookedMeshVertex& vertex, const CookedMeshHeader& header) noexcept {
+    const auto unorm10 = [](uint32_t value) noexcept {
+        return static_cast<float>(value & 0x3FFU) / 1023.0f * 2.0f - 1.0f;
+    };
+
+    MeshVertex result;
+    result.X    = header.PositionOffset[0] + static_cast<float>(vertex.X) * header.PositionScale[0];
+    result.Y    = header.PositionOffset[1] + static_cast<float>(vertex.Y) * header.PositionScale[1];
+    result.Z    = header.PositionOffset[2] + static_cast<float>(vertex.Z) * header.PositionScale[2];
+    result.NX   = unorm10(vertex.Normal);
+    result.NY   = unorm10(vertex.Normal >> 10);
+    result.NZ   = unorm10(vertex.Normal >> 20);
+    result.U    = fromHalf(vertex.U);
+    result.V    = fromHalf(vertex.V);
+    return result;
+}
+
+/// @brief 메시를 쿠킹합니다.
+/// @param mesh 원본 메시 (BuildMesh 등으로 만든 삼각형 목록)
+/// @param options 쿠킹 옵션
+/// @param cooked 결과 (헤더 + 정점 + 인덱스 + LOD + 범위)
+/// @return 성공(true), 실패(false: 메시가 비어있음)
+bool MeshCooker::Cook(const MeshData& mesh, const MeshCookOptions& options, std::vector<byte_t>& cooked) noexcept {
+    if (mesh.Vertices.empty() || mesh.Indices.empty() || mesh.Subsets.empty() || mesh.Vertices.size() > UINT32_MAX) {
+        return false;
+    }
+
+    const uint32_t lodLimit = std::clamp(options.LodCount, 1U, MAX_LODS);
+    std::vector<MeshVertex> vertices = mesh.Vertices;
+
+    // 0단계: 원본 범위마다 정점 캐시, 오버드로 순서로 정렬합니다.
+    std::vector<std::vector<uint32_t>> lodIndices(1U);
+    std::vector<std::vector<MeshSubset>> lodSubsets(1U);
+    std::vector<float> lodErrors(1U, 0.0f);
+    for (const MeshSubset& subset : mesh.Subsets) {
+        std::vector<uint32_t>& indices = lodIndices[0];
+        const uint32_t start = static_cast<uint32_t>(indices.size());
+        indices.insert(indices.end(), mesh.Indices.begin() + subset.StartIndex, mesh.Indices.begin() + subset.StartIndex + subset.IndexCount);
+
+        MeshOptimizer::OptimizeVertexCache(indices.data() + start, subset.IndexCount, vertices.size());
+        if (options.OptimizeOverdraw) {
+            MeshOptimizer::OptimizeOverdraw(indices.data() + start, subset.IndexCount, vertices.data(), vertices.size(), options.OverdrawThreshold);
+        }
+        lodSubsets[0].push_back({ start, subset.IndexCount, subset.Material });
+    }
+
+    // 다음 단계는 이전 단계를 단순화해 만들고, 삼각형이 충분히 줄지 않으면 멈춥니다.
+    std::vector<uint32_t> simplified;
+    while (lodIndices.size() < lodLimit) {
+        const std::vector<uint32_t>& previous = lodIndices.back();
+        std::vector<uint32_t> indices;
+        std::vector<MeshSubset> subsets;
+        float error = 0.0f;
+
+        for (const MeshSubset& subset : lodSubsets.back()) {
+            const size_t target = static_cast<size_t>(static_cast<float>(subset.IndexCount / 3U) * options.LodReduction) * 3U;
+            simplified.resize(subset.IndexCount);
+            float subsetError = 0.0f;
+            const size_t count = MeshOptimizer::Simplify(simplified.data(), previous.data() + subset.StartIndex, subset.IndexCount, vertices.data(), vertices.size(), target, options.LodMaxError, &subsetError);
+            if (count == 0U) {
+                continue;
+            }
+
+            MeshOptimizer::OptimizeVertexCache(simplified.data(), count, vertices.size());
+            subsets.push_back({ static_cast<uint32_t>(indices.size()), static_cast<uint32_t>(count), subset.Material });
+            indices.insert(indices.end(), simplified.begin(), simplified.begin() + static_cast<ptrdiff_t>(count));
+            error = std::max(error, subsetError);
+        }
+
+        if (indices.empty() || indices.size() * 10U > previous.size() * 9U) {
+            break;
+        }
+        lodIndices.push_back(std::move(indices));
+        lodSubsets.push_back(std::move(subsets));
+        lodErrors.push_back(lodErrors.back() + error);
+    }
+
+    // 모든 단계를 이어 붙이고, 0단계가 앞쪽 정점을 쓰도록 처음 쓰이는 순서로 정점을 배치합니다.
+    std::vector<uint32_t> indices;
+    std::vector<MeshSubset> subsets;
+    std::vector<CookedMeshLod> lods;
+    for (size_t lod = 0U; lod < lodIndices.size(); ++lod) {
+        lods.push_back({ static_cast<uint32_t>(subsets.size()), static_cast<uint32_t>(lodSubsets[lod].size()), lodErrors[lod], static_cast<uint32_t>(lodIndices[lod].size()) });
+        for (MeshSubset subset : lodSubsets[lod]) {
+            subset.StartIndex += static_cast<uint32_t>(indices.size());
+            subsets.push_back(subset);
+        }
+        indices.insert(indices.end(), lodIndices[lod].begin(), lodIndices[lod].end());
+    }
+    vertices.resize(MeshOptimizer::OptimizeVertexFetch(vertices.data(), vertices.size(), sizeof(MeshVertex), indices.data(), indices.size()));
+
+    float minimum[3] = { vertices[0].X, vertices[0].Y, vertices[0].Z };
+    float maximum[3] = { vertices[0].X, vertices[0].Y, vertices[0].Z };
+    for (const MeshVertex& vertex : vertices) {
+        const float position[3] = { vertex.X, vertex.Y, vertex.Z };
+        for (uint32_t axis = 0U; axis < 3U; ++axis) {
+            minimum[axis] = std::min(minimum[axis], position[axis]);
+            maximum[axis] = std::max(maximum[axis], position[axis]);
+        }
+    }
+
+    CookedMeshHeader header = {};
+    header.Magic        = MAGIC;
+    header.Version      = VERSION;
+    header.VertexCount  = static_cast<uint32_t>(vertices.size());
+    header.VertexStride = sizeof(CookedMeshVertex);
+    header.IndexCount   = static_cast<uint32_t>(indices.size());
+    header.IndexFormat  = static_cast<uint32_t>((vertices.size() <= 65536U) ? IndexFormat::UInt16 : IndexFormat::UInt32);
+    header.LodCount     = static_cast<uint32_t>(lods.size());
+    header.SubsetCount  = static_cast<uint32_t>(subsets.size());
+
+    float inverseScale[3];
+    for (uint32_t axis = 0U; axis < 3U; ++axis) {
+        const float extent = maximum[axis] - minimum[axis];
+        header.PositionOffset[axis] = minimum[axis];
+        header.PositionScale[axis]  = extent / 65535.0f;
+        inverseScale[axis]          = (extent > 0.0f) ? 65535.0f / extent : 0.0f;
+    }
+
+    const size_t indexSize = (header.IndexFormat == static_cast<uint32_t>(IndexFormat::UInt16)) ? 2U : 4U;
+    header.VertexOffset = alignUp(sizeof(CookedMeshHeader), DATA_ALIGNMENT);
+    header.IndexOffset  = alignUp(header.VertexOffset + static_cast<uint64_t>(header.VertexCount) * sizeof(CookedMeshVertex), DATA_ALIGNMENT);
+    header.LodOffset    = alignUp(header.IndexOffset + static_cast<uint64_t>(header.IndexCount) * indexSize, DATA_ALIGNMENT);
+    header.SubsetOffset = alignUp(header.LodOffset + sizeof(CookedMeshLod) * lods.size(), DATA_ALIGNMENT);
+
+    cooked.assign(static_cast<size_t>(header.SubsetOffset + sizeof(MeshSubset) * subsets.size()), 0U);
+    std::memcpy(cooked.data(), &header, sizeof(header));
+
+    byte_t* vertexData = cooked.data() + header.VertexOffset;
+    for (const MeshVertex& vertex : vertices) {
+        const CookedMeshVertex encoded = EncodeVertex(vertex, minimum, inverseScale);
+        std::memcpy(vertexData, &encoded, sizeof(encoded));
+        vertexData += sizeof(encoded);
+    }
+
+    byte_t* indexData = cooked.data() + header.IndexOffset;
+    if (indexSize == 2U) {
+        for (const uint32_t index : indices) {
+            const uint16_t narrow = static_cast<uint16_t>(index);
+            std::memcpy(indexData, &narrow, sizeof(narrow));
+            indexData += sizeof(narrow);
+        }
+    }
+    else {
+        std::memcpy(indexData, indices.data(), indices.size() * sizeof(uint32_t));
+    }
+
+    std::memcpy(cooked.data() + header.LodOffset, lods.data(), sizeof(CookedMeshLod) * lods.size());
+    std::memcpy(cooked.data() + header.SubsetOffset, subsets.data(), sizeof(MeshSubset) * subsets.size());
+    return true;
+}
+
+/// @brief 쿠킹된 메시의 헤더를 읽고 검증합니다.
+/// @param cooked 쿠킹된 메시 (파일 내용)
+/// @param size 크기
+/// @param header 결과
+/// @return 유효(true), 무효(false: 식별자, 버전, 배열 범위가 맞지 않음)
+/// @note 배열 범위와 LOD, 범위 테이블만 검사하며 인덱스 값은 쿠커가 만든 그대로 믿습니다.
+bool MeshCooker::ReadHeader(const void* cooked, size_t size, CookedMeshHeader& header) noexcept {
+    if (!cooked || size < sizeof(CookedMeshHeader)) {
+        return false;
+    }
+    std::memcpy(&header, cooked, sizeof(header));
+
+    if (header.Magic != MAGIC || header.Version != VERSION || header.VertexStride != sizeof(CookedMeshVertex) ||
+        header.IndexFormat > static_cast<uint32_t>(IndexFormat::UInt32) || header.LodCount == 0U || header.LodCount > MAX_LODS) {
+        return false;
+    }
+
+    const auto fits = [size](uint64_t offset, uint64_t bytes) noexcept {
+        return (offset % DATA_ALIGNMENT) == 0U && offset <= size && bytes <= size - offset;
+    };
+    const uint64_t indexSize = (header.IndexFormat == static_cast<uint32_t>(IndexFormat::UInt16)) ? 2U : 4U;
+    if (!fits(header.VertexOffset, static_cast<uint64_t>(header.VertexCount) * sizeof(CookedMeshVertex)) ||
+        !fits(header.IndexOffset, static_cast<uint64_t>(header.IndexCount) * indexSize) ||
+        !fits(header.LodOffset, static_cast<uint64_t>(header.LodCount) * sizeof(CookedMeshLod)) ||
+        !fits(header.SubsetOffset, static_cast<uint64_t>(header.SubsetCount) * sizeof(MeshSubset))) {
+        return false;
+    }
+
+    const byte_t* data = static_cast<const byte_t*>(cooked);
+    for (uint32_t i = 0U; i < header.LodCount; ++i) {
+        CookedMeshLod lod;
+        std::memcpy(&lod, data + header.LodOffset + sizeof(CookedMeshLod) * i, sizeof(lod));
+        if (lod.FirstSubset > header.SubsetCount || lod.SubsetCount > header.SubsetCount - lod.FirstSubset) {
+            return false;
+        }
+    }
+    for (uint32_t i = 0U; i < header.SubsetCount; ++i) {
+        MeshSubset subset;
+        std::memcpy(&subset, data + header.SubsetOffset + sizeof(MeshSubset) * i, sizeof(subset));
+        if (subset.StartIndex > header.IndexCount || subset.IndexCount > header.IndexCount - subset.StartIndex) {
+            return false;
+        }
+    }
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,657 @@
+#include "Graphics/MeshOptimizer.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+using namespace graphics;
+
+namespace {
+    constexpr uint32_t NO_TRIANGLE      = UINT32_MAX;       ///< 삼각형 없음
+    constexpr float LAST_TRIANGLE_SCORE = 0.75f;            ///< 직전 삼각형 정점의 점수
+    constexpr float CACHE_DECAY_POWER   = 1.5f;             ///< 캐시 위치 점수의 감쇠 지수
+    constexpr float VALENCE_BOOST_SCALE = 2.0f;             ///< 남은 삼각형이 적은 정점의 가산점 배율
+    constexpr float VALENCE_BOOST_POWER = 0.5f;             ///< 남은 삼각형이 적은 정점의 가산점 지수
+    constexpr uint32_t VALENCE_TABLE_SIZE = 32U;            ///< 가산점을 미리 계산해둘 남은 삼각형 수
+
+    /// @brief 미리 계산한 점수표
+    struct ScoreTable final {
+        float Cache[MeshOptimizer::CACHE_SIZE];             ///< 캐시 위치별 점수
+        float Valence[VALENCE_TABLE_SIZE];                  ///< 남은 삼각형 수별 가산점
+
+        ScoreTable() noexcept {
+            const float scale = 1.0f / static_cast<float>(MeshOptimizer::CACHE_SIZE - 3U);
+            for (uint32_t i = 0U; i < MeshOptimizer::CACHE_SIZE; ++i) {
+                // 직전 삼각형의 정점은 바로 다시 쓰면 이득이 적으므로 고정 점수를 줍니다.
+                Cache[i] = (i < 3U) ? LAST_TRIANGLE_SCORE : std::pow(1.0f - static_cast<float>(i - 3U) * scale, CACHE_DECAY_POWER);
+            }
+            Valence[0] = 0.0f;
+            for (uint32_t i = 1U; i < VALENCE_TABLE_SIZE; ++i) {
+                Valence[i] = VALENCE_BOOST_SCALE * std::pow(static_cast<float>(i), -VALENCE_BOOST_POWER);
+            }
+        }
+    };
+
+    /// @brief 정점 점수를 계산합니다.
+    /// @param table 점수표
+    /// @param cachePosition 캐시 위치 (-1: 캐시에 없음)
+    /// @param liveTriangles 아직 내보내지 않은 삼각형 수
+    /// @return 점수 (남은 삼각형이 없으면 -1)
+    float vertexScore(const ScoreTable& table, int32_t cachePosition, uint32_t liveTriangles) noexcept {
+        if (liveTriangles == 0U) {
+            return -1.0f;
+        }
+
+        const float cache = (cachePosition >= 0) ? table.Cache[cachePosition] : 0.0f;
+        const float valence = (liveTriangles < VALENCE_TABLE_SIZE) ? table.Valence[liveTriangles] : VALENCE_BOOST_SCALE * std::pow(static_cast<float>(liveTriangles), -VALENCE_BOOST_POWER);
+        return cache + valence;
+    }
+
+    /// @brief 정점 캐시 모의용 FIFO
+    struct FifoCache final {
+        uint32_t Entries[64];                               ///< 정점
+        uint32_t Size;                                      ///< 크기 (64 이하)
+        uint32_t Head;                                      ///< 다음에 쓸 위치
+        uint32_t Count;                                     ///< 들어있는 정점 수
+
+        explicit FifoCache(uint32_t size) noexcept : Entries(), Size(std::clamp(size, 1U, 64U)), Head(0U), Count(0U) {
+
+        }
+
+        /// @brief 정점을 읽습니다.
+        /// @param vertex 정점
+        /// @return 캐시 실패(true), 적중(false)
+        bool Access(uint32_t vertex) noexcept {
+            if (std::find(Entries, Entries + Count, vertex) != Entries + Count) {
+                return false;
+            }
+            Entries[Head] = vertex;
+            Head = (Head + 1U) % Size;
+            Count = std::min(Count + 1U, Size);
+            return true;
+        }
+
+        /// @brief 캐시를 비웁니다.
+        void Reset() noexcept {
+            Head = Count = 0U;
+        }
+    };
+
+    /// @brief 2차 오차 행렬 (평면까지 거리 제곱의 합)
+    struct Quadric final {
+        float A2, B2, C2, AB, AC, BC, AD, BD, CD, D2;       ///< 대칭 4x4 행렬 성분
+        float Weight;                                       ///< 가중치 합 (넓이)
+
+        /// @brief 평면으로 만듭니다.
+        /// @param n 단위 노멀
+        /// @param d 평면 상수 (n · p + d = 0)
+        /// @param weight 가중치
+        /// @return Quadric
+        static Quadric FromPlane(const Vector3F& n, float d, float weight) noexcept {
+            return {
+                n.X * n.X * weight, n.Y * n.Y * weight, n.Z * n.Z * weight,
+                n.X * n.Y * weight, n.X * n.Z * weight, n.Y * n.Z * weight,
+                n.X * d * weight, n.Y * d * weight, n.Z * d * weight, d * d * weight,
+                weight
+            };
+        }
+
+        /// @brief 다른 행렬을 더합니다.
+        /// @param other 다른 행렬
+        void Add(const Quadric& other) noexcept {
+            A2 += other.A2; B2 += other.B2; C2 += other.C2;
+            AB += other.AB; AC += other.AC; BC += other.BC;
+            AD += other.AD; BD += other.BD; CD += other.CD; D2 += other.D2;
+            Weight += other.Weight;
+        }
+
+        /// @brief 점의 오차를 계산합니다.
+        /// @param p 점
+        /// @return 가중치 합으로 나눈 거리 제곱
+        [[nodiscard]] float Evaluate(const Vector3F& p) const noexcept {
+            const float error =
+                A2 * p.X * p.X + B2 * p.Y * p.Y + C2 * p.Z * p.Z +
+                2.0f * (AB * p.X * p.Y + AC * p.X * p.Z + BC * p.Y * p.Z) +
+                2.0f * (AD * p.X + BD * p.Y + CD * p.Z) + D2;
+            return (Weight > 0.0f) ? std::fabs(error) / Weight : 0.0f;
+        }
+    };
+
+    /// @brief 정점 위치를 취득합니다.
+    /// @param vertex 정점
+    /// @return 위치
+    Vector3F positionOf(const MeshVertex& vertex) noexcept {
+        return { vertex.X, vertex.Y, vertex.Z };
+    }
+
+    /// @brief 정점마다 자신을 쓰는 삼각형 목록을 만듭니다.
+    /// @param indices 인덱스
+    /// @param indexCount 인덱스 수
+    /// @param vertexCount 정점 수
+    /// @param offsets 결과 (정점 v의 목록은 adjacency[offsets[v], offsets[v + 1]))
+    /// @param adjacency 결과 (삼각형 인덱스)
+    void buildAdjacency(const uint32_t* indices, size_t indexCount, size_t vertexCount, std::vector<uint32_t>& offsets, std::vector<uint32_t>& adjacency) noexcept {
+        offsets.assign(vertexCount + 1U, 0U);
+        for (size_t i = 0U; i < indexCount; ++i) {
+            ++offsets[indices[i] + 1U];
+        }
+        for (size_t v = 0U; v < vertexCount; ++v) {
+            offsets[v + 1U] += offsets[v];
+        }
+        adjacency.resize(indexCount);
+        std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0U; i < indexCount; ++i) {
+            adjacency[cursor[indices[i]]++] = static_cast<uint32_t>(i / 3U);
+        }
+    }
+}
+
+/// @brief 정점 캐시 적중률이 높아지도록 삼각형 순서를 바꿉니다.
+/// @param indices 인덱스 (삼각형 목록, 제자리에서 바뀜)
+/// @param indexCount 인덱스 수 (3의 배수)
+/// @param vertexCount 정점 수 (모든 인덱스보다 커야 함)
+void MeshOptimizer::OptimizeVertexCache(uint32_t* indices, size_t indexCount, size_t vertexCount) noexcept {
+    const size_t triangleCount = indexCount / 3U;
+    if (triangleCount < 2U || vertexCount == 0U) {
+        return;
+    }
+
+    // 정점마다 자신을 쓰는 삼각형 목록을 만듭니다. 앞쪽 liveCount개가 아직 내보내지 않은 삼각형입니다.
+    std::vector<uint32_t> liveCount(vertexCount, 0U);
+    for (size_t i = 0U; i < triangleCount * 3U; ++i) {
+        ++liveCount[indices[i]];
+    }
+    std::vector<uint32_t> offsets(vertexCount + 1U, 0U);
+    for (size_t v = 0U; v < vertexCount; ++v) {
+        offsets[v + 1U] = offsets[v] + liveCount[v];
+    }
+    std::vector<uint32_t> adjacency(triangleCount * 3U);
+    {
+        std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0U; i < triangleCount * 3U; ++i) {
+            adjacency[cursor[indices[i]]++] = static_cast<uint32_t>(i / 3U);
+        }
+    }
+
+    static const ScoreTable table;
+    std::vector<int32_t> cachePosition(vertexCount, -1);
+    std::vector<float> score(vertexCount);
+    for (size_t v = 0U; v < vertexCount; ++v) {
+        score[v] = vertexScore(table, -1, liveCount[v]);
+    }
+    std::vector<float> triangleScore(triangleCount);
+    for (size_t t = 0U; t < triangleCount; ++t) {
+        triangleScore[t] = score[indices[t * 3U]] + score[indices[t * 3U + 1U]] + score[indices[t * 3U + 2U]];
+    }
+
+    std::vector<uint32_t> output(triangleCount * 3U);
+    std::vector<uint8_t> emitted(triangleCount, 0U);
+    uint32_t cache[CACHE_SIZE + 3U];
+    uint32_t nextCache[CACHE_SIZE + 3U];
+    uint32_t cacheCount = 0U;
+
+    uint32_t best = static_cast<uint32_t>(std::max_element(triangleScore.begin(), triangleScore.end()) - triangleScore.begin());
+    size_t scan = 0U;
+    for (size_t written = 0U; written < triangleCount; ++written) {
+        // 캐시 안에 후보가 없으면 아직 내보내지 않은 다음 삼각형에서 다시 시작합니다.
+        if (best == NO_TRIANGLE) {
+            while (emitted[scan]) {
+                ++scan;
+            }
+            best = static_cast<uint32_t>(scan);
+        }
+
+        const uint32_t* triangle = indices + static_cast<size_t>(best) * 3U;
+        std::memcpy(&output[written * 3U], triangle, sizeof(uint32_t) * 3U);
+        emitted[best] = 1U;
+
+        // 내보낸 삼각형을 정점별 목록에서 뺍니다.
+        for (uint32_t k = 0U; k < 3U; ++k) {
+            const uint32_t vertex = triangle[k];
+            uint32_t* begin = &adjacency[offsets[vertex]];
+            uint32_t* end = begin + liveCount[vertex];
+            std::iter_swap(std::find(begin, end, best), end - 1);
+            --liveCount[vertex];
+        }
+
+        // 삼각형의 정점을 캐시 맨 앞에 넣고, 넘친 정점(CACHE_SIZE 이후)은 점수 갱신 후 버립니다.
+        uint32_t nextCount = 0U;
+        for (uint32_t k = 0U; k < 3U; ++k) {
+            if (std::find(nextCache, nextCache + nextCount, triangle[k]) == nextCache + nextCount) {
+                nextCache[nextCount++] = triangle[k];
+            }
+        }
+        for (uint32_t i = 0U; i < cacheCount; ++i) {
+            const uint32_t vertex = cache[i];
+            if (vertex != triangle[0] && vertex != triangle[1] && vertex != triangle[2]) {
+                nextCache[nextCount++] = vertex;
+            }
+        }
+
+        for (uint32_t i = 0U; i < nextCount; ++i) {
+            const uint32_t vertex = nextCache[i];
+            cachePosition[vertex] = (i < CACHE_SIZE) ? static_cast<int32_t>(i) : -1;
+            score[vertex] = vertexScore(table, cachePosition[vertex], liveCount[vertex]);
+        }
+
+        // 캐시에 남은 정점의 삼각형만 점수를 다시 계산하고 그중 최고를 다음 후보로 고릅니다.
+        best = NO_TRIANGLE;
+        float bestScore = -1.0f;
+        for (uint32_t i = 0U; i < nextCount; ++i) {
+            const uint32_t vertex = nextCache[i];
+            const uint32_t* live = &adjacency[offsets[vertex]];
+            for (uint32_t j = 0U; j < liveCount[vertex]; ++j) {
+                const size_t t = live[j];
+                const float value = score[indices[t * 3U]] + score[indices[t * 3U + 1U]] + score[indices[t * 3U + 2U]];
+                if (value > bestScore && cachePosition[vertex] >= 0) {
+                    bestScore = value;
+                    best = static_cast<uint32_t>(t);
+                }
+            }
+        }
+
+        cacheCount = std::min(nextCount, CACHE_SIZE);
+        std::memcpy(cache, nextCache, sizeof(uint32_t) * cacheCount);
+    }
+
+    std::memcpy(indices, output.data(), sizeof(uint32_t) * output.size());
+}
+
+/// @brief 정점을 처음 쓰이는 순서로 다시 배치합니다.
+/// @param vertices 정점 (제자리에서 바뀜)
+/// @param vertexCount 정점 수
+/// @param stride 정점 크기 (바이트 단위)
+/// @param indices 인덱스 (새 배치에 맞게 바뀜)
+/// @param indexCount 인덱스 수
+/// @return 쓰이는 정점 수 (쓰이지 않는 정점은 뒤로 밀려나므로 호출자가 이 크기로 줄이면 됨)
+size_t MeshOptimizer::OptimizeVertexFetch(void* vertices, size_t vertexCount, size_t stride, uint32_t* indices, size_t indexCount) noexcept {
+    std::vector<uint32_t> remap(vertexCount, UINT32_MAX);
+    uint32_t used = 0U;
+    for (size_t i = 0U; i < indexCount; ++i) {
+        uint32_t& target = remap[indices[i]];
+        if (target == UINT32_MAX) {
+            target = used++;
+        }
+        indices[i] = target;
+    }
+
+    byte_t* data = static_cast<byte_t*>(vertices);
+    std::vector<byte_t> sorted(static_cast<size_t>(used) * stride);
+    for (size_t v = 0U; v < vertexCount; ++v) {
+        if (remap[v] != UINT32_MAX) {
+            std::memcpy(&sorted[static_cast<size_t>(remap[v]) * stride], data + v * stride, stride);
+        }
+    }
+    std::memcpy(data, sorted.data(), sorted.size());
+    return used;
+}
+
+/// @brief 바깥을 향한 삼각형부터 그려지도록 삼각형 묶음 순서를 바꿉니다.
+/// @param indices 인덱스 (정점 캐시 최적화를 마친 삼각형 목록, 제자리에서 바뀜)
+/// @param indexCount 인덱스 수
+/// @param vertices 정점
+/// @param vertexCount 정점 수
+/// @param threshold 허용할 ACMR 증가 비율 (1.05: 5%까지 캐시 효율을 내주고 묶음을 더 잘게 나눔)
+/// @note Sander 등의 방식입니다. 캐시가 비워지는 지점과 캐시 효율이 threshold 이내로 유지되는 지점에서 삼각형을 묶음으로 나누고,
+///       묶음을 (중심 - 메시 중심) · 묶음 노멀이 큰 순서, 즉 바깥을 향한 면부터 그립니다.
+///       앞쪽 면이 먼저 깊이를 채우므로 뒤쪽 면의 픽셀 셰이더 실행이 줄어듭니다. 시계 방향 앞면을 가정합니다.
+void MeshOptimizer::OptimizeOverdraw(uint32_t* indices, size_t indexCount, const MeshVertex* vertices, size_t vertexCount, float threshold) noexcept {
+    const size_t triangleCount = indexCount / 3U;
+    if (triangleCount < 2U || vertexCount == 0U) {
+        return;
+    }
+
+    // 세 정점이 모두 캐시 실패인 삼각형에서 끊고(단단한 경계), 그 안에서 다시 캐시 효율이 충분한 곳에서 끊습니다(부드러운 경계).
+    std::vector<uint32_t> clusters;
+    FifoCache cache(16U);
+    for (size_t t = 0U; t < triangleCount; ++t) {
+        const uint32_t misses = static_cast<uint32_t>(cache.Access(indices[t * 3U])) + cache.Access(indices[t * 3U + 1U]) + cache.Access(indices[t * 3U + 2U]);
+        if (t == 0U || misses == 3U) {
+            clusters.push_back(static_cast<uint32_t>(t));
+        }
+    }
+    clusters.push_back(static_cast<uint32_t>(triangleCount));
+
+    std::vector<uint32_t> soft;
+    for (size_t c = 0U; c + 1U < clusters.size(); ++c) {
+        const uint32_t begin = clusters[c];
+        const uint32_t end = clusters[c + 1U];
+
+        cache.Reset();
+        uint32_t misses = 0U;
+        for (uint32_t t = begin * 3U; t < end * 3U; ++t) {
+            misses += cache.Access(indices[t]);
+        }
+        const float limit = threshold * static_cast<float>(misses) / static_cast<float>(end - begin);
+
+        cache.Reset();
+        misses = 0U;
+        uint32_t start = begin;
+        soft.push_back(begin);
+        for (uint32_t t = begin; t < end; ++t) {
+            misses += static_cast<uint32_t>(cache.Access(indices[t * 3U])) + cache.Access(indices[t * 3U + 1U]) + cache.Access(indices[t * 3U + 2U]);
+            if (t + 1U < end && static_cast<float>(misses) <= limit * static_cast<float>(t + 1U - start)) {
+                soft.push_back(t + 1U);
+                start = t + 1U;
+                misses = 0U;
+                cache.Reset();
+            }
+        }
+    }
+    soft.push_back(static_cast<uint32_t>(triangleCount));
+
+    // 묶음마다 넓이 가중 중심과 노멀을 구합니다.
+    Vector3F meshCenter(0.0f, 0.0f, 0.0f);
+    float meshArea = 0.0f;
+    std::vector<Vector3F> centers(soft.size() - 1U);
+    std::vector<Vector3F> normals(soft.size() - 1U);
+    for (size_t c = 0U; c + 1U < soft.size(); ++c) {
+        Vector3F center(0.0f, 0.0f, 0.0f);
+        Vector3F normal(0.0f, 0.0f, 0.0f);
+        float area = 0.0f;
+        for (uint32_t t = soft[c]; t < soft[c + 1U]; ++t) {
+            const Vector3F a = positionOf(vertices[indices[t * 3U]]);
+            const Vector3F b = positionOf(vertices[indices[t * 3U + 1U]]);
+            const Vector3F d = positionOf(vertices[indices[t * 3U + 2U]]);
+            const Vector3F cross = Vector3F::Cross(b - a, d - a);
+            const float weight = cross.Length();
+            center = center + (a + b + d) * (weight / 3.0f);
+            normal = normal + cross;
+            area += weight;
+        }
+        meshCenter = meshCenter + center;
+        meshArea += area;
+        centers[c] = (area > 0.0f) ? center * (1.0f / area) : positionOf(vertices[indices[soft[c] * 3U]]);
+        normals[c] = normal.Normalize();
+    }
+    meshCenter = (meshArea > 0.0f) ? meshCenter * (1.0f / meshArea) : centers[0];
+
+    std::vector<float> keys(centers.size());
+    std::vector<uint32_t> order(centers.size());
+    for (size_t c = 0U; c < centers.size(); ++c) {
+        keys[c] = Vector3F::Dot(centers[c] - meshCenter, normals[c]);
+        order[c] = static_cast<uint32_t>(c);
+    }
+    std::stable_sort(order.begin(), order.end(), [&keys](uint32_t lhs, uint32_t rhs) noexcept {
+        return keys[lhs] > keys[rhs];
+    });
+
+    std::vector<uint32_t> output;
+    output.reserve(triangleCount * 3U);
+    for (const uint32_t c : order) {
+        output.insert(output.end(), indices + static_cast<size_t>(soft[c]) * 3U, indices + static_cast<size_t>(soft[c + 1U]) * 3U);
+    }
+    std::memcpy(indices, output.data(), sizeof(uint32_t) * output.size());
+}
+
+/// @brief 모서리를 접어 삼각형 수를 줄입니다.
+/// @param destination 결과 인덱스 (indexCount 이상 크기)
+/// @param indices 원본 인덱스 (삼각형 목록)
+/// @param indexCount 원본 인덱스 수
+/// @param vertices 정점
+/// @param vertexCount 정점 수
+/// @param targetIndexCount 목표 인덱스 수
+/// @param targetError 허용 오차 (메시 크기에 대한 비율, 0.01: 1%)
+/// @param resultError 실제 최대 오차 (메시 크기에 대한 비율, nullptr 가능)
+/// @return 결과 인덱스 수 (오차 안에서 더 줄일 수 없으면 목표보다 클 수 있음)
+/// @note 2차 오차 행렬로 비용을 매긴 모서리를 한 정점 쪽으로 접습니다. 정점을 새로 만들지 않으므로 정점 버퍼를 모든 LOD가 공유합니다.
+///       위치가 같고 속성이 다른 정점(텍스처 이음새)과 경계 모서리의 정점은 모양이 깨지지 않도록 움직이지 않고,
+///       접었을 때 뒤집히는 삼각형이 생기는 모서리는 접지 않습니다.
+size_t MeshOptimizer::Simplify(uint32_t* destination, const uint32_t* indices, size_t indexCount, const MeshVertex* vertices, size_t vertexCount, size_t targetIndexCount, float targetError, float* resultError) noexcept {
+    indexCount -= indexCount % 3U;
+    std::memcpy(destination, indices, sizeof(uint32_t) * indexCount);
+    if (resultError) {
+        *resultError = 0.0f;
+    }
+    if (indexCount <= targetIndexCount || vertexCount == 0U) {
+        return indexCount;
+    }
+
+    // 위치와 속성이 모두 같은 정점은 하나로 모으고, 위치만 같은 정점들은 이음새이므로 잠급니다.
+    std::vector<uint32_t> canonical(vertexCount);
+    std::vector<uint8_t> locked(vertexCount, 0U);
+    {
+        std::vector<uint32_t> order(vertexCount);
+        for (size_t v = 0U; v < vertexCount; ++v) {
+            order[v] = static_cast<uint32_t>(v);
+        }
+        const auto samePosition = [vertices](uint32_t lhs, uint32_t rhs) noexcept {
+            return vertices[lhs].X == vertices[rhs].X && vertices[lhs].Y == vertices[rhs].Y && vertices[lhs].Z == vertices[rhs].Z;
+        };
+        std::sort(order.begin(), order.end(), [vertices](uint32_t lhs, uint32_t rhs) noexcept {
+            const MeshVertex& a = vertices[lhs];
+            const MeshVertex& b = vertices[rhs];
+            return (a.X != b.X) ? a.X < b.X : (a.Y != b.Y) ? a.Y < b.Y : (a.Z != b.Z) ? a.Z < b.Z : lhs < rhs;
+        });
+        for (size_t i = 0U; i < vertexCount;) {
+            size_t j = i + 1U;
+            while (j < vertexCount && samePosition(order[i], order[j])) {
+                ++j;
+            }
+            bool seam = false;
+            for (size_t k = i; k < j; ++k) {
+                size_t same = i;
+                while (std::memcmp(&vertices[order[k]], &vertices[order[same]], sizeof(MeshVertex)) != 0) {
+                    ++same;
+                }
+                canonical[order[k]] = order[same];
+                seam = seam || (same != i);
+            }
+            for (size_t k = i; k < j && seam; ++k) {
+                locked[order[k]] = 1U;
+            }
+            i = j;
+        }
+    }
+
+    uint32_t* result = destination;
+    for (size_t i = 0U; i < indexCount; ++i) {
+        result[i] = canonical[result[i]];
+    }
+
+    // 한 삼각형만 쓰는 모서리의 정점은 경계이므로 잠급니다.
+    {
+        std::vector<uint64_t> edges;
+        edges.reserve(indexCount);
+        for (size_t t = 0U; t < indexCount; t += 3U) {
+            for (uint32_t k = 0U; k < 3U; ++k) {
+                const uint32_t a = result[t + k];
+                const uint32_t b = result[t + (k + 1U) % 3U];
+                edges.push_back((static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b));
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+        for (size_t i = 0U; i < edges.size();) {
+            size_t j = i + 1U;
+            while (j < edges.size() && edges[j] == edges[i]) {
+                ++j;
+            }
+            if (j - i == 1U) {
+                locked[static_cast<uint32_t>(edges[i] >> 32)] = 1U;
+                locked[static_cast<uint32_t>(edges[i])] = 1U;
+            }
+            i = j;
+        }
+    }
+
+    // 메시 크기로 오차를 정규화합니다.
+    Vector3F minimum = positionOf(vertices[0]);
+    Vector3F maximum = minimum;
+    for (size_t v = 1U; v < vertexCount; ++v) {
+        minimum = { std::min(minimum.X, vertices[v].X), std::min(minimum.Y, vertices[v].Y), std::min(minimum.Z, vertices[v].Z) };
+        maximum = { std::max(maximum.X, vertices[v].X), std::max(maximum.Y, vertices[v].Y), std::max(maximum.Z, vertices[v].Z) };
+    }
+    const float extent = std::max({ maximum.X - minimum.X, maximum.Y - minimum.Y, maximum.Z - minimum.Z, FLT_MIN });
+    const float errorLimit = targetError * extent;
+    const float errorLimitSquared = errorLimit * errorLimit;
+
+    std::vector<Quadric> quadrics(vertexCount, Quadric{});
+    for (size_t t = 0U; t < indexCount; t += 3U) {
+        const Vector3F a = positionOf(vertices[result[t]]);
+        const Vector3F b = positionOf(vertices[result[t + 1U]]);
+        const Vector3F c = positionOf(vertices[result[t + 2U]]);
+        const Vector3F cross = Vector3F::Cross(b - a, c - a);
+        const float area = cross.Length();
+        if (area <= 0.0f) {
+            continue;
+        }
+        const Vector3F normal = cross * (1.0f / area);
+        const Quadric plane = Quadric::FromPlane(normal, -Vector3F::Dot(normal, a), area);
+        for (uint32_t k = 0U; k < 3U; ++k) {
+            quadrics[result[t + k]].Add(plane);
+        }
+    }
+
+    /// @brief 접기 후보
+    struct Collapse final {
+        uint32_t From;                      ///< 없어지는 정점
+        uint32_t To;                        ///< 남는 정점
+        float Error;                        ///< 오차 (거리 제곱)
+    };
+
+    std::vector<uint32_t> remap(vertexCount);
+    std::vector<uint8_t> touched(vertexCount);
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> adjacency;
+    std::vector<Collapse> collapses;
+    float maxError = 0.0f;
+
+    while (indexCount > targetIndexCount) {
+        buildAdjacency(result, indexCount, vertexCount, offsets, adjacency);
+
+        // 모든 모서리에 대해 잠기지 않은 쪽을 다른 쪽으로 접는 비용을 매깁니다.
+        collapses.clear();
+        for (size_t t = 0U; t < indexCount; t += 3U) {
+            for (uint32_t k = 0U; k < 3U; ++k) {
+                const uint32_t a = result[t + k];
+                const uint32_t b = result[t + (k + 1U) % 3U];
+                Collapse best = { a, b, FLT_MAX };
+                if (!locked[a]) {
+                    Quadric q = quadrics[a];
+                    q.Add(quadrics[b]);
+                    best = { a, b, q.Evaluate(positionOf(vertices[b])) };
+                }
+                if (!locked[b]) {
+                    Quadric q = quadrics[b];
+                    q.Add(quadrics[a]);
+                    const float error = q.Evaluate(positionOf(vertices[a]));
+                    if (error < best.Error) {
+                        best = { b, a, error };
+                    }
+                }
+                if (best.Error <= errorLimitSquared) {
+                    collapses.push_back(best);
+                }
+            }
+        }
+        if (collapses.empty()) {
+            break;
+        }
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse& lhs, const Collapse& rhs) noexcept {
+            return lhs.Error < rhs.Error;
+        });
+
+        // 싼 것부터, 한 번에 한 정점 주변만 바뀌도록 서로 겹치지 않는 모서리만 접습니다.
+        for (size_t v = 0U; v < vertexCount; ++v) {
+            remap[v] = static_cast<uint32_t>(v);
+        }
+        std::fill(touched.begin(), touched.end(), 0U);
+        size_t removed = 0U;
+        const size_t excess = (indexCount - targetIndexCount) / 3U;
+        for (const Collapse& collapse : collapses) {
+            if (removed >= excess) {
+                break;
+            }
+            if (touched[collapse.From] || touched[collapse.To]) {
+                continue;
+            }
+
+            // 접었을 때 노멀이 뒤집히는 삼각형이 있으면 접지 않습니다.
+            const Vector3F target = positionOf(vertices[collapse.To]);
+            bool flipped = false;
+            uint32_t collapsed = 0U;
+            for (uint32_t i = offsets[collapse.From]; i < offsets[collapse.From + 1U] && !flipped; ++i) {
+                const uint32_t* triangle = result + static_cast<size_t>(adjacency[i]) * 3U;
+                if (triangle[0] == collapse.To || triangle[1] == collapse.To || triangle[2] == collapse.To) {
+                    ++collapsed;
+                    continue;
+                }
+                Vector3F before[3];
+                Vector3F after[3];
+                for (uint32_t k = 0U; k < 3U; ++k) {
+                    before[k] = positionOf(vertices[triangle[k]]);
+                    after[k] = (triangle[k] == collapse.From) ? target : before[k];
+                }
+                const Vector3F n0 = Vector3F::Cross(before[1] - before[0], before[2] - before[0]);
+                const Vector3F n1 = Vector3F::Cross(after[1] - after[0], after[2] - after[0]);
+                flipped = Vector3F::Dot(n0, n1) <= 0.0f;
+            }
+            if (flipped) {
+                continue;
+            }
+
+            // 접는 정점의 이웃도 이번 단계에서는 건드리지 않습니다.
+            for (uint32_t i = offsets[collapse.From]; i < offsets[collapse.From + 1U]; ++i) {
+                const uint32_t* triangle = result + static_cast<size_t>(adjacency[i]) * 3U;
+                touched[triangle[0]] = touched[triangle[1]] = touched[triangle[2]] = 1U;
+            }
+            remap[collapse.From] = collapse.To;
+            quadrics[collapse.To].Add(quadrics[collapse.From]);
+            maxError = std::max(maxError, collapse.Error);
+            removed += collapsed;
+        }
+        if (removed == 0U) {
+            break;
+        }
+
+        // 정점을 옮기고 넓이가 없어진 삼각형을 버립니다.
+        size_t write = 0U;
+        for (size_t t = 0U; t < indexCount; t += 3U) {
+            const uint32_t a = remap[result[t]];
+            const uint32_t b = remap[result[t + 1U]];
+            const uint32_t c = remap[result[t + 2U]];
+            if (a != b && b != c && a != c) {
+                result[write++] = a;
+                result[write++] = b;
+                result[write++] = c;
+            }
+        }
+        indexCount = write;
+    }
+
+    if (resultError) {
+        *resultError = std::sqrt(maxError) / extent;
+    }
+    return indexCount;
+}
+
+/// @brief 메시를 최적화합니다.
+/// @param mesh 메시
+/// @note 범위마다 삼각형 순서를 바꾼 뒤 메시 전체의 정점을 다시 배치하고, 쓰이지 않는 정점은 버립니다.
+void MeshOptimizer::Optimize(MeshData& mesh) noexcept {
+    for (const MeshSubset& subset : mesh.Subsets) {
+        OptimizeVertexCache(mesh.Indices.data() + subset.StartIndex, subset.IndexCount, mesh.Vertices.size());
+    }
+
+    const size_t used = OptimizeVertexFetch(mesh.Vertices.data(), mesh.Vertices.size(), sizeof(MeshVertex), mesh.Indices.data(), mesh.Indices.size());
+    mesh.Vertices.resize(used);
+}
+
+/// @brief 삼각형당 평균 캐시 실패 수(ACMR)를 계산합니다.
+/// @param indices 인덱스 (삼각형 목록)
+/// @param indexCount 인덱스 수
+/// @param cacheSize 모의할 FIFO 캐시 크기 (64 이하)
+/// @return ACMR (0.5에 가까울수록 좋고 3이 최악)
+float MeshOptimizer::GetACMR(const uint32_t* indices, size_t indexCount, uint32_t cacheSize) noexcept {
+    const size_t triangleCount = indexCount / 3U;
+    if (triangleCount == 0U) {
+        return 0.0f;
+    }
+
+    FifoCache cache(cacheSize);
+    size_t misses = 0U;
+    for (size_t i = 0U; i < triangleCount * 3U; ++i) {
+        misses += cache.Access(indices[i]);
+    }
+    return static_cast<float>(misses) / static_cast<float>(triangleCount);
+}
\ No newline at end of file
@@ -0,0 +1,430 @@
+#include "Graphics/NullRenderDevice.hpp"
+
+using namespace graphics;
+
+/// @brief 기본 생성자
+NullRenderDevice::NullRenderDevice() noexcept {
+    m_Width         = 0;
+    m_Height        = 0;
+    m_FrameCount    = 0ULL;
+    m_VSyncEnabled  = false;
+    m_InFrame       = false;
+}
+
+/// @brief 소멸자
+NullRenderDevice::~NullRenderDevice() noexcept {
+
+}
+
+/// @brief 디바이스를 초기화합니다.
+/// @param nativeHandle 윈도우의 핸들 (무시)
+/// @param width 너비
+/// @param height 높이
+/// @param fullscreenEnabled 전체화면 활성화 유무 (무시)
+/// @param vsyncEnabled 수직 동기화 활성화 유무
+/// @return 성공(true), 실패(false)
+/// @note 출력 장치가 없으므로 수직 동기화를 켜더라도 대기하지 않습니다. 프레임 제한은 FPSLimiter에 맡겨주세요.
+bool NullRenderDevice::Initialize(void*, int32_t width, int32_t height, bool, bool vsyncEnabled) noexcept {
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+
+    m_Width         = width;
+    m_Height        = height;
+    m_FrameCount    = 0ULL;
+    m_VSyncEnabled  = vsyncEnabled;
+
+    m_Buffers.Clear();
+    m_Textures.Clear();
+    m_Shaders.Clear();
+    m_BlendStates.Clear();
+    m_DepthStencilStates.Clear();
+    m_RasterizerStates.Clear();
+    m_Samplers.Clear();
+    m_FrameStats        = {};
+    m_LastFrameStats    = {};
+    m_TotalStats        = {};
+
+    return true;
+}
+
+/// @brief V-Sync 활성화 유무를 취득합니다.
+/// @return 활성화(true), 비활성화(false)
+bool NullRenderDevice::IsVSyncEnabled() const noexcept {
+    return m_VSyncEnabled;
+}
+
+/// @brief 프레임을 시작합니다.
+/// @param color 색상 (무시)
+void NullRenderDevice::BeginFrame(float[4]) noexcept {
+    m_InFrame = true;
+}
+
+/// @brief 프레임을 종료합니다.
+/// @note 이전 EndFrame 이후의 호출(프레임 밖에서의 리소스 생성 포함)이 이번 프레임의 통계로 확정됩니다.
+void NullRenderDevice::EndFrame() noexcept {
+    if (m_InFrame) {
+        ++m_FrameCount;
+        m_InFrame = false;
+
+        m_LastFrameStats = m_FrameStats;
+        m_FrameStats = {};
+    }
+}
+
+/// @brief 화면의 크기를 변경합니다.
+/// @param width 너비
+/// @param height 높이
+/// @return 성공(true), 실패(false)
+bool NullRenderDevice::Resize(int32_t width, int32_t height) noexcept {
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+
+    m_Width     = width;
+    m_Height    = height;
+
+    return true;
+}
+
+/// @brief V-Sync 활성화를 설정합니다.
+/// @param enabled 활성화 유무
+void NullRenderDevice::SetVSync(bool enabled) noexcept {
+    m_VSyncEnabled = enabled;
+}
+
+/// @brief 제출된 프레임 수를 취득합니다.
+/// @return 프레임 수
+uint64_t NullRenderDevice::GetFrameCount() const noexcept {
+    return m_FrameCount;
+}
+
+/// @brief 해제되지 않은 버퍼 수를 취득합니다.
+/// @return 버퍼 수
+uint32_t NullRenderDevice::GetBufferCount() const noexcept {
+    return m_Buffers.GetCount();
+}
+
+/// @brief 해제되지 않은 텍스처 수를 취득합니다.
+/// @return 텍스처 수
+uint32_t NullRenderDevice::GetTextureCount() const noexcept {
+    return m_Textures.GetCount();
+}
+
+/// @brief 버퍼를 생성합니다.
+/// @param desc 버퍼 설명
+/// @param data 초기 데이터 (nullptr 가능, Immutable은 필수)
+/// @return 버퍼 핸들 (실패 시 무효 핸들)
+BufferHandle NullRenderDevice::CreateBuffer(const BufferDesc& desc, const void* data) noexcept {
+    if (desc.Size == 0U || (desc.Usage == BufferUsage::Immutable && !data)) {
+        return {};
+    }
+
+    BufferDesc copy = desc;
+    const uint32_t id = m_Buffers.Add(std::move(copy));
+    if (id == 0U) {
+        return {};
+    }
+
+    const uint64_t uploaded = data ? desc.Size : 0ULL;
+    ++m_FrameStats.BuffersCreated;
+    ++m_TotalStats.BuffersCreated;
+    m_FrameStats.BytesUploaded += uploaded;
+    m_TotalStats.BytesUploaded += uploaded;
+
+    return { id };
+}
+
+/// @brief 버퍼의 내용을 갱신합니다.
+/// @param handle 버퍼 핸들
+/// @param data 데이터
+/// @param size 크기 (바이트 단위)
+/// @return 성공(true), 실패(false)
+bool NullRenderDevice::UpdateBuffer(BufferHandle handle, const void* data, uint32_t size) noexcept {
+    const BufferDesc* desc = m_Buffers.Get(handle.ID);
+    if (!desc || !data || size == 0U || size > desc->Size || desc->Usage == BufferUsage::Immutable) {
+        return false;
+    }
+
+    m_FrameStats.BytesUploaded += size;
+    m_TotalStats.BytesUploaded += size;
+
+    return true;
+}
+
+/// @brief 버퍼를 해제합니다.
+/// @param handle 버퍼 핸들
+void NullRenderDevice::DestroyBuffer(BufferHandle handle) noexcept {
+    m_Buffers.Remove(handle.ID);
+}
+
+/// @brief 텍스처를 생성합니다.
+/// @param desc 텍스처 설명
+/// @param data 초기 데이터 (0단계부터 모든 밉맵 단계가 행 간격 없이 연속, nullptr 가능)
+/// @return 텍스처 핸들 (실패 시 무효 핸들)
+TextureHandle NullRenderDevice::CreateTexture(const TextureDesc& desc, const void* data) noexcept {
+    if (!IsValidTextureDesc(desc)) {
+        return {};
+    }
+
+    TextureDesc copy = desc;
+    const uint32_t id = m_Textures.Add(std::move(copy));
+    if (id == 0U) {
+        return {};
+    }
+
+    const uint64_t uploaded = data ? GetTextureDataSize(desc) : 0ULL;
+    ++m_FrameStats.TexturesCreated;
+    ++m_TotalStats.TexturesCreated;
+    m_FrameStats.BytesUploaded += uploaded;
+    m_TotalStats.BytesUploaded += uploaded;
+
+    return { id };
+}
+
+/// @brief 텍스처를 해제합니다.
+/// @param handle 텍스처 핸들
+void NullRenderDevice::DestroyTexture(TextureHandle handle) noexcept {
+    m_Textures.Remove(handle.ID);
+}
+
+/// @brief 텍스처 형식을 지원하는지 확인합니다.
+/// @return 지원(true: 모든 형식)
+bool NullRenderDevice::IsTextureFormatSupported(TextureFormat) const noexcept {
+    return true;
+}
+
+/// @brief 셰이더를 생성합니다.
+/// @param desc 셰이더 설명
+/// @param code 바이트 코드 (내용은 검사하지 않음)
+/// @param size 바이트 코드 크기
+/// @return 셰이더 핸들 (실패 시 무효 핸들)
+ShaderHandle NullRenderDevice::CreateShader(const ShaderDesc& desc, const void* code, size_t size) noexcept {
+    if (!code || size == 0U) {
+        return {};
+    }
+
+    ShaderDesc copy = desc;
+    const uint32_t id = m_Shaders.Add(std::move(copy));
+    if (id == 0U) {
+        return {};
+    }
+
+    ++m_FrameStats.ShadersCreated;
+    ++m_TotalStats.ShadersCreated;
+
+    return { id };
+}
+
+/// @brief 셰이더를 해제합니다.
+/// @param handle 셰이더 핸들
+void NullRenderDevice::DestroyShader(ShaderHandle handle) noexcept {
+    m_Shaders.Remove(handle.ID);
+}
+
+/// @brief 블렌드 상태를 생성합니다.
+/// @param desc 블렌드 상태 설명
+/// @return 블렌드 상태 핸들 (실패 시 무효 핸들)
+BlendStateHandle NullRenderDevice::CreateBlendState(const BlendDesc& desc) noexcept {
+    BlendDesc copy = desc;
+    const uint32_t id = m_BlendStates.Add(std::move(copy));
+    if (id == 0U) {
+        return {};
+    }
+
+    ++m_FrameStats.StatesCreated;
+    ++m_TotalStats.StatesCreated;
+
+    return { id };
+}
+
+/// @brief 깊이 스텐실 상태를 생성합니다.
+/// @param desc 깊이 스텐실 상태 설명
+/// @return 깊이 스텐실 상태 핸들 (실패 시 무효 핸들)
+DepthStencilStateHandle NullRenderDevice::CreateDepthStencilState(const DepthStencilDesc& desc) noexcept {
+    DepthStencilDesc copy = desc;
+    const uint32_t id = m_DepthStencilStates.Add(std::move(copy));
+    if (id == 0U) {
+        return {};
+    }
+
+    ++m_FrameStats.StatesCreated;
+    ++m_TotalStats.StatesCreated;
+
+    return { id };
+}
+
+/// @brief 래스터라이저 상태를 생성합니다.
+/// @param desc 래스터라이저 상태 설명
+/// @return 래스터라이저 상태 핸들 (실패 시 무효 핸들)
+RasterizerStateHandle NullRenderDevice::CreateRasterizerState(const RasterizerDesc& desc) noexcept {
+    RasterizerDesc copy = desc;
+    const uint32_t id = m_RasterizerStates.Add(std::move(copy));
+    if (id == 0U) {
+        return {};
+    }
+
+    ++m_FrameStats.StatesCreated;
+    ++m_TotalStats.StatesCreated;
+
+    return { id };
+}
+
+/// @brief 샘플러를 생성합니다.
+/// @param desc 샘플러 설명
+/// @return 샘플러 핸들 (실패 시 무효 핸들)
+SamplerHandle NullRenderDevice::CreateSampler(const SamplerDesc& desc) noexcept {
+    SamplerDesc copy = desc;
+    const uint32_t id = m_Samplers.Add(std::move(copy));
+    if (id == 0U) {
+        return {};
+    }
+
+    ++m_FrameStats.StatesCreated;
+    ++m_TotalStats.StatesCreated;
+
+    return { id };
+}
+
+/// @brief 블렌드 상태를 해제합니다.
+/// @param handle 블렌드 상태 핸들
+void NullRenderDevice::DestroyBlendState(BlendStateHandle handle) noexcept {
+    m_BlendStates.Remove(handle.ID);
+}
+
+/// @brief 깊이 스텐실 상태를 해제합니다.
+/// @param handle 깊이 스텐실 상태 핸들
+void NullRenderDevice::DestroyDepthStencilState(DepthStencilStateHandle handle) noexcept {
+    m_DepthStencilStates.Remove(handle.ID);
+}
+
+/// @brief 래스터라이저 상태를 해제합니다.
+/// @param handle 래스터라이저 상태 핸들
+void NullRenderDevice::DestroyRasterizerState(RasterizerStateHandle handle) noexcept {
+    m_RasterizerStates.Remove(handle.ID);
+}
+
+/// @brief 샘플러를 해제합니다.
+/// @param handle 샘플러 핸들
+void NullRenderDevice::DestroySampler(SamplerHandle handle) noexcept {
+    m_Samplers.Remove(handle.ID);
+}
+
+/// @brief 백 버퍼의 설명을 취득합니다.
+/// @return 텍스처 설명 (백 버퍼와 같은 크기, 형식)
+TextureDesc NullRenderDevice::GetBackBufferDesc() const noexcept {
+    TextureDesc desc;
+    desc.Width  = m_Width;
+    desc.Height = m_Height;
+    desc.Format = TextureFormat::RGBA8;
+    return desc;
+}
+
+/// @brief 백 버퍼의 내용을 텍스처로 복사합니다.
+/// @param handle 텍스처 핸들 (백 버퍼와 같은 크기, 형식)
+/// @return 성공(true), 실패(false)
+bool NullRenderDevice::CopyBackBufferToTexture(TextureHandle handle) noexcept {
+    const TextureDesc* desc = m_Textures.Get(handle.ID);
+    return desc && desc->Width == m_Width && desc->Height == m_Height && !IsBlockCompressed(desc->Format) && desc->MipLevels == 1U;
+}
+
+/// @brief 텍스처의 내용을 백 버퍼로 복사합니다.
+/// @param handle 텍스처 핸들 (백 버퍼와 같은 크기, 형식)
+/// @return 성공(true), 실패(false)
+bool NullRenderDevice::CopyTextureToBackBuffer(TextureHandle handle) noexcept {
+    const TextureDesc* desc = m_Textures.Get(handle.ID);
+    return desc && desc->Width == m_Width && desc->Height == m_Height && !IsBlockCompressed(desc->Format) && desc->MipLevels == 1U;
+}
+
+/// @brief 정점 버퍼를 바인딩합니다.
+void NullRenderDevice::SetVertexBuffer(BufferHandle) noexcept {
+    ++m_FrameStats.StateChanges;
+    ++m_TotalStats.StateChanges;
+}
+
+/// @brief 인덱스 버퍼를 바인딩합니다.
+void NullRenderDevice::SetIndexBuffer(BufferHandle, IndexFormat) noexcept {
+    ++m_FrameStats.StateChanges;
+    ++m_TotalStats.StateChanges;
+}
+
+/// @brief 상수 버퍼를 바인딩합니다.
+void NullRenderDevice::SetConstantBuffer(uint32_t, BufferHandle) noexcept {
+    ++m_FrameStats.StateChanges;
+    ++m_TotalStats.StateChanges;
+}
+
+/// @brief 텍스처를 바인딩합니다.
+void NullRenderDevice::SetTexture(uint32_t, TextureHandle) noexcept {
+    ++m_FrameStats.StateChanges;
+    ++m_TotalStats.StateChanges;
+}
+
+/// @brief 샘플러를 바인딩합니다.
+void NullRenderDevice::SetSampler(uint32_t, SamplerHandle) noexcept {
+    ++m_FrameStats.StateChanges;
+    ++m_TotalStats.StateChanges;
+}
+
+/// @brief 셰이더를 바인딩합니다.
+void NullRenderDevice::SetShader(ShaderStage, ShaderHandle) noexcept {
+    ++m_FrameStats.StateChanges;
+    ++m_TotalStats.StateChanges;
+}
+
+/// @brief 블렌드 상태를 바인딩합니다.
+void NullRenderDevice::SetBlendState(BlendStateHandle) noexcept {
+    ++m_FrameStats.StateChanges;
+    ++m_TotalStats.StateChanges;
+}
+
+/// @brief 깊이 스텐실 상태를 바인딩합니다.
+void NullRenderDevice::SetDepthStencilState(DepthStencilStateHandle) noexcept {
+    ++m_FrameStats.StateChanges;
+    ++m_TotalStats.StateChanges;
+}
+
+/// @brief 래스터라이저 상태를 바인딩합니다.
+void NullRenderDevice::SetRasterizerState(RasterizerStateHandle) noexcept {
+    ++m_FrameStats.StateChanges;
+    ++m_TotalStats.StateChanges;
+}
+
+/// @brief 프리미티브 토폴로지를 설정합니다.
+void NullRenderDevice::SetPrimitiveTopology(PrimitiveTopology) noexcept {
+    ++m_FrameStats.StateChanges;
+    ++m_TotalStats.StateChanges;
+}
+
+/// @brief 드로우를 제출합니다.
+/// @param vertexCount 정점 수
+/// @param startVertex 시작 정점
+void NullRenderDevice::Draw(uint32_t vertexCount, uint32_t) noexcept {
+    ++m_FrameStats.DrawCalls;
+    ++m_TotalStats.DrawCalls;
+    m_FrameStats.Vertices += vertexCount;
+    m_TotalStats.Vertices += vertexCount;
+}
+
+/// @brief 인덱스 드로우를 제출합니다.
+/// @param indexCount 인덱스 수
+/// @param startIndex 시작 인덱스
+/// @param baseVertex 기준 정점
+void NullRenderDevice::DrawIndexed(uint32_t indexCount, uint32_t, int32_t) noexcept {
+    ++m_FrameStats.DrawCalls;
+    ++m_TotalStats.DrawCalls;
+    m_FrameStats.Vertices += indexCount;
+    m_TotalStats.Vertices += indexCount;
+}
+
+/// @brief 마지막으로 완료된 프레임의 통계를 취득합니다.
+/// @return 렌더링 통계
+const RenderStats& NullRenderDevice::GetFrameStats() const noexcept {
+    return m_LastFrameStats;
+}
+
+/// @brief 초기화 이후의 누적 통계를 취득합니다.
+/// @return 렌더링 통계
+const RenderStats& NullRenderDevice::GetTotalStats() const noexcept {
+    return m_TotalStats;
+}
\ No newline at end of file
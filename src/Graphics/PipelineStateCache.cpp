@@ -0,0 +1,166 @@
+#include "Graphics/PipelineStateCache.hpp"
+
+using namespace graphics;
+
+namespace {
+    /// @brief 블렌드 상태 설명을 키로 압축합니다.
+    /// @param desc 블렌드 상태 설명
+    /// @return 키 (필드마다 1바이트)
+    uint64_t getKey(const BlendDesc& desc) noexcept {
+        return static_cast<uint64_t>(desc.BlendEnabled ? 1U : 0U)
+            | (static_cast<uint64_t>(desc.SrcColor) << 8)
+            | (static_cast<uint64_t>(desc.DestColor) << 16)
+            | (static_cast<uint64_t>(desc.ColorOp) << 24)
+            | (static_cast<uint64_t>(desc.SrcAlpha) << 32)
+            | (static_cast<uint64_t>(desc.DestAlpha) << 40)
+            | (static_cast<uint64_t>(desc.AlphaOp) << 48)
+            | (static_cast<uint64_t>(desc.WriteMask & 0x0FU) << 56);
+    }
+
+    /// @brief 깊이 스텐실 상태 설명을 키로 압축합니다.
+    /// @param desc 깊이 스텐실 상태 설명
+    /// @return 키 (필드마다 1바이트)
+    uint64_t getKey(const DepthStencilDesc& desc) noexcept {
+        return static_cast<uint64_t>(desc.DepthEnabled ? 1U : 0U)
+            | (static_cast<uint64_t>(desc.DepthWriteEnabled ? 1U : 0U) << 8)
+            | (static_cast<uint64_t>(desc.DepthFunc) << 16);
+    }
+
+    /// @brief 래스터라이저 상태 설명을 키로 압축합니다.
+    /// @param desc 래스터라이저 상태 설명
+    /// @return 키 (하위 32비트: 플래그, 상위 32비트: 깊이 바이어스)
+    uint64_t getKey(const RasterizerDesc& desc) noexcept {
+        return static_cast<uint64_t>(desc.Fill)
+            | (static_cast<uint64_t>(desc.Cull) << 8)
+            | (static_cast<uint64_t>(desc.FrontCounterClockwise ? 1U : 0U) << 16)
+            | (static_cast<uint64_t>(desc.DepthClipEnabled ? 1U : 0U) << 17)
+            | (static_cast<uint64_t>(desc.ScissorEnabled ? 1U : 0U) << 18)
+            | (static_cast<uint64_t>(static_cast<uint32_t>(desc.DepthBias)) << 32);
+    }
+
+    /// @brief 샘플러 설명을 키로 압축합니다.
+    /// @param desc 샘플러 설명
+    /// @return 키 (필드마다 1바이트)
+    uint64_t getKey(const SamplerDesc& desc) noexcept {
+        return static_cast<uint64_t>(desc.Filter)
+            | (static_cast<uint64_t>(desc.AddressU) << 8)
+            | (static_cast<uint64_t>(desc.AddressV) << 16)
+            | (static_cast<uint64_t>(desc.MaxAnisotropy) << 24);
+    }
+
+    /// @brief 키로 상태 객체를 찾고, 없으면 만들어 등록합니다.
+    /// @param states 키 → 상태 객체
+    /// @param key 키
+    /// @param create 생성 함수
+    /// @param hits 재사용 횟수
+    /// @param misses 생성 횟수
+    /// @param failures 실패 횟수
+    /// @return 상태 객체 핸들 (실패 시 무효 핸들)
+    template <typename Handle, typename Create>
+    Handle findOrCreate(std::unordered_map<uint64_t, Handle>& states, uint64_t key, Create create, uint64_t& hits, uint64_t& misses, uint64_t& failures) noexcept {
+        const auto found = states.find(key);
+        if (found != states.end()) {
+            ++hits;
+            return found->second;
+        }
+
+        const Handle handle = create();
+        if (!handle.IsValid()) {
+            ++failures;
+            return {};
+        }
+
+        states.emplace(key, handle);
+        ++misses;
+        return handle;
+    }
+}
+
+/// @brief 생성자
+/// @param device 렌더 디바이스 (캐시보다 오래 살아있어야 함)
+PipelineStateCache::PipelineStateCache(IRenderDevice& device) noexcept : m_Device(device), m_Hits(0ULL), m_Misses(0ULL), m_Failures(0ULL) {
+
+}
+
+/// @brief 소멸자
+/// @note 모든 상태 객체를 해제하므로 디바이스를 해제하기 전에 소멸시켜야 합니다.
+PipelineStateCache::~PipelineStateCache() noexcept {
+    for (const auto& [key, handle] : m_BlendStates) {
+        m_Device.DestroyBlendState(handle);
+    }
+    for (const auto& [key, handle] : m_DepthStencilStates) {
+        m_Device.DestroyDepthStencilState(handle);
+    }
+    for (const auto& [key, handle] : m_RasterizerStates) {
+        m_Device.DestroyRasterizerState(handle);
+    }
+    for (const auto& [key, handle] : m_Samplers) {
+        m_Device.DestroySampler(handle);
+    }
+}
+
+/// @brief 블렌드 상태를 취득합니다.
+/// @param desc 블렌드 상태 설명
+/// @return 블렌드 상태 핸들 (실패 시 무효 핸들)
+BlendStateHandle PipelineStateCache::GetBlendState(const BlendDesc& desc) noexcept {
+    return findOrCreate(m_BlendStates, getKey(desc), [&]() noexcept { return m_Device.CreateBlendState(desc); }, m_Hits, m_Misses, m_Failures);
+}
+
+/// @brief 깊이 스텐실 상태를 취득합니다.
+/// @param desc 깊이 스텐실 상태 설명
+/// @return 깊이 스텐실 상태 핸들 (실패 시 무효 핸들)
+DepthStencilStateHandle PipelineStateCache::GetDepthStencilState(const DepthStencilDesc& desc) noexcept {
+    return findOrCreate(m_DepthStencilStates, getKey(desc), [&]() noexcept { return m_Device.CreateDepthStencilState(desc); }, m_Hits, m_Misses, m_Failures);
+}
+
+/// @brief 래스터라이저 상태를 취득합니다.
+/// @param desc 래스터라이저 상태 설명
+/// @return 래스터라이저 상태 핸들 (실패 시 무효 핸들)
+RasterizerStateHandle PipelineStateCache::GetRasterizerState(const RasterizerDesc& desc) noexcept {
+    return findOrCreate(m_RasterizerStates, getKey(desc), [&]() noexcept { return m_Device.CreateRasterizerState(desc); }, m_Hits, m_Misses, m_Failures);
+}
+
+/// @brief 샘플러를 취득합니다.
+/// @param desc 샘플러 설명
+/// @return 샘플러 핸들 (실패 시 무효 핸들)
+SamplerHandle PipelineStateCache::GetSampler(const SamplerDesc& desc) noexcept {
+    return findOrCreate(m_Samplers, getKey(desc), [&]() noexcept { return m_Device.CreateSampler(desc); }, m_Hits, m_Misses, m_Failures);
+}
+
+/// @brief 파이프라인 상태를 취득합니다.
+/// @param desc 파이프라인 상태 설명
+/// @param state 결과
+/// @return 성공(true), 실패(false: 상태 객체 생성 실패)
+/// @note 로딩할 때 한 번 취득해 보관하고, 그릴 때는 Bind만 호출해주세요.
+bool PipelineStateCache::GetPipeline(const PipelineDesc& desc, PipelineState& state) noexcept {
+    state.VertexShader  = desc.VertexShader;
+    state.PixelShader   = desc.PixelShader;
+    state.Blend         = GetBlendState(desc.Blend);
+    state.DepthStencil  = GetDepthStencilState(desc.DepthStencil);
+    state.Rasterizer    = GetRasterizerState(desc.Rasterizer);
+    state.Topology      = desc.Topology;
+    return state.Blend.IsValid() && state.DepthStencil.IsValid() && state.Rasterizer.IsValid();
+}
+
+/// @brief 통계를 취득합니다.
+/// @return 통계
+PipelineCacheStats PipelineStateCache::GetStats() const noexcept {
+    PipelineCacheStats stats;
+    stats.Hits          = m_Hits;
+    stats.Misses        = m_Misses;
+    stats.Failures      = m_Failures;
+    stats.StateCount    = static_cast<uint32_t>(m_BlendStates.size() + m_DepthStencilStates.size() + m_RasterizerStates.size() + m_Samplers.size());
+    return stats;
+}
+
+/// @brief 파이프라인 상태를 바인딩합니다.
+/// @param device 렌더 디바이스 (RenderContext를 넘기면 이미 바인딩된 항목은 걸러짐)
+/// @param state 파이프라인 상태
+void PipelineStateCache::Bind(IRenderDevice& device, const PipelineState& state) noexcept {
+    device.SetShader(ShaderStage::Vertex, state.VertexShader);
+    device.SetShader(ShaderStage::Pixel, state.PixelShader);
+    device.SetBlendState(state.Blend);
+    device.SetDepthStencilState(state.DepthStencil);
+    device.SetRasterizerState(state.Rasterizer);
+    device.SetPrimitiveTopology(state.Topology);
+}
\ No newline at end of file
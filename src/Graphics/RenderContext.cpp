@@ -0,0 +1,370 @@
+#include "Graphics/RenderContext.hpp"
+#include <algorithm>
+#include <iterator>
+
+using namespace graphics;
+
+/// @brief 생성자
+/// @param device 렌더 디바이스 (래퍼보다 오래 살아있어야 함)
+RenderContext::RenderContext(IRenderDevice& device) noexcept : m_Device(device) {
+    Invalidate();
+}
+
+/// @brief 바인딩할 값을 사본과 비교합니다.
+/// @param bound 사본
+/// @param value 바인딩할 값
+/// @return 전달 필요(true: 사본 갱신), 중복(false)
+bool RenderContext::filter(uint32_t& bound, uint32_t value) noexcept {
+    if (bound == value) {
+        ++m_FrameStats.Filtered;
+        return false;
+    }
+
+    bound = value;
+    ++m_FrameStats.Issued;
+    return true;
+}
+
+/// @brief 바인딩 사본을 비웁니다.
+/// @note 이후 각 항목의 첫 바인딩은 값과 관계없이 디바이스로 전달됩니다.
+void RenderContext::Invalidate() noexcept {
+    m_VertexBuffer      = UNKNOWN;
+    m_IndexBuffer       = UNKNOWN;
+    m_IndexFormat       = UNKNOWN;
+    m_VertexShader      = UNKNOWN;
+    m_PixelShader       = UNKNOWN;
+    m_BlendState        = UNKNOWN;
+    m_DepthStencilState = UNKNOWN;
+    m_RasterizerState   = UNKNOWN;
+    m_Topology          = UNKNOWN;
+    std::fill(std::begin(m_ConstantBuffers), std::end(m_ConstantBuffers), UNKNOWN);
+    std::fill(std::begin(m_Textures), std::end(m_Textures), UNKNOWN);
+    std::fill(std::begin(m_Samplers), std::end(m_Samplers), UNKNOWN);
+}
+
+/// @brief 디바이스를 초기화합니다.
+/// @param nativeHandle 윈도우의 핸들
+/// @param width 너비
+/// @param height 높이
+/// @param fullscreenEnabled 전체화면 활성화 유무
+/// @param vsyncEnabled 수직 동기화 활성화 유무
+/// @return 성공(true), 실패(false)
+bool RenderContext::Initialize(void* nativeHandle, int32_t width, int32_t height, bool fullscreenEnabled, bool vsyncEnabled) noexcept {
+    Invalidate();
+    return m_Device.Initialize(nativeHandle, width, height, fullscreenEnabled, vsyncEnabled);
+}
+
+/// @brief V-Sync 활성화 유무를 취득합니다.
+/// @return 활성화(true), 비활성화(false)
+bool RenderContext::IsVSyncEnabled() const noexcept {
+    return m_Device.IsVSyncEnabled();
+}
+
+/// @brief 프레임을 시작합니다.
+/// @param color 색상
+void RenderContext::BeginFrame(float color[4]) noexcept {
+    Invalidate();
+    m_Device.BeginFrame(color);
+}
+
+/// @brief 프레임을 종료합니다.
+/// @note 이번 프레임의 바인딩 필터 통계가 확정됩니다.
+void RenderContext::EndFrame() noexcept {
+    m_Device.EndFrame();
+
+    m_LastFrameStats = m_FrameStats;
+    m_FrameStats = {};
+}
+
+/// @brief 화면의 크기를 변경합니다.
+/// @param width 너비
+/// @param height 높이
+/// @return 성공(true), 실패(false)
+bool RenderContext::Resize(int32_t width, int32_t height) noexcept {
+    Invalidate();
+    return m_Device.Resize(width, height);
+}
+
+/// @brief V-Sync 활성화를 설정합니다.
+/// @param enabled 활성화 유무
+void RenderContext::SetVSync(bool enabled) noexcept {
+    m_Device.SetVSync(enabled);
+}
+
+/// @brief 버퍼를 생성합니다.
+/// @param desc 버퍼 설명
+/// @param data 초기 데이터
+/// @return 버퍼 핸들 (실패 시 무효 핸들)
+BufferHandle RenderContext::CreateBuffer(const BufferDesc& desc, const void* data) noexcept {
+    return m_Device.CreateBuffer(desc, data);
+}
+
+/// @brief 버퍼의 내용을 갱신합니다.
+/// @param handle 버퍼 핸들
+/// @param data 데이터
+/// @param size 크기 (바이트 단위)
+/// @return 성공(true), 실패(false)
+/// @note 바인딩된 버퍼를 갱신해도 바인딩은 유지되므로 사본은 그대로 둡니다.
+bool RenderContext::UpdateBuffer(BufferHandle handle, const void* data, uint32_t size) noexcept {
+    return m_Device.UpdateBuffer(handle, data, size);
+}
+
+/// @brief 버퍼를 해제합니다.
+/// @param handle 버퍼 핸들
+/// @note 해제한 버퍼가 사본에 남아 있으면 비워서, 같은 식별자가 다시 쓰이더라도 잘못 걸러지지 않게 합니다.
+void RenderContext::DestroyBuffer(BufferHandle handle) noexcept {
+    if (m_VertexBuffer == handle.ID) {
+        m_VertexBuffer = UNKNOWN;
+    }
+    if (m_IndexBuffer == handle.ID) {
+        m_IndexBuffer = UNKNOWN;
+    }
+    std::replace(std::begin(m_ConstantBuffers), std::end(m_ConstantBuffers), handle.ID, UNKNOWN);
+    m_Device.DestroyBuffer(handle);
+}
+
+/// @brief 텍스처를 생성합니다.
+/// @param desc 텍스처 설명
+/// @param data 초기 데이터
+/// @return 텍스처 핸들 (실패 시 무효 핸들)
+TextureHandle RenderContext::CreateTexture(const TextureDesc& desc, const void* data) noexcept {
+    return m_Device.CreateTexture(desc, data);
+}
+
+/// @brief 텍스처를 해제합니다.
+/// @param handle 텍스처 핸들
+void RenderContext::DestroyTexture(TextureHandle handle) noexcept {
+    std::replace(std::begin(m_Textures), std::end(m_Textures), handle.ID, UNKNOWN);
+    m_Device.DestroyTexture(handle);
+}
+
+/// @brief 텍스처 형식을 지원하는지 확인합니다.
+/// @param format 텍스처 형식
+/// @return 지원(true), 미지원(false)
+bool RenderContext::IsTextureFormatSupported(TextureFormat format) const noexcept {
+    return m_Device.IsTextureFormatSupported(format);
+}
+
+/// @brief 셰이더를 생성합니다.
+/// @param desc 셰이더 설명
+/// @param code 바이트 코드
+/// @param size 바이트 코드 크기
+/// @return 셰이더 핸들 (실패 시 무효 핸들)
+ShaderHandle RenderContext::CreateShader(const ShaderDesc& desc, const void* code, size_t size) noexcept {
+    return m_Device.CreateShader(desc, code, size);
+}
+
+/// @brief 셰이더를 해제합니다.
+/// @param handle 셰이더 핸들
+void RenderContext::DestroyShader(ShaderHandle handle) noexcept {
+    if (m_VertexShader == handle.ID) {
+        m_VertexShader = UNKNOWN;
+    }
+    if (m_PixelShader == handle.ID) {
+        m_PixelShader = UNKNOWN;
+    }
+    m_Device.DestroyShader(handle);
+}
+
+/// @brief 블렌드 상태를 생성합니다.
+/// @param desc 블렌드 상태 설명
+/// @return 블렌드 상태 핸들 (실패 시 무효 핸들)
+BlendStateHandle RenderContext::CreateBlendState(const BlendDesc& desc) noexcept {
+    return m_Device.CreateBlendState(desc);
+}
+
+/// @brief 깊이 스텐실 상태를 생성합니다.
+/// @param desc 깊이 스텐실 상태 설명
+/// @return 깊이 스텐실 상태 핸들 (실패 시 무효 핸들)
+DepthStencilStateHandle RenderContext::CreateDepthStencilState(const DepthStencilDesc& desc) noexcept {
+    return m_Device.CreateDepthStencilState(desc);
+}
+
+/// @brief 래스터라이저 상태를 생성합니다.
+/// @param desc 래스터라이저 상태 설명
+/// @return 래스터라이저 상태 핸들 (실패 시 무효 핸들)
+RasterizerStateHandle RenderContext::CreateRasterizerState(const RasterizerDesc& desc) noexcept {
+    return m_Device.CreateRasterizerState(desc);
+}
+
+/// @brief 샘플러를 생성합니다.
+/// @param desc 샘플러 설명
+/// @return 샘플러 핸들 (실패 시 무효 핸들)
+SamplerHandle RenderContext::CreateSampler(const SamplerDesc& desc) noexcept {
+    return m_Device.CreateSampler(desc);
+}
+
+/// @brief 블렌드 상태를 해제합니다.
+/// @param handle 블렌드 상태 핸들
+void RenderContext::DestroyBlendState(BlendStateHandle handle) noexcept {
+    if (m_BlendState == handle.ID) {
+        m_BlendState = UNKNOWN;
+    }
+    m_Device.DestroyBlendState(handle);
+}
+
+/// @brief 깊이 스텐실 상태를 해제합니다.
+/// @param handle 깊이 스텐실 상태 핸들
+void RenderContext::DestroyDepthStencilState(DepthStencilStateHandle handle) noexcept {
+    if (m_DepthStencilState == handle.ID) {
+        m_DepthStencilState = UNKNOWN;
+    }
+    m_Device.DestroyDepthStencilState(handle);
+}
+
+/// @brief 래스터라이저 상태를 해제합니다.
+/// @param handle 래스터라이저 상태 핸들
+void RenderContext::DestroyRasterizerState(RasterizerStateHandle handle) noexcept {
+    if (m_RasterizerState == handle.ID) {
+        m_RasterizerState = UNKNOWN;
+    }
+    m_Device.DestroyRasterizerState(handle);
+}
+
+/// @brief 샘플러를 해제합니다.
+/// @param handle 샘플러 핸들
+void RenderContext::DestroySampler(SamplerHandle handle) noexcept {
+    std::replace(std::begin(m_Samplers), std::end(m_Samplers), handle.ID, UNKNOWN);
+    m_Device.DestroySampler(handle);
+}
+
+/// @brief 백 버퍼의 설명을 취득합니다.
+/// @return 텍스처 설명
+TextureDesc RenderContext::GetBackBufferDesc() const noexcept {
+    return m_Device.GetBackBufferDesc();
+}
+
+/// @brief 백 버퍼의 내용을 텍스처로 복사합니다.
+/// @param handle 텍스처 핸들
+/// @return 성공(true), 실패(false)
+bool RenderContext::CopyBackBufferToTexture(TextureHandle handle) noexcept {
+    return m_Device.CopyBackBufferToTexture(handle);
+}
+
+/// @brief 텍스처의 내용을 백 버퍼로 복사합니다.
+/// @param handle 텍스처 핸들
+/// @return 성공(true), 실패(false)
+bool RenderContext::CopyTextureToBackBuffer(TextureHandle handle) noexcept {
+    return m_Device.CopyTextureToBackBuffer(handle);
+}
+
+/// @brief 정점 버퍼를 바인딩합니다.
+/// @param handle 버퍼 핸들
+void RenderContext::SetVertexBuffer(BufferHandle handle) noexcept {
+    if (filter(m_VertexBuffer, handle.ID)) {
+        m_Device.SetVertexBuffer(handle);
+    }
+}
+
+/// @brief 인덱스 버퍼를 바인딩합니다.
+/// @param handle 버퍼 핸들
+/// @param format 인덱스 형식
+void RenderContext::SetIndexBuffer(BufferHandle handle, IndexFormat format) noexcept {
+    if (m_IndexBuffer == handle.ID && m_IndexFormat == static_cast<uint32_t>(format)) {
+        ++m_FrameStats.Filtered;
+        return;
+    }
+
+    m_IndexBuffer = handle.ID;
+    m_IndexFormat = static_cast<uint32_t>(format);
+    ++m_FrameStats.Issued;
+    m_Device.SetIndexBuffer(handle, format);
+}
+
+/// @brief 상수 버퍼를 바인딩합니다.
+/// @param slot 슬롯
+/// @param handle 버퍼 핸들
+void RenderContext::SetConstantBuffer(uint32_t slot, BufferHandle handle) noexcept {
+    if (slot >= MAX_CONSTANT_BUFFERS) {
+        ++m_FrameStats.Issued;
+        m_Device.SetConstantBuffer(slot, handle);
+    } else if (filter(m_ConstantBuffers[slot], handle.ID)) {
+        m_Device.SetConstantBuffer(slot, handle);
+    }
+}
+
+/// @brief 텍스처를 바인딩합니다.
+/// @param slot 슬롯
+/// @param handle 텍스처 핸들
+void RenderContext::SetTexture(uint32_t slot, TextureHandle handle) noexcept {
+    if (slot >= MAX_TEXTURES) {
+        ++m_FrameStats.Issued;
+        m_Device.SetTexture(slot, handle);
+    } else if (filter(m_Textures[slot], handle.ID)) {
+        m_Device.SetTexture(slot, handle);
+    }
+}
+
+/// @brief 샘플러를 바인딩합니다.
+/// @param slot 슬롯
+/// @param handle 샘플러 핸들
+void RenderContext::SetSampler(uint32_t slot, SamplerHandle handle) noexcept {
+    if (slot >= MAX_SAMPLERS) {
+        ++m_FrameStats.Issued;
+        m_Device.SetSampler(slot, handle);
+    } else if (filter(m_Samplers[slot], handle.ID)) {
+        m_Device.SetSampler(slot, handle);
+    }
+}
+
+/// @brief 셰이더를 바인딩합니다.
+/// @param stage 단계
+/// @param handle 셰이더 핸들
+void RenderContext::SetShader(ShaderStage stage, ShaderHandle handle) noexcept {
+    if (filter((stage == ShaderStage::Vertex) ? m_VertexShader : m_PixelShader, handle.ID)) {
+        m_Device.SetShader(stage, handle);
+    }
+}
+
+/// @brief 블렌드 상태를 바인딩합니다.
+/// @param handle 블렌드 상태 핸들
+void RenderContext::SetBlendState(BlendStateHandle handle) noexcept {
+    if (filter(m_BlendState, handle.ID)) {
+        m_Device.SetBlendState(handle);
+    }
+}
+
+/// @brief 깊이 스텐실 상태를 바인딩합니다.
+/// @param handle 깊이 스텐실 상태 핸들
+void RenderContext::SetDepthStencilState(DepthStencilStateHandle handle) noexcept {
+    if (filter(m_DepthStencilState, handle.ID)) {
+        m_Device.SetDepthStencilState(handle);
+    }
+}
+
+/// @brief 래스터라이저 상태를 바인딩합니다.
+/// @param handle 래스터라이저 상태 핸들
+void RenderContext::SetRasterizerState(RasterizerStateHandle handle) noexcept {
+    if (filter(m_RasterizerState, handle.ID)) {
+        m_Device.SetRasterizerState(handle);
+    }
+}
+
+/// @brief 프리미티브 토폴로지를 설정합니다.
+/// @param topology 프리미티브 토폴로지
+void RenderContext::SetPrimitiveTopology(PrimitiveTopology topology) noexcept {
+    if (filter(m_Topology, static_cast<uint32_t>(topology))) {
+        m_Device.SetPrimitiveTopology(topology);
+    }
+}
+
+/// @brief 드로우를 제출합니다.
+/// @param vertexCount 정점 수
+/// @param startVertex 시작 정점
+void RenderContext::Draw(uint32_t vertexCount, uint32_t startVertex) noexcept {
+    m_Device.Draw(vertexCount, startVertex);
+}
+
+/// @brief 인덱스 드로우를 제출합니다.
+/// @param indexCount 인덱스 수
+/// @param startIndex 시작 인덱스
+/// @param baseVertex 기준 정점
+void RenderContext::DrawIndexed(uint32_t indexCount, uint32_t startIndex, int32_t baseVertex) noexcept {
+    m_Device.DrawIndexed(indexCount, startIndex, baseVertex);
+}
+
+/// @brief 마지막으로 완료된 프레임의 통계를 취득합니다.
+/// @return 디바이스의 통계 (StateChanges는 걸러지고 남은 호출 수)
+const RenderStats& RenderContext::GetFrameStats() const noexcept {
+    return m_Device.GetFrameStats();
+}
\ No newline at end of file
@@ -0,0 +1,396 @@
+#include <cstring>
+#include "Graphics/ResourceManager.hpp"
+#include "Type/Hash.hpp"
+
+using namespace graphics;
+
+namespace {
+    /// @brief 내용 해시와 설명을 결합해 중복 제거 키를 만듭니다.
+    /// @param content 내용 해시
+    /// @param a 설명 값
+    /// @param b 설명 값
+    /// @param c 설명 값
+    /// @return 키 (0은 공유하지 않음을 뜻하므로 피함)
+    uint64_t makeKey(uint64_t content, uint64_t a, uint64_t b, uint64_t c) noexcept {
+        const uint64_t key = HashCombine(HashCombine(HashCombine(content, a), b), c);
+        return (key != 0ULL) ? key : 1ULL;
+    }
+}
+
+/// @brief 생성자
+/// @param device 렌더 디바이스 (관리자보다 오래 살아있어야 함)
+ResourceManager::ResourceManager(IRenderDevice& device) noexcept : m_Device(device), m_Frame(0ULL), m_PendingBytes(0ULL), m_SharedBytes(0ULL), m_SharedCount(0ULL), m_CollisionCount(0ULL), m_DestroyedCount(0ULL), m_VerifyContent(false) {
+
+}
+
+/// @brief 소멸자
+/// @note 남은 참조와 관계없이 모든 리소스를 해제하므로, GPU가 작업을 마친 뒤(디바이스 해제 직전)에 소멸시켜야 합니다.
+ResourceManager::~ResourceManager() noexcept {
+    for (size_t kind = 0U; kind < static_cast<size_t>(Kind::Count); ++kind) {
+        std::vector<uint32_t> ids;
+        ids.reserve(m_Pools[kind].Entries.size());
+        for (const auto& [id, entry] : m_Pools[kind].Entries) {
+            ids.push_back(id);
+        }
+        for (const uint32_t id : ids) {
+            destroy(static_cast<Kind>(kind), id);
+        }
+    }
+}
+
+/// @brief 키로 기존 리소스를 찾아 참조를 추가합니다.
+/// @param kind 종류
+/// @param key 중복 제거 키 (0: 공유하지 않음)
+/// @param data 내용
+/// @param bytes 내용 크기
+/// @param collided 키는 같지만 내용이 다른지 여부 (내용 검증을 켰을 때만 설정)
+/// @return 핸들 식별자 (없으면 0)
+/// @note m_Mutex를 잠근 상태에서 호출합니다. 해제 대기 중인 리소스는 되살립니다.
+uint32_t ResourceManager::find(Kind kind, uint64_t key, const void* data, uint64_t bytes, bool& collided) noexcept {
+    collided = false;
+    Pool& pool = m_Pools[static_cast<size_t>(kind)];
+    const auto found = (key != 0ULL) ? pool.Keys.find(key) : pool.Keys.end();
+    if (found == pool.Keys.end()) {
+        return 0U;
+    }
+
+    // 내용 사본이 있으면 공유하기 전에 바이트 단위로 비교
+    Entry& entry = pool.Entries[found->second];
+    if (!entry.Content.empty() && (entry.Content.size() != bytes || std::memcmp(entry.Content.data(), data, static_cast<size_t>(bytes)) != 0)) {
+        collided = true;
+        return 0U;
+    }
+
+    if (entry.RefCount == 0U) {
+        m_PendingBytes -= entry.Bytes;
+    }
+    ++entry.RefCount;
+    m_SharedBytes += entry.Bytes;
+    ++m_SharedCount;
+    return found->second;
+}
+
+/// @brief 새로 만든 리소스를 등록합니다.
+/// @param kind 종류
+/// @param id 새로 만든 리소스의 핸들 식별자
+/// @param key 중복 제거 키 (0: 공유하지 않음)
+/// @param data 내용 (내용 검증을 켰으면 사본을 둠)
+/// @param bytes 크기
+/// @return 사용할 핸들 식별자 (id가 아니면 다른 스레드가 같은 내용을 먼저 등록했으므로 id를 해제해야 함)
+/// @note 키가 충돌하면 새 리소스는 공유하지 않는 리소스로 등록합니다.
+uint32_t ResourceManager::insert(Kind kind, uint32_t id, uint64_t key, const void* data, uint64_t bytes) noexcept {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    bool collided = false;
+    const uint32_t existing = find(kind, key, data, bytes, collided);
+    if (existing != 0U) {
+        return existing;
+    }
+    if (collided) {
+        ++m_CollisionCount;
+        key = 0ULL;
+    }
+
+    Pool& pool = m_Pools[static_cast<size_t>(kind)];
+    Entry& entry = pool.Entries[id];
+    entry = { key, bytes, 0ULL, 1U, {} };
+    pool.Bytes += bytes;
+    if (key != 0ULL) {
+        pool.Keys[key] = id;
+        if (m_VerifyContent) {
+            const byte_t* content = static_cast<const byte_t*>(data);
+            entry.Content.assign(content, content + bytes);
+        }
+    }
+    return id;
+}
+
+/// @brief 참조를 추가합니다.
+/// @param kind 종류
+/// @param id 핸들 식별자
+/// @return 성공(true), 실패(false: 관리 중인 리소스가 아님)
+bool ResourceManager::addRef(Kind kind, uint32_t id) noexcept {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    Pool& pool = m_Pools[static_cast<size_t>(kind)];
+    const auto found = pool.Entries.find(id);
+    if (found == pool.Entries.end()) {
+        return false;
+    }
+
+    if (found->second.RefCount == 0U) {
+        m_PendingBytes -= found->second.Bytes;
+    }
+    ++found->second.RefCount;
+    return true;
+}
+
+/// @brief 참조를 해제합니다.
+/// @param kind 종류
+/// @param id 핸들 식별자
+/// @note 참조가 0이 되면 해제 대기 목록에 넣습니다.
+void ResourceManager::release(Kind kind, uint32_t id) noexcept {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    Pool& pool = m_Pools[static_cast<size_t>(kind)];
+    const auto found = pool.Entries.find(id);
+    if (found == pool.Entries.end() || found->second.RefCount == 0U) {
+        return;
+    }
+
+    Entry& entry = found->second;
+    if (--entry.RefCount == 0U) {
+        entry.ReleaseFrame = m_Frame;
+        m_PendingBytes += entry.Bytes;
+        m_Pending.push_back({ kind, id, m_Frame });
+    }
+}
+
+/// @brief 리소스를 디바이스에서 해제합니다.
+/// @param kind 종류
+/// @param id 핸들 식별자
+void ResourceManager::destroy(Kind kind, uint32_t id) noexcept {
+    Pool& pool = m_Pools[static_cast<size_t>(kind)];
+    const auto found = pool.Entries.find(id);
+    if (found == pool.Entries.end()) {
+        return;
+    }
+
+    const Entry& entry = found->second;
+    if (entry.Key != 0ULL) {
+        pool.Keys.erase(entry.Key);
+    }
+    if (entry.RefCount == 0U) {
+        m_PendingBytes -= entry.Bytes;
+    }
+    pool.Bytes -= entry.Bytes;
+    pool.Entries.erase(found);
+
+    switch (kind) {
+        case Kind::Texture: m_Device.DestroyTexture({ id });    break;
+        case Kind::Buffer:  m_Device.DestroyBuffer({ id });     break;
+        case Kind::Shader:  m_Device.DestroyShader({ id });     break;
+        case Kind::Count:   break;
+    }
+    ++m_DestroyedCount;
+}
+
+/// @brief 텍스처를 취득합니다.
+/// @param desc 텍스처 설명
+/// @param data 초기 데이터 (nullptr이면 공유하지 않음)
+/// @param key 내용 키 (0이면 데이터의 해시를 계산, 쿠킹된 자산처럼 내용 해시를 이미 알면 넘겨서 해시 계산을 생략)
+/// @return 텍스처 핸들 (실패 시 무효 핸들)
+/// @note 설명과 내용이 같은 텍스처가 있으면 새로 만들지 않고 참조만 추가합니다. 다 쓰면 Release를 호출해주세요.
+TextureHandle ResourceManager::AcquireTexture(const TextureDesc& desc, const void* data, uint64_t key) noexcept {
+    if (!IsValidTextureDesc(desc)) {
+        return {};
+    }
+
+    const uint64_t bytes = GetTextureDataSize(desc);
+    if (data) {
+        const uint64_t content = (key != 0ULL) ? key : Hash64(data, static_cast<size_t>(bytes));
+        key = makeKey(content, (static_cast<uint64_t>(desc.Width) << 32) | static_cast<uint32_t>(desc.Height), static_cast<uint64_t>(desc.Format), desc.MipLevels);
+    } else {
+        key = 0ULL;
+    }
+
+    if (key != 0ULL) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        bool collided = false;
+        const uint32_t id = find(Kind::Texture, key, data, bytes, collided);
+        if (id != 0U) {
+            return { id };
+        }
+    }
+
+    // 업로드는 잠금 밖에서 하고, 등록할 때 키를 다시 확인
+    const TextureHandle handle = m_Device.CreateTexture(desc, data);
+    if (!handle.IsValid()) {
+        return handle;
+    }
+    const uint32_t id = insert(Kind::Texture, handle.ID, key, data, bytes);
+    if (id != handle.ID) {
+        m_Device.DestroyTexture(handle);
+    }
+    return { id };
+}
+
+/// @brief 버퍼를 취득합니다.
+/// @param desc 버퍼 설명
+/// @param data 초기 데이터 (nullptr 가능, Immutable은 필수)
+/// @param key 내용 키 (0이면 데이터의 해시를 계산)
+/// @return 버퍼 핸들 (실패 시 무효 핸들)
+/// @note 내용이 바뀌지 않는 Immutable 버퍼만 공유하며, 갱신할 수 있는 버퍼는 항상 새로 만듭니다.
+BufferHandle ResourceManager::AcquireBuffer(const BufferDesc& desc, const void* data, uint64_t key) noexcept {
+    if (data && desc.Usage == BufferUsage::Immutable) {
+        const uint64_t content = (key != 0ULL) ? key : Hash64(data, desc.Size);
+        key = makeKey(content, desc.Size, static_cast<uint64_t>(desc.Type), desc.Stride);
+    } else {
+        key = 0ULL;
+    }
+
+    if (key != 0ULL) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        bool collided = false;
+        const uint32_t id = find(Kind::Buffer, key, data, desc.Size, collided);
+        if (id != 0U) {
+            return { id };
+        }
+    }
+
+    const BufferHandle handle = m_Device.CreateBuffer(desc, data);
+    if (!handle.IsValid()) {
+        return handle;
+    }
+    const uint32_t id = insert(Kind::Buffer, handle.ID, key, data, desc.Size);
+    if (id != handle.ID) {
+        m_Device.DestroyBuffer(handle);
+    }
+    return { id };
+}
+
+/// @brief 셰이더를 취득합니다.
+/// @param desc 셰이더 설명
+/// @param code 바이트 코드
+/// @param size 바이트 코드 크기
+/// @return 셰이더 핸들 (실패 시 무효 핸들)
+/// @note 단계, 입력 배치, 바이트 코드가 같은 셰이더는 공유합니다.
+ShaderHandle ResourceManager::AcquireShader(const ShaderDesc& desc, const void* code, size_t size) noexcept {
+    if (!code || size == 0U) {
+        return {};
+    }
+
+    const uint64_t key = makeKey(Hash64(code, size), size, static_cast<uint64_t>(desc.Stage), static_cast<uint64_t>(desc.Layout));
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        bool collided = false;
+        const uint32_t id = find(Kind::Shader, key, code, size, collided);
+        if (id != 0U) {
+            return { id };
+        }
+    }
+
+    const ShaderHandle handle = m_Device.CreateShader(desc, code, size);
+    if (!handle.IsValid()) {
+        return handle;
+    }
+    const uint32_t id = insert(Kind::Shader, handle.ID, key, code, size);
+    if (id != handle.ID) {
+        m_Device.DestroyShader(handle);
+    }
+    return { id };
+}
+
+/// @brief 텍스처의 참조를 추가합니다.
+/// @param handle 텍스처 핸들
+/// @return 성공(true), 실패(false: 관리 중인 텍스처가 아님)
+bool ResourceManager::AddRef(TextureHandle handle) noexcept {
+    return addRef(Kind::Texture, handle.ID);
+}
+
+/// @brief 버퍼의 참조를 추가합니다.
+/// @param handle 버퍼 핸들
+/// @return 성공(true), 실패(false: 관리 중인 버퍼가 아님)
+bool ResourceManager::AddRef(BufferHandle handle) noexcept {
+    return addRef(Kind::Buffer, handle.ID);
+}
+
+/// @brief 셰이더의 참조를 추가합니다.
+/// @param handle 셰이더 핸들
+/// @return 성공(true), 실패(false: 관리 중인 셰이더가 아님)
+bool ResourceManager::AddRef(ShaderHandle handle) noexcept {
+    return addRef(Kind::Shader, handle.ID);
+}
+
+/// @brief 텍스처의 참조를 해제합니다.
+/// @param handle 텍스처 핸들
+void ResourceManager::Release(TextureHandle handle) noexcept {
+    release(Kind::Texture, handle.ID);
+}
+
+/// @brief 버퍼의 참조를 해제합니다.
+/// @param handle 버퍼 핸들
+void ResourceManager::Release(BufferHandle handle) noexcept {
+    release(Kind::Buffer, handle.ID);
+}
+
+/// @brief 셰이더의 참조를 해제합니다.
+/// @param handle 셰이더 핸들
+void ResourceManager::Release(ShaderHandle handle) noexcept {
+    release(Kind::Shader, handle.ID);
+}
+
+/// @brief 프레임을 마칩니다.
+/// @note 디바이스의 EndFrame 직후에 호출하며, 참조가 0이 된 뒤 FRAME_LATENCY 프레임이 지난 리소스를 디바이스에서 해제합니다.
+void ResourceManager::EndFrame() noexcept {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    ++m_Frame;
+
+    size_t count = 0U;
+    for (; count < m_Pending.size(); ++count) {
+        const Pending& pending = m_Pending[count];
+        if (pending.Frame + FRAME_LATENCY > m_Frame) {
+            break;
+        }
+
+        // 대기 중에 되살아났거나 다시 대기 목록에 들어간 리소스는 건너뜀
+        const Pool& pool = m_Pools[static_cast<size_t>(pending.Type)];
+        const auto found = pool.Entries.find(pending.ID);
+        if (found != pool.Entries.end() && found->second.RefCount == 0U && found->second.ReleaseFrame == pending.Frame) {
+            destroy(pending.Type, pending.ID);
+        }
+    }
+    m_Pending.erase(m_Pending.begin(), m_Pending.begin() + static_cast<std::ptrdiff_t>(count));
+}
+
+/// @brief 해제 대기 중인 리소스를 모두 해제합니다.
+/// @note GPU가 작업을 모두 마친 것이 확실할 때(씬 전환 후 디바이스 유휴 상태 등)만 호출해주세요.
+void ResourceManager::FlushPending() noexcept {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    for (const Pending& pending : m_Pending) {
+        const Pool& pool = m_Pools[static_cast<size_t>(pending.Type)];
+        const auto found = pool.Entries.find(pending.ID);
+        if (found != pool.Entries.end() && found->second.RefCount == 0U) {
+            destroy(pending.Type, pending.ID);
+        }
+    }
+    m_Pending.clear();
+}
+
+/// @brief 공유 전 내용 비교 여부를 설정합니다.
+/// @param verify 비교 여부 (공유하는 리소스마다 내용 사본을 두므로 개발, 진단용)
+/// @note 켜기 전에 등록된 리소스는 사본이 없으므로 비교하지 않습니다. 리소스를 취득하기 전에 설정해주세요.
+void ResourceManager::SetVerifyContent(bool verify) noexcept {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_VerifyContent = verify;
+}
+
+/// @brief 사용량을 취득합니다.
+/// @return 사용량
+ResourceUsage ResourceManager::GetUsage() const noexcept {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    const Pool& textures    = m_Pools[static_cast<size_t>(Kind::Texture)];
+    const Pool& buffers     = m_Pools[static_cast<size_t>(Kind::Buffer)];
+    const Pool& shaders     = m_Pools[static_cast<size_t>(Kind::Shader)];
+
+    ResourceUsage usage;
+    usage.TextureBytes      = textures.Bytes;
+    usage.BufferBytes       = buffers.Bytes;
+    usage.ShaderBytes       = shaders.Bytes;
+    usage.PendingBytes      = m_PendingBytes;
+    usage.SharedBytes       = m_SharedBytes;
+    usage.TextureCount      = static_cast<uint32_t>(textures.Entries.size());
+    usage.BufferCount       = static_cast<uint32_t>(buffers.Entries.size());
+    usage.ShaderCount       = static_cast<uint32_t>(shaders.Entries.size());
+    usage.SharedCount       = m_SharedCount;
+    usage.CollisionCount    = m_CollisionCount;
+    usage.DestroyedCount    = m_DestroyedCount;
+
+    size_t pendingCount = 0U;
+    for (const Pool& pool : m_Pools) {
+        for (const auto& [id, entry] : pool.Entries) {
+            pendingCount += (entry.RefCount == 0U) ? 1U : 0U;
+        }
+    }
+    usage.PendingCount      = static_cast<uint32_t>(pendingCount);
+    return usage;
+}
\ No newline at end of file
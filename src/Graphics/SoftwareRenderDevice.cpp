@@ -0,0 +1,1337 @@
+#include "Graphics/SoftwareRenderDevice.hpp"
+#include "Type/SIMD.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+using namespace graphics;
+
+namespace {
+    /// @brief 한 번에 처리하는 픽셀 묶음 (레인)
+    /// @note 빌드 대상에 따라 AVX2(8), SSE2(4), 스칼라(1) 중 하나가 선택됩니다.
+#if defined(NEOXOPS_SIMD_AVX2)
+    struct Lanes final {
+        static constexpr int32_t COUNT = 8;
+        using F = __m256;
+        using I = __m256i;
+
+        static F SetF(float v) noexcept { return _mm256_set1_ps(v); }
+        static I SetI(int32_t v) noexcept { return _mm256_set1_epi32(v); }
+        static F IndexF() noexcept { return _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f); }
+        static I LoadI(const void* p) noexcept { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+        static void StoreI(void* p, I v) noexcept { _mm256_storeu_si256(static_cast<__m256i*>(p), v); }
+        static void StoreF(float* p, F v) noexcept { _mm256_storeu_ps(p, v); }
+        static I AddI(I a, I b) noexcept { return _mm256_add_epi32(a, b); }
+        static I OrI(I a, I b) noexcept { return _mm256_or_si256(a, b); }
+        static I AndI(I a, I b) noexcept { return _mm256_and_si256(a, b); }
+        static I AndNotI(I a, I b) noexcept { return _mm256_andnot_si256(a, b); }
+        static I CmpGtI(I a, I b) noexcept { return _mm256_cmpgt_epi32(a, b); }
+        static I SignI(I a) noexcept { return _mm256_srai_epi32(a, 31); }
+        template <int N> static I SllI(I a) noexcept { return _mm256_slli_epi32(a, N); }
+        static int32_t MoveMask(I a) noexcept { return _mm256_movemask_ps(_mm256_castsi256_ps(a)); }
+        static I Select(I mask, I a, I b) noexcept { return _mm256_blendv_epi8(b, a, mask); }
+        static F AddF(F a, F b) noexcept { return _mm256_add_ps(a, b); }
+        static F MulF(F a, F b) noexcept { return _mm256_mul_ps(a, b); }
+        static F DivF(F a, F b) noexcept { return _mm256_div_ps(a, b); }
+        static F ClampF(F a, F lo, F hi) noexcept { return _mm256_min_ps(_mm256_max_ps(a, lo), hi); }
+        static I ToI(F a) noexcept { return _mm256_cvttps_epi32(a); }
+    };
+#elif defined(NEOXOPS_SIMD_SSE2)
+    struct Lanes final {
+        static constexpr int32_t COUNT = 4;
+        using F = __m128;
+        using I = __m128i;
+
+        static F SetF(float v) noexcept { return _mm_set1_ps(v); }
+        static I SetI(int32_t v) noexcept { return _mm_set1_epi32(v); }
+        static F IndexF() noexcept { return _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f); }
+        static I LoadI(const void* p) noexcept { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+        static void StoreI(void* p, I v) noexcept { _mm_storeu_si128(static_cast<__m128i*>(p), v); }
+        static void StoreF(float* p, F v) noexcept { _mm_storeu_ps(p, v); }
+        static I AddI(I a, I b) noexcept { return _mm_add_epi32(a, b); }
+        static I OrI(I a, I b) noexcept { return _mm_or_si128(a, b); }
+        static I AndI(I a, I b) noexcept { return _mm_and_si128(a, b); }
+        static I AndNotI(I a, I b) noexcept { return _mm_andnot_si128(a, b); }
+        static I CmpGtI(I a, I b) noexcept { return _mm_cmpgt_epi32(a, b); }
+        static I SignI(I a) noexcept { return _mm_srai_epi32(a, 31); }
+        template <int N> static I SllI(I a) noexcept { return _mm_slli_epi32(a, N); }
+        static int32_t MoveMask(I a) noexcept { return _mm_movemask_ps(_mm_castsi128_ps(a)); }
+        static I Select(I mask, I a, I b) noexcept { return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b)); }
+        static F AddF(F a, F b) noexcept { return _mm_add_ps(a, b); }
+        static F MulF(F a, F b) noexcept { return _mm_mul_ps(a, b); }
+        static F DivF(F a, F b) noexcept { return _mm_div_ps(a, b); }
+        static F ClampF(F a, F lo, F hi) noexcept { return _mm_min_ps(_mm_max_ps(a, lo), hi); }
+        static I ToI(F a) noexcept { return _mm_cvttps_epi32(a); }
+    };
+#else
+    struct Lanes final {
+        static constexpr int32_t COUNT = 1;
+        using F = float;
+        using I = int32_t;
+
+        static F SetF(float v) noexcept { return v; }
+        static I SetI(int32_t v) noexcept { return v; }
+        static F IndexF() noexcept { return 0.0f; }
+        static I LoadI(const void* p) noexcept { I v; std::memcpy(&v, p, sizeof(v)); return v; }
+        static void StoreI(void* p, I v) noexcept { std::memcpy(p, &v, sizeof(v)); }
+        static void StoreF(float* p, F v) noexcept { *p = v; }
+        static I AddI(I a, I b) noexcept { return static_cast<I>(static_cast<uint32_t>(a) + static_cast<uint32_t>(b)); }
+        static I OrI(I a, I b) noexcept { return a | b; }
+        static I AndI(I a, I b) noexcept { return a & b; }
+        static I AndNotI(I a, I b) noexcept { return ~a & b; }
+        static I CmpGtI(I a, I b) noexcept { return (a > b) ? -1 : 0; }
+        static I SignI(I a) noexcept { return (a < 0) ? -1 : 0; }
+        template <int N> static I SllI(I a) noexcept { return static_cast<I>(static_cast<uint32_t>(a) << N); }
+        static int32_t MoveMask(I a) noexcept { return (a < 0) ? 1 : 0; }
+        static I Select(I mask, I a, I b) noexcept { return (a & mask) | (b & ~mask); }
+        static F AddF(F a, F b) noexcept { return a + b; }
+        static F MulF(F a, F b) noexcept { return a * b; }
+        static F DivF(F a, F b) noexcept { return a / b; }
+        static F ClampF(F a, F lo, F hi) noexcept { return std::min(std::max(a, lo), hi); }
+        static I ToI(F a) noexcept { return static_cast<I>(a); }
+    };
+#endif
+
+    constexpr uint32_t DEPTH_MASK       = 0x00FFFFFFU;                          ///< D24S8의 깊이 비트
+    constexpr float DEPTH_SCALE         = 16777215.0f;                          ///< 24비트 UNORM 변환 계수
+    constexpr int64_t EDGE_CLAMP        = static_cast<int64_t>(1) << 30;        ///< 에지 함수 초기값 클램프 범위
+    constexpr int32_t MAX_CLIP_VERTICES = 12;                                   ///< 클리핑 후 다각형의 최대 정점 수
+
+    /// @brief R8G8B8A8 색상의 성분을 곱합니다.
+    /// @param lhs 색상
+    /// @param rhs 색상
+    /// @return 색상
+    inline uint32_t modulate(uint32_t lhs, uint32_t rhs) noexcept {
+        uint32_t result = 0U;
+        for (uint32_t shift = 0U; shift < 32U; shift += 8U) {
+            const uint32_t a = (lhs >> shift) & 0xFFU;
+            const uint32_t b = (rhs >> shift) & 0xFFU;
+            result |= (((a * b) + 127U) / 255U) << shift;
+        }
+
+        return result;
+    }
+}
+
+/// @brief 생성자
+/// @param threadCount 래스터화에 사용할 스레드 수 (호출 스레드 포함, 0이면 하드웨어 스레드 수)
+SoftwareRenderDevice::SoftwareRenderDevice(uint32_t threadCount) noexcept {
+    m_Width             = 0;
+    m_Height            = 0;
+    m_TilesX            = 0;
+    m_TilesY            = 0;
+    m_ClearColor        = 0U;
+    m_VSyncEnabled      = false;
+    m_LoadTiles         = false;
+    m_InFrame           = false;
+
+    m_VertexBuffer      = 0U;
+    m_IndexBuffer       = 0U;
+    m_IndexFormat       = IndexFormat::UInt16;
+    m_ConstantBuffer    = 0U;
+    m_Texture           = 0U;
+    m_Topology          = PrimitiveTopology::TriangleList;
+
+    m_NextTile          = 0;
+    m_Dispatch          = 0ULL;
+    m_BusyWorkers       = 0U;
+    m_Shutdown          = false;
+
+    startWorkers(threadCount);
+}
+
+/// @brief 소멸자
+SoftwareRenderDevice::~SoftwareRenderDevice() noexcept {
+    stopWorkers();
+}
+
+/// @brief 작업 스레드를 시작합니다.
+/// @param threadCount 호출 스레드를 포함한 스레드 수 (0이면 하드웨어 스레드 수)
+void SoftwareRenderDevice::startWorkers(uint32_t threadCount) noexcept {
+    if (threadCount == 0U) {
+        threadCount = std::max(1U, std::thread::hardware_concurrency());
+    }
+
+    m_Shutdown = false;
+    for (uint32_t i = 1U; i < threadCount; ++i) {
+        m_Workers.emplace_back(&SoftwareRenderDevice::workerMain, this);
+    }
+}
+
+/// @brief 작업 스레드를 모두 종료합니다.
+void SoftwareRenderDevice::stopWorkers() noexcept {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Shutdown = true;
+    }
+    m_WakeCondition.notify_all();
+
+    for (auto& worker : m_Workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    m_Workers.clear();
+}
+
+/// @brief 작업 스레드의 진입점
+void SoftwareRenderDevice::workerMain() noexcept {
+    uint64_t seen = 0ULL;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_WakeCondition.wait(lock, [&] { return m_Shutdown || m_Dispatch != seen; });
+            if (m_Shutdown) {
+                return;
+            }
+            seen = m_Dispatch;
+        }
+
+        processTiles();
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (--m_BusyWorkers == 0U) {
+                m_DoneCondition.notify_one();
+            }
+        }
+    }
+}
+
+/// @brief 남은 타일을 가져가며 래스터화와 리졸브를 수행합니다.
+void SoftwareRenderDevice::processTiles() noexcept {
+    const int32_t tileCount = m_TilesX * m_TilesY;
+
+    while (true) {
+        const int32_t tile = m_NextTile.fetch_add(1, std::memory_order_relaxed);
+        if (tile >= tileCount) {
+            break;
+        }
+
+        rasterizeTile(tile);
+        resolveTile(tile);
+    }
+}
+
+/// @brief 타일 하나를 클리어하고, 배정된 삼각형을 제출 순서대로 래스터화합니다.
+/// @param tile 타일 인덱스
+void SoftwareRenderDevice::rasterizeTile(int32_t tile) noexcept {
+    using F = Lanes::F;
+    using I = Lanes::I;
+    constexpr int32_t L = Lanes::COUNT;
+
+    const int32_t tileX = (tile % m_TilesX) * TILE_SIZE;
+    const int32_t tileY = (tile / m_TilesX) * TILE_SIZE;
+
+    uint32_t* color = &m_TileColor[static_cast<size_t>(tile) * TILE_PIXELS];
+    uint32_t* depth = &m_TileDepth[static_cast<size_t>(tile) * TILE_PIXELS];
+
+    // 클리어 (깊이 1.0, 스텐실 0)
+    if (!m_LoadTiles) {
+        std::fill(color, color + TILE_PIXELS, m_ClearColor);
+        std::fill(depth, depth + TILE_PIXELS, DEPTH_MASK);
+    }
+
+    const F laneIndex   = Lanes::IndexF();
+    const F zero        = Lanes::SetF(0.0f);
+    const F one         = Lanes::SetF(1.0f);
+    const F colorScale  = Lanes::SetF(255.0f);
+    const F half        = Lanes::SetF(0.5f);
+    const F depthScale  = Lanes::SetF(DEPTH_SCALE);
+    const I depthMask   = Lanes::SetI(static_cast<int32_t>(DEPTH_MASK));
+
+    alignas(32) int32_t laneSteps[3][L];
+    alignas(32) uint32_t laneColor[L];
+    alignas(32) float laneU[L];
+    alignas(32) float laneV[L];
+
+    for (const uint32_t index : m_Bins[tile]) {
+        const Triangle& tri = m_Triangles[index];
+        const Texture* texture = m_Textures.Get(tri.TextureID);
+
+        // 타일과 경계 상자의 교집합
+        const int32_t x0 = std::max(tri.MinX, tileX);
+        const int32_t y0 = std::max(tri.MinY, tileY);
+        const int32_t x1 = std::min(tri.MaxX, tileX + TILE_SIZE - 1);
+        const int32_t y1 = std::min(tri.MaxY, tileY + TILE_SIZE - 1);
+        if (x0 > x1 || y0 > y1) {
+            continue;
+        }
+
+        // 레인 폭에 맞춰 시작 열 정렬 (타일 폭이 레인 폭의 배수이므로 타일을 벗어나지 않음)
+        const int32_t xs = tileX + ((x0 - tileX) & ~(L - 1));
+
+        // 시작 픽셀 중심에서의 에지 함수 값
+        const int64_t px = (static_cast<int64_t>(xs) << SUBPIXEL_BITS) + (1 << (SUBPIXEL_BITS - 1));
+        const int64_t py = (static_cast<int64_t>(y0) << SUBPIXEL_BITS) + (1 << (SUBPIXEL_BITS - 1));
+
+        int32_t edgeRow[3];
+        int32_t stepX[3];
+        int32_t stepY[3];
+        bool rejected = false;
+        for (int32_t k = 0; k < 3; ++k) {
+            const int64_t e = static_cast<int64_t>(tri.A[k]) * px + static_cast<int64_t>(tri.B[k]) * py + tri.C[k];
+
+            // 타일 안에서 에지 값의 변화량은 2^29 미만이므로 ±2^30으로 잘라도 부호가 바뀌지 않음
+            if (e < -EDGE_CLAMP) {
+                rejected = true;
+                break;
+            }
+            edgeRow[k] = static_cast<int32_t>(std::min(e, EDGE_CLAMP));
+            stepX[k] = tri.A[k] << SUBPIXEL_BITS;
+            stepY[k] = tri.B[k] << SUBPIXEL_BITS;
+
+            for (int32_t lane = 0; lane < L; ++lane) {
+                laneSteps[k][lane] = stepX[k] * lane;
+            }
+        }
+        if (rejected) {
+            continue;
+        }
+
+        const I laneStep0 = Lanes::LoadI(laneSteps[0]);
+        const I laneStep1 = Lanes::LoadI(laneSteps[1]);
+        const I laneStep2 = Lanes::LoadI(laneSteps[2]);
+
+        // 평면 방정식의 기준점 (시작 픽셀 중심)
+        const float fx = static_cast<float>(xs) + 0.5f - tri.X0;
+        float fy = static_cast<float>(y0) + 0.5f - tri.Y0;
+
+        for (int32_t y = y0; y <= y1; ++y, fy += 1.0f) {
+            const int32_t rowOffset = (y - tileY) * TILE_SIZE;
+
+            int32_t e0 = edgeRow[0];
+            int32_t e1 = edgeRow[1];
+            int32_t e2 = edgeRow[2];
+
+            float pfx = fx;
+            for (int32_t x = xs; x <= x1; x += L, pfx += static_cast<float>(L)) {
+                const I edge0 = Lanes::AddI(Lanes::SetI(e0), laneStep0);
+                const I edge1 = Lanes::AddI(Lanes::SetI(e1), laneStep1);
+                const I edge2 = Lanes::AddI(Lanes::SetI(e2), laneStep2);
+
+                e0 += stepX[0] * L;
+                e1 += stepX[1] * L;
+                e2 += stepX[2] * L;
+
+                // 세 에지 모두 0 이상이면 내부
+                const I outside = Lanes::SignI(Lanes::OrI(Lanes::OrI(edge0, edge1), edge2));
+                if (Lanes::MoveMask(outside) == ((1 << L) - 1)) {
+                    continue;
+                }
+
+                // 깊이 테스트 (LESS)
+                const F laneX = Lanes::AddF(Lanes::SetF(pfx), laneIndex);
+                const F laneY = Lanes::SetF(fy);
+
+                const F z = Lanes::AddF(Lanes::AddF(Lanes::SetF(tri.Z.C), Lanes::MulF(Lanes::SetF(tri.Z.DX), laneX)), Lanes::MulF(Lanes::SetF(tri.Z.DY), laneY));
+                const I newDepth = Lanes::ToI(Lanes::AddF(Lanes::MulF(Lanes::ClampF(z, zero, one), depthScale), half));
+
+                uint32_t* depthPtr = depth + rowOffset + (x - tileX);
+                const I oldDepth = Lanes::LoadI(depthPtr);
+                const I pass = Lanes::AndNotI(outside, Lanes::CmpGtI(Lanes::AndI(oldDepth, depthMask), newDepth));
+                const int32_t passMask = Lanes::MoveMask(pass);
+                if (passMask == 0) {
+                    continue;
+                }
+
+                // 원근 보정 보간
+                const F invW = Lanes::AddF(Lanes::AddF(Lanes::SetF(tri.InvW.C), Lanes::MulF(Lanes::SetF(tri.InvW.DX), laneX)), Lanes::MulF(Lanes::SetF(tri.InvW.DY), laneY));
+                const F w = Lanes::DivF(one, invW);
+
+                F channel[4];
+                for (int32_t c = 0; c < 4; ++c) {
+                    const Plane& plane = tri.Attr[c];
+                    const F value = Lanes::AddF(Lanes::AddF(Lanes::SetF(plane.C), Lanes::MulF(Lanes::SetF(plane.DX), laneX)), Lanes::MulF(Lanes::SetF(plane.DY), laneY));
+                    channel[c] = Lanes::AddF(Lanes::MulF(Lanes::ClampF(Lanes::MulF(value, w), zero, one), colorScale), half);
+                }
+
+                I packed = Lanes::ToI(channel[0]);
+                packed = Lanes::OrI(packed, Lanes::SllI<8>(Lanes::ToI(channel[1])));
+                packed = Lanes::OrI(packed, Lanes::SllI<16>(Lanes::ToI(channel[2])));
+                packed = Lanes::OrI(packed, Lanes::SllI<24>(Lanes::ToI(channel[3])));
+
+                // 텍스처 샘플링 (최근접, 반복)
+                if (texture) {
+                    const Plane& planeU = tri.Attr[4];
+                    const Plane& planeV = tri.Attr[5];
+                    const F u = Lanes::AddF(Lanes::AddF(Lanes::SetF(planeU.C), Lanes::MulF(Lanes::SetF(planeU.DX), laneX)), Lanes::MulF(Lanes::SetF(planeU.DY), laneY));
+                    const F v = Lanes::AddF(Lanes::AddF(Lanes::SetF(planeV.C), Lanes::MulF(Lanes::SetF(planeV.DX), laneX)), Lanes::MulF(Lanes::SetF(planeV.DY), laneY));
+
+                    Lanes::StoreI(laneColor, packed);
+                    Lanes::StoreF(laneU, Lanes::MulF(u, w));
+                    Lanes::StoreF(laneV, Lanes::MulF(v, w));
+
+                    const Texture& tex = *texture;
+                    for (int32_t lane = 0; lane < L; ++lane) {
+                        if ((passMask >> lane) & 1) {
+                            const float su = laneU[lane] - std::floor(laneU[lane]);
+                            const float sv = laneV[lane] - std::floor(laneV[lane]);
+                            const int32_t tx = std::min(static_cast<int32_t>(su * static_cast<float>(tex.Width)), tex.Width - 1);
+                            const int32_t ty = std::min(static_cast<int32_t>(sv * static_cast<float>(tex.Height)), tex.Height - 1);
+                            laneColor[lane] = modulate(laneColor[lane], tex.Texels[static_cast<size_t>(ty) * tex.Width + tx]);
+                        }
+                    }
+
+                    packed = Lanes::LoadI(laneColor);
+                }
+
+                uint32_t* colorPtr = color + rowOffset + (x - tileX);
+                Lanes::StoreI(colorPtr, Lanes::Select(pass, packed, Lanes::LoadI(colorPtr)));
+                Lanes::StoreI(depthPtr, Lanes::Select(pass, Lanes::OrI(Lanes::AndNotI(depthMask, oldDepth), newDepth), oldDepth));
+            }
+
+            edgeRow[0] += stepY[0];
+            edgeRow[1] += stepY[1];
+            edgeRow[2] += stepY[2];
+        }
+    }
+}
+
+/// @brief 타일 색상을 행 우선 색상 버퍼로 복사합니다.
+/// @param tile 타일 인덱스
+void SoftwareRenderDevice::resolveTile(int32_t tile) noexcept {
+    const int32_t tileX = (tile % m_TilesX) * TILE_SIZE;
+    const int32_t tileY = (tile / m_TilesX) * TILE_SIZE;
+    const int32_t width = std::min(TILE_SIZE, m_Width - tileX);
+    const int32_t height = std::min(TILE_SIZE, m_Height - tileY);
+
+    const uint32_t* src = &m_TileColor[static_cast<size_t>(tile) * TILE_PIXELS];
+    for (int32_t y = 0; y < height; ++y) {
+        std::memcpy(&m_ColorBuffer[static_cast<size_t>(tileY + y) * m_Width + tileX], src + y * TILE_SIZE, sizeof(uint32_t) * width);
+    }
+}
+
+/// @brief 정점 하나를 읽어 클립 공간으로 변환합니다.
+/// @param buffer 정점 버퍼
+/// @param matrix 변환 행렬 (행 우선 4x4, nullptr이면 항등)
+/// @param index 정점 인덱스
+/// @param out 클립 공간 정점
+void SoftwareRenderDevice::fetchVertex(const Buffer& buffer, const float* matrix, uint32_t index, ClipVertex& out) const noexcept {
+    const uint32_t stride = buffer.Desc.Stride;
+    const byte_t* src = buffer.Data.data() + static_cast<size_t>(index) * stride;
+
+    float position[3];
+    std::memcpy(position, src, sizeof(position));
+
+    if (matrix) {
+        for (int32_t c = 0; c < 4; ++c) {
+            out.P[c] = position[0] * matrix[c] + position[1] * matrix[4 + c] + position[2] * matrix[8 + c] + matrix[12 + c];
+        }
+    } else {
+        out.P[0] = position[0];
+        out.P[1] = position[1];
+        out.P[2] = position[2];
+        out.P[3] = 1.0f;
+    }
+
+    uint32_t color = 0xFFFFFFFFU;
+    if (stride >= 16U) {
+        std::memcpy(&color, src + 12, sizeof(color));
+    }
+    for (int32_t c = 0; c < 4; ++c) {
+        out.Attr[c] = static_cast<float>((color >> (c * 8)) & 0xFFU) / 255.0f;
+    }
+
+    if (stride >= 24U) {
+        std::memcpy(&out.Attr[4], src + 16, sizeof(float) * 2);
+    } else {
+        out.Attr[4] = 0.0f;
+        out.Attr[5] = 0.0f;
+    }
+}
+
+/// @brief 인덱스 목록의 삼각형을 클리핑하고 설정합니다.
+/// @param indices 정점 인덱스
+/// @param count 인덱스 수
+/// @param strip 삼각형 스트립 여부
+void SoftwareRenderDevice::submitTriangles(const uint32_t* indices, uint32_t count, bool strip) noexcept {
+    Buffer* vertexBuffer = m_Buffers.Get(m_VertexBuffer);
+    if (!vertexBuffer || vertexBuffer->Desc.Stride < 12U || count < 3U) {
+        return;
+    }
+
+    // 변환 행렬
+    const float* matrix = nullptr;
+    if (Buffer* constantBuffer = m_Buffers.Get(m_ConstantBuffer)) {
+        if (constantBuffer->Data.size() >= sizeof(float) * 16) {
+            matrix = reinterpret_cast<const float*>(constantBuffer->Data.data());
+        }
+    }
+
+    const uint32_t texture = m_Texture;
+    const uint32_t vertexCount = static_cast<uint32_t>(vertexBuffer->Data.size() / vertexBuffer->Desc.Stride);
+
+    // 가드 밴드 (NDC 단위)
+    const float guardX = GUARD_BAND / (static_cast<float>(m_Width) * 0.5f);
+    const float guardY = GUARD_BAND / (static_cast<float>(m_Height) * 0.5f);
+
+    // 클립 평면 (a, b, c, d, e): a*x + b*y + c*z + d*w + e >= 0
+    const float planes[][5] = {
+        {  0.0f,  0.0f,  1.0f, 0.0f,   0.0f },      // 근평면 (z >= 0)
+        {  0.0f,  0.0f, -1.0f, 1.0f,   0.0f },      // 원평면 (z <= w)
+        {  0.0f,  0.0f,  0.0f, 1.0f, -1e-6f },      // w > 0
+        {  1.0f,  0.0f,  0.0f, guardX, 0.0f },      // 좌측 가드 밴드
+        { -1.0f,  0.0f,  0.0f, guardX, 0.0f },      // 우측 가드 밴드
+        {  0.0f,  1.0f,  0.0f, guardY, 0.0f },      // 하단 가드 밴드
+        {  0.0f, -1.0f,  0.0f, guardY, 0.0f },      // 상단 가드 밴드
+    };
+    constexpr int32_t PLANE_COUNT = static_cast<int32_t>(sizeof(planes) / sizeof(planes[0]));
+
+    auto distance = [&](const ClipVertex& v, int32_t plane) {
+        const float* p = planes[plane];
+        return p[0] * v.P[0] + p[1] * v.P[1] + p[2] * v.P[2] + p[3] * v.P[3] + p[4];
+    };
+
+    const uint32_t triangleCount = strip ? (count - 2U) : (count / 3U);
+    for (uint32_t t = 0U; t < triangleCount; ++t) {
+        uint32_t i0, i1, i2;
+        if (strip) {
+            // 홀수 번째 삼각형은 감기 순서를 유지하기 위해 뒤집음
+            i0 = indices[t + ((t & 1U) ? 1U : 0U)];
+            i1 = indices[t + ((t & 1U) ? 0U : 1U)];
+            i2 = indices[t + 2U];
+        } else {
+            i0 = indices[t * 3U];
+            i1 = indices[t * 3U + 1U];
+            i2 = indices[t * 3U + 2U];
+        }
+
+        ++m_RasterStats.TrianglesSubmitted;
+        if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount) {
+            ++m_RasterStats.TrianglesCulled;
+            continue;
+        }
+
+        ClipVertex polygon[2][MAX_CLIP_VERTICES];
+        fetchVertex(*vertexBuffer, matrix, i0, polygon[0][0]);
+        fetchVertex(*vertexBuffer, matrix, i1, polygon[0][1]);
+        fetchVertex(*vertexBuffer, matrix, i2, polygon[0][2]);
+
+        // 평면별 포함 여부
+        uint32_t outMask[3] = { 0U, 0U, 0U };
+        for (int32_t plane = 0; plane < PLANE_COUNT; ++plane) {
+            for (int32_t v = 0; v < 3; ++v) {
+                if (distance(polygon[0][v], plane) < 0.0f) {
+                    outMask[v] |= (1U << plane);
+                }
+            }
+        }
+
+        // 모든 정점이 같은 평면 밖이면 버림
+        if ((outMask[0] & outMask[1] & outMask[2]) != 0U) {
+            ++m_RasterStats.TrianglesCulled;
+            continue;
+        }
+
+        // 모든 정점이 안쪽이면 클리핑 생략
+        if ((outMask[0] | outMask[1] | outMask[2]) == 0U) {
+            setupTriangle(polygon[0][0], polygon[0][1], polygon[0][2], texture);
+            continue;
+        }
+
+        // Sutherland-Hodgman 클리핑
+        int32_t current = 0;
+        int32_t vertexTotal = 3;
+        const uint32_t clipMask = outMask[0] | outMask[1] | outMask[2];
+        for (int32_t plane = 0; plane < PLANE_COUNT && vertexTotal >= 3; ++plane) {
+            if ((clipMask & (1U << plane)) == 0U) {
+                continue;
+            }
+
+            const ClipVertex* in = polygon[current];
+            ClipVertex* out = polygon[current ^ 1];
+            int32_t outCount = 0;
+
+            for (int32_t v = 0; v < vertexTotal; ++v) {
+                const ClipVertex& a = in[v];
+                const ClipVertex& b = in[(v + 1) % vertexTotal];
+                const float da = distance(a, plane);
+                const float db = distance(b, plane);
+
+                if (da >= 0.0f && outCount < MAX_CLIP_VERTICES) {
+                    out[outCount++] = a;
+                }
+
+                if ((da >= 0.0f) != (db >= 0.0f) && outCount < MAX_CLIP_VERTICES) {
+                    const float s = da / (da - db);
+                    ClipVertex& mid = out[outCount++];
+                    for (int32_t c = 0; c < 4; ++c) {
+                        mid.P[c] = a.P[c] + (b.P[c] - a.P[c]) * s;
+                    }
+                    for (int32_t c = 0; c < 6; ++c) {
+                        mid.Attr[c] = a.Attr[c] + (b.Attr[c] - a.Attr[c]) * s;
+                    }
+                }
+            }
+
+            vertexTotal = outCount;
+            current ^= 1;
+        }
+
+        if (vertexTotal < 3) {
+            ++m_RasterStats.TrianglesCulled;
+            continue;
+        }
+
+        // 부채꼴 분할
+        for (int32_t v = 1; v + 1 < vertexTotal; ++v) {
+            setupTriangle(polygon[current][0], polygon[current][v], polygon[current][v + 1], texture);
+        }
+    }
+}
+
+/// @brief 클립 공간 삼각형을 화면 공간으로 옮겨 에지 함수와 평면 방정식을 설정하고 타일에 비닝합니다.
+/// @param v0 정점
+/// @param v1 정점
+/// @param v2 정점
+/// @param texture 텍스처 식별자 (0 가능)
+void SoftwareRenderDevice::setupTriangle(const ClipVertex& v0, const ClipVertex& v1, const ClipVertex& v2, uint32_t texture) noexcept {
+    const ClipVertex* vertices[3] = { &v0, &v1, &v2 };
+
+    constexpr float SUBPIXEL_SCALE = static_cast<float>(1 << SUBPIXEL_BITS);
+
+    int32_t fixedX[3];
+    int32_t fixedY[3];
+    float screenX[3];
+    float screenY[3];
+    float depth[3];
+    float invW[3];
+
+    for (int32_t i = 0; i < 3; ++i) {
+        const ClipVertex& v = *vertices[i];
+        invW[i] = 1.0f / v.P[3];
+
+        // 뷰포트 변환 후 부화소 격자에 맞춤
+        const float sx = (v.P[0] * invW[i] * 0.5f + 0.5f) * static_cast<float>(m_Width);
+        const float sy = (0.5f - v.P[1] * invW[i] * 0.5f) * static_cast<float>(m_Height);
+        fixedX[i] = static_cast<int32_t>(std::lround(sx * SUBPIXEL_SCALE));
+        fixedY[i] = static_cast<int32_t>(std::lround(sy * SUBPIXEL_SCALE));
+        screenX[i] = static_cast<float>(fixedX[i]) / SUBPIXEL_SCALE;
+        screenY[i] = static_cast<float>(fixedY[i]) / SUBPIXEL_SCALE;
+        depth[i] = v.P[2] * invW[i];
+    }
+
+    // 후면 컬링 (화면 좌표계에서 시계 방향이 전면)
+    const int64_t area = static_cast<int64_t>(fixedX[1] - fixedX[0]) * (fixedY[2] - fixedY[0]) - static_cast<int64_t>(fixedX[2] - fixedX[0]) * (fixedY[1] - fixedY[0]);
+    if (area <= 0) {
+        ++m_RasterStats.TrianglesCulled;
+        return;
+    }
+
+    // 픽셀 중심을 포함하는 경계 상자
+    constexpr int32_t HALF = 1 << (SUBPIXEL_BITS - 1);
+    constexpr int32_t MASK = (1 << SUBPIXEL_BITS) - 1;
+    const int32_t minFX = std::min({ fixedX[0], fixedX[1], fixedX[2] });
+    const int32_t minFY = std::min({ fixedY[0], fixedY[1], fixedY[2] });
+    const int32_t maxFX = std::max({ fixedX[0], fixedX[1], fixedX[2] });
+    const int32_t maxFY = std::max({ fixedY[0], fixedY[1], fixedY[2] });
+
+    Triangle tri;
+    tri.MinX = std::max(0, (minFX - HALF + MASK) >> SUBPIXEL_BITS);
+    tri.MinY = std::max(0, (minFY - HALF + MASK) >> SUBPIXEL_BITS);
+    tri.MaxX = std::min(m_Width - 1, (maxFX - HALF) >> SUBPIXEL_BITS);
+    tri.MaxY = std::min(m_Height - 1, (maxFY - HALF) >> SUBPIXEL_BITS);
+    if (tri.MinX > tri.MaxX || tri.MinY > tri.MaxY) {
+        ++m_RasterStats.TrianglesCulled;
+        return;
+    }
+
+    // 에지 함수: 에지 k는 정점 k의 맞은편 (v1→v2, v2→v0, v0→v1)
+    for (int32_t k = 0; k < 3; ++k) {
+        const int32_t a = (k + 1) % 3;
+        const int32_t b = (k + 2) % 3;
+
+        tri.A[k] = fixedY[a] - fixedY[b];
+        tri.B[k] = fixedX[b] - fixedX[a];
+        tri.C[k] = -(static_cast<int64_t>(tri.A[k]) * fixedX[a] + static_cast<int64_t>(tri.B[k]) * fixedY[a]);
+
+        // 좌상단 규칙: 윗변, 왼변이 아니면 경계 위의 픽셀은 제외
+        const bool topLeft = (tri.A[k] > 0) || (tri.A[k] == 0 && tri.B[k] > 0);
+        if (!topLeft) {
+            tri.C[k] -= 1;
+        }
+    }
+
+    // 평면 방정식
+    tri.X0 = screenX[0];
+    tri.Y0 = screenY[0];
+
+    const float dx1 = screenX[1] - screenX[0];
+    const float dy1 = screenY[1] - screenY[0];
+    const float dx2 = screenX[2] - screenX[0];
+    const float dy2 = screenY[2] - screenY[0];
+    const float invDet = 1.0f / (dx1 * dy2 - dx2 * dy1);
+
+    auto makePlane = [&](float a0, float a1, float a2) {
+        const float d1 = a1 - a0;
+        const float d2 = a2 - a0;
+        return Plane{ a0, (d1 * dy2 - d2 * dy1) * invDet, (dx1 * d2 - dx2 * d1) * invDet };
+    };
+
+    tri.Z = makePlane(depth[0], depth[1], depth[2]);
+    tri.InvW = makePlane(invW[0], invW[1], invW[2]);
+    for (int32_t c = 0; c < 6; ++c) {
+        tri.Attr[c] = makePlane(v0.Attr[c] * invW[0], v1.Attr[c] * invW[1], v2.Attr[c] * invW[2]);
+    }
+    tri.TextureID = texture;
+
+    // 비닝
+    const uint32_t index = static_cast<uint32_t>(m_Triangles.size());
+    m_Triangles.push_back(tri);
+    ++m_RasterStats.TrianglesBinned;
+
+    const int32_t tileMinX = tri.MinX / TILE_SIZE;
+    const int32_t tileMinY = tri.MinY / TILE_SIZE;
+    const int32_t tileMaxX = tri.MaxX / TILE_SIZE;
+    const int32_t tileMaxY = tri.MaxY / TILE_SIZE;
+    for (int32_t ty = tileMinY; ty <= tileMaxY; ++ty) {
+        for (int32_t tx = tileMinX; tx <= tileMaxX; ++tx) {
+            m_Bins[static_cast<size_t>(ty) * m_TilesX + tx].push_back(index);
+            ++m_RasterStats.TileBinEntries;
+        }
+    }
+}
+
+/// @brief 디바이스를 초기화합니다.
+/// @param nativeHandle 윈도우의 핸들 (무시)
+/// @param width 너비
+/// @param height 높이
+/// @param fullscreenEnabled 전체화면 활성화 유무 (무시)
+/// @param vsyncEnabled 수직 동기화 활성화 유무
+/// @return 성공(true), 실패(false)
+bool SoftwareRenderDevice::Initialize(void*, int32_t width, int32_t height, bool, bool vsyncEnabled) noexcept {
+    m_VSyncEnabled = vsyncEnabled;
+
+    m_Buffers.Clear();
+    m_Textures.Clear();
+    m_Shaders.Clear();
+    m_BlendStates.Clear();
+    m_DepthStencilStates.Clear();
+    m_RasterizerStates.Clear();
+    m_Samplers.Clear();
+
+    return Resize(width, height);
+}
+
+/// @brief V-Sync 활성화 유무를 취득합니다.
+/// @return 활성화(true), 비활성화(false)
+bool SoftwareRenderDevice::IsVSyncEnabled() const noexcept {
+    return m_VSyncEnabled;
+}
+
+/// @brief 프레임을 시작합니다.
+/// @param color 클리어 색상 (RGBA, 0.0 ~ 1.0)
+/// @note 실제 클리어는 EndFrame에서 타일별로 수행됩니다.
+void SoftwareRenderDevice::BeginFrame(float color[4]) noexcept {
+    m_ClearColor = 0U;
+    for (int32_t c = 0; c < 4; ++c) {
+        const float value = std::clamp(color[c], 0.0f, 1.0f);
+        m_ClearColor |= static_cast<uint32_t>(value * 255.0f + 0.5f) << (c * 8);
+    }
+
+    m_Triangles.clear();
+    for (auto& bin : m_Bins) {
+        bin.clear();
+    }
+    m_LoadTiles = false;
+    m_InFrame = true;
+}
+
+/// @brief 비닝된 삼각형을 모든 스레드로 래스터화하고 색상 버퍼로 리졸브합니다.
+void SoftwareRenderDevice::EndFrame() noexcept {
+    flushTiles();
+
+    m_RasterStats.ThreadCount = GetThreadCount();
+
+    m_LastRasterStats = m_RasterStats;
+    m_RasterStats = {};
+    m_LastFrameStats = m_FrameStats;
+    m_FrameStats = {};
+    m_InFrame = false;
+}
+
+/// @brief 지금까지 비닝된 삼각형을 래스터화, 리졸브하고 빈을 비웁니다.
+/// @note 이후의 래스터화는 타일을 클리어하지 않고 이어서 그립니다.
+void SoftwareRenderDevice::flushTiles() noexcept {
+    const auto startTime = std::chrono::steady_clock::now();
+
+    m_NextTile.store(0, std::memory_order_relaxed);
+
+    // 작업 스레드 깨우기
+    if (!m_Workers.empty()) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_BusyWorkers = static_cast<uint32_t>(m_Workers.size());
+        ++m_Dispatch;
+    }
+    m_WakeCondition.notify_all();
+
+    // 호출 스레드도 참여
+    processTiles();
+
+    // 모든 작업 스레드 대기
+    if (!m_Workers.empty()) {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_DoneCondition.wait(lock, [&] { return m_BusyWorkers == 0U; });
+    }
+
+    m_RasterStats.RasterTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    m_Triangles.clear();
+    for (auto& bin : m_Bins) {
+        bin.clear();
+    }
+    m_LoadTiles = true;
+}
+
+/// @brief 화면의 크기를 변경합니다.
+/// @param width 너비
+/// @param height 높이
+/// @return 성공(true), 실패(false)
+bool SoftwareRenderDevice::Resize(int32_t width, int32_t height) noexcept {
+    if (width <= 0 || height <= 0 || width > static_cast<int32_t>(GUARD_BAND) || height > static_cast<int32_t>(GUARD_BAND)) {
+        return false;
+    }
+
+    m_Width     = width;
+    m_Height    = height;
+    m_TilesX    = (width + TILE_SIZE - 1) / TILE_SIZE;
+    m_TilesY    = (height + TILE_SIZE - 1) / TILE_SIZE;
+
+    const size_t tileCount = static_cast<size_t>(m_TilesX) * m_TilesY;
+    m_ColorBuffer.assign(static_cast<size_t>(width) * height, 0U);
+    m_TileColor.assign(tileCount * TILE_PIXELS, 0U);
+    m_TileDepth.assign(tileCount * TILE_PIXELS, DEPTH_MASK);
+    m_Bins.assign(tileCount, {});
+    m_Triangles.clear();
+
+    return true;
+}
+
+/// @brief V-Sync 활성화를 설정합니다.
+/// @param enabled 활성화 유무
+void SoftwareRenderDevice::SetVSync(bool enabled) noexcept {
+    m_VSyncEnabled = enabled;
+}
+
+/// @brief 버퍼를 생성합니다.
+/// @param desc 버퍼 설명
+/// @param data 초기 데이터 (nullptr 가능, Immutable은 필수)
+/// @return 버퍼 핸들 (실패 시 무효 핸들)
+BufferHandle SoftwareRenderDevice::CreateBuffer(const BufferDesc& desc, const void* data) noexcept {
+    if (desc.Size == 0U || (desc.Usage == BufferUsage::Immutable && !data)) {
+        return {};
+    }
+
+    Buffer resource;
+    resource.Desc = desc;
+    resource.Data.resize(desc.Size);
+    if (data) {
+        std::memcpy(resource.Data.data(), data, desc.Size);
+    }
+
+    const uint32_t id = m_Buffers.Add(std::move(resource));
+    if (id == 0U) {
+        return {};
+    }
+
+    ++m_FrameStats.BuffersCreated;
+    m_FrameStats.BytesUploaded += data ? desc.Size : 0U;
+
+    return { id };
+}
+
+/// @brief 버퍼의 내용을 갱신합니다.
+/// @param handle 버퍼 핸들
+/// @param data 데이터
+/// @param size 크기 (바이트 단위)
+/// @return 성공(true), 실패(false)
+bool SoftwareRenderDevice::UpdateBuffer(BufferHandle handle, const void* data, uint32_t size) noexcept {
+    Buffer* resource = m_Buffers.Get(handle.ID);
+    if (!resource || !data || size == 0U || size > resource->Desc.Size || resource->Desc.Usage == BufferUsage::Immutable) {
+        return false;
+    }
+
+    std::memcpy(resource->Data.data(), data, size);
+    m_FrameStats.BytesUploaded += size;
+
+    return true;
+}
+
+/// @brief 버퍼를 해제합니다.
+/// @param handle 버퍼 핸들
+void SoftwareRenderDevice::DestroyBuffer(BufferHandle handle) noexcept {
+    m_Buffers.Remove(handle.ID);
+}
+
+/// @brief 텍스처를 생성합니다.
+/// @param desc 텍스처 설명
+/// @param data 초기 데이터 (0단계부터 모든 밉맵 단계가 행 간격 없이 연속, nullptr 가능)
+/// @return 텍스처 핸들 (실패 시 무효 핸들)
+/// @note 0단계만 사용하며 나머지 밉맵 단계는 무시합니다. 블록 압축 형식은 지원하지 않습니다.
+TextureHandle SoftwareRenderDevice::CreateTexture(const TextureDesc& desc, const void* data) noexcept {
+    if (!IsValidTextureDesc(desc) || !IsTextureFormatSupported(desc.Format)) {
+        return {};
+    }
+
+    Texture resource;
+    resource.Width  = desc.Width;
+    resource.Height = desc.Height;
+    resource.Texels.assign(static_cast<size_t>(desc.Width) * desc.Height, 0xFFFFFFFFU);
+
+    if (data) {
+        std::memcpy(resource.Texels.data(), data, resource.Texels.size() * sizeof(uint32_t));
+
+        // 내부 형식은 R8G8B8A8
+        if (desc.Format == TextureFormat::BGRA8) {
+            for (auto& texel : resource.Texels) {
+                texel = (texel & 0xFF00FF00U) | ((texel >> 16) & 0xFFU) | ((texel & 0xFFU) << 16);
+            }
+        }
+    }
+
+    const uint32_t id = m_Textures.Add(std::move(resource));
+    if (id == 0U) {
+        return {};
+    }
+
+    ++m_FrameStats.TexturesCreated;
+    m_FrameStats.BytesUploaded += data ? static_cast<uint64_t>(desc.Width) * desc.Height * GetBytesPerPixel(desc.Format) : 0ULL;
+
+    return { id };
+}
+
+/// @brief 텍스처를 해제합니다.
+/// @param handle 텍스처 핸들
+void SoftwareRenderDevice::DestroyTexture(TextureHandle handle) noexcept {
+    m_Textures.Remove(handle.ID);
+}
+
+/// @brief 텍스처 형식을 지원하는지 확인합니다.
+/// @param format 텍스처 형식
+/// @return 지원(true), 미지원(false: 블록 압축 형식)
+bool SoftwareRenderDevice::IsTextureFormatSupported(TextureFormat format) const noexcept {
+    return !IsBlockCompressed(format);
+}
+
+/// @brief 셰이더를 생성합니다.
+/// @param desc 셰이더 설명
+/// @param code 바이트 코드 (실행하지 않음)
+/// @param size 바이트 코드 크기
+/// @return 셰이더 핸들 (실패 시 무효 핸들)
+/// @note 고정 기능(정점 색상 × 텍스처)으로 그리므로 셰이더는 다른 디바이스와 같은 호출 흐름을 유지하기 위한 자리표시자입니다.
+ShaderHandle SoftwareRenderDevice::CreateShader(const ShaderDesc& desc, const void* code, size_t size) noexcept {
+    if (!code || size == 0U) {
+        return {};
+    }
+
+    ShaderDesc copy = desc;
+    const uint32_t id = m_Shaders.Add(std::move(copy));
+    if (id == 0U) {
+        return {};
+    }
+
+    ++m_FrameStats.ShadersCreated;
+
+    return { id };
+}
+
+/// @brief 셰이더를 해제합니다.
+/// @param handle 셰이더 핸들
+void SoftwareRenderDevice::DestroyShader(ShaderHandle handle) noexcept {
+    m_Shaders.Remove(handle.ID);
+}
+
+/// @brief 블렌드 상태를 생성합니다.
+/// @param desc 블렌드 상태 설명
+/// @return 블렌드 상태 핸들 (실패 시 무효 핸들)
+/// @note 고정 기능(불투명, 깊이 LESS, 후면 컬링, 점 샘플링)으로 그리므로 상태 객체는 설명만 보관하고 결과에는 반영하지 않습니다.
+BlendStateHandle SoftwareRenderDevice::CreateBlendState(const BlendDesc& desc) noexcept {
+    BlendDesc copy = desc;
+    const uint32_t id = m_BlendStates.Add(std::move(copy));
+    if (id == 0U) {
+        return {};
+    }
+
+    ++m_FrameStats.StatesCreated;
+
+    return { id };
+}
+
+/// @brief 깊이 스텐실 상태를 생성합니다.
+/// @param desc 깊이 스텐실 상태 설명
+/// @return 깊이 스텐실 상태 핸들 (실패 시 무효 핸들)
+DepthStencilStateHandle SoftwareRenderDevice::CreateDepthStencilState(const DepthStencilDesc& desc) noexcept {
+    DepthStencilDesc copy = desc;
+    const uint32_t id = m_DepthStencilStates.Add(std::move(copy));
+    if (id == 0U) {
+        return {};
+    }
+
+    ++m_FrameStats.StatesCreated;
+
+    return { id };
+}
+
+/// @brief 래스터라이저 상태를 생성합니다.
+/// @param desc 래스터라이저 상태 설명
+/// @return 래스터라이저 상태 핸들 (실패 시 무효 핸들)
+RasterizerStateHandle SoftwareRenderDevice::CreateRasterizerState(const RasterizerDesc& desc) noexcept {
+    RasterizerDesc copy = desc;
+    const uint32_t id = m_RasterizerStates.Add(std::move(copy));
+    if (id == 0U) {
+        return {};
+    }
+
+    ++m_FrameStats.StatesCreated;
+
+    return { id };
+}
+
+/// @brief 샘플러를 생성합니다.
+/// @param desc 샘플러 설명
+/// @return 샘플러 핸들 (실패 시 무효 핸들)
+SamplerHandle SoftwareRenderDevice::CreateSampler(const SamplerDesc& desc) noexcept {
+    SamplerDesc copy = desc;
+    const uint32_t id = m_Samplers.Add(std::move(copy));
+    if (id == 0U) {
+        return {};
+    }
+
+    ++m_FrameStats.StatesCreated;
+
+    return { id };
+}
+
+/// @brief 블렌드 상태를 해제합니다.
+/// @param handle 블렌드 상태 핸들
+void SoftwareRenderDevice::DestroyBlendState(BlendStateHandle handle) noexcept {
+    m_BlendStates.Remove(handle.ID);
+}
+
+/// @brief 깊이 스텐실 상태를 해제합니다.
+/// @param handle 깊이 스텐실 상태 핸들
+void SoftwareRenderDevice::DestroyDepthStencilState(DepthStencilStateHandle handle) noexcept {
+    m_DepthStencilStates.Remove(handle.ID);
+}
+
+/// @brief 래스터라이저 상태를 해제합니다.
+/// @param handle 래스터라이저 상태 핸들
+void SoftwareRenderDevice::DestroyRasterizerState(RasterizerStateHandle handle) noexcept {
+    m_RasterizerStates.Remove(handle.ID);
+}
+
+/// @brief 샘플러를 해제합니다.
+/// @param handle 샘플러 핸들
+void SoftwareRenderDevice::DestroySampler(SamplerHandle handle) noexcept {
+    m_Samplers.Remove(handle.ID);
+}
+
+/// @brief 백 버퍼의 설명을 취득합니다.
+/// @return 텍스처 설명 (백 버퍼와 같은 크기, 형식)
+TextureDesc SoftwareRenderDevice::GetBackBufferDesc() const noexcept {
+    TextureDesc desc;
+    desc.Width  = m_Width;
+    desc.Height = m_Height;
+    desc.Format = TextureFormat::RGBA8;
+    return desc;
+}
+
+/// @brief 백 버퍼의 내용을 텍스처로 복사합니다.
+/// @param handle 텍스처 핸들 (백 버퍼와 같은 크기, 형식)
+/// @return 성공(true), 실패(false)
+/// @note 지금까지 제출된 삼각형을 먼저 래스터화합니다.
+bool SoftwareRenderDevice::CopyBackBufferToTexture(TextureHandle handle) noexcept {
+    Texture* texture = m_Textures.Get(handle.ID);
+    if (!texture || texture->Width != m_Width || texture->Height != m_Height) {
+        return false;
+    }
+
+    flushTiles();
+    std::copy(m_ColorBuffer.begin(), m_ColorBuffer.end(), texture->Texels.begin());
+    return true;
+}
+
+/// @brief 텍스처의 내용을 백 버퍼로 복사합니다.
+/// @param handle 텍스처 핸들 (백 버퍼와 같은 크기, 형식)
+/// @return 성공(true), 실패(false)
+/// @note 지금까지 제출된 삼각형은 덮어쓰이므로 버려지며, 깊이 버퍼는 클리어됩니다.
+bool SoftwareRenderDevice::CopyTextureToBackBuffer(TextureHandle handle) noexcept {
+    const Texture* texture = m_Textures.Get(handle.ID);
+    if (!texture || texture->Width != m_Width || texture->Height != m_Height) {
+        return false;
+    }
+
+    m_Triangles.clear();
+    for (auto& bin : m_Bins) {
+        bin.clear();
+    }
+
+    // 타일 배치로 복사
+    for (int32_t tile = 0; tile < m_TilesX * m_TilesY; ++tile) {
+        const int32_t tileX = (tile % m_TilesX) * TILE_SIZE;
+        const int32_t tileY = (tile / m_TilesX) * TILE_SIZE;
+        const int32_t width = std::min(TILE_SIZE, m_Width - tileX);
+        const int32_t height = std::min(TILE_SIZE, m_Height - tileY);
+
+        uint32_t* color = &m_TileColor[static_cast<size_t>(tile) * TILE_PIXELS];
+        uint32_t* depth = &m_TileDepth[static_cast<size_t>(tile) * TILE_PIXELS];
+        for (int32_t y = 0; y < height; ++y) {
+            std::memcpy(color + y * TILE_SIZE, &texture->Texels[static_cast<size_t>(tileY + y) * m_Width + tileX], sizeof(uint32_t) * width);
+        }
+        std::fill(depth, depth + TILE_PIXELS, DEPTH_MASK);
+    }
+
+    std::copy(texture->Texels.begin(), texture->Texels.end(), m_ColorBuffer.begin());
+    m_LoadTiles = true;
+    return true;
+}
+
+/// @brief 정점 버퍼를 바인딩합니다.
+/// @param handle 버퍼 핸들
+void SoftwareRenderDevice::SetVertexBuffer(BufferHandle handle) noexcept {
+    m_VertexBuffer = handle.ID;
+    ++m_FrameStats.StateChanges;
+}
+
+/// @brief 인덱스 버퍼를 바인딩합니다.
+/// @param handle 버퍼 핸들
+/// @param format 인덱스 형식
+void SoftwareRenderDevice::SetIndexBuffer(BufferHandle handle, IndexFormat format) noexcept {
+    m_IndexBuffer = handle.ID;
+    m_IndexFormat = format;
+    ++m_FrameStats.StateChanges;
+}
+
+/// @brief 상수 버퍼를 바인딩합니다.
+/// @param slot 슬롯 (0만 사용)
+/// @param handle 버퍼 핸들
+void SoftwareRenderDevice::SetConstantBuffer(uint32_t slot, BufferHandle handle) noexcept {
+    if (slot == 0U) {
+        m_ConstantBuffer = handle.ID;
+    }
+    ++m_FrameStats.StateChanges;
+}
+
+/// @brief 텍스처를 바인딩합니다.
+/// @param slot 슬롯 (0만 사용)
+/// @param handle 텍스처 핸들
+void SoftwareRenderDevice::SetTexture(uint32_t slot, TextureHandle handle) noexcept {
+    if (slot == 0U) {
+        m_Texture = handle.ID;
+    }
+    ++m_FrameStats.StateChanges;
+}
+
+/// @brief 샘플러를 바인딩합니다.
+/// @param slot 슬롯 (무시)
+/// @param handle 샘플러 핸들 (무시)
+void SoftwareRenderDevice::SetSampler(uint32_t, SamplerHandle) noexcept {
+    ++m_FrameStats.StateChanges;
+}
+
+/// @brief 셰이더를 바인딩합니다.
+/// @param stage 단계 (무시)
+/// @param handle 셰이더 핸들 (무시)
+void SoftwareRenderDevice::SetShader(ShaderStage, ShaderHandle) noexcept {
+    ++m_FrameStats.StateChanges;
+}
+
+/// @brief 블렌드 상태를 바인딩합니다.
+/// @param handle 블렌드 상태 핸들 (무시)
+void SoftwareRenderDevice::SetBlendState(BlendStateHandle) noexcept {
+    ++m_FrameStats.StateChanges;
+}
+
+/// @brief 깊이 스텐실 상태를 바인딩합니다.
+/// @param handle 깊이 스텐실 상태 핸들 (무시)
+void SoftwareRenderDevice::SetDepthStencilState(DepthStencilStateHandle) noexcept {
+    ++m_FrameStats.StateChanges;
+}
+
+/// @brief 래스터라이저 상태를 바인딩합니다.
+/// @param handle 래스터라이저 상태 핸들 (무시)
+void SoftwareRenderDevice::SetRasterizerState(RasterizerStateHandle) noexcept {
+    ++m_FrameStats.StateChanges;
+}
+
+/// @brief 프리미티브 토폴로지를 설정합니다.
+/// @param topology 프리미티브 토폴로지
+/// @note 선과 점은 래스터화하지 않습니다.
+void SoftwareRenderDevice::SetPrimitiveTopology(PrimitiveTopology topology) noexcept {
+    m_Topology = topology;
+    ++m_FrameStats.StateChanges;
+}
+
+/// @brief 드로우를 제출합니다.
+/// @param vertexCount 정점 수
+/// @param startVertex 시작 정점
+void SoftwareRenderDevice::Draw(uint32_t vertexCount, uint32_t startVertex) noexcept {
+    ++m_FrameStats.DrawCalls;
+    m_FrameStats.Vertices += vertexCount;
+
+    if (m_Topology != PrimitiveTopology::TriangleList && m_Topology != PrimitiveTopology::TriangleStrip) {
+        return;
+    }
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    m_IndexScratch.resize(vertexCount);
+    for (uint32_t i = 0U; i < vertexCount; ++i) {
+        m_IndexScratch[i] = startVertex + i;
+    }
+    submitTriangles(m_IndexScratch.data(), vertexCount, m_Topology == PrimitiveTopology::TriangleStrip);
+
+    m_RasterStats.SetupTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+/// @brief 인덱스 드로우를 제출합니다.
+/// @param indexCount 인덱스 수
+/// @param startIndex 시작 인덱스
+/// @param baseVertex 기준 정점
+void SoftwareRenderDevice::DrawIndexed(uint32_t indexCount, uint32_t startIndex, int32_t baseVertex) noexcept {
+    ++m_FrameStats.DrawCalls;
+    m_FrameStats.Vertices += indexCount;
+
+    if (m_Topology != PrimitiveTopology::TriangleList && m_Topology != PrimitiveTopology::TriangleStrip) {
+        return;
+    }
+
+    Buffer* indexBuffer = m_Buffers.Get(m_IndexBuffer);
+    if (!indexBuffer) {
+        return;
+    }
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    // 인덱스 버퍼 범위 확인
+    const size_t indexSize = (m_IndexFormat == IndexFormat::UInt16) ? sizeof(uint16_t) : sizeof(uint32_t);
+    const size_t available = indexBuffer->Data.size() / indexSize;
+    if (static_cast<size_t>(startIndex) + indexCount > available) {
+        return;
+    }
+
+    m_IndexScratch.resize(indexCount);
+    const byte_t* src = indexBuffer->Data.data() + static_cast<size_t>(startIndex) * indexSize;
+    for (uint32_t i = 0U; i < indexCount; ++i) {
+        uint32_t value = 0U;
+        if (m_IndexFormat == IndexFormat::UInt16) {
+            uint16_t value16 = 0U;
+            std::memcpy(&value16, src + i * sizeof(uint16_t), sizeof(uint16_t));
+            value = value16;
+        } else {
+            std::memcpy(&value, src + i * sizeof(uint32_t), sizeof(uint32_t));
+        }
+        m_IndexScratch[i] = static_cast<uint32_t>(static_cast<int64_t>(value) + baseVertex);
+    }
+    submitTriangles(m_IndexScratch.data(), indexCount, m_Topology == PrimitiveTopology::TriangleStrip);
+
+    m_RasterStats.SetupTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+/// @brief 마지막으로 완료된 프레임의 통계를 취득합니다.
+/// @return 렌더링 통계
+const RenderStats& SoftwareRenderDevice::GetFrameStats() const noexcept {
+    return m_LastFrameStats;
+}
+
+/// @brief 마지막으로 완료된 프레임의 래스터 통계를 취득합니다.
+/// @return 래스터 통계
+const SoftwareRasterStats& SoftwareRenderDevice::GetRasterStats() const noexcept {
+    return m_LastRasterStats;
+}
+
+/// @brief 래스터화에 사용할 스레드 수를 설정합니다.
+/// @param threadCount 호출 스레드를 포함한 스레드 수 (0이면 하드웨어 스레드 수)
+/// @return 성공(true), 프레임 진행 중이라 거부(false)
+/// @note 코어 수에 따른 확장성을 측정할 때 사용합니다. BeginFrame과 EndFrame 사이에는 작업 스레드를 바꾸지 않고 거부하며,
+///       프레임 밖에서는 작업 스레드가 모두 대기 중이므로 이를 합류시킨 뒤 새로 시작합니다. 렌더링 스레드에서만 호출해야 합니다.
+bool SoftwareRenderDevice::SetThreadCount(uint32_t threadCount) noexcept {
+    if (m_InFrame) {
+        return false;
+    }
+
+    stopWorkers();
+    startWorkers(threadCount);
+    return true;
+}
+
+/// @brief 래스터화에 사용하는 스레드 수를 취득합니다.
+/// @return 호출 스레드를 포함한 스레드 수
+uint32_t SoftwareRenderDevice::GetThreadCount() const noexcept {
+    return static_cast<uint32_t>(m_Workers.size()) + 1U;
+}
+
+/// @brief 마지막으로 완료된 프레임의 색상 버퍼를 취득합니다.
+/// @return 색상 버퍼 (R8G8B8A8, 행 우선, 너비 * 높이)
+const uint32_t* SoftwareRenderDevice::GetColorBuffer() const noexcept {
+    return m_ColorBuffer.data();
+}
+
+/// @brief 너비를 취득합니다.
+/// @return 너비
+int32_t SoftwareRenderDevice::GetWidth() const noexcept {
+    return m_Width;
+}
+
+/// @brief 높이를 취득합니다.
+/// @return 높이
+int32_t SoftwareRenderDevice::GetHeight() const noexcept {
+    return m_Height;
+}
+
+/// @brief 색상 버퍼를 32비트 BMP 파일로 저장합니다.
+/// @param path 파일 경로
+/// @return 성공(true), 실패(false)
+/// @note 골든 이미지 비교용입니다.
+bool SoftwareRenderDevice::SaveBMP(const char* path) const noexcept {
+    if (!path || m_ColorBuffer.empty()) {
+        return false;
+    }
+
+    FILE* fp = std::fopen(path, "wb");
+    if (!fp) {
+        return false;
+    }
+
+    const uint32_t imageSize = static_cast<uint32_t>(m_ColorBuffer.size() * sizeof(uint32_t));
+    byte_t header[54] = {};
+
+    auto write16 = [&](int32_t offset, uint32_t value) {
+        header[offset]      = static_cast<byte_t>(value);
+        header[offset + 1]  = static_cast<byte_t>(value >> 8);
+    };
+    auto write32 = [&](int32_t offset, uint32_t value) {
+        write16(offset, value & 0xFFFFU);
+        write16(offset + 2, value >> 16);
+    };
+
+    header[0] = 'B';
+    header[1] = 'M';
+    write32(2, 54U + imageSize);                                // 파일 크기
+    write32(10, 54U);                                           // 픽셀 데이터 위치
+    write32(14, 40U);                                           // BITMAPINFOHEADER 크기
+    write32(18, static_cast<uint32_t>(m_Width));
+    write32(22, static_cast<uint32_t>(-m_Height));              // 위에서 아래로
+    write16(26, 1U);                                            // 평면 수
+    write16(28, 32U);                                           // 비트 수
+    write32(34, imageSize);
+
+    bool succeeded = (std::fwrite(header, 1, sizeof(header), fp) == sizeof(header));
+
+    // R8G8B8A8 → B8G8R8A8
+    std::vector<uint32_t> row(static_cast<size_t>(m_Width));
+    for (int32_t y = 0; y < m_Height && succeeded; ++y) {
+        const uint32_t* src = &m_ColorBuffer[static_cast<size_t>(y) * m_Width];
+        for (int32_t x = 0; x < m_Width; ++x) {
+            row[x] = (src[x] & 0xFF00FF00U) | ((src[x] >> 16) & 0xFFU) | ((src[x] & 0xFFU) << 16);
+        }
+        succeeded = (std::fwrite(row.data(), sizeof(uint32_t), row.size(), fp) == row.size());
+    }
+
+    std::fclose(fp);
+    return succeeded;
+}
\ No newline at end of file
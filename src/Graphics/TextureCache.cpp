@@ -0,0 +1,171 @@
+#include "Graphics/TextureCache.hpp"
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <utility>
+
+using namespace graphics;
+
+namespace {
+    std::atomic<uint32_t> s_TempCounter{ 0U };      ///< 임시 파일 이름 충돌 방지용 일련번호
+
+    /// @brief 쿠킹된 파일 내용으로부터 텍스처 설명과 데이터 위치를 설정합니다.
+    /// @param data 쿠킹된 파일 내용
+    /// @param size 쿠킹된 파일 크기
+    /// @param key 기대하는 캐시 키
+    /// @param texture 결과
+    /// @return 유효(true), 무효(false)
+    bool bindCooked(const byte_t* data, size_t size, uint64_t key, CookedTexture& texture) noexcept {
+        CookedTextureHeader header;
+        if (!TextureCooker::ReadHeader(data, size, header) || header.Key != key) {
+            return false;
+        }
+
+        texture.Desc.Width      = header.Width;
+        texture.Desc.Height     = header.Height;
+        texture.Desc.MipLevels  = header.MipLevels;
+        texture.Desc.Format     = static_cast<TextureFormat>(header.Format);
+        texture.Data            = data + header.DataOffset;
+        return true;
+    }
+}
+
+/// @brief 생성자
+/// @param directory 캐시 디렉터리 (없으면 처음 쿠킹할 때 생성)
+TextureCache::TextureCache(std::string directory) noexcept : m_Directory(std::move(directory)), m_Hits(0ULL), m_Cooks(0ULL), m_Failures(0ULL) {
+
+}
+
+/// @brief 캐시 키에 해당하는 캐시 파일 경로를 취득합니다.
+/// @param key 캐시 키
+/// @return 경로
+std::string TextureCache::getCachePath(uint64_t key) const noexcept {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.nxtex", static_cast<unsigned long long>(key));
+    return (std::filesystem::path(m_Directory) / name).string();
+}
+
+/// @brief 캐시 파일을 기록합니다.
+/// @param path 캐시 파일 경로
+/// @param cooked 쿠킹 결과
+/// @return 성공(true), 실패(false)
+/// @note 임시 파일에 먼저 기록한 뒤 이름을 바꾸므로, 다른 스레드나 프로세스가 기록 중인 파일을 읽는 일이 없습니다.
+bool TextureCache::writeCacheFile(const std::string& path, const std::vector<byte_t>& cooked) const noexcept {
+    std::error_code error;
+    std::filesystem::create_directories(m_Directory, error);
+
+    const std::string temp = path + "." + std::to_string(s_TempCounter.fetch_add(1U, std::memory_order_relaxed)) + ".tmp";
+    {
+        std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+        if (!file.write(reinterpret_cast<const char*>(cooked.data()), static_cast<std::streamsize>(cooked.size()))) {
+            file.close();
+            std::filesystem::remove(temp, error);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(temp, path, error);
+    if (error) {
+        std::filesystem::remove(temp, error);
+        return false;
+    }
+    return true;
+}
+
+/// @brief 텍스처를 GPU에 올릴 수 있도록 준비합니다.
+/// @param path 원본 이미지 경로
+/// @param options 쿠킹 옵션
+/// @param texture 결과
+/// @return 성공(true), 실패(false: 원본이 없거나 디코딩할 수 없음)
+/// @note 캐시 파일이 없거나 원본이 바뀌었으면 쿠킹해서 캐시 파일을 만듭니다.
+///       렌더 디바이스를 사용하지 않으므로 로딩 스레드(OnLoadAsync)에서 호출할 수 있습니다. (여러 스레드에서 동시에 호출해도 안전)
+bool TextureCache::Prepare(const std::string& path, const TextureCookOptions& options, CookedTexture& texture) noexcept {
+    system::MappedFile source;
+    if (!source.Open(path)) {
+        m_Failures.fetch_add(1ULL, std::memory_order_relaxed);
+        return false;
+    }
+
+    const uint64_t key = TextureCooker::GetCacheKey(source.GetData(), source.GetSize(), options);
+    const std::string cachePath = getCachePath(key);
+
+    texture.Memory.clear();
+    if (texture.File.Open(cachePath) && bindCooked(texture.File.GetData(), texture.File.GetSize(), key, texture)) {
+        m_Hits.fetch_add(1ULL, std::memory_order_relaxed);
+        return true;
+    }
+    texture.File.Close();
+
+    std::vector<byte_t> cooked;
+    if (!TextureCooker::Cook(source.GetData(), source.GetSize(), options, cooked)) {
+        m_Failures.fetch_add(1ULL, std::memory_order_relaxed);
+        return false;
+    }
+    m_Cooks.fetch_add(1ULL, std::memory_order_relaxed);
+
+    // 캐시 파일을 매핑해서 사용하고, 기록할 수 없으면 (읽기 전용 디렉터리 등) 메모리에 보관한 결과를 사용합니다.
+    if (writeCacheFile(cachePath, cooked) && texture.File.Open(cachePath) && bindCooked(texture.File.GetData(), texture.File.GetSize(), key, texture)) {
+        return true;
+    }
+    texture.File.Close();
+
+    texture.Memory = std::move(cooked);
+    return bindCooked(texture.Memory.data(), texture.Memory.size(), key, texture);
+}
+
+/// @brief 준비된 텍스처를 생성합니다.
+/// @param device 렌더 디바이스
+/// @param texture 준비된 텍스처
+/// @return 텍스처 핸들 (실패 시 무효 핸들)
+/// @note 매핑된 데이터를 그대로 디바이스에 넘기므로, 생성이 끝나면 texture를 해제해도 됩니다.
+TextureHandle TextureCache::Create(IRenderDevice& device, const CookedTexture& texture) noexcept {
+    if (!texture.Data) {
+        return {};
+    }
+    return device.CreateTexture(texture.Desc, texture.Data);
+}
+
+/// @brief 텍스처를 불러옵니다. (Prepare + Create)
+/// @param device 렌더 디바이스
+/// @param path 원본 이미지 경로
+/// @param options 쿠킹 옵션 (디바이스가 지원하지 않는 압축 형식은 압축하지 않음으로 바뀜)
+/// @return 텍스처 핸들 (실패 시 무효 핸들)
+TextureHandle TextureCache::Load(IRenderDevice& device, const std::string& path, TextureCookOptions options) noexcept {
+    bool supported = true;
+    switch (options.Compression) {
+        case TextureCompression::None:
+            break;
+        case TextureCompression::BC1:
+            supported = device.IsTextureFormatSupported(TextureFormat::BC1);
+            break;
+        case TextureCompression::BC3:
+            supported = device.IsTextureFormatSupported(TextureFormat::BC3);
+            break;
+        case TextureCompression::BC7:
+            supported = device.IsTextureFormatSupported(TextureFormat::BC7);
+            break;
+        case TextureCompression::Auto:
+            supported = device.IsTextureFormatSupported(TextureFormat::BC1) && device.IsTextureFormatSupported(TextureFormat::BC3);
+            break;
+    }
+    if (!supported) {
+        options.Compression = TextureCompression::None;
+    }
+
+    CookedTexture texture;
+    if (!Prepare(path, options, texture)) {
+        return {};
+    }
+    return Create(device, texture);
+}
+
+/// @brief 통계를 취득합니다.
+/// @return 통계
+TextureCacheStats TextureCache::GetStats() const noexcept {
+    TextureCacheStats stats;
+    stats.Hits      = m_Hits.load(std::memory_order_relaxed);
+    stats.Cooks     = m_Cooks.load(std::memory_order_relaxed);
+    stats.Failures  = m_Failures.load(std::memory_order_relaxed);
+    return stats;
+}
\ No newline at end of file
@@ -0,0 +1,897 @@
+#include "Graphics/TextureCooker.hpp"
+#include "Type/Hash.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(_WIN32)
+    #include <windows.h>
+    #include <wincodec.h>
+    #include <wrl/client.h>
+
+    #if defined(_MSC_VER)
+        #pragma comment(lib, "windowscodecs.lib")
+        #pragma comment(lib, "ole32.lib")
+    #endif
+#endif
+
+namespace {
+    /// @brief 리틀 엔디언 값을 읽습니다.
+    template <typename T>
+    inline T read(const byte_t* p) noexcept {
+        T value;
+        std::memcpy(&value, p, sizeof(T));
+        return value;
+    }
+
+    /// @brief 정수 크기를 정렬합니다.
+    inline uint64_t alignUp(uint64_t value, uint64_t alignment) noexcept {
+        return (value + alignment - 1U) & ~(alignment - 1U);
+    }
+
+    /// @brief BMP를 디코딩합니다. (8비트 팔레트, 24비트, 32비트 무압축)
+    /// @param data 파일 내용
+    /// @param size 파일 크기
+    /// @param image 결과
+    /// @return 성공(true), 실패(false)
+    bool decodeBMP(const byte_t* data, size_t size, graphics::Image& image) noexcept {
+        if (size < 54U || data[0] != 'B' || data[1] != 'M') {
+            return false;
+        }
+
+        const uint32_t pixelOffset  = read<uint32_t>(data + 10);
+        const uint32_t headerSize   = read<uint32_t>(data + 14);
+        const int32_t width         = read<int32_t>(data + 18);
+        const int32_t rawHeight     = read<int32_t>(data + 22);
+        const uint16_t bitCount     = read<uint16_t>(data + 28);
+        const uint32_t compression  = read<uint32_t>(data + 30);
+        uint32_t paletteCount       = read<uint32_t>(data + 46);
+
+        // BI_RGB(0) 또는 32비트 BI_BITFIELDS(3, 표준 BGRA 마스크로 간주)
+        const bool supported = (compression == 0U && (bitCount == 8U || bitCount == 24U || bitCount == 32U)) || (compression == 3U && bitCount == 32U);
+        if (!supported || width <= 0 || rawHeight == 0 || rawHeight == INT32_MIN) {
+            return false;
+        }
+
+        // 크기 계산은 64비트로 수행 (32비트 헤더 값의 합, 곱이 넘치면 범위 밖을 가리킴)
+        const bool topDown      = rawHeight < 0;
+        const int32_t height    = topDown ? -rawHeight : rawHeight;
+        const uint64_t stride   = ((static_cast<uint64_t>(width) * bitCount + 31U) / 32U) * 4U;
+        if (headerSize < 40U || 14U + static_cast<uint64_t>(headerSize) > size) {
+            return false;
+        }
+        if (pixelOffset > size || static_cast<uint64_t>(height) > (size - pixelOffset) / stride) {
+            return false;
+        }
+
+        const byte_t* palette = nullptr;
+        if (bitCount == 8U) {
+            paletteCount = (paletteCount == 0U) ? 256U : std::min(paletteCount, 256U);
+            if (14U + static_cast<uint64_t>(headerSize) + paletteCount * 4U > size) {
+                return false;
+            }
+            palette = data + 14 + headerSize;
+        }
+
+        image.Width     = width;
+        image.Height    = height;
+        image.Pixels.resize(static_cast<size_t>(width) * height * 4U);
+
+        bool hasAlpha = false;
+        for (int32_t y = 0; y < height; ++y) {
+            const byte_t* src = data + pixelOffset + static_cast<size_t>(stride) * (topDown ? y : (height - 1 - y));
+            byte_t* dst = image.Pixels.data() + static_cast<size_t>(y) * width * 4U;
+
+            for (int32_t x = 0; x < width; ++x, dst += 4) {
+                const byte_t* bgr = src;
+                byte_t alpha = 255U;
+                if (bitCount == 8U) {
+                    const uint32_t index = src[x];
+                    bgr = palette + ((index < paletteCount) ? index : 0U) * 4U;
+                } else if (bitCount == 24U) {
+                    bgr = src + x * 3;
+                } else {
+                    bgr = src + x * 4;
+                    alpha = bgr[3];
+                    hasAlpha |= (alpha != 0U);
+                }
+
+                dst[0] = bgr[2];
+                dst[1] = bgr[1];
+                dst[2] = bgr[0];
+                dst[3] = alpha;
+            }
+        }
+
+        // 32비트 BMP는 대부분 알파 자리를 0으로 채우므로, 전부 0이면 불투명으로 봅니다.
+        if (bitCount == 32U && !hasAlpha) {
+            for (size_t i = 3U; i < image.Pixels.size(); i += 4U) {
+                image.Pixels[i] = 255U;
+            }
+        }
+
+        return true;
+    }
+
+    /// @brief DDS 파일 정보
+    struct DDSInfo final {
+        graphics::TextureDesc Desc;         ///< 텍스처 설명
+        const byte_t* Data = nullptr;       ///< 데이터 (0단계부터 연속)
+        bool SwapRedBlue = false;           ///< B8G8R8A8 (무압축 전용)
+    };
+
+    /// @brief DDS 헤더를 해석합니다. (BC1, BC3, BC7, 32비트 무압축)
+    /// @param data 파일 내용
+    /// @param size 파일 크기
+    /// @param info 결과
+    /// @return 성공(true), 실패(false: 지원하지 않는 형식)
+    bool parseDDS(const byte_t* data, size_t size, DDSInfo& info) noexcept {
+        constexpr uint32_t DDSD_MIPMAPCOUNT = 0x20000U;
+        constexpr uint32_t DDPF_FOURCC      = 0x4U;
+        constexpr uint32_t DDPF_RGB         = 0x40U;
+
+        if (size < 128U || std::memcmp(data, "DDS ", 4) != 0 || read<uint32_t>(data + 4) != 124U) {
+            return false;
+        }
+
+        const uint32_t flags        = read<uint32_t>(data + 8);
+        const int32_t height        = read<int32_t>(data + 12);
+        const int32_t width         = read<int32_t>(data + 16);
+        const uint32_t mipCount     = read<uint32_t>(data + 28);
+        const uint32_t formatFlags  = read<uint32_t>(data + 80);
+        const uint32_t fourCC       = read<uint32_t>(data + 84);
+        const uint32_t bitCount     = read<uint32_t>(data + 88);
+        const uint32_t redMask      = read<uint32_t>(data + 92);
+
+        size_t offset = 128U;
+        graphics::TextureDesc& desc = info.Desc;
+        if (formatFlags & DDPF_FOURCC) {
+            if (std::memcmp(&fourCC, "DXT1", 4) == 0) {
+                desc.Format = graphics::TextureFormat::BC1;
+            } else if (std::memcmp(&fourCC, "DXT5", 4) == 0) {
+                desc.Format = graphics::TextureFormat::BC3;
+            } else if (std::memcmp(&fourCC, "DX10", 4) == 0 && size >= 148U) {
+                // DDS_HEADER_DXT10: DXGI_FORMAT_BC1_UNORM(71), BC3_UNORM(77), BC7_UNORM(98)
+                const uint32_t dxgiFormat = read<uint32_t>(data + 128);
+                if (dxgiFormat == 71U) {
+                    desc.Format = graphics::TextureFormat::BC1;
+                } else if (dxgiFormat == 77U) {
+                    desc.Format = graphics::TextureFormat::BC3;
+                } else if (dxgiFormat == 98U) {
+                    desc.Format = graphics::TextureFormat::BC7;
+                } else {
+                    return false;
+                }
+                offset = 148U;
+            } else {
+                return false;
+            }
+        } else if ((formatFlags & DDPF_RGB) && bitCount == 32U && (redMask == 0x000000FFU || redMask == 0x00FF0000U)) {
+            desc.Format = graphics::TextureFormat::RGBA8;
+            info.SwapRedBlue = (redMask == 0x00FF0000U);
+        } else {
+            return false;
+        }
+
+        desc.Width      = width;
+        desc.Height     = height;
+        desc.MipLevels  = ((flags & DDSD_MIPMAPCOUNT) && mipCount > 0U) ? mipCount : 1U;
+        if (!graphics::IsValidTextureDesc(desc) || graphics::GetTextureDataSize(desc) > size - offset) {
+            return false;
+        }
+
+        info.Data = data + offset;
+        return true;
+    }
+
+#if defined(_WIN32)
+    /// @brief WIC로 이미지를 디코딩합니다. (JPEG, PNG, GIF, TIFF 등 Windows가 지원하는 모든 형식)
+    /// @param data 파일 내용
+    /// @param size 파일 크기
+    /// @param image 결과
+    /// @return 성공(true), 실패(false)
+    bool decodeWIC(const byte_t* data, size_t size, graphics::Image& image) noexcept {
+        using Microsoft::WRL::ComPtr;
+
+        if (size > UINT32_MAX) {
+            return false;
+        }
+
+        // 호출 스레드가 이미 다른 모드로 COM을 초기화했다면(RPC_E_CHANGED_MODE) 그대로 사용합니다.
+        const HRESULT init = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+        bool result = false;
+        {
+            ComPtr<IWICImagingFactory> factory;
+            ComPtr<IWICStream> stream;
+            ComPtr<IWICBitmapDecoder> decoder;
+            ComPtr<IWICBitmapFrameDecode> frame;
+            ComPtr<IWICFormatConverter> converter;
+            UINT width = 0, height = 0;
+
+            if (SUCCEEDED(CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(&factory))) &&
+                SUCCEEDED(factory->CreateStream(&stream)) &&
+                SUCCEEDED(stream->InitializeFromMemory(const_cast<BYTE*>(data), static_cast<DWORD>(size))) &&
+                SUCCEEDED(factory->CreateDecoderFromStream(stream.Get(), nullptr, WICDecodeMetadataCacheOnDemand, &decoder)) &&
+                SUCCEEDED(decoder->GetFrame(0, &frame)) &&
+                SUCCEEDED(factory->CreateFormatConverter(&converter)) &&
+                SUCCEEDED(converter->Initialize(frame.Get(), GUID_WICPixelFormat32bppRGBA, WICBitmapDitherTypeNone, nullptr, 0.0, WICBitmapPaletteTypeCustom)) &&
+                SUCCEEDED(converter->GetSize(&width, &height)) &&
+                width > 0U && height > 0U && width <= INT32_MAX / 4U && height <= INT32_MAX) {
+                image.Width     = static_cast<int32_t>(width);
+                image.Height    = static_cast<int32_t>(height);
+                image.Pixels.resize(static_cast<size_t>(width) * height * 4U);
+
+                const UINT stride = width * 4U;
+                result = image.Pixels.size() <= UINT32_MAX &&
+                    SUCCEEDED(converter->CopyPixels(nullptr, stride, static_cast<UINT>(image.Pixels.size()), image.Pixels.data()));
+            }
+        }
+
+        if (SUCCEEDED(init)) {
+            CoUninitialize();
+        }
+        return result;
+    }
+#endif
+
+    /// @brief sRGB -> 선형 변환표 (0.0 ~ 1.0)
+    const float* getSrgbToLinearTable() noexcept {
+        static const auto table = [] {
+            std::vector<float> values(256U);
+            for (uint32_t i = 0U; i < 256U; ++i) {
+                const float c = static_cast<float>(i) / 255.0f;
+                values[i] = (c <= 0.04045f) ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+            }
+            return values;
+        }();
+        return table.data();
+    }
+
+    constexpr uint32_t LINEAR_TO_SRGB_STEPS = 4096U;    ///< 선형 -> sRGB 변환표 크기
+
+    /// @brief 선형(0 ~ LINEAR_TO_SRGB_STEPS - 1) -> sRGB 변환표
+    const byte_t* getLinearToSrgbTable() noexcept {
+        static const auto table = [] {
+            std::vector<byte_t> values(LINEAR_TO_SRGB_STEPS);
+            for (uint32_t i = 0U; i < LINEAR_TO_SRGB_STEPS; ++i) {
+                const float l = static_cast<float>(i) / static_cast<float>(LINEAR_TO_SRGB_STEPS - 1U);
+                const float c = (l <= 0.0031308f) ? l * 12.92f : 1.055f * std::pow(l, 1.0f / 2.4f) - 0.055f;
+                values[i] = static_cast<byte_t>(std::lround(std::clamp(c, 0.0f, 1.0f) * 255.0f));
+            }
+            return values;
+        }();
+        return table.data();
+    }
+
+    /// @brief 4x4 블록을 읽습니다. (가장자리 밖은 가장자리 픽셀로 채움)
+    /// @param pixels 이미지 (R8G8B8A8)
+    /// @param width 너비
+    /// @param height 높이
+    /// @param bx 블록 X
+    /// @param by 블록 Y
+    /// @param block 결과 (16픽셀 x RGBA)
+    void loadBlock(const byte_t* pixels, int32_t width, int32_t height, int32_t bx, int32_t by, byte_t (&block)[64]) noexcept {
+        for (int32_t y = 0; y < 4; ++y) {
+            const int32_t sy = std::min(by * 4 + y, height - 1);
+            for (int32_t x = 0; x < 4; ++x) {
+                const int32_t sx = std::min(bx * 4 + x, width - 1);
+                std::memcpy(block + (y * 4 + x) * 4, pixels + (static_cast<size_t>(sy) * width + sx) * 4U, 4U);
+            }
+        }
+    }
+
+    /// @brief 블록의 주성분 축을 따라 양 끝점을 찾습니다.
+    /// @param block 블록 (16픽셀 x RGBA)
+    /// @param channels 사용할 채널 수 (3: RGB, 4: RGBA)
+    /// @param mask 사용할 픽셀 비트마스크
+    /// @param minColor 결과 (축의 최소 쪽 끝점)
+    /// @param maxColor 결과 (축의 최대 쪽 끝점)
+    /// @note 공분산 행렬에 거듭제곱법을 적용해 축을 구하고, 끝점은 경계 상자 안쪽으로 살짝 당겨 양자화 오차를 줄입니다.
+    void findEndpoints(const byte_t (&block)[64], uint32_t channels, uint32_t mask, float (&minColor)[4], float (&maxColor)[4]) noexcept {
+        float mean[4] = {};
+        float count = 0.0f;
+        for (uint32_t i = 0U; i < 16U; ++i) {
+            if (mask & (1U << i)) {
+                for (uint32_t c = 0U; c < channels; ++c) {
+                    mean[c] += block[i * 4U + c];
+                }
+                count += 1.0f;
+            }
+        }
+        for (uint32_t c = 0U; c < channels; ++c) {
+            mean[c] /= count;
+        }
+
+        float cov[4][4] = {};
+        for (uint32_t i = 0U; i < 16U; ++i) {
+            if (mask & (1U << i)) {
+                for (uint32_t a = 0U; a < channels; ++a) {
+                    const float da = block[i * 4U + a] - mean[a];
+                    for (uint32_t b = a; b < channels; ++b) {
+                        cov[a][b] += da * (block[i * 4U + b] - mean[b]);
+                    }
+                }
+            }
+        }
+
+        float axis[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+        for (uint32_t iteration = 0U; iteration < 8U; ++iteration) {
+            float next[4] = {};
+            for (uint32_t a = 0U; a < channels; ++a) {
+                for (uint32_t b = 0U; b < channels; ++b) {
+                    next[a] += ((a <= b) ? cov[a][b] : cov[b][a]) * axis[b];
+                }
+            }
+
+            float length = 0.0f;
+            for (uint32_t c = 0U; c < channels; ++c) {
+                length = std::max(length, std::fabs(next[c]));
+            }
+            if (length < 1e-6f) {
+                break;
+            }
+            for (uint32_t c = 0U; c < channels; ++c) {
+                axis[c] = next[c] / length;
+            }
+        }
+
+        float lo = 1e30f, hi = -1e30f;
+        for (uint32_t i = 0U; i < 16U; ++i) {
+            if (mask & (1U << i)) {
+                float t = 0.0f;
+                for (uint32_t c = 0U; c < channels; ++c) {
+                    t += (block[i * 4U + c] - mean[c]) * axis[c];
+                }
+                lo = std::min(lo, t);
+                hi = std::max(hi, t);
+            }
+        }
+
+        float axisLengthSq = 0.0f;
+        for (uint32_t c = 0U; c < channels; ++c) {
+            axisLengthSq += axis[c] * axis[c];
+        }
+        const float scale = (axisLengthSq > 0.0f) ? 1.0f / axisLengthSq : 0.0f;
+        const float inset = (hi - lo) / 32.0f;
+        for (uint32_t c = 0U; c < channels; ++c) {
+            minColor[c] = std::clamp(mean[c] + (lo + inset) * axis[c] * scale, 0.0f, 255.0f);
+            maxColor[c] = std::clamp(mean[c] + (hi - inset) * axis[c] * scale, 0.0f, 255.0f);
+        }
+    }
+
+    /// @brief RGB를 R5G6B5로 양자화합니다.
+    inline uint16_t toRGB565(const float (&color)[4]) noexcept {
+        const uint32_t r = static_cast<uint32_t>(std::lround(color[0] * 31.0f / 255.0f));
+        const uint32_t g = static_cast<uint32_t>(std::lround(color[1] * 63.0f / 255.0f));
+        const uint32_t b = static_cast<uint32_t>(std::lround(color[2] * 31.0f / 255.0f));
+        return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+    }
+
+    /// @brief R5G6B5를 RGB로 복원합니다.
+    inline void fromRGB565(uint16_t value, int32_t (&color)[3]) noexcept {
+        const int32_t r = (value >> 11) & 31;
+        const int32_t g = (value >> 5) & 63;
+        const int32_t b = value & 31;
+        color[0] = (r << 3) | (r >> 2);
+        color[1] = (g << 2) | (g >> 4);
+        color[2] = (b << 3) | (b >> 2);
+    }
+
+    /// @brief BC1 색상 블록(8바이트)을 만듭니다.
+    /// @param block 블록 (16픽셀 x RGBA)
+    /// @param allowTransparent 1비트 알파(3색 모드) 허용 여부 (BC3의 색상 블록은 false)
+    /// @param dst 결과
+    void compressColorBlock(const byte_t (&block)[64], bool allowTransparent, byte_t* dst) noexcept {
+        uint32_t opaqueMask = 0xFFFFU;
+        if (allowTransparent) {
+            opaqueMask = 0U;
+            for (uint32_t i = 0U; i < 16U; ++i) {
+                opaqueMask |= (block[i * 4U + 3U] >= 128U) ? (1U << i) : 0U;
+            }
+        }
+
+        if (opaqueMask == 0U) {
+            // 전부 투명: c0 <= c1인 3색 모드에서 인덱스 3
+            const uint16_t zero = 0U;
+            std::memcpy(dst, &zero, 2U);
+            std::memcpy(dst + 2, &zero, 2U);
+            std::memset(dst + 4, 0xFF, 4U);
+            return;
+        }
+
+        float minColor[4], maxColor[4];
+        findEndpoints(block, 3U, opaqueMask, minColor, maxColor);
+
+        uint16_t c0 = toRGB565(maxColor);
+        uint16_t c1 = toRGB565(minColor);
+        const bool threeColor = (opaqueMask != 0xFFFFU);
+
+        // 4색 모드는 c0 > c1, 3색 모드는 c0 <= c1
+        if (threeColor ? (c0 > c1) : (c0 < c1)) {
+            std::swap(c0, c1);
+        }
+
+        int32_t palette[4][3];
+        fromRGB565(c0, palette[0]);
+        fromRGB565(c1, palette[1]);
+        uint32_t paletteCount = 4U;
+        if (!threeColor && c0 != c1) {
+            for (uint32_t c = 0U; c < 3U; ++c) {
+                palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+                palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+            }
+        } else if (threeColor) {
+            for (uint32_t c = 0U; c < 3U; ++c) {
+                palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            }
+            paletteCount = 3U;
+        } else {
+            paletteCount = 1U;
+        }
+
+        uint32_t indices = 0U;
+        for (uint32_t i = 0U; i < 16U; ++i) {
+            uint32_t best = 3U;
+            if (opaqueMask & (1U << i)) {
+                int32_t bestError = INT32_MAX;
+                for (uint32_t p = 0U; p < paletteCount; ++p) {
+                    int32_t error = 0;
+                    for (uint32_t c = 0U; c < 3U; ++c) {
+                        const int32_t d = static_cast<int32_t>(block[i * 4U + c]) - palette[p][c];
+                        error += d * d;
+                    }
+                    if (error < bestError) {
+                        bestError = error;
+                        best = p;
+                    }
+                }
+            }
+            indices |= best << (i * 2U);
+        }
+
+        std::memcpy(dst, &c0, 2U);
+        std::memcpy(dst + 2, &c1, 2U);
+        std::memcpy(dst + 4, &indices, 4U);
+    }
+
+    /// @brief BC3 알파 블록(8바이트)을 만듭니다. (8단계 보간 모드)
+    /// @param block 블록 (16픽셀 x RGBA)
+    /// @param dst 결과
+    void compressAlphaBlock(const byte_t (&block)[64], byte_t* dst) noexcept {
+        uint32_t a0 = 0U, a1 = 255U;
+        for (uint32_t i = 0U; i < 16U; ++i) {
+            a0 = std::max<uint32_t>(a0, block[i * 4U + 3U]);
+            a1 = std::min<uint32_t>(a1, block[i * 4U + 3U]);
+        }
+
+        dst[0] = static_cast<byte_t>(a0);
+        dst[1] = static_cast<byte_t>(a1);
+
+        uint64_t indices = 0ULL;
+        if (a0 > a1) {
+            int32_t palette[8];
+            palette[0] = static_cast<int32_t>(a0);
+            palette[1] = static_cast<int32_t>(a1);
+            for (int32_t p = 1; p < 7; ++p) {
+                palette[p + 1] = ((7 - p) * palette[0] + p * palette[1]) / 7;
+            }
+
+            for (uint32_t i = 0U; i < 16U; ++i) {
+                const int32_t alpha = block[i * 4U + 3U];
+                uint64_t best = 0U;
+                int32_t bestError = INT32_MAX;
+                for (uint32_t p = 0U; p < 8U; ++p) {
+                    const int32_t error = std::abs(alpha - palette[p]);
+                    if (error < bestError) {
+                        bestError = error;
+                        best = p;
+                    }
+                }
+                indices |= best << (i * 3U);
+            }
+        }
+
+        for (uint32_t i = 0U; i < 6U; ++i) {
+            dst[2U + i] = static_cast<byte_t>(indices >> (i * 8U));
+        }
+    }
+
+    /// @brief 128비트 블록에 하위 비트부터 차례로 기록하는 도우미
+    struct BitWriter final {
+        byte_t* Data;
+        uint32_t Position = 0U;
+
+        void Write(uint32_t value, uint32_t bits) noexcept {
+            for (uint32_t i = 0U; i < bits; ++i, ++Position) {
+                Data[Position >> 3] |= static_cast<byte_t>(((value >> i) & 1U) << (Position & 7U));
+            }
+        }
+    };
+
+    /// @brief BC7 블록(16바이트)을 만듭니다. (모드 6: 단일 영역, RGBA 7비트 + P비트 끝점, 4비트 인덱스)
+    /// @param block 블록 (16픽셀 x RGBA)
+    /// @param dst 결과
+    void compressBC7Block(const byte_t (&block)[64], byte_t* dst) noexcept {
+        static constexpr int32_t WEIGHTS[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+        float minColor[4], maxColor[4];
+        findEndpoints(block, 4U, 0xFFFFU, minColor, maxColor);
+
+        // 끝점마다 P비트(모든 채널 공통 최하위 비트)를 양자화 오차가 작은 쪽으로 고릅니다.
+        uint32_t quantized[2][4];
+        uint32_t pbit[2];
+        int32_t endpoint[2][4];
+        const float* sources[2] = { minColor, maxColor };
+        for (uint32_t e = 0U; e < 2U; ++e) {
+            float bestError = 1e30f;
+            for (uint32_t p = 0U; p < 2U; ++p) {
+                float error = 0.0f;
+                uint32_t q[4];
+                for (uint32_t c = 0U; c < 4U; ++c) {
+                    q[c] = static_cast<uint32_t>(std::clamp(std::lround((sources[e][c] - static_cast<float>(p)) / 2.0f), 0L, 127L));
+                    const float d = static_cast<float>((q[c] << 1) | p) - sources[e][c];
+                    error += d * d;
+                }
+                if (error < bestError) {
+                    bestError = error;
+                    pbit[e] = p;
+                    std::memcpy(quantized[e], q, sizeof(q));
+                }
+            }
+            for (uint32_t c = 0U; c < 4U; ++c) {
+                endpoint[e][c] = static_cast<int32_t>((quantized[e][c] << 1) | pbit[e]);
+            }
+        }
+
+        int32_t palette[16][4];
+        for (uint32_t p = 0U; p < 16U; ++p) {
+            for (uint32_t c = 0U; c < 4U; ++c) {
+                palette[p][c] = ((64 - WEIGHTS[p]) * endpoint[0][c] + WEIGHTS[p] * endpoint[1][c] + 32) >> 6;
+            }
+        }
+
+        uint32_t indices[16];
+        for (uint32_t i = 0U; i < 16U; ++i) {
+            int32_t bestError = INT32_MAX;
+            for (uint32_t p = 0U; p < 16U; ++p) {
+                int32_t error = 0;
+                for (uint32_t c = 0U; c < 4U; ++c) {
+                    const int32_t d = static_cast<int32_t>(block[i * 4U + c]) - palette[p][c];
+                    error += d * d;
+                }
+                if (error < bestError) {
+                    bestError = error;
+                    indices[i] = p;
+                }
+            }
+        }
+
+        // 첫 픽셀(앵커)의 인덱스 최상위 비트는 0이어야 하므로, 필요하면 끝점을 맞바꿉니다.
+        if (indices[0] >= 8U) {
+            std::swap(quantized[0], quantized[1]);
+            std::swap(pbit[0], pbit[1]);
+            for (uint32_t i = 0U; i < 16U; ++i) {
+                indices[i] = 15U - indices[i];
+            }
+        }
+
+        std::memset(dst, 0, 16U);
+        BitWriter writer{ dst };
+        writer.Write(1U << 6, 7U);
+        for (uint32_t c = 0U; c < 4U; ++c) {
+            writer.Write(quantized[0][c], 7U);
+            writer.Write(quantized[1][c], 7U);
+        }
+        writer.Write(pbit[0], 1U);
+        writer.Write(pbit[1], 1U);
+        writer.Write(indices[0], 3U);
+        for (uint32_t i = 1U; i < 16U; ++i) {
+            writer.Write(indices[i], 4U);
+        }
+    }
+
+    /// @brief 이미지에 알파(255 미만)가 있는지 확인합니다.
+    /// @param image 이미지
+    /// @param binary 알파가 0 또는 255뿐인지 여부 (결과)
+    /// @return 알파 있음(true), 불투명(false)
+    bool hasAlpha(const graphics::Image& image, bool& binary) noexcept {
+        bool found = false;
+        binary = true;
+        for (size_t i = 3U; i < image.Pixels.size(); i += 4U) {
+            const byte_t alpha = image.Pixels[i];
+            found |= (alpha != 255U);
+            binary &= (alpha == 0U || alpha == 255U);
+        }
+        return found;
+    }
+}
+
+using namespace graphics;
+
+/// @brief 원본과 옵션으로부터 캐시 키를 계산합니다.
+/// @param source 원본 파일 내용
+/// @param size 원본 파일 크기
+/// @param options 쿠킹 옵션
+/// @return 캐시 키 (형식 버전이 바뀌어도 달라집니다.)
+uint64_t TextureCooker::GetCacheKey(const void* source, size_t size, const TextureCookOptions& options) noexcept {
+    uint64_t key = Hash64(source, size);
+    key = HashCombine(key, static_cast<uint64_t>(options.Compression));
+    key = HashCombine(key, (options.GenerateMips ? 1ULL : 0ULL) | (options.SrgbMips ? 2ULL : 0ULL));
+    key = HashCombine(key, VERSION);
+    return key;
+}
+
+/// @brief 원본 이미지를 R8G8B8A8로 디코딩합니다.
+/// @param source 원본 파일 내용
+/// @param size 원본 파일 크기
+/// @param image 결과
+/// @return 성공(true), 실패(false: 지원하지 않는 형식이거나 손상됨)
+/// @note BMP와 무압축 DDS는 모든 플랫폼에서, 그 밖의 형식(JPEG, PNG 등)은 Windows에서 WIC로 디코딩합니다.
+bool TextureCooker::Decode(const void* source, size_t size, Image& image) noexcept {
+    const byte_t* data = static_cast<const byte_t*>(source);
+    if (!data || size == 0U) {
+        return false;
+    }
+
+    if (decodeBMP(data, size, image)) {
+        return true;
+    }
+
+    DDSInfo dds;
+    if (parseDDS(data, size, dds)) {
+        if (dds.Desc.Format != TextureFormat::RGBA8) {
+            return false;
+        }
+
+        image.Width     = dds.Desc.Width;
+        image.Height    = dds.Desc.Height;
+        image.Pixels.assign(dds.Data, dds.Data + static_cast<size_t>(image.Width) * image.Height * 4U);
+        if (dds.SwapRedBlue) {
+            for (size_t i = 0U; i < image.Pixels.size(); i += 4U) {
+                std::swap(image.Pixels[i], image.Pixels[i + 2U]);
+            }
+        }
+        return true;
+    }
+
+#if defined(_WIN32)
+    return decodeWIC(data, size, image);
+#else
+    return false;
+#endif
+}
+
+/// @brief 원본 이미지를 쿠킹합니다.
+/// @param source 원본 파일 내용
+/// @param size 원본 파일 크기
+/// @param options 쿠킹 옵션
+/// @param cooked 결과 (CookedTextureHeader + 데이터)
+/// @return 성공(true), 실패(false)
+bool TextureCooker::Cook(const void* source, size_t size, const TextureCookOptions& options, std::vector<byte_t>& cooked) noexcept {
+    TextureDesc desc;
+    const byte_t* passthrough = nullptr;
+
+    // 이미 블록 압축된 DDS는 그대로 사용
+    DDSInfo dds;
+    if (parseDDS(static_cast<const byte_t*>(source), size, dds) && IsBlockCompressed(dds.Desc.Format)) {
+        desc = dds.Desc;
+        passthrough = dds.Data;
+    }
+
+    Image image;
+    if (!passthrough) {
+        if (!Decode(source, size, image)) {
+            return false;
+        }
+
+        desc.Width      = image.Width;
+        desc.Height     = image.Height;
+        desc.MipLevels  = options.GenerateMips ? GetFullMipLevels(image.Width, image.Height) : 1U;
+
+        switch (options.Compression) {
+            case TextureCompression::None:
+                desc.Format = TextureFormat::RGBA8;
+                break;
+            case TextureCompression::BC1:
+                desc.Format = TextureFormat::BC1;
+                break;
+            case TextureCompression::BC3:
+                desc.Format = TextureFormat::BC3;
+                break;
+            case TextureCompression::BC7:
+                desc.Format = TextureFormat::BC7;
+                break;
+            case TextureCompression::Auto: {
+                bool binary = true;
+                desc.Format = (hasAlpha(image, binary) && !binary) ? TextureFormat::BC3 : TextureFormat::BC1;
+                break;
+            }
+        }
+
+        // 블록 압축은 0단계가 4의 배수여야 함
+        if (IsBlockCompressed(desc.Format) && ((desc.Width % 4) != 0 || (desc.Height % 4) != 0)) {
+            desc.Format = TextureFormat::RGBA8;
+        }
+    }
+
+    if (!IsValidTextureDesc(desc)) {
+        return false;
+    }
+
+    const uint64_t dataOffset   = alignUp(sizeof(CookedTextureHeader), DATA_ALIGNMENT);
+    const uint64_t dataSize     = GetTextureDataSize(desc);
+
+    cooked.assign(static_cast<size_t>(dataOffset + dataSize), 0U);
+
+    CookedTextureHeader header;
+    header.Magic        = MAGIC;
+    header.Version      = VERSION;
+    header.Key          = GetCacheKey(source, size, options);
+    header.Width        = desc.Width;
+    header.Height       = desc.Height;
+    header.MipLevels    = desc.MipLevels;
+    header.Format       = static_cast<uint32_t>(desc.Format);
+    header.DataOffset   = dataOffset;
+    header.DataSize     = dataSize;
+    std::memcpy(cooked.data(), &header, sizeof(header));
+
+    byte_t* dst = cooked.data() + dataOffset;
+    if (passthrough) {
+        std::memcpy(dst, passthrough, static_cast<size_t>(dataSize));
+        return true;
+    }
+
+    // 밉맵 단계마다 축소한 뒤 (필요하면) 압축해서 이어 붙입니다.
+    std::vector<byte_t> current = std::move(image.Pixels);
+    std::vector<byte_t> next;
+    for (uint32_t level = 0U; level < desc.MipLevels; ++level) {
+        const int32_t width     = GetMipSize(desc.Width, level);
+        const int32_t height    = GetMipSize(desc.Height, level);
+
+        if (level > 0U) {
+            next.resize(static_cast<size_t>(width) * height * 4U);
+            GenerateMip(current.data(), GetMipSize(desc.Width, level - 1U), GetMipSize(desc.Height, level - 1U), next.data(), options.SrgbMips);
+            current.swap(next);
+        }
+
+        Compress(current.data(), width, height, desc.Format, dst);
+        dst += static_cast<size_t>(GetRowPitch(desc.Format, width)) * GetRowCount(desc.Format, height);
+    }
+
+    return true;
+}
+
+/// @brief 쿠킹된 텍스처의 헤더를 읽고 검증합니다.
+/// @param cooked 쿠킹된 파일 내용
+/// @param size 쿠킹된 파일 크기
+/// @param header 결과
+/// @return 유효(true), 무효(false: 손상되었거나 형식 버전이 다름)
+bool TextureCooker::ReadHeader(const void* cooked, size_t size, CookedTextureHeader& header) noexcept {
+    if (!cooked || size < sizeof(CookedTextureHeader)) {
+        return false;
+    }
+    std::memcpy(&header, cooked, sizeof(header));
+
+    if (header.Magic != MAGIC || header.Version != VERSION || header.Format > static_cast<uint32_t>(TextureFormat::BC7)) {
+        return false;
+    }
+
+    TextureDesc desc;
+    desc.Width      = header.Width;
+    desc.Height     = header.Height;
+    desc.MipLevels  = header.MipLevels;
+    desc.Format     = static_cast<TextureFormat>(header.Format);
+
+    return IsValidTextureDesc(desc) &&
+        (header.DataOffset % DATA_ALIGNMENT) == 0U &&
+        header.DataSize == GetTextureDataSize(desc) &&
+        header.DataOffset <= size && header.DataSize <= size - header.DataOffset;
+}
+
+/// @brief 다음 밉맵 단계를 만듭니다. (2x2 상자 필터)
+/// @param src 원본 (R8G8B8A8)
+/// @param width 원본 너비
+/// @param height 원본 높이
+/// @param dst 결과 (R8G8B8A8, max(1, width / 2) x max(1, height / 2))
+/// @param srgb 색상 채널을 선형 공간에서 평균할지 여부 (알파는 항상 그대로 평균)
+void TextureCooker::GenerateMip(const byte_t* src, int32_t width, int32_t height, byte_t* dst, bool srgb) noexcept {
+    const int32_t dstWidth  = std::max(1, width / 2);
+    const int32_t dstHeight = std::max(1, height / 2);
+
+    const float* toLinear   = getSrgbToLinearTable();
+    const byte_t* toSrgb    = getLinearToSrgbTable();
+
+    for (int32_t y = 0; y < dstHeight; ++y) {
+        const int32_t y0 = std::min(y * 2, height - 1);
+        const int32_t y1 = std::min(y * 2 + 1, height - 1);
+
+        for (int32_t x = 0; x < dstWidth; ++x) {
+            const int32_t x0 = std::min(x * 2, width - 1);
+            const int32_t x1 = std::min(x * 2 + 1, width - 1);
+
+            const byte_t* p[4] = {
+                src + (static_cast<size_t>(y0) * width + x0) * 4U,
+                src + (static_cast<size_t>(y0) * width + x1) * 4U,
+                src + (static_cast<size_t>(y1) * width + x0) * 4U,
+                src + (static_cast<size_t>(y1) * width + x1) * 4U
+            };
+            byte_t* out = dst + (static_cast<size_t>(y) * dstWidth + x) * 4U;
+
+            for (uint32_t c = 0U; c < 3U; ++c) {
+                if (srgb) {
+                    const float linear = (toLinear[p[0][c]] + toLinear[p[1][c]] + toLinear[p[2][c]] + toLinear[p[3][c]]) * 0.25f;
+                    out[c] = toSrgb[static_cast<uint32_t>(linear * static_cast<float>(LINEAR_TO_SRGB_STEPS - 1U) + 0.5f)];
+                } else {
+                    out[c] = static_cast<byte_t>((p[0][c] + p[1][c] + p[2][c] + p[3][c] + 2U) / 4U);
+                }
+            }
+            out[3] = static_cast<byte_t>((p[0][3] + p[1][3] + p[2][3] + p[3][3] + 2U) / 4U);
+        }
+    }
+}
+
+/// @brief 이미지를 텍스처 형식으로 변환합니다.
+/// @param pixels 원본 (R8G8B8A8)
+/// @param width 너비
+/// @param height 높이
+/// @param format 텍스처 형식
+/// @param dst 결과 (GetRowPitch(format, width) * GetRowCount(format, height) 바이트)
+void TextureCooker::Compress(const byte_t* pixels, int32_t width, int32_t height, TextureFormat format, byte_t* dst) noexcept {
+    switch (format) {
+        case TextureFormat::RGBA8:
+            std::memcpy(dst, pixels, static_cast<size_t>(width) * height * 4U);
+            break;
+        case TextureFormat::BGRA8:
+            for (size_t i = 0U; i < static_cast<size_t>(width) * height * 4U; i += 4U) {
+                dst[i + 0U] = pixels[i + 2U];
+                dst[i + 1U] = pixels[i + 1U];
+                dst[i + 2U] = pixels[i + 0U];
+                dst[i + 3U] = pixels[i + 3U];
+            }
+            break;
+        case TextureFormat::BC1:
+            compressBC1(pixels, width, height, dst);
+            break;
+        case TextureFormat::BC3:
+            compressBC3(pixels, width, height, dst);
+            break;
+        case TextureFormat::BC7:
+            compressBC7(pixels, width, height, dst);
+            break;
+    }
+}
+
+/// @brief BC1로 압축합니다.
+void TextureCooker::compressBC1(const byte_t* pixels, int32_t width, int32_t height, byte_t* dst) noexcept {
+    byte_t block[64];
+    for (int32_t by = 0; by < (height + 3) / 4; ++by) {
+        for (int32_t bx = 0; bx < (width + 3) / 4; ++bx, dst += 8) {
+            loadBlock(pixels, width, height, bx, by, block);
+            compressColorBlock(block, true, dst);
+        }
+    }
+}
+
+/// @brief BC3로 압축합니다.
+void TextureCooker::compressBC3(const byte_t* pixels, int32_t width, int32_t height, byte_t* dst) noexcept {
+    byte_t block[64];
+    for (int32_t by = 0; by < (height + 3) / 4; ++by) {
+        for (int32_t bx = 0; bx < (width + 3) / 4; ++bx, dst += 16) {
+            loadBlock(pixels, width, height, bx, by, block);
+            compressAlphaBlock(block, dst);
+            compressColorBlock(block, false, dst + 8);
+        }
+    }
+}
+
+/// @brief BC7로 압축합니다.
+void TextureCooker::compressBC7(const byte_t* pixels, int32_t width, int32_t height, byte_t* dst) noexcept {
+    byte_t block[64];
+    for (int32_t by = 0; by < (height + 3) / 4; ++by) {
+        for (int32_t bx = 0; bx < (width + 3) / 4; ++bx, dst += 16) {
+            loadBlock(pixels, width, height, bx, by, block);
+            compressBC7Block(block, dst);
+        }
+    }
+}
\ No newline at end of file
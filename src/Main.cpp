@@ -0,0 +1,65 @@
+#if !defined(_WIN32)
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "System/Application.hpp"
+#include "System/FPSLimiter.hpp"
+
+/// @brief 헤드리스 진입점
+/// @note 사용법: NeoXOPS [--frames N] [--fps N] [--tick HZ] [--renderer null|software] [--threads N] [--workers N] [--pipelined] [--pack PATH] [--data DIR] [--stats]
+int main(int argc, char* argv[]) {
+    system::ApplicationDesc desc;
+    desc.Headless = true;
+    bool printStats = false;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--frames") == 0 && (i + 1) < argc) {
+            desc.MaxFrames = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--fps") == 0 && (i + 1) < argc) {
+            desc.MaxFPS = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--tick") == 0 && (i + 1) < argc) {
+            const double hz = std::strtod(argv[++i], nullptr);
+            desc.FixedTimeStep = (hz > 0.0) ? (1.0 / hz) : 0.0;
+        } else if (std::strcmp(argv[i], "--renderer") == 0 && (i + 1) < argc) {
+            ++i;
+            if (std::strcmp(argv[i], "software") == 0) {
+                desc.Renderer = system::RenderBackend::Software;
+            } else if (std::strcmp(argv[i], "null") == 0) {
+                desc.Renderer = system::RenderBackend::Null;
+            }
+        } else if (std::strcmp(argv[i], "--threads") == 0 && (i + 1) < argc) {
+            desc.RenderThreads = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--workers") == 0 && (i + 1) < argc) {
+            desc.WorkerThreads = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--pipelined") == 0) {
+            desc.Pipelined = true;
+        } else if (std::strcmp(argv[i], "--pack") == 0 && (i + 1) < argc) {
+            desc.DataPack = argv[++i];
+        } else if (std::strcmp(argv[i], "--data") == 0 && (i + 1) < argc) {
+            desc.DataDirectory = argv[++i];
+        } else if (std::strcmp(argv[i], "--stats") == 0) {
+            printStats = true;
+        }
+    }
+
+    system::Application app;
+    if (!app.Initialize(desc)) {
+        return 1;
+    }
+
+    app.Run();
+
+    // 프레임 시간 통계 출력 (밀리초 단위)
+    if (printStats) {
+        app.GetFPSLimiter()->UpdateFrameTimeStats();
+        const auto& stats = app.GetFPSLimiter()->GetFrameTimeStats();
+        std::printf("frames=%llu fps=%.2f samples=%u\n", static_cast<unsigned long long>(app.GetFrameIndex()), (stats.Mean > 0.0) ? 1.0 / stats.Mean : 0.0, stats.SampleCount);
+        std::printf("frame time: mean=%.3f p50=%.3f p95=%.3f p99=%.3f max=%.3f\n", stats.Mean * 1e3, stats.P50 * 1e3, stats.P95 * 1e3, stats.P99 * 1e3, stats.Max * 1e3);
+        std::printf("wake error: p99=%.3f max=%.3f samples=%u sleep overshoot=%.3f\n", stats.WakeErrorP99 * 1e3, stats.WakeErrorMax * 1e3, stats.WakeSampleCount, stats.SleepOvershoot * 1e3);
+    }
+
+    return 0;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include "Scene/EntityRegistry.hpp"
+#include <atomic>
+
+using namespace scene;
+
+/// @brief 생성자
+EntityRegistry::EntityRegistry() noexcept : m_Generations(), m_Alive(), m_FreeList(), m_Pools(), m_Count(0U) {
+
+}
+
+/// @brief 새 컴포넌트 형식 번호를 발급합니다.
+/// @return 형식 번호
+/// @note 형식 번호는 프로세스 전체에서 공유되므로 모든 레지스트리에서 같은 형식은 같은 번호를 씁니다.
+uint32_t EntityRegistry::nextTypeID() noexcept {
+    static std::atomic<uint32_t> next{ 0U };
+    return next.fetch_add(1U, std::memory_order_relaxed);
+}
+
+/// @brief 개체를 생성합니다.
+/// @return 개체 (슬롯이 부족하면 무효 핸들)
+/// @note 파괴된 슬롯을 재사용하며, 이때 세대가 올라가므로 이전 핸들은 IsAlive에서 걸러집니다.
+Entity EntityRegistry::Create() noexcept {
+    uint32_t index = 0U;
+    if (!m_FreeList.empty()) {
+        index = m_FreeList.back();
+        m_FreeList.pop_back();
+    } else {
+        if (m_Generations.size() >= Entity::INDEX_MASK) {
+            return {};
+        }
+
+        m_Generations.push_back(0U);
+        m_Alive.push_back(0U);
+        index = static_cast<uint32_t>(m_Generations.size() - 1U);
+    }
+
+    m_Alive[index] = 1U;
+    ++m_Count;
+    return { (m_Generations[index] << Entity::INDEX_BITS) | (index + 1U) };
+}
+
+/// @brief 개체를 파괴합니다.
+/// @param entity 개체
+/// @return 성공(true), 이미 파괴됨(false)
+/// @note 모든 풀에서 개체의 컴포넌트를 제거합니다.
+bool EntityRegistry::Destroy(Entity entity) noexcept {
+    if (!IsAlive(entity)) {
+        return false;
+    }
+
+    const uint32_t index = entity.GetIndex();
+    for (const std::unique_ptr<ComponentPoolBase>& pool : m_Pools) {
+        if (pool) {
+            pool->Remove(index);
+        }
+    }
+
+    m_Alive[index] = 0U;
+    m_Generations[index] = (m_Generations[index] + 1U) & Entity::GENERATION_MASK;
+    m_FreeList.push_back(index);
+    --m_Count;
+    return true;
+}
+
+/// @brief 개체가 살아있는지 확인합니다.
+/// @param entity 개체
+/// @return 살아있음(true), 무효 또는 파괴됨(false)
+bool EntityRegistry::IsAlive(Entity entity) const noexcept {
+    const uint32_t index = entity.GetIndex();
+    return index < m_Generations.size() && m_Alive[index] && m_Generations[index] == entity.GetGeneration();
+}
+
+/// @brief 모든 개체와 컴포넌트를 제거합니다.
+/// @note 풀은 유지하므로 다시 채울 때 할당이 줄어듭니다. 슬롯 세대도 유지하여 이전 핸들이 되살아나지 않게 합니다.
+void EntityRegistry::Clear() noexcept {
+    for (const std::unique_ptr<ComponentPoolBase>& pool : m_Pools) {
+        if (pool) {
+            pool->Clear();
+        }
+    }
+
+    m_FreeList.clear();
+    for (uint32_t index = static_cast<uint32_t>(m_Generations.size()); index > 0U; --index) {
+        if (m_Alive[index - 1U]) {
+            m_Alive[index - 1U] = 0U;
+            m_Generations[index - 1U] = (m_Generations[index - 1U] + 1U) & Entity::GENERATION_MASK;
+        }
+        m_FreeList.push_back(index - 1U);
+    }
+    m_Count = 0U;
+}
\ No newline at end of file
@@ -1,206 +1,910 @@
-#include "Scene/SceneManager.hpp"
-
-using namespace scene;
-
-/// @brief 기본 생성자
-SceneManager::SceneManager() noexcept {
-
-}
-
-/// @brief 소멸자
-SceneManager::~SceneManager() noexcept {
-    while (!m_SceneStack.empty()) {
-        auto& top = m_SceneStack.back();
-        top.Scene->OnExit();
-        top.Scene->OnDestroy();
-        m_SceneStack.pop_back();
-    }
-
-    // m_SceneRegistry.clear();
-}
-
-/// @brief 장면을 추가합니다.
-/// @param sceneName 장면의 이름
-/// @param sceneFunc 장면 생성 함수
-/// @return 성공(true), 실패(false)
-bool SceneManager::AddScene(std::string_view sceneName, std::function<std::unique_ptr<SceneBase>()> sceneFunc) noexcept {
-    auto [it, inserted] = m_SceneRegistry.emplace(std::string(sceneName), std::move(sceneFunc));
-    return inserted;
-}
-
-/// @brief 장면을 불러옵니다.
-/// @param sceneName 장면의 이름
-/// @return 성공(true), 실패(false)
-/// @note 현재 활성화된 장면이 있다면 일시 정지합니다. 일시 정지가 아닌 파괴를 원한다면 ChangeScene을 호출해주세요.
-bool SceneManager::LoadScene(std::string_view sceneName) noexcept {
-    // 미등록 장면
-    auto it = m_SceneRegistry.find(std::string(sceneName));
-    if (it == m_SceneRegistry.end()) {
-        return false;
-    }
-
-    // 현재 활성화된 장면 일시정지
-    if (!m_SceneStack.empty() && !m_SceneStack.back().IsPause) {
-        m_SceneStack.back().Scene->OnPause();
-        m_SceneStack.back().IsPause = true;
-    }
-
-    // 새 장면 생성 및 초기화
-    auto newScene = it->second();
-    newScene->OnCreate();
-    newScene->OnEnter();
-
-    m_SceneStack.push_back({ std::string(sceneName), std::move(newScene), false });
-    return true;
-}
-
-/// @brief 장면을 제거합니다.
-/// @param sceneName 장면의 이름
-/// @return 성공(true), 실패(false)
-bool SceneManager::RemoveScene(std::string_view sceneName) noexcept {
-    for (auto it = m_SceneStack.begin(); it != m_SceneStack.end(); ++it) {
-        if (it->Name == sceneName) {
-            // 자원 정리
-            it->Scene->OnExit();
-            it->Scene->OnDestroy();
-            
-            // 제거
-            m_SceneStack.erase(it);
-
-            // 최상위 장면이 있다면 재개
-            if (!m_SceneStack.empty() && m_SceneStack.back().IsPause) {
-                m_SceneStack.back().Scene->OnResume();
-                m_SceneStack.back().IsPause = false;
-            }
-
-            return true;
-        }
-    }
-
-    return false;
-}
-
-/// @brief 장면을 교체합니다.
-/// @param sceneName 장면의 이름
-/// @return 성공(true), 실패(false)
-bool SceneManager::ChangeScene(std::string_view sceneName) noexcept {
-    // 미등록 장면
-    auto it = m_SceneRegistry.find(std::string(sceneName));
-    if (it == m_SceneRegistry.end()) {
-        return false;
-    }
-    
-    // 자원 정리 후 제거
-    if (!m_SceneStack.empty()) {
-        m_SceneStack.back().Scene->OnExit();
-        m_SceneStack.back().Scene->OnDestroy();
-        m_SceneStack.pop_back();
-    }
-
-    // 새 장면 생성 및 초기화
-    auto newScene = it->second();
-    newScene->OnCreate();
-    newScene->OnEnter();
-
-    m_SceneStack.push_back({ std::string(sceneName), std::move(newScene), false });
-    return true;
-}
-
-/// @brief 현재 장면을 다시 불러옵니다.
-/// @return 성공(true), 실패(false)
-bool SceneManager::ReloadScene() noexcept {
-    if (m_SceneStack.empty()) { return false; }
-
-    // 현재 장면
-    auto& entry = m_SceneStack.back();
-
-    // 자원 정리 및 해제
-    entry.Scene->OnExit();
-    entry.Scene->OnDestroy();
-    entry.Scene.reset();
-
-    // 장면 생성 함수
-    auto it = m_SceneRegistry.find(entry.Name);
-    if (it == m_SceneRegistry.end()) {
-        return false;
-    }
-
-    // 새 장면 생성 및 초기화
-    auto newScene = it->second();
-    newScene->OnCreate();
-    newScene->OnEnter();
-
-    // 이동
-    entry.Scene = std::move(newScene);
-    entry.IsPause = false;
-
-    return true;
-}
-
-/// @brief 장면을 일시 정지합니다.
-/// @return 성공(true), 실패(false)
-bool SceneManager::Pause() noexcept {
-    if (m_SceneStack.empty()) { return false; }
-
-    // 현재 장면이 이미 멈춰있다면...
-    auto& entry = m_SceneStack.back();
-    if (entry.IsPause) { return false; }
-
-    // 일시 정지
-    entry.Scene->OnPause();
-    entry.IsPause = true;
-
-    return true;
-}
-
-/// @brief 장면을 재개합니다.
-/// @return 성공(true), 실패(false)
-bool SceneManager::Resume() noexcept {
-    if (m_SceneStack.empty()) { return false; }
-
-    // 현재 장면이 안 멈춰있다면...
-    auto& entry = m_SceneStack.back();
-    if (!entry.IsPause) { return false; }
-
-    entry.Scene->OnResume();
-    entry.IsPause = false;
-
-    return true;
-}
-
-/// @brief 현재 장면을 취득합니다.
-/// @return 장면
-SceneBase* SceneManager::GetCurrentScene() const noexcept {
-    return (m_SceneStack.empty()) ? nullptr : m_SceneStack.back().Scene.get();
-}
-
-/// @brief 입력 처리를 수행합니다.
-void SceneManager::Input() noexcept {
-    if (!m_SceneStack.empty()) {
-        auto& entry = m_SceneStack.back();
-        if (!entry.IsPause) {
-            entry.Scene->Input();
-        }
-    }
-}
-
-/// @brief 갱신 처리를 수행합니다.
-/// @param dt 델타 타임
-void SceneManager::Update(double dt) noexcept {
-    if (!m_SceneStack.empty()) {
-        auto& entry = m_SceneStack.back();
-        if (!entry.IsPause) {
-            entry.Scene->Update(dt);
-        }
-    }
-}
-
-/// @brief 렌더링 처리를 수행합니다.
-void SceneManager::Render() noexcept {
-    if (!m_SceneStack.empty()) {
-        auto& entry = m_SceneStack.back();
-        if (!entry.IsPause) {
-            entry.Scene->Render();
-        }
-    }
+#include "Scene/SceneManager.hpp"
+#include "Graphics/IRenderDevice.hpp"
+
+using namespace graphics;
+using namespace scene;
+using namespace system;
+
+/// @brief 기본 생성자
+SceneManager::SceneManager() noexcept {
+    m_RenderDevice          = nullptr;
+    m_PipelineCache         = nullptr;
+    m_ResourceMgr           = nullptr;
+    m_JobSystem             = nullptr;
+    m_FileSystem            = nullptr;
+    m_InterpolationAlpha    = 1.0;
+    m_NextSerial            = 1ULL;
+    m_Updating              = false;
+}
+
+/// @brief 소멸자
+SceneManager::~SceneManager() noexcept {
+    // 진행 중인 로딩 취소
+    if (m_PendingLoad) {
+        m_PendingLoad->Context.Cancel();
+        if (m_PendingLoad->Thread.joinable()) {
+            m_PendingLoad->Thread.join();
+        }
+        m_PendingLoad.reset();
+    }
+
+    while (!m_SceneStack.empty()) {
+        popScene();
+    }
+
+    // 보관된 인스턴스 파괴
+    ClearScenePool();
+
+    // 렌더 디바이스보다 먼저 파괴되어야 함
+    releaseLayerCache();
+
+    // m_SceneRegistry.clear();
+}
+
+/// @brief 장면 생성 함수로 장면을 만들고 장면 관리자를 연결합니다.
+/// @param sceneFunc 장면 생성 함수
+/// @return 장면 (실패 시 nullptr)
+std::unique_ptr<SceneBase> SceneManager::createScene(const std::function<std::unique_ptr<SceneBase>()>& sceneFunc) noexcept {
+    auto newScene = sceneFunc();
+    if (newScene) {
+        newScene->m_SceneMgr = this;
+    }
+
+    return newScene;
+}
+
+/// @brief 장면의 OnCreate를 호출합니다.
+/// @param scene 장면
+/// @return 성공(true), 실패(false)
+/// @note 실패한 장면은 OnDestroy 없이 버려지므로, OnCreate는 실패 시 스스로 정리해야 합니다.
+bool SceneManager::initializeScene(SceneBase* scene) noexcept {
+    return scene && scene->OnCreate();
+}
+
+/// @brief 등록된 장면의 인스턴스를 준비합니다.
+/// @param registration 등록된 장면
+/// @return 초기화된 장면 (실패 시 nullptr)
+/// @note 풀에 보관된 인스턴스가 있다면 OnReset으로 재사용하고, 없거나 실패하면 새로 생성합니다.
+std::unique_ptr<SceneBase> SceneManager::acquireScene(SceneRegistration& registration) noexcept {
+    auto scene = takePooledScene(registration);
+    if (scene) {
+        return scene;
+    }
+
+    scene = createScene(registration.Factory);
+    if (!initializeScene(scene.get())) {
+        return nullptr;
+    }
+
+    ++registration.Stats.Builds;
+    return scene;
+}
+
+/// @brief 풀에 보관된 인스턴스를 꺼내 초기 상태로 되돌립니다.
+/// @param registration 등록된 장면
+/// @return 초기화된 장면 (풀이 비었거나 OnReset 실패 시 nullptr)
+/// @note OnReset에 실패한 인스턴스는 파괴됩니다.
+std::unique_ptr<SceneBase> SceneManager::takePooledScene(SceneRegistration& registration) noexcept {
+    while (!registration.Pool.empty()) {
+        auto scene = std::move(registration.Pool.back());
+        registration.Pool.pop_back();
+
+        if (scene->OnReset()) {
+            ++registration.Stats.PoolHits;
+            return scene;
+        }
+
+        scene->OnDestroy();
+    }
+
+    return nullptr;
+}
+
+/// @brief 스택에서 빠진 장면을 풀에 보관하거나 파괴합니다.
+/// @param sceneName 장면의 이름
+/// @param scene OnExit까지 호출된 장면
+void SceneManager::releaseScene(std::string_view sceneName, std::unique_ptr<SceneBase> scene) noexcept {
+    auto it = m_SceneRegistry.find(std::string(sceneName));
+    if (it != m_SceneRegistry.end() && it->second.Pool.size() < it->second.Policy.PoolSize) {
+        it->second.Pool.push_back(std::move(scene));
+        return;
+    }
+
+    scene->OnDestroy();
+}
+
+/// @brief 초기화된 장면을 스택의 최상위에 올리고 진입시킵니다.
+/// @param sceneName 장면의 이름
+/// @param scene 장면
+/// @param layer 아래 장면에 대한 레이어 플래그
+/// @note UpdateThrough가 아니라면 아래 장면을 일시 정지합니다.
+void SceneManager::pushScene(std::string_view sceneName, std::unique_ptr<SceneBase> scene, SceneLayer layer) noexcept {
+    SceneBase* newScene = scene.get();
+    m_SceneStack.push_back({ std::string(sceneName), std::move(scene), false, m_NextSerial++, layer });
+
+    syncPauseStates();
+    newScene->OnEnter();
+}
+
+/// @brief 최상위 장면을 종료하고 스택에서 제거합니다.
+/// @note 장면은 재사용 정책에 따라 풀에 보관되거나 파괴됩니다.
+void SceneManager::popScene() noexcept {
+    auto& top = m_SceneStack.back();
+    top.Scene->OnExit();
+    releaseScene(top.Name, std::move(top.Scene));
+    m_SceneStack.pop_back();
+}
+
+/// @brief 레이어 플래그에 따라 장면들을 일시 정지하거나 재개합니다.
+/// @note 최상위 장면과 UpdateThrough로 이어진 아래 장면들은 재개되고, 그 아래는 일시 정지됩니다.
+void SceneManager::syncPauseStates() noexcept {
+    if (m_SceneStack.empty()) { return; }
+
+    const size_t base = getLayerBase(SceneLayer::UpdateThrough);
+    for (size_t i = 0; i < m_SceneStack.size(); ++i) {
+        auto& entry = m_SceneStack[i];
+        const bool active = (i >= base);
+
+        if (active && entry.IsPause) {
+            entry.Scene->OnResume();
+            entry.IsPause = false;
+        }
+        else if (!active && !entry.IsPause) {
+            entry.Scene->OnPause();
+            entry.IsPause = true;
+        }
+    }
+}
+
+/// @brief 최상위에서부터 레이어 플래그가 이어지는 가장 아래 장면을 찾습니다.
+/// @param flag 레이어 플래그
+/// @return 장면 스택 인덱스 (스택이 비어있지 않아야 함)
+size_t SceneManager::getLayerBase(SceneLayer flag) const noexcept {
+    size_t index = m_SceneStack.size() - 1U;
+    while (index > 0U && HasSceneLayer(m_SceneStack[index].Layer, flag)) {
+        --index;
+    }
+
+    return index;
+}
+
+/// @brief 아래 레이어를 캐시할 수 있는 가장 위의 장면을 찾습니다.
+/// @param base 그리기 시작하는 장면 스택 인덱스
+/// @return 장면 스택 인덱스 (0: 캐시할 수 없음)
+/// @note CacheBelow가 지정되어 있고, 그 아래의 그려지는 장면이 모두 일시 정지된 경우에만 캐시합니다.
+size_t SceneManager::getCacheLayer(size_t base) const noexcept {
+    for (size_t index = m_SceneStack.size() - 1U; index > base; --index) {
+        if (!HasSceneLayer(m_SceneStack[index].Layer, SceneLayer::CacheBelow)) {
+            continue;
+        }
+
+        bool frozen = true;
+        for (size_t i = base; i < index; ++i) {
+            frozen = frozen && m_SceneStack[i].IsPause;
+        }
+
+        if (frozen) {
+            return index;
+        }
+    }
+
+    return 0U;
+}
+
+/// @brief 캐시된 화면을 백 버퍼로 복원합니다.
+/// @return 복원함(true), 캐시가 없거나 m_LayerSerials와 다름(false)
+bool SceneManager::restoreLayerCache() noexcept {
+    if (!m_LayerCache.Valid || !m_RenderDevice || m_LayerCache.Serials != m_LayerSerials) {
+        m_LayerCache.Valid = false;
+        return false;
+    }
+
+    const TextureDesc desc = m_RenderDevice->GetBackBufferDesc();
+    if (desc.Width != m_LayerCache.Desc.Width || desc.Height != m_LayerCache.Desc.Height || desc.Format != m_LayerCache.Desc.Format) {
+        m_LayerCache.Valid = false;
+        return false;
+    }
+
+    m_LayerCache.Valid = m_RenderDevice->CopyTextureToBackBuffer(m_LayerCache.Texture);
+    return m_LayerCache.Valid;
+}
+
+/// @brief 지금까지 그려진 화면을 m_LayerSerials 레이어의 캐시로 보관합니다.
+void SceneManager::captureLayerCache() noexcept {
+    if (!m_RenderDevice) { return; }
+
+    const TextureDesc desc = m_RenderDevice->GetBackBufferDesc();
+    if (desc.Width <= 0 || desc.Height <= 0) { return; }
+
+    // 크기가 바뀌었다면 다시 생성
+    if (!m_LayerCache.Texture.IsValid() || desc.Width != m_LayerCache.Desc.Width || desc.Height != m_LayerCache.Desc.Height || desc.Format != m_LayerCache.Desc.Format) {
+        releaseLayerCache();
+
+        m_LayerCache.Texture = m_RenderDevice->CreateTexture(desc, nullptr);
+        m_LayerCache.Desc = desc;
+        if (!m_LayerCache.Texture.IsValid()) { return; }
+    }
+
+    m_LayerCache.Valid = m_RenderDevice->CopyBackBufferToTexture(m_LayerCache.Texture);
+    m_LayerCache.Serials = m_LayerSerials;
+}
+
+/// @brief 캐시 텍스처를 해제합니다.
+void SceneManager::releaseLayerCache() noexcept {
+    if (m_RenderDevice && m_LayerCache.Texture.IsValid()) {
+        m_RenderDevice->DestroyTexture(m_LayerCache.Texture);
+    }
+
+    m_LayerCache.Texture = {};
+    m_LayerCache.Valid = false;
+    m_LayerCache.Serials.clear();
+}
+
+/// @brief Update 중이라면 스택 변경을 다음 ProcessPendingLoad로 미룹니다.
+/// @param kind 변경 종류
+/// @param sceneName 장면의 이름
+/// @param layer 레이어 플래그 (Load 전용)
+/// @return 미룸(true), 지금 바로 수행해야 함(false)
+/// @note 파이프라인 모드에서는 Update가 시뮬레이션 스레드에서 실행되는 동안 메인 스레드가 같은 렌더 디바이스와 리소스 관리자로 그리므로,
+///       OnCreate, OnDestroy 등 자원을 만들고 해제하는 호출은 메인 스레드가 수행해야 합니다.
+///       단일 스레드에서도 갱신 중인 장면이 스스로를 파괴하거나 순회 중인 스택이 바뀌지 않도록 같은 방식으로 미룹니다.
+bool SceneManager::deferChange(StackChange kind, std::string_view sceneName, SceneLayer layer) noexcept {
+    if (!m_Updating) {
+        return false;
+    }
+
+    m_PendingChanges.push_back({ kind, std::string(sceneName), layer });
+    return true;
+}
+
+/// @brief 미뤄진 스택 변경을 요청된 순서대로 반영합니다.
+/// @note 메인 스레드에서 시뮬레이션 스레드가 쉬는 동안 호출됩니다. 실패한 변경은 즉시 호출했을 때와 같이 무시됩니다.
+void SceneManager::applyPendingChanges() noexcept {
+    if (m_PendingChanges.empty()) { return; }
+
+    std::vector<PendingChange> changes = std::move(m_PendingChanges);
+    m_PendingChanges.clear();
+
+    for (const PendingChange& change : changes) {
+        switch (change.Kind) {
+            case StackChange::Load:
+                (void)LoadScene(change.Name, change.Layer);
+                break;
+
+            case StackChange::Change:
+                (void)ChangeScene(change.Name);
+                break;
+
+            case StackChange::Remove:
+                (void)RemoveScene(change.Name);
+                break;
+
+            case StackChange::Reload:
+                (void)ReloadScene();
+                break;
+
+            case StackChange::ClearPool:
+                ClearScenePool(change.Name);
+                break;
+        }
+    }
+}
+
+/// @brief 장면을 추가합니다.
+/// @param sceneName 장면의 이름
+/// @param sceneFunc 장면 생성 함수
+/// @param policy 재사용 정책
+/// @return 성공(true), 실패(false)
+bool SceneManager::AddScene(std::string_view sceneName, std::function<std::unique_ptr<SceneBase>()> sceneFunc, ScenePolicy policy) noexcept {
+    auto [it, inserted] = m_SceneRegistry.try_emplace(std::string(sceneName));
+    if (inserted) {
+        it->second.Factory  = std::move(sceneFunc);
+        it->second.Policy   = policy;
+    }
+
+    return inserted;
+}
+
+/// @brief 장면을 불러옵니다.
+/// @param sceneName 장면의 이름
+/// @param layer 아래 장면에 대한 레이어 플래그
+/// @return 성공(true), 실패(false: 미등록 장면이거나 OnCreate 실패)
+/// @note 현재 활성화된 장면이 있다면 일시 정지합니다. 일시 정지가 아닌 파괴를 원한다면 ChangeScene을 호출해주세요.
+///       새 장면의 생성에 실패하면 현재 장면은 그대로 유지됩니다.
+///       Update에서 호출하면 다음 프레임의 ProcessPendingLoad까지 미뤄지며, 반환값은 등록 여부만 나타냅니다.
+bool SceneManager::LoadScene(std::string_view sceneName, SceneLayer layer) noexcept {
+    // 미등록 장면
+    auto it = m_SceneRegistry.find(std::string(sceneName));
+    if (it == m_SceneRegistry.end()) {
+        return false;
+    }
+
+    if (deferChange(StackChange::Load, sceneName, layer)) {
+        return true;
+    }
+
+    // 새 장면 준비
+    auto newScene = acquireScene(it->second);
+    if (!newScene) {
+        return false;
+    }
+
+    // 현재 활성화된 장면 일시정지 후 진입
+    pushScene(sceneName, std::move(newScene), layer);
+    return true;
+}
+
+/// @brief 장면을 제거합니다.
+/// @param sceneName 장면의 이름
+/// @return 성공(true), 실패(false)
+/// @note Update에서 호출하면 다음 프레임의 ProcessPendingLoad까지 미뤄지며, 반환값은 지금 스택에 있는지만 나타냅니다.
+bool SceneManager::RemoveScene(std::string_view sceneName) noexcept {
+    for (auto it = m_SceneStack.begin(); it != m_SceneStack.end(); ++it) {
+        if (it->Name == sceneName) {
+            if (deferChange(StackChange::Remove, sceneName)) {
+                return true;
+            }
+
+            // 자원 정리
+            it->Scene->OnExit();
+            std::string name = std::move(it->Name);
+            std::unique_ptr<SceneBase> scene = std::move(it->Scene);
+
+            // 제거
+            m_SceneStack.erase(it);
+            releaseScene(name, std::move(scene));
+
+            // 최상위 장면이 있다면 재개
+            syncPauseStates();
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// @brief 장면을 교체합니다.
+/// @param sceneName 장면의 이름
+/// @return 성공(true), 실패(false: 미등록 장면이거나 OnCreate 실패)
+/// @note 새 장면의 생성에 실패하면 현재 장면은 그대로 유지됩니다.
+///       Update에서 호출하면 다음 프레임의 ProcessPendingLoad까지 미뤄지며, 반환값은 등록 여부만 나타냅니다.
+bool SceneManager::ChangeScene(std::string_view sceneName) noexcept {
+    // 미등록 장면
+    auto it = m_SceneRegistry.find(std::string(sceneName));
+    if (it == m_SceneRegistry.end()) {
+        return false;
+    }
+
+    if (deferChange(StackChange::Change, sceneName)) {
+        return true;
+    }
+
+    // 새 장면 준비
+    auto newScene = acquireScene(it->second);
+    if (!newScene) {
+        return false;
+    }
+
+    // 자원 정리 후 제거
+    if (!m_SceneStack.empty()) {
+        popScene();
+    }
+
+    pushScene(sceneName, std::move(newScene), SceneLayer::None);
+    return true;
+}
+
+/// @brief 현재 장면을 다시 불러옵니다.
+/// @return 성공(true), 실패(false)
+/// @note 장면이 OnReset을 지원하면 파괴하지 않고 그 자리에서 재시작합니다.
+///       새 장면의 생성에 실패하면 현재 장면은 제거되고 아래 장면이 재개됩니다.
+///       Update에서 호출하면 다음 프레임의 ProcessPendingLoad까지 미뤄집니다.
+bool SceneManager::ReloadScene() noexcept {
+    if (m_SceneStack.empty()) { return false; }
+
+    if (deferChange(StackChange::Reload, {})) {
+        return true;
+    }
+
+    // 현재 장면
+    auto& entry = m_SceneStack.back();
+    auto it = m_SceneRegistry.find(entry.Name);
+
+    // 그 자리에서 재시작
+    entry.Scene->OnExit();
+    if (entry.Scene->OnReset()) {
+        if (it != m_SceneRegistry.end()) {
+            ++it->second.Stats.Resets;
+        }
+
+        entry.IsPause = false;
+        entry.Scene->OnEnter();
+        return true;
+    }
+
+    // 자원 정리 및 해제
+    entry.Scene->OnDestroy();
+    entry.Scene.reset();
+
+    // 새 장면 준비
+    std::unique_ptr<SceneBase> newScene;
+    if (it != m_SceneRegistry.end()) {
+        newScene = acquireScene(it->second);
+    }
+
+    if (!newScene) {
+        // 빈 엔트리 제거 후 아래 장면 재개
+        m_SceneStack.pop_back();
+        syncPauseStates();
+        return false;
+    }
+
+    // 이동
+    entry.Scene = std::move(newScene);
+    entry.IsPause = false;
+    entry.Serial = m_NextSerial++;
+    entry.Scene->OnEnter();
+
+    return true;
+}
+
+/// @brief 장면의 레이어 플래그를 변경합니다.
+/// @param sceneName 장면의 이름 (같은 이름이 여럿이면 가장 위의 장면)
+/// @param layer 아래 장면에 대한 레이어 플래그
+/// @return 성공(true), 실패(false: 스택에 없는 장면)
+bool SceneManager::SetSceneLayer(std::string_view sceneName, SceneLayer layer) noexcept {
+    for (auto it = m_SceneStack.rbegin(); it != m_SceneStack.rend(); ++it) {
+        if (it->Name == sceneName) {
+            it->Layer = layer;
+            syncPauseStates();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// @brief 가려진 레이어의 화면 캐시를 무효화합니다.
+/// @note 일시 정지된 장면의 화면이 바뀌었을 때(설정 변경 등) 호출하면 다음 프레임에 다시 그려집니다.
+void SceneManager::InvalidateLayerCache() noexcept {
+    m_LayerCache.Valid = false;
+}
+
+/// @brief 장면을 비동기로 불러옵니다.
+/// @param sceneName 장면의 이름
+/// @param mode 로딩이 끝난 뒤 스택에 넣는 방식
+/// @param loadingSceneName 로딩 중에 위에 쌓아 표시할 장면의 이름 (비어있으면 현재 장면이 계속 구동됨)
+/// @return 로딩 시작(true), 실패(false: 미등록 장면이거나 이미 로딩 중)
+/// @note 장면 생성 함수와 OnLoadAsync는 로딩 스레드에서 실행되고,
+///       완료 후 ProcessPendingLoad에서 OnCreate, OnEnter와 스택 교체가 메인 스레드에서 수행됩니다.
+bool SceneManager::LoadSceneAsync(std::string_view sceneName, SceneLoadMode mode, std::string_view loadingSceneName) noexcept {
+    if (m_PendingLoad) {
+        return false;
+    }
+
+    // 미등록 장면
+    auto it = m_SceneRegistry.find(std::string(sceneName));
+    if (it == m_SceneRegistry.end()) {
+        return false;
+    }
+
+    // 로딩 화면
+    if (!loadingSceneName.empty() && !LoadScene(loadingSceneName)) {
+        return false;
+    }
+
+    m_PendingLoad = std::make_unique<PendingLoad>();
+    m_PendingLoad->Name             = std::string(sceneName);
+    m_PendingLoad->LoadingSceneName = std::string(loadingSceneName);
+    m_PendingLoad->Mode             = mode;
+    m_PendingLoad->Factory          = it->second.Factory;
+
+    // 풀에 보관된 인스턴스가 있다면 로딩 스레드 없이 바로 완료
+    PendingLoad* load = m_PendingLoad.get();
+    if (!it->second.Pool.empty()) {
+        load->Scene = std::move(it->second.Pool.back());
+        it->second.Pool.pop_back();
+        load->Pooled    = true;
+        load->Succeeded = true;
+        load->Context.SetProgress(1.0f);
+        load->Finished.store(true, std::memory_order_release);
+        return true;
+    }
+
+    load->Thread = std::thread([this, load] {
+        load->Scene = createScene(load->Factory);
+        load->Succeeded = load->Scene && !load->Context.IsCancelled() && load->Scene->OnLoadAsync(load->Context);
+        if (load->Succeeded) {
+            load->Context.SetProgress(1.0f);
+        }
+        load->Finished.store(true, std::memory_order_release);
+    });
+
+    return true;
+}
+
+/// @brief 진행 중인 비동기 로딩을 취소합니다.
+/// @note 로딩 스레드가 취소를 확인하고 끝나면 ProcessPendingLoad에서 정리됩니다.
+void SceneManager::CancelLoad() noexcept {
+    if (m_PendingLoad) {
+        m_PendingLoad->Context.Cancel();
+    }
+}
+
+/// @brief 비동기 로딩이 끝났다면 장면을 초기화하고 스택에 반영합니다.
+/// @note 메인 스레드에서 매 프레임 호출합니다. (Application이 입력 처리 전에 호출)
+///       지난 프레임의 Update에서 미뤄진 스택 변경도 여기서 먼저 반영합니다.
+void SceneManager::ProcessPendingLoad() noexcept {
+    applyPendingChanges();
+
+    if (m_PendingLoad && m_PendingLoad->Finished.load(std::memory_order_acquire)) {
+        finishPendingLoad();
+    }
+}
+
+/// @brief 로딩 스레드를 정리하고 결과를 스택에 반영합니다.
+void SceneManager::finishPendingLoad() noexcept {
+    std::unique_ptr<PendingLoad> load = std::move(m_PendingLoad);
+    if (load->Thread.joinable()) {
+        load->Thread.join();
+    }
+
+    // 로딩 화면 제거
+    if (!load->LoadingSceneName.empty()) {
+        (void)RemoveScene(load->LoadingSceneName);
+    }
+
+    // 취소된 풀 인스턴스는 다시 보관
+    if (load->Pooled && load->Context.IsCancelled()) {
+        releaseScene(load->Name, std::move(load->Scene));
+        return;
+    }
+
+    // 실패 또는 취소 시 폐기
+    if (!load->Succeeded || load->Context.IsCancelled()) {
+        return;
+    }
+
+    // 초기화 (풀 인스턴스는 OnReset, 실패하면 새로 생성)
+    auto it = m_SceneRegistry.find(load->Name);
+    if (load->Pooled) {
+        if (load->Scene->OnReset()) {
+            ++it->second.Stats.PoolHits;
+        }
+        else {
+            load->Scene->OnDestroy();
+            load->Scene = acquireScene(it->second);
+            if (!load->Scene) {
+                return;
+            }
+        }
+    }
+    else if (initializeScene(load->Scene.get())) {
+        ++it->second.Stats.Builds;
+    }
+    else {
+        return;
+    }
+
+    if (load->Mode == SceneLoadMode::Change && !m_SceneStack.empty()) {
+        popScene();
+    }
+
+    pushScene(load->Name, std::move(load->Scene), SceneLayer::None);
+}
+
+/// @brief 비동기 로딩 중인지 확인합니다.
+/// @return 로딩 중(true), 아님(false)
+bool SceneManager::IsLoading() const noexcept {
+    return m_PendingLoad != nullptr;
+}
+
+/// @brief 비동기 로딩의 진행률을 취득합니다.
+/// @return 진행률 (0.0 ~ 1.0, 로딩 중이 아니면 0.0)
+/// @note 로딩 화면 장면이 표시용으로 사용합니다.
+float SceneManager::GetLoadProgress() const noexcept {
+    return m_PendingLoad ? m_PendingLoad->Context.GetProgress() : 0.0f;
+}
+
+/// @brief 장면의 생성 통계를 취득합니다.
+/// @param sceneName 장면의 이름
+/// @return 생성 통계 (미등록 장면은 0)
+SceneStats SceneManager::GetSceneStats(std::string_view sceneName) const noexcept {
+    auto it = m_SceneRegistry.find(std::string(sceneName));
+    if (it == m_SceneRegistry.end()) {
+        return {};
+    }
+
+    SceneStats stats = it->second.Stats;
+    stats.Pooled = static_cast<uint32_t>(it->second.Pool.size());
+    return stats;
+}
+
+/// @brief 풀에 보관된 인스턴스를 파괴합니다.
+/// @param sceneName 장면의 이름 (비어있으면 모든 장면)
+/// @note 메모리가 부족하거나 다시 돌아오지 않을 장면의 자원을 해제할 때 호출합니다.
+///       Update에서 호출하면 다음 프레임의 ProcessPendingLoad까지 미뤄집니다.
+void SceneManager::ClearScenePool(std::string_view sceneName) noexcept {
+    if (deferChange(StackChange::ClearPool, sceneName)) {
+        return;
+    }
+
+    for (auto& [name, registration] : m_SceneRegistry) {
+        if (!sceneName.empty() && name != sceneName) {
+            continue;
+        }
+
+        for (auto& scene : registration.Pool) {
+            scene->OnDestroy();
+        }
+        registration.Pool.clear();
+    }
+}
+
+/// @brief 장면을 일시 정지합니다.
+/// @return 성공(true), 실패(false)
+bool SceneManager::Pause() noexcept {
+    if (m_SceneStack.empty()) { return false; }
+
+    // 현재 장면이 이미 멈춰있다면...
+    auto& entry = m_SceneStack.back();
+    if (entry.IsPause) { return false; }
+
+    // 일시 정지
+    entry.Scene->OnPause();
+    entry.IsPause = true;
+
+    return true;
+}
+
+/// @brief 장면을 재개합니다.
+/// @return 성공(true), 실패(false)
+bool SceneManager::Resume() noexcept {
+    if (m_SceneStack.empty()) { return false; }
+
+    // 현재 장면이 안 멈춰있다면...
+    auto& entry = m_SceneStack.back();
+    if (!entry.IsPause) { return false; }
+
+    entry.Scene->OnResume();
+    entry.IsPause = false;
+
+    return true;
+}
+
+/// @brief 현재 장면을 취득합니다.
+/// @return 장면
+SceneBase* SceneManager::GetCurrentScene() const noexcept {
+    return (m_SceneStack.empty()) ? nullptr : m_SceneStack.back().Scene.get();
+}
+
+/// @brief 렌더 디바이스를 취득합니다.
+/// @return 렌더 디바이스
+IRenderDevice* SceneManager::GetRenderDevice() const noexcept {
+    return m_RenderDevice;
+}
+
+/// @brief 파이프라인 상태 캐시를 취득합니다.
+/// @return 파이프라인 상태 캐시
+/// @note 장면은 로딩할 때 필요한 파이프라인 상태를 취득해 보관하고, 그릴 때 PipelineStateCache::Bind로 바인딩합니다.
+PipelineStateCache* SceneManager::GetPipelineStateCache() const noexcept {
+    return m_PipelineCache;
+}
+
+/// @brief 리소스 관리자를 취득합니다.
+/// @return 리소스 관리자
+/// @note 장면은 자산 리소스를 디바이스에서 직접 만들지 않고 여기서 취득해 다른 장면과 공유하며, OnDestroy에서 Release합니다.
+ResourceManager* SceneManager::GetResourceManager() const noexcept {
+    return m_ResourceMgr;
+}
+
+/// @brief 장면이 사용할 작업 시스템을 취득합니다.
+/// @return 작업 시스템
+JobSystem* SceneManager::GetJobSystem() const noexcept {
+    return m_JobSystem;
+}
+
+/// @brief 장면이 자산을 읽을 파일 시스템을 취득합니다.
+/// @return 파일 시스템
+/// @note 마운트가 끝난 뒤에는 OnLoadAsync의 로딩 스레드나 작업 스레드에서 동시에 읽어도 안전합니다.
+FileSystem* SceneManager::GetFileSystem() const noexcept {
+    return m_FileSystem;
+}
+
+/// @brief 렌더링 보간 계수를 취득합니다.
+/// @return 직전 시뮬레이션 상태와 현재 상태 사이의 위치 (0.0 ~ 1.0)
+/// @note 고정 간격 시뮬레이션일 때 장면은 Render에서 lerp(이전 상태, 현재 상태, alpha)로 그립니다.
+///       가변 간격이면 항상 1.0입니다.
+double SceneManager::GetInterpolationAlpha() const noexcept {
+    return m_InterpolationAlpha;
+}
+
+/// @brief 장면이 사용할 렌더 디바이스를 설정합니다.
+/// @param renderDevice 렌더 디바이스
+void SceneManager::SetRenderDevice(IRenderDevice* renderDevice) noexcept {
+    if (m_RenderDevice != renderDevice) {
+        releaseLayerCache();
+    }
+
+    m_RenderDevice = renderDevice;
+}
+
+/// @brief 장면이 사용할 파이프라인 상태 캐시를 설정합니다.
+/// @param pipelineCache 파이프라인 상태 캐시
+void SceneManager::SetPipelineStateCache(PipelineStateCache* pipelineCache) noexcept {
+    m_PipelineCache = pipelineCache;
+}
+
+/// @brief 장면이 사용할 리소스 관리자를 설정합니다.
+/// @param resourceMgr 리소스 관리자
+void SceneManager::SetResourceManager(ResourceManager* resourceMgr) noexcept {
+    m_ResourceMgr = resourceMgr;
+}
+
+/// @brief 장면이 사용할 작업 시스템을 설정합니다.
+/// @param jobSystem 작업 시스템
+void SceneManager::SetJobSystem(JobSystem* jobSystem) noexcept {
+    m_JobSystem = jobSystem;
+}
+
+/// @brief 장면이 자산을 읽을 파일 시스템을 설정합니다.
+/// @param fileSystem 파일 시스템
+void SceneManager::SetFileSystem(FileSystem* fileSystem) noexcept {
+    m_FileSystem = fileSystem;
+}
+
+/// @brief 렌더링 보간 계수를 설정합니다.
+/// @param alpha 보간 계수 (0.0 ~ 1.0)
+void SceneManager::SetInterpolationAlpha(double alpha) noexcept {
+    m_InterpolationAlpha = alpha;
+}
+
+/// @brief 입력 처리를 수행합니다.
+void SceneManager::Input() noexcept {
+    if (!m_SceneStack.empty()) {
+        auto& entry = m_SceneStack.back();
+        if (!entry.IsPause) {
+            entry.Scene->Input();
+        }
+    }
+}
+
+/// @brief 갱신 처리를 수행합니다.
+/// @param dt 델타 타임
+/// @note 최상위 장면과 UpdateThrough로 이어진 아래 장면들을 아래부터 갱신합니다.
+///       이 동안 요청된 LoadScene, ChangeScene, RemoveScene, ReloadScene, ClearScenePool은 다음 ProcessPendingLoad에서 요청 순서대로 반영됩니다.
+void SceneManager::Update(double dt) noexcept {
+    if (m_SceneStack.empty()) { return; }
+
+    m_Updating = true;
+    for (size_t i = getLayerBase(SceneLayer::UpdateThrough); i < m_SceneStack.size(); ++i) {
+        auto& entry = m_SceneStack[i];
+        if (!entry.IsPause) {
+            entry.Scene->Update(dt);
+        }
+    }
+    m_Updating = false;
+}
+
+/// @brief 렌더링 처리를 수행합니다.
+/// @note 최상위 장면과 RenderThrough로 이어진 아래 장면들을 아래부터 그립니다.
+///       CacheBelow 장면 아래가 모두 일시 정지되어 있다면 처음 한 번만 그려 캐시하고, 이후에는 캐시를 복원합니다.
+void SceneManager::Render() noexcept {
+    if (m_SceneStack.empty()) { return; }
+
+    const size_t top    = m_SceneStack.size() - 1U;
+    const size_t base   = getLayerBase(SceneLayer::RenderThrough);
+    const size_t cache  = getCacheLayer(base);
+
+    size_t first = base;
+    if (cache != 0U) {
+        m_LayerSerials.clear();
+        for (size_t i = base; i < cache; ++i) {
+            m_LayerSerials.push_back(m_SceneStack[i].Serial);
+        }
+
+        if (restoreLayerCache()) {
+            first = cache;
+        }
+    }
+    else {
+        m_LayerCache.Valid = false;
+    }
+
+    for (size_t i = first; i <= top; ++i) {
+        // 가려진 레이어를 모두 그렸으면 캐시
+        if (cache != 0U && i == cache) {
+            captureLayerCache();
+        }
+
+        // 일시 정지된 최상위 장면은 그리지 않음
+        auto& entry = m_SceneStack[i];
+        if (i != top || !entry.IsPause) {
+            entry.Scene->Render();
+        }
+    }
+}
+
+/// @brief 그려질 장면들의 렌더 스냅샷을 기록하고 발행합니다.
+/// @note 파이프라인 모드에서 Update 직후 시뮬레이션 스레드에서 호출합니다.
+///       그려질 장면 중 하나라도 스냅샷을 지원하지 않으면 발행하지 않으며, 렌더 스레드는 Render로 대체합니다.
+void SceneManager::PublishSnapshot() noexcept {
+    SnapshotSlot& slot = m_Snapshots.GetWriteBuffer();
+    slot.Valid = false;
+
+    if (!m_SceneStack.empty()) {
+        const size_t base   = getLayerBase(SceneLayer::RenderThrough);
+        const size_t cache  = getCacheLayer(base);
+
+        // 일시 정지된 최상위 장면은 그리지 않음
+        size_t count = m_SceneStack.size() - base;
+        if (m_SceneStack.back().IsPause) {
+            --count;
+        }
+
+        bool valid = (count > 0U);
+        slot.Layers.resize(count);
+        for (size_t i = 0; i < count && valid; ++i) {
+            auto& entry = m_SceneStack[base + i];
+            auto& layer = slot.Layers[i];
+
+            // 장면이 바뀌었으면 새 장면의 스냅샷으로 교체
+            if (layer.Serial != entry.Serial) {
+                layer.Snapshot = entry.Scene->CreateSnapshot();
+                layer.Serial = entry.Serial;
+            }
+
+            if (layer.Snapshot) {
+                entry.Scene->WriteSnapshot(*layer.Snapshot);
+            }
+            else {
+                valid = false;
+            }
+        }
+
+        slot.CacheLayer = (cache != 0U && cache - base < count) ? cache - base : 0U;
+        slot.Valid = valid;
+    }
+
+    m_Snapshots.Publish();
+}
+
+/// @brief 가장 최근에 발행된 렌더 스냅샷을 가져옵니다.
+/// @return 그릴 스냅샷이 있음(true), 없음(false: 장면이 파이프라인을 지원하지 않거나 아직 발행 전)
+/// @note 렌더 스레드에서 호출합니다. 새로 발행된 스냅샷이 없으면 이전 스냅샷을 유지합니다.
+bool SceneManager::AcquireSnapshot() noexcept {
+    (void)m_Snapshots.Acquire();
+    return m_Snapshots.GetReadBuffer().Valid;
+}
+
+/// @brief AcquireSnapshot으로 가져온 렌더 스냅샷을 그립니다.
+/// @note 렌더 스레드에서 BeginFrame과 EndFrame 사이에 호출합니다.
+void SceneManager::RenderFromSnapshot() noexcept {
+    const SnapshotSlot& slot = m_Snapshots.GetReadBuffer();
+    if (!slot.Valid) { return; }
+
+    size_t first = 0U;
+    if (slot.CacheLayer != 0U) {
+        m_LayerSerials.clear();
+        for (size_t i = 0; i < slot.CacheLayer; ++i) {
+            m_LayerSerials.push_back(slot.Layers[i].Serial);
+        }
+
+        if (restoreLayerCache()) {
+            first = slot.CacheLayer;
+        }
+    }
+    else {
+        m_LayerCache.Valid = false;
+    }
+
+    for (size_t i = first; i < slot.Layers.size(); ++i) {
+        // 가려진 레이어를 모두 그렸으면 캐시
+        if (slot.CacheLayer != 0U && i == slot.CacheLayer) {
+            captureLayerCache();
+        }
+
+        slot.Layers[i].Snapshot->Render(m_RenderDevice);
+    }
 }
\ No newline at end of file
@@ -1,120 +1,424 @@
-#include "Scene/SceneManager.hpp"
-#include "System/Application.hpp"
-#include "System/FPSLimiter.hpp"
-#include "System/Window.hpp"
-#include "Graphics/D3DGraphics.hpp"
-
-using namespace graphics;
-using namespace scene;
-using namespace system;
-
-/// @brief 기본 생성자
-Application::Application() noexcept {
-    m_hInstance     = nullptr;
-    m_FPSLimiter    = nullptr;
-    m_Window        = nullptr;
-    m_D3DGraphics   = nullptr;
-    m_SceneMgr      = nullptr;
-}
-
-/// @brief 소멸자
-Application::~Application() noexcept {
-    if (m_SceneMgr) {
-        delete m_SceneMgr;
-        m_SceneMgr = nullptr;
-    }
-    
-    if (m_FPSLimiter) {
-        delete m_FPSLimiter;
-        m_FPSLimiter = nullptr;
-    }
-    
-    if (m_D3DGraphics) {
-        delete m_D3DGraphics;
-        m_D3DGraphics = nullptr;
-    }
-    
-    if (m_Window) {
-        delete m_Window;
-        m_Window = nullptr;
-    }
-}
-
-void Application::input() noexcept {
-    m_SceneMgr->Input();
-}
-
-void Application::update() noexcept {
-    m_SceneMgr->Update(m_FPSLimiter->GetDeltaTime());
-}
-
-void Application::render() noexcept {
-    float color[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
-    m_D3DGraphics->BeginFrame(color);
-    m_SceneMgr->Render();
-    m_D3DGraphics->EndFrame();
-}
-
-/// @brief 응용 프로그램을 초기화합니다.
-/// @param hInstance 응용 프로그램의 인스턴스 핸들
-/// @return 성공(true), 실패(false)
-bool Application::Initialize(HINSTANCE hInstance) noexcept {
-    m_hInstance = hInstance;
-
-    // 윈도우 생성
-    m_Window = new Window();
-    if (m_Window && !m_Window->Create(hInstance, "NeoXOPS", 640, 480, false)) {
-        return false;
-    }
-
-    // Direct3D 초기화
-    m_D3DGraphics = new D3DGraphics();
-    if (m_D3DGraphics && !m_D3DGraphics->Initialize(m_Window->GetHandle(), 640, 480, false, false)) {
-        return false;
-    }
-
-    // FPSLimiter 초기화
-    m_FPSLimiter = new FPSLimiter();
-    if (!m_FPSLimiter) {
-        return false;
-    }
-
-    // 장면 관리자 초기화
-    m_SceneMgr = new SceneManager();
-    if (!m_SceneMgr) {
-        return false;
-    }
-
-    return true;
-}
-
-/// @brief 응용 프로그램을 구동합니다.
-void Application::Run() noexcept {
-    // 윈도우 표기
-    HWND windowHandle = m_Window->GetHandle();
-    ShowWindow(windowHandle, SW_SHOW);
-    UpdateWindow(windowHandle);
-
-    // 루프
-    MSG msg = {};
-    
-    while (true) {
-        while (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE)) {
-            if (msg.message == WM_QUIT) {
-                return;
-            }
-
-            TranslateMessage(&msg);
-            DispatchMessage(&msg);
-        }
-
-        // TODO:
-        m_FPSLimiter->StartFrame();
-
-        this->input();
-        this->update();
-        this->render();
-
-        m_FPSLimiter->EndFrame(m_D3DGraphics->IsVSyncEnabled());
-    }
+#include "Scene/SceneManager.hpp"
+#include "System/Application.hpp"
+#include "System/FileSystem.hpp"
+#include "System/FPSLimiter.hpp"
+#include "System/JobSystem.hpp"
+#include "System/NullWindow.hpp"
+#include "Graphics/NullRenderDevice.hpp"
+#include "Graphics/PipelineStateCache.hpp"
+#include "Graphics/RenderContext.hpp"
+#include "Graphics/ResourceManager.hpp"
+#include "Graphics/SoftwareRenderDevice.hpp"
+
+#if defined(_WIN32)
+    #include "System/Window.hpp"
+    #include "Graphics/D3DGraphics.hpp"
+#endif
+
+using namespace graphics;
+using namespace scene;
+using namespace system;
+
+/// @brief 기본 생성자
+Application::Application() noexcept {
+    m_FPSLimiter    = nullptr;
+    m_Window        = nullptr;
+    m_RenderDevice  = nullptr;
+    m_RenderContext = nullptr;
+    m_PipelineCache = nullptr;
+    m_ResourceMgr   = nullptr;
+    m_SceneMgr      = nullptr;
+    m_JobSystem     = nullptr;
+    m_FileSystem    = nullptr;
+    m_MaxFrames     = 0ULL;
+    m_FrameIndex    = 0ULL;
+
+    m_Pipelined     = false;
+    m_SimRequested  = false;
+    m_SimShutdown   = false;
+}
+
+/// @brief 소멸자
+Application::~Application() noexcept {
+    stopSimulationThread();
+
+    if (m_SceneMgr) {
+        delete m_SceneMgr;
+        m_SceneMgr = nullptr;
+    }
+
+    // 장면이 모두 파괴된 뒤 종료 (장면이 OnDestroy에서 작업을 기다릴 수 있음)
+    if (m_JobSystem) {
+        delete m_JobSystem;
+        m_JobSystem = nullptr;
+    }
+
+    // 작업이 모두 끝난 뒤 해제 (팩에서 읽은 데이터가 매핑을 가리킴)
+    if (m_FileSystem) {
+        delete m_FileSystem;
+        m_FileSystem = nullptr;
+    }
+
+    if (m_FPSLimiter) {
+        delete m_FPSLimiter;
+        m_FPSLimiter = nullptr;
+    }
+
+    // 장면이 모두 파괴된 뒤, 디바이스보다 먼저 해제 (남은 리소스를 디바이스에서 해제함)
+    if (m_ResourceMgr) {
+        delete m_ResourceMgr;
+        m_ResourceMgr = nullptr;
+    }
+
+    if (m_PipelineCache) {
+        delete m_PipelineCache;
+        m_PipelineCache = nullptr;
+    }
+
+    if (m_RenderContext) {
+        delete m_RenderContext;
+        m_RenderContext = nullptr;
+    }
+
+    if (m_RenderDevice) {
+        delete m_RenderDevice;
+        m_RenderDevice = nullptr;
+    }
+
+    if (m_Window) {
+        delete m_Window;
+        m_Window = nullptr;
+    }
+}
+
+void Application::input() noexcept {
+    m_SceneMgr->Input();
+}
+
+void Application::update() noexcept {
+    // 가변 간격
+    if (!m_FPSLimiter->IsFixedTimeStep()) {
+        m_SceneMgr->Update(m_FPSLimiter->GetDeltaTime());
+        m_SceneMgr->SetInterpolationAlpha(1.0);
+        return;
+    }
+
+    // 고정 간격 (누적된 시간만큼 반복, 상한 초과분은 버림)
+    const double step = m_FPSLimiter->GetFixedTimeStep();
+    while (m_FPSLimiter->StepSimulation()) {
+        m_SceneMgr->Update(step);
+    }
+    m_SceneMgr->SetInterpolationAlpha(m_FPSLimiter->GetInterpolationAlpha());
+}
+
+void Application::render() noexcept {
+    float color[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    m_RenderContext->BeginFrame(color);
+    m_SceneMgr->Render();
+    m_RenderContext->EndFrame();
+    m_ResourceMgr->EndFrame();
+}
+
+void Application::renderSnapshot() noexcept {
+    float color[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    m_RenderContext->BeginFrame(color);
+    m_SceneMgr->RenderFromSnapshot();
+    m_RenderContext->EndFrame();
+    m_ResourceMgr->EndFrame();
+}
+
+/// @brief 시뮬레이션 스레드의 진입점
+/// @note 요청을 받을 때마다 한 프레임을 시뮬레이션하고 렌더 스냅샷을 발행합니다.
+void Application::simulationMain() noexcept {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_SimMutex);
+            m_SimCondition.wait(lock, [this] { return m_SimRequested || m_SimShutdown; });
+            if (m_SimShutdown) {
+                return;
+            }
+        }
+
+        this->update();
+        m_SceneMgr->PublishSnapshot();
+
+        {
+            std::lock_guard<std::mutex> lock(m_SimMutex);
+            m_SimRequested = false;
+        }
+        m_SimCondition.notify_all();
+    }
+}
+
+/// @brief 시뮬레이션 스레드에 한 프레임의 시뮬레이션을 요청합니다.
+void Application::startSimulation() noexcept {
+    {
+        std::lock_guard<std::mutex> lock(m_SimMutex);
+        m_SimRequested = true;
+    }
+    m_SimCondition.notify_all();
+}
+
+/// @brief 요청한 시뮬레이션이 끝날 때까지 대기합니다.
+/// @note 시뮬레이션 스레드의 Update가 RunOnMainThread로 예약한 작업을 Wait할 수 있으므로,
+///       기다리는 동안에도 MAIN_JOB_POLL_INTERVAL마다 메인 스레드 전용 작업을 처리합니다. (처리하지 않으면 교착 상태)
+void Application::waitSimulation() noexcept {
+    std::unique_lock<std::mutex> lock(m_SimMutex);
+    while (m_SimRequested) {
+        lock.unlock();
+        const uint32_t processed = m_JobSystem->ProcessMainThreadJobs();
+        lock.lock();
+
+        if (processed == 0U) {
+            (void)m_SimCondition.wait_for(lock, MAIN_JOB_POLL_INTERVAL, [this] { return !m_SimRequested; });
+        }
+    }
+}
+
+/// @brief 시뮬레이션 스레드를 종료합니다.
+void Application::stopSimulationThread() noexcept {
+    if (!m_SimThread.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_SimMutex);
+        m_SimShutdown = true;
+    }
+    m_SimCondition.notify_all();
+    m_SimThread.join();
+}
+
+/// @brief 응용 프로그램을 초기화합니다.
+/// @param desc 응용 프로그램 설정
+/// @return 성공(true), 실패(false)
+/// @note 헤드리스 모드이거나 Win32가 아닌 환경에서는 NullWindow로 구동하며,
+///       렌더러를 지정하지 않으면 NullRenderDevice를 사용합니다.
+bool Application::Initialize(const ApplicationDesc& desc) noexcept {
+    m_MaxFrames     = desc.MaxFrames;
+    m_FrameIndex    = 0ULL;
+
+    // 작업 시스템 초기화 (호출한 스레드가 메인 스레드로 등록됨)
+    m_JobSystem = new JobSystem();
+    if (!m_JobSystem || !m_JobSystem->Initialize(desc.WorkerThreads)) {
+        return false;
+    }
+
+    // 파일 시스템 초기화 (디렉터리를 나중에 마운트해서 팩보다 먼저 찾음)
+    m_FileSystem = new FileSystem();
+    if (!m_FileSystem) {
+        return false;
+    }
+    if (desc.DataPack && !m_FileSystem->MountPack(desc.DataPack)) {
+        return false;
+    }
+    if (desc.DataDirectory && !m_FileSystem->MountDirectory(desc.DataDirectory)) {
+        return false;
+    }
+
+    // 윈도우 선택
+#if defined(_WIN32)
+    const bool headless = desc.Headless;
+#else
+    const bool headless = true;
+#endif
+
+    if (headless) {
+        m_Window = new NullWindow();
+    } else {
+#if defined(_WIN32)
+        m_Window = new Window(static_cast<HINSTANCE>(desc.Instance));
+#endif
+    }
+
+    // 렌더 디바이스 선택
+    RenderBackend renderer = desc.Renderer;
+    if (renderer == RenderBackend::Auto) {
+        renderer = headless ? RenderBackend::Null : RenderBackend::Direct3D11;
+    }
+
+    switch (renderer) {
+        case RenderBackend::Direct3D11:
+#if defined(_WIN32)
+            if (!headless) {
+                m_RenderDevice = new D3DGraphics();
+            }
+#endif
+            break;
+
+        case RenderBackend::Software:
+            m_RenderDevice = new SoftwareRenderDevice(desc.RenderThreads);
+            break;
+
+        default:
+            m_RenderDevice = new NullRenderDevice();
+            break;
+    }
+
+    // 윈도우 생성
+    if (!m_Window || !m_Window->Create(desc.Title, desc.Width, desc.Height, desc.FullscreenEnabled)) {
+        return false;
+    }
+
+    // 렌더 디바이스 초기화
+    if (!m_RenderDevice || !m_RenderDevice->Initialize(m_Window->GetNativeHandle(), desc.Width, desc.Height, desc.FullscreenEnabled, desc.VSyncEnabled)) {
+        return false;
+    }
+
+    // 제출 래퍼, 파이프라인 상태 캐시, 리소스 관리자 초기화 (해제가 바인딩 사본에 반영되도록 래퍼를 거침)
+    m_RenderContext = new RenderContext(*m_RenderDevice);
+    if (!m_RenderContext) {
+        return false;
+    }
+    m_PipelineCache = new PipelineStateCache(*m_RenderContext);
+    if (!m_PipelineCache) {
+        return false;
+    }
+    m_ResourceMgr = new ResourceManager(*m_RenderContext);
+    if (!m_ResourceMgr) {
+        return false;
+    }
+
+    // FPSLimiter 초기화
+    m_FPSLimiter = new FPSLimiter(desc.MaxFPS);
+    if (!m_FPSLimiter) {
+        return false;
+    }
+    m_FPSLimiter->SetFixedTimeStep(desc.FixedTimeStep, desc.MaxSimulationSteps);
+
+    // 장면 관리자 초기화
+    m_SceneMgr = new SceneManager();
+    if (!m_SceneMgr) {
+        return false;
+    }
+    m_SceneMgr->SetRenderDevice(m_RenderContext);
+    m_SceneMgr->SetPipelineStateCache(m_PipelineCache);
+    m_SceneMgr->SetResourceManager(m_ResourceMgr);
+    m_SceneMgr->SetJobSystem(m_JobSystem);
+    m_SceneMgr->SetFileSystem(m_FileSystem);
+
+    // 시뮬레이션 스레드 시작
+    m_Pipelined = desc.Pipelined;
+    if (m_Pipelined) {
+        m_SimShutdown = false;
+        m_SimThread = std::thread(&Application::simulationMain, this);
+    }
+
+    return true;
+}
+
+/// @brief 응용 프로그램을 구동합니다.
+/// @note 윈도우가 닫히거나 최대 프레임 수에 도달하면 반환합니다.
+///       파이프라인 모드에서는 프레임 N의 스냅샷을 이 스레드에서 그리는 동안 시뮬레이션 스레드가 프레임 N+1을 진행하므로,
+///       프레임 시간은 시뮬레이션과 렌더링 시간의 합이 아닌 둘 중 긴 쪽이 됩니다.
+///       이 동안 장면의 Update는 시뮬레이션 스레드에서 실행되므로 렌더 디바이스를 직접 사용하면 안 되며,
+///       그리기는 RenderSnapshot::Render에서 수행해야 합니다. Update에서 요청한 장면 교체(OnCreate, OnDestroy 등)는
+///       다음 프레임의 ProcessPendingLoad에서 메인 스레드가 반영하므로 리소스를 취득하고 해제해도 됩니다.
+void Application::Run() noexcept {
+    // 윈도우 표기
+    m_Window->Show();
+
+    // 루프
+    while (m_Window->ProcessMessages()) {
+        if (m_MaxFrames != 0ULL && m_FrameIndex >= m_MaxFrames) {
+            break;
+        }
+
+        m_FPSLimiter->StartFrame();
+
+        // 메인 스레드 전용 작업 처리, 비동기 로딩이 끝난 장면 반영
+        (void)m_JobSystem->ProcessMainThreadJobs();
+        m_SceneMgr->ProcessPendingLoad();
+
+        this->input();
+
+        if (m_Pipelined) {
+            // 직전 프레임의 스냅샷을 그리는 동안 다음 프레임을 시뮬레이션
+            const bool snapshotReady = m_SceneMgr->AcquireSnapshot();
+            this->startSimulation();
+            if (snapshotReady) {
+                this->renderSnapshot();
+            }
+            this->waitSimulation();
+
+            // 스냅샷을 지원하지 않는 장면은 시뮬레이션이 끝난 뒤 직접 그림
+            if (!snapshotReady) {
+                this->render();
+            }
+        } else {
+            this->update();
+            this->render();
+        }
+
+        m_FPSLimiter->EndFrame(m_RenderDevice->IsVSyncEnabled());
+        ++m_FrameIndex;
+    }
+}
+
+/// @brief 응용 프로그램의 종료를 요청합니다.
+/// @note 현재 프레임을 마친 뒤 Run이 반환됩니다.
+void Application::Quit() noexcept {
+    if (m_Window) {
+        m_Window->Close();
+    }
+}
+
+/// @brief 구동한 프레임 수를 취득합니다.
+/// @return 프레임 수
+uint64_t Application::GetFrameIndex() const noexcept {
+    return m_FrameIndex;
+}
+
+/// @brief 파이프라인 모드 여부를 취득합니다.
+/// @return 파이프라인 모드(true), 단일 스레드(false)
+bool Application::IsPipelined() const noexcept {
+    return m_Pipelined;
+}
+
+/// @brief FPSLimiter를 취득합니다.
+/// @return FPSLimiter
+FPSLimiter* Application::GetFPSLimiter() const noexcept {
+    return m_FPSLimiter;
+}
+
+/// @brief 렌더 디바이스를 취득합니다.
+/// @return 렌더 디바이스
+IRenderDevice* Application::GetRenderDevice() const noexcept {
+    return m_RenderDevice;
+}
+
+/// @brief 제출 래퍼를 취득합니다.
+/// @return 제출 래퍼 (장면에는 렌더 디바이스로 전달됨)
+RenderContext* Application::GetRenderContext() const noexcept {
+    return m_RenderContext;
+}
+
+/// @brief 파이프라인 상태 캐시를 취득합니다.
+/// @return 파이프라인 상태 캐시
+PipelineStateCache* Application::GetPipelineStateCache() const noexcept {
+    return m_PipelineCache;
+}
+
+/// @brief 리소스 관리자를 취득합니다.
+/// @return 리소스 관리자
+ResourceManager* Application::GetResourceManager() const noexcept {
+    return m_ResourceMgr;
+}
+
+/// @brief 장면 관리자를 취득합니다.
+/// @return 장면 관리자
+SceneManager* Application::GetSceneManager() const noexcept {
+    return m_SceneMgr;
+}
+
+/// @brief 작업 시스템을 취득합니다.
+/// @return 작업 시스템
+JobSystem* Application::GetJobSystem() const noexcept {
+    return m_JobSystem;
+}
+
+/// @brief 파일 시스템을 취득합니다.
+/// @return 파일 시스템
+FileSystem* Application::GetFileSystem() const noexcept {
+    return m_FileSystem;
 }
\ No newline at end of file
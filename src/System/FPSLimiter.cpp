@@ -1,102 +1,375 @@
-#include "System/FPSLimiter.hpp"
-#include <algorithm>
-#include <thread>
-
-using namespace system;
-
-/// @brief 생성자
-/// @param maxFPS 최대 제한 FPS
-FPSLimiter::FPSLimiter(uint32_t maxFPS) noexcept {
-    auto initTime       = std::chrono::steady_clock::now();
-    m_StartTime         = initTime;
-    m_EndTime           = initTime;
-    m_FrameStartTime    = initTime;
-    m_LastFPSTime       = initTime;
-
-    m_FrameCount        = 0U;
-    m_MaxFPS            = std::max(1U, maxFPS);
-    m_FPS               = 0.0;
-    m_DeltaTime         = 0.0;
-}
-
-/// @brief 소멸자
-FPSLimiter::~FPSLimiter() noexcept {
-
-}
-
-/// @brief 프레임의 측정을 시작합니다.
-void FPSLimiter::StartFrame() noexcept {
-    m_FrameStartTime = std::chrono::steady_clock::now();
-}
-
-/// @brief 프레임의 측정을 종료한 후, 연산을 수행합니다.
-/// @param vsyncEnabled V-Sync 활성화 유무
-void FPSLimiter::EndFrame(bool vsyncEnabled) noexcept {    
-    // 현재 시각
-    auto currentTime = std::chrono::steady_clock::now();
-
-    // 델타 타임
-    m_DeltaTime = std::chrono::duration<double>(currentTime - m_FrameStartTime).count();
-
-    // FPS 계산
-    ++m_FrameCount;
-    if (m_FrameCount >= m_MaxFPS) {
-        // 총 경과 시간
-        auto totalTime = std::chrono::duration<double>(currentTime - m_StartTime).count();
-
-        // 경과 시간이 0보다 크냐?
-        if (totalTime > 0.0) {
-            m_FPS = static_cast<double>(m_FrameCount) / totalTime;
-        }
-
-        // 초기화 및 갱신
-        m_FrameCount = 0U;
-        m_StartTime = currentTime;
-    }
-
-    // V-Sync 비활성화 일 때
-    if (!vsyncEnabled) {
-        if (m_SleepUntil.time_since_epoch().count() == 0) {
-            m_SleepUntil = currentTime;
-        }
-
-        // 1 프레임의 목표 시간
-        const auto targetDuration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / m_MaxFPS));
-
-        // 다음 프레임의 시작 시간
-        m_SleepUntil += targetDuration;
-
-        // 밀렸다면?
-        m_SleepUntil = std::max(m_SleepUntil, std::chrono::steady_clock::now() - MAX_DRIFT);
-
-        // 스레드 대기
-        // sleep_for는 비정확함.
-        std::this_thread::sleep_until(m_SleepUntil);
-    }
-
-    m_EndTime = currentTime;
-}
-
-/// @brief 프레임 카운트를 취득합니다.
-/// @return 프레임 카운트
-uint32_t FPSLimiter::GetFrameCount() const noexcept {
-    return m_FrameCount;
-}
-
-/// @brief FPS를 취득합니다.
-/// @return FPS
-double FPSLimiter::GetFPS() const noexcept {
-    return m_FPS;
-}
-
-/// @brief 델타 타임을 취득합니다.
-/// @return 델타 타임
-double FPSLimiter::GetDeltaTime() const noexcept {
-    return m_DeltaTime;
-}
-
-/// @brief 최대 제한 FPS를 설정합니다.
-/// @param maxFPS 최대 제한 FPS
-void FPSLimiter::SetMaxFPS(uint32_t maxFPS) noexcept {
-    m_MaxFPS = std::max(1U, maxFPS);
+#include "System/FPSLimiter.hpp"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+    #include <mmsystem.h>
+#endif
+
+using namespace system;
+
+namespace {
+    constexpr double OVERSHOOT_SMOOTHING    = 0.05;         ///< sleep 초과 시간 추정의 평활 계수
+    constexpr double OVERSHOOT_DEVIATIONS   = 2.0;          ///< 추정치에 더하는 표준편차 배수
+    constexpr double INITIAL_OVERSHOOT      = 0.0005;       ///< sleep 초과 시간의 초기 추정치 (초 단위)
+
+    /// @brief 정렬되지 않은 표본에서 백분위 값을 구합니다.
+    /// @param samples 표본 (순서가 바뀜)
+    /// @param count 표본 수
+    /// @param percentile 백분위 (0.0 ~ 1.0)
+    /// @return 백분위 값
+    double percentileOf(float* samples, uint32_t count, double percentile) noexcept {
+        const uint32_t rank = std::min(count - 1U, static_cast<uint32_t>(percentile * static_cast<double>(count)));
+        std::nth_element(samples, samples + rank, samples + count);
+        return samples[rank];
+    }
+}
+
+/// @brief 생성자
+/// @param maxFPS 최대 제한 FPS (0: 무제한)
+FPSLimiter::FPSLimiter(uint32_t maxFPS) noexcept {
+    auto initTime       = std::chrono::steady_clock::now();
+    m_StartTime         = initTime;
+    m_EndTime           = initTime;
+    m_FrameStartTime    = initTime;
+    m_LastFPSTime       = initTime;
+
+    m_FrameCount        = 0U;
+    m_MaxFPS            = maxFPS;
+    m_FPS               = 0.0;
+    m_DeltaTime         = 0.0;
+
+    m_FixedTimeStep         = 0.0;
+    m_Accumulator           = 0.0;
+    m_DroppedTime           = 0.0;
+    m_MaxSimulationSteps    = 5U;
+    m_SimulationSteps       = 0U;
+
+    m_HybridWaitEnabled     = true;
+    m_OvershootMean         = INITIAL_OVERSHOOT;
+    m_OvershootVariance     = 0.0;
+    m_WakeError             = 0.0;
+    m_FirstFrame            = true;
+
+    ResetFrameTimeStats();
+
+#if defined(_WIN32)
+    // 기본 타이머 해상도(15.6ms)로는 1ms 단위 sleep이 불가능
+    timeBeginPeriod(1);
+#endif
+}
+
+/// @brief 소멸자
+FPSLimiter::~FPSLimiter() noexcept {
+#if defined(_WIN32)
+    timeEndPeriod(1);
+#endif
+}
+
+/// @brief 목표 시각까지 대기합니다.
+/// @param deadline 목표 시각
+/// @note 남은 시간이 보정된 sleep 초과 시간보다 길면 SLEEP_QUANTUM씩 잠들고, 나머지는 양보하며 스핀합니다.
+///       잠들 때마다 실제로 초과한 시간을 측정해 추정치(평균 + 2 표준편차)를 갱신합니다.
+void FPSLimiter::waitUntil(std::chrono::steady_clock::time_point deadline) noexcept {
+    if (!m_HybridWaitEnabled) {
+        std::this_thread::sleep_until(deadline);
+        m_WakeError = std::chrono::duration<double>(std::chrono::steady_clock::now() - deadline).count();
+        return;
+    }
+
+    const double quantum = std::chrono::duration<double>(SLEEP_QUANTUM).count();
+
+    // 거친 대기
+    auto currentTime = std::chrono::steady_clock::now();
+    while (true) {
+        const double remaining = std::chrono::duration<double>(deadline - currentTime).count();
+        const double estimate = m_OvershootMean + OVERSHOOT_DEVIATIONS * std::sqrt(m_OvershootVariance);
+        if (remaining <= quantum + estimate) {
+            break;
+        }
+
+        std::this_thread::sleep_for(SLEEP_QUANTUM);
+
+        const auto wakeTime = std::chrono::steady_clock::now();
+        const double overshoot = std::chrono::duration<double>(wakeTime - currentTime).count() - quantum;
+        currentTime = wakeTime;
+
+        // 지수 이동 평균, 분산 갱신
+        const double diff = overshoot - m_OvershootMean;
+        m_OvershootMean += OVERSHOOT_SMOOTHING * diff;
+        m_OvershootVariance = (1.0 - OVERSHOOT_SMOOTHING) * (m_OvershootVariance + OVERSHOOT_SMOOTHING * diff * diff);
+    }
+
+    // 정밀 대기
+    while (currentTime < deadline) {
+        std::this_thread::yield();
+        currentTime = std::chrono::steady_clock::now();
+    }
+
+    m_WakeError = std::chrono::duration<double>(currentTime - deadline).count();
+}
+
+/// @brief 프레임 시간 표본을 추가합니다.
+/// @param frameTime 프레임 시간 (초 단위)
+void FPSLimiter::recordFrameTime(double frameTime) noexcept {
+    auto binOf = [](float value) {
+        return std::min(HISTOGRAM_BIN_COUNT - 1U, static_cast<uint32_t>(static_cast<double>(value) / HISTOGRAM_BIN_WIDTH));
+    };
+
+    // 가장 오래된 표본 제거
+    if (m_SampleCount == FRAME_TIME_WINDOW) {
+        --m_Histogram[binOf(m_FrameTimes[m_SampleIndex])];
+    } else {
+        ++m_SampleCount;
+    }
+
+    m_FrameTimes[m_SampleIndex] = static_cast<float>(frameTime);
+    ++m_Histogram[binOf(m_FrameTimes[m_SampleIndex])];
+
+    m_SampleIndex = (m_SampleIndex + 1U) % FRAME_TIME_WINDOW;
+}
+
+/// @brief 기상 지연 표본을 추가합니다.
+/// @param wakeError 목표 시각 대비 기상 지연 (초 단위)
+/// @note 목표 시각이 미래였던 대기만 기록합니다. 이미 늦은 프레임의 지연은 대기 정확도와 관계없기 때문입니다.
+void FPSLimiter::recordWakeError(double wakeError) noexcept {
+    m_WakeErrors[m_WakeErrorIndex] = static_cast<float>(wakeError);
+    m_WakeErrorIndex = (m_WakeErrorIndex + 1U) % FRAME_TIME_WINDOW;
+    m_WakeErrorCount = std::min(m_WakeErrorCount + 1U, FRAME_TIME_WINDOW);
+}
+
+/// @brief 최근 표본으로 프레임 시간 통계를 다시 계산합니다.
+/// @note EndFrame은 FPS_UPDATE_INTERVAL마다 호출하므로, 루프를 마친 뒤 통계를 읽기 전에 호출해 마지막 구간까지 반영합니다.
+void FPSLimiter::UpdateFrameTimeStats() noexcept {
+    FrameTimeStats stats;
+    stats.SampleCount = m_SampleCount;
+    stats.WakeSampleCount = m_WakeErrorCount;
+    stats.SleepOvershoot = m_OvershootMean + OVERSHOOT_DEVIATIONS * std::sqrt(m_OvershootVariance);
+
+    if (m_SampleCount != 0U) {
+        std::array<float, FRAME_TIME_WINDOW> sorted;
+
+        std::copy_n(m_FrameTimes.begin(), m_SampleCount, sorted.begin());
+        double sum = 0.0;
+        for (uint32_t i = 0U; i < m_SampleCount; ++i) {
+            sum += sorted[i];
+        }
+        stats.Mean  = sum / static_cast<double>(m_SampleCount);
+        stats.Max   = *std::max_element(sorted.begin(), sorted.begin() + m_SampleCount);
+        stats.P50   = percentileOf(sorted.data(), m_SampleCount, 0.50);
+        stats.P95   = percentileOf(sorted.data(), m_SampleCount, 0.95);
+        stats.P99   = percentileOf(sorted.data(), m_SampleCount, 0.99);
+    }
+
+    if (m_WakeErrorCount != 0U) {
+        std::array<float, FRAME_TIME_WINDOW> sorted;
+
+        std::copy_n(m_WakeErrors.begin(), m_WakeErrorCount, sorted.begin());
+        stats.WakeErrorMax  = *std::max_element(sorted.begin(), sorted.begin() + m_WakeErrorCount);
+        stats.WakeErrorP99  = percentileOf(sorted.data(), m_WakeErrorCount, 0.99);
+    }
+
+    m_FrameTimeStats = stats;
+}
+
+/// @brief 프레임의 측정을 시작합니다.
+/// @note 델타 타임은 이전 프레임의 시작부터 측정하므로 대기 시간을 포함합니다.
+void FPSLimiter::StartFrame() noexcept {
+    auto currentTime = std::chrono::steady_clock::now();
+
+    // 델타 타임 (첫 프레임은 생성 시점부터)
+    const double frameTime = std::chrono::duration<double>(currentTime - m_FrameStartTime).count();
+    m_DeltaTime = std::min(frameTime, MAX_DELTA_TIME);
+    m_FrameStartTime = currentTime;
+
+    // 첫 프레임은 초기화 시간이 섞이므로 통계에서 제외
+    if (m_FirstFrame) {
+        m_FirstFrame = false;
+    } else {
+        recordFrameTime(frameTime);
+    }
+
+    // 고정 간격 누적
+    m_SimulationSteps = 0U;
+    if (m_FixedTimeStep > 0.0) {
+        m_Accumulator += m_DeltaTime;
+    }
+}
+
+/// @brief 프레임의 측정을 종료한 후, 연산을 수행합니다.
+/// @param vsyncEnabled V-Sync 활성화 유무
+void FPSLimiter::EndFrame(bool vsyncEnabled) noexcept {    
+    // 현재 시각
+    auto currentTime = std::chrono::steady_clock::now();
+
+    // FPS 계산
+    ++m_FrameCount;
+    auto totalTime = std::chrono::duration<double>(currentTime - m_StartTime).count();
+    if (totalTime >= FPS_UPDATE_INTERVAL) {
+        m_FPS = static_cast<double>(m_FrameCount) / totalTime;
+        UpdateFrameTimeStats();
+
+        // 초기화 및 갱신
+        m_FrameCount = 0U;
+        m_StartTime = currentTime;
+    }
+
+    // V-Sync 비활성화 이고, 제한이 있을 때
+    if (!vsyncEnabled && m_MaxFPS != 0U) {
+        if (m_SleepUntil.time_since_epoch().count() == 0) {
+            m_SleepUntil = currentTime;
+        }
+
+        // 1 프레임의 목표 시간
+        const auto targetDuration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / m_MaxFPS));
+
+        // 다음 프레임의 시작 시간
+        m_SleepUntil += targetDuration;
+
+        const auto now = std::chrono::steady_clock::now();
+        if (m_SleepUntil <= now) {
+            // 밀렸다면 기다리지 않고, 드리프트만 제한 (늦은 만큼은 기상 지연이 아니므로 기록하지 않음)
+            m_SleepUntil = std::max(m_SleepUntil, now - MAX_DRIFT);
+            m_WakeError = 0.0;
+        } else {
+            // 스레드 대기
+            waitUntil(m_SleepUntil);
+            recordWakeError(m_WakeError);
+        }
+    } else {
+        m_WakeError = 0.0;
+    }
+
+    m_EndTime = currentTime;
+}
+
+/// @brief 프레임 카운트를 취득합니다.
+/// @return 프레임 카운트
+uint32_t FPSLimiter::GetFrameCount() const noexcept {
+    return m_FrameCount;
+}
+
+/// @brief FPS를 취득합니다.
+/// @return FPS
+double FPSLimiter::GetFPS() const noexcept {
+    return m_FPS;
+}
+
+/// @brief 델타 타임을 취득합니다.
+/// @return 델타 타임
+double FPSLimiter::GetDeltaTime() const noexcept {
+    return m_DeltaTime;
+}
+
+/// @brief 고정 간격 시뮬레이션을 한 단계 진행할 수 있는지 확인하고, 가능하면 누적 시간을 소모합니다.
+/// @return 진행(true), 이번 프레임의 시뮬레이션 종료(false)
+/// @note 매 프레임 false가 반환될 때까지 반복 호출합니다.
+///       따라잡기 상한에 도달하면 남은 누적 시간을 버려 죽음의 나선(spiral of death)을 막습니다.
+bool FPSLimiter::StepSimulation() noexcept {
+    if (m_FixedTimeStep <= 0.0 || m_Accumulator < m_FixedTimeStep) {
+        return false;
+    }
+
+    if (m_SimulationSteps >= m_MaxSimulationSteps) {
+        // 한 간격 미만만 남겨 보간 계수를 유지
+        const double excess = m_Accumulator - std::fmod(m_Accumulator, m_FixedTimeStep);
+        m_DroppedTime += excess;
+        m_Accumulator -= excess;
+        return false;
+    }
+
+    m_Accumulator -= m_FixedTimeStep;
+    ++m_SimulationSteps;
+    return true;
+}
+
+/// @brief 고정 간격 시뮬레이션 사용 유무를 취득합니다.
+/// @return 사용(true), 미사용(false)
+bool FPSLimiter::IsFixedTimeStep() const noexcept {
+    return m_FixedTimeStep > 0.0;
+}
+
+/// @brief 고정 시뮬레이션 간격을 취득합니다.
+/// @return 간격 (초 단위, 0: 가변 간격)
+double FPSLimiter::GetFixedTimeStep() const noexcept {
+    return m_FixedTimeStep;
+}
+
+/// @brief 렌더링 보간 계수를 취득합니다.
+/// @return 직전 시뮬레이션 상태와 현재 상태 사이의 위치 (0.0 ~ 1.0, 가변 간격이면 1.0)
+/// @note 렌더링 시 lerp(이전 상태, 현재 상태, alpha)로 사용합니다.
+double FPSLimiter::GetInterpolationAlpha() const noexcept {
+    if (m_FixedTimeStep <= 0.0) {
+        return 1.0;
+    }
+
+    return std::clamp(m_Accumulator / m_FixedTimeStep, 0.0, 1.0);
+}
+
+/// @brief 현재 프레임에서 수행한 시뮬레이션 횟수를 취득합니다.
+/// @return 시뮬레이션 횟수
+uint32_t FPSLimiter::GetSimulationSteps() const noexcept {
+    return m_SimulationSteps;
+}
+
+/// @brief 따라잡기 상한으로 버린 누적 시간을 취득합니다.
+/// @return 시간 (초 단위)
+double FPSLimiter::GetDroppedTime() const noexcept {
+    return m_DroppedTime;
+}
+
+/// @brief 최근 프레임 시간 통계를 취득합니다.
+/// @return 프레임 시간 통계
+/// @note FPS와 같은 간격(FPS_UPDATE_INTERVAL)으로 갱신됩니다. 최신 값이 필요하면 먼저 UpdateFrameTimeStats를 호출합니다.
+const FrameTimeStats& FPSLimiter::GetFrameTimeStats() const noexcept {
+    return m_FrameTimeStats;
+}
+
+/// @brief 최근 FRAME_TIME_WINDOW 프레임의 프레임 시간 히스토그램을 취득합니다.
+/// @return 구간별 프레임 수 (구간 i: [i * HISTOGRAM_BIN_WIDTH, (i + 1) * HISTOGRAM_BIN_WIDTH))
+const std::array<uint32_t, FPSLimiter::HISTOGRAM_BIN_COUNT>& FPSLimiter::GetFrameTimeHistogram() const noexcept {
+    return m_Histogram;
+}
+
+/// @brief 하이브리드 대기 사용 유무를 취득합니다.
+/// @return 사용(true), 미사용(false)
+bool FPSLimiter::IsHybridWaitEnabled() const noexcept {
+    return m_HybridWaitEnabled;
+}
+
+/// @brief 최대 제한 FPS를 설정합니다.
+/// @param maxFPS 최대 제한 FPS (0: 무제한)
+void FPSLimiter::SetMaxFPS(uint32_t maxFPS) noexcept {
+    m_MaxFPS = maxFPS;
+}
+
+/// @brief 고정 시뮬레이션 간격을 설정합니다.
+/// @param step 간격 (초 단위, 0: 가변 간격)
+/// @param maxSteps 한 프레임에서 수행할 최대 시뮬레이션 횟수 (따라잡기 상한)
+void FPSLimiter::SetFixedTimeStep(double step, uint32_t maxSteps) noexcept {
+    m_FixedTimeStep         = std::max(0.0, step);
+    m_MaxSimulationSteps    = std::max(1U, maxSteps);
+    m_Accumulator           = 0.0;
+    m_DroppedTime           = 0.0;
+}
+
+/// @brief 하이브리드 대기 사용 유무를 설정합니다.
+/// @param enabled 사용 유무 (false: sleep_until만 사용, 전력 소모 우선)
+void FPSLimiter::SetHybridWaitEnabled(bool enabled) noexcept {
+    m_HybridWaitEnabled = enabled;
+}
+
+/// @brief 프레임 시간 통계와 히스토그램을 초기화합니다.
+void FPSLimiter::ResetFrameTimeStats() noexcept {
+    m_FrameTimes.fill(0.0f);
+    m_WakeErrors.fill(0.0f);
+    m_Histogram.fill(0U);
+    m_SampleIndex       = 0U;
+    m_SampleCount       = 0U;
+    m_WakeErrorIndex    = 0U;
+    m_WakeErrorCount    = 0U;
+    m_FrameTimeStats    = {};
 }
\ No newline at end of file
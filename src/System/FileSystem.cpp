@@ -0,0 +1,177 @@
+#include "System/FileSystem.hpp"
+#include "Type/Hash.hpp"
+#include <filesystem>
+
+using namespace system;
+
+namespace {
+    /// @brief 디렉터리 층에서 찾을 실제 경로를 만듭니다.
+    /// @param directory 디렉터리
+    /// @param path 가상 경로
+    /// @return 실제 경로
+    std::string getLoosePath(const std::string& directory, std::string_view path) noexcept {
+        std::string result;
+        result.reserve(directory.size() + path.size() + 1U);
+        result = directory;
+        result.push_back('/');
+        for (const char c : path) {
+            result.push_back((c == '\\') ? '/' : c);
+        }
+        return result;
+    }
+}
+
+/// @brief 생성자
+FileSystem::FileSystem() noexcept : m_VerifyContent(false), m_PackReads(0ULL), m_LooseReads(0ULL), m_Misses(0ULL), m_Failures(0ULL), m_DecompressedBytes(0ULL) {
+
+}
+
+/// @brief 팩 항목을 읽습니다.
+/// @param pack 팩
+/// @param entry 항목
+/// @param data 결과
+/// @return 성공(true), 실패(false: 손상됨)
+bool FileSystem::readPack(const PackFile& pack, const PackEntry& entry, FileData& data) noexcept {
+    data.File.Close();
+    data.Size = static_cast<size_t>(entry.Size);
+    data.Data = pack.GetStoredData(entry);
+    if (data.Data) {
+        data.Memory.clear();
+    } else {
+        data.Memory.resize(data.Size);
+        data.Data = data.Memory.data();
+        if (!pack.Read(entry, data.Memory.data())) {
+            data.Data = nullptr;
+            data.Size = 0U;
+            m_Failures.fetch_add(1ULL, std::memory_order_relaxed);
+            return false;
+        }
+        m_DecompressedBytes.fetch_add(entry.Size, std::memory_order_relaxed);
+    }
+
+    if (m_VerifyContent && Hash64(data.Data, data.Size) != entry.ContentHash) {
+        data.Data = nullptr;
+        data.Size = 0U;
+        m_Failures.fetch_add(1ULL, std::memory_order_relaxed);
+        return false;
+    }
+
+    m_PackReads.fetch_add(1ULL, std::memory_order_relaxed);
+    return true;
+}
+
+/// @brief 디렉터리 층에서 파일을 읽습니다.
+/// @param directory 디렉터리
+/// @param path 가상 경로
+/// @param data 결과
+/// @return 성공(true), 없음(false)
+bool FileSystem::readLoose(const std::string& directory, std::string_view path, FileData& data) noexcept {
+    const std::string loosePath = getLoosePath(directory, path);
+    data.Memory.clear();
+    if (data.File.Open(loosePath)) {
+        data.Data = data.File.GetData();
+        data.Size = data.File.GetSize();
+        return true;
+    }
+
+    // 빈 파일은 매핑할 수 없으므로 존재 여부만 따로 확인
+    std::error_code error;
+    data.Data = nullptr;
+    data.Size = 0U;
+    return std::filesystem::is_regular_file(loosePath, error);
+}
+
+/// @brief 팩을 마운트합니다.
+/// @param path 팩 파일 경로
+/// @return 성공(true), 실패(false: 파일이 없거나 손상됨)
+bool FileSystem::MountPack(const std::string& path) noexcept {
+    auto pack = std::make_unique<PackFile>();
+    if (!pack->Open(path)) {
+        return false;
+    }
+
+    m_Layers.push_back({ std::move(pack), {} });
+    return true;
+}
+
+/// @brief 디렉터리를 마운트합니다.
+/// @param path 디렉터리 경로
+/// @return 성공(true), 실패(false: 디렉터리가 아님)
+/// @note 찾을 때마다 파일 열기를 시도하므로 개발용 덮어쓰기에만 사용합니다.
+bool FileSystem::MountDirectory(const std::string& path) noexcept {
+    std::error_code error;
+    if (!std::filesystem::is_directory(path, error)) {
+        return false;
+    }
+
+    m_Layers.push_back({ nullptr, path });
+    return true;
+}
+
+/// @brief 모든 층을 해제합니다.
+/// @note 팩에서 읽은 FileData는 모두 무효가 됩니다.
+void FileSystem::UnmountAll() noexcept {
+    m_Layers.clear();
+}
+
+/// @brief 파일이 있는지 확인합니다.
+/// @param path 가상 경로
+/// @return 있음(true), 없음(false)
+bool FileSystem::Exists(std::string_view path) const noexcept {
+    for (auto layer = m_Layers.rbegin(); layer != m_Layers.rend(); ++layer) {
+        if (layer->Pack) {
+            if (layer->Pack->Find(path)) {
+                return true;
+            }
+        } else {
+            std::error_code error;
+            if (std::filesystem::is_regular_file(getLoosePath(layer->Directory, path), error)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/// @brief 파일을 읽습니다.
+/// @param path 가상 경로
+/// @param data 결과 (재사용하면 압축 해제 버퍼를 다시 할당하지 않음)
+/// @return 성공(true), 실패(false: 없거나 손상됨)
+/// @note 나중에 마운트한 층부터 찾으며, 처음 찾은 층의 내용을 돌려줍니다.
+bool FileSystem::Read(std::string_view path, FileData& data) noexcept {
+    for (auto layer = m_Layers.rbegin(); layer != m_Layers.rend(); ++layer) {
+        if (layer->Pack) {
+            const PackEntry* entry = layer->Pack->Find(path);
+            if (entry) {
+                return readPack(*layer->Pack, *entry, data);
+            }
+        } else if (readLoose(layer->Directory, path, data)) {
+            m_LooseReads.fetch_add(1ULL, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    data.File.Close();
+    data.Data = nullptr;
+    data.Size = 0U;
+    m_Misses.fetch_add(1ULL, std::memory_order_relaxed);
+    return false;
+}
+
+/// @brief 팩에서 읽은 내용의 해시 검증 여부를 설정합니다.
+/// @param verify 검증 여부 (읽을 때마다 Hash64를 계산하므로 개발, 진단용)
+void FileSystem::SetVerifyContent(bool verify) noexcept {
+    m_VerifyContent = verify;
+}
+
+/// @brief 통계를 취득합니다.
+/// @return 통계
+FileSystemStats FileSystem::GetStats() const noexcept {
+    FileSystemStats stats;
+    stats.PackReads         = m_PackReads.load(std::memory_order_relaxed);
+    stats.LooseReads        = m_LooseReads.load(std::memory_order_relaxed);
+    stats.Misses            = m_Misses.load(std::memory_order_relaxed);
+    stats.Failures          = m_Failures.load(std::memory_order_relaxed);
+    stats.DecompressedBytes = m_DecompressedBytes.load(std::memory_order_relaxed);
+    return stats;
+}
\ No newline at end of file
@@ -0,0 +1,382 @@
+#include "System/JobSystem.hpp"
+#include <algorithm>
+
+using namespace system;
+
+namespace {
+    constexpr uint32_t IDLE_SPIN_COUNT = 64U;               ///< 잠들기 전에 작업을 다시 찾아보는 횟수
+
+    thread_local const JobSystem* t_Owner = nullptr;        ///< 현재 스레드가 등록된 작업 시스템
+    thread_local uint32_t t_Index = 0U;                     ///< 현재 스레드의 작업 덱 인덱스
+}
+
+/// @brief 생성자
+JobSystem::WorkQueue::WorkQueue() noexcept : m_Top(0), m_Bottom(0), m_Jobs(new std::atomic<Job*>[CAPACITY]) {
+    for (int64_t i = 0; i < CAPACITY; ++i) {
+        m_Jobs[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+/// @brief 작업을 넣습니다. (소유 스레드 전용)
+/// @param job 작업
+/// @return 성공(true), 가득 참(false)
+bool JobSystem::WorkQueue::Push(Job* job) noexcept {
+    const int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+    const int64_t top = m_Top.load(std::memory_order_acquire);
+    if (bottom - top >= CAPACITY) {
+        return false;
+    }
+
+    m_Jobs[bottom & (CAPACITY - 1)].store(job, std::memory_order_relaxed);
+    m_Bottom.store(bottom + 1, std::memory_order_release);
+
+    return true;
+}
+
+/// @brief 가장 최근에 넣은 작업을 꺼냅니다. (소유 스레드 전용)
+/// @return 작업 (없으면 nullptr)
+JobSystem::Job* JobSystem::WorkQueue::Pop() noexcept {
+    const int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+    m_Bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = m_Top.load(std::memory_order_relaxed);
+
+    // 비어있음
+    if (top > bottom) {
+        m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Job* job = m_Jobs[bottom & (CAPACITY - 1)].load(std::memory_order_relaxed);
+
+    // 마지막 하나는 훔치는 쪽과 경쟁
+    if (top == bottom) {
+        if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            job = nullptr;
+        }
+        m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    return job;
+}
+
+/// @brief 가장 오래된 작업을 훔칩니다.
+/// @return 작업 (없거나 경쟁에서 지면 nullptr)
+JobSystem::Job* JobSystem::WorkQueue::Steal() noexcept {
+    int64_t top = m_Top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+
+    if (top >= bottom) {
+        return nullptr;
+    }
+
+    Job* job = m_Jobs[top & (CAPACITY - 1)].load(std::memory_order_relaxed);
+    if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return nullptr;
+    }
+
+    return job;
+}
+
+/// @brief 기본 생성자
+JobSystem::JobSystem() noexcept : m_PendingJobs(0), m_SleepingWorkers(0), m_Shutdown(false) {
+
+}
+
+/// @brief 소멸자
+JobSystem::~JobSystem() noexcept {
+    Shutdown();
+}
+
+/// @brief 작업 스레드의 진입점
+/// @param index 작업 덱 인덱스
+void JobSystem::workerMain(uint32_t index) noexcept {
+    t_Owner = this;
+    t_Index = index;
+
+    uint32_t idle = 0U;
+    while (!m_Shutdown.load(std::memory_order_acquire)) {
+        if (Job* job = findJob()) {
+            execute(job);
+            idle = 0U;
+            continue;
+        }
+
+        // 잠시 다른 스레드에 양보하며 다시 찾아본 뒤 잠듦
+        if (++idle < IDLE_SPIN_COUNT) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_SleepMutex);
+        m_SleepingWorkers.fetch_add(1);
+        m_SleepCondition.wait(lock, [this] {
+            return m_PendingJobs.load() > 0 || m_Shutdown.load(std::memory_order_acquire);
+        });
+        m_SleepingWorkers.fetch_sub(1);
+        idle = 0U;
+    }
+
+    t_Owner = nullptr;
+}
+
+/// @brief 작업을 예약하고 잠든 작업 스레드를 깨웁니다.
+/// @param job 작업
+void JobSystem::submit(Job* job) noexcept {
+    if (t_Owner == this) {
+        // 덱이 가득 찼다면 바로 실행
+        if (!m_Queues[t_Index]->Push(job)) {
+            execute(job);
+            return;
+        }
+    } else {
+        std::lock_guard<std::mutex> lock(m_GlobalMutex);
+        m_GlobalQueue.push_back(job);
+    }
+
+    // 작업 수 증가와 잠든 스레드 수 확인은 순차 일관성으로 수행하여,
+    // 잠들려는 스레드가 새 작업을 보거나 이쪽이 그 스레드를 보도록 보장
+    m_PendingJobs.fetch_add(1);
+    if (m_SleepingWorkers.load() > 0) {
+        {
+            std::lock_guard<std::mutex> lock(m_SleepMutex);
+        }
+        m_SleepCondition.notify_one();
+    }
+}
+
+/// @brief 실행할 작업을 찾습니다.
+/// @return 작업 (없으면 nullptr)
+/// @note 자신의 덱 → 전역 큐 → 다른 스레드의 덱 순서로 찾습니다.
+JobSystem::Job* JobSystem::findJob() noexcept {
+    Job* job = nullptr;
+    const uint32_t queueCount = static_cast<uint32_t>(m_Queues.size());
+    const bool registered = (t_Owner == this);
+
+    // 자신의 덱
+    if (registered) {
+        job = m_Queues[t_Index]->Pop();
+    }
+
+    // 전역 큐
+    if (!job) {
+        std::lock_guard<std::mutex> lock(m_GlobalMutex);
+        if (!m_GlobalQueue.empty()) {
+            job = m_GlobalQueue.front();
+            m_GlobalQueue.pop_front();
+        }
+    }
+
+    // 다른 스레드의 덱
+    if (!job) {
+        const uint32_t start = registered ? (t_Index + 1U) : 0U;
+        for (uint32_t i = 0U; i < queueCount && !job; ++i) {
+            const uint32_t victim = (start + i) % queueCount;
+            if (registered && victim == t_Index) {
+                continue;
+            }
+            job = m_Queues[victim]->Steal();
+        }
+    }
+
+    if (job) {
+        m_PendingJobs.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    return job;
+}
+
+/// @brief 작업을 실행하고 카운터를 감소시킵니다.
+/// @param job 작업
+void JobSystem::execute(Job* job) noexcept {
+    job->Function();
+
+    if (job->Counter) {
+        job->Counter->Value.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    delete job;
+}
+
+/// @brief 작업 시스템을 초기화합니다.
+/// @param workerCount 작업 스레드 수 (메인 스레드 제외, 0이면 하드웨어 스레드 수 - 1)
+/// @return 성공(true), 실패(false)
+/// @note 호출한 스레드가 메인 스레드로 등록됩니다.
+bool JobSystem::Initialize(uint32_t workerCount) noexcept {
+    if (!m_Queues.empty()) {
+        return false;
+    }
+
+    if (workerCount == 0U) {
+        workerCount = std::max(1U, std::thread::hardware_concurrency()) - 1U;
+    }
+
+    m_Shutdown.store(false, std::memory_order_release);
+    m_MainThreadID = std::this_thread::get_id();
+
+    for (uint32_t i = 0U; i <= workerCount; ++i) {
+        m_Queues.push_back(std::make_unique<WorkQueue>());
+    }
+
+    t_Owner = this;
+    t_Index = 0U;
+
+    for (uint32_t i = 1U; i <= workerCount; ++i) {
+        m_Workers.emplace_back(&JobSystem::workerMain, this, i);
+    }
+
+    return true;
+}
+
+/// @brief 작업 스레드를 모두 종료합니다.
+/// @note 남은 작업은 호출한 스레드에서 모두 실행한 뒤 종료합니다.
+void JobSystem::Shutdown() noexcept {
+    if (m_Queues.empty()) {
+        return;
+    }
+
+    // 남은 작업 처리
+    while (Job* job = findJob()) {
+        execute(job);
+    }
+    while (ProcessMainThreadJobs() != 0U) {}
+
+    {
+        std::lock_guard<std::mutex> lock(m_SleepMutex);
+        m_Shutdown.store(true, std::memory_order_release);
+    }
+    m_SleepCondition.notify_all();
+
+    for (auto& worker : m_Workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    m_Workers.clear();
+    m_Queues.clear();
+
+    if (t_Owner == this) {
+        t_Owner = nullptr;
+    }
+}
+
+/// @brief 작업을 예약합니다.
+/// @param function 실행할 함수
+/// @param counter 완료 카운터 (nullptr 가능)
+/// @note 어떤 스레드에서든 호출할 수 있으며, 실행 중인 작업 안에서 호출하면 자식 작업이 됩니다.
+void JobSystem::Run(JobFunction function, JobCounter* counter) noexcept {
+    if (counter) {
+        counter->Value.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    Job* job = new Job{ std::move(function), counter };
+
+    // 초기화 전이라면 바로 실행
+    if (m_Queues.empty()) {
+        execute(job);
+        return;
+    }
+
+    submit(job);
+}
+
+/// @brief 메인 스레드에서만 실행될 작업을 예약합니다.
+/// @param function 실행할 함수
+/// @param counter 완료 카운터 (nullptr 가능)
+/// @note 그래픽스 컨텍스트처럼 스레드 안전하지 않은 자원을 다루는 작업에 사용합니다.
+///       메인 스레드가 ProcessMainThreadJobs 또는 Wait를 호출할 때 실행됩니다.
+///       파이프라인 모드의 Application은 시뮬레이션 완료를 기다리는 동안에도 처리하므로, 시뮬레이션 스레드에서 예약하고 Wait해도 됩니다.
+void JobSystem::RunOnMainThread(JobFunction function, JobCounter* counter) noexcept {
+    if (counter) {
+        counter->Value.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    std::lock_guard<std::mutex> lock(m_MainMutex);
+    m_MainQueue.push_back(new Job{ std::move(function), counter });
+}
+
+/// @brief 카운터가 0이 될 때까지 다른 작업을 처리하며 대기합니다.
+/// @param counter 완료 카운터
+void JobSystem::Wait(JobCounter& counter) noexcept {
+    const bool mainThread = IsMainThread();
+
+    while (!counter.IsDone()) {
+        if (mainThread && ProcessMainThreadJobs() != 0U) {
+            continue;
+        }
+
+        if (Job* job = findJob()) {
+            execute(job);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+/// @brief 범위를 나누어 병렬로 처리하고 모두 끝날 때까지 대기합니다.
+/// @param begin 시작 (포함)
+/// @param end 끝 (미포함)
+/// @param grain 작업 하나가 처리할 최소 개수 (0이면 스레드당 4개의 작업이 되도록 자동 결정)
+/// @param function 범위 처리 함수 (시작, 끝)
+void JobSystem::ParallelFor(uint32_t begin, uint32_t end, uint32_t grain, const RangeFunction& function) noexcept {
+    if (begin >= end) {
+        return;
+    }
+
+    const uint32_t count = end - begin;
+    if (grain == 0U) {
+        grain = std::max(1U, count / (GetThreadCount() * 4U));
+    }
+
+    // 나눌 필요가 없음
+    if (count <= grain) {
+        function(begin, end);
+        return;
+    }
+
+    JobCounter counter;
+    for (uint32_t first = begin + grain; first < end; first += grain) {
+        const uint32_t last = std::min(end, first + grain);
+        Run([&function, first, last] { function(first, last); }, &counter);
+    }
+
+    // 첫 구간은 호출한 스레드에서 처리
+    function(begin, begin + grain);
+
+    Wait(counter);
+}
+
+/// @brief 메인 스레드 전용 작업을 처리합니다.
+/// @return 처리한 작업 수 (메인 스레드가 아니면 0)
+/// @note Application이 매 프레임 호출합니다.
+uint32_t JobSystem::ProcessMainThreadJobs() noexcept {
+    if (!IsMainThread()) {
+        return 0U;
+    }
+
+    std::deque<Job*> jobs;
+    {
+        std::lock_guard<std::mutex> lock(m_MainMutex);
+        jobs.swap(m_MainQueue);
+    }
+
+    for (Job* job : jobs) {
+        execute(job);
+    }
+
+    return static_cast<uint32_t>(jobs.size());
+}
+
+/// @brief 작업을 처리하는 스레드 수를 취득합니다.
+/// @return 메인 스레드를 포함한 스레드 수
+uint32_t JobSystem::GetThreadCount() const noexcept {
+    return static_cast<uint32_t>(m_Workers.size()) + 1U;
+}
+
+/// @brief 호출한 스레드가 메인 스레드인지 확인합니다.
+/// @return 메인 스레드(true), 그 외(false)
+bool JobSystem::IsMainThread() const noexcept {
+    return std::this_thread::get_id() == m_MainThreadID;
+}
\ No newline at end of file
@@ -0,0 +1,475 @@
+#include "System/Json.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+using namespace system;
+
+namespace {
+    /// @brief 16진수 숫자 4개를 읽습니다.
+    /// @param text 숫자 (4글자)
+    /// @param value 결과
+    /// @return 성공(true), 실패(false)
+    bool parseHex4(const char* text, uint32_t& value) noexcept {
+        value = 0U;
+        for (uint32_t i = 0U; i < 4U; ++i) {
+            const char c = text[i];
+            uint32_t digit = 0U;
+            if (c >= '0' && c <= '9') {
+                digit = static_cast<uint32_t>(c - '0');
+            }
+            else if (c >= 'a' && c <= 'f') {
+                digit = static_cast<uint32_t>(c - 'a' + 10);
+            }
+            else if (c >= 'A' && c <= 'F') {
+                digit = static_cast<uint32_t>(c - 'A' + 10);
+            }
+            else {
+                return false;
+            }
+            value = (value << 4) | digit;
+        }
+        return true;
+    }
+
+    /// @brief 코드 포인트를 UTF-8로 씁니다.
+    /// @param codePoint 코드 포인트
+    /// @param out 출력 위치 (최대 4바이트)
+    /// @return 쓴 바이트 수
+    uint32_t encodeUTF8(uint32_t codePoint, char* out) noexcept {
+        if (codePoint < 0x80U) {
+            out[0] = static_cast<char>(codePoint);
+            return 1U;
+        }
+        if (codePoint < 0x800U) {
+            out[0] = static_cast<char>(0xC0U | (codePoint >> 6));
+            out[1] = static_cast<char>(0x80U | (codePoint & 0x3FU));
+            return 2U;
+        }
+        if (codePoint < 0x10000U) {
+            out[0] = static_cast<char>(0xE0U | (codePoint >> 12));
+            out[1] = static_cast<char>(0x80U | ((codePoint >> 6) & 0x3FU));
+            out[2] = static_cast<char>(0x80U | (codePoint & 0x3FU));
+            return 3U;
+        }
+        out[0] = static_cast<char>(0xF0U | (codePoint >> 18));
+        out[1] = static_cast<char>(0x80U | ((codePoint >> 12) & 0x3FU));
+        out[2] = static_cast<char>(0x80U | ((codePoint >> 6) & 0x3FU));
+        out[3] = static_cast<char>(0x80U | (codePoint & 0x3FU));
+        return 4U;
+    }
+}
+
+/// @brief Null 값을 취득합니다.
+/// @return Null 값 (없는 멤버, 범위 밖 요소 대신 돌려주는 값)
+const JsonValue& JsonValue::GetNull() noexcept {
+    static const JsonValue null = { JsonType::Null, 0U, { false } };
+    return null;
+}
+
+/// @brief Bool 값을 취득합니다.
+/// @param fallback Bool이 아닐 때 돌려줄 값
+/// @return 값
+bool JsonValue::GetBool(bool fallback) const noexcept {
+    return (Type == JsonType::Bool) ? Bool : fallback;
+}
+
+/// @brief Number 값을 취득합니다.
+/// @param fallback Number가 아닐 때 돌려줄 값
+/// @return 값
+double JsonValue::GetNumber(double fallback) const noexcept {
+    return (Type == JsonType::Number) ? Number : fallback;
+}
+
+/// @brief Number 값을 float로 취득합니다.
+/// @param fallback Number가 아닐 때 돌려줄 값
+/// @return 값
+float JsonValue::GetFloat(float fallback) const noexcept {
+    return (Type == JsonType::Number) ? static_cast<float>(Number) : fallback;
+}
+
+/// @brief Number 값을 정수로 취득합니다.
+/// @param fallback Number가 아니거나 범위를 벗어날 때 돌려줄 값
+/// @return 값 (소수부는 버림)
+int32_t JsonValue::GetInt(int32_t fallback) const noexcept {
+    return (Type == JsonType::Number && Number >= -2147483648.0 && Number <= 2147483647.0) ? static_cast<int32_t>(Number) : fallback;
+}
+
+/// @brief Number 값을 부호 없는 정수로 취득합니다.
+/// @param fallback Number가 아니거나 범위를 벗어날 때 돌려줄 값
+/// @return 값 (소수부는 버림)
+uint32_t JsonValue::GetUint(uint32_t fallback) const noexcept {
+    return (Type == JsonType::Number && Number >= 0.0 && Number <= 4294967295.0) ? static_cast<uint32_t>(Number) : fallback;
+}
+
+/// @brief String 값을 취득합니다.
+/// @param fallback String이 아닐 때 돌려줄 값
+/// @return 값 (이스케이프가 풀린 UTF-8)
+std::string_view JsonValue::GetString(std::string_view fallback) const noexcept {
+    return (Type == JsonType::String) ? std::string_view(String, Count) : fallback;
+}
+
+/// @brief 배열 요소 수 또는 객체 멤버 수를 취득합니다.
+/// @return 개수 (배열, 객체가 아니면 0)
+uint32_t JsonValue::GetSize() const noexcept {
+    return (Type == JsonType::Array || Type == JsonType::Object) ? Count : 0U;
+}
+
+/// @brief 배열 요소를 취득합니다.
+/// @param index 인덱스
+/// @return 요소 (배열이 아니거나 범위 밖이면 Null)
+const JsonValue& JsonValue::operator[](size_t index) const noexcept {
+    return (Type == JsonType::Array && index < Count) ? Items[index] : GetNull();
+}
+
+/// @brief 객체 멤버를 이름으로 취득합니다.
+/// @param name 이름
+/// @return 값 (객체가 아니거나 없으면 Null)
+const JsonValue& JsonValue::operator[](std::string_view name) const noexcept {
+    const JsonValue* value = Find(name);
+    return value ? *value : GetNull();
+}
+
+/// @brief 객체 멤버를 이름으로 찾습니다.
+/// @param name 이름
+/// @return 값 (객체가 아니거나 없으면 nullptr)
+const JsonValue* JsonValue::Find(std::string_view name) const noexcept {
+    if (Type != JsonType::Object) {
+        return nullptr;
+    }
+    for (uint32_t i = 0U; i < Count; ++i) {
+        if (Members[i].Name == name) {
+            return &Members[i].Value;
+        }
+    }
+    return nullptr;
+}
+
+/// @brief 객체 멤버를 순서로 취득합니다.
+/// @param index 인덱스 (GetSize() 미만)
+/// @return 멤버
+const JsonMember& JsonValue::GetMember(size_t index) const noexcept {
+    return Members[index];
+}
+
+/// @brief 생성자
+JsonDocument::JsonDocument() noexcept : m_Blocks(), m_BlockOffset(0U), m_BlockSize(0U), m_ArenaSize(0U), m_ValueStack(), m_MemberStack(), m_Root(JsonValue::GetNull()), m_Cursor(nullptr), m_End(nullptr) {
+
+}
+
+/// @brief 아레나에서 메모리를 할당합니다.
+/// @param size 크기
+/// @param alignment 정렬 (2의 거듭제곱, 16 이하)
+/// @return 메모리
+/// @note 큰 할당은 전용 블록을 받아, 쓰던 블록의 남은 공간을 버리지 않습니다.
+void* JsonDocument::allocate(size_t size, size_t alignment) noexcept {
+    if (size > BLOCK_SIZE / 4U) {
+        std::unique_ptr<byte_t[]> block(new byte_t[size]);
+        void* memory = block.get();
+        m_Blocks.insert(m_Blocks.empty() ? m_Blocks.end() : m_Blocks.end() - 1, std::move(block));
+        m_ArenaSize += size;
+        return memory;
+    }
+
+    size_t offset = (m_BlockOffset + alignment - 1U) & ~(alignment - 1U);
+    if (m_Blocks.empty() || offset + size > m_BlockSize) {
+        m_Blocks.emplace_back(new byte_t[BLOCK_SIZE]);
+        m_BlockSize = BLOCK_SIZE;
+        m_ArenaSize += BLOCK_SIZE;
+        offset = 0U;
+    }
+
+    m_BlockOffset = offset + size;
+    return m_Blocks.back().get() + offset;
+}
+
+/// @brief 공백을 건너뜁니다.
+void JsonDocument::skipWhitespace() noexcept {
+    while (m_Cursor < m_End && (*m_Cursor == ' ' || *m_Cursor == '\n' || *m_Cursor == '\r' || *m_Cursor == '\t')) {
+        ++m_Cursor;
+    }
+}
+
+/// @brief 값을 파싱합니다.
+/// @param value 결과
+/// @param depth 중첩 깊이
+/// @return 성공(true), 실패(false)
+bool JsonDocument::parseValue(JsonValue& value, uint32_t depth) noexcept {
+    skipWhitespace();
+    if (m_Cursor >= m_End) {
+        return false;
+    }
+
+    const auto literal = [&](std::string_view text) noexcept {
+        if (static_cast<size_t>(m_End - m_Cursor) < text.size() || std::memcmp(m_Cursor, text.data(), text.size()) != 0) {
+            return false;
+        }
+        m_Cursor += text.size();
+        return true;
+    };
+
+    value.Count = 0U;
+    switch (*m_Cursor) {
+    case '{':
+        return parseObject(value, depth + 1U);
+    case '[':
+        return parseArray(value, depth + 1U);
+    case '"': {
+        std::string_view text;
+        if (!parseString(text)) {
+            return false;
+        }
+        value.Type = JsonType::String;
+        value.Count = static_cast<uint32_t>(text.size());
+        value.String = text.data();
+        return true;
+    }
+    case 't':
+        value.Type = JsonType::Bool;
+        value.Bool = true;
+        return literal("true");
+    case 'f':
+        value.Type = JsonType::Bool;
+        value.Bool = false;
+        return literal("false");
+    case 'n':
+        value.Type = JsonType::Null;
+        value.Bool = false;
+        return literal("null");
+    default:
+        return parseNumber(value);
+    }
+}
+
+/// @brief 문자열을 파싱합니다.
+/// @param text 결과 (이스케이프가 없으면 원문, 있으면 아레나에 푼 복사본)
+/// @return 성공(true), 실패(false)
+bool JsonDocument::parseString(std::string_view& text) noexcept {
+    const char* begin = ++m_Cursor;
+    const char* end = begin;
+    bool escaped = false;
+    while (end < m_End && *end != '"') {
+        if (*end == '\\') {
+            escaped = true;
+            ++end;
+        }
+        ++end;
+    }
+    if (end >= m_End) {
+        return false;
+    }
+    m_Cursor = end + 1;
+
+    if (!escaped) {
+        text = std::string_view(begin, static_cast<size_t>(end - begin));
+        return true;
+    }
+
+    // 풀린 문자열은 원문보다 길지 않습니다. (\uXXXX 6글자 -> 최대 3바이트, 서로게이트 쌍 12글자 -> 4바이트)
+    char* out = static_cast<char*>(allocate(static_cast<size_t>(end - begin), 1U));
+    char* write = out;
+    for (const char* read = begin; read < end; ++read) {
+        if (*read != '\\') {
+            *write++ = *read;
+            continue;
+        }
+
+        ++read;
+        switch (*read) {
+        case '"':   *write++ = '"';     break;
+        case '\\':  *write++ = '\\';    break;
+        case '/':   *write++ = '/';     break;
+        case 'b':   *write++ = '\b';    break;
+        case 'f':   *write++ = '\f';    break;
+        case 'n':   *write++ = '\n';    break;
+        case 'r':   *write++ = '\r';    break;
+        case 't':   *write++ = '\t';    break;
+        case 'u': {
+            uint32_t codePoint = 0U;
+            if (end - read < 5 || !parseHex4(read + 1, codePoint)) {
+                return false;
+            }
+            read += 4;
+
+            // 서로게이트 쌍
+            if (codePoint >= 0xD800U && codePoint <= 0xDBFFU && end - read >= 7 && read[1] == '\\' && read[2] == 'u') {
+                uint32_t low = 0U;
+                if (parseHex4(read + 3, low) && low >= 0xDC00U && low <= 0xDFFFU) {
+                    codePoint = 0x10000U + ((codePoint - 0xD800U) << 10) + (low - 0xDC00U);
+                    read += 6;
+                }
+            }
+            write += encodeUTF8(codePoint, write);
+            break;
+        }
+        default:
+            return false;
+        }
+    }
+
+    text = std::string_view(out, static_cast<size_t>(write - out));
+    return true;
+}
+
+/// @brief 숫자를 파싱합니다.
+/// @param value 결과
+/// @return 성공(true), 실패(false)
+bool JsonDocument::parseNumber(JsonValue& value) noexcept {
+    double number = 0.0;
+    const std::from_chars_result result = std::from_chars(m_Cursor, m_End, number);
+    if (result.ec != std::errc() || result.ptr == m_Cursor) {
+        return false;
+    }
+
+    m_Cursor = result.ptr;
+    value.Type = JsonType::Number;
+    value.Number = number;
+    return true;
+}
+
+/// @brief 배열을 파싱합니다.
+/// @param value 결과
+/// @param depth 중첩 깊이
+/// @return 성공(true), 실패(false)
+/// @note 요소는 공용 스택에 쌓았다가 배열이 닫히면 개수에 맞게 아레나로 옮깁니다.
+bool JsonDocument::parseArray(JsonValue& value, uint32_t depth) noexcept {
+    if (depth > MAX_DEPTH) {
+        return false;
+    }
+
+    ++m_Cursor;
+    const size_t base = m_ValueStack.size();
+    skipWhitespace();
+    if (m_Cursor < m_End && *m_Cursor == ']') {
+        ++m_Cursor;
+    }
+    else {
+        while (true) {
+            JsonValue item;
+            if (!parseValue(item, depth)) {
+                return false;
+            }
+            m_ValueStack.push_back(item);
+
+            skipWhitespace();
+            if (m_Cursor >= m_End) {
+                return false;
+            }
+            const char c = *m_Cursor++;
+            if (c == ']') {
+                break;
+            }
+            if (c != ',') {
+                return false;
+            }
+        }
+    }
+
+    const size_t count = m_ValueStack.size() - base;
+    JsonValue* items = nullptr;
+    if (count > 0U) {
+        items = static_cast<JsonValue*>(allocate(count * sizeof(JsonValue), alignof(JsonValue)));
+        std::copy(m_ValueStack.begin() + static_cast<ptrdiff_t>(base), m_ValueStack.end(), items);
+        m_ValueStack.resize(base);
+    }
+
+    value.Type = JsonType::Array;
+    value.Count = static_cast<uint32_t>(count);
+    value.Items = items;
+    return true;
+}
+
+/// @brief 객체를 파싱합니다.
+/// @param value 결과
+/// @param depth 중첩 깊이
+/// @return 성공(true), 실패(false)
+bool JsonDocument::parseObject(JsonValue& value, uint32_t depth) noexcept {
+    if (depth > MAX_DEPTH) {
+        return false;
+    }
+
+    ++m_Cursor;
+    const size_t base = m_MemberStack.size();
+    skipWhitespace();
+    if (m_Cursor < m_End && *m_Cursor == '}') {
+        ++m_Cursor;
+    }
+    else {
+        while (true) {
+            JsonMember member;
+            skipWhitespace();
+            if (m_Cursor >= m_End || *m_Cursor != '"' || !parseString(member.Name)) {
+                return false;
+            }
+
+            skipWhitespace();
+            if (m_Cursor >= m_End || *m_Cursor++ != ':') {
+                return false;
+            }
+            if (!parseValue(member.Value, depth)) {
+                return false;
+            }
+            m_MemberStack.push_back(member);
+
+            skipWhitespace();
+            if (m_Cursor >= m_End) {
+                return false;
+            }
+            const char c = *m_Cursor++;
+            if (c == '}') {
+                break;
+            }
+            if (c != ',') {
+                return false;
+            }
+        }
+    }
+
+    const size_t count = m_MemberStack.size() - base;
+    JsonMember* members = nullptr;
+    if (count > 0U) {
+        members = static_cast<JsonMember*>(allocate(count * sizeof(JsonMember), alignof(JsonMember)));
+        std::copy(m_MemberStack.begin() + static_cast<ptrdiff_t>(base), m_MemberStack.end(), members);
+        m_MemberStack.resize(base);
+    }
+
+    value.Type = JsonType::Object;
+    value.Count = static_cast<uint32_t>(count);
+    value.Members = members;
+    return true;
+}
+
+/// @brief JSON 원문을 파싱합니다.
+/// @param text 원문 (UTF-8, 널 문자로 끝나지 않아도 됨, 문서보다 오래 살아있어야 함)
+/// @param size 원문 크기
+/// @return 성공(true), 실패(false: 문서는 비워짐)
+bool JsonDocument::Parse(const char* text, size_t size) noexcept {
+    Clear();
+    m_Cursor = text;
+    m_End = text + size;
+
+    JsonValue root;
+    bool succeeded = parseValue(root, 0U);
+    skipWhitespace();
+    succeeded = succeeded && (m_Cursor == m_End);
+
+    m_ValueStack.clear();
+    m_MemberStack.clear();
+    m_Cursor = m_End = nullptr;
+    if (!succeeded) {
+        Clear();
+        return false;
+    }
+
+    m_Root = root;
+    return true;
+}
+
+/// @brief 문서를 비웁니다.
+void JsonDocument::Clear() noexcept {
+    m_Blocks.clear();
+    m_BlockOffset = 0U;
+    m_BlockSize = 0U;
+    m_ArenaSize = 0U;
+    m_Root = JsonValue::GetNull();
+}
\ No newline at end of file
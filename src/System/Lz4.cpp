@@ -0,0 +1,266 @@
+#include "System/Lz4.hpp"
+#include <cstddef>
+#include <cstring>
+
+using namespace system;
+
+namespace {
+    constexpr size_t MIN_MATCH          = 4U;           ///< 최소 일치 길이
+    constexpr size_t LAST_LITERALS      = 5U;           ///< 블록 끝에 반드시 남겨야 하는 리터럴 수
+    constexpr size_t MATCH_FIND_LIMIT   = 12U;          ///< 마지막 일치가 시작할 수 있는 블록 끝까지의 최소 거리
+    constexpr size_t MAX_OFFSET         = 65535U;       ///< 최대 일치 거리
+    constexpr uint32_t HASH_BITS        = 12U;          ///< 해시 테이블 크기 (비트 단위, 16KB)
+    constexpr uint32_t SKIP_TRIGGER     = 6U;           ///< 일치 실패가 2^n번 쌓일 때마다 탐색 간격을 1씩 늘림
+    constexpr size_t WILD_COPY          = 16U;          ///< 해제할 때 한 번에 복사하는 크기 (끝에서 이만큼 여유가 있으면 넘쳐서 복사)
+
+    /// @brief 4바이트를 읽습니다.
+    /// @param p 위치
+    /// @return 값
+    inline uint32_t read32(const byte_t* p) noexcept {
+        uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    /// @brief 4바이트 시퀀스의 해시를 계산합니다.
+    /// @param p 위치
+    /// @return 해시 테이블 인덱스
+    inline uint32_t hashSequence(const byte_t* p) noexcept {
+        return (read32(p) * 2654435761U) >> (32U - HASH_BITS);
+    }
+
+    /// @brief WILD_COPY 단위로 복사합니다.
+    /// @param destination 결과
+    /// @param source 원본 (destination보다 WILD_COPY 이상 앞이거나 겹치지 않아야 함)
+    /// @param size 크기
+    /// @note 끝을 WILD_COPY 단위로 올려서 복사하므로, 양쪽 모두 size + WILD_COPY까지 접근할 수 있어야 합니다.
+    ///       짧은 리터럴과 일치가 대부분이라 가변 길이 memcpy 호출보다 고정 크기 복사 몇 번이 훨씬 빠릅니다.
+    inline void wildCopy(byte_t* destination, const byte_t* source, size_t size) noexcept {
+        byte_t* const end = destination + size;
+        do {
+            std::memcpy(destination, source, WILD_COPY);
+            destination += WILD_COPY;
+            source += WILD_COPY;
+        } while (destination < end);
+    }
+
+    /// @brief 15 이상인 길이의 나머지를 255 단위로 기록합니다.
+    /// @param op 기록 위치 (기록한 뒤로 이동)
+    /// @param length 토큰에 담고 남은 길이
+    inline void writeLength(byte_t*& op, size_t length) noexcept {
+        while (length >= 255U) {
+            *op++ = 255U;
+            length -= 255U;
+        }
+        *op++ = static_cast<byte_t>(length);
+    }
+
+    /// @brief 15 이상인 길이의 나머지를 읽습니다.
+    /// @param ip 읽을 위치 (읽은 뒤로 이동)
+    /// @param end 입력 끝
+    /// @param length 더할 길이
+    /// @return 성공(true), 입력이 끝남(false)
+    inline bool readLength(const byte_t*& ip, const byte_t* end, size_t& length) noexcept {
+        byte_t value;
+        do {
+            if (ip >= end) {
+                return false;
+            }
+            value = *ip++;
+            length += value;
+        } while (value == 255U);
+        return true;
+    }
+
+    /// @brief 시퀀스(리터럴 + 일치) 하나를 기록합니다.
+    /// @param op 기록 위치 (기록한 뒤로 이동)
+    /// @param end 출력 끝
+    /// @param literals 리터럴 시작
+    /// @param literalLength 리터럴 길이
+    /// @param offset 일치 거리 (0이면 리터럴만 기록하는 마지막 시퀀스)
+    /// @param matchLength 일치 길이 - MIN_MATCH
+    /// @return 성공(true), 출력 공간 부족(false)
+    bool writeSequence(byte_t*& op, const byte_t* end, const byte_t* literals, size_t literalLength, size_t offset, size_t matchLength) noexcept {
+        const size_t required = 1U + literalLength + (literalLength / 255U) + 1U + ((offset != 0U) ? 2U + (matchLength / 255U) + 1U : 0U);
+        if (required > static_cast<size_t>(end - op)) {
+            return false;
+        }
+
+        byte_t* token = op++;
+        *token = static_cast<byte_t>(((literalLength < 15U) ? literalLength : 15U) << 4);
+        if (literalLength >= 15U) {
+            writeLength(op, literalLength - 15U);
+        }
+        if (literalLength != 0U) {
+            std::memcpy(op, literals, literalLength);
+            op += literalLength;
+        }
+
+        if (offset != 0U) {
+            *op++ = static_cast<byte_t>(offset & 0xFFU);
+            *op++ = static_cast<byte_t>(offset >> 8);
+            *token |= static_cast<byte_t>((matchLength < 15U) ? matchLength : 15U);
+            if (matchLength >= 15U) {
+                writeLength(op, matchLength - 15U);
+            }
+        }
+        return true;
+    }
+}
+
+/// @brief 압축 결과의 최대 크기를 취득합니다.
+/// @param size 원본 크기
+/// @return 최대 크기 (압축되지 않는 데이터 기준)
+size_t Lz4::GetMaxCompressedSize(size_t size) noexcept {
+    return size + (size / 255U) + 16U;
+}
+
+/// @brief 압축합니다.
+/// @param source 원본
+/// @param size 원본 크기
+/// @param destination 결과
+/// @param capacity 결과 공간 크기
+/// @return 압축된 크기 (0: 공간 부족)
+/// @note 공간을 원본보다 작게 주면 충분히 줄어들지 않는 데이터는 0을 반환하므로, 그대로 보관할지 바로 판단할 수 있습니다.
+size_t Lz4::Compress(const void* source, size_t size, void* destination, size_t capacity) noexcept {
+    const byte_t* const begin = static_cast<const byte_t*>(source);
+    const byte_t* const end = begin + size;
+    byte_t* op = static_cast<byte_t*>(destination);
+    const byte_t* const opEnd = op + capacity;
+    const byte_t* anchor = begin;
+
+    if (size > MATCH_FIND_LIMIT) {
+        const byte_t* const matchLimit = end - LAST_LITERALS;
+        const byte_t* const findLimit = end - MATCH_FIND_LIMIT;
+
+        // 위치는 블록 시작 기준이며, 0으로 초기화된 칸은 후보 비교에서 걸러집니다.
+        uint32_t table[1U << HASH_BITS] = {};
+        const byte_t* ip = begin + 1;
+        uint32_t misses = 0U;
+
+        while (ip <= findLimit) {
+            const uint32_t hash = hashSequence(ip);
+            const byte_t* match = begin + table[hash];
+            table[hash] = static_cast<uint32_t>(ip - begin);
+
+            if (match >= ip || static_cast<size_t>(ip - match) > MAX_OFFSET || read32(match) != read32(ip)) {
+                ip += 1U + (misses++ >> SKIP_TRIGGER);
+                continue;
+            }
+            misses = 0U;
+
+            // 앞쪽으로 일치를 넓힘
+            while (ip > anchor && match > begin && ip[-1] == match[-1]) {
+                --ip;
+                --match;
+            }
+
+            // 뒤쪽으로 일치를 넓힘
+            const byte_t* matchEnd = ip + MIN_MATCH;
+            const byte_t* reference = match + MIN_MATCH;
+            while (matchEnd < matchLimit && *matchEnd == *reference) {
+                ++matchEnd;
+                ++reference;
+            }
+
+            if (!writeSequence(op, opEnd, anchor, static_cast<size_t>(ip - anchor), static_cast<size_t>(ip - match), static_cast<size_t>(matchEnd - ip) - MIN_MATCH)) {
+                return 0U;
+            }
+
+            // 일치 직전 위치도 등록해서 다음 탐색의 후보를 늘림
+            ip = matchEnd;
+            anchor = ip;
+            if (ip <= findLimit) {
+                table[hashSequence(ip - 2)] = static_cast<uint32_t>(ip - 2 - begin);
+            }
+        }
+    }
+
+    if (!writeSequence(op, opEnd, anchor, static_cast<size_t>(end - anchor), 0U, 0U)) {
+        return 0U;
+    }
+    return static_cast<size_t>(op - static_cast<byte_t*>(destination));
+}
+
+/// @brief 압축을 해제합니다.
+/// @param source 압축된 데이터
+/// @param size 압축된 크기
+/// @param destination 결과
+/// @param originalSize 원본 크기 (결과 공간 크기)
+/// @return 성공(true), 실패(false: 손상되었거나 크기가 맞지 않음)
+bool Lz4::Decompress(const void* source, size_t size, void* destination, size_t originalSize) noexcept {
+    const byte_t* ip = static_cast<const byte_t*>(source);
+    const byte_t* const ipEnd = ip + size;
+    byte_t* const begin = static_cast<byte_t*>(destination);
+    byte_t* op = begin;
+    byte_t* const opEnd = begin + originalSize;
+
+    while (ip < ipEnd) {
+        const byte_t token = *ip++;
+
+        // 리터럴
+        size_t literalLength = token >> 4;
+        if (literalLength == 15U && !readLength(ip, ipEnd, literalLength)) {
+            return false;
+        }
+        if (literalLength > static_cast<size_t>(ipEnd - ip) || literalLength > static_cast<size_t>(opEnd - op)) {
+            return false;
+        }
+        if ((ipEnd - ip) >= static_cast<ptrdiff_t>(literalLength + WILD_COPY) && (opEnd - op) >= static_cast<ptrdiff_t>(literalLength + WILD_COPY)) {
+            wildCopy(op, ip, literalLength);
+        } else if (literalLength != 0U) {
+            std::memcpy(op, ip, literalLength);
+        }
+        ip += literalLength;
+        op += literalLength;
+
+        // 마지막 시퀀스는 리터럴만 가짐
+        if (ip == ipEnd) {
+            break;
+        }
+
+        // 일치
+        if ((ipEnd - ip) < 2) {
+            return false;
+        }
+        const size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+        if (offset == 0U || offset > static_cast<size_t>(op - begin)) {
+            return false;
+        }
+
+        size_t matchLength = token & 0x0FU;
+        if (matchLength == 15U && !readLength(ip, ipEnd, matchLength)) {
+            return false;
+        }
+        matchLength += MIN_MATCH;
+        if (matchLength > static_cast<size_t>(opEnd - op)) {
+            return false;
+        }
+
+        // 겹치는 복사는 거리 단위로 나눠서 반복 (거리가 짧으면 같은 패턴이 이어지는 구간)
+        const byte_t* match = op - offset;
+        if (offset >= WILD_COPY && (opEnd - op) >= static_cast<ptrdiff_t>(matchLength + WILD_COPY)) {
+            wildCopy(op, match, matchLength);
+            op += matchLength;
+        } else if (offset >= matchLength) {
+            std::memcpy(op, match, matchLength);
+            op += matchLength;
+        } else if (offset >= 8U) {
+            byte_t* const matchEnd = op + matchLength;
+            while ((matchEnd - op) >= 8) {
+                std::memcpy(op, match, 8U);
+                op += 8;
+                match += 8;
+            }
+            while (op < matchEnd) {
+                *op++ = *match++;
+            }
+        } else {
+            for (size_t i = 0U; i < matchLength; ++i) {
+                *op++ = *match++;
+            }
+        }
+    }
+    return op == opEnd;
+}
\ No newline at end of file
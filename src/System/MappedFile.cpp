@@ -0,0 +1,122 @@
+#include "System/MappedFile.hpp"
+#include <utility>
+
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+using namespace system;
+
+/// @brief 생성자
+MappedFile::MappedFile() noexcept : m_Data(nullptr), m_Size(0U), m_Handle(nullptr) {
+
+}
+
+/// @brief 이동 생성자
+/// @param other 원본 (닫힌 상태가 됨)
+MappedFile::MappedFile(MappedFile&& other) noexcept :
+    m_Data(std::exchange(other.m_Data, nullptr)),
+    m_Size(std::exchange(other.m_Size, 0U)),
+    m_Handle(std::exchange(other.m_Handle, nullptr)) {
+}
+
+/// @brief 소멸자
+MappedFile::~MappedFile() noexcept {
+    Close();
+}
+
+/// @brief 파일을 읽기 전용으로 매핑합니다.
+/// @param path 파일 경로
+/// @return 성공(true), 실패(false: 파일이 없거나 비어있음)
+bool MappedFile::Open(const std::string& path) noexcept {
+    Close();
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER size = {};
+    if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    // 매핑 객체가 파일을 참조하므로 파일 핸들은 바로 닫아도 됩니다.
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) {
+        return false;
+    }
+
+    const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    m_Data      = static_cast<const byte_t*>(view);
+    m_Size      = static_cast<size_t>(size.QuadPart);
+    m_Handle    = mapping;
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info = {};
+    if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+
+    // 매핑이 파일을 참조하므로 파일 기술자는 바로 닫아도 됩니다.
+    void* view = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED) {
+        return false;
+    }
+
+    m_Data = static_cast<const byte_t*>(view);
+    m_Size = static_cast<size_t>(info.st_size);
+#endif
+
+    return true;
+}
+
+/// @brief 매핑을 해제합니다.
+void MappedFile::Close() noexcept {
+    if (!m_Data) {
+        return;
+    }
+
+#if defined(_WIN32)
+    UnmapViewOfFile(m_Data);
+    CloseHandle(static_cast<HANDLE>(m_Handle));
+#else
+    ::munmap(const_cast<byte_t*>(m_Data), m_Size);
+#endif
+
+    m_Data      = nullptr;
+    m_Size      = 0U;
+    m_Handle    = nullptr;
+}
+
+/// @brief 이동 대입 연산자
+/// @param other 원본 (닫힌 상태가 됨)
+/// @return 자기 자신
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        m_Data      = std::exchange(other.m_Data, nullptr);
+        m_Size      = std::exchange(other.m_Size, 0U);
+        m_Handle    = std::exchange(other.m_Handle, nullptr);
+    }
+    return *this;
+}
\ No newline at end of file
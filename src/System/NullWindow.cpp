@@ -0,0 +1,74 @@
+#include "System/NullWindow.hpp"
+
+using namespace system;
+
+/// @brief 기본 생성자
+NullWindow::NullWindow() noexcept {
+    m_Width         = 0;
+    m_Height        = 0;
+    m_QuitRequested = false;
+}
+
+/// @brief 소멸자
+NullWindow::~NullWindow() noexcept {
+
+}
+
+/// @brief 윈도우를 생성합니다.
+/// @param title 타이틀 (무시)
+/// @param width 너비
+/// @param height 높이
+/// @param fullscreenEnabled 전체화면 활성화 유무 (무시)
+/// @return 성공(true), 실패(false)
+bool NullWindow::Create(const char*, int32_t width, int32_t height, bool) noexcept {
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+
+    m_Width         = width;
+    m_Height        = height;
+    m_QuitRequested = false;
+
+    return true;
+}
+
+/// @brief 윈도우를 표시합니다.
+void NullWindow::Show() noexcept {
+
+}
+
+/// @brief 윈도우를 닫습니다.
+/// @note 다음 ProcessMessages 호출에서 루프가 종료됩니다.
+void NullWindow::Close() noexcept {
+    m_QuitRequested = true;
+}
+
+/// @brief 대기 중인 메시지를 처리합니다.
+/// @return 계속(true), 종료(false)
+bool NullWindow::ProcessMessages() noexcept {
+    return !m_QuitRequested;
+}
+
+/// @brief 윈도우의 좌표를 설정합니다.
+void NullWindow::SetPosition(int32_t, int32_t) noexcept {
+
+}
+
+/// @brief 윈도우의 크기를 설정합니다.
+/// @param width 너비
+/// @param height 높이
+void NullWindow::SetSize(int32_t width, int32_t height) noexcept {
+    m_Width     = width;
+    m_Height    = height;
+}
+
+/// @brief 윈도우의 타이틀을 설정합니다.
+void NullWindow::SetTitle(const char*) noexcept {
+
+}
+
+/// @brief 네이티브 핸들을 취득합니다.
+/// @return 항상 nullptr
+void* NullWindow::GetNativeHandle() const noexcept {
+    return nullptr;
+}
\ No newline at end of file
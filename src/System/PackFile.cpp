@@ -0,0 +1,450 @@
+#include "System/PackFile.hpp"
+#include "System/Lz4.hpp"
+#include "Type/Hash.hpp"
+#include <algorithm>
+#include <cstring>
+
+using namespace system;
+
+namespace {
+    constexpr byte_t s_Padding[PackFile::DATA_ALIGNMENT] = {};     ///< 정렬용 0 바이트
+
+    /// @brief 정렬 단위로 올림합니다.
+    /// @param value 값
+    /// @param alignment 정렬 단위 (2의 거듭제곱)
+    /// @return 정렬된 값
+    inline uint64_t alignUp(uint64_t value, uint64_t alignment) noexcept {
+        return (value + alignment - 1U) & ~(alignment - 1U);
+    }
+
+    /// @brief 파일의 청크 수를 계산합니다.
+    /// @param size 원본 크기
+    /// @return 청크 수
+    inline uint64_t getChunkCount(uint64_t size) noexcept {
+        return (size + PackFile::CHUNK_SIZE - 1U) / PackFile::CHUNK_SIZE;
+    }
+
+    /// @brief 범위가 파일 안에 있는지 확인합니다.
+    /// @param offset 위치
+    /// @param size 크기
+    /// @param fileSize 파일 크기
+    /// @return 안에 있음(true), 벗어남(false)
+    inline bool isInRange(uint64_t offset, uint64_t size, uint64_t fileSize) noexcept {
+        return offset <= fileSize && size <= fileSize - offset;
+    }
+}
+
+/// @brief 생성자
+PackFile::PackFile() noexcept : m_Entries(nullptr), m_Chunks(nullptr), m_Names(nullptr), m_EntryCount(0U) {
+
+}
+
+/// @brief 디렉터리 전체를 검증합니다.
+/// @param header 헤더
+/// @return 유효(true), 무효(false)
+/// @note 열 때 한 번만 검사하므로, 이후 Find와 Read는 범위 검사 없이 항목을 그대로 믿습니다.
+bool PackFile::validate(const PackHeader& header) const noexcept {
+    const uint64_t fileSize = m_File.GetSize();
+    for (uint32_t i = 0U; i < header.EntryCount; ++i) {
+        const PackEntry& entry = m_Entries[i];
+        if (i != 0U && m_Entries[i - 1U].PathHash >= entry.PathHash) {
+            return false;
+        }
+        if (entry.NameOffset >= header.NameSize || entry.PackedSize > entry.Size || !isInRange(entry.Offset, entry.PackedSize, fileSize)) {
+            return false;
+        }
+        if (entry.PackedSize == entry.Size) {
+            continue;
+        }
+
+        // 압축된 파일은 청크 크기 합이 기록된 크기와 같아야 함
+        const uint64_t chunkCount = getChunkCount(entry.Size);
+        if (!isInRange(entry.FirstChunk, chunkCount, header.ChunkCount)) {
+            return false;
+        }
+        uint64_t packedSize = 0ULL;
+        for (uint64_t c = 0U; c < chunkCount; ++c) {
+            const uint32_t chunk = m_Chunks[entry.FirstChunk + c];
+            const uint32_t size = chunk & ~CHUNK_RAW;
+            const uint64_t originalSize = std::min<uint64_t>(CHUNK_SIZE, entry.Size - c * CHUNK_SIZE);
+            if ((chunk & CHUNK_RAW) ? (size != originalSize) : (size > originalSize)) {
+                return false;
+            }
+            packedSize += size;
+        }
+        if (packedSize != entry.PackedSize) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief 팩 파일을 엽니다.
+/// @param path 팩 파일 경로
+/// @return 성공(true), 실패(false: 파일이 없거나 손상됨)
+bool PackFile::Open(const std::string& path) noexcept {
+    Close();
+
+    PackHeader header;
+    if (!m_File.Open(path) || !ReadHeader(m_File.GetData(), m_File.GetSize(), header)) {
+        Close();
+        return false;
+    }
+
+    m_Entries       = reinterpret_cast<const PackEntry*>(m_File.GetData() + header.EntryOffset);
+    m_Chunks        = reinterpret_cast<const uint32_t*>(m_File.GetData() + header.ChunkOffset);
+    m_Names         = reinterpret_cast<const char*>(m_File.GetData() + header.NameOffset);
+    m_EntryCount    = header.EntryCount;
+    if (!validate(header)) {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+/// @brief 팩 파일을 닫습니다.
+/// @note 이전에 GetStoredData로 얻은 포인터는 모두 무효가 됩니다.
+void PackFile::Close() noexcept {
+    m_File.Close();
+    m_Entries       = nullptr;
+    m_Chunks        = nullptr;
+    m_Names         = nullptr;
+    m_EntryCount    = 0U;
+}
+
+/// @brief 경로 해시로 항목을 찾습니다.
+/// @param pathHash 경로 해시 (GetPathHash)
+/// @return 항목 (없으면 nullptr)
+const PackEntry* PackFile::Find(uint64_t pathHash) const noexcept {
+    const PackEntry* end = m_Entries + m_EntryCount;
+    const PackEntry* entry = std::lower_bound(m_Entries, end, pathHash, [](const PackEntry& e, uint64_t hash) { return e.PathHash < hash; });
+    return (entry != end && entry->PathHash == pathHash) ? entry : nullptr;
+}
+
+/// @brief 경로로 항목을 찾습니다.
+/// @param path 경로 (대소문자, 구분자 종류 무시)
+/// @return 항목 (없으면 nullptr)
+/// @note 해시가 같은 다른 경로를 돌려주지 않도록 저장된 경로와 한 번 더 비교합니다.
+const PackEntry* PackFile::Find(std::string_view path) const noexcept {
+    char normalized[MAX_PATH_LENGTH];
+    const size_t length = NormalizePath(path, normalized);
+    if (length == 0U) {
+        return nullptr;
+    }
+
+    const PackEntry* entry = Find(Hash64(normalized, length));
+    if (!entry || GetPath(*entry) != std::string_view(normalized, length)) {
+        return nullptr;
+    }
+    return entry;
+}
+
+/// @brief 항목의 경로를 취득합니다.
+/// @param entry 항목
+/// @return 정규화된 경로
+std::string_view PackFile::GetPath(const PackEntry& entry) const noexcept {
+    return m_Names + entry.NameOffset;
+}
+
+/// @brief 압축하지 않고 보관된 항목의 데이터를 취득합니다.
+/// @param entry 항목
+/// @return 매핑된 데이터 (압축된 항목이면 nullptr)
+/// @note 팩이 열려 있는 동안 유효하며, DATA_ALIGNMENT로 정렬되어 있습니다.
+const byte_t* PackFile::GetStoredData(const PackEntry& entry) const noexcept {
+    return (entry.PackedSize == entry.Size) ? m_File.GetData() + entry.Offset : nullptr;
+}
+
+/// @brief 항목의 내용을 읽습니다.
+/// @param entry 항목
+/// @param destination 결과 (entry.Size 바이트)
+/// @return 성공(true), 실패(false: 압축된 데이터가 손상됨)
+bool PackFile::Read(const PackEntry& entry, void* destination) const noexcept {
+    const byte_t* source = m_File.GetData() + entry.Offset;
+    if (entry.PackedSize == entry.Size) {
+        if (entry.Size != 0U) {
+            std::memcpy(destination, source, static_cast<size_t>(entry.Size));
+        }
+        return true;
+    }
+
+    byte_t* output = static_cast<byte_t*>(destination);
+    const uint32_t* chunks = m_Chunks + entry.FirstChunk;
+    for (uint64_t offset = 0U; offset < entry.Size; offset += CHUNK_SIZE) {
+        const uint32_t chunk = *chunks++;
+        const size_t packedSize = chunk & ~CHUNK_RAW;
+        const size_t originalSize = static_cast<size_t>(std::min<uint64_t>(CHUNK_SIZE, entry.Size - offset));
+        if (chunk & CHUNK_RAW) {
+            std::memcpy(output + offset, source, originalSize);
+        } else if (!Lz4::Decompress(source, packedSize, output + offset, originalSize)) {
+            return false;
+        }
+        source += packedSize;
+    }
+    return true;
+}
+
+/// @brief 팩 파일 헤더를 검증하고 읽습니다.
+/// @param data 팩 파일 내용
+/// @param size 팩 파일 크기
+/// @param header 결과
+/// @return 유효(true), 무효(false)
+bool PackFile::ReadHeader(const void* data, size_t size, PackHeader& header) noexcept {
+    if (!data || size < sizeof(PackHeader)) {
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(PackHeader));
+
+    if (header.Magic != MAGIC || header.Version != VERSION || header.ChunkSize != CHUNK_SIZE) {
+        return false;
+    }
+    if ((header.EntryOffset % alignof(PackEntry)) != 0U || (header.ChunkOffset % alignof(uint32_t)) != 0U) {
+        return false;
+    }
+    if (!isInRange(header.EntryOffset, static_cast<uint64_t>(header.EntryCount) * sizeof(PackEntry), size) ||
+        !isInRange(header.ChunkOffset, static_cast<uint64_t>(header.ChunkCount) * sizeof(uint32_t), size) ||
+        !isInRange(header.NameOffset, header.NameSize, size)) {
+        return false;
+    }
+
+    // 경로 문자열 테이블은 널 문자로 끝나야 함
+    const char* names = static_cast<const char*>(data) + header.NameOffset;
+    return header.NameSize == 0U || names[header.NameSize - 1U] == '\0';
+}
+
+/// @brief 경로를 정규화합니다.
+/// @param path 경로
+/// @param destination 결과 (MAX_PATH_LENGTH 바이트 이상)
+/// @return 결과 길이 (0: 비어있거나 너무 김)
+/// @note 원본 게임 자산은 Windows 경로이므로, 구분자를 '/'로 통일하고 ASCII 대문자를 소문자로 바꾸며
+///       앞쪽의 "./"와 연속된 구분자를 제거합니다.
+size_t PackFile::NormalizePath(std::string_view path, char* destination) noexcept {
+    size_t length = 0U;
+    size_t i = 0U;
+    while (i < path.size()) {
+        if (path[i] == '/' || path[i] == '\\') {
+            ++i;
+        } else if (path[i] == '.' && (i + 1U) < path.size() && (path[i + 1U] == '/' || path[i + 1U] == '\\')) {
+            i += 2U;
+        } else {
+            break;
+        }
+    }
+
+    for (; i < path.size(); ++i) {
+        char c = path[i];
+        if (c == '\\') {
+            c = '/';
+        } else if (c >= 'A' && c <= 'Z') {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+        if (c == '/' && length != 0U && destination[length - 1U] == '/') {
+            continue;
+        }
+        if (length >= (MAX_PATH_LENGTH - 1U)) {
+            return 0U;
+        }
+        destination[length++] = c;
+    }
+    return length;
+}
+
+/// @brief 경로 해시를 계산합니다.
+/// @param path 경로 (NormalizePath로 정규화한 뒤 해시)
+/// @return 경로 해시 (정규화할 수 없는 경로는 0)
+uint64_t PackFile::GetPathHash(std::string_view path) noexcept {
+    char normalized[MAX_PATH_LENGTH];
+    const size_t length = NormalizePath(path, normalized);
+    return (length != 0U) ? Hash64(normalized, length) : 0ULL;
+}
+
+/// @brief 생성자
+PackWriter::PackWriter() noexcept : m_Offset(0ULL) {
+
+}
+
+/// @brief 데이터를 기록하고 DATA_ALIGNMENT까지 0으로 채웁니다.
+/// @param data 데이터
+/// @param size 크기
+/// @return 성공(true), 실패(false)
+bool PackWriter::writePadded(const void* data, size_t size) noexcept {
+    const uint64_t end = alignUp(m_Offset + size, PackFile::DATA_ALIGNMENT);
+    if (size != 0U && !m_File.write(static_cast<const char*>(data), static_cast<std::streamsize>(size))) {
+        return false;
+    }
+    if (!m_File.write(reinterpret_cast<const char*>(s_Padding), static_cast<std::streamsize>(end - m_Offset - size))) {
+        return false;
+    }
+    m_Offset = end;
+    return true;
+}
+
+/// @brief 이미 기록한 파일의 데이터가 내용과 같은지 비교합니다.
+/// @param source 기록한 파일 (Size가 내용 크기와 같아야 함)
+/// @param data 내용
+/// @return 같음(true), 다름 또는 읽기 실패(false)
+/// @note 기록한 데이터를 청크 단위로 다시 읽어 비교하므로 해시가 충돌해도 다른 내용을 공유하지 않습니다. 끝나면 기록 위치를 끝으로 되돌립니다.
+bool PackWriter::matches(const PackEntry& source, const void* data) noexcept {
+    const byte_t* input = static_cast<const byte_t*>(data);
+    const bool stored = (source.PackedSize == source.Size);
+    m_Buffer.resize(Lz4::GetMaxCompressedSize(PackFile::CHUNK_SIZE));
+    m_CompareBuffer.resize(PackFile::CHUNK_SIZE);
+
+    m_File.flush();
+    bool result = static_cast<bool>(m_File.seekg(static_cast<std::streamoff>(source.Offset)));
+    uint32_t chunk = source.FirstChunk;
+    for (uint64_t offset = 0U; result && offset < source.Size; offset += PackFile::CHUNK_SIZE) {
+        const size_t chunkSize = static_cast<size_t>(std::min<uint64_t>(PackFile::CHUNK_SIZE, source.Size - offset));
+        const uint32_t packed = stored ? (static_cast<uint32_t>(chunkSize) | PackFile::CHUNK_RAW) : m_Chunks[chunk++];
+        const size_t packedSize = packed & ~PackFile::CHUNK_RAW;
+
+        result = static_cast<bool>(m_File.read(reinterpret_cast<char*>(m_Buffer.data()), static_cast<std::streamsize>(packedSize)));
+        if (result && (packed & PackFile::CHUNK_RAW)) {
+            result = std::memcmp(m_Buffer.data(), input + offset, chunkSize) == 0;
+        } else if (result) {
+            result = Lz4::Decompress(m_Buffer.data(), packedSize, m_CompareBuffer.data(), chunkSize) && std::memcmp(m_CompareBuffer.data(), input + offset, chunkSize) == 0;
+        }
+    }
+
+    // 읽기 실패 상태를 지우고 기록 위치를 되돌림 (되돌리지 못하면 이후 기록이 실패함)
+    m_File.clear();
+    m_File.seekp(static_cast<std::streamoff>(m_Offset));
+    return result;
+}
+
+/// @brief 팩 파일 기록을 시작합니다.
+/// @param path 팩 파일 경로 (있으면 덮어씀)
+/// @return 성공(true), 실패(false)
+bool PackWriter::Create(const std::string& path) noexcept {
+    m_File.close();
+    m_File.clear();
+    m_File.open(path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    m_Entries.clear();
+    m_Chunks.clear();
+    m_Names.clear();
+    m_PathIndex.clear();
+    m_ContentIndex.clear();
+    m_Offset = 0ULL;
+    m_Stats = {};
+    if (!m_File) {
+        return false;
+    }
+
+    // 헤더 자리는 0으로 비워두고 Finish에서 기록
+    const PackHeader header = {};
+    return writePadded(&header, sizeof(header));
+}
+
+/// @brief 파일을 추가합니다.
+/// @param path 경로 (팩 안에서 찾을 이름, 정규화되어 저장)
+/// @param data 내용
+/// @param size 크기
+/// @param compress 압축 여부 (압축해도 줄어들지 않는 청크는 그대로 보관)
+/// @return 성공(true), 실패(false: 경로가 무효이거나 이미 있음, 기록 실패)
+/// @note 내용이 이미 추가한 파일과 같으면 데이터를 다시 기록하지 않고 그 파일의 데이터를 공유합니다.
+///       내용 해시와 크기가 같은 후보는 기록된 데이터를 다시 읽어 바이트 단위로 비교한 뒤에만 공유합니다.
+bool PackWriter::Add(std::string_view path, const void* data, size_t size, bool compress) noexcept {
+    char normalized[PackFile::MAX_PATH_LENGTH];
+    const size_t length = PackFile::NormalizePath(path, normalized);
+    if (length == 0U || !m_File.is_open()) {
+        return false;
+    }
+
+    PackEntry entry = {};
+    entry.PathHash      = Hash64(normalized, length);
+    entry.ContentHash   = Hash64(data, size);
+    entry.Size          = size;
+    entry.NameOffset    = static_cast<uint32_t>(m_Names.size());
+    if (m_PathIndex.find(entry.PathHash) != m_PathIndex.end()) {
+        return false;
+    }
+
+    const PackEntry* shared = nullptr;
+    const auto [first, last] = m_ContentIndex.equal_range(entry.ContentHash);
+    for (auto candidate = first; candidate != last && !shared; ++candidate) {
+        const PackEntry& source = m_Entries[candidate->second];
+        shared = (source.Size == size && matches(source, data)) ? &source : nullptr;
+    }
+
+    if (shared) {
+        entry.Offset        = shared->Offset;
+        entry.PackedSize    = shared->PackedSize;
+        entry.FirstChunk    = shared->FirstChunk;
+        ++m_Stats.DuplicateCount;
+    } else {
+        entry.Offset        = m_Offset;
+        entry.FirstChunk    = static_cast<uint32_t>(m_Chunks.size());
+
+        // 청크마다 1/8 이상 줄어들 때만 압축본을 기록하고, 아니면 원본 그대로 기록
+        const byte_t* input = static_cast<const byte_t*>(data);
+        bool compressed = false;
+        for (size_t offset = 0U; offset < size; offset += PackFile::CHUNK_SIZE) {
+            const size_t chunkSize = std::min<size_t>(PackFile::CHUNK_SIZE, size - offset);
+            size_t packedSize = 0U;
+            if (compress) {
+                m_Buffer.resize(Lz4::GetMaxCompressedSize(PackFile::CHUNK_SIZE));
+                packedSize = Lz4::Compress(input + offset, chunkSize, m_Buffer.data(), chunkSize - chunkSize / 8U);
+            }
+
+            const bool raw = (packedSize == 0U);
+            const char* chunkData = raw ? reinterpret_cast<const char*>(input + offset) : reinterpret_cast<const char*>(m_Buffer.data());
+            const size_t chunkBytes = raw ? chunkSize : packedSize;
+            if (!m_File.write(chunkData, static_cast<std::streamsize>(chunkBytes))) {
+                return false;
+            }
+            m_Chunks.push_back(raw ? (static_cast<uint32_t>(chunkSize) | PackFile::CHUNK_RAW) : static_cast<uint32_t>(packedSize));
+            m_Offset += chunkBytes;
+            entry.PackedSize += chunkBytes;
+            compressed |= !raw;
+        }
+
+        // 모든 청크를 그대로 기록했으면 기록된 내용이 원본과 같으므로 압축하지 않은 파일로 취급 (매핑된 데이터를 바로 사용)
+        if (!compressed) {
+            m_Chunks.resize(entry.FirstChunk);
+            entry.FirstChunk = 0U;
+            ++m_Stats.StoredCount;
+        }
+        if (!writePadded(nullptr, 0U)) {
+            return false;
+        }
+        m_Stats.PackedBytes += entry.PackedSize;
+        m_ContentIndex.emplace(entry.ContentHash, static_cast<uint32_t>(m_Entries.size()));
+    }
+
+    m_Names.append(normalized, length);
+    m_Names.push_back('\0');
+    m_PathIndex.emplace(entry.PathHash, static_cast<uint32_t>(m_Entries.size()));
+    m_Entries.push_back(entry);
+    ++m_Stats.FileCount;
+    m_Stats.SourceBytes += size;
+    return true;
+}
+
+/// @brief 디렉터리와 헤더를 기록하고 팩 파일을 닫습니다.
+/// @return 성공(true), 실패(false)
+bool PackWriter::Finish() noexcept {
+    if (!m_File.is_open()) {
+        return false;
+    }
+
+    std::sort(m_Entries.begin(), m_Entries.end(), [](const PackEntry& a, const PackEntry& b) { return a.PathHash < b.PathHash; });
+
+    PackHeader header = {};
+    header.Magic        = PackFile::MAGIC;
+    header.Version      = PackFile::VERSION;
+    header.EntryCount   = static_cast<uint32_t>(m_Entries.size());
+    header.ChunkCount   = static_cast<uint32_t>(m_Chunks.size());
+    header.ChunkSize    = PackFile::CHUNK_SIZE;
+    header.NameSize     = static_cast<uint32_t>(m_Names.size());
+
+    header.EntryOffset = m_Offset;
+    bool result = writePadded(m_Entries.data(), m_Entries.size() * sizeof(PackEntry));
+    header.ChunkOffset = m_Offset;
+    result = result && writePadded(m_Chunks.data(), m_Chunks.size() * sizeof(uint32_t));
+    header.NameOffset = m_Offset;
+    result = result && writePadded(m_Names.data(), m_Names.size());
+
+    // 모든 내용을 기록한 뒤 헤더를 기록하므로, 중간에 실패한 팩은 식별자가 0으로 남아 열리지 않음
+    result = result && m_File.seekp(0) && m_File.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_File.close();
+    return result && !m_File.fail();
+}
\ No newline at end of file
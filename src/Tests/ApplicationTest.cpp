@@ -0,0 +1,246 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Graphics/IRenderDevice.hpp"
+#include "Graphics/ResourceManager.hpp"
+#include "Scene/SceneManager.hpp"
+#include "System/Application.hpp"
+#include "TestCommon.hpp"
+
+using namespace tests;
+using namespace graphics;
+using namespace scene;
+
+namespace {
+    constexpr uint32_t TEXTURES_PER_SCENE   = 8U;       ///< 장면 하나가 취득하는 텍스처 수 (절반은 다른 장면과 공유)
+    constexpr uint32_t CHANGE_INTERVAL      = 5U;       ///< 장면을 교체하는 Update 간격
+    constexpr uint64_t TEST_FRAMES          = 120ULL;   ///< 검사에서 구동하는 프레임 수
+    constexpr uint64_t BENCH_FRAMES         = 60ULL;    ///< 벤치마크에서 구동하는 프레임 수
+    constexpr double BENCH_WORK             = 0.004;    ///< 벤치마크에서 Update와 렌더링이 각각 소모하는 시간 (초 단위)
+
+    /// @brief 장면들이 기록하는 검사 결과
+    struct Record final {
+        std::thread::id MainThread;                     ///< Application을 구동하는 스레드
+        std::atomic<uint32_t> Creates{ 0U };            ///< OnCreate 횟수
+        std::atomic<uint32_t> Destroys{ 0U };           ///< OnDestroy 횟수
+        std::atomic<uint32_t> OffMainCalls{ 0U };       ///< 메인 스레드 밖에서 호출된 OnCreate, OnDestroy 수
+        std::atomic<uint32_t> Updates{ 0U };            ///< Update 횟수
+        std::atomic<uint32_t> Rendered{ 0U };           ///< 그려진 스냅샷 수
+        std::atomic<uint32_t> InvalidDraws{ 0U };       ///< 무효한 텍스처로 그린 횟수
+        std::atomic<uint32_t> StaleFrames{ 0U };        ///< 이전 스냅샷보다 오래된 Update 번호를 그린 횟수
+        uint32_t LastRendered = 0U;                     ///< 마지막으로 그린 스냅샷의 Update 번호 (렌더 스레드 전용)
+        double Work = 0.0;                              ///< Update와 렌더링이 각각 소모하는 시간 (초 단위)
+    };
+
+    /// @brief 지정한 시간 동안 바쁘게 대기합니다.
+    void spin(double seconds) noexcept {
+        const double end = Now() + seconds;
+        while (Now() < end) {}
+    }
+
+    void expectMainThread(Record& record) noexcept {
+        if (std::this_thread::get_id() != record.MainThread) {
+            record.OffMainCalls.fetch_add(1U, std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief 텍스처를 바인딩해 그리는 스냅샷
+    class TestSnapshot final : public RenderSnapshot {
+    public:
+        explicit TestSnapshot(Record& record) noexcept : m_Record(record) {}
+
+        void Render(IRenderDevice* device) noexcept override {
+            for (const TextureHandle texture : Textures) {
+                if (!texture.IsValid()) {
+                    m_Record.InvalidDraws.fetch_add(1U, std::memory_order_relaxed);
+                }
+                device->SetTexture(0U, texture);
+                device->Draw(3U, 0U);
+            }
+
+            if (Update < m_Record.LastRendered) {
+                m_Record.StaleFrames.fetch_add(1U, std::memory_order_relaxed);
+            }
+            m_Record.LastRendered = Update;
+            m_Record.Rendered.fetch_add(1U, std::memory_order_relaxed);
+            spin(m_Record.Work);
+        }
+
+        std::vector<TextureHandle> Textures;            ///< 그릴 텍스처
+        uint32_t Update = 0U;                           ///< 기록한 시점의 Update 번호
+
+    private:
+        Record& m_Record;
+    };
+
+    /// @brief 리소스를 취득하고 Update에서 다른 장면으로 교체하는 장면
+    class TestScene final : public SceneBase {
+    public:
+        TestScene(Record& record, uint32_t seed, const char* next) noexcept : m_Record(record), m_Seed(seed), m_Next(next) {}
+
+        bool OnCreate() noexcept override {
+            expectMainThread(m_Record);
+            ResourceManager* resources = GetSceneManager()->GetResourceManager();
+
+            TextureDesc desc;
+            desc.Width = 16;
+            desc.Height = 16;
+            desc.Format = TextureFormat::RGBA8;
+            std::vector<uint32_t> pixels(16U * 16U);
+            for (uint32_t i = 0U; i < TEXTURES_PER_SCENE; ++i) {
+                // 앞의 절반은 모든 장면이 공유
+                std::fill(pixels.begin(), pixels.end(), (i < TEXTURES_PER_SCENE / 2U) ? i : m_Seed * 1000U + i);
+                m_Textures.push_back(resources->AcquireTexture(desc, pixels.data()));
+            }
+
+            m_Record.Creates.fetch_add(1U, std::memory_order_relaxed);
+            return true;
+        }
+
+        void OnDestroy() noexcept override {
+            expectMainThread(m_Record);
+            for (const TextureHandle texture : m_Textures) {
+                GetSceneManager()->GetResourceManager()->Release(texture);
+            }
+            m_Textures.clear();
+            m_Record.Destroys.fetch_add(1U, std::memory_order_relaxed);
+        }
+
+        void OnEnter() noexcept override { m_Updates = 0U; }
+        void OnExit() noexcept override {}
+        void OnPause() noexcept override {}
+        void OnResume() noexcept override {}
+        void Input() noexcept override {}
+
+        void Update(double) noexcept override {
+            m_Record.Updates.fetch_add(1U, std::memory_order_relaxed);
+            spin(m_Record.Work);
+            if (m_Next && ++m_Updates == CHANGE_INTERVAL) {
+                (void)GetSceneManager()->ChangeScene(m_Next);
+            }
+        }
+
+        // 스냅샷이 없는 단일 스레드 모드의 그리기 (스냅샷과 같은 비용)
+        void Render() noexcept override {
+            spin(m_Record.Work);
+        }
+
+        std::unique_ptr<RenderSnapshot> CreateSnapshot() noexcept override {
+            return std::make_unique<TestSnapshot>(m_Record);
+        }
+
+        void WriteSnapshot(RenderSnapshot& snapshot) noexcept override {
+            auto& target = static_cast<TestSnapshot&>(snapshot);
+            target.Textures = m_Textures;
+            target.Update = m_Record.Updates.load(std::memory_order_relaxed);
+        }
+
+    protected:
+        void onPreRender() noexcept override {}
+        void onRender3D() noexcept override {}
+        void onRender2D() noexcept override {}
+        void onPostRender() noexcept override {}
+
+    private:
+        Record& m_Record;
+        uint32_t m_Seed;
+        const char* m_Next;
+        uint32_t m_Updates = 0U;
+        std::vector<TextureHandle> m_Textures;
+    };
+
+    /// @brief 두 장면을 번갈아 교체하며 Application을 구동합니다.
+    /// @param pipelined 파이프라인 모드
+    /// @param frames 구동할 프레임 수
+    /// @param record 검사 결과
+    /// @param changeScenes 장면 교체 여부 (false면 첫 장면만 구동)
+    /// @param usage 종료 직전의 리소스 사용량
+    /// @return 프레임당 시간 (초 단위, 초기화 실패 시 음수)
+    double run(bool pipelined, uint64_t frames, Record& record, bool changeScenes, ResourceUsage& usage) {
+        record.MainThread = std::this_thread::get_id();
+
+        system::ApplicationDesc desc;
+        desc.Headless       = true;
+        desc.Renderer       = system::RenderBackend::Null;
+        desc.MaxFPS         = 0U;
+        desc.MaxFrames      = frames;
+        desc.Pipelined      = pipelined;
+        desc.WorkerThreads  = 1U;
+
+        system::Application app;
+        if (!app.Initialize(desc)) {
+            return -1.0;
+        }
+
+        SceneManager* scenes = app.GetSceneManager();
+        (void)scenes->AddScene("A", [&record, changeScenes] { return std::make_unique<TestScene>(record, 1U, changeScenes ? "B" : nullptr); });
+        (void)scenes->AddScene("B", [&record] { return std::make_unique<TestScene>(record, 2U, "A"); });
+        if (!scenes->ChangeScene("A")) {
+            return -1.0;
+        }
+
+        const double start = Now();
+        app.Run();
+        const double elapsed = Now() - start;
+
+        usage = app.GetResourceManager()->GetUsage();
+        return elapsed / static_cast<double>(frames);
+    }
+
+    /// @brief Update에서 장면을 교체해도 OnCreate, OnDestroy가 메인 스레드에서 실행되고 리소스가 유지되는지 확인합니다.
+    void checkSceneChanges(bool pipelined) {
+        const std::string mode = pipelined ? "pipelined: " : "serial: ";
+        Record record;
+        ResourceUsage usage;
+        if (!Check(run(pipelined, TEST_FRAMES, record, true, usage) >= 0.0, (mode + "application initializes").c_str())) {
+            return;
+        }
+
+        const uint32_t creates = record.Creates.load();
+        const uint32_t destroys = record.Destroys.load();
+        Check(creates >= static_cast<uint32_t>(TEST_FRAMES / (CHANGE_INTERVAL + 1U)), (mode + "Update changes scenes").c_str());
+        Check(destroys == creates, (mode + "every created scene is destroyed").c_str());
+        Check(record.OffMainCalls.load() == 0U, (mode + "OnCreate and OnDestroy run on the main thread").c_str());
+        Check(record.InvalidDraws.load() == 0U && record.StaleFrames.load() == 0U, (mode + "snapshots draw valid textures in order").c_str());
+        Check(usage.TextureCount <= 2U * TEXTURES_PER_SCENE, (mode + "released textures are destroyed").c_str());
+        if (pipelined) {
+            Check(record.Rendered.load() + 1U >= static_cast<uint32_t>(TEST_FRAMES), "pipelined: a snapshot is drawn every frame after the first");
+        }
+    }
+
+    /// @brief Update와 렌더링이 각각 BENCH_WORK만큼 걸리는 장면으로 프레임 시간을 비교합니다.
+    /// @note 두 단계가 겹치려면 하드웨어 스레드가 2개 이상이어야 합니다.
+    void benchmark() {
+        double frameTimes[2] = {};
+        for (int32_t pipelined = 0; pipelined < 2; ++pipelined) {
+            Record record;
+            record.Work = BENCH_WORK;
+            ResourceUsage usage;
+            frameTimes[pipelined] = run(pipelined != 0, BENCH_FRAMES, record, false, usage);
+            Check(record.Updates.load() == static_cast<uint32_t>(BENCH_FRAMES), "benchmark updates once per frame");
+        }
+
+        std::printf("benchmark (%llu frames, %.1f ms update + %.1f ms render, %u hardware threads)\n", static_cast<unsigned long long>(BENCH_FRAMES),
+            BENCH_WORK * 1e3, BENCH_WORK * 1e3, std::max(1U, std::thread::hardware_concurrency()));
+        std::printf("  serial     %6.2f ms/frame\n", frameTimes[0] * 1e3);
+        std::printf("  pipelined  %6.2f ms/frame\n", frameTimes[1] * 1e3);
+    }
+}
+
+/// @brief Application 테스트 진입점
+/// @note 사용법: ApplicationTest [--no-bench]
+///       헤드리스(NullWindow, NullRenderDevice)로 구동하므로 Win32가 아닌 환경에서 빌드합니다.
+int main(int argc, char* argv[]) {
+    checkSceneChanges(false);
+    checkSceneChanges(true);
+
+    if (argc < 2 || std::string(argv[1]) != "--no-bench") {
+        benchmark();
+    }
+
+    return Finish("ApplicationTest");
+}
\ No newline at end of file
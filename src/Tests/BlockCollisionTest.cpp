@@ -0,0 +1,295 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Type/SIMD.hpp"
+#include "World/BlockCollision.hpp"
+#include "TestCommon.hpp"
+
+using namespace tests;
+using namespace world;
+
+namespace {
+    constexpr size_t CHECK_RAYS         = 20000U;       ///< 전수 검사와 비교할 광선 수
+    constexpr size_t BENCH_RAYS         = 200000U;      ///< 벤치마크 광선 수
+    constexpr size_t OVERLAP_QUERIES    = 20000U;       ///< 겹침 검사 수
+    constexpr int32_t BENCH_REPEATS     = 5;            ///< 벤치마크 반복 횟수
+    constexpr float DISTANCE_TOLERANCE  = 1e-3f;        ///< 거리 허용 오차
+
+    std::mt19937 g_Random(5U);
+
+    float random01() noexcept {
+        return std::uniform_real_distribution<float>(0.0f, 1.0f)(g_Random);
+    }
+
+    /// @brief 테스트용 맵을 만듭니다.
+    /// @note 블록 0은 바닥이고 나머지는 무작위 상자이며, 7개마다 하나는 윗면을 밀어 기울인 상자입니다.
+    void makeMap(BlockData& blocks) {
+        std::vector<byte_t> file(BlockData::HEADER_SIZE + BlockData::MAX_BLOCKS * BlockData::BLOCK_SIZE, 0U);
+        const uint16_t count = static_cast<uint16_t>(BlockData::MAX_BLOCKS);
+        std::memcpy(&file[BlockData::TEXTURE_COUNT * BlockData::TEXTURE_NAME_LENGTH], &count, sizeof(count));
+
+        for (uint32_t b = 0U; b < BlockData::MAX_BLOCKS; ++b) {
+            float x0 = -10.0f, y0 = -1.0f, z0 = -10.0f, width = 180.0f, height = 1.0f, depth = 120.0f;
+            if (b > 0U) {
+                x0 = random01() * 150.0f;
+                z0 = random01() * 100.0f;
+                y0 = (random01() < 0.3f) ? random01() * 10.0f : 0.0f;
+                width = 1.0f + random01() * 10.0f;
+                depth = 1.0f + random01() * 10.0f;
+                height = 1.0f + random01() * 15.0f;
+            }
+
+            // 꼭짓점 0 ~ 3: 윗면, 4 ~ 7: 아랫면
+            float values[BlockData::BLOCK_SIZE / sizeof(float)] = {};
+            float* x = values;
+            float* y = values + BlockData::VERTEX_COUNT;
+            float* z = values + BlockData::VERTEX_COUNT * 2U;
+            const float cornerX[4] = { x0, x0 + width, x0 + width, x0 };
+            const float cornerZ[4] = { z0, z0, z0 + depth, z0 + depth };
+            for (uint32_t k = 0U; k < 4U; ++k) {
+                const bool sheared = (b % 7U) == 3U;
+                x[k] = cornerX[k] + (sheared ? 1.5f : 0.0f);
+                z[k] = cornerZ[k] - (sheared ? 0.7f : 0.0f);
+                y[k] = y0 + height;
+                x[k + 4U] = cornerX[k];
+                z[k + 4U] = cornerZ[k];
+                y[k + 4U] = y0;
+            }
+            std::memcpy(&file[BlockData::HEADER_SIZE + b * BlockData::BLOCK_SIZE], values, sizeof(values));
+        }
+
+        (void)blocks.Parse(file.data(), file.size());
+    }
+
+    /// @brief 전수 검사 기준: 모든 블록의 모든 면을 삼각형 둘로 나누어 Moller-Trumbore로 검사합니다.
+    bool referenceRayCast(const BlockData& blocks, const Vector3F& origin, Vector3F direction, float maxDistance, float& distance) noexcept {
+        direction = direction.Normalize();
+        distance = maxDistance;
+        bool hit = false;
+        for (uint32_t b = 0U; b < blocks.GetBlockCount(); ++b) {
+            for (uint32_t f = 0U; f < BlockData::FACE_COUNT; ++f) {
+                Vector3F corners[BlockData::FACE_VERTEX_COUNT];
+                for (uint32_t k = 0U; k < BlockData::FACE_VERTEX_COUNT; ++k) {
+                    corners[k] = blocks.GetVertex(b, BlockData::FACE_VERTEX_INDEX[f][k]);
+                }
+
+                for (uint32_t k = 1U; k <= 2U; ++k) {
+                    const Vector3F edge1 = corners[k] - corners[0];
+                    const Vector3F edge2 = corners[k + 1U] - corners[0];
+                    const Vector3F p = Vector3F::Cross(direction, edge2);
+                    const float determinant = Vector3F::Dot(edge1, p);
+                    if (std::fabs(determinant) <= 1e-9f) {
+                        continue;
+                    }
+                    const float inverse = 1.0f / determinant;
+                    const Vector3F t = origin - corners[0];
+                    const float u = Vector3F::Dot(t, p) * inverse;
+                    if (u < 0.0f || u > 1.0f) {
+                        continue;
+                    }
+                    const Vector3F q = Vector3F::Cross(t, edge1);
+                    const float v = Vector3F::Dot(direction, q) * inverse;
+                    if (v < 0.0f || u + v > 1.0f) {
+                        continue;
+                    }
+                    const float d = Vector3F::Dot(edge2, q) * inverse;
+                    if (d >= 0.0f && d < distance) {
+                        distance = d;
+                        hit = true;
+                    }
+                }
+            }
+        }
+        return hit;
+    }
+
+    /// @brief 무작위 광선 (절반은 짧은 거리, 절반은 맵을 가로지르는 거리)
+    void makeRays(size_t count, Vector3FStream& origins, Vector3FStream& directions, std::vector<float>& maxDistances) {
+        origins.Clear();
+        directions.Clear();
+        maxDistances.resize(count);
+        for (size_t i = 0U; i < count; ++i) {
+            origins.PushBack({ random01() * 150.0f, 1.0f + random01() * 5.0f, random01() * 100.0f });
+            directions.PushBack({ random01() * 2.0f - 1.0f, random01() * 0.6f - 0.4f, random01() * 2.0f - 1.0f });
+            maxDistances[i] = (i % 2U) ? 300.0f : 5.0f + random01() * 20.0f;
+        }
+    }
+
+    /// @brief BVH 결과가 전수 검사와 같은지 확인합니다.
+    void checkRays(const BlockData& blocks, const BlockCollision& collision) {
+        Vector3FStream origins, directions;
+        std::vector<float> maxDistances;
+        makeRays(CHECK_RAYS, origins, directions, maxDistances);
+
+        std::vector<RayHit> batchHits(CHECK_RAYS);
+        std::vector<byte_t> batchBlocked(CHECK_RAYS);
+        const uint32_t batchHitCount = collision.RayCastBatch(origins, directions, maxDistances.data(), 0U, CHECK_RAYS, batchHits.data());
+        const uint32_t batchBlockedCount = collision.RayTestBatch(origins, directions, maxDistances.data(), 0U, CHECK_RAYS, batchBlocked.data());
+
+        size_t castMismatches = 0U;
+        size_t testMismatches = 0U;
+        size_t batchMismatches = 0U;
+        size_t hitCount = 0U;
+        for (size_t i = 0U; i < CHECK_RAYS; ++i) {
+            const Vector3F origin = origins.Get(i);
+            const Vector3F direction = directions.Get(i);
+
+            float expectedDistance = 0.0f;
+            const bool expected = referenceRayCast(blocks, origin, direction, maxDistances[i], expectedDistance);
+            hitCount += expected ? 1U : 0U;
+
+            RayHit hit;
+            const bool result = collision.RayCast(origin, direction, maxDistances[i], hit);
+            if (result != expected || (result && std::fabs(hit.Distance - expectedDistance) > DISTANCE_TOLERANCE)) {
+                ++castMismatches;
+            }
+            testMismatches += (collision.RayTest(origin, direction, maxDistances[i]) != expected) ? 1U : 0U;
+
+            const bool batchResult = batchHits[i].Block != BlockCollision::NO_BLOCK;
+            if (batchResult != result || (result && (batchHits[i].Distance != hit.Distance || batchHits[i].Block != hit.Block || batchHits[i].Face != hit.Face))) {
+                ++batchMismatches;
+            }
+            batchMismatches += ((batchBlocked[i] != 0U) != expected) ? 1U : 0U;
+        }
+
+        std::printf("rays: %zu checked, %zu hit, RayCast mismatches %zu, RayTest mismatches %zu\n", CHECK_RAYS, hitCount, castMismatches, testMismatches);
+        Check(hitCount > CHECK_RAYS / 10U && hitCount < CHECK_RAYS, "ray set has both hits and misses");
+        Check(castMismatches == 0U, "RayCast matches brute force");
+        Check(testMismatches == 0U, "RayTest matches brute force");
+        Check(batchMismatches == 0U && batchHitCount == hitCount && batchBlockedCount == hitCount, "batch queries match single queries");
+    }
+
+    /// @brief 겹침 검사 결과를 확인합니다.
+    void checkOverlap(const BlockCollision& collision) {
+        CollisionContact contacts[32];
+
+        // 바닥 윗면은 y = 0
+        uint32_t count = collision.OverlapSphere({ -5.0f, 0.4f, -5.0f }, 0.5f, contacts, 32U);
+        Check(count == 1U && std::fabs(contacts[0].Depth - 0.1f) < 1e-4f && Vector3F::NearlyEquals(contacts[0].Normal, Vector3F::Up()) && std::fabs(contacts[0].Position.Y) < 1e-4f, "sphere resting in the floor is pushed up by its overlap");
+
+        count = collision.OverlapCapsule({ -5.0f, -0.3f, -5.0f }, { -5.0f, 1.5f, -5.0f }, 0.3f, contacts, 32U);
+        Check(count >= 1U && contacts[0].Normal.Y > 0.99f && std::fabs(contacts[0].Depth - 0.6f) < 1e-4f, "capsule crossing the floor is pushed out through the top face");
+
+        count = collision.OverlapCapsule({ -5.0f, 0.5f, -5.0f }, { -5.0f, 2.5f, -5.0f }, 0.3f, contacts, 32U);
+        Check(count == 0U, "capsule above the floor has no contacts");
+
+        size_t badContacts = 0U;
+        for (size_t i = 0U; i < OVERLAP_QUERIES; ++i) {
+            const Vector3F center = { random01() * 150.0f, random01() * 8.0f, random01() * 100.0f };
+            const float radius = 0.3f + random01() * 2.0f;
+            count = (i & 1U) ? collision.OverlapSphere(center, radius, contacts, 32U) : collision.OverlapCapsule(center, center + Vector3F{ 0.0f, 1.7f, 0.0f }, radius, contacts, 32U);
+            for (uint32_t k = 0U; k < count; ++k) {
+                const bool valid = contacts[k].Depth > 0.0f && std::fabs(contacts[k].Normal.Length() - 1.0f) < 1e-3f && contacts[k].Block < BlockData::MAX_BLOCKS && contacts[k].Face < BlockData::FACE_COUNT;
+                badContacts += valid ? 0U : 1U;
+            }
+        }
+        Check(badContacts == 0U, "overlap contacts have positive depth and unit normals");
+    }
+
+    /// @brief 광선 처리량을 스레드 수별로 잽니다.
+    /// @note 범위를 스레드 수만큼 나누어 각 스레드가 RayCastBatch를 호출합니다. (JobSystem::ParallelFor와 같은 분할)
+    double measureRays(const BlockCollision& collision, const Vector3FStream& origins, const Vector3FStream& directions, const std::vector<float>& maxDistances,
+        uint32_t threadCount, bool anyHit, std::vector<RayHit>& hits, std::vector<byte_t>& blocked) {
+        return MeasureBest(BENCH_REPEATS, [&] {
+            auto work = [&](size_t begin, size_t end) {
+                if (anyHit) {
+                    Consume(collision.RayTestBatch(origins, directions, maxDistances.data(), begin, end, blocked.data()));
+                } else {
+                    Consume(collision.RayCastBatch(origins, directions, maxDistances.data(), begin, end, hits.data()));
+                }
+            };
+
+            std::vector<std::thread> threads;
+            const size_t grain = (BENCH_RAYS + threadCount - 1U) / threadCount;
+            for (uint32_t t = 1U; t < threadCount; ++t) {
+                threads.emplace_back(work, std::min(BENCH_RAYS, t * grain), std::min(BENCH_RAYS, (t + 1U) * grain));
+            }
+            work(0U, std::min(BENCH_RAYS, grain));
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        });
+    }
+
+    void benchmark(const BlockData& blocks, BlockCollision& collision) {
+        const double buildTime = MeasureBest(BENCH_REPEATS * 10, [&] {
+            collision.Build(blocks);
+            Consume(collision.GetTriangleCount());
+        });
+        std::printf("benchmark: build %.3f ms (%u triangles, %zu nodes, %zu groups)\n", buildTime * 1e3, collision.GetTriangleCount(), collision.GetNodes().size(), collision.GetGroups().size());
+
+        Vector3FStream origins, directions;
+        std::vector<float> maxDistances;
+        makeRays(BENCH_RAYS, origins, directions, maxDistances);
+        std::vector<RayHit> hits(BENCH_RAYS);
+        std::vector<byte_t> blocked(BENCH_RAYS);
+
+        constexpr size_t REFERENCE_RAYS = 2000U;
+        const double referenceTime = MeasureBest(1, [&] {
+            for (size_t i = 0U; i < REFERENCE_RAYS; ++i) {
+                float distance = 0.0f;
+                Consume(referenceRayCast(blocks, origins.Get(i), directions.Get(i), maxDistances[i], distance));
+            }
+        });
+        std::printf("  brute force (every face):  %8.3f M rays/s\n", REFERENCE_RAYS / referenceTime / 1e6);
+
+        const uint32_t hardwareThreads = std::max(1U, std::thread::hardware_concurrency());
+        std::vector<uint32_t> threadCounts = { 1U };
+        for (uint32_t count = 2U; count < hardwareThreads; count *= 2U) {
+            threadCounts.push_back(count);
+        }
+        if (hardwareThreads > 1U) {
+            threadCounts.push_back(hardwareThreads);
+        }
+
+        std::printf("  %zu rays, %u hardware threads\n", BENCH_RAYS, hardwareThreads);
+        for (const uint32_t threadCount : threadCounts) {
+            const double castTime = measureRays(collision, origins, directions, maxDistances, threadCount, false, hits, blocked);
+            const double testTime = measureRays(collision, origins, directions, maxDistances, threadCount, true, hits, blocked);
+            const double castRate = BENCH_RAYS / castTime / 1e6;
+            const double testRate = BENCH_RAYS / testTime / 1e6;
+            std::printf("  %2u thread(s): RayCastBatch %6.2f M rays/s (%.2f per core), RayTestBatch %6.2f M rays/s (%.2f per core)\n",
+                threadCount, castRate, castRate / threadCount, testRate, testRate / threadCount);
+        }
+
+        CollisionContact contacts[32];
+        const double overlapTime = MeasureBest(BENCH_REPEATS, [&] {
+            for (size_t i = 0U; i < OVERLAP_QUERIES; ++i) {
+                const Vector3F center = origins.Get(i);
+                Consume(collision.OverlapCapsule(center, center + Vector3F{ 0.0f, 1.7f, 0.0f }, 0.5f, contacts, 32U));
+            }
+        });
+        std::printf("  OverlapCapsule: %.2f M queries/s\n", OVERLAP_QUERIES / overlapTime / 1e6);
+    }
+}
+
+/// @brief 블록 충돌 검사 테스트 진입점
+/// @note 사용법: BlockCollisionTest [--no-bench]
+int main(int argc, char* argv[]) {
+#if defined(NEOXOPS_SIMD_SSE2) || defined(NEOXOPS_SIMD_NEON)
+    std::printf("collision path: SIMD\n");
+#else
+    std::printf("collision path: scalar\n");
+#endif
+
+    auto blocks = std::make_unique<BlockData>();
+    makeMap(*blocks);
+    BlockCollision collision;
+    collision.Build(*blocks);
+    Check(collision.GetTriangleCount() == BlockData::MAX_BLOCKS * BlockData::FACE_COUNT * 2U, "every face becomes two triangles");
+
+    checkRays(*blocks, collision);
+    checkOverlap(collision);
+
+    if (argc < 2 || std::string(argv[1]) != "--no-bench") {
+        benchmark(*blocks, collision);
+    }
+
+    return Finish("BlockCollisionTest");
+}
\ No newline at end of file
@@ -0,0 +1,255 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+#include "World/BlockData.hpp"
+#include "TestCommon.hpp"
+
+using namespace tests;
+using namespace world;
+
+namespace {
+    constexpr int32_t BENCH_REPEATS = 2000;     ///< 벤치마크 반복 횟수
+
+    /// @brief 블록 하나의 파일 내 float 수
+    constexpr size_t BLOCK_FLOATS = BlockData::BLOCK_SIZE / sizeof(float);
+
+    /// @brief 텍스처 인덱스 필드의 블록 내 float 위치
+    constexpr size_t TEXTURE_FIELD = BlockData::VERTEX_COUNT * 3U + BlockData::UV_COUNT * 2U;
+
+    /// @brief 테스트용 BD1 파일 내용을 만듭니다.
+    /// @param blockCount 파일에 기록할 블록 수 (MAX_BLOCKS를 넘어도 됨)
+    /// @note 텍스처 이름 널 문자 뒤의 쓰레기 값, 범위 밖 텍스처 인덱스(-1, 10), 0이 아닌 플래그를 포함합니다.
+    std::vector<byte_t> makeFile(uint32_t blockCount) {
+        std::vector<byte_t> file(BlockData::HEADER_SIZE + blockCount * BlockData::BLOCK_SIZE, 0U);
+        for (uint32_t i = 0U; i < BlockData::TEXTURE_COUNT; ++i) {
+            std::snprintf(reinterpret_cast<char*>(&file[i * BlockData::TEXTURE_NAME_LENGTH]), BlockData::TEXTURE_NAME_LENGTH, "tex/block%02u.bmp", i);
+        }
+        file[5U * BlockData::TEXTURE_NAME_LENGTH + 20U] = 'Z';
+
+        const uint16_t count = static_cast<uint16_t>(blockCount);
+        std::memcpy(&file[BlockData::TEXTURE_COUNT * BlockData::TEXTURE_NAME_LENGTH], &count, sizeof(count));
+
+        uint32_t seed = 7U;
+        for (uint32_t b = 0U; b < blockCount; ++b) {
+            float values[BLOCK_FLOATS];
+            for (size_t k = 0U; k < TEXTURE_FIELD; ++k) {
+                seed = seed * 1664525U + 1013904223U;
+                values[k] = static_cast<float>(seed >> 8U) / 65536.0f - 128.0f;
+            }
+            for (size_t f = 0U; f < BlockData::FACE_COUNT; ++f) {
+                values[TEXTURE_FIELD + f] = static_cast<float>(static_cast<int32_t>((b + f) % 12U) - 1);
+            }
+            values[BLOCK_FLOATS - 1U] = static_cast<float>(b & 1U);
+            std::memcpy(&file[BlockData::HEADER_SIZE + b * BlockData::BLOCK_SIZE], values, sizeof(values));
+        }
+        return file;
+    }
+
+    /// @brief 블록의 텍스처 인덱스 필드를 바꿉니다.
+    void setTextureField(std::vector<byte_t>& file, uint32_t block, uint32_t face, float value) noexcept {
+        std::memcpy(&file[BlockData::HEADER_SIZE + block * BlockData::BLOCK_SIZE + (TEXTURE_FIELD + face) * sizeof(float)], &value, sizeof(value));
+    }
+
+    bool sameBytes(const std::vector<byte_t>& lhs, const std::vector<byte_t>& rhs) noexcept {
+        return lhs.size() == rhs.size() && std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0;
+    }
+
+    bool writeFile(const std::string& path, const std::vector<byte_t>& data) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        return static_cast<bool>(file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size())));
+    }
+
+    std::vector<byte_t> readFile(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+    }
+
+    /// @brief 정수 텍스처 인덱스만 있는 MAX_BLOCKS 이하의 파일은 바이트 단위로 그대로 돌아와야 합니다.
+    void checkRoundTrip(BlockData& blocks, const std::string& path) {
+        const std::vector<byte_t> file = makeFile(BlockData::MAX_BLOCKS);
+        std::vector<byte_t> serialized;
+
+        Check(blocks.Parse(file.data(), file.size()) && blocks.GetBlockCount() == BlockData::MAX_BLOCKS, "Parse reads every block");
+        blocks.Serialize(serialized);
+        Check(sameBytes(serialized, file), "Parse -> Serialize is byte-identical");
+        Check(std::strcmp(blocks.GetTextureName(5U), "tex/block05.bmp") == 0, "texture name stops at the first NUL");
+        Check(blocks.GetTextureIndex(0U, 0U) == -1 && blocks.GetTextureIndex(0U, 5U) == 4 && blocks.GetTextureIndex(6U, 5U) == 10, "texture indices are parsed as integers, out of range values kept");
+
+        Check(writeFile(path, file) && blocks.Load(path), "Load reads the file");
+        blocks.Serialize(serialized);
+        Check(sameBytes(serialized, file), "Load -> Serialize is byte-identical");
+
+        Check(blocks.Save(path) && sameBytes(readFile(path), file), "Save writes the original bytes");
+
+        const std::vector<byte_t> empty = makeFile(0U);
+        Check(blocks.Parse(empty.data(), empty.size()) && blocks.GetBlockCount() == 0U, "Parse accepts an empty map");
+        blocks.Serialize(serialized);
+        Check(sameBytes(serialized, empty), "empty map round trip is byte-identical");
+    }
+
+    /// @brief MAX_BLOCKS를 넘는 파일은 OpenXOPS와 같이 앞부분만 읽고, 저장하면 잘린 파일이 됩니다.
+    void checkTruncation(BlockData& blocks) {
+        constexpr uint32_t FILE_BLOCKS = BlockData::MAX_BLOCKS + 10U;
+        const std::vector<byte_t> file = makeFile(FILE_BLOCKS);
+        std::vector<byte_t> serialized;
+
+        Check(blocks.Parse(file.data(), file.size()) && blocks.GetBlockCount() == BlockData::MAX_BLOCKS, "Parse clamps the block count to MAX_BLOCKS");
+        blocks.Serialize(serialized);
+
+        // 기대값: 앞 MAX_BLOCKS개 블록과 MAX_BLOCKS로 고친 블록 수
+        std::vector<byte_t> expected(file.begin(), file.begin() + static_cast<std::ptrdiff_t>(BlockData::HEADER_SIZE + BlockData::MAX_BLOCKS * BlockData::BLOCK_SIZE));
+        const uint16_t count = static_cast<uint16_t>(BlockData::MAX_BLOCKS);
+        std::memcpy(&expected[BlockData::TEXTURE_COUNT * BlockData::TEXTURE_NAME_LENGTH], &count, sizeof(count));
+        Check(sameBytes(serialized, expected), "Serialize of a truncated map writes the first MAX_BLOCKS blocks");
+
+        std::vector<byte_t> reserialized;
+        Check(blocks.Parse(serialized.data(), serialized.size()), "truncated map parses again");
+        blocks.Serialize(reserialized);
+        Check(sameBytes(reserialized, serialized), "truncated map round trip is stable");
+
+        // 블록 수만 MAX_BLOCKS를 넘고 내용이 MAX_BLOCKS개면 읽을 수 있어야 함
+        Check(blocks.Parse(expected.data(), expected.size()) && blocks.GetBlockCount() == BlockData::MAX_BLOCKS, "header count above MAX_BLOCKS only needs MAX_BLOCKS blocks of data");
+
+        Check(!blocks.Parse(file.data(), BlockData::HEADER_SIZE + BlockData::MAX_BLOCKS * BlockData::BLOCK_SIZE - 1U) && blocks.GetBlockCount() == 0U, "short file is rejected and clears the map");
+        Check(!blocks.Parse(file.data(), BlockData::HEADER_SIZE - 1U), "short header is rejected");
+        Check(!blocks.Parse(nullptr, file.size()), "null data is rejected");
+    }
+
+    /// @brief 정수가 아닌 텍스처 인덱스는 OpenXOPS와 같이 0 방향으로 잘리며, 저장 후에는 그 정수값으로 고정됩니다.
+    void checkFloatTextureIndex(BlockData& blocks) {
+        std::vector<byte_t> file = makeFile(4U);
+        setTextureField(file, 1U, 0U, 2.5f);
+        setTextureField(file, 1U, 1U, -0.75f);
+        setTextureField(file, 1U, 2U, 9.999f);
+        setTextureField(file, 1U, 3U, std::numeric_limits<float>::quiet_NaN());
+        setTextureField(file, 1U, 4U, 1e10f);
+        setTextureField(file, 1U, 5U, -std::numeric_limits<float>::infinity());
+
+        Check(blocks.Parse(file.data(), file.size()), "map with float texture indices parses");
+        Check(blocks.GetTextureIndex(1U, 0U) == 2 && blocks.GetTextureIndex(1U, 1U) == 0 && blocks.GetTextureIndex(1U, 2U) == 9, "fractional texture index truncates toward zero");
+        Check(blocks.GetTextureIndex(1U, 3U) == -1 && blocks.GetTextureIndex(1U, 4U) == -1 && blocks.GetTextureIndex(1U, 5U) == -1, "non-finite or out of int range texture index becomes -1");
+
+        std::vector<byte_t> serialized;
+        blocks.Serialize(serialized);
+        std::vector<byte_t> expected = file;
+        const float written[BlockData::FACE_COUNT] = { 2.0f, 0.0f, 9.0f, -1.0f, -1.0f, -1.0f };
+        for (uint32_t f = 0U; f < BlockData::FACE_COUNT; ++f) {
+            setTextureField(expected, 1U, f, written[f]);
+        }
+        Check(sameBytes(serialized, expected), "Serialize writes the integer texture index, other bytes unchanged");
+
+        std::vector<byte_t> reserialized;
+        Check(blocks.Parse(serialized.data(), serialized.size()), "normalized map parses again");
+        blocks.Serialize(reserialized);
+        Check(sameBytes(reserialized, serialized), "normalized map round trip is byte-identical");
+    }
+
+    /// @brief OpenXOPS 방식 로더 (필드마다 fread, 블록 구조체 배열)
+    struct ReferenceBlock final {
+        float X[BlockData::VERTEX_COUNT];
+        float Y[BlockData::VERTEX_COUNT];
+        float Z[BlockData::VERTEX_COUNT];
+        float U[BlockData::UV_COUNT];
+        float V[BlockData::UV_COUNT];
+        int32_t TextureIndex[BlockData::FACE_COUNT];
+        float Flag;
+    };
+
+    uint32_t referenceLoad(const char* path, std::vector<ReferenceBlock>& blocks) {
+        FILE* fp = std::fopen(path, "rb");
+        if (!fp) {
+            return 0U;
+        }
+
+        char names[BlockData::TEXTURE_COUNT][BlockData::TEXTURE_NAME_LENGTH];
+        for (auto& name : names) {
+            (void)std::fread(name, 1U, BlockData::TEXTURE_NAME_LENGTH, fp);
+        }
+        uint16_t count = 0U;
+        (void)std::fread(&count, sizeof(count), 1U, fp);
+        count = static_cast<uint16_t>(std::min<uint32_t>(count, BlockData::MAX_BLOCKS));
+
+        blocks.clear();
+        for (uint32_t i = 0U; i < count; ++i) {
+            ReferenceBlock block;
+            (void)std::fread(block.X, sizeof(float), BlockData::VERTEX_COUNT, fp);
+            (void)std::fread(block.Y, sizeof(float), BlockData::VERTEX_COUNT, fp);
+            (void)std::fread(block.Z, sizeof(float), BlockData::VERTEX_COUNT, fp);
+            (void)std::fread(block.U, sizeof(float), BlockData::UV_COUNT, fp);
+            (void)std::fread(block.V, sizeof(float), BlockData::UV_COUNT, fp);
+            for (int32_t& index : block.TextureIndex) {
+                float value = 0.0f;
+                (void)std::fread(&value, sizeof(value), 1U, fp);
+                index = static_cast<int32_t>(value);
+            }
+            (void)std::fread(&block.Flag, sizeof(float), 1U, fp);
+            blocks.push_back(block);
+        }
+        std::fclose(fp);
+        return count;
+    }
+
+    /// @brief 메모리 매핑 로더를 fread 로더와 비교합니다.
+    void benchmark(BlockData& blocks, const std::string& path) {
+        const std::vector<byte_t> file = makeFile(BlockData::MAX_BLOCKS);
+        (void)writeFile(path, file);
+
+        std::vector<ReferenceBlock> reference;
+        const uint32_t count = referenceLoad(path.c_str(), reference);
+        bool same = blocks.Load(path) && count == blocks.GetBlockCount();
+        for (uint32_t b = 0U; same && b < count; ++b) {
+            for (uint32_t k = 0U; k < BlockData::VERTEX_COUNT; ++k) {
+                same = same && Vector3F{ reference[b].X[k], reference[b].Y[k], reference[b].Z[k] } == blocks.GetVertex(b, k);
+            }
+            for (uint32_t k = 0U; k < BlockData::UV_COUNT; ++k) {
+                same = same && reference[b].U[k] == blocks.GetU()[b * BlockData::UV_COUNT + k] && reference[b].V[k] == blocks.GetV()[b * BlockData::UV_COUNT + k];
+            }
+            for (uint32_t f = 0U; f < BlockData::FACE_COUNT; ++f) {
+                same = same && reference[b].TextureIndex[f] == blocks.GetTextureIndex(b, f);
+            }
+        }
+        Check(same, "Load matches the fread reference loader");
+
+        const double referenceTime = MeasureBest(BENCH_REPEATS, [&] {
+            Consume(referenceLoad(path.c_str(), reference));
+        });
+        const double loadTime = MeasureBest(BENCH_REPEATS, [&] {
+            Consume(blocks.Load(path));
+        });
+        const double parseTime = MeasureBest(BENCH_REPEATS, [&] {
+            Consume(blocks.Parse(file.data(), file.size()));
+        });
+        std::printf("benchmark (%u blocks, %zu bytes, best of %d)\n", BlockData::MAX_BLOCKS, file.size(), BENCH_REPEATS);
+        std::printf("  fread per field (reference)  %8.2f us\n", referenceTime * 1e6);
+        std::printf("  BlockData::Load (mapped)     %8.2f us\n", loadTime * 1e6);
+        std::printf("  BlockData::Parse (memory)    %8.2f us\n", parseTime * 1e6);
+    }
+}
+
+/// @brief BlockData 테스트 진입점
+/// @note 사용법: BlockDataTest [--no-bench]
+int main(int argc, char* argv[]) {
+    const std::string path = (std::filesystem::temp_directory_path() / "NeoXOPS_BlockDataTest.bd1").string();
+    auto blocks = std::make_unique<BlockData>();
+
+    checkRoundTrip(*blocks, path);
+    checkTruncation(*blocks);
+    checkFloatTextureIndex(*blocks);
+
+    if (argc < 2 || std::string(argv[1]) != "--no-bench") {
+        benchmark(*blocks, path);
+    }
+
+    std::error_code error;
+    std::filesystem::remove(path, error);
+
+    return Finish("BlockDataTest");
+}
\ No newline at end of file
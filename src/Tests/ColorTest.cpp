@@ -0,0 +1,259 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "Graphics/Color.hpp"
+#include "Type/SIMD.hpp"
+#include "TestCommon.hpp"
+
+using namespace tests;
+using namespace graphics;
+
+namespace {
+    constexpr int32_t BENCH_REPEATS = 50;       ///< 벤치마크 반복 횟수
+    constexpr size_t BENCH_COUNT    = 65537U;   ///< 벤치마크 픽셀 수 (레인 수의 배수가 아니므로 나머지 경로 포함)
+
+    /// @brief 빌드된 커널 경로 이름
+    constexpr const char* PATH_NAME =
+#if defined(NEOXOPS_SIMD_AVX2)
+        "AVX2 (8 pixels)";
+#elif defined(NEOXOPS_SIMD_SSE2)
+        "SSE2 (4 pixels)";
+#else
+        "scalar (1 pixel)";
+#endif
+
+    constexpr ColorOrder ORDERS[] = { ColorOrder::ARGB, ColorOrder::RGBA, ColorOrder::BGRA };
+
+    /// @brief 채널 순서와 무관한 픽셀 (기준 구현용)
+    struct Pixel final {
+        uint32_t R, G, B, A;
+    };
+
+    /// @brief 바이트 순서별 R, G, B, A의 바이트 위치 (ColorOrder 순)
+    constexpr uint32_t POSITIONS[3][4] = {
+        { 1U, 2U, 3U, 0U },     // ARGB
+        { 0U, 1U, 2U, 3U },     // RGBA
+        { 2U, 1U, 0U, 3U }      // BGRA
+    };
+
+    Pixel readPixel(const byte_t* p, ColorOrder order) noexcept {
+        const uint32_t (&positions)[4] = POSITIONS[static_cast<uint32_t>(order)];
+        return { p[positions[0]], p[positions[1]], p[positions[2]], p[positions[3]] };
+    }
+
+    void writePixel(byte_t* p, ColorOrder order, const Pixel& pixel) noexcept {
+        const uint32_t (&positions)[4] = POSITIONS[static_cast<uint32_t>(order)];
+        p[positions[0]] = static_cast<byte_t>(pixel.R);
+        p[positions[1]] = static_cast<byte_t>(pixel.G);
+        p[positions[2]] = static_cast<byte_t>(pixel.B);
+        p[positions[3]] = static_cast<byte_t>(pixel.A);
+    }
+
+    /// @brief 기준: value / 255를 반올림 (정수 나눗셈)
+    uint32_t roundDiv255(uint32_t value) noexcept {
+        return (value * 2U + 255U) / 510U;
+    }
+
+    /// @brief 기준: sRGB 8비트 -> 선형 8비트
+    uint32_t srgbToLinear(uint32_t value) noexcept {
+        const double c = value / 255.0;
+        return static_cast<uint32_t>(std::lround(255.0 * ((c <= 0.04045) ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4))));
+    }
+
+    /// @brief 기준: 선형 8비트 -> sRGB 8비트
+    uint32_t linearToSrgb(uint32_t value) noexcept {
+        const double c = value / 255.0;
+        return static_cast<uint32_t>(std::lround(255.0 * ((c <= 0.0031308) ? c * 12.92 : 1.055 * std::pow(c, 1.0 / 2.4) - 0.055)));
+    }
+
+    /// @brief 무작위 픽셀 바이트를 만듭니다. (알파 0, 255와 채널 양 끝값이 자주 나오도록 섞음)
+    std::vector<byte_t> makePixels(size_t count, uint32_t seed) {
+        std::mt19937 random(seed);
+        std::vector<byte_t> bytes(count * 4U);
+        for (byte_t& value : bytes) {
+            const uint32_t r = random();
+            value = static_cast<byte_t>((r % 8U == 0U) ? 0U : (r % 8U == 1U) ? 255U : (r >> 8));
+        }
+        return bytes;
+    }
+
+    /// @brief 미리 곱한 알파 픽셀을 만듭니다. (색상 <= 알파)
+    std::vector<byte_t> makePremultiplied(size_t count, ColorOrder order, uint32_t seed) {
+        std::vector<byte_t> bytes = makePixels(count, seed);
+        for (size_t i = 0U; i < count; ++i) {
+            Pixel pixel = readPixel(bytes.data() + i * 4U, order);
+            pixel.R = roundDiv255(pixel.R * pixel.A);
+            pixel.G = roundDiv255(pixel.G * pixel.A);
+            pixel.B = roundDiv255(pixel.B * pixel.A);
+            writePixel(bytes.data() + i * 4U, order, pixel);
+        }
+        return bytes;
+    }
+
+    /// @brief 정렬되지 않은 위치(1바이트 어긋남)에 픽셀을 둔 버퍼
+    struct Unaligned final {
+        std::vector<byte_t> Storage;
+
+        explicit Unaligned(const std::vector<byte_t>& bytes) : Storage(bytes.size() + 1U) {
+            std::copy(bytes.begin(), bytes.end(), Storage.begin() + 1);
+        }
+
+        byte_t* Data() noexcept { return Storage.data() + 1; }
+        std::vector<byte_t> Bytes() const { return { Storage.begin() + 1, Storage.end() }; }
+    };
+
+    /// @brief 모든 커널을 픽셀 수 하나에 대해 기준 구현과 비교합니다.
+    void checkKernels(size_t count) {
+        const std::string suffix = " (" + std::to_string(count) + " pixels)";
+        const std::vector<byte_t> source = makePixels(count, static_cast<uint32_t>(count) + 1U);
+        const std::vector<byte_t> dest = makePixels(count, static_cast<uint32_t>(count) + 1000U);
+
+        bool converted = true, inPlace = true;
+        for (const ColorOrder from : ORDERS) {
+            for (const ColorOrder to : ORDERS) {
+                std::vector<byte_t> expected(count * 4U);
+                for (size_t i = 0U; i < count; ++i) {
+                    writePixel(expected.data() + i * 4U, to, readPixel(source.data() + i * 4U, from));
+                }
+
+                Unaligned result(std::vector<byte_t>(count * 4U, 0xCDU));
+                Color::Convert(source.data(), from, result.Data(), to, count);
+                converted = converted && result.Bytes() == expected;
+
+                std::vector<byte_t> same = source;
+                Color::Convert(same.data(), from, same.data(), to, count);
+                inPlace = inPlace && same == expected;
+            }
+        }
+        Check(converted, ("Convert matches the reference for every order pair" + suffix).c_str());
+        Check(inPlace, ("Convert works in place" + suffix).c_str());
+
+        bool premultiplied = true, srgb = true, blended = true, blendedPremultiplied = true;
+        for (const ColorOrder order : ORDERS) {
+            std::vector<byte_t> expected(count * 4U);
+            for (size_t i = 0U; i < count; ++i) {
+                Pixel pixel = readPixel(source.data() + i * 4U, order);
+                pixel.R = roundDiv255(pixel.R * pixel.A);
+                pixel.G = roundDiv255(pixel.G * pixel.A);
+                pixel.B = roundDiv255(pixel.B * pixel.A);
+                writePixel(expected.data() + i * 4U, order, pixel);
+            }
+            Unaligned result(source);
+            Color::PremultiplyAlpha(result.Data(), result.Data(), order, count);
+            premultiplied = premultiplied && result.Bytes() == expected;
+
+            std::vector<byte_t> linear(count * 4U), back(count * 4U);
+            Color::SrgbToLinear(source.data(), linear.data(), order, count);
+            Color::LinearToSrgb(source.data(), back.data(), order, count);
+            for (size_t i = 0U; i < count; ++i) {
+                const Pixel s = readPixel(source.data() + i * 4U, order);
+                const Pixel l = readPixel(linear.data() + i * 4U, order);
+                const Pixel b = readPixel(back.data() + i * 4U, order);
+                srgb = srgb && l.R == srgbToLinear(s.R) && l.G == srgbToLinear(s.G) && l.B == srgbToLinear(s.B) && l.A == s.A
+                    && b.R == linearToSrgb(s.R) && b.G == linearToSrgb(s.G) && b.B == linearToSrgb(s.B) && b.A == s.A;
+            }
+
+            for (size_t i = 0U; i < count; ++i) {
+                const Pixel s = readPixel(source.data() + i * 4U, order);
+                const Pixel d = readPixel(dest.data() + i * 4U, order);
+                const uint32_t inv = 255U - s.A;
+                writePixel(expected.data() + i * 4U, order, {
+                    roundDiv255(s.R * s.A + d.R * inv), roundDiv255(s.G * s.A + d.G * inv), roundDiv255(s.B * s.A + d.B * inv), s.A + roundDiv255(d.A * inv) });
+            }
+            Unaligned target(dest);
+            Color::BlendOver(source.data(), target.Data(), order, count);
+            blended = blended && target.Bytes() == expected;
+
+            const std::vector<byte_t> premultipliedSource = makePremultiplied(count, order, static_cast<uint32_t>(count) + 2000U);
+            const std::vector<byte_t> premultipliedDest = makePremultiplied(count, order, static_cast<uint32_t>(count) + 3000U);
+            for (size_t i = 0U; i < count; ++i) {
+                const Pixel s = readPixel(premultipliedSource.data() + i * 4U, order);
+                const Pixel d = readPixel(premultipliedDest.data() + i * 4U, order);
+                const uint32_t inv = 255U - s.A;
+                writePixel(expected.data() + i * 4U, order, {
+                    std::min(255U, s.R + roundDiv255(d.R * inv)), std::min(255U, s.G + roundDiv255(d.G * inv)),
+                    std::min(255U, s.B + roundDiv255(d.B * inv)), std::min(255U, s.A + roundDiv255(d.A * inv)) });
+            }
+            Unaligned premultipliedTarget(premultipliedDest);
+            Color::BlendOverPremultiplied(premultipliedSource.data(), premultipliedTarget.Data(), order, count);
+            blendedPremultiplied = blendedPremultiplied && premultipliedTarget.Bytes() == expected;
+        }
+        Check(premultiplied, ("PremultiplyAlpha matches the reference" + suffix).c_str());
+        Check(srgb, ("sRGB tables match the transfer functions" + suffix).c_str());
+        Check(blended, ("BlendOver matches the reference" + suffix).c_str());
+        Check(blendedPremultiplied, ("BlendOverPremultiplied matches the reference" + suffix).c_str());
+    }
+
+    /// @brief 포화와 경계값을 확인합니다.
+    void checkEdges() {
+        // 미리 곱하지 않은 값(색상 > 알파)을 넣으면 포화
+        const byte_t source[4] = { 255U, 255U, 255U, 0U };
+        byte_t dest[4] = { 200U, 200U, 200U, 255U };
+        Color::BlendOverPremultiplied(source, dest, ColorOrder::RGBA, 1U);
+        Check(dest[0] == 255U && dest[3] == 255U, "BlendOverPremultiplied saturates at 255");
+
+        // 알파 255 원본은 결과를 덮어쓰고, 알파 0 원본은 결과를 유지
+        std::vector<Color> pixels(9U, Color(10, 20, 30, 255));
+        std::vector<Color> opaque(9U, Color(200, 100, 50, 255));
+        Color::BlendOver(opaque.data(), pixels.data(), ColorOrder::ARGB, pixels.size());
+        Check(std::all_of(pixels.begin(), pixels.end(), [](const Color& c) { return c == Color(200, 100, 50, 255); }), "opaque BlendOver replaces the destination");
+        std::vector<Color> clear(9U, Color(1, 2, 3, 0));
+        Color::BlendOver(clear.data(), pixels.data(), ColorOrder::ARGB, pixels.size());
+        Check(std::all_of(pixels.begin(), pixels.end(), [](const Color& c) { return c == Color(200, 100, 50, 255); }), "transparent BlendOver keeps the destination");
+
+        // Color 배열과 색상 코드(0xAARRGGBB)의 순서
+        const Color color(0x12, 0x34, 0x56, 0x78);
+        uint32_t code = 0U;
+        Color::Convert(&color, ColorOrder::ARGB, &code, ColorOrder::BGRA, 1U);
+        Check(code == color.GetColorCode() && code == 0x78123456U, "ARGB Color converts to a BGRA color code");
+    }
+
+    /// @brief 벤치마크 결과를 출력합니다.
+    void report(const char* name, double time) noexcept {
+        std::printf("  %-24s %8.1f Mpixel/s\n", name, BENCH_COUNT / time / 1e6);
+    }
+
+    /// @brief 커널별 처리량을 잽니다.
+    void benchmark() {
+        const std::vector<byte_t> source = makePixels(BENCH_COUNT, 1U);
+        std::vector<byte_t> dest = makePixels(BENCH_COUNT, 2U);
+
+        std::printf("benchmark (%zu pixels, best of %d)\n", BENCH_COUNT, BENCH_REPEATS);
+        report("Convert RGBA->BGRA", MeasureBest(BENCH_REPEATS, [&] { Color::Convert(source.data(), ColorOrder::RGBA, dest.data(), ColorOrder::BGRA, BENCH_COUNT); Consume(dest[7]); }));
+        report("Convert ARGB->RGBA", MeasureBest(BENCH_REPEATS, [&] { Color::Convert(source.data(), ColorOrder::ARGB, dest.data(), ColorOrder::RGBA, BENCH_COUNT); Consume(dest[7]); }));
+        report("PremultiplyAlpha", MeasureBest(BENCH_REPEATS, [&] { Color::PremultiplyAlpha(source.data(), dest.data(), ColorOrder::RGBA, BENCH_COUNT); Consume(dest[7]); }));
+        report("SrgbToLinear", MeasureBest(BENCH_REPEATS, [&] { Color::SrgbToLinear(source.data(), dest.data(), ColorOrder::RGBA, BENCH_COUNT); Consume(dest[7]); }));
+        report("BlendOver", MeasureBest(BENCH_REPEATS, [&] { Color::BlendOver(source.data(), dest.data(), ColorOrder::RGBA, BENCH_COUNT); Consume(dest[7]); }));
+        report("BlendOverPremultiplied", MeasureBest(BENCH_REPEATS, [&] { Color::BlendOverPremultiplied(source.data(), dest.data(), ColorOrder::RGBA, BENCH_COUNT); Consume(dest[7]); }));
+    }
+}
+
+/// @brief Color 픽셀 배열 커널 테스트 진입점
+/// @note 사용법: ColorTest [--no-bench]
+///       커널 경로는 빌드 시점에 정해지므로 기본(SSE2), -mavx2, -DNEOXOPS_DISABLE_SIMD로 각각 빌드해 실행해야 모든 경로가 검사됩니다.
+int main(int argc, char* argv[]) {
+#if defined(NEOXOPS_SIMD_AVX2) && (defined(__GNUC__) || defined(__clang__))
+    if (!__builtin_cpu_supports("avx2")) {
+        std::printf("ColorTest: AVX2 build skipped (CPU does not support AVX2)\n");
+        return 0;
+    }
+#endif
+
+    std::printf("kernel path: %s\n", PATH_NAME);
+
+    // 레인 수(1, 4, 8)의 배수 전후와 빈 배열
+    const size_t counts[] = { 0U, 1U, 3U, 4U, 5U, 7U, 8U, 9U, 15U, 16U, 17U, 31U, 33U, 1000U, 4099U };
+    for (size_t count : counts) {
+        checkKernels(count);
+    }
+    checkEdges();
+
+    if (argc < 2 || std::string(argv[1]) != "--no-bench") {
+        benchmark();
+    }
+
+    return Finish("ColorTest");
+}
\ No newline at end of file
@@ -0,0 +1,265 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "Scene/EntityRegistry.hpp"
+#include "TestCommon.hpp"
+
+using namespace tests;
+using namespace scene;
+
+namespace {
+    constexpr uint32_t WORKER_COUNT     = 3U;       ///< 작업 스레드 수 (하드웨어 스레드 수와 무관하게 고정)
+    constexpr uint32_t STRESS_STEPS     = 20000U;   ///< 무작위 연산 수
+    constexpr uint32_t BENCH_ENTITIES   = 100000U;  ///< 벤치마크 개체 수
+    constexpr int32_t BENCH_REPEATS     = 20;       ///< 벤치마크 반복 횟수
+
+    struct Position final {
+        float X = 0.0f, Y = 0.0f, Z = 0.0f;
+    };
+
+    struct Velocity final {
+        float X = 0.0f, Y = 0.0f, Z = 0.0f;
+    };
+
+    /// @brief 이동만 가능한 컴포넌트 (빈자리 채우기가 복사 없이 소유권을 옮기는지 확인)
+    struct Name final {
+        std::unique_ptr<uint32_t> Value;
+    };
+
+    /// @brief 기준 모델의 개체 상태
+    struct Model final {
+        bool HasPosition = false;
+        bool HasVelocity = false;
+        bool HasName = false;
+        float Value = 0.0f;             ///< Position.X, Velocity.Y에 기록한 값
+        uint32_t NameValue = 0U;        ///< Name에 기록한 값
+    };
+
+    std::mt19937 g_Random(20U);
+
+    /// @brief 생성, 파괴, 세대 재사용을 확인합니다.
+    void checkLifetime() {
+        EntityRegistry registry;
+        Check(!registry.IsAlive(Entity{}) && !registry.Destroy(Entity{}), "invalid handle is never alive");
+
+        const Entity a = registry.Create();
+        const Entity b = registry.Create();
+        Check(a.IsValid() && b.IsValid() && a != b && registry.IsAlive(a) && registry.IsAlive(b) && registry.GetCount() == 2U, "Create returns distinct live entities");
+
+        Check(registry.Destroy(a) && !registry.Destroy(a) && !registry.IsAlive(a) && registry.GetCount() == 1U, "Destroy succeeds once");
+
+        const Entity reused = registry.Create();
+        Check(reused.GetIndex() == a.GetIndex() && reused.GetGeneration() == a.GetGeneration() + 1U, "destroyed slot is reused with the next generation");
+        Check(registry.IsAlive(reused) && !registry.IsAlive(a) && !registry.Destroy(a), "stale handle stays dead after its slot is reused");
+
+        // 세대는 12비트에서 되돌아가지만 0이 아닌 식별자를 유지
+        Entity cycled = reused;
+        for (uint32_t i = 0U; i < Entity::GENERATION_MASK + 1U; ++i) {
+            (void)registry.Destroy(cycled);
+            cycled = registry.Create();
+        }
+        Check(cycled.IsValid() && cycled.GetIndex() == a.GetIndex() && cycled.GetGeneration() == reused.GetGeneration(), "generation wraps within GENERATION_MASK");
+
+        registry.Clear();
+        Check(registry.GetCount() == 0U && !registry.IsAlive(b) && !registry.IsAlive(cycled), "Clear kills every entity");
+        const Entity afterClear = registry.Create();
+        Check(afterClear.GetIndex() == 0U && afterClear != a && afterClear != reused && !registry.IsAlive(b), "Clear reuses slots without reviving old handles");
+    }
+
+    /// @brief 컴포넌트 추가, 교체, 제거와 파괴 시 제거를 확인합니다.
+    void checkComponents() {
+        EntityRegistry registry;
+        std::vector<Entity> entities;
+        for (uint32_t i = 0U; i < 8U; ++i) {
+            entities.push_back(registry.Create());
+            registry.AddComponent<Position>(entities.back(), Position{ static_cast<float>(i), 0.0f, 0.0f });
+        }
+        ComponentPool<Position>* pool = registry.GetPool<Position>();
+        Check(pool && pool->GetSize() == 8U && registry.GetPool<Velocity>() == nullptr, "pools are created on first use");
+
+        // 가운데를 제거하면 마지막 요소가 빈자리를 채움
+        Check(registry.RemoveComponent<Position>(entities[2]) && !registry.RemoveComponent<Position>(entities[2]), "RemoveComponent succeeds once");
+        Check(pool->GetSize() == 7U && pool->GetEntities()[2] == entities[7] && pool->GetData()[2].X == 7.0f, "swap-remove moves the last component into the gap");
+        bool mapped = true;
+        for (uint32_t i = 0U; i < 8U; ++i) {
+            const Position* position = registry.GetComponent<Position>(entities[i]);
+            mapped = mapped && ((i == 2U) ? position == nullptr : (position && position->X == static_cast<float>(i)));
+        }
+        Check(mapped, "every remaining entity still finds its own component");
+
+        Position* replaced = registry.AddComponent<Position>(entities[7], Position{ 70.0f, 0.0f, 0.0f });
+        Check(replaced && replaced->X == 70.0f && pool->GetSize() == 7U, "adding an existing component replaces it");
+
+        registry.AddComponent<Velocity>(entities[3]);
+        (void)registry.Destroy(entities[3]);
+        Check(!registry.GetComponent<Position>(entities[3]) && registry.GetPool<Velocity>()->GetSize() == 0U && pool->GetSize() == 6U, "Destroy removes the entity from every pool");
+        Check(registry.AddComponent<Position>(entities[3]) == nullptr && !registry.RemoveComponent<Position>(entities[3]), "dead entity cannot gain or lose components");
+
+        const Entity reused = registry.Create();
+        Check(reused.GetIndex() == entities[3].GetIndex() && !registry.HasComponent<Position>(reused) && !registry.HasComponent<Velocity>(reused),
+            "reused slot starts without components");
+
+        // 이동 전용 컴포넌트
+        registry.AddComponent<Name>(entities[0], Name{ std::make_unique<uint32_t>(100U) });
+        registry.AddComponent<Name>(entities[1], Name{ std::make_unique<uint32_t>(101U) });
+        registry.AddComponent<Name>(entities[4], Name{ std::make_unique<uint32_t>(104U) });
+        (void)registry.RemoveComponent<Name>(entities[0]);
+        const Name* name = registry.GetComponent<Name>(entities[4]);
+        Check(name && name->Value && *name->Value == 104U && *registry.GetComponent<Name>(entities[1])->Value == 101U, "move-only components survive swap-remove");
+    }
+
+    /// @brief 무작위 연산을 기준 모델과 비교하며 순회 결과를 확인합니다.
+    void checkStress(system::JobSystem& jobs) {
+        EntityRegistry registry;
+        std::map<uint32_t, Model> model;            // 살아있는 개체 식별자 → 상태
+        std::vector<Entity> dead;
+
+        bool consistent = true, viewsMatch = true;
+        for (uint32_t step = 0U; step < STRESS_STEPS; ++step) {
+            const uint32_t op = g_Random() % 10U;
+            if (op < 3U || model.empty()) {
+                const Entity entity = registry.Create();
+                consistent = consistent && entity.IsValid() && model.count(entity.ID) == 0U;
+                model[entity.ID] = {};
+                continue;
+            }
+
+            auto it = model.begin();
+            std::advance(it, g_Random() % model.size());
+            const Entity entity{ it->first };
+            Model& state = it->second;
+            const float value = static_cast<float>(step);
+
+            switch (op) {
+            case 3U:
+                consistent = consistent && registry.Destroy(entity);
+                dead.push_back(entity);
+                model.erase(it);
+                break;
+            case 4U:
+                registry.AddComponent<Position>(entity, Position{ value, 0.0f, 0.0f });
+                state.HasPosition = true;
+                state.Value = value;
+                if (state.HasVelocity) {
+                    registry.GetComponent<Velocity>(entity)->Y = value;
+                }
+                break;
+            case 5U:
+                registry.AddComponent<Velocity>(entity, Velocity{ 0.0f, value, 0.0f });
+                state.HasVelocity = true;
+                state.Value = value;
+                if (state.HasPosition) {
+                    registry.GetComponent<Position>(entity)->X = value;
+                }
+                break;
+            case 6U:
+                consistent = consistent && registry.RemoveComponent<Position>(entity) == state.HasPosition;
+                state.HasPosition = false;
+                break;
+            case 7U:
+                consistent = consistent && registry.RemoveComponent<Velocity>(entity) == state.HasVelocity;
+                state.HasVelocity = false;
+                break;
+            case 8U:
+                registry.AddComponent<Name>(entity, Name{ std::make_unique<uint32_t>(step) });
+                state.HasName = true;
+                state.NameValue = step;
+                break;
+            default:
+                consistent = consistent && registry.RemoveComponent<Name>(entity) == state.HasName;
+                state.HasName = false;
+                break;
+            }
+
+            // 주기적으로 순회 결과를 기준 모델과 비교
+            if (step % 500U == 499U) {
+                std::vector<uint32_t> expected;
+                for (const auto& [id, entry] : model) {
+                    if (entry.HasPosition && entry.HasVelocity) {
+                        expected.push_back(id);
+                    }
+                }
+
+                std::vector<uint32_t> visited;
+                bool values = true;
+                registry.Each<Velocity, Position>([&](Entity e, Velocity& velocity, Position& position) {
+                    visited.push_back(e.ID);
+                    const Model& entry = model[e.ID];
+                    values = values && velocity.Y == entry.Value && position.X == entry.Value;
+                });
+                std::sort(visited.begin(), visited.end());
+
+                std::atomic<uint32_t> parallelCount{ 0U };
+                registry.ParallelEach<Position, Velocity>(&jobs, [&](Entity, Position& position, Velocity& velocity) {
+                    parallelCount.fetch_add(position.X == velocity.Y ? 1U : 0U, std::memory_order_relaxed);
+                }, 7U);
+
+                viewsMatch = viewsMatch && values && visited == expected && parallelCount.load() == expected.size();
+            }
+        }
+
+        for (const auto& [id, entry] : model) {
+            const Entity entity{ id };
+            const Position* position = registry.GetComponent<Position>(entity);
+            const Velocity* velocity = registry.GetComponent<Velocity>(entity);
+            const Name* name = registry.GetComponent<Name>(entity);
+            consistent = consistent && registry.IsAlive(entity) && (position != nullptr) == entry.HasPosition && (velocity != nullptr) == entry.HasVelocity
+                && (name != nullptr) == entry.HasName && (!name || *name->Value == entry.NameValue);
+        }
+        for (const Entity entity : dead) {
+            consistent = consistent && (model.count(entity.ID) != 0U || !registry.IsAlive(entity));
+        }
+        Check(consistent && registry.GetCount() == model.size(), "random operations match the reference model");
+        Check(viewsMatch, "Each and ParallelEach visit exactly the entities with every component after removals");
+    }
+
+    /// @brief 순회 시간을 잽니다.
+    void benchmark(system::JobSystem& jobs) {
+        EntityRegistry registry;
+        for (uint32_t i = 0U; i < BENCH_ENTITIES; ++i) {
+            const Entity entity = registry.Create();
+            registry.AddComponent<Position>(entity);
+            if (i % 2U == 0U) {
+                registry.AddComponent<Velocity>(entity, Velocity{ 1.0f, 2.0f, 3.0f });
+            }
+        }
+
+        const auto integrate = [](Entity, Velocity& velocity, Position& position) noexcept {
+            position.X += velocity.X * 0.016f;
+            position.Y += velocity.Y * 0.016f;
+            position.Z += velocity.Z * 0.016f;
+        };
+        const double serial = MeasureBest(BENCH_REPEATS, [&] { registry.Each<Velocity, Position>(integrate); });
+        const double parallel = MeasureBest(BENCH_REPEATS, [&] { registry.ParallelEach<Velocity, Position>(&jobs, integrate); });
+        Consume(registry.GetPool<Position>()->GetData()[0].X);
+
+        std::printf("benchmark (%u entities, %u with velocity, %u threads)\n", BENCH_ENTITIES, BENCH_ENTITIES / 2U, jobs.GetThreadCount());
+        std::printf("  Each          %8.3f ms\n", serial * 1e3);
+        std::printf("  ParallelEach  %8.3f ms\n", parallel * 1e3);
+    }
+}
+
+/// @brief EntityRegistry 테스트 진입점
+/// @note 사용법: EntityRegistryTest [--no-bench]
+int main(int argc, char* argv[]) {
+    system::JobSystem jobs;
+    if (!Check(jobs.Initialize(WORKER_COUNT), "JobSystem initializes")) {
+        return Finish("EntityRegistryTest");
+    }
+
+    checkLifetime();
+    checkComponents();
+    checkStress(jobs);
+
+    if (argc < 2 || std::string(argv[1]) != "--no-bench") {
+        benchmark(jobs);
+    }
+
+    jobs.Shutdown();
+    return Finish("EntityRegistryTest");
+}
\ No newline at end of file
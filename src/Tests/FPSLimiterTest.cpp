@@ -0,0 +1,82 @@
+#include <cstdio>
+#include <string>
+#include "System/FPSLimiter.hpp"
+#include "TestCommon.hpp"
+
+using namespace tests;
+
+namespace {
+    constexpr uint32_t TARGET_FPS       = 120U;     ///< 페이싱 검사의 목표 FPS
+    constexpr uint32_t PACING_FRAMES    = 240U;     ///< 페이싱 검사의 프레임 수 (약 2초)
+    constexpr double MEAN_TOLERANCE     = 0.05;     ///< 평균 프레임 시간의 허용 오차 비율
+    constexpr double P99_LIMIT          = 2.0;      ///< 99 백분위 프레임 시간의 상한 (목표 간격의 배수)
+
+    /// @brief 프레임 하나를 진행합니다.
+    void runFrame(system::FPSLimiter& limiter) noexcept {
+        limiter.StartFrame();
+        limiter.EndFrame(false);
+    }
+
+    /// @brief 통계가 FPS_UPDATE_INTERVAL 전에도 UpdateFrameTimeStats로 최신이 되는지 확인합니다.
+    void checkStatsRefresh() noexcept {
+        system::FPSLimiter limiter(0U);
+        for (uint32_t i = 0U; i < 10U; ++i) {
+            runFrame(limiter);
+        }
+        Check(limiter.GetFrameTimeStats().SampleCount == 0U, "stats are only computed every FPS_UPDATE_INTERVAL");
+
+        limiter.UpdateFrameTimeStats();
+        const system::FrameTimeStats& stats = limiter.GetFrameTimeStats();
+        Check(stats.SampleCount == 9U && stats.Max >= stats.P50 && stats.P50 > 0.0, "UpdateFrameTimeStats covers every frame after the first");
+
+        limiter.ResetFrameTimeStats();
+        limiter.UpdateFrameTimeStats();
+        Check(limiter.GetFrameTimeStats().SampleCount == 0U, "ResetFrameTimeStats clears the samples");
+    }
+
+    /// @brief 목표 FPS로 프레임을 진행하고 통계를 취득합니다.
+    system::FrameTimeStats pace(bool hybridWait) noexcept {
+        system::FPSLimiter limiter(TARGET_FPS);
+        limiter.SetHybridWaitEnabled(hybridWait);
+        for (uint32_t i = 0U; i < PACING_FRAMES; ++i) {
+            runFrame(limiter);
+        }
+        limiter.UpdateFrameTimeStats();
+        return limiter.GetFrameTimeStats();
+    }
+
+    void printStats(const char* name, const system::FrameTimeStats& stats) noexcept {
+        std::printf("  %-10s mean %6.3f  p50 %6.3f  p99 %6.3f  max %6.3f ms, wake error p99 %6.3f  max %6.3f ms\n", name,
+            stats.Mean * 1e3, stats.P50 * 1e3, stats.P99 * 1e3, stats.Max * 1e3, stats.WakeErrorP99 * 1e3, stats.WakeErrorMax * 1e3);
+    }
+
+    /// @brief 하이브리드 대기의 페이싱을 확인합니다.
+    /// @note 목표 시각을 누적하므로 평균은 스케줄러와 관계없이 목표 간격에 맞아야 하지만, p99와 최댓값은 OS 스케줄링에 좌우됩니다.
+    ///       그래서 p99는 타이머 해상도 회귀(예: 15.6ms 단위 sleep)를 잡을 만큼만 느슨하게 검사합니다.
+    ///       부하가 걸린 단일 코어 Linux 컨테이너에서 p99 7.8ms, 최댓값 19.4ms까지 관측되었으므로 최댓값은 검사하지 않습니다.
+    void checkPacing(bool bench) noexcept {
+        const double target = 1.0 / static_cast<double>(TARGET_FPS);
+        const system::FrameTimeStats hybrid = pace(true);
+
+        Check(hybrid.SampleCount == PACING_FRAMES - 1U, "pacing records every frame after the first");
+        Check(hybrid.Mean > target * (1.0 - MEAN_TOLERANCE) && hybrid.Mean < target * (1.0 + MEAN_TOLERANCE), "mean frame time matches the target");
+        Check(hybrid.P99 < target * P99_LIMIT, "p99 frame time stays within the jitter bound");
+
+        std::printf("pacing (%u FPS target = %.3f ms, %u frames)\n", TARGET_FPS, target * 1e3, PACING_FRAMES);
+        printStats("hybrid", hybrid);
+        if (bench) {
+            printStats("sleep only", pace(false));
+        }
+    }
+}
+
+/// @brief FPSLimiter 테스트 진입점
+/// @note 사용법: FPSLimiterTest [--no-bench]
+int main(int argc, char* argv[]) {
+    const bool bench = argc < 2 || std::string(argv[1]) != "--no-bench";
+
+    checkStatsRefresh();
+    checkPacing(bench);
+
+    return Finish("FPSLimiterTest");
+}
\ No newline at end of file
@@ -0,0 +1,233 @@
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include "Graphics/GlbModel.hpp"
+#include "TestCommon.hpp"
+
+using namespace tests;
+using namespace graphics;
+
+namespace {
+    constexpr uint32_t GRID_SIZE        = 400U;     ///< 격자 메시 한 변의 정점 수
+    constexpr uint32_t NODE_COUNT       = 20000U;   ///< 노드 수 (JSON 크기를 키움)
+    constexpr int32_t BENCH_REPEATS     = 10;       ///< 벤치마크 반복 횟수
+
+    /// @brief 테스트용 GLB
+    struct Asset final {
+        std::vector<byte_t> File;               ///< GLB 파일 내용
+        size_t JsonOffset = 0U;                 ///< JSON 청크 시작 위치
+        size_t JsonSize = 0U;                   ///< JSON 청크 크기
+        size_t BinOffset = 0U;                  ///< BIN 청크 시작 위치
+        size_t BinSize = 0U;                    ///< BIN 청크 크기
+    };
+
+    void append(std::vector<byte_t>& data, const void* source, size_t size) {
+        const byte_t* bytes = static_cast<const byte_t*>(source);
+        data.insert(data.end(), bytes, bytes + size);
+    }
+
+    void appendU32(std::vector<byte_t>& data, uint32_t value) {
+        append(data, &value, sizeof(value));
+    }
+
+    /// @brief 섞인 삼각형 목록의 격자 메시와 노드 NODE_COUNT개를 가진 GLB를 만듭니다.
+    /// @note 재질 이름의 \u 이스케이프, extras의 \n 이스케이프, 노드 TRS를 포함합니다.
+    Asset makeAsset() {
+        std::vector<float> positions, normals, texCoords;
+        for (uint32_t y = 0U; y < GRID_SIZE; ++y) {
+            for (uint32_t x = 0U; x < GRID_SIZE; ++x) {
+                positions.insert(positions.end(), { static_cast<float>(x), static_cast<float>((x * y) % 7U), static_cast<float>(y) });
+                normals.insert(normals.end(), { 0.0f, 1.0f, 0.0f });
+                texCoords.insert(texCoords.end(), { static_cast<float>(x) / GRID_SIZE, static_cast<float>(y) / GRID_SIZE });
+            }
+        }
+
+        std::vector<std::array<uint32_t, 3>> triangles;
+        for (uint32_t y = 0U; y + 1U < GRID_SIZE; ++y) {
+            for (uint32_t x = 0U; x + 1U < GRID_SIZE; ++x) {
+                const uint32_t a = y * GRID_SIZE + x;
+                triangles.push_back({ a, a + GRID_SIZE, a + 1U });
+                triangles.push_back({ a + 1U, a + GRID_SIZE, a + GRID_SIZE + 1U });
+            }
+        }
+        std::mt19937 random(1U);
+        std::shuffle(triangles.begin(), triangles.end(), random);
+
+        std::vector<byte_t> bin;
+        const auto addView = [&bin](const void* source, size_t size) {
+            const size_t offset = bin.size();
+            append(bin, source, size);
+            bin.resize((bin.size() + 3U) & ~size_t(3U), 0U);
+            return "{\"buffer\":0,\"byteOffset\":" + std::to_string(offset) + ",\"byteLength\":" + std::to_string(size) + "}";
+        };
+        std::string views = addView(positions.data(), positions.size() * sizeof(float));
+        views += "," + addView(normals.data(), normals.size() * sizeof(float));
+        views += "," + addView(texCoords.data(), texCoords.size() * sizeof(float));
+        views += "," + addView(triangles.data(), triangles.size() * sizeof(triangles[0]));
+
+        const std::string vertexCount = std::to_string(GRID_SIZE * GRID_SIZE);
+        std::string json = "{\"asset\":{\"version\":\"2.0\"},\"buffers\":[{\"byteLength\":" + std::to_string(bin.size()) + "}],\"bufferViews\":[" + views + "],";
+        json += "\"accessors\":[{\"bufferView\":0,\"componentType\":5126,\"count\":" + vertexCount + ",\"type\":\"VEC3\",\"min\":[0,0,0],\"max\":[1,1,1]},"
+            "{\"bufferView\":1,\"componentType\":5126,\"count\":" + vertexCount + ",\"type\":\"VEC3\"},"
+            "{\"bufferView\":2,\"componentType\":5126,\"count\":" + vertexCount + ",\"type\":\"VEC2\"},"
+            "{\"bufferView\":3,\"componentType\":5125,\"count\":" + std::to_string(triangles.size() * 3U) + ",\"type\":\"SCALAR\"}],";
+        json += "\"meshes\":[{\"name\":\"grid\",\"primitives\":[{\"attributes\":{\"POSITION\":0,\"NORMAL\":1,\"TEXCOORD_0\":2},\"indices\":3,\"material\":0}]}],";
+        json += "\"materials\":[{\"name\":\"m\\u00e9tal\",\"pbrMetallicRoughness\":{\"baseColorFactor\":[1,0.5,0.25,1]}}],\"nodes\":[";
+        for (uint32_t i = 0U; i < NODE_COUNT; ++i) {
+            json += (i > 0U) ? "," : "";
+            json += "{\"name\":\"node_" + std::to_string(i) + "\",\"mesh\":0,\"translation\":[1.5," + std::to_string(i * 0.25) + ",-3.75],"
+                "\"rotation\":[0,0.7071068,0,0.7071068],\"scale\":[1,1,1],\"extras\":{\"tag\":\"static\\nprop\",\"lod\":[0,1,2]}}";
+        }
+        json += "]}";
+        json.resize((json.size() + 3U) & ~size_t(3U), ' ');
+
+        Asset asset;
+        appendU32(asset.File, GlbModel::MAGIC);
+        appendU32(asset.File, GlbModel::VERSION);
+        appendU32(asset.File, static_cast<uint32_t>(12U + 8U + json.size() + 8U + bin.size()));
+        appendU32(asset.File, static_cast<uint32_t>(json.size()));
+        appendU32(asset.File, GlbModel::CHUNK_JSON);
+        asset.JsonOffset = asset.File.size();
+        asset.JsonSize = json.size();
+        append(asset.File, json.data(), json.size());
+        appendU32(asset.File, static_cast<uint32_t>(bin.size()));
+        appendU32(asset.File, GlbModel::CHUNK_BIN);
+        asset.BinOffset = asset.File.size();
+        asset.BinSize = bin.size();
+        append(asset.File, bin.data(), bin.size());
+        return asset;
+    }
+
+    /// @brief 삼각형을 꼭짓점 위치로 나타내고, 감는 방향을 유지한 채 가장 작은 꼭짓점부터 시작하도록 돌립니다.
+    std::vector<std::array<float, 9>> triangleSet(const MeshData& mesh) {
+        std::vector<std::array<float, 9>> result;
+        for (size_t i = 0U; i + 2U < mesh.Indices.size(); i += 3U) {
+            std::array<std::array<float, 3>, 3> corners;
+            for (size_t k = 0U; k < 3U; ++k) {
+                const MeshVertex& vertex = mesh.Vertices[mesh.Indices[i + k]];
+                corners[k] = { vertex.X, vertex.Y, vertex.Z };
+            }
+            std::rotate(corners.begin(), std::min_element(corners.begin(), corners.end()), corners.end());
+            result.push_back({ corners[0][0], corners[0][1], corners[0][2], corners[1][0], corners[1][1], corners[1][2], corners[2][0], corners[2][1], corners[2][2] });
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    void checkJson() {
+        system::JsonDocument document;
+        const std::string text = "{\"a\":\"x\\ud83d\\ude00y\",\"b\":[1,2,{\"c\":null}],\"d\":-1.5e3,\"e\":true,\"f\":\"plain\"}";
+        Check(document.Parse(text.data(), text.size()), "JSON parses");
+        const system::JsonValue& root = document.GetRoot();
+        Check(root["a"].GetString() == "x\xF0\x9F\x98\x80y", "surrogate pair decodes to UTF-8");
+        Check(root["b"].GetSize() == 3U && root["b"][1].GetInt() == 2 && root["b"][2]["c"].IsNull(), "nested array and object");
+        Check(root["d"].GetNumber() == -1500.0 && root["e"].GetBool(), "number and bool");
+        Check(root["f"].GetString().data() > text.data() && root["f"].GetString().data() < text.data() + text.size(), "unescaped string points into the source text");
+        Check(root["missing"]["deeper"][3].IsNull(), "missing members read as null");
+
+        const char* invalid[] = { "{\"a\":[1,2,}", "{\"a\" 1}", "[1,2", "\"\\u12G4\"", "{} x", "" };
+        for (const char* json : invalid) {
+            Check(!document.Parse(json, std::strlen(json)) && document.GetRoot().IsNull(), (std::string("invalid JSON is rejected: ") + json).c_str());
+        }
+
+        const std::string deep = std::string(system::JsonDocument::MAX_DEPTH + 1U, '[') + std::string(system::JsonDocument::MAX_DEPTH + 1U, ']');
+        Check(!document.Parse(deep.data(), deep.size()), "nesting deeper than MAX_DEPTH is rejected");
+    }
+
+    void checkModel(const Asset& asset) {
+        GlbModel model;
+        if (!Check(model.Parse(asset.File.data(), asset.File.size()), "GLB parses")) {
+            return;
+        }
+
+        Check(model.GetNodes().size() == NODE_COUNT && model.GetNodes()[5].Name == "node_5", "every node is read");
+        const Matrix4x4F& local = model.GetNodes()[5].Local;
+        Check(local.M[3][0] == 1.5f && local.M[3][1] == 1.25f && local.M[3][2] == -3.75f, "node translation");
+        Check(model.GetMeshes().size() == 1U && model.GetMeshes()[0].Name == "grid", "mesh name");
+        Check(model.GetMaterials().size() == 1U && model.GetMaterials()[0].Name == "m\xC3\xA9tal" && model.GetMaterials()[0].BaseColor[1] == 0.5f, "material with escaped name");
+
+        const GltfAccessor& positions = model.GetAccessors()[0];
+        Check(positions.Data.data() == asset.File.data() + asset.BinOffset && positions.Count == GRID_SIZE * GRID_SIZE, "accessor points into the BIN chunk without a copy");
+
+        MeshData plain, optimized;
+        Check(model.BuildMesh(0U, plain, { true, false }) && model.BuildMesh(0U, optimized), "BuildMesh succeeds");
+        const size_t triangleCount = (GRID_SIZE - 1U) * (GRID_SIZE - 1U) * 2U;
+        Check(plain.Indices.size() == triangleCount * 3U && optimized.Indices.size() == triangleCount * 3U, "every triangle is converted");
+        Check(triangleSet(plain) == triangleSet(optimized), "optimization keeps the triangle set and winding");
+
+        const float before = MeshOptimizer::GetACMR(plain.Indices.data(), plain.Indices.size(), MeshOptimizer::CACHE_SIZE);
+        const float after = MeshOptimizer::GetACMR(optimized.Indices.data(), optimized.Indices.size(), MeshOptimizer::CACHE_SIZE);
+        std::printf("ACMR (%u-entry cache): shuffled %.3f -> optimized %.3f\n", MeshOptimizer::CACHE_SIZE, before, after);
+        Check(after < before * 0.5f, "vertex cache optimization lowers ACMR");
+
+        std::vector<byte_t> corrupt = asset.File;
+        corrupt[4] = 3U;
+        Check(!model.Parse(corrupt.data(), corrupt.size()), "unsupported version is rejected");
+        Check(!model.Parse(asset.File.data(), asset.File.size() / 2U), "truncated file is rejected");
+        Check(!model.Parse(asset.File.data(), 11U), "short header is rejected");
+    }
+
+    /// @brief JSON 파싱, GLB 파싱, 파일 불러오기, 메시 변환 시간을 잽니다.
+    void benchmark(const Asset& asset) {
+        const std::string path = (std::filesystem::temp_directory_path() / "NeoXOPS_GlbModelTest.glb").string();
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(asset.File.data()), static_cast<std::streamsize>(asset.File.size()));
+        }
+
+        system::JsonDocument document;
+        GlbModel model;
+        const char* json = reinterpret_cast<const char*>(asset.File.data() + asset.JsonOffset);
+        const double jsonTime = MeasureBest(BENCH_REPEATS, [&] {
+            Consume(document.Parse(json, asset.JsonSize));
+        });
+        const double parseTime = MeasureBest(BENCH_REPEATS, [&] {
+            Consume(model.Parse(asset.File.data(), asset.File.size()));
+        });
+        const double loadTime = MeasureBest(BENCH_REPEATS, [&] {
+            Consume(model.Load(path));
+        });
+
+        MeshData mesh;
+        const double buildTime = MeasureBest(3, [&] {
+            Consume(model.BuildMesh(0U, mesh, { true, false }));
+        });
+        const double optimizeTime = MeasureBest(3, [&] {
+            Consume(model.BuildMesh(0U, mesh));
+        });
+
+        const double jsonMB = asset.JsonSize / 1e6;
+        std::printf("benchmark (JSON %.2f MB, BIN %.2f MB, %u nodes, best of %d)\n", jsonMB, asset.BinSize / 1e6, NODE_COUNT, BENCH_REPEATS);
+        std::printf("  JsonDocument::Parse  %8.2f ms  %7.1f MB/s  (arena %zu KB)\n", jsonTime * 1e3, jsonMB / jsonTime, document.GetArenaSize() / 1024U);
+        std::printf("  GlbModel::Parse      %8.2f ms  %7.1f MB/s of JSON\n", parseTime * 1e3, jsonMB / parseTime);
+        std::printf("  GlbModel::Load       %8.2f ms  (mapped file)\n", loadTime * 1e3);
+        std::printf("  BuildMesh            %8.2f ms  (%zu vertices, %zu triangles)\n", buildTime * 1e3, mesh.Vertices.size(), mesh.Indices.size() / 3U);
+        std::printf("  BuildMesh + optimize %8.2f ms\n", optimizeTime * 1e3);
+
+        model.Clear();
+        std::error_code error;
+        std::filesystem::remove(path, error);
+    }
+}
+
+/// @brief GlbModel, JsonDocument 테스트 진입점
+/// @note 사용법: GlbModelTest [--no-bench]
+///       큰 합성 GLB(격자 메시와 노드 2만 개)를 만들어 파싱 결과를 확인하고 처리량을 잽니다.
+int main(int argc, char* argv[]) {
+    checkJson();
+
+    const Asset asset = makeAsset();
+    checkModel(asset);
+
+    if (argc < 2 || std::string(argv[1]) != "--no-bench") {
+        benchmark(asset);
+    }
+
+    return Finish("GlbModelTest");
+}
\ No newline at end of file
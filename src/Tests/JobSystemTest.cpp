@@ -0,0 +1,231 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "System/JobSystem.hpp"
+#include "TestCommon.hpp"
+
+using namespace tests;
+
+namespace {
+    constexpr uint32_t WORKER_COUNT     = 3U;       ///< 작업 스레드 수 (하드웨어 스레드 수와 무관하게 고정)
+    constexpr uint32_t FIB_INPUT        = 22U;      ///< 피보나치 검사 입력
+    constexpr uint32_t FIB_CUTOFF       = 10U;      ///< 이보다 작으면 작업을 나누지 않음
+    constexpr uint32_t STRESS_ROUNDS    = 200U;     ///< 훔치기 스트레스 반복 횟수
+    constexpr uint32_t STRESS_JOBS      = 256U;     ///< 반복마다 예약하는 작업 수 (작업마다 자식 2개)
+    constexpr uint32_t OVERFLOW_JOBS    = 10000U;   ///< 작업 덱 용량(4096)을 넘기는 작업 수
+
+    uint64_t fibSerial(uint32_t n) noexcept {
+        return (n < 2U) ? n : fibSerial(n - 1U) + fibSerial(n - 2U);
+    }
+
+    /// @brief 재귀적으로 작업을 나누고 자식마다 Wait하는 피보나치
+    /// @note 작업 스레드 안의 Wait는 다른 작업을 처리하며 기다리므로 중첩된 대기가 만들어집니다.
+    uint64_t fibJobs(system::JobSystem& jobs, uint32_t n) noexcept {
+        if (n < FIB_CUTOFF) {
+            return fibSerial(n);
+        }
+
+        uint64_t lhs = 0ULL, rhs = 0ULL;
+        system::JobCounter counter;
+        jobs.Run([&] { lhs = fibJobs(jobs, n - 1U); }, &counter);
+        jobs.Run([&] { rhs = fibJobs(jobs, n - 2U); }, &counter);
+        jobs.Wait(counter);
+        return lhs + rhs;
+    }
+
+    void checkFib(system::JobSystem& jobs) {
+        Check(fibJobs(jobs, FIB_INPUT) == fibSerial(FIB_INPUT), "recursive fib with nested waits");
+
+        // 카운터 하나로 자식까지 기다리는 fork-join
+        std::atomic<uint32_t> leaves{ 0U };
+        system::JobCounter counter;
+        for (uint32_t i = 0U; i < 16U; ++i) {
+            jobs.Run([&] {
+                for (uint32_t k = 0U; k < 16U; ++k) {
+                    jobs.Run([&] { leaves.fetch_add(1U, std::memory_order_relaxed); }, &counter);
+                }
+            }, &counter);
+        }
+        jobs.Wait(counter);
+        Check(leaves.load() == 256U && counter.IsDone(), "waiting on the parent counter includes child jobs");
+    }
+
+    /// @brief ParallelFor가 모든 인덱스를 정확히 한 번씩 처리하는지 확인합니다.
+    void checkParallelFor(system::JobSystem& jobs) {
+        struct Case final {
+            uint32_t Begin, End, Grain;
+        };
+        constexpr Case CASES[] = {
+            { 0U, 1U, 0U }, { 0U, 1000U, 0U }, { 7U, 1000U, 1U }, { 3U, 1003U, 13U },
+            { 0U, 4097U, 64U }, { 100U, 200U, 1000U }, { 5U, 5U, 1U }, { 0U, 100000U, 0U },
+        };
+
+        bool exact = true;
+        for (const Case& range : CASES) {
+            std::unique_ptr<std::atomic<uint32_t>[]> hits(new std::atomic<uint32_t>[range.End + 1U]);
+            for (uint32_t i = 0U; i <= range.End; ++i) {
+                hits[i].store(0U, std::memory_order_relaxed);
+            }
+
+            jobs.ParallelFor(range.Begin, range.End, range.Grain, [&](uint32_t first, uint32_t last) {
+                for (uint32_t i = first; i < last; ++i) {
+                    hits[i].fetch_add(1U, std::memory_order_relaxed);
+                }
+            });
+
+            for (uint32_t i = 0U; i <= range.End; ++i) {
+                exact = exact && hits[i].load() == ((i >= range.Begin && i < range.End) ? 1U : 0U);
+            }
+        }
+        Check(exact, "ParallelFor touches every index exactly once");
+
+        // 작업 안에서 호출한 ParallelFor
+        std::atomic<uint64_t> sum{ 0ULL };
+        system::JobCounter counter;
+        for (uint32_t j = 0U; j < 8U; ++j) {
+            jobs.Run([&] {
+                jobs.ParallelFor(0U, 1000U, 10U, [&](uint32_t first, uint32_t last) {
+                    uint64_t local = 0ULL;
+                    for (uint32_t i = first; i < last; ++i) {
+                        local += i;
+                    }
+                    sum.fetch_add(local, std::memory_order_relaxed);
+                });
+            }, &counter);
+        }
+        jobs.Wait(counter);
+        Check(sum.load() == 8ULL * 999ULL * 1000ULL / 2ULL, "nested ParallelFor inside jobs");
+    }
+
+    /// @brief 작업 스레드와 등록되지 않은 스레드에서 예약한 메인 스레드 작업이 메인 스레드에서만 실행되는지 확인합니다.
+    void checkMainThread(system::JobSystem& jobs) {
+        const std::thread::id mainThread = std::this_thread::get_id();
+        std::atomic<uint32_t> onMain{ 0U }, offMain{ 0U };
+        const auto record = [&] {
+            (std::this_thread::get_id() == mainThread ? onMain : offMain).fetch_add(1U, std::memory_order_relaxed);
+        };
+
+        system::JobCounter counter;
+        for (uint32_t i = 0U; i < 32U; ++i) {
+            jobs.Run([&] { jobs.RunOnMainThread(record, &counter); }, &counter);
+        }
+        std::thread external([&] {
+            for (uint32_t i = 0U; i < 32U; ++i) {
+                jobs.RunOnMainThread(record, &counter);
+            }
+        });
+        external.join();
+        jobs.Wait(counter);
+        Check(onMain.load() == 64U && offMain.load() == 0U, "RunOnMainThread jobs run on the main thread only");
+
+        // 메인 스레드가 아니면 처리하지 않음
+        uint32_t processed = 1U;
+        jobs.RunOnMainThread(record);
+        std::thread([&] { processed = jobs.ProcessMainThreadJobs(); }).join();
+        Check(processed == 0U && jobs.ProcessMainThreadJobs() == 1U, "ProcessMainThreadJobs does nothing off the main thread");
+    }
+
+    /// @brief 작업마다 자식을 예약하게 하여 훔치기와 덱 경합을 반복합니다.
+    /// @note 경합 검사기(-fsanitize=thread)로 빌드해 실행하면 덱과 깨우기의 데이터 경합도 함께 검사됩니다.
+    void checkStealStress(system::JobSystem& jobs) {
+        std::atomic<uint32_t> executed{ 0U };
+        bool complete = true;
+        for (uint32_t round = 0U; round < STRESS_ROUNDS; ++round) {
+            system::JobCounter counter;
+            const uint32_t before = executed.load();
+
+            // 등록되지 않은 스레드는 전역 큐로 예약
+            std::thread external([&] {
+                for (uint32_t i = 0U; i < STRESS_JOBS / 4U; ++i) {
+                    jobs.Run([&] { executed.fetch_add(1U, std::memory_order_relaxed); }, &counter);
+                }
+            });
+            for (uint32_t i = 0U; i < STRESS_JOBS; ++i) {
+                jobs.Run([&] {
+                    executed.fetch_add(1U, std::memory_order_relaxed);
+                    jobs.Run([&] { executed.fetch_add(1U, std::memory_order_relaxed); }, &counter);
+                    jobs.Run([&] { executed.fetch_add(1U, std::memory_order_relaxed); }, &counter);
+                }, &counter);
+            }
+            external.join();
+            jobs.Wait(counter);
+            complete = complete && executed.load() - before == STRESS_JOBS * 3U + STRESS_JOBS / 4U;
+        }
+        Check(complete, "steal stress runs every job once per round");
+
+        // 덱이 가득 차면 예약한 스레드에서 바로 실행
+        system::JobCounter counter;
+        std::atomic<uint32_t> overflow{ 0U };
+        for (uint32_t i = 0U; i < OVERFLOW_JOBS; ++i) {
+            jobs.Run([&] { overflow.fetch_add(1U, std::memory_order_relaxed); }, &counter);
+        }
+        jobs.Wait(counter);
+        Check(overflow.load() == OVERFLOW_JOBS, "jobs beyond the deque capacity still run");
+    }
+
+    /// @brief 종료 시 남은 작업을 처리하고, 종료 후 예약한 작업은 바로 실행되는지 확인합니다.
+    void checkShutdown() {
+        system::JobSystem jobs;
+        Check(jobs.Initialize(WORKER_COUNT) && !jobs.Initialize(WORKER_COUNT), "second Initialize is refused");
+
+        std::atomic<uint32_t> executed{ 0U };
+        for (uint32_t i = 0U; i < 100U; ++i) {
+            jobs.Run([&] { executed.fetch_add(1U, std::memory_order_relaxed); });
+        }
+        jobs.RunOnMainThread([&] { executed.fetch_add(1U, std::memory_order_relaxed); });
+        jobs.Shutdown();
+        Check(executed.load() == 101U, "Shutdown drains queued jobs");
+
+        system::JobCounter counter;
+        jobs.Run([&] { executed.fetch_add(1U, std::memory_order_relaxed); }, &counter);
+        Check(executed.load() == 102U && counter.IsDone(), "Run after Shutdown executes inline");
+    }
+
+    /// @brief 작업 예약과 대기 비용, 피보나치 시간을 잽니다.
+    void benchmark(system::JobSystem& jobs) {
+        constexpr uint32_t EMPTY_JOBS = 100000U;
+        const double emptyTime = MeasureBest(3, [&] {
+            system::JobCounter counter;
+            for (uint32_t i = 0U; i < EMPTY_JOBS; ++i) {
+                jobs.Run([] {}, &counter);
+            }
+            jobs.Wait(counter);
+        });
+
+        uint64_t result = 0ULL;
+        const double serialTime = MeasureBest(3, [&] { result = fibSerial(30U); });
+        const double jobTime = MeasureBest(3, [&] { result = fibJobs(jobs, 30U); });
+        Consume(result);
+
+        std::printf("benchmark (%u threads, %u hardware threads)\n", jobs.GetThreadCount(), std::max(1U, std::thread::hardware_concurrency()));
+        std::printf("  empty job    %8.1f ns/job\n", emptyTime * 1e9 / EMPTY_JOBS);
+        std::printf("  fib(30)      %8.2f ms serial, %8.2f ms jobs (cutoff %u)\n", serialTime * 1e3, jobTime * 1e3, FIB_CUTOFF);
+    }
+}
+
+/// @brief JobSystem 테스트 진입점
+/// @note 사용법: JobSystemTest [--no-bench]
+int main(int argc, char* argv[]) {
+    system::JobSystem jobs;
+    if (!Check(jobs.Initialize(WORKER_COUNT) && jobs.GetThreadCount() == WORKER_COUNT + 1U && jobs.IsMainThread(), "JobSystem initializes")) {
+        return Finish("JobSystemTest");
+    }
+
+    checkFib(jobs);
+    checkParallelFor(jobs);
+    checkMainThread(jobs);
+    checkStealStress(jobs);
+
+    if (argc < 2 || std::string(argv[1]) != "--no-bench") {
+        benchmark(jobs);
+    }
+
+    jobs.Shutdown();
+    checkShutdown();
+
+    return Finish("JobSystemTest");
+}
\ No newline at end of file
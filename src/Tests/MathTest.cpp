@@ -0,0 +1,393 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "Type/Matrix4x4F.hpp"
+#include "Type/QuaternionF.hpp"
+#include "Type/SIMD.hpp"
+#include "Type/Vector2F.hpp"
+#include "TestCommon.hpp"
+
+using namespace tests;
+
+namespace {
+    constexpr int32_t RANDOM_CASES  = 10000;    ///< 무작위 검사 횟수
+    constexpr size_t BATCH_COUNT    = 1003U;    ///< 일괄 연산 검사 요소 수 (4의 배수가 아니므로 나머지 경로 포함)
+    constexpr size_t BENCH_COUNT    = 4096U;    ///< 벤치마크 요소 수
+    constexpr int32_t BENCH_REPEATS = 30;       ///< 벤치마크 반복 횟수
+
+    std::mt19937 g_Random(1U);
+
+    float randomFloat(float min = -2.0f, float max = 2.0f) noexcept {
+        return std::uniform_real_distribution<float>(min, max)(g_Random);
+    }
+
+    Matrix4x4F randomMatrix() noexcept {
+        Matrix4x4F matrix;
+        for (auto& row : matrix.M) {
+            for (float& value : row) {
+                value = randomFloat();
+            }
+        }
+        return matrix;
+    }
+
+    QuaternionF randomQuaternion() noexcept {
+        return QuaternionF(randomFloat(), randomFloat(), randomFloat(), randomFloat()).Normalize();
+    }
+
+    /// @brief 스칼라 기준: 행렬 곱 (삼중 루프)
+    Matrix4x4F referenceMultiply(const Matrix4x4F& lhs, const Matrix4x4F& rhs) noexcept {
+        Matrix4x4F result;
+        for (int32_t i = 0; i < 4; ++i) {
+            for (int32_t j = 0; j < 4; ++j) {
+                float sum = 0.0f;
+                for (int32_t k = 0; k < 4; ++k) {
+                    sum += lhs.M[i][k] * rhs.M[k][j];
+                }
+                result.M[i][j] = sum;
+            }
+        }
+        return result;
+    }
+
+    /// @brief 스칼라 기준: 벡터 변환 (v * M)
+    Vector4F referenceTransform(const Vector4F& vec, const Matrix4x4F& matrix) noexcept {
+        const float in[4] = { vec.X, vec.Y, vec.Z, vec.W };
+        float out[4];
+        for (int32_t j = 0; j < 4; ++j) {
+            float sum = 0.0f;
+            for (int32_t k = 0; k < 4; ++k) {
+                sum += in[k] * matrix.M[k][j];
+            }
+            out[j] = sum;
+        }
+        return { out[0], out[1], out[2], out[3] };
+    }
+
+    /// @brief 스칼라 기준: 역행렬과 행렬식 (부분 피벗 가우스-조르단, double)
+    bool referenceInverse(const Matrix4x4F& matrix, Matrix4x4F& result, double* determinant = nullptr) noexcept {
+        double product = 1.0;
+        double a[4][8];
+        for (int32_t i = 0; i < 4; ++i) {
+            for (int32_t j = 0; j < 8; ++j) {
+                a[i][j] = (j < 4) ? matrix.M[i][j] : ((j - 4 == i) ? 1.0 : 0.0);
+            }
+        }
+
+        for (int32_t c = 0; c < 4; ++c) {
+            int32_t pivot = c;
+            for (int32_t r = c + 1; r < 4; ++r) {
+                pivot = (std::fabs(a[r][c]) > std::fabs(a[pivot][c])) ? r : pivot;
+            }
+            if (std::fabs(a[pivot][c]) < 1e-12) {
+                return false;
+            }
+            if (pivot != c) {
+                for (int32_t j = 0; j < 8; ++j) {
+                    std::swap(a[c][j], a[pivot][j]);
+                }
+                product = -product;
+            }
+            const double divisor = a[c][c];
+            product *= divisor;
+            for (int32_t j = 0; j < 8; ++j) {
+                a[c][j] /= divisor;
+            }
+            for (int32_t r = 0; r < 4; ++r) {
+                if (r != c) {
+                    const double factor = a[r][c];
+                    for (int32_t j = 0; j < 8; ++j) {
+                        a[r][j] -= factor * a[c][j];
+                    }
+                }
+            }
+        }
+
+        for (int32_t i = 0; i < 4; ++i) {
+            for (int32_t j = 0; j < 4; ++j) {
+                result.M[i][j] = static_cast<float>(a[i][j + 4]);
+            }
+        }
+        if (determinant != nullptr) {
+            *determinant = product;
+        }
+        return true;
+    }
+
+    /// @brief 스칼라 기준: 구면 선형 보간 (acos, sin)
+    QuaternionF referenceSlerp(const QuaternionF& start, QuaternionF end, float t) noexcept {
+        double cosine = QuaternionF::Dot(start, end);
+        if (cosine < 0.0) {
+            end = { -end.X, -end.Y, -end.Z, -end.W };
+            cosine = -cosine;
+        }
+        if (cosine > 0.99999) {
+            return QuaternionF::Nlerp(start, end, t);
+        }
+
+        const double theta = std::acos(cosine);
+        const double sine = std::sin(theta);
+        const double w0 = std::sin((1.0 - t) * theta) / sine;
+        const double w1 = std::sin(t * theta) / sine;
+        return {
+            static_cast<float>(start.X * w0 + end.X * w1), static_cast<float>(start.Y * w0 + end.Y * w1),
+            static_cast<float>(start.Z * w0 + end.Z * w1), static_cast<float>(start.W * w0 + end.W * w1),
+        };
+    }
+
+    double maxDifference(const Matrix4x4F& lhs, const Matrix4x4F& rhs) noexcept {
+        double difference = 0.0;
+        for (int32_t i = 0; i < 4; ++i) {
+            for (int32_t j = 0; j < 4; ++j) {
+                difference = std::max(difference, static_cast<double>(std::fabs(lhs.M[i][j] - rhs.M[i][j])));
+            }
+        }
+        return difference;
+    }
+
+    /// @brief 내적의 두 피연산자를 섞는 실수를 잡아냅니다.
+    /// @note 비대칭 값으로 비교하므로 lhs.X * lhs.Y 같은 오타는 다른 결과가 됩니다.
+    void checkDot() noexcept {
+        const Vector2F a2 = { 1.0f, 2.0f };
+        const Vector2F b2 = { 3.0f, 4.0f };
+        Check(Vector2F::Dot(a2, b2) == 1.0f * 3.0f + 2.0f * 4.0f, "Vector2F::Dot uses both operands");
+        Check(Vector2F::Dot(b2, a2) == Vector2F::Dot(a2, b2), "Vector2F::Dot is symmetric");
+
+        const Vector3F a3 = { 1.0f, 2.0f, 3.0f };
+        const Vector3F b3 = { 4.0f, 5.0f, 6.0f };
+        Check(Vector3F::Dot(a3, b3) == 1.0f * 4.0f + 2.0f * 5.0f + 3.0f * 6.0f, "Vector3F::Dot uses both operands");
+        Check(Vector3F::Dot(b3, a3) == Vector3F::Dot(a3, b3), "Vector3F::Dot is symmetric");
+        Check(Vector3F::Dot(Vector3F::Right(), Vector3F::Up()) == 0.0f, "Vector3F::Dot of orthogonal axes is zero");
+
+        const Vector4F a4 = { 1.0f, 2.0f, 3.0f, 4.0f };
+        const Vector4F b4 = { 5.0f, 6.0f, 7.0f, 8.0f };
+        Check(Vector4F::Dot(a4, b4) == 70.0f, "Vector4F::Dot uses both operands");
+
+        // LookAtLH는 내적으로 이동 성분을 구하므로 내적이 틀리면 눈 위치가 원점으로 가지 않음
+        const Vector3F eye = { 1.0f, 2.0f, -5.0f };
+        const Matrix4x4F view = Matrix4x4F::LookAtLH(eye, Vector3F::Zero(), Vector3F::Up());
+        Check(Vector3F::NearlyEquals(view.TransformPoint(eye), Vector3F::Zero()), "LookAtLH moves the eye to the origin");
+        Check(std::fabs(view.TransformPoint(Vector3F::Zero()).Z - std::sqrt(30.0f)) < 1e-5f, "LookAtLH puts the target on +Z at its distance");
+    }
+
+    void checkMatrix() {
+        double multiplyError = 0.0;
+        double inverseError = 0.0;
+        double determinantError = 0.0;
+        int32_t inverseMismatches = 0;
+        for (int32_t n = 0; n < RANDOM_CASES; ++n) {
+            const Matrix4x4F a = randomMatrix();
+            const Matrix4x4F b = randomMatrix();
+            multiplyError = std::max(multiplyError, maxDifference(a * b, referenceMultiply(a, b)));
+
+            Matrix4x4F inverse;
+            Matrix4x4F expected;
+            double determinant = 0.0;
+            const bool succeeded = a.Inverse(inverse);
+            if (succeeded != referenceInverse(a, expected, &determinant)) {
+                ++inverseMismatches;
+                continue;
+            }
+            if (succeeded) {
+                inverseError = std::max(inverseError, maxDifference(a * inverse, Matrix4x4F::Identity()));
+                determinantError = std::max(determinantError, std::fabs(a.Determinant() - determinant) / std::max(1.0, std::fabs(determinant)));
+            }
+        }
+        std::printf("matrix: multiply max error %.3g, |A * inverse(A) - I| max %.3g, determinant max relative error %.3g\n", multiplyError, inverseError, determinantError);
+        Check(multiplyError < 1e-5, "Multiply matches the scalar triple loop");
+        Check(inverseMismatches == 0, "Inverse fails exactly when Gauss-Jordan fails");
+        Check(inverseError < 5e-3, "A * inverse(A) is identity");
+        Check(determinantError < 1e-4, "Determinant matches the Gauss-Jordan pivot product");
+
+        Matrix4x4F unchanged = Matrix4x4F::Translation({ 1.0f, 2.0f, 3.0f });
+        const Matrix4x4F before = unchanged;
+        Check(!Matrix4x4F::Scaling({ 1.0f, 0.0f, 1.0f }).Inverse(unchanged) && unchanged == before, "Inverse rejects a singular matrix and leaves the result unchanged");
+
+        const Matrix4x4F projection = Matrix4x4F::PerspectiveFovLH(1.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+        Check(std::fabs(projection.TransformCoord({ 0.0f, 0.0f, 0.1f }).Z) < 1e-5f, "PerspectiveFovLH maps the near plane to 0");
+        Check(std::fabs(projection.TransformCoord({ 0.0f, 0.0f, 100.0f }).Z - 1.0f) < 1e-5f, "PerspectiveFovLH maps the far plane to 1");
+
+        // 일괄 연산은 단일 연산과 비트 단위로 같아야 함
+        const Matrix4x4F matrix = randomMatrix();
+        std::vector<Matrix4x4F> matrices(BATCH_COUNT);
+        std::vector<Matrix4x4F> products(BATCH_COUNT);
+        std::vector<Vector4F> vectors(BATCH_COUNT);
+        std::vector<Vector4F> transformed(BATCH_COUNT);
+        std::vector<Vector3F> points(BATCH_COUNT);
+        std::vector<Vector3F> transformedPoints(BATCH_COUNT);
+        for (size_t i = 0U; i < BATCH_COUNT; ++i) {
+            matrices[i] = randomMatrix();
+            vectors[i] = { randomFloat(), randomFloat(), randomFloat(), 1.0f };
+            points[i] = { randomFloat(), randomFloat(), randomFloat() };
+        }
+        Matrix4x4F::Multiply(matrices.data(), matrix, products.data(), BATCH_COUNT);
+        Matrix4x4F::Transform(matrix, vectors.data(), transformed.data(), BATCH_COUNT);
+        Matrix4x4F::TransformPoints(matrix, points.data(), transformedPoints.data(), BATCH_COUNT);
+
+        size_t multiplyDifferences = 0U;
+        size_t transformDifferences = 0U;
+        size_t pointDifferences = 0U;
+        double referenceError = 0.0;
+        for (size_t i = 0U; i < BATCH_COUNT; ++i) {
+            multiplyDifferences += (products[i] != matrices[i] * matrix) ? 1U : 0U;
+            transformDifferences += (transformed[i] != matrix.Transform(vectors[i])) ? 1U : 0U;
+            pointDifferences += (transformedPoints[i] != matrix.TransformPoint(points[i])) ? 1U : 0U;
+
+            const Vector4F expected = referenceTransform(vectors[i], matrix);
+            referenceError = std::max({ referenceError, static_cast<double>(std::fabs(transformed[i].X - expected.X)), static_cast<double>(std::fabs(transformed[i].W - expected.W)) });
+        }
+        Check(multiplyDifferences == 0U, "batch Multiply is bit-identical to operator*");
+        Check(transformDifferences == 0U, "batch Transform is bit-identical to Transform");
+        Check(pointDifferences == 0U, "batch TransformPoints is bit-identical to TransformPoint");
+        Check(referenceError < 1e-5, "Transform matches the scalar reference");
+
+        // 제자리 일괄 연산
+        std::vector<Vector4F> inPlace = vectors;
+        Matrix4x4F::Transform(matrix, inPlace.data(), inPlace.data(), BATCH_COUNT);
+        Check(inPlace == transformed, "in-place batch Transform matches");
+    }
+
+    void checkQuaternion() {
+        const QuaternionF a = QuaternionF::FromAxisAngle({ 1.0f, 2.0f, 3.0f }, 0.7f);
+        const QuaternionF b = QuaternionF::FromAxisAngle({ -1.0f, 0.5f, 2.0f }, 1.9f);
+        Check(Matrix4x4F::NearlyEquals((a * b).ToMatrix(), a.ToMatrix() * b.ToMatrix()), "quaternion product composes like matrices");
+
+        const Vector3F vec = { 0.3f, -1.0f, 2.0f };
+        Check(Vector3F::NearlyEquals(a.Rotate(vec), a.ToMatrix().TransformPoint(vec)), "Rotate matches ToMatrix");
+        Check(Matrix4x4F::NearlyEquals(QuaternionF::FromAxisAngle(Vector3F::Right(), 0.4f).ToMatrix(), Matrix4x4F::RotationX(0.4f)), "X axis rotation matches RotationX");
+        Check(Matrix4x4F::NearlyEquals(QuaternionF::FromAxisAngle(Vector3F::Up(), 0.4f).ToMatrix(), Matrix4x4F::RotationY(0.4f)), "Y axis rotation matches RotationY");
+        Check(Matrix4x4F::NearlyEquals(QuaternionF::FromAxisAngle(Vector3F::Forward(), 0.4f).ToMatrix(), Matrix4x4F::RotationZ(0.4f)), "Z axis rotation matches RotationZ");
+
+        double slerpError = 0.0;
+        for (int32_t n = 0; n < RANDOM_CASES; ++n) {
+            const QuaternionF start = randomQuaternion();
+            const QuaternionF end = randomQuaternion();
+            const float t = randomFloat(0.0f, 1.0f);
+            const QuaternionF result = QuaternionF::Slerp(start, end, t);
+            const QuaternionF expected = referenceSlerp(start, end, t);
+            slerpError = std::max({ slerpError, static_cast<double>(std::fabs(result.X - expected.X)), static_cast<double>(std::fabs(result.Y - expected.Y)),
+                static_cast<double>(std::fabs(result.Z - expected.Z)), static_cast<double>(std::fabs(result.W - expected.W)) });
+        }
+        std::printf("quaternion: slerp max error %.3g against acos/sin\n", slerpError);
+        Check(slerpError < 1e-4, "Slerp matches the acos/sin reference");
+
+        std::vector<QuaternionF> starts(BATCH_COUNT);
+        std::vector<QuaternionF> ends(BATCH_COUNT);
+        std::vector<QuaternionF> results(BATCH_COUNT);
+        for (size_t i = 0U; i < BATCH_COUNT; ++i) {
+            starts[i] = randomQuaternion();
+            ends[i] = randomQuaternion();
+        }
+        QuaternionF::Slerp(starts.data(), ends.data(), 0.37f, results.data(), BATCH_COUNT);
+        size_t differences = 0U;
+        for (size_t i = 0U; i < BATCH_COUNT; ++i) {
+            differences += (results[i] != QuaternionF::Slerp(starts[i], ends[i], 0.37f)) ? 1U : 0U;
+        }
+        Check(differences == 0U, "batch Slerp is bit-identical to Slerp");
+    }
+
+    /// @brief 스칼라 기준 구현과 비교해 연산당 시간을 잽니다.
+    void benchmark() {
+        std::vector<Matrix4x4F> lhs(BENCH_COUNT);
+        std::vector<Matrix4x4F> rhs(BENCH_COUNT);
+        std::vector<Matrix4x4F> matrices(BENCH_COUNT);
+        std::vector<QuaternionF> starts(BENCH_COUNT);
+        std::vector<QuaternionF> ends(BENCH_COUNT);
+        std::vector<QuaternionF> quaternions(BENCH_COUNT);
+        std::vector<Vector4F> vectors(BENCH_COUNT);
+        std::vector<Vector4F> transformed(BENCH_COUNT);
+        for (size_t i = 0U; i < BENCH_COUNT; ++i) {
+            lhs[i] = randomMatrix();
+            rhs[i] = randomMatrix();
+            starts[i] = randomQuaternion();
+            ends[i] = randomQuaternion();
+            vectors[i] = { randomFloat(), randomFloat(), randomFloat(), 1.0f };
+        }
+        const Matrix4x4F matrix = randomMatrix();
+        const double scale = 1e9 / BENCH_COUNT;
+
+        std::printf("benchmark (ns/op, %zu operations, best of %d)\n", BENCH_COUNT, BENCH_REPEATS);
+
+        const double referenceMultiplyTime = MeasureBest(BENCH_REPEATS, [&] {
+            for (size_t i = 0U; i < BENCH_COUNT; ++i) {
+                matrices[i] = referenceMultiply(lhs[i], rhs[i]);
+            }
+            Consume(matrices[BENCH_COUNT / 2U]);
+        });
+        const double multiplyTime = MeasureBest(BENCH_REPEATS, [&] {
+            for (size_t i = 0U; i < BENCH_COUNT; ++i) {
+                matrices[i] = lhs[i] * rhs[i];
+            }
+            Consume(matrices[BENCH_COUNT / 2U]);
+        });
+        std::printf("  multiply    reference %7.2f  Matrix4x4F %7.2f\n", referenceMultiplyTime * scale, multiplyTime * scale);
+
+        const double referenceInverseTime = MeasureBest(BENCH_REPEATS / 3, [&] {
+            for (size_t i = 0U; i < BENCH_COUNT; ++i) {
+                (void)referenceInverse(lhs[i], matrices[i]);
+            }
+            Consume(matrices[BENCH_COUNT / 2U]);
+        });
+        const double inverseTime = MeasureBest(BENCH_REPEATS, [&] {
+            for (size_t i = 0U; i < BENCH_COUNT; ++i) {
+                (void)lhs[i].Inverse(matrices[i]);
+            }
+            Consume(matrices[BENCH_COUNT / 2U]);
+        });
+        std::printf("  inverse     reference %7.2f  Matrix4x4F %7.2f  (Gauss-Jordan)\n", referenceInverseTime * scale, inverseTime * scale);
+
+        const double referenceSlerpTime = MeasureBest(BENCH_REPEATS, [&] {
+            for (size_t i = 0U; i < BENCH_COUNT; ++i) {
+                quaternions[i] = referenceSlerp(starts[i], ends[i], 0.3f);
+            }
+            Consume(quaternions[BENCH_COUNT / 2U]);
+        });
+        const double slerpTime = MeasureBest(BENCH_REPEATS, [&] {
+            for (size_t i = 0U; i < BENCH_COUNT; ++i) {
+                quaternions[i] = QuaternionF::Slerp(starts[i], ends[i], 0.3f);
+            }
+            Consume(quaternions[BENCH_COUNT / 2U]);
+        });
+        const double batchSlerpTime = MeasureBest(BENCH_REPEATS, [&] {
+            QuaternionF::Slerp(starts.data(), ends.data(), 0.3f, quaternions.data(), BENCH_COUNT);
+            Consume(quaternions[BENCH_COUNT / 2U]);
+        });
+        std::printf("  slerp       reference %7.2f  QuaternionF %7.2f  batch %7.2f  (acos/sin)\n", referenceSlerpTime * scale, slerpTime * scale, batchSlerpTime * scale);
+
+        const double referenceTransformTime = MeasureBest(BENCH_REPEATS, [&] {
+            for (size_t i = 0U; i < BENCH_COUNT; ++i) {
+                transformed[i] = referenceTransform(vectors[i], matrix);
+            }
+            Consume(transformed[BENCH_COUNT / 2U]);
+        });
+        const double transformTime = MeasureBest(BENCH_REPEATS, [&] {
+            Matrix4x4F::Transform(matrix, vectors.data(), transformed.data(), BENCH_COUNT);
+            Consume(transformed[BENCH_COUNT / 2U]);
+        });
+        std::printf("  transform   reference %7.2f  batch %7.2f\n", referenceTransformTime * scale, transformTime * scale);
+    }
+}
+
+/// @brief Vector4F, Matrix4x4F, QuaternionF 테스트 진입점
+/// @note 사용법: MathTest [--no-bench]
+///       SIMD 경로는 빌드 시점에 정해지므로 기본(SSE2)과 -DNEOXOPS_DISABLE_SIMD로 각각 빌드해 실행합니다.
+int main(int argc, char* argv[]) {
+#if defined(NEOXOPS_SIMD_SSE2) || defined(NEOXOPS_SIMD_NEON)
+    std::printf("math path: SIMD\n");
+#else
+    std::printf("math path: scalar\n");
+#endif
+
+    checkDot();
+    checkMatrix();
+    checkQuaternion();
+
+    if (argc < 2 || std::string(argv[1]) != "--no-bench") {
+        benchmark();
+    }
+
+    return Finish("MathTest");
+}
\ No newline at end of file
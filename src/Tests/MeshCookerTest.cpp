@@ -0,0 +1,420 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include "Graphics/MeshCooker.hpp"
+#include "System/MappedFile.hpp"
+#include "TestCommon.hpp"
+
+using namespace tests;
+using namespace graphics;
+
+namespace {
+    constexpr uint32_t SPHERE_STACKS    = 48U;      ///< 구의 위도 분할 수
+    constexpr uint32_t SPHERE_SLICES    = 96U;      ///< 구의 경도 분할 수
+    constexpr uint32_t GRID_SIZE        = 64U;      ///< 평면 격자 한 변의 정점 수
+    constexpr float SIMPLIFY_RATIO      = 0.5f;     ///< 단순화 목표 삼각형 비율
+    constexpr float SIMPLIFY_ERROR      = 0.05f;    ///< 단순화 허용 오차
+    constexpr int32_t BENCH_REPEATS     = 3;        ///< 벤치마크 반복 횟수
+
+    /// @brief 회전해도 같은 삼각형 (감김 방향은 유지)
+    using Triangle = std::array<uint32_t, 3>;
+
+    /// @brief 가장 작은 인덱스가 앞에 오도록 회전한 삼각형을 만듭니다.
+    Triangle canonical(uint32_t a, uint32_t b, uint32_t c) noexcept {
+        if (b < a && b < c) {
+            return { b, c, a };
+        }
+        if (c < a && c < b) {
+            return { c, a, b };
+        }
+        return { a, b, c };
+    }
+
+    /// @brief 삼각형 목록을 정렬된 삼각형 집합으로 바꿉니다.
+    std::vector<Triangle> triangleSet(const uint32_t* indices, size_t indexCount) {
+        std::vector<Triangle> triangles;
+        for (size_t i = 0U; i + 2U < indexCount; i += 3U) {
+            triangles.push_back(canonical(indices[i], indices[i + 1U], indices[i + 2U]));
+        }
+        std::sort(triangles.begin(), triangles.end());
+        return triangles;
+    }
+
+    /// @brief 인덱스가 참조하는 정점 수를 셉니다.
+    size_t usedVertexCount(const MeshData& mesh) {
+        std::vector<uint8_t> used(mesh.Vertices.size(), 0U);
+        for (const uint32_t index : mesh.Indices) {
+            used[index] = 1U;
+        }
+        return static_cast<size_t>(std::count(used.begin(), used.end(), 1U));
+    }
+
+    /// @brief 삼각형 넓이의 합을 구합니다.
+    double totalArea(const std::vector<uint32_t>& indices, size_t indexCount, const std::vector<MeshVertex>& vertices) {
+        double area = 0.0;
+        for (size_t i = 0U; i < indexCount; i += 3U) {
+            const MeshVertex& a = vertices[indices[i]];
+            const MeshVertex& b = vertices[indices[i + 1U]];
+            const MeshVertex& c = vertices[indices[i + 2U]];
+            const Vector3F cross = Vector3F::Cross({ b.X - a.X, b.Y - a.Y, b.Z - a.Z }, { c.X - a.X, c.Y - a.Y, c.Z - a.Z });
+            area += 0.5 * cross.Length();
+        }
+        return area;
+    }
+
+    /// @brief 경도 이음새(u = 0, 1)와 극점에 위치가 같은 정점을 가진 단위 구를 만듭니다. (범위 2개: 북반구, 남반구)
+    /// @note 극점마다 어떤 삼각형도 쓰지 않는 정점이 하나씩 있어 OptimizeVertexFetch가 버리는 정점도 확인할 수 있습니다.
+    ///       삼각형 순서는 섞어서 정점 캐시 최적화가 할 일이 있게 합니다.
+    MeshData makeSphere() {
+        MeshData mesh;
+        for (uint32_t stack = 0U; stack <= SPHERE_STACKS; ++stack) {
+            const float v = static_cast<float>(stack) / SPHERE_STACKS;
+            const float phi = v * 3.14159265f;
+            for (uint32_t slice = 0U; slice <= SPHERE_SLICES; ++slice) {
+                const float u = static_cast<float>(slice) / SPHERE_SLICES;
+                const float theta = (slice == SPHERE_SLICES) ? 0.0f : u * 6.28318531f;
+                const float x = std::sin(phi) * std::cos(theta);
+                const float y = (stack == 0U) ? 1.0f : (stack == SPHERE_STACKS) ? -1.0f : std::cos(phi);
+                const float z = std::sin(phi) * std::sin(theta);
+                const float px = (stack == 0U || stack == SPHERE_STACKS) ? 0.0f : x;
+                const float pz = (stack == 0U || stack == SPHERE_STACKS) ? 0.0f : z;
+                mesh.Vertices.push_back({ px, y, pz, px, y, pz, u, v });
+            }
+        }
+
+        const uint32_t row = SPHERE_SLICES + 1U;
+        std::vector<Triangle> halves[2];
+        for (uint32_t stack = 0U; stack < SPHERE_STACKS; ++stack) {
+            for (uint32_t slice = 0U; slice < SPHERE_SLICES; ++slice) {
+                const uint32_t a = stack * row + slice;
+                std::vector<Triangle>& half = halves[(stack < SPHERE_STACKS / 2U) ? 0 : 1];
+                if (stack != 0U) {
+                    half.push_back({ a, a + 1U, a + row });
+                }
+                if (stack + 1U != SPHERE_STACKS) {
+                    half.push_back({ a + 1U, a + row + 1U, a + row });
+                }
+            }
+        }
+
+        std::mt19937 random(22U);
+        for (int32_t material = 0; material < 2; ++material) {
+            std::shuffle(halves[material].begin(), halves[material].end(), random);
+            const uint32_t start = static_cast<uint32_t>(mesh.Indices.size());
+            for (const Triangle& triangle : halves[material]) {
+                mesh.Indices.insert(mesh.Indices.end(), triangle.begin(), triangle.end());
+            }
+            mesh.Subsets.push_back({ start, static_cast<uint32_t>(mesh.Indices.size()) - start, material });
+        }
+        mesh.Min = { -1.0f, -1.0f, -1.0f };
+        mesh.Max = { 1.0f, 1.0f, 1.0f };
+        return mesh;
+    }
+
+    /// @brief 경계가 있는 평평한 격자를 만듭니다.
+    MeshData makeGrid() {
+        MeshData mesh;
+        for (uint32_t y = 0U; y < GRID_SIZE; ++y) {
+            for (uint32_t x = 0U; x < GRID_SIZE; ++x) {
+                const float u = static_cast<float>(x) / (GRID_SIZE - 1U);
+                const float v = static_cast<float>(y) / (GRID_SIZE - 1U);
+                mesh.Vertices.push_back({ u * 10.0f, 0.0f, v * 10.0f, 0.0f, 1.0f, 0.0f, u, v });
+            }
+        }
+        for (uint32_t y = 0U; y + 1U < GRID_SIZE; ++y) {
+            for (uint32_t x = 0U; x + 1U < GRID_SIZE; ++x) {
+                const uint32_t a = y * GRID_SIZE + x;
+                mesh.Indices.insert(mesh.Indices.end(), { a, a + GRID_SIZE, a + 1U, a + 1U, a + GRID_SIZE, a + GRID_SIZE + 1U });
+            }
+        }
+        mesh.Subsets.push_back({ 0U, static_cast<uint32_t>(mesh.Indices.size()), 0 });
+        mesh.Min = { 0.0f, 0.0f, 0.0f };
+        mesh.Max = { 10.0f, 0.0f, 10.0f };
+        return mesh;
+    }
+
+    /// @brief 정점 캐시, 오버드로, 정점 가져오기 최적화가 그리는 삼각형을 바꾸지 않는지 확인합니다.
+    void checkReorder(const MeshData& sphere) {
+        std::vector<uint32_t> indices = sphere.Indices;
+        const std::vector<Triangle> original = triangleSet(indices.data(), indices.size());
+        const float shuffled = MeshOptimizer::GetACMR(indices.data(), indices.size(), MeshOptimizer::CACHE_SIZE);
+
+        MeshOptimizer::OptimizeVertexCache(indices.data(), indices.size(), sphere.Vertices.size());
+        const float optimized = MeshOptimizer::GetACMR(indices.data(), indices.size(), MeshOptimizer::CACHE_SIZE);
+        Check(triangleSet(indices.data(), indices.size()) == original, "OptimizeVertexCache keeps the triangle set and winding");
+        Check(optimized < 1.0f && optimized < shuffled * 0.5f, "OptimizeVertexCache lowers ACMR");
+
+        MeshOptimizer::OptimizeOverdraw(indices.data(), indices.size(), sphere.Vertices.data(), sphere.Vertices.size(), 1.05f);
+        const float overdraw = MeshOptimizer::GetACMR(indices.data(), indices.size(), MeshOptimizer::CACHE_SIZE);
+        Check(triangleSet(indices.data(), indices.size()) == original, "OptimizeOverdraw keeps the triangle set and winding");
+        Check(overdraw < shuffled * 0.5f, "OptimizeOverdraw keeps most of the cache order");
+
+        // 범위 하나만 정렬해도 다른 범위는 그대로
+        std::vector<uint32_t> partial = sphere.Indices;
+        const MeshSubset& first = sphere.Subsets[0];
+        MeshOptimizer::OptimizeOverdraw(partial.data() + first.StartIndex, first.IndexCount, sphere.Vertices.data(), sphere.Vertices.size(), 1.05f);
+        const MeshSubset& second = sphere.Subsets[1];
+        Check(std::equal(partial.begin() + second.StartIndex, partial.begin() + second.StartIndex + second.IndexCount, sphere.Indices.begin() + second.StartIndex),
+            "OptimizeOverdraw stays inside the given range");
+
+        // 쓰이지 않는 정점을 덧붙여도 처음 쓰이는 순서로 앞에 모이고 뒤는 버려짐
+        std::vector<MeshVertex> vertices = sphere.Vertices;
+        vertices.push_back({ 9.0f, 9.0f, 9.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f });
+        std::vector<uint32_t> fetched = indices;
+        const size_t used = MeshOptimizer::OptimizeVertexFetch(vertices.data(), vertices.size(), sizeof(MeshVertex), fetched.data(), fetched.size());
+        bool same = used == usedVertexCount(sphere), firstUse = true;
+        uint32_t next = 0U;
+        for (size_t i = 0U; i < fetched.size() && same; ++i) {
+            same = std::memcmp(&vertices[fetched[i]], &sphere.Vertices[indices[i]], sizeof(MeshVertex)) == 0;
+            if (fetched[i] == next) {
+                ++next;
+            }
+            firstUse = firstUse && fetched[i] < next;
+        }
+        Check(same && firstUse, "OptimizeVertexFetch keeps every drawn vertex and orders vertices by first use");
+    }
+
+    /// @brief 단순화 결과의 인덱스 유효성, 목표 삼각형 수, 오차를 확인합니다.
+    void checkSimplify(const MeshData& sphere, const MeshData& grid) {
+        const size_t target = static_cast<size_t>(static_cast<float>(sphere.Indices.size() / 3U) * SIMPLIFY_RATIO) * 3U;
+        std::vector<uint32_t> result(sphere.Indices.size());
+        float error = -1.0f;
+        const size_t count = MeshOptimizer::Simplify(result.data(), sphere.Indices.data(), sphere.Indices.size(), sphere.Vertices.data(), sphere.Vertices.size(), target, SIMPLIFY_ERROR, &error);
+
+        bool valid = count % 3U == 0U;
+        for (size_t i = 0U; i + 2U < count && valid; i += 3U) {
+            const uint32_t a = result[i], b = result[i + 1U], c = result[i + 2U];
+            valid = a < sphere.Vertices.size() && b < sphere.Vertices.size() && c < sphere.Vertices.size() && a != b && b != c && a != c;
+        }
+        Check(valid, "Simplify emits in-range indices and no degenerate triangles");
+        Check(count <= target && count + 6U >= target, "Simplify reaches the target triangle count");
+        Check(error >= 0.0f && error <= SIMPLIFY_ERROR, "Simplify reports an error within the limit");
+
+        // 결과는 구 표면을 벗어나지 않음 (정점을 새로 만들지 않음)
+        const double sphereArea = totalArea(sphere.Indices, sphere.Indices.size(), sphere.Vertices);
+        const double simplifiedArea = totalArea(result, count, sphere.Vertices);
+        Check(simplifiedArea <= sphereArea && simplifiedArea > sphereArea * 0.95, "simplified sphere keeps its surface area");
+
+        // 오차 한도가 0에 가까우면 곡면은 거의 줄지 않음
+        float strictError = -1.0f;
+        const size_t strict = MeshOptimizer::Simplify(result.data(), sphere.Indices.data(), sphere.Indices.size(), sphere.Vertices.data(), sphere.Vertices.size(), target, 1e-6f, &strictError);
+        Check(strict > target && strictError <= 1e-6f, "Simplify stops early when the error limit is reached");
+
+        // 평면 격자는 경계를 잠근 채 목표까지 줄고 넓이가 그대로
+        const size_t gridTarget = grid.Indices.size() / 4U / 3U * 3U;
+        std::vector<uint32_t> gridResult(grid.Indices.size());
+        const size_t gridCount = MeshOptimizer::Simplify(gridResult.data(), grid.Indices.data(), grid.Indices.size(), grid.Vertices.data(), grid.Vertices.size(), gridTarget, 1e-3f);
+        const double gridArea = totalArea(gridResult, gridCount, grid.Vertices);
+        Check(gridCount <= gridTarget && std::fabs(gridArea - 100.0) < 1e-3, "planar grid simplifies to the target and keeps its area");
+
+        // 목표가 원본 이상이면 그대로 복사
+        const size_t copied = MeshOptimizer::Simplify(result.data(), sphere.Indices.data(), sphere.Indices.size(), sphere.Vertices.data(), sphere.Vertices.size(), sphere.Indices.size(), SIMPLIFY_ERROR);
+        Check(copied == sphere.Indices.size() && std::equal(sphere.Indices.begin(), sphere.Indices.end(), result.begin()), "Simplify copies when already under the target");
+    }
+
+    /// @brief 쿠킹된 정점 값 (16바이트를 그대로 비교)
+    using VertexKey = std::array<uint64_t, 2>;
+
+    VertexKey vertexKey(const CookedMeshVertex& vertex) noexcept {
+        VertexKey key;
+        std::memcpy(key.data(), &vertex, sizeof(key));
+        return key;
+    }
+
+    /// @brief 삼각형을 쿠킹된 정점 값 3개로 만듭니다. (가장 작은 값이 앞에 오도록 회전)
+    std::array<VertexKey, 3> triangleKey(const VertexKey& a, const VertexKey& b, const VertexKey& c) noexcept {
+        if (b < a && b < c) {
+            return { b, c, a };
+        }
+        if (c < a && c < b) {
+            return { c, a, b };
+        }
+        return { a, b, c };
+    }
+
+    /// @brief 파일로 쓰고 다시 읽은 쿠킹 결과가 원본 메시를 그대로 그리는지 확인합니다.
+    void checkCook(const MeshData& sphere) {
+        std::vector<byte_t> cooked;
+        Check(!MeshCooker::Cook(MeshData{}, MeshCookOptions{}, cooked), "empty mesh is refused");
+        if (!Check(MeshCooker::Cook(sphere, MeshCookOptions{}, cooked), "Cook succeeds")) {
+            return;
+        }
+
+        const std::filesystem::path root = std::filesystem::temp_directory_path() / "NeoXOPS_MeshCookerTest";
+        std::error_code error;
+        std::filesystem::remove_all(root, error);
+        std::filesystem::create_directories(root, error);
+        const std::string path = (root / "sphere.nxm").string();
+        std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(cooked.data()), static_cast<std::streamsize>(cooked.size()));
+
+        system::MappedFile file;
+        CookedMeshHeader header;
+        if (!Check(file.Open(path) && file.GetSize() == cooked.size() && MeshCooker::ReadHeader(file.GetData(), file.GetSize(), header), "cooked file reads back")) {
+            std::filesystem::remove_all(root, error);
+            return;
+        }
+        const byte_t* data = file.GetData();
+        Check(header.VertexCount == usedVertexCount(sphere) && header.IndexFormat == static_cast<uint32_t>(IndexFormat::UInt16)
+            && header.VertexOffset % MeshCooker::DATA_ALIGNMENT == 0U && header.IndexOffset % MeshCooker::DATA_ALIGNMENT == 0U, "header describes 16-bit indices and aligned arrays");
+
+        std::vector<CookedMeshVertex> vertices(header.VertexCount);
+        std::memcpy(vertices.data(), data + header.VertexOffset, sizeof(CookedMeshVertex) * vertices.size());
+        std::vector<uint32_t> indices(header.IndexCount);
+        for (size_t i = 0U; i < indices.size(); ++i) {
+            uint16_t index = 0U;
+            std::memcpy(&index, data + header.IndexOffset + i * sizeof(index), sizeof(index));
+            indices[i] = index;
+        }
+        std::vector<CookedMeshLod> lods(header.LodCount);
+        std::memcpy(lods.data(), data + header.LodOffset, sizeof(CookedMeshLod) * lods.size());
+        std::vector<MeshSubset> subsets(header.SubsetCount);
+        std::memcpy(subsets.data(), data + header.SubsetOffset, sizeof(MeshSubset) * subsets.size());
+
+        // 0단계는 재질별로 원본과 같은 삼각형을 같은 감김 방향으로 그림 (쿠커와 같은 경계 상자로 양자화해 비교)
+        float offset[3] = { sphere.Vertices[0].X, sphere.Vertices[0].Y, sphere.Vertices[0].Z };
+        float maximum[3] = { offset[0], offset[1], offset[2] };
+        for (const MeshVertex& vertex : sphere.Vertices) {
+            const float position[3] = { vertex.X, vertex.Y, vertex.Z };
+            for (uint32_t axis = 0U; axis < 3U; ++axis) {
+                offset[axis] = std::min(offset[axis], position[axis]);
+                maximum[axis] = std::max(maximum[axis], position[axis]);
+            }
+        }
+        float inverseScale[3];
+        for (uint32_t axis = 0U; axis < 3U; ++axis) {
+            inverseScale[axis] = 65535.0f / (maximum[axis] - offset[axis]);
+        }
+        bool lod0 = lods[0].SubsetCount == sphere.Subsets.size() && lods[0].Error == 0.0f;
+        for (uint32_t s = 0U; s < sphere.Subsets.size() && lod0; ++s) {
+            const MeshSubset& source = sphere.Subsets[s];
+            const MeshSubset& target = subsets[lods[0].FirstSubset + s];
+            std::vector<std::array<VertexKey, 3>> expected, actual;
+            for (uint32_t i = 0U; i < source.IndexCount; i += 3U) {
+                VertexKey key[3];
+                for (uint32_t k = 0U; k < 3U; ++k) {
+                    key[k] = vertexKey(MeshCooker::EncodeVertex(sphere.Vertices[sphere.Indices[source.StartIndex + i + k]], offset, inverseScale));
+                }
+                expected.push_back(triangleKey(key[0], key[1], key[2]));
+            }
+            for (uint32_t i = 0U; i < target.IndexCount; i += 3U) {
+                const uint32_t* triangle = &indices[target.StartIndex + i];
+                actual.push_back(triangleKey(vertexKey(vertices[triangle[0]]), vertexKey(vertices[triangle[1]]), vertexKey(vertices[triangle[2]])));
+            }
+            std::sort(expected.begin(), expected.end());
+            std::sort(actual.begin(), actual.end());
+            lod0 = target.Material == source.Material && expected == actual;
+        }
+        Check(lod0, "LOD 0 draws the original triangles per material after the round trip");
+
+        // 되돌린 정점은 양자화 오차 안에서 원본과 같음
+        float positionError = 0.0f, normalError = 0.0f, uvError = 0.0f;
+        for (const CookedMeshVertex& vertex : vertices) {
+            const MeshVertex decoded = MeshCooker::DecodeVertex(vertex, header);
+            float best = 1e30f;
+            const MeshVertex* closest = nullptr;
+            for (const MeshVertex& source : sphere.Vertices) {
+                const float distance = std::fabs(source.X - decoded.X) + std::fabs(source.Y - decoded.Y) + std::fabs(source.Z - decoded.Z)
+                    + std::fabs(source.U - decoded.U) + std::fabs(source.V - decoded.V);
+                if (distance < best) {
+                    best = distance;
+                    closest = &source;
+                }
+            }
+            positionError = std::max({ positionError, std::fabs(closest->X - decoded.X), std::fabs(closest->Y - decoded.Y), std::fabs(closest->Z - decoded.Z) });
+            normalError = std::max({ normalError, std::fabs(closest->NX - decoded.NX), std::fabs(closest->NY - decoded.NY), std::fabs(closest->NZ - decoded.NZ) });
+            uvError = std::max({ uvError, std::fabs(closest->U - decoded.U), std::fabs(closest->V - decoded.V) });
+        }
+        Check(positionError <= 2.0f / 65535.0f && normalError <= 1.001f / 1023.0f && uvError <= 1.0f / 2048.0f, "decoded vertices stay within quantization error");
+
+        // LOD 사슬: 인덱스 수가 줄고 오차가 늘며, 범위가 단계 안에 있음
+        bool chain = header.LodCount >= 2U;
+        uint32_t lodStart = 0U;
+        for (uint32_t lod = 0U; lod < header.LodCount && chain; ++lod) {
+            uint32_t sum = 0U;
+            for (uint32_t s = 0U; s < lods[lod].SubsetCount; ++s) {
+                const MeshSubset& subset = subsets[lods[lod].FirstSubset + s];
+                chain = chain && subset.StartIndex == lodStart + sum && subset.Material >= 0 && subset.Material < 2;
+                sum += subset.IndexCount;
+            }
+            chain = chain && sum == lods[lod].IndexCount && (lod == 0U || (lods[lod].IndexCount < lods[lod - 1U].IndexCount && lods[lod].Error >= lods[lod - 1U].Error));
+            lodStart += sum;
+        }
+        chain = chain && lodStart == header.IndexCount
+            && std::all_of(indices.begin(), indices.end(), [&header](uint32_t index) { return index < header.VertexCount; });
+        Check(chain, "LOD chain shrinks, errors grow and every index is in range");
+
+        // 잘리거나 손상된 파일은 거부
+        bool truncated = true;
+        for (const size_t size : { sizeof(CookedMeshHeader) - 1U, static_cast<size_t>(header.SubsetOffset), cooked.size() - 1U }) {
+            CookedMeshHeader ignored;
+            truncated = truncated && !MeshCooker::ReadHeader(cooked.data(), size, ignored);
+        }
+        Check(truncated, "truncated cooked mesh is rejected");
+
+        const auto corrupt = [&](size_t offset, auto value) {
+            std::vector<byte_t> copy = cooked;
+            std::memcpy(copy.data() + offset, &value, sizeof(value));
+            CookedMeshHeader ignored;
+            return !MeshCooker::ReadHeader(copy.data(), copy.size(), ignored);
+        };
+        Check(corrupt(offsetof(CookedMeshHeader, Magic), 0U) && corrupt(offsetof(CookedMeshHeader, Version), MeshCooker::VERSION + 1U)
+            && corrupt(offsetof(CookedMeshHeader, LodCount), MeshCooker::MAX_LODS + 1U), "wrong magic, version or LOD count is rejected");
+        Check(corrupt(offsetof(CookedMeshHeader, IndexOffset), header.IndexOffset + 4U) && corrupt(offsetof(CookedMeshHeader, VertexCount), UINT32_MAX),
+            "misaligned or out-of-range arrays are rejected");
+        Check(corrupt(static_cast<size_t>(header.LodOffset) + offsetof(CookedMeshLod, SubsetCount), header.SubsetCount + 1U)
+            && corrupt(static_cast<size_t>(header.SubsetOffset) + offsetof(MeshSubset, IndexCount), header.IndexCount + 1U), "out-of-range LOD or subset is rejected");
+
+        file.Close();
+        std::filesystem::remove_all(root, error);
+    }
+
+    /// @brief 최적화와 쿠킹 시간을 잽니다.
+    void benchmark(const MeshData& sphere) {
+        std::vector<uint32_t> indices;
+        const double cacheTime = MeasureBest(BENCH_REPEATS, [&] {
+            indices = sphere.Indices;
+            MeshOptimizer::OptimizeVertexCache(indices.data(), indices.size(), sphere.Vertices.size());
+        });
+        const double overdrawTime = MeasureBest(BENCH_REPEATS, [&] {
+            MeshOptimizer::OptimizeOverdraw(indices.data(), indices.size(), sphere.Vertices.data(), sphere.Vertices.size(), 1.05f);
+        });
+        std::vector<uint32_t> result(sphere.Indices.size());
+        const size_t target = sphere.Indices.size() / 2U / 3U * 3U;
+        const double simplifyTime = MeasureBest(BENCH_REPEATS, [&] {
+            Consume(MeshOptimizer::Simplify(result.data(), sphere.Indices.data(), sphere.Indices.size(), sphere.Vertices.data(), sphere.Vertices.size(), target, SIMPLIFY_ERROR));
+        });
+        std::vector<byte_t> cooked;
+        const double cookTime = MeasureBest(BENCH_REPEATS, [&] { Consume(MeshCooker::Cook(sphere, MeshCookOptions{}, cooked)); });
+
+        std::printf("benchmark (%zu vertices, %zu triangles)\n", sphere.Vertices.size(), sphere.Indices.size() / 3U);
+        std::printf("  OptimizeVertexCache %8.2f ms\n", cacheTime * 1e3);
+        std::printf("  OptimizeOverdraw    %8.2f ms\n", overdrawTime * 1e3);
+        std::printf("  Simplify (50%%)      %8.2f ms\n", simplifyTime * 1e3);
+        std::printf("  Cook                %8.2f ms, %7.1f KB\n", cookTime * 1e3, static_cast<double>(cooked.size()) / 1024.0);
+    }
+}
+
+/// @brief MeshOptimizer, MeshCooker 테스트 진입점
+/// @note 사용법: MeshCookerTest [--no-bench]
+int main(int argc, char* argv[]) {
+    const MeshData sphere = makeSphere();
+    const MeshData grid = makeGrid();
+
+    checkReorder(sphere);
+    checkSimplify(sphere, grid);
+    checkCook(sphere);
+
+    if (argc < 2 || std::string(argv[1]) != "--no-bench") {
+        benchmark(sphere);
+    }
+
+    return Finish("MeshCookerTest");
+}
\ No newline at end of file
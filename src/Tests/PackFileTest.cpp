@@ -0,0 +1,334 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include "System/FileSystem.hpp"
+#include "Type/Hash.hpp"
+#include "TestCommon.hpp"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace tests;
+
+namespace {
+    constexpr uint32_t MODEL_COUNT      = 160U;     ///< 텍스트 모델 수 (잘 압축됨)
+    constexpr uint32_t TEXTURE_COUNT    = 80U;      ///< 텍스처 수 (절반은 압축되지 않음)
+    constexpr uint32_t SOUND_COUNT      = 24U;      ///< 소리 수 (압축되지 않음, 청크 여러 개)
+    constexpr uint32_t COPY_COUNT       = 40U;      ///< 다른 경로에 같은 내용을 둔 파일 수
+    constexpr int32_t COLD_RUNS         = 5;        ///< 페이지 캐시를 비운 측정 횟수
+    constexpr int32_t WARM_RUNS         = 7;        ///< 페이지 캐시에 올라간 뒤 측정 횟수
+
+    std::mt19937 g_Random(3U);
+
+    /// @brief 테스트 자산
+    struct Asset final {
+        std::string Path;                   ///< 경로 (자산 디렉터리 기준)
+        std::vector<byte_t> Data;           ///< 내용
+    };
+
+    /// @brief 정점 목록 형식의 텍스트 (LZ4로 2~3배 줄어듦)
+    std::vector<byte_t> makeText(size_t size) {
+        std::string text;
+        char line[64];
+        while (text.size() < size) {
+            const int length = std::snprintf(line, sizeof(line), "v %.3f %.3f %.3f\n", static_cast<double>(g_Random() % 2000U) * 0.01, static_cast<double>(g_Random() % 400U) * 0.01, -static_cast<double>(g_Random() % 2000U) * 0.01);
+            text.append(line, static_cast<size_t>(length));
+        }
+        return { text.begin(), text.begin() + static_cast<std::ptrdiff_t>(size) };
+    }
+
+    /// @brief 압축되지 않는 내용 (압축된 텍스처, 소리)
+    std::vector<byte_t> makeNoise(size_t size) {
+        std::vector<byte_t> data(size);
+        for (byte_t& value : data) {
+            value = static_cast<byte_t>(g_Random());
+        }
+        return data;
+    }
+
+    /// @brief 같은 색이 이어지는 비압축 텍스처 (LZ4로 잘 줄어듦)
+    std::vector<byte_t> makeImage(size_t size) {
+        std::vector<byte_t> data(size);
+        for (size_t i = 0U; i < size; i += 64U) {
+            std::fill_n(data.begin() + static_cast<std::ptrdiff_t>(i), std::min<size_t>(64U, size - i), static_cast<byte_t>(g_Random() % 8U));
+        }
+        return data;
+    }
+
+    /// @brief 결정적인 자산 목록을 만듭니다.
+    /// @note 64 KB 청크를 여러 개 쓰는 파일, 빈 파일, 내용이 같은 파일, 크기만 같고 내용이 다른 파일을 포함합니다.
+    std::vector<Asset> makeAssets() {
+        std::vector<Asset> assets;
+        char path[64];
+        for (uint32_t i = 0U; i < MODEL_COUNT; ++i) {
+            std::snprintf(path, sizeof(path), "model/m%03u.x", i);
+            assets.push_back({ path, makeText(1024U + g_Random() % (96U * 1024U)) });
+        }
+        for (uint32_t i = 0U; i < TEXTURE_COUNT; ++i) {
+            std::snprintf(path, sizeof(path), "texture/t%03u.dds", i);
+            const size_t size = 16U * 1024U + g_Random() % (256U * 1024U);
+            assets.push_back({ path, (i % 2U == 0U) ? makeImage(size) : makeNoise(size) });
+        }
+        for (uint32_t i = 0U; i < SOUND_COUNT; ++i) {
+            std::snprintf(path, sizeof(path), "sound/s%02u.wav", i);
+            assets.push_back({ path, makeNoise(128U * 1024U + g_Random() % (640U * 1024U)) });
+        }
+        for (uint32_t i = 0U; i < COPY_COUNT; ++i) {
+            std::snprintf(path, sizeof(path), "mission/copy%02u.bin", i);
+            assets.push_back({ path, assets[(i * 7U) % (MODEL_COUNT + TEXTURE_COUNT + SOUND_COUNT)].Data });
+        }
+
+        // 크기는 같고 한 바이트만 다른 파일 (공유하면 안 됨)
+        std::vector<byte_t> model = assets[1].Data;
+        model[model.size() / 2U] ^= 1U;
+        assets.push_back({ "mission/variant_model.x", model });
+        std::vector<byte_t> sound = assets[MODEL_COUNT + TEXTURE_COUNT].Data;
+        sound[sound.size() - 1U] ^= 1U;
+        assets.push_back({ "mission/variant_sound.wav", sound });
+        assets.push_back({ "mission/empty.txt", {} });
+        return assets;
+    }
+
+    bool writeFile(const std::filesystem::path& path, const std::vector<byte_t>& data) {
+        std::error_code error;
+        std::filesystem::create_directories(path.parent_path(), error);
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        return static_cast<bool>(file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size())));
+    }
+
+    bool sameBytes(const system::FileData& data, const std::vector<byte_t>& expected) noexcept {
+        return data.Size == expected.size() && (expected.empty() || std::memcmp(data.Data, expected.data(), expected.size()) == 0);
+    }
+
+    /// @brief 자산 목록으로 팩을 만듭니다.
+    bool buildPack(const std::string& path, const std::vector<Asset>& assets, bool compress, system::PackWriterStats& stats) {
+        system::PackWriter writer;
+        bool result = writer.Create(path);
+        for (const Asset& asset : assets) {
+            result = result && writer.Add(asset.Path, asset.Data.data(), asset.Data.size(), compress);
+        }
+        stats = writer.GetStats();
+        return writer.Finish() && result;
+    }
+
+    /// @brief 팩의 모든 파일이 원본과 같은지, 내용이 같은 파일만 데이터를 공유하는지 확인합니다.
+    void checkPack(const std::string& path, const std::vector<Asset>& assets, const system::PackWriterStats& stats, const char* name) {
+        const std::string prefix = std::string(name) + ": ";
+        Check(stats.FileCount == assets.size() && stats.DuplicateCount == COPY_COUNT, (prefix + "only identical content is shared").c_str());
+
+        system::PackFile pack;
+        if (!Check(pack.Open(path), (prefix + "pack opens").c_str())) {
+            return;
+        }
+        Check(pack.GetEntries().size() == assets.size(), (prefix + "directory has every file").c_str());
+
+        bool shared = true;
+        for (uint32_t i = 0U; i < COPY_COUNT; ++i) {
+            const system::PackEntry* copy = pack.Find(assets[MODEL_COUNT + TEXTURE_COUNT + SOUND_COUNT + i].Path);
+            const system::PackEntry* source = pack.Find(assets[(i * 7U) % (MODEL_COUNT + TEXTURE_COUNT + SOUND_COUNT)].Path);
+            shared = shared && copy && source && copy->Offset == source->Offset;
+        }
+        Check(shared, (prefix + "copies point at the original data").c_str());
+
+        const system::PackEntry* model = pack.Find("mission/variant_model.x");
+        const system::PackEntry* sound = pack.Find("mission/variant_sound.wav");
+        Check(model && sound && model->Offset != pack.Find(assets[1].Path)->Offset && sound->Offset != pack.Find(assets[MODEL_COUNT + TEXTURE_COUNT].Path)->Offset,
+            (prefix + "same size, different content is not shared").c_str());
+
+        system::FileSystem fileSystem;
+        fileSystem.SetVerifyContent(true);
+        Check(fileSystem.MountPack(path), (prefix + "MountPack").c_str());
+        system::FileData data;
+        bool same = true;
+        for (const Asset& asset : assets) {
+            same = fileSystem.Read(asset.Path, data) && sameBytes(data, asset.Data) && same;
+        }
+        Check(same, (prefix + "every file reads back unchanged").c_str());
+        Check(fileSystem.Read("MODEL\\m001.X", data) && sameBytes(data, assets[1].Data), (prefix + "lookup ignores case and separators").c_str());
+        Check(!fileSystem.Read("model/missing.x", data) && data.Size == 0U, (prefix + "missing file is reported").c_str());
+
+        const system::FileSystemStats fileStats = fileSystem.GetStats();
+        Check(fileStats.PackReads == assets.size() + 1U && fileStats.Misses == 1U && fileStats.Failures == 0U, (prefix + "statistics count reads").c_str());
+    }
+
+    /// @brief 팩 위에 마운트한 디렉터리가 우선하는지 확인합니다.
+    void checkOverlay(const std::string& packPath, const std::filesystem::path& directory, const std::vector<Asset>& assets) {
+        const std::vector<byte_t> patched = makeText(5000U);
+        Check(writeFile(directory / assets[0].Path, patched), "overlay: write patched file");
+
+        system::FileSystem fileSystem;
+        Check(fileSystem.MountPack(packPath) && fileSystem.MountDirectory(directory.string()), "overlay: mount pack then directory");
+        system::FileData data;
+        Check(fileSystem.Read(assets[0].Path, data) && sameBytes(data, patched), "overlay: directory overrides the pack");
+        Check(fileSystem.Read(assets[1].Path, data) && sameBytes(data, assets[1].Data), "overlay: other files still come from the pack");
+
+        const system::FileSystemStats stats = fileSystem.GetStats();
+        Check(stats.LooseReads == 1U && stats.PackReads == 1U, "overlay: one loose read, one pack read");
+    }
+
+    /// @brief 파일을 운영체제 페이지 캐시에서 내보냅니다.
+    /// @return 성공(true), 지원하지 않음(false)
+    bool evict(const std::filesystem::path& path) noexcept {
+#if defined(_WIN32)
+        (void)path;
+        return false;
+#else
+        const int file = open(path.c_str(), O_RDONLY);
+        if (file < 0) {
+            return false;
+        }
+        (void)fdatasync(file);
+        const bool result = posix_fadvise(file, 0, 0, POSIX_FADV_DONTNEED) == 0;
+        close(file);
+        return result;
+#endif
+    }
+
+    /// @brief 벤치마크 대상 (모든 파일을 읽고 내용을 해시해 실제로 페이지를 건드림)
+    struct Loader final {
+        const char* Name;                                   ///< 이름
+        std::string Pack;                                   ///< 팩 경로 (개별 파일이면 비어있음)
+        bool UseFileSystem;                                 ///< FileSystem 사용 여부 (아니면 fread)
+    };
+
+    /// @brief 모든 파일을 한 번 읽습니다.
+    /// @return 걸린 시간 (초 단위, 마운트 포함)
+    double load(const Loader& loader, const std::filesystem::path& directory, const std::vector<Asset>& assets, uint64_t& checksum) {
+        const double start = Now();
+        uint64_t hash = 0ULL;
+        if (loader.UseFileSystem) {
+            system::FileSystem fileSystem;
+            const bool mounted = loader.Pack.empty() ? fileSystem.MountDirectory(directory.string()) : fileSystem.MountPack(loader.Pack);
+            system::FileData data;
+            for (const Asset& asset : assets) {
+                hash += (mounted && fileSystem.Read(asset.Path, data)) ? Hash64(data.Data, data.Size) : 0ULL;
+            }
+        } else {
+            std::vector<byte_t> buffer;
+            for (const Asset& asset : assets) {
+                FILE* file = std::fopen((directory / asset.Path).string().c_str(), "rb");
+                if (!file) {
+                    continue;
+                }
+                std::fseek(file, 0, SEEK_END);
+                buffer.resize(static_cast<size_t>(std::ftell(file)));
+                std::fseek(file, 0, SEEK_SET);
+                const size_t size = std::fread(buffer.data(), 1U, buffer.size(), file);
+                std::fclose(file);
+                hash += Hash64(buffer.data(), size);
+            }
+        }
+        checksum = hash;
+        return Now() - start;
+    }
+
+    double median(std::vector<double> times) {
+        std::sort(times.begin(), times.end());
+        return times[times.size() / 2U];
+    }
+
+    /// @brief 개별 파일, 디렉터리 층, LZ4 팩, 무압축 팩의 콜드/웜 로딩 시간을 비교합니다.
+    /// @note 콜드 측정은 매번 자산과 팩을 페이지 캐시에서 내보낸 뒤 잽니다. (Windows와 tmpfs에서는 웜과 같아짐)
+    void benchmark(const std::filesystem::path& directory, const std::vector<Asset>& assets, const std::string& lz4Pack, const std::string& storedPack, double buildTime) {
+        uint64_t totalBytes = 0ULL;
+        for (const Asset& asset : assets) {
+            totalBytes += asset.Data.size();
+        }
+
+        const auto evictAll = [&] {
+            bool result = evict(lz4Pack) && evict(storedPack);
+            for (const Asset& asset : assets) {
+                result = evict(directory / asset.Path) && result;
+            }
+            return result;
+        };
+        const bool cold = evictAll();
+
+        std::printf("benchmark (%zu files, %.1f MB, median of %d cold / %d warm, ms)\n", assets.size(), static_cast<double>(totalBytes) / 1048576.0, COLD_RUNS, WARM_RUNS);
+        std::printf("  %-18s %9s %9s %10s\n", "loader", "cold", "warm", "file MB");
+
+        const Loader loaders[] = {
+            { "loose fread", {}, false },
+            { "loose FileSystem", {}, true },
+            { "pack LZ4", lz4Pack, true },
+            { "pack stored", storedPack, true },
+        };
+        uint64_t expected = 0ULL;
+        bool same = true;
+        for (const Loader& loader : loaders) {
+            std::vector<double> coldTimes;
+            std::vector<double> warmTimes;
+            uint64_t checksum = 0ULL;
+            for (int32_t i = 0; cold && i < COLD_RUNS; ++i) {
+                (void)evictAll();
+                coldTimes.push_back(load(loader, directory, assets, checksum));
+            }
+            for (int32_t i = 0; i < WARM_RUNS; ++i) {
+                warmTimes.push_back(load(loader, directory, assets, checksum));
+            }
+            expected = (&loader == loaders) ? checksum : expected;
+            same = same && checksum == expected;
+
+            std::error_code error;
+            const double fileBytes = static_cast<double>(loader.Pack.empty() ? totalBytes : std::filesystem::file_size(loader.Pack, error));
+            char coldText[32] = "-";
+            if (cold) {
+                std::snprintf(coldText, sizeof(coldText), "%.2f", median(coldTimes) * 1e3);
+            }
+            std::printf("  %-18s %9s %9.2f %10.2f\n", loader.Name, coldText, median(warmTimes) * 1e3, fileBytes / 1048576.0);
+        }
+        std::printf("  pack LZ4 build %.2f ms\n", buildTime * 1e3);
+        Check(same, "every loader reads the same content");
+    }
+}
+
+/// @brief PackFile/FileSystem 테스트 진입점
+/// @note 사용법: PackFileTest [--no-bench]
+///       합성 자산 트리로 LZ4 팩과 무압축 팩을 만들어 내용과 데이터 공유를 확인하고, 개별 파일과 콜드/웜 로딩 시간을 비교합니다.
+int main(int argc, char* argv[]) {
+    const std::filesystem::path root = std::filesystem::temp_directory_path() / "NeoXOPS_PackFileTest";
+    const std::filesystem::path directory = root / "assets";
+    const std::string lz4Pack = (root / "data.nxpak").string();
+    const std::string storedPack = (root / "stored.nxpak").string();
+    std::error_code error;
+    std::filesystem::remove_all(root, error);
+
+    const std::vector<Asset> assets = makeAssets();
+    bool written = true;
+    for (const Asset& asset : assets) {
+        written = writeFile(directory / asset.Path, asset.Data) && written;
+    }
+    Check(written, "write asset tree");
+
+    system::PackWriterStats lz4Stats;
+    system::PackWriterStats storedStats;
+    const double start = Now();
+    Check(buildPack(lz4Pack, assets, true, lz4Stats), "build LZ4 pack");
+    const double buildTime = Now() - start;
+    Check(buildPack(storedPack, assets, false, storedStats), "build stored pack");
+    Check(lz4Stats.PackedBytes < lz4Stats.SourceBytes && storedStats.PackedBytes == storedStats.SourceBytes - [&] {
+        uint64_t shared = 0ULL;
+        for (uint32_t i = 0U; i < COPY_COUNT; ++i) {
+            shared += assets[MODEL_COUNT + TEXTURE_COUNT + SOUND_COUNT + i].Data.size();
+        }
+        return shared;
+    }(), "packed sizes (LZ4 shrinks, stored keeps one copy of shared data)");
+
+    checkPack(lz4Pack, assets, lz4Stats, "LZ4 pack");
+    checkPack(storedPack, assets, storedStats, "stored pack");
+    checkOverlay(lz4Pack, root / "overlay", assets);
+
+    if (argc < 2 || std::string(argv[1]) != "--no-bench") {
+        benchmark(directory, assets, lz4Pack, storedPack, buildTime);
+    }
+
+    std::filesystem::remove_all(root, error);
+    return Finish("PackFileTest");
+}
\ No newline at end of file
@@ -0,0 +1,248 @@
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "Graphics/NullRenderDevice.hpp"
+#include "Graphics/PipelineStateCache.hpp"
+#include "Graphics/RenderContext.hpp"
+#include "TestCommon.hpp"
+
+using namespace tests;
+using namespace graphics;
+
+namespace {
+    constexpr uint32_t PIPELINE_COUNT   = 6U;       ///< 서로 다른 파이프라인 수
+    constexpr uint32_t MATERIAL_COUNT   = 200U;     ///< 파이프라인을 요청하는 재질 수
+    constexpr uint32_t MESH_COUNT       = 300U;     ///< 메시 수 (정점, 인덱스 버퍼 한 쌍씩)
+    constexpr uint32_t TEXTURE_COUNT    = 64U;      ///< 텍스처 수
+    constexpr uint32_t DRAW_COUNT       = 2000U;    ///< 프레임당 드로우 수 (메시마다 인스턴스 6~7개)
+    constexpr int32_t BENCH_FRAMES      = 300;      ///< 벤치마크 프레임 수
+
+    /// @brief 드로우 하나의 바인딩
+    struct Draw final {
+        uint32_t Pipeline;                  ///< 파이프라인
+        TextureHandle Texture;              ///< 텍스처
+        SamplerHandle Sampler;              ///< 샘플러
+        BufferHandle VertexBuffer;          ///< 정점 버퍼
+        BufferHandle IndexBuffer;           ///< 인덱스 버퍼
+        BufferHandle ConstantBuffer;        ///< 상수 버퍼
+    };
+
+    /// @brief 합성 씬 (불투명, 양면, 알파, 가산, 데칼, 하늘 파이프라인)
+    struct Scene final {
+        std::vector<PipelineDesc> Descs;        ///< 파이프라인 설명
+        std::vector<PipelineState> Pipelines;   ///< 파이프라인
+        std::vector<Draw> Draws;                ///< 제출 순서 그대로의 드로우
+        std::vector<Draw> Sorted;               ///< 파이프라인, 텍스처, 메시 순으로 정렬한 드로우
+    };
+
+    std::vector<PipelineDesc> makeDescs(IRenderDevice& device) {
+        const byte_t code[64] = { 1U };
+        const ShaderHandle vertexShader = device.CreateShader({ ShaderStage::Vertex, VertexLayout::Mesh }, code, sizeof(code));
+        ShaderHandle pixelShaders[3];
+        for (ShaderHandle& shader : pixelShaders) {
+            shader = device.CreateShader({ ShaderStage::Pixel, VertexLayout::None }, code, sizeof(code));
+        }
+
+        std::vector<PipelineDesc> descs(PIPELINE_COUNT);
+        for (PipelineDesc& desc : descs) {
+            desc.VertexShader = vertexShader;
+            desc.PixelShader = pixelShaders[0];
+        }
+        descs[1].Rasterizer.Cull = CullMode::None;
+        descs[2].Blend = { true, BlendFactor::SrcAlpha, BlendFactor::InvSrcAlpha, BlendOp::Add, BlendFactor::One, BlendFactor::InvSrcAlpha, BlendOp::Add, 0x0F };
+        descs[2].DepthStencil.DepthWriteEnabled = false;
+        descs[2].PixelShader = pixelShaders[1];
+        descs[3].Blend = { true, BlendFactor::One, BlendFactor::One, BlendOp::Add, BlendFactor::One, BlendFactor::One, BlendOp::Add, 0x0F };
+        descs[3].DepthStencil.DepthWriteEnabled = false;
+        descs[3].PixelShader = pixelShaders[1];
+        descs[4].Rasterizer.DepthBias = -16;
+        descs[4].DepthStencil.DepthFunc = CompareFunc::LessEqual;
+        descs[5].DepthStencil.DepthWriteEnabled = false;
+        descs[5].DepthStencil.DepthFunc = CompareFunc::LessEqual;
+        descs[5].PixelShader = pixelShaders[2];
+        return descs;
+    }
+
+    /// @brief 재질마다 파이프라인을 요청하고 드로우 목록을 만듭니다.
+    /// @note 디바이스 리소스는 직접 바인딩과 RenderContext 바인딩이 같은 핸들을 쓰도록 디바이스에서 바로 만듭니다.
+    void makeScene(NullRenderDevice& device, PipelineStateCache& cache, Scene& scene) {
+        std::mt19937 random(3U);
+        scene.Descs = makeDescs(device);
+        scene.Pipelines.resize(PIPELINE_COUNT);
+
+        // 재질 200개가 파이프라인 6개 중 하나를 요청 (로딩 중 반복 요청)
+        PipelineState state;
+        bool created = true;
+        for (uint32_t i = 0U; i < MATERIAL_COUNT; ++i) {
+            created = cache.GetPipeline(scene.Descs[random() % PIPELINE_COUNT], state) && created;
+        }
+        for (uint32_t i = 0U; i < PIPELINE_COUNT; ++i) {
+            created = cache.GetPipeline(scene.Descs[i], scene.Pipelines[i]) && created;
+        }
+        Check(created, "every pipeline is created");
+
+        SamplerDesc pointSampler;
+        pointSampler.Filter = TextureFilter::Point;
+        pointSampler.AddressU = TextureAddress::Clamp;
+        pointSampler.AddressV = TextureAddress::Clamp;
+        const SamplerHandle samplers[2] = { cache.GetSampler({}), cache.GetSampler(pointSampler) };
+
+        TextureDesc textureDesc;
+        textureDesc.Width = 4;
+        textureDesc.Height = 4;
+        std::vector<TextureHandle> textures(TEXTURE_COUNT);
+        for (TextureHandle& texture : textures) {
+            texture = device.CreateTexture(textureDesc, nullptr);
+        }
+
+        BufferDesc bufferDesc;
+        bufferDesc.Size = 1024U;
+        std::vector<BufferHandle> vertexBuffers(MESH_COUNT);
+        std::vector<BufferHandle> indexBuffers(MESH_COUNT);
+        for (BufferHandle& buffer : vertexBuffers) {
+            buffer = device.CreateBuffer(bufferDesc, nullptr);
+        }
+        bufferDesc.Type = BufferType::Index;
+        for (BufferHandle& buffer : indexBuffers) {
+            buffer = device.CreateBuffer(bufferDesc, nullptr);
+        }
+        bufferDesc.Type = BufferType::Constant;
+        bufferDesc.Usage = BufferUsage::Dynamic;
+        const BufferHandle constantBuffer = device.CreateBuffer(bufferDesc, nullptr);
+
+        // 메시 20개 중 하나는 반투명(알파, 가산, 데칼, 하늘), 나머지 중 일부는 양면
+        scene.Draws.resize(DRAW_COUNT);
+        for (Draw& draw : scene.Draws) {
+            const uint32_t mesh = random() % MESH_COUNT;
+            draw.Pipeline       = (mesh % 20U == 0U) ? 2U + (mesh % 4U) : ((mesh % 7U == 0U) ? 1U : 0U);
+            draw.Texture        = textures[mesh % TEXTURE_COUNT];
+            draw.Sampler        = samplers[(mesh % 9U == 0U) ? 1U : 0U];
+            draw.VertexBuffer   = vertexBuffers[mesh];
+            draw.IndexBuffer    = indexBuffers[mesh];
+            draw.ConstantBuffer = constantBuffer;
+        }
+        scene.Sorted = scene.Draws;
+        std::sort(scene.Sorted.begin(), scene.Sorted.end(), [](const Draw& lhs, const Draw& rhs) noexcept {
+            if (lhs.Pipeline != rhs.Pipeline) {
+                return lhs.Pipeline < rhs.Pipeline;
+            }
+            if (lhs.Texture.ID != rhs.Texture.ID) {
+                return lhs.Texture.ID < rhs.Texture.ID;
+            }
+            return lhs.VertexBuffer.ID < rhs.VertexBuffer.ID;
+        });
+    }
+
+    /// @brief 드로우 목록으로 프레임 하나를 그립니다.
+    void drawFrame(IRenderDevice& target, const Scene& scene, const std::vector<Draw>& draws) noexcept {
+        float color[4] = {};
+        target.BeginFrame(color);
+        for (const Draw& draw : draws) {
+            PipelineStateCache::Bind(target, scene.Pipelines[draw.Pipeline]);
+            target.SetSampler(0U, draw.Sampler);
+            target.SetTexture(0U, draw.Texture);
+            target.SetVertexBuffer(draw.VertexBuffer);
+            target.SetIndexBuffer(draw.IndexBuffer, IndexFormat::UInt16);
+            target.SetConstantBuffer(0U, draw.ConstantBuffer);
+            target.DrawIndexed(36U, 0U, 0);
+        }
+        target.EndFrame();
+    }
+
+    /// @brief 캐시가 같은 설명에 같은 상태 객체를 돌려주는지 확인합니다.
+    void checkCache(PipelineStateCache& cache, const Scene& scene) {
+        const PipelineCacheStats stats = cache.GetStats();
+        Check(stats.Misses == stats.StateCount && stats.Failures == 0U, "each distinct state is created once");
+        Check(stats.Hits + stats.Misses == (MATERIAL_COUNT + PIPELINE_COUNT) * 3U + 2U, "every request is a hit or a miss");
+
+        PipelineState again;
+        Check(cache.GetPipeline(scene.Descs[2], again) && again.Blend == scene.Pipelines[2].Blend && again.DepthStencil == scene.Pipelines[2].DepthStencil
+            && again.Rasterizer == scene.Pipelines[2].Rasterizer, "same description returns the same states");
+        Check(scene.Pipelines[0].Blend != scene.Pipelines[2].Blend && scene.Pipelines[0].Rasterizer != scene.Pipelines[1].Rasterizer, "different descriptions get different states");
+    }
+
+    /// @brief RenderContext가 중복 바인딩만 걸러내는지 확인합니다.
+    void checkFilter(NullRenderDevice& device, RenderContext& context, const Scene& scene) {
+        drawFrame(device, scene, scene.Draws);
+        const RenderStats direct = device.GetFrameStats();
+        drawFrame(context, scene, scene.Draws);
+        const RenderStats filtered = device.GetFrameStats();
+        const RenderContextStats stats = context.GetFilterStats();
+        Check(filtered.DrawCalls == direct.DrawCalls && filtered.Vertices == direct.Vertices, "context forwards every draw");
+        Check(stats.Issued == filtered.StateChanges && stats.Issued + stats.Filtered == direct.StateChanges, "issued plus filtered equals every bind");
+        Check(stats.Filtered > 0U, "redundant binds are filtered");
+
+        // 프레임 첫 바인딩과 Invalidate 뒤의 바인딩은 항상 전달
+        float color[4] = {};
+        context.BeginFrame(color);
+        context.SetTexture(0U, scene.Draws[0].Texture);
+        context.SetTexture(0U, scene.Draws[0].Texture);
+        context.Invalidate();
+        context.SetTexture(0U, scene.Draws[0].Texture);
+        context.EndFrame();
+        Check(context.GetFilterStats().Issued == 2U && context.GetFilterStats().Filtered == 1U, "first bind and bind after Invalidate are issued");
+    }
+
+    /// @brief 직접 바인딩과 RenderContext 바인딩의 프레임 시간과 디바이스 상태 변경 수를 비교합니다.
+    /// @note NullRenderDevice는 바인딩마다 통계만 세므로 바인딩 비용이 거의 없고, RenderContext 쪽 시간이 더 깁니다.
+    ///       그 차이는 걸러내는 비용 자체이며 속도 향상을 뜻하지 않습니다. 걸러낸 호출이 아끼는 양은 바인딩 비용이 있는
+    ///       D3D11 디바이스에서만 생기고 여기서는 재지 않으므로, 표는 걸러낸 호출 수와 바인딩 호출당 추가 비용만 보여줍니다.
+    void benchmark(NullRenderDevice& device, RenderContext& context, const PipelineStateCache& cache, const Scene& scene) {
+        const PipelineCacheStats stats = cache.GetStats();
+        std::printf("benchmark (%u draws, %u meshes, %u textures, %d frames)\n", DRAW_COUNT, MESH_COUNT, TEXTURE_COUNT, BENCH_FRAMES);
+        std::printf("  pipeline cache: %llu hits, %llu misses, %u states (%.1f%% hit rate)\n", static_cast<unsigned long long>(stats.Hits), static_cast<unsigned long long>(stats.Misses),
+            stats.StateCount, 100.0 * static_cast<double>(stats.Hits) / static_cast<double>(stats.Hits + stats.Misses));
+        std::printf("  %-8s %-8s %12s %14s %10s %14s\n", "order", "target", "us/frame", "state changes", "filtered", "filter cost");
+
+        for (const std::vector<Draw>* draws : { &scene.Draws, &scene.Sorted }) {
+            const char* order = (draws == &scene.Draws) ? "unsorted" : "sorted";
+            double directTime = 0.0;
+            for (IRenderDevice* target : { static_cast<IRenderDevice*>(&device), static_cast<IRenderDevice*>(&context) }) {
+                const double start = Now();
+                for (int32_t frame = 0; frame < BENCH_FRAMES; ++frame) {
+                    drawFrame(*target, scene, *draws);
+                }
+                const double frameTime = (Now() - start) / BENCH_FRAMES;
+
+                char filtered[32] = "-";
+                char cost[32] = "-";
+                if (target == &context) {
+                    const RenderContextStats filter = context.GetFilterStats();
+                    const double binds = static_cast<double>(filter.Issued + filter.Filtered);
+                    std::snprintf(filtered, sizeof(filtered), "%.1f%%", 100.0 * filter.Filtered / binds);
+                    std::snprintf(cost, sizeof(cost), "%+.1f ns/bind", (frameTime - directTime) * 1e9 / binds);
+                }
+                else {
+                    directTime = frameTime;
+                }
+                std::printf("  %-8s %-8s %12.1f %14u %10s %14s\n", order, (target == &context) ? "context" : "direct", frameTime * 1e6, device.GetFrameStats().StateChanges, filtered, cost);
+            }
+        }
+        std::printf("  binds are free on the null device: the context time is filtering overhead, not a speedup\n");
+    }
+}
+
+/// @brief PipelineStateCache/RenderContext 테스트 진입점
+/// @note 사용법: PipelineStateTest [--no-bench]
+///       합성 씬에서 캐시 적중률과 RenderContext가 걸러내는 바인딩 비율을 제출 순서 그대로와 정렬한 경우로 나눠 잽니다.
+int main(int argc, char* argv[]) {
+    NullRenderDevice device;
+    if (!Check(device.Initialize(nullptr, 640, 480, false, false), "NullRenderDevice initializes")) {
+        return Finish("PipelineStateTest");
+    }
+
+    RenderContext context(device);
+    PipelineStateCache cache(context);
+    Scene scene;
+    makeScene(device, cache, scene);
+    checkCache(cache, scene);
+    checkFilter(device, context, scene);
+
+    if (argc < 2 || std::string(argv[1]) != "--no-bench") {
+        benchmark(device, context, cache, scene);
+    }
+
+    return Finish("PipelineStateTest");
+}
\ No newline at end of file
@@ -0,0 +1,200 @@
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "Graphics/NullRenderDevice.hpp"
+#include "Graphics/ResourceManager.hpp"
+#include "Type/Hash.hpp"
+#include "TestCommon.hpp"
+
+using namespace tests;
+using namespace graphics;
+
+namespace {
+    constexpr int32_t TEXTURE_SIZE      = 256;      ///< 텍스처 한 변 길이
+    constexpr uint32_t UNIQUE_TEXTURES  = 96U;      ///< 벤치마크의 서로 다른 텍스처 수
+    constexpr uint32_t SCENE_TEXTURES   = 400U;     ///< 씬 하나가 요청하는 텍스처 수 (재질끼리 공유)
+    constexpr uint32_t SCENE_COUNT      = 4U;       ///< 벤치마크에서 전환하는 씬 수
+
+    std::mt19937 g_Random(5U);
+
+    std::vector<uint32_t> makePixels() {
+        std::vector<uint32_t> pixels(static_cast<size_t>(TEXTURE_SIZE) * TEXTURE_SIZE);
+        for (uint32_t& pixel : pixels) {
+            pixel = g_Random();
+        }
+        return pixels;
+    }
+
+    TextureDesc makeDesc() noexcept {
+        TextureDesc desc;
+        desc.Width  = TEXTURE_SIZE;
+        desc.Height = TEXTURE_SIZE;
+        desc.Format = TextureFormat::RGBA8;
+        return desc;
+    }
+
+    /// @brief 프레임 하나를 마칩니다.
+    void endFrame(NullRenderDevice& device, ResourceManager& manager) noexcept {
+        float color[4] = {};
+        device.BeginFrame(color);
+        device.EndFrame();
+        manager.EndFrame();
+    }
+
+    /// @brief 중복 제거, 해제 대기, 되살리기를 확인합니다.
+    void checkSharing(NullRenderDevice& device) {
+        ResourceManager manager(device);
+        const TextureDesc desc = makeDesc();
+        const std::vector<uint32_t> first = makePixels();
+        const std::vector<uint32_t> second = makePixels();
+        const uint64_t uploaded = device.GetTotalStats().BytesUploaded;
+
+        const TextureHandle a = manager.AcquireTexture(desc, first.data());
+        const TextureHandle b = manager.AcquireTexture(desc, first.data());
+        const TextureHandle c = manager.AcquireTexture(desc, second.data());
+        Check(a.IsValid() && a == b && a != c, "same content shares, different content does not");
+        Check(device.GetTotalStats().BytesUploaded - uploaded == 2U * GetTextureDataSize(desc), "shared texture is uploaded once");
+
+        ResourceUsage usage = manager.GetUsage();
+        Check(usage.TextureCount == 2U && usage.SharedCount == 1U && usage.SharedBytes == GetTextureDataSize(desc), "usage counts sharing");
+
+        manager.Release(a);
+        manager.Release(b);
+        manager.Release(c);
+        Check(manager.GetUsage().PendingCount == 2U, "released textures wait");
+        endFrame(device, manager);
+        const TextureHandle revived = manager.AcquireTexture(desc, first.data());
+        Check(revived == a && manager.GetUsage().PendingCount == 1U, "pending texture is revived");
+
+        for (uint32_t i = 0U; i < ResourceManager::FRAME_LATENCY; ++i) {
+            endFrame(device, manager);
+        }
+        usage = manager.GetUsage();
+        Check(usage.TextureCount == 1U && usage.PendingCount == 0U && usage.DestroyedCount == 1U, "pending texture is destroyed after FRAME_LATENCY frames");
+        manager.Release(revived);
+
+        BufferDesc bufferDesc;
+        bufferDesc.Usage = BufferUsage::Immutable;
+        bufferDesc.Size = 256U;
+        const BufferHandle immutableA = manager.AcquireBuffer(bufferDesc, first.data());
+        const BufferHandle immutableB = manager.AcquireBuffer(bufferDesc, first.data());
+        bufferDesc.Usage = BufferUsage::Dynamic;
+        const BufferHandle dynamicA = manager.AcquireBuffer(bufferDesc, first.data());
+        const BufferHandle dynamicB = manager.AcquireBuffer(bufferDesc, first.data());
+        Check(immutableA == immutableB && dynamicA != dynamicB, "only immutable buffers are shared");
+    }
+
+    /// @brief 내용 키가 충돌하면 내용 검증이 공유를 막는지 확인합니다.
+    /// @note 64비트 해시 충돌은 만들 수 없으므로, 호출자가 넘기는 내용 키를 같게 주어 충돌을 흉내 냅니다.
+    void checkCollision(NullRenderDevice& device) {
+        const TextureDesc desc = makeDesc();
+        const std::vector<uint32_t> first = makePixels();
+        const std::vector<uint32_t> second = makePixels();
+        constexpr uint64_t KEY = 42ULL;
+
+        {
+            ResourceManager manager(device);
+            const TextureHandle a = manager.AcquireTexture(desc, first.data(), KEY);
+            const TextureHandle b = manager.AcquireTexture(desc, second.data(), KEY);
+            Check(a == b && manager.GetUsage().CollisionCount == 0U, "without verification a colliding key shares (documented risk)");
+        }
+
+        ResourceManager manager(device);
+        manager.SetVerifyContent(true);
+        const TextureHandle a = manager.AcquireTexture(desc, first.data(), KEY);
+        const TextureHandle b = manager.AcquireTexture(desc, second.data(), KEY);
+        const TextureHandle c = manager.AcquireTexture(desc, first.data(), KEY);
+        ResourceUsage usage = manager.GetUsage();
+        Check(a.IsValid() && b.IsValid() && a != b && a == c, "verification keeps colliding content apart");
+        Check(usage.CollisionCount == 1U && usage.TextureCount == 2U && usage.SharedCount == 1U, "collision is counted");
+
+        // 충돌한 텍스처는 공유하지 않는 리소스이므로 해제해도 원래 키의 텍스처는 남음
+        manager.Release(b);
+        for (uint32_t i = 0U; i < ResourceManager::FRAME_LATENCY; ++i) {
+            endFrame(device, manager);
+        }
+        Check(manager.AcquireTexture(desc, first.data(), KEY) == a && manager.GetUsage().TextureCount == 1U, "destroying the collided texture keeps the original key");
+
+        BufferDesc bufferDesc;
+        bufferDesc.Usage = BufferUsage::Immutable;
+        bufferDesc.Size = 64U;
+        const BufferHandle bufferA = manager.AcquireBuffer(bufferDesc, first.data(), KEY);
+        const BufferHandle bufferB = manager.AcquireBuffer(bufferDesc, second.data(), KEY);
+        Check(bufferA != bufferB && manager.GetUsage().CollisionCount == 2U, "verification covers buffers");
+    }
+
+    /// @brief 씬을 전환하며 텍스처를 다시 요청할 때 업로드 크기와 관리 비용을 잽니다.
+    /// @note 씬마다 400개를 요청하지만 서로 다른 텍스처는 96개이고, 이웃한 씬은 16개만 다릅니다.
+    ///       NullRenderDevice는 데이터를 복사하지 않으므로 시간은 관리 비용(해시, 목록)만 보여줍니다. 요청마다 만들었을 때의 업로드 크기는
+    ///       시간을 재지 않고 계산으로만 비교합니다.
+    void benchmark(NullRenderDevice& device) {
+        const TextureDesc desc = makeDesc();
+        std::vector<std::vector<uint32_t>> textures;
+        for (uint32_t i = 0U; i < UNIQUE_TEXTURES; ++i) {
+            textures.push_back(makePixels());
+        }
+        const auto pick = [](uint32_t scene, uint32_t i) noexcept {
+            return (scene * 16U + (i * 2654435761U >> 7U) % UNIQUE_TEXTURES) % UNIQUE_TEXTURES;
+        };
+
+        const uint64_t requestedBytes = static_cast<uint64_t>(SCENE_COUNT) * SCENE_TEXTURES * GetTextureDataSize(desc);
+
+        std::vector<uint64_t> keys;
+        for (const std::vector<uint32_t>& texture : textures) {
+            keys.push_back(Hash64(texture.data(), texture.size() * sizeof(uint32_t)));
+        }
+
+        // 쿠킹된 자산처럼 내용 키를 넘기면 해시 계산을 생략
+        const auto runManaged = [&](bool cooked, uint64_t& bytes, uint64_t& shared) {
+            ResourceManager manager(device);
+            const uint64_t before = device.GetTotalStats().BytesUploaded;
+            const double begin = Now();
+            std::vector<TextureHandle> previous;
+            for (uint32_t scene = 0U; scene < SCENE_COUNT; ++scene) {
+                std::vector<TextureHandle> handles;
+                for (uint32_t i = 0U; i < SCENE_TEXTURES; ++i) {
+                    const uint32_t index = pick(scene, i);
+                    handles.push_back(manager.AcquireTexture(desc, textures[index].data(), cooked ? keys[index] : 0ULL));
+                }
+                for (const TextureHandle handle : previous) {
+                    manager.Release(handle);
+                }
+                endFrame(device, manager);
+                previous = std::move(handles);
+            }
+            bytes = device.GetTotalStats().BytesUploaded - before;
+            shared = manager.GetUsage().SharedCount;
+            return Now() - begin;
+        };
+        uint64_t managedBytes = 0ULL;
+        uint64_t cookedBytes = 0ULL;
+        uint64_t shared = 0ULL;
+        const double managedTime = runManaged(false, managedBytes, shared);
+        const double cookedTime = runManaged(true, cookedBytes, shared);
+        Check(managedBytes * 4U < requestedBytes && cookedBytes == managedBytes, "manager uploads far less than one texture per request");
+
+        std::printf("benchmark (%u scenes x %u textures, %u unique, %dx%d RGBA8)\n", SCENE_COUNT, SCENE_TEXTURES, UNIQUE_TEXTURES, TEXTURE_SIZE, TEXTURE_SIZE);
+        std::printf("  requested %7.1f MB (one upload per request, not timed)\n", static_cast<double>(requestedBytes) / 1048576.0);
+        std::printf("  manager  %8.1f MB uploaded %8.2f ms  (hash every request, shared %llu)\n", static_cast<double>(managedBytes) / 1048576.0, managedTime * 1e3, static_cast<unsigned long long>(shared));
+        std::printf("  manager  %8.1f MB uploaded %8.2f ms  (cooked content keys)\n", static_cast<double>(cookedBytes) / 1048576.0, cookedTime * 1e3);
+    }
+}
+
+/// @brief ResourceManager 테스트 진입점
+/// @note 사용법: ResourceManagerTest [--no-bench]
+int main(int argc, char* argv[]) {
+    NullRenderDevice device;
+    if (!Check(device.Initialize(nullptr, 640, 480, false, false), "NullRenderDevice initializes")) {
+        return Finish("ResourceManagerTest");
+    }
+
+    checkSharing(device);
+    checkCollision(device);
+
+    if (argc < 2 || std::string(argv[1]) != "--no-bench") {
+        benchmark(device);
+    }
+
+    return Finish("ResourceManagerTest");
+}
\ No newline at end of file
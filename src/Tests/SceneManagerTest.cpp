@@ -0,0 +1,418 @@
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Graphics/NullRenderDevice.hpp"
+#include "Scene/SceneManager.hpp"
+#include "TestCommon.hpp"
+
+using namespace tests;
+using namespace graphics;
+using namespace scene;
+
+namespace {
+    constexpr double LOAD_TIMEOUT       = 5.0;      ///< 비동기 로딩을 기다리는 최대 시간 (초 단위)
+    constexpr uint32_t BENCH_FRAMES     = 100000U;  ///< 벤치마크 프레임 수
+
+    /// @brief 장면들이 남기는 호출 기록
+    class Journal final {
+    private:
+        mutable std::mutex m_Mutex;
+        std::vector<std::string> m_Events;          ///< "장면:호출" 목록
+
+    public:
+        std::thread::id MainThread = std::this_thread::get_id();    ///< 장면 관리자를 구동하는 스레드
+        std::atomic<uint32_t> OffMainCalls{ 0U };                   ///< 메인 스레드 밖에서 호출된 OnLoadAsync 외의 호출 수
+        std::atomic<uint32_t> LoadsOffMain{ 0U };                   ///< 메인 스레드 밖에서 호출된 OnLoadAsync 수
+
+        void Add(const std::string& scene, const char* event) {
+            const std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Events.push_back(scene + ":" + event);
+        }
+
+        /// @brief 기록을 꺼내고 비웁니다.
+        std::string Take() {
+            const std::lock_guard<std::mutex> lock(m_Mutex);
+            std::string joined;
+            for (const std::string& event : m_Events) {
+                joined += (joined.empty() ? "" : " ") + event;
+            }
+            m_Events.clear();
+            return joined;
+        }
+    };
+
+    /// @brief 그릴 때 기록을 남기는 스냅샷
+    class JournalSnapshot final : public RenderSnapshot {
+    public:
+        JournalSnapshot(Journal& journal, std::string name) noexcept : m_Journal(journal), m_Name(std::move(name)) {}
+
+        void Render(IRenderDevice*) noexcept override {
+            m_Journal.Add(m_Name, "DrawSnapshot");
+        }
+
+    private:
+        Journal& m_Journal;
+        std::string m_Name;
+    };
+
+    /// @brief 장면 동작 설정
+    struct SceneOptions final {
+        bool Reset = false;                         ///< OnReset 지원 여부
+        bool Snapshot = false;                      ///< 렌더 스냅샷 지원 여부
+        std::atomic<bool>* LoadGate = nullptr;      ///< OnLoadAsync가 이 값이 true가 될 때까지 대기 (nullptr: 대기 안 함)
+        const char* ChangeOnUpdate = nullptr;       ///< Update에서 ChangeScene할 장면
+    };
+
+    /// @brief 모든 호출을 기록하는 장면
+    class JournalScene final : public SceneBase {
+    public:
+        JournalScene(Journal& journal, std::string name, SceneOptions options) noexcept : m_Journal(journal), m_Name(std::move(name)), m_Options(options) {}
+
+        bool OnLoadAsync(SceneLoadContext& context) noexcept override {
+            if (std::this_thread::get_id() != m_Journal.MainThread) {
+                m_Journal.LoadsOffMain.fetch_add(1U, std::memory_order_relaxed);
+            }
+            context.SetProgress(0.5f);
+            while (m_Options.LoadGate && !m_Options.LoadGate->load() && !context.IsCancelled()) {
+                std::this_thread::yield();
+            }
+            m_Journal.Add(m_Name, "LoadAsync");
+            return !context.IsCancelled();
+        }
+
+        bool OnCreate() noexcept override { return record("Create"); }
+        void OnDestroy() noexcept override { (void)record("Destroy"); }
+        void OnEnter() noexcept override { (void)record("Enter"); }
+        void OnExit() noexcept override { (void)record("Exit"); }
+        void OnPause() noexcept override { (void)record("Pause"); }
+        void OnResume() noexcept override { (void)record("Resume"); }
+        bool OnReset() noexcept override { return m_Options.Reset && record("Reset"); }
+        void Input() noexcept override { (void)record("Input"); }
+
+        void Update(double) noexcept override {
+            (void)record("Update");
+            if (m_Options.ChangeOnUpdate) {
+                const bool accepted = GetSceneManager()->ChangeScene(m_Options.ChangeOnUpdate);
+                m_Journal.Add(m_Name, (accepted && GetSceneManager()->GetCurrentScene() == this) ? "Deferred" : "Applied");
+            }
+        }
+
+        void Render() noexcept override { (void)record("Render"); }
+
+        std::unique_ptr<RenderSnapshot> CreateSnapshot() noexcept override {
+            if (!m_Options.Snapshot) {
+                return nullptr;
+            }
+            (void)record("CreateSnapshot");
+            return std::make_unique<JournalSnapshot>(m_Journal, m_Name);
+        }
+
+    protected:
+        void onPreRender() noexcept override {}
+        void onRender3D() noexcept override {}
+        void onRender2D() noexcept override {}
+        void onPostRender() noexcept override {}
+
+    private:
+        bool record(const char* event) noexcept {
+            if (std::this_thread::get_id() != m_Journal.MainThread) {
+                m_Journal.OffMainCalls.fetch_add(1U, std::memory_order_relaxed);
+            }
+            m_Journal.Add(m_Name, event);
+            return true;
+        }
+
+        Journal& m_Journal;
+        std::string m_Name;
+        SceneOptions m_Options;
+    };
+
+    /// @brief 기록을 꺼내 기대한 호출 순서와 비교합니다.
+    /// @return 같음(true), 다름(false: 실제 기록을 출력)
+    bool expect(Journal& journal, const char* expected) {
+        const std::string actual = journal.Take();
+        if (actual != expected) {
+            std::printf("  expected: %s\n  actual:   %s\n", expected, actual.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    /// @brief 장면을 등록합니다.
+    void addScene(SceneManager& manager, Journal& journal, const char* name, SceneOptions options = {}, ScenePolicy policy = {}) {
+        (void)manager.AddScene(name, [&journal, name, options] { return std::make_unique<JournalScene>(journal, name, options); }, policy);
+    }
+
+    /// @brief 비동기 로딩이 끝날 때까지 ProcessPendingLoad를 호출합니다.
+    bool waitLoad(SceneManager& manager) {
+        const double end = Now() + LOAD_TIMEOUT;
+        while (manager.IsLoading() && Now() < end) {
+            manager.ProcessPendingLoad();
+            std::this_thread::yield();
+        }
+        return !manager.IsLoading();
+    }
+
+    /// @brief 로딩 스레드에서 OnLoadAsync가, 메인 스레드에서 OnCreate와 스택 교체가 실행되는지 확인합니다.
+    void checkAsyncLoad() {
+        Journal journal;
+        std::atomic<bool> gate{ false };
+        SceneManager manager;
+        addScene(manager, journal, "title");
+        addScene(manager, journal, "loading");
+        addScene(manager, journal, "game", { false, false, &gate, nullptr });
+        (void)manager.ChangeScene("title");
+        (void)journal.Take();
+
+        Check(manager.LoadSceneAsync("game", SceneLoadMode::Change, "loading") && !manager.LoadSceneAsync("game"), "second LoadSceneAsync is refused while loading");
+        Check(expect(journal, "loading:Create title:Pause loading:Enter"), "loading screen is pushed immediately");
+
+        // 로딩 스레드가 끝나기 전에는 스택이 그대로
+        for (uint32_t i = 0U; i < 10U; ++i) {
+            manager.ProcessPendingLoad();
+        }
+        Check(manager.IsLoading() && expect(journal, ""), "stack is unchanged until the load finishes");
+
+        gate.store(true);
+        Check(waitLoad(manager), "async load completes");
+        Check(expect(journal, "game:LoadAsync loading:Exit loading:Destroy title:Resume game:Create title:Exit title:Destroy game:Enter"),
+            "finished load removes the loading screen and replaces the current scene");
+        Check(journal.LoadsOffMain.load() == 1U && journal.OffMainCalls.load() == 0U, "OnLoadAsync runs on the loading thread, everything else on the main thread");
+        Check(manager.GetSceneStats("game").Builds == 1U && manager.GetLoadProgress() == 0.0f, "async load counts one build");
+
+        // Push 모드는 현재 장면을 일시 정지하고 위에 쌓음
+        Check(manager.LoadSceneAsync("title", SceneLoadMode::Push) && waitLoad(manager), "push load completes");
+        Check(expect(journal, "title:LoadAsync title:Create game:Pause title:Enter"), "push load pauses the current scene");
+
+        // 취소된 로딩은 OnCreate 없이 버려짐
+        gate.store(false);
+        Check(manager.LoadSceneAsync("game", SceneLoadMode::Change, "loading"), "cancellable load starts");
+        const double end = Now() + LOAD_TIMEOUT;
+        while (manager.GetLoadProgress() < 0.5f && Now() < end) {
+            std::this_thread::yield();
+        }
+        manager.CancelLoad();
+        Check(waitLoad(manager), "cancelled load finishes");
+        Check(expect(journal, "loading:Create title:Pause loading:Enter game:LoadAsync loading:Exit loading:Destroy title:Resume"),
+            "cancelled load discards the scene and keeps the stack");
+        Check(manager.GetSceneStats("game").Builds == 1U && journal.OffMainCalls.load() == 0U, "cancelled load never calls OnCreate");
+    }
+
+    /// @brief 풀에 보관된 장면이 OnCreate 대신 OnReset으로 재사용되는지 확인합니다.
+    void checkPool() {
+        Journal journal;
+        SceneManager manager;
+        addScene(manager, journal, "world");
+        addScene(manager, journal, "menu", { true, false, nullptr, nullptr }, { 1U });
+        addScene(manager, journal, "plain", {}, { 1U });
+        (void)manager.ChangeScene("world");
+        (void)journal.Take();
+
+        Check(manager.LoadScene("menu") && manager.RemoveScene("menu"), "menu opens and closes");
+        Check(expect(journal, "menu:Create world:Pause menu:Enter menu:Exit world:Resume") && manager.GetSceneStats("menu").Pooled == 1U,
+            "closed scene is kept in the pool without OnDestroy");
+
+        Check(manager.LoadScene("menu"), "pooled menu opens again");
+        const SceneStats stats = manager.GetSceneStats("menu");
+        Check(expect(journal, "menu:Reset world:Pause menu:Enter") && stats.Builds == 1U && stats.PoolHits == 1U && stats.Pooled == 0U,
+            "pooled scene gets OnReset and not OnCreate");
+
+        // 비동기 로딩도 풀 인스턴스를 쓰면 로딩 스레드 없이 메인 스레드에서 OnReset
+        Check(manager.RemoveScene("menu") && manager.LoadSceneAsync("menu", SceneLoadMode::Push) && waitLoad(manager), "pooled async load completes");
+        Check(expect(journal, "menu:Exit world:Resume menu:Reset world:Pause menu:Enter") && manager.GetSceneStats("menu").PoolHits == 2U && journal.LoadsOffMain.load() == 0U,
+            "pooled async load skips OnLoadAsync and uses OnReset");
+
+        // OnReset을 지원하지 않으면 파괴 후 새로 생성
+        Check(manager.LoadScene("plain") && manager.RemoveScene("plain") && manager.LoadScene("plain"), "plain scene cycles through the pool");
+        Check(expect(journal, "plain:Create menu:Pause plain:Enter plain:Exit menu:Resume plain:Destroy plain:Create menu:Pause plain:Enter")
+            && manager.GetSceneStats("plain").Builds == 2U, "failed OnReset destroys the pooled instance and builds a new one");
+
+        manager.ClearScenePool();
+        (void)manager.RemoveScene("menu");
+        manager.ClearScenePool("menu");
+        Check(expect(journal, "menu:Exit menu:Destroy") && manager.GetSceneStats("menu").Pooled == 0U, "ClearScenePool destroys pooled instances");
+    }
+
+    /// @brief 레이어 플래그에 따라 아래 장면이 갱신되고 그려지는지 확인합니다.
+    void checkLayers() {
+        Journal journal;
+        SceneManager manager;
+        addScene(manager, journal, "world");
+        addScene(manager, journal, "hud");
+        addScene(manager, journal, "menu");
+        addScene(manager, journal, "popup");
+        (void)manager.ChangeScene("world");
+
+        const auto frame = [&] {
+            (void)journal.Take();
+            manager.Input();
+            manager.Update(0.016);
+            manager.Render();
+            return journal.Take();
+        };
+
+        Check(manager.LoadScene("hud", SceneLayer::RenderThrough | SceneLayer::UpdateThrough), "hud opens");
+        Check(frame() == "hud:Input world:Update hud:Update world:Render hud:Render", "UpdateThrough and RenderThrough keep the scene below running and drawn");
+
+        Check(manager.LoadScene("menu", SceneLayer::RenderThrough), "menu opens");
+        Check(frame() == "menu:Input menu:Update world:Render hud:Render menu:Render", "RenderThrough alone pauses the scenes below but still draws them");
+
+        Check(manager.LoadScene("popup"), "popup opens");
+        Check(frame() == "popup:Input popup:Update popup:Render", "opaque layer hides and pauses everything below");
+
+        Check(manager.SetSceneLayer("popup", SceneLayer::UpdateThrough) && frame() == "popup:Input menu:Update popup:Update popup:Render",
+            "SetSceneLayer changes pass-through at runtime");
+
+        Check(manager.Pause() && frame() == "menu:Update", "paused top scene receives no input and is not drawn");
+        Check(manager.Resume() && manager.RemoveScene("popup") && manager.RemoveScene("menu"), "overlays close");
+        Check(frame() == "hud:Input world:Update hud:Update world:Render hud:Render", "closing overlays restores the original layers");
+    }
+
+    /// @brief Update 중의 스택 변경이 다음 ProcessPendingLoad까지 미뤄지는지 확인합니다.
+    void checkDeferredChanges() {
+        Journal journal;
+        SceneManager manager;
+        addScene(manager, journal, "first", { false, false, nullptr, "second" });
+        addScene(manager, journal, "second");
+        (void)manager.ChangeScene("first");
+        (void)journal.Take();
+
+        manager.Update(0.016);
+        Check(expect(journal, "first:Update first:Deferred"), "ChangeScene inside Update is deferred");
+        manager.Render();
+        Check(expect(journal, "first:Render"), "deferred change leaves the scene in place for the rest of the frame");
+
+        manager.ProcessPendingLoad();
+        Check(expect(journal, "second:Create first:Exit first:Destroy second:Enter"), "ProcessPendingLoad applies the deferred change");
+    }
+
+    /// @brief 가려진 레이어 캐시와 렌더 스냅샷이 장면 일련번호가 바뀌면 다시 만들어지는지 확인합니다.
+    void checkCacheInvalidation() {
+        NullRenderDevice device;
+        if (!Check(device.Initialize(nullptr, 64, 48, false, false), "NullRenderDevice initializes")) {
+            return;
+        }
+
+        Journal journal;
+        {
+            SceneManager manager;
+            manager.SetRenderDevice(&device);
+            addScene(manager, journal, "world", { false, true, nullptr, nullptr });
+            addScene(manager, journal, "pause", { false, true, nullptr, nullptr });
+            (void)manager.ChangeScene("world");
+            (void)manager.LoadScene("pause", SceneLayer::RenderThrough | SceneLayer::CacheBelow);
+            (void)journal.Take();
+
+            manager.Render();
+            Check(expect(journal, "world:Render pause:Render"), "first frame draws the paused layer and caches it");
+            manager.Render();
+            Check(expect(journal, "pause:Render"), "next frame restores the cached layer");
+
+            // 같은 인스턴스가 그대로면 캐시 유지
+            (void)manager.RemoveScene("pause");
+            (void)manager.LoadScene("pause", SceneLayer::RenderThrough | SceneLayer::CacheBelow);
+            (void)journal.Take();
+            manager.Render();
+            Check(expect(journal, "pause:Render"), "reopening the overlay keeps the cache of the same scene");
+
+            // 아래 장면이 새 인스턴스로 바뀌면 일련번호가 달라 다시 그림
+            (void)manager.RemoveScene("pause");
+            (void)manager.ReloadScene();
+            (void)manager.LoadScene("pause", SceneLayer::RenderThrough | SceneLayer::CacheBelow);
+            (void)journal.Take();
+            manager.Render();
+            Check(expect(journal, "world:Render pause:Render"), "reloaded scene below invalidates the cache");
+            manager.Render();
+            Check(expect(journal, "pause:Render"), "cache is reused again after redrawing");
+
+            manager.InvalidateLayerCache();
+            manager.Render();
+            Check(expect(journal, "world:Render pause:Render"), "InvalidateLayerCache forces a redraw");
+
+            // 스냅샷도 일련번호가 바뀐 레이어만 새로 생성 (발행과 취득을 번갈아 하면 세 슬롯을 차례로 씀)
+            const auto cycleSlots = [&] {
+                bool acquired = true;
+                for (uint32_t i = 0U; i < 3U; ++i) {
+                    manager.PublishSnapshot();
+                    acquired = manager.AcquireSnapshot() && acquired;
+                }
+                return acquired;
+            };
+            Check(cycleSlots() && expect(journal, "world:CreateSnapshot pause:CreateSnapshot world:CreateSnapshot pause:CreateSnapshot world:CreateSnapshot pause:CreateSnapshot"),
+                "each slot creates a snapshot per layer once");
+            Check(cycleSlots() && expect(journal, ""), "unchanged serials reuse every snapshot");
+            manager.RenderFromSnapshot();
+            Check(expect(journal, "pause:DrawSnapshot"), "snapshot rendering restores the cached layer");
+
+            (void)manager.RemoveScene("pause");
+            (void)manager.LoadScene("pause", SceneLayer::RenderThrough | SceneLayer::CacheBelow);
+            (void)journal.Take();
+            Check(cycleSlots() && expect(journal, "pause:CreateSnapshot pause:CreateSnapshot pause:CreateSnapshot"), "new serial recreates only that layer's snapshot");
+            manager.RenderFromSnapshot();
+            Check(expect(journal, "pause:DrawSnapshot"), "cache survives a new serial on the top layer only");
+        }
+        Check(device.GetTextureCount() == 0U, "layer cache texture is released with the manager");
+    }
+
+    /// @brief 레이어 세 개의 프레임 처리 시간을 잽니다.
+    void benchmark() {
+        /// @brief 아무것도 하지 않는 장면
+        class EmptyScene final : public SceneBase {
+        public:
+            bool OnCreate() noexcept override { return true; }
+            void OnDestroy() noexcept override {}
+            void OnEnter() noexcept override {}
+            void OnExit() noexcept override {}
+            void OnPause() noexcept override {}
+            void OnResume() noexcept override {}
+            void Input() noexcept override {}
+            void Update(double) noexcept override {}
+            void Render() noexcept override {}
+
+        protected:
+            void onPreRender() noexcept override {}
+            void onRender3D() noexcept override {}
+            void onRender2D() noexcept override {}
+            void onPostRender() noexcept override {}
+        };
+
+        SceneManager manager;
+        for (const char* name : { "world", "hud", "menu" }) {
+            (void)manager.AddScene(name, [] { return std::make_unique<EmptyScene>(); });
+        }
+        (void)manager.ChangeScene("world");
+        (void)manager.LoadScene("hud", SceneLayer::RenderThrough | SceneLayer::UpdateThrough);
+        (void)manager.LoadScene("menu", SceneLayer::RenderThrough | SceneLayer::UpdateThrough);
+
+        const double time = MeasureBest(3, [&] {
+            for (uint32_t i = 0U; i < BENCH_FRAMES; ++i) {
+                manager.ProcessPendingLoad();
+                manager.Input();
+                manager.Update(0.016);
+                manager.Render();
+            }
+        });
+        std::printf("benchmark (3 pass-through layers, %u frames)\n", BENCH_FRAMES);
+        std::printf("  frame overhead %8.1f ns\n", time * 1e9 / BENCH_FRAMES);
+    }
+}
+
+/// @brief SceneManager 테스트 진입점
+/// @note 사용법: SceneManagerTest [--no-bench]
+int main(int argc, char* argv[]) {
+    checkAsyncLoad();
+    checkPool();
+    checkLayers();
+    checkDeferredChanges();
+    checkCacheInvalidation();
+
+    if (argc < 2 || std::string(argv[1]) != "--no-bench") {
+        benchmark();
+    }
+
+    return Finish("SceneManagerTest");
+}
\ No newline at end of file
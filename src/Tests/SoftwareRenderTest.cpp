@@ -0,0 +1,364 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Graphics/SoftwareRenderDevice.hpp"
+#include "TestCommon.hpp"
+
+using namespace graphics;
+using namespace tests;
+
+namespace {
+    constexpr int32_t GOLDEN_WIDTH  = 160;          ///< 기준 이미지 너비 (가로 3타일, 마지막 타일은 일부만 사용)
+    constexpr int32_t GOLDEN_HEIGHT = 120;          ///< 기준 이미지 높이 (세로 2타일)
+    constexpr int32_t CHANNEL_TOLERANCE = 2;        ///< 채널마다 허용하는 차이 (컴파일러의 부동 소수점 축약 차이 흡수)
+    constexpr double PIXEL_TOLERANCE = 0.005;       ///< 허용 범위를 넘어도 되는 픽셀 비율
+
+    /// @brief 고정 장면
+    struct Scene final {
+        const char* Name;                                   ///< 이름 (기준 이미지 파일 이름)
+        void (*Draw)(SoftwareRenderDevice&);                ///< 그리기 함수
+    };
+
+    /// @brief 정점 버퍼를 만듭니다.
+    BufferHandle createVertexBuffer(SoftwareRenderDevice& device, const std::vector<SoftwareVertex>& vertices) noexcept {
+        BufferDesc desc;
+        desc.Type   = BufferType::Vertex;
+        desc.Usage  = BufferUsage::Immutable;
+        desc.Size   = static_cast<uint32_t>(vertices.size() * sizeof(SoftwareVertex));
+        desc.Stride = sizeof(SoftwareVertex);
+        return device.CreateBuffer(desc, vertices.data());
+    }
+
+    /// @brief 색상, 텍스처, 근평면 클리핑 장면
+    void drawTriangles(SoftwareRenderDevice& device) noexcept {
+        const std::vector<SoftwareVertex> vertices = {
+            { -0.9f, -0.9f, 0.5f, 0xFF0000FFU, 0.0f, 1.0f }, { 0.0f, 0.9f, 0.5f, 0xFF00FF00U, 0.5f, 0.0f }, { 0.9f, -0.9f, 0.5f, 0xFFFF0000U, 1.0f, 1.0f },
+            // 근평면(z = 0)을 가로지르는 삼각형
+            { -2.0f, -0.5f, -0.5f, 0xFFFFFFFFU, 0.0f, 0.0f }, { 0.0f, 3.0f, 0.8f, 0xFFFFFFFFU, 0.0f, 0.0f }, { 2.0f, -0.5f, 0.2f, 0xFFFFFFFFU, 0.0f, 0.0f },
+            // 클리핑된 삼각형 앞의 작은 텍스처 삼각형 (반복 주소 지정)
+            { 0.2f, 0.2f, 0.01f, 0xFFFFFFFFU, 0.0f, 0.0f }, { 0.5f, 0.8f, 0.01f, 0xFF80FFFFU, 4.0f, 0.0f }, { 0.8f, 0.2f, 0.01f, 0xFFFFFFFFU, 4.0f, 4.0f },
+        };
+        const BufferHandle vertexBuffer = createVertexBuffer(device, vertices);
+
+        const uint32_t texels[4] = { 0xFFFFFFFFU, 0xFF404040U, 0xFF404040U, 0xFFFFFFFFU };
+        TextureDesc textureDesc;
+        textureDesc.Width   = 2;
+        textureDesc.Height  = 2;
+        const TextureHandle texture = device.CreateTexture(textureDesc, texels);
+
+        device.SetVertexBuffer(vertexBuffer);
+        device.SetTexture(0U, TextureHandle{});
+        device.Draw(3U, 3U);
+        device.Draw(3U, 0U);
+        device.SetTexture(0U, texture);
+        device.Draw(3U, 6U);
+
+        // 텍스처는 EndFrame의 래스터화에서 읽으므로 디바이스와 함께 해제 (버퍼는 제출할 때 읽음)
+        device.DestroyBuffer(vertexBuffer);
+    }
+
+    /// @brief 원근 투영, 깊이 테스트, 후면 컬링 장면
+    void drawDepth(SoftwareRenderDevice& device) noexcept {
+        // 원근 투영 상자 두 개 (앞면 CW), 먼 것을 나중에 그려 깊이 테스트로 가려지게 함
+        std::vector<SoftwareVertex> vertices;
+        auto addQuad = [&](float x0, float y0, float x1, float y1, float z, uint32_t color, bool clockwise) {
+            const SoftwareVertex a = { x0, y0, z, color, 0.0f, 0.0f };
+            const SoftwareVertex b = { x0, y1, z, color, 0.0f, 0.0f };
+            const SoftwareVertex c = { x1, y1, z, color, 0.0f, 0.0f };
+            const SoftwareVertex d = { x1, y0, z, color, 0.0f, 0.0f };
+            if (clockwise) {
+                vertices.insert(vertices.end(), { a, b, c, a, c, d });
+            } else {
+                vertices.insert(vertices.end(), { a, c, b, a, d, c });
+            }
+        };
+        addQuad(-1.0f, -0.8f, 0.6f, 0.8f, 3.0f, 0xFF2080F0U, true);         // 가까운 면
+        addQuad(-0.4f, -1.2f, 1.4f, 0.4f, 5.0f, 0xFFF08020U, true);         // 먼 면 (일부 가려짐)
+        addQuad(-1.5f, -1.5f, 1.5f, 1.5f, 2.5f, 0xFF00FF00U, false);        // 후면 (컬링되어야 함)
+        const BufferHandle vertexBuffer = createVertexBuffer(device, vertices);
+
+        // v * M: Z축 회전 후 원근 투영 (시야각 90도, 근 1, 원 10, z / w는 [0, 1])
+        const float angle = 0.3f;
+        const float c = std::cos(angle);
+        const float s = std::sin(angle);
+        const float aspect = static_cast<float>(GOLDEN_WIDTH) / static_cast<float>(GOLDEN_HEIGHT);
+        const float farZ = 10.0f;
+        const float nearZ = 1.0f;
+        const float q = farZ / (farZ - nearZ);
+        const float matrix[16] = {
+             c / aspect,  s, 0.0f, 0.0f,
+            -s / aspect,  c, 0.0f, 0.0f,
+             0.0f, 0.0f, q, 1.0f,
+             0.0f, 0.0f, -q * nearZ, 0.0f,
+        };
+        BufferDesc constantDesc;
+        constantDesc.Type   = BufferType::Constant;
+        constantDesc.Size   = sizeof(matrix);
+        const BufferHandle constantBuffer = device.CreateBuffer(constantDesc, matrix);
+
+        device.SetVertexBuffer(vertexBuffer);
+        device.SetConstantBuffer(0U, constantBuffer);
+        device.Draw(static_cast<uint32_t>(vertices.size()), 0U);
+        device.SetConstantBuffer(0U, BufferHandle{});
+
+        device.DestroyBuffer(constantBuffer);
+        device.DestroyBuffer(vertexBuffer);
+    }
+
+    /// @brief 타일 경계를 가로지르는 작은 삼각형 격자 장면 (16비트 인덱스, 스트립)
+    void drawGrid(SoftwareRenderDevice& device) noexcept {
+        constexpr uint32_t CELLS_X = 23U;
+        constexpr uint32_t CELLS_Y = 17U;
+        std::vector<SoftwareVertex> vertices;
+        for (uint32_t y = 0U; y <= CELLS_Y; ++y) {
+            for (uint32_t x = 0U; x <= CELLS_X; ++x) {
+                const float fx = -0.95f + 1.9f * static_cast<float>(x) / CELLS_X;
+                const float fy = -0.95f + 1.9f * static_cast<float>(y) / CELLS_Y;
+                const uint32_t r = (x * 255U) / CELLS_X;
+                const uint32_t g = (y * 255U) / CELLS_Y;
+                const uint32_t b = ((x ^ y) & 1U) ? 0xC0U : 0x30U;
+                vertices.push_back({ fx, fy, 0.2f + 0.03f * static_cast<float>(x % 7U), 0xFF000000U | (b << 16) | (g << 8) | r, 0.0f, 0.0f });
+            }
+        }
+
+        std::vector<uint16_t> indices;
+        for (uint32_t y = 0U; y < CELLS_Y; ++y) {
+            for (uint32_t x = 0U; x < CELLS_X; ++x) {
+                const uint16_t i0 = static_cast<uint16_t>(y * (CELLS_X + 1U) + x);
+                const uint16_t i1 = static_cast<uint16_t>(i0 + CELLS_X + 1U);
+                // 체크 무늬로 한 칸씩 비움
+                if (((x + y) % 5U) == 0U) {
+                    continue;
+                }
+                indices.insert(indices.end(), { i0, i1, static_cast<uint16_t>(i1 + 1U), i0, static_cast<uint16_t>(i1 + 1U), static_cast<uint16_t>(i0 + 1U) });
+            }
+        }
+        const BufferHandle vertexBuffer = createVertexBuffer(device, vertices);
+
+        BufferDesc indexDesc;
+        indexDesc.Type  = BufferType::Index;
+        indexDesc.Usage = BufferUsage::Immutable;
+        indexDesc.Size  = static_cast<uint32_t>(indices.size() * sizeof(uint16_t));
+        const BufferHandle indexBuffer = device.CreateBuffer(indexDesc, indices.data());
+
+        device.SetVertexBuffer(vertexBuffer);
+        device.SetIndexBuffer(indexBuffer, IndexFormat::UInt16);
+        device.DrawIndexed(static_cast<uint32_t>(indices.size()), 0U, 0);
+
+        // 앞쪽에 겹치는 띠 (스트립)
+        const std::vector<SoftwareVertex> strip = {
+            { -1.0f, -0.1f, 0.05f, 0xC0FFFFFFU, 0.0f, 0.0f }, { -1.0f, 0.1f, 0.05f, 0xC0FFFFFFU, 0.0f, 0.0f },
+            {  0.0f, -0.3f, 0.05f, 0xC0000000U, 0.0f, 0.0f }, {  0.0f, 0.3f, 0.05f, 0xC0000000U, 0.0f, 0.0f },
+            {  1.0f, -0.1f, 0.05f, 0xC0FFFFFFU, 0.0f, 0.0f }, {  1.0f, 0.1f, 0.05f, 0xC0FFFFFFU, 0.0f, 0.0f },
+        };
+        const BufferHandle stripBuffer = createVertexBuffer(device, strip);
+        device.SetVertexBuffer(stripBuffer);
+        device.SetPrimitiveTopology(PrimitiveTopology::TriangleStrip);
+        device.Draw(static_cast<uint32_t>(strip.size()), 0U);
+        device.SetPrimitiveTopology(PrimitiveTopology::TriangleList);
+
+        device.DestroyBuffer(stripBuffer);
+        device.DestroyBuffer(indexBuffer);
+        device.DestroyBuffer(vertexBuffer);
+    }
+
+    constexpr Scene SCENES[] = {
+        { "triangles", drawTriangles },
+        { "depth", drawDepth },
+        { "grid", drawGrid },
+    };
+
+    /// @brief 장면을 그려 색상 버퍼를 취득합니다.
+    /// @param scene 장면
+    /// @param threadCount 래스터화 스레드 수
+    /// @param pixels 결과 (R8G8B8A8)
+    /// @param savePath 결과를 BMP로 저장할 경로 (nullptr이면 저장하지 않음)
+    /// @return 성공(true), 실패(false)
+    bool render(const Scene& scene, uint32_t threadCount, std::vector<uint32_t>& pixels, const char* savePath = nullptr) noexcept {
+        SoftwareRenderDevice device(threadCount);
+        if (!device.Initialize(nullptr, GOLDEN_WIDTH, GOLDEN_HEIGHT, false, false)) {
+            return false;
+        }
+
+        float clearColor[4] = { 0.1f, 0.1f, 0.2f, 1.0f };
+        device.BeginFrame(clearColor);
+        scene.Draw(device);
+        device.EndFrame();
+
+        const uint32_t* colors = device.GetColorBuffer();
+        pixels.assign(colors, colors + static_cast<size_t>(GOLDEN_WIDTH) * GOLDEN_HEIGHT);
+        return !savePath || device.SaveBMP(savePath);
+    }
+
+    /// @brief SaveBMP로 저장한 32비트 BMP를 읽습니다.
+    /// @param path 경로
+    /// @param pixels 결과 (R8G8B8A8, 위에서 아래로)
+    /// @return 성공(true), 실패(false: 파일 없음 또는 크기 불일치)
+    bool loadBMP(const std::string& path, std::vector<uint32_t>& pixels) noexcept {
+        FILE* fp = std::fopen(path.c_str(), "rb");
+        if (!fp) {
+            return false;
+        }
+
+        byte_t header[54];
+        bool succeeded = (std::fread(header, 1, sizeof(header), fp) == sizeof(header));
+        auto read32 = [&](int32_t offset) {
+            return static_cast<uint32_t>(header[offset]) | (static_cast<uint32_t>(header[offset + 1]) << 8)
+                | (static_cast<uint32_t>(header[offset + 2]) << 16) | (static_cast<uint32_t>(header[offset + 3]) << 24);
+        };
+        succeeded = succeeded && header[0] == 'B' && header[1] == 'M'
+            && static_cast<int32_t>(read32(18)) == GOLDEN_WIDTH && static_cast<int32_t>(read32(22)) == -GOLDEN_HEIGHT
+            && header[28] == 32U && read32(10) == 54U;
+
+        if (succeeded) {
+            pixels.resize(static_cast<size_t>(GOLDEN_WIDTH) * GOLDEN_HEIGHT);
+            succeeded = (std::fread(pixels.data(), sizeof(uint32_t), pixels.size(), fp) == pixels.size());
+            // B8G8R8A8 → R8G8B8A8
+            for (uint32_t& pixel : pixels) {
+                pixel = (pixel & 0xFF00FF00U) | ((pixel >> 16) & 0xFFU) | ((pixel & 0xFFU) << 16);
+            }
+        }
+
+        std::fclose(fp);
+        return succeeded;
+    }
+
+    /// @brief 허용 범위를 넘는 픽셀 수를 셉니다.
+    size_t countMismatches(const std::vector<uint32_t>& lhs, const std::vector<uint32_t>& rhs, int32_t& maxDifference) noexcept {
+        size_t mismatches = 0U;
+        maxDifference = 0;
+        for (size_t i = 0U; i < lhs.size(); ++i) {
+            int32_t difference = 0;
+            for (int32_t shift = 0; shift < 32; shift += 8) {
+                const int32_t a = static_cast<int32_t>((lhs[i] >> shift) & 0xFFU);
+                const int32_t b = static_cast<int32_t>((rhs[i] >> shift) & 0xFFU);
+                difference = std::max(difference, std::abs(a - b));
+            }
+            maxDifference = std::max(maxDifference, difference);
+            mismatches += (difference > CHANNEL_TOLERANCE) ? 1U : 0U;
+        }
+        return mismatches;
+    }
+
+    /// @brief 프레임 중에는 스레드 수 변경을 거부하고, 프레임 사이에 바꾼 뒤에도 같은 결과를 내는지 확인합니다.
+    void checkThreadCountChange() noexcept {
+        SoftwareRenderDevice device(1U);
+        if (!Check(device.Initialize(nullptr, GOLDEN_WIDTH, GOLDEN_HEIGHT, false, false), "thread count device initializes")) {
+            return;
+        }
+
+        float clearColor[4] = { 0.1f, 0.1f, 0.2f, 1.0f };
+        device.BeginFrame(clearColor);
+        drawGrid(device);
+        Check(!device.SetThreadCount(4U) && device.GetThreadCount() == 1U, "SetThreadCount is refused between BeginFrame and EndFrame");
+        device.EndFrame();
+        const uint32_t* colors = device.GetColorBuffer();
+        const std::vector<uint32_t> before(colors, colors + static_cast<size_t>(GOLDEN_WIDTH) * GOLDEN_HEIGHT);
+
+        Check(device.SetThreadCount(4U) && device.GetThreadCount() == 4U, "SetThreadCount succeeds between frames");
+        device.BeginFrame(clearColor);
+        drawGrid(device);
+        device.EndFrame();
+        colors = device.GetColorBuffer();
+        Check(before == std::vector<uint32_t>(colors, colors + before.size()), "output is unchanged after SetThreadCount");
+    }
+
+    /// @brief 스레드 수에 따른 래스터화 시간을 잽니다.
+    void measureScaling() noexcept {
+        constexpr int32_t WIDTH = 1280;
+        constexpr int32_t HEIGHT = 720;
+        constexpr int32_t FRAMES = 8;
+        constexpr int32_t LAYERS = 40;
+
+        const uint32_t hardwareThreads = std::max(1U, std::thread::hardware_concurrency());
+        std::vector<uint32_t> threadCounts = { 1U };
+        for (uint32_t count = 2U; count < hardwareThreads; count *= 2U) {
+            threadCounts.push_back(count);
+        }
+        if (hardwareThreads > 1U) {
+            threadCounts.push_back(hardwareThreads);
+        }
+
+        std::printf("raster scaling (%dx%d, %d layers of the grid scene, %u hardware threads)\n", WIDTH, HEIGHT, LAYERS, hardwareThreads);
+        double baseline = 0.0;
+        for (uint32_t threadCount : threadCounts) {
+            SoftwareRenderDevice device(threadCount);
+            if (!device.Initialize(nullptr, WIDTH, HEIGHT, false, false)) {
+                Check(false, "scaling device initializes");
+                return;
+            }
+
+            float clearColor[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+            double best = 1e30;
+            for (int32_t frame = 0; frame < FRAMES; ++frame) {
+                device.BeginFrame(clearColor);
+                for (int32_t layer = 0; layer < LAYERS; ++layer) {
+                    drawGrid(device);
+                }
+                device.EndFrame();
+                best = std::min(best, device.GetRasterStats().RasterTime);
+            }
+
+            baseline = (threadCount == 1U) ? best : baseline;
+            std::printf("  %2u thread(s): raster %7.3f ms, speedup %.2fx\n", threadCount, best * 1000.0, baseline / best);
+        }
+    }
+}
+
+/// @brief 소프트웨어 렌더 디바이스 기준 이미지 테스트 진입점
+/// @note 사용법: SoftwareRenderTest [기준 이미지 디렉터리 (기본: res/Tests/Golden)] [--update] [--no-bench]
+///       고정 장면을 그려 기준 이미지와 비교하고, 스레드 수와 관계없이 결과가 같은지, 코어 수에 따라 얼마나 빨라지는지 확인합니다.
+///       --update는 현재 결과로 기준 이미지를 다시 만듭니다. (렌더러의 출력을 의도적으로 바꾼 경우에만 사용)
+int main(int argc, char* argv[]) {
+    std::string directory = "res/Tests/Golden";
+    bool update = false;
+    bool bench = true;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--update") == 0) {
+            update = true;
+        } else if (std::strcmp(argv[i], "--no-bench") == 0) {
+            bench = false;
+        } else {
+            directory = argv[i];
+        }
+    }
+
+    const uint32_t threadCount = std::max(4U, std::thread::hardware_concurrency());
+    for (const Scene& scene : SCENES) {
+        const std::string path = directory + "/" + scene.Name + ".bmp";
+
+        std::vector<uint32_t> single;
+        std::vector<uint32_t> multi;
+        if (!Check(render(scene, 1U, single, update ? path.c_str() : nullptr) && render(scene, threadCount, multi), (std::string(scene.Name) + ": renders").c_str())) {
+            continue;
+        }
+        Check(single == multi, (std::string(scene.Name) + ": output is identical for 1 and N threads").c_str());
+        if (update) {
+            std::printf("%-10s reference image written to %s\n", scene.Name, path.c_str());
+            continue;
+        }
+
+        std::vector<uint32_t> reference;
+        if (!Check(loadBMP(path, reference), (path + ": reference image loads").c_str())) {
+            continue;
+        }
+
+        int32_t maxDifference = 0;
+        const size_t mismatches = countMismatches(single, reference, maxDifference);
+        const double ratio = static_cast<double>(mismatches) / static_cast<double>(single.size());
+        std::printf("%-10s %zu pixel(s) over tolerance (%.3f%%), max channel difference %d\n", scene.Name, mismatches, ratio * 100.0, maxDifference);
+        Check(ratio <= PIXEL_TOLERANCE, (std::string(scene.Name) + ": matches reference image").c_str());
+    }
+
+    checkThreadCountChange();
+
+    if (bench) {
+        measureScaling();
+    }
+
+    return Finish("SoftwareRenderTest");
+}
\ No newline at end of file
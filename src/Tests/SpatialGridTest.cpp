@@ -0,0 +1,182 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "World/SpatialGrid.hpp"
+#include "TestCommon.hpp"
+
+using namespace tests;
+using namespace world;
+
+namespace {
+    constexpr float CELL_SIZE           = 16.0f;        ///< 칸 크기 (자주 쓰는 검색 반경의 약 2배)
+    constexpr float QUERY_RADIUS        = 8.0f;         ///< 검색 반경
+    constexpr uint32_t SAMPLE_QUERIES   = 500U;         ///< 전수 비교할 검색 수
+    constexpr uint32_t NAIVE_LIMIT      = 10000U;       ///< 전체 쌍 비교를 잴 최대 개체 수
+    constexpr uint32_t RESULT_CAPACITY  = 1U << 16U;    ///< 검색 결과 버퍼 크기
+
+    std::mt19937 g_Random(1U);
+
+    float random01() noexcept {
+        return std::uniform_real_distribution<float>(0.0f, 1.0f)(g_Random);
+    }
+
+    /// @brief 개체 집합과 격자
+    struct World final {
+        std::vector<Vector3F> Positions;        ///< 위치 (값 = 인덱스)
+        std::vector<uint32_t> Proxies;          ///< 개체 식별자 (제거되었으면 INVALID_PROXY)
+        SpatialGrid Grid;                       ///< 격자
+        float Side;                             ///< 분포 영역 한 변 길이
+
+        explicit World(uint32_t count) noexcept : Grid(CELL_SIZE, std::max(1024U, count)), Side(std::sqrt(static_cast<float>(count)) * 10.0f) {
+            // 밀도를 100 m^2당 하나로 유지하고, 원점을 가로질러 음수 칸도 사용
+            Positions.resize(count);
+            Proxies.resize(count);
+            for (uint32_t i = 0U; i < count; ++i) {
+                Positions[i] = { (random01() - 0.5f) * Side, random01() * 4.0f, (random01() - 0.5f) * Side };
+                Proxies[i] = Grid.Insert(Positions[i], i);
+            }
+        }
+
+        /// @brief 모든 개체를 무작위로 걷게 합니다.
+        void Walk() noexcept {
+            for (uint32_t i = 0U; i < Positions.size(); ++i) {
+                if (Proxies[i] != SpatialGrid::INVALID_PROXY) {
+                    Positions[i].X += random01() * 2.0f - 1.0f;
+                    Positions[i].Z += random01() * 2.0f - 1.0f;
+                    Grid.Move(Proxies[i], Positions[i]);
+                }
+            }
+        }
+    };
+
+    /// @brief 전수 검사 기준: 반경 안의 모든 개체
+    std::vector<uint32_t> referenceRadius(const World& world, const Vector3F& center, float radius) {
+        std::vector<uint32_t> result;
+        for (uint32_t i = 0U; i < world.Positions.size(); ++i) {
+            if (world.Proxies[i] != SpatialGrid::INVALID_PROXY && Vector3F::DistanceSquared(center, world.Positions[i]) <= radius * radius) {
+                result.push_back(i);
+            }
+        }
+        return result;
+    }
+
+    /// @brief 전수 검사 기준: 경계 상자 안의 모든 개체
+    std::vector<uint32_t> referenceAABB(const World& world, const Vector3F& min, const Vector3F& max) {
+        std::vector<uint32_t> result;
+        for (uint32_t i = 0U; i < world.Positions.size(); ++i) {
+            const Vector3F& p = world.Positions[i];
+            if (world.Proxies[i] != SpatialGrid::INVALID_PROXY && p.X >= min.X && p.Y >= min.Y && p.Z >= min.Z && p.X <= max.X && p.Y <= max.Y && p.Z <= max.Z) {
+                result.push_back(i);
+            }
+        }
+        return result;
+    }
+
+    std::vector<uint32_t> sorted(const std::vector<uint32_t>& buffer, uint32_t count) {
+        std::vector<uint32_t> result(buffer.begin(), buffer.begin() + count);
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    /// @brief 표본 검색 결과를 전수 검사와 비교합니다.
+    /// @return 결과가 다른 검색 수
+    uint32_t compareQueries(const World& world, std::vector<uint32_t>& buffer) {
+        uint32_t mismatches = 0U;
+        for (uint32_t n = 0U; n < SAMPLE_QUERIES; ++n) {
+            const Vector3F center = { (random01() - 0.5f) * world.Side, random01() * 4.0f, (random01() - 0.5f) * world.Side };
+            const float radius = (n % 10U == 0U) ? QUERY_RADIUS * 8.0f : QUERY_RADIUS * random01();
+            uint32_t count = world.Grid.QueryRadius(center, radius, buffer.data(), RESULT_CAPACITY);
+            mismatches += (sorted(buffer, count) != referenceRadius(world, center, radius)) ? 1U : 0U;
+
+            const Vector3F extent = { random01() * 20.0f, 2.0f, random01() * 20.0f };
+            count = world.Grid.QueryAABB(center - extent, center + extent, buffer.data(), RESULT_CAPACITY);
+            mismatches += (sorted(buffer, count) != referenceAABB(world, center - extent, center + extent)) ? 1U : 0U;
+        }
+
+        // MAX_QUERY_CELLS를 넘는 검색 (모든 버킷을 검사하는 경로)
+        const Vector3F half = { world.Side * 0.3f, 4.0f, world.Side * 0.3f };
+        const uint32_t count = world.Grid.QueryAABB(-half, half, buffer.data(), RESULT_CAPACITY);
+        const std::vector<uint32_t> expected = referenceAABB(world, -half, half);
+        mismatches += (expected.size() <= RESULT_CAPACITY && sorted(buffer, count) != expected) ? 1U : 0U;
+        return mismatches;
+    }
+
+    /// @brief 개체 수별로 검색 결과를 확인하고, 한 프레임(모두 이동 후 모두 검색) 시간을 전체 쌍 비교와 비교합니다.
+    void run(uint32_t count, bool bench) {
+        World world(count);
+        std::vector<uint32_t> buffer(RESULT_CAPACITY);
+        const std::string name = "n=" + std::to_string(count) + ": ";
+
+        Check(world.Grid.GetCount() == count, (name + "every entity is inserted").c_str());
+        Check(compareQueries(world, buffer) == 0U, (name + "queries match brute force").c_str());
+
+        const int32_t frames = (count >= 100000U) ? 3 : ((count >= 10000U) ? 10 : 100);
+        double moveTime = 0.0;
+        double queryTime = 0.0;
+        uint64_t found = 0U;
+        for (int32_t frame = 0; frame < frames; ++frame) {
+            const double start = Now();
+            world.Walk();
+            const double moved = Now();
+            for (uint32_t i = 0U; i < count; ++i) {
+                found += world.Grid.QueryRadius(world.Positions[i], QUERY_RADIUS, buffer.data(), RESULT_CAPACITY);
+            }
+            moveTime += moved - start;
+            queryTime += Now() - moved;
+        }
+        Check(compareQueries(world, buffer) == 0U, (name + "queries match brute force after moves").c_str());
+
+        // 절반 제거 후 식별자 재사용
+        for (uint32_t i = 0U; i < count; i += 2U) {
+            world.Grid.Remove(world.Proxies[i]);
+            world.Proxies[i] = SpatialGrid::INVALID_PROXY;
+        }
+        Check(world.Grid.GetCount() == count - (count + 1U) / 2U, (name + "Remove updates the count").c_str());
+        Check(compareQueries(world, buffer) == 0U, (name + "removed entities are not found").c_str());
+
+        world.Proxies[0] = world.Grid.Insert(world.Positions[0], 0U);
+        Check(world.Grid.GetUserData(world.Proxies[0]) == 0U && world.Grid.GetPosition(world.Proxies[0]) == world.Positions[0], (name + "reinserted entity keeps its value").c_str());
+        Check(compareQueries(world, buffer) == 0U, (name + "queries match after reinsertion").c_str());
+
+        if (!bench) {
+            return;
+        }
+
+        std::string naive = "-";
+        if (count <= NAIVE_LIMIT) {
+            const double start = Now();
+            uint64_t pairs = 0U;
+            for (uint32_t i = 0U; i < count; ++i) {
+                for (uint32_t j = 0U; j < count; ++j) {
+                    pairs += (Vector3F::DistanceSquared(world.Positions[i], world.Positions[j]) <= QUERY_RADIUS * QUERY_RADIUS) ? 1U : 0U;
+                }
+            }
+            Consume(pairs);
+            char text[32];
+            std::snprintf(text, sizeof(text), "%.3f", (Now() - start) * 1e3);
+            naive = text;
+        }
+
+        std::printf("  %7u %10.3f %13.3f %10.1f %16s\n", count, moveTime / frames * 1e3, queryTime / frames * 1e3, static_cast<double>(found) / frames / count, naive.c_str());
+    }
+}
+
+/// @brief SpatialGrid 테스트 진입점
+/// @note 사용법: SpatialGridTest [--no-bench]
+///       100 ~ 100k 개체에서 검색 결과를 전수 검사와 비교하고, 모든 개체가 이동한 뒤 각자 반경 검색하는 프레임 시간을 잽니다.
+int main(int argc, char* argv[]) {
+    const bool bench = argc < 2 || std::string(argv[1]) != "--no-bench";
+    if (bench) {
+        std::printf("benchmark (cell %.0f, radius %.0f, ~1 entity per 100 m^2, ms per frame)\n", CELL_SIZE, QUERY_RADIUS);
+        std::printf("  %7s %10s %13s %10s %16s\n", "count", "move", "all queries", "found", "naive all-pairs");
+    }
+
+    for (const uint32_t count : { 100U, 1000U, 10000U, 100000U }) {
+        run(count, bench);
+    }
+
+    return Finish("SpatialGridTest");
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include "Type/Types.hpp"
+
+inline namespace neoxops {
+    namespace tests {
+        /// @brief 실패한 검사 수를 취득합니다.
+        /// @return 실패한 검사 수
+        inline uint32_t& GetFailureCount() noexcept {
+            static uint32_t failures = 0U;
+            return failures;
+        }
+
+        /// @brief 조건을 검사하고 실패하면 기록합니다.
+        /// @param condition 조건
+        /// @param what 검사 내용
+        /// @return 조건
+        inline bool Check(bool condition, const char* what) noexcept {
+            if (!condition) {
+                std::fprintf(stderr, "FAILED: %s\n", what);
+                ++GetFailureCount();
+            }
+            return condition;
+        }
+
+        /// @brief 검사 결과를 출력합니다.
+        /// @param name 테스트 이름
+        /// @return 종료 코드 (모두 통과하면 0)
+        inline int Finish(const char* name) noexcept {
+            const uint32_t failures = GetFailureCount();
+            if (failures == 0U) {
+                std::printf("%s: all checks passed\n", name);
+                return 0;
+            }
+            std::fprintf(stderr, "%s: %u check(s) failed\n", name, failures);
+            return 1;
+        }
+
+        /// @brief 현재 시각을 취득합니다.
+        /// @return 시각 (초 단위)
+        inline double Now() noexcept {
+            return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        /// @brief 함수를 여러 번 실행해 가장 짧은 실행 시간을 잽니다.
+        /// @param repeats 반복 횟수
+        /// @param function 잴 함수
+        /// @return 가장 짧은 실행 시간 (초 단위)
+        /// @note 최솟값은 스케줄링과 캐시 예열의 영향을 가장 적게 받습니다.
+        template <typename Function>
+        double MeasureBest(int32_t repeats, Function&& function) noexcept {
+            double best = 1e30;
+            for (int32_t i = 0; i < repeats; ++i) {
+                const double start = Now();
+                function();
+                const double elapsed = Now() - start;
+                best = (elapsed < best) ? elapsed : best;
+            }
+            return best;
+        }
+
+        /// @brief 최적화로 계산이 사라지지 않도록 값을 소비합니다.
+        /// @param value 값
+        template <typename T>
+        void Consume(const T& value) noexcept {
+            static volatile byte_t sink;
+            sink = sink ^ *reinterpret_cast<const volatile byte_t*>(&value);
+        }
+    }
+}
\ No newline at end of file
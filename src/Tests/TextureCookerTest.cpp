@@ -0,0 +1,566 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include "Graphics/NullRenderDevice.hpp"
+#include "Graphics/TextureCache.hpp"
+#include "Graphics/TextureCooker.hpp"
+#include "TestCommon.hpp"
+
+using namespace tests;
+using namespace graphics;
+
+namespace {
+    constexpr int32_t IMAGE_SIZE    = 64;       ///< 검사 이미지 한 변 길이
+    constexpr int32_t BENCH_SIZE    = 512;      ///< 벤치마크 이미지 한 변 길이
+
+    /// @brief 형식별 0단계 PSNR 하한 (dB, 검사 이미지 기준)
+    struct QualityFloor final {
+        TextureCompression Compression;         ///< 압축 방식
+        TextureFormat Format;                   ///< 기대하는 텍스처 형식
+        double MinPSNR;                         ///< PSNR 하한
+        const char* Name;                       ///< 이름
+    };
+
+    constexpr QualityFloor QUALITY_FLOORS[] = {
+        { TextureCompression::None, TextureFormat::RGBA8, 1000.0, "RGBA8" },
+        { TextureCompression::BC1, TextureFormat::BC1, 36.0, "BC1" },
+        { TextureCompression::BC3, TextureFormat::BC3, 34.0, "BC3" },
+        { TextureCompression::BC7, TextureFormat::BC7, 34.0, "BC7" },
+    };
+
+    std::mt19937 g_Random(11U);
+
+    template <typename T>
+    void write(std::vector<byte_t>& data, size_t offset, T value) noexcept {
+        std::memcpy(data.data() + offset, &value, sizeof(T));
+    }
+
+    template <typename T>
+    T read(const byte_t* data) noexcept {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        return value;
+    }
+
+    /// @brief 부드러운 그레이디언트에 잡음을 더한 검사 이미지를 만듭니다. (알파는 가운데가 불투명한 원형 그레이디언트)
+    Image makeImage(int32_t size) {
+        Image image;
+        image.Width = size;
+        image.Height = size;
+        image.Pixels.resize(static_cast<size_t>(size) * size * 4U);
+        std::uniform_int_distribution<int32_t> noise(-6, 6);
+        for (int32_t y = 0; y < size; ++y) {
+            for (int32_t x = 0; x < size; ++x) {
+                byte_t* pixel = image.Pixels.data() + (static_cast<size_t>(y) * size + x) * 4U;
+                const float u = static_cast<float>(x) / static_cast<float>(size - 1);
+                const float v = static_cast<float>(y) / static_cast<float>(size - 1);
+                const float radius = std::sqrt((u - 0.5f) * (u - 0.5f) + (v - 0.5f) * (v - 0.5f));
+                pixel[0] = static_cast<byte_t>(std::clamp(static_cast<int32_t>(u * 220.0f) + 20 + noise(g_Random), 0, 255));
+                pixel[1] = static_cast<byte_t>(std::clamp(static_cast<int32_t>(v * 200.0f) + 30 + noise(g_Random), 0, 255));
+                pixel[2] = static_cast<byte_t>(std::clamp(static_cast<int32_t>((1.0f - u * v) * 180.0f) + noise(g_Random), 0, 255));
+                pixel[3] = static_cast<byte_t>(std::clamp(static_cast<int32_t>(255.0f - radius * 300.0f), 0, 255));
+            }
+        }
+        return image;
+    }
+
+    /// @brief BITMAPFILEHEADER와 BITMAPINFOHEADER를 기록합니다.
+    void writeBMPHeader(std::vector<byte_t>& data, int32_t width, int32_t height, uint16_t bitCount, uint32_t pixelOffset, uint32_t paletteCount) noexcept {
+        data[0] = 'B';
+        data[1] = 'M';
+        write<uint32_t>(data, 2, static_cast<uint32_t>(data.size()));
+        write<uint32_t>(data, 10, pixelOffset);
+        write<uint32_t>(data, 14, 40U);
+        write<int32_t>(data, 18, width);
+        write<int32_t>(data, 22, height);
+        write<uint16_t>(data, 26, 1U);
+        write<uint16_t>(data, 28, bitCount);
+        write<uint32_t>(data, 46, paletteCount);
+    }
+
+    /// @brief 24비트 또는 32비트 무압축 BMP를 만듭니다.
+    std::vector<byte_t> makeBMP(const Image& image, uint16_t bitCount, bool topDown) {
+        const size_t bytesPerPixel = bitCount / 8U;
+        const size_t stride = ((static_cast<size_t>(image.Width) * bitCount + 31U) / 32U) * 4U;
+        std::vector<byte_t> data(54U + stride * image.Height, 0U);
+        writeBMPHeader(data, image.Width, topDown ? -image.Height : image.Height, bitCount, 54U, 0U);
+
+        for (int32_t y = 0; y < image.Height; ++y) {
+            byte_t* row = data.data() + 54U + stride * (topDown ? y : (image.Height - 1 - y));
+            for (int32_t x = 0; x < image.Width; ++x) {
+                const byte_t* pixel = image.Pixels.data() + (static_cast<size_t>(y) * image.Width + x) * 4U;
+                byte_t* dst = row + x * bytesPerPixel;
+                dst[0] = pixel[2];
+                dst[1] = pixel[1];
+                dst[2] = pixel[0];
+                if (bitCount == 32U) {
+                    dst[3] = pixel[3];
+                }
+            }
+        }
+        return data;
+    }
+
+    /// @brief 8비트 팔레트 BMP와 디코딩 결과로 기대하는 이미지를 만듭니다.
+    std::vector<byte_t> makePaletteBMP(int32_t width, int32_t height, Image& expected) {
+        const size_t stride = ((static_cast<size_t>(width) * 8U + 31U) / 32U) * 4U;
+        const uint32_t pixelOffset = 54U + 256U * 4U;
+        std::vector<byte_t> data(pixelOffset + stride * height, 0U);
+        writeBMPHeader(data, width, height, 8U, pixelOffset, 0U);
+        for (uint32_t i = 0U; i < 256U; ++i) {
+            data[54U + i * 4U + 0U] = static_cast<byte_t>(255U - i);
+            data[54U + i * 4U + 1U] = static_cast<byte_t>(i * 7U);
+            data[54U + i * 4U + 2U] = static_cast<byte_t>(i);
+        }
+
+        expected.Width = width;
+        expected.Height = height;
+        expected.Pixels.resize(static_cast<size_t>(width) * height * 4U);
+        for (int32_t y = 0; y < height; ++y) {
+            for (int32_t x = 0; x < width; ++x) {
+                const uint32_t index = static_cast<uint32_t>(x * 3 + y * 5) & 0xFFU;
+                data[pixelOffset + stride * (height - 1 - y) + x] = static_cast<byte_t>(index);
+                byte_t* pixel = expected.Pixels.data() + (static_cast<size_t>(y) * width + x) * 4U;
+                pixel[0] = static_cast<byte_t>(index);
+                pixel[1] = static_cast<byte_t>(index * 7U);
+                pixel[2] = static_cast<byte_t>(255U - index);
+                pixel[3] = 255U;
+            }
+        }
+        return data;
+    }
+
+    /// @brief DDS 헤더를 만듭니다.
+    /// @param fourCC FourCC (nullptr이면 32비트 RGB)
+    /// @param redMask 빨강 마스크 (32비트 RGB 전용)
+    std::vector<byte_t> makeDDSHeader(int32_t width, int32_t height, uint32_t mipCount, const char* fourCC, uint32_t redMask) {
+        std::vector<byte_t> data(128U, 0U);
+        std::memcpy(data.data(), "DDS ", 4U);
+        write<uint32_t>(data, 4, 124U);
+        write<uint32_t>(data, 8, 0x1007U | (mipCount > 1U ? 0x20000U : 0U));
+        write<int32_t>(data, 12, height);
+        write<int32_t>(data, 16, width);
+        write<uint32_t>(data, 28, mipCount);
+        write<uint32_t>(data, 76, 32U);
+        if (fourCC) {
+            write<uint32_t>(data, 80, 0x4U);
+            std::memcpy(data.data() + 84, fourCC, 4U);
+        } else {
+            write<uint32_t>(data, 80, 0x41U);
+            write<uint32_t>(data, 88, 32U);
+            write<uint32_t>(data, 92, redMask);
+            write<uint32_t>(data, 96, 0x0000FF00U);
+            write<uint32_t>(data, 100, redMask ^ 0x00FF00FFU);
+            write<uint32_t>(data, 104, 0xFF000000U);
+        }
+        return data;
+    }
+
+    /// @brief 두 RGBA 이미지의 PSNR을 구합니다.
+    /// @return PSNR (dB, 같으면 무한대)
+    double computePSNR(const byte_t* lhs, const byte_t* rhs, size_t pixels) noexcept {
+        double error = 0.0;
+        for (size_t i = 0U; i < pixels * 4U; ++i) {
+            const double d = static_cast<double>(lhs[i]) - static_cast<double>(rhs[i]);
+            error += d * d;
+        }
+        if (error == 0.0) {
+            return INFINITY;
+        }
+        const double mse = error / static_cast<double>(pixels * 4U);
+        return 10.0 * std::log10(255.0 * 255.0 / mse);
+    }
+
+    /// @brief R5G6B5를 RGB로 복원합니다.
+    void expand565(uint16_t value, int32_t (&color)[4]) noexcept {
+        const int32_t r = (value >> 11) & 31;
+        const int32_t g = (value >> 5) & 63;
+        const int32_t b = value & 31;
+        color[0] = (r << 3) | (r >> 2);
+        color[1] = (g << 2) | (g >> 4);
+        color[2] = (b << 3) | (b >> 2);
+        color[3] = 255;
+    }
+
+    /// @brief BC1 색상 블록을 복원합니다.
+    /// @param alwaysFourColor BC3의 색상 블록처럼 항상 4색 모드로 해석할지 여부
+    void decodeColorBlock(const byte_t* src, bool alwaysFourColor, byte_t (&block)[64]) noexcept {
+        const uint16_t c0 = read<uint16_t>(src);
+        const uint16_t c1 = read<uint16_t>(src + 2);
+        const uint32_t indices = read<uint32_t>(src + 4);
+
+        int32_t palette[4][4];
+        expand565(c0, palette[0]);
+        expand565(c1, palette[1]);
+        for (int32_t c = 0; c < 4; ++c) {
+            if (alwaysFourColor || c0 > c1) {
+                palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+                palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+            } else {
+                palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+                palette[3][c] = 0;
+            }
+        }
+
+        for (uint32_t i = 0U; i < 16U; ++i) {
+            const int32_t* color = palette[(indices >> (i * 2U)) & 3U];
+            for (uint32_t c = 0U; c < 4U; ++c) {
+                block[i * 4U + c] = static_cast<byte_t>(color[c]);
+            }
+        }
+    }
+
+    /// @brief BC3 알파 블록을 복원합니다.
+    void decodeAlphaBlock(const byte_t* src, byte_t (&block)[64]) noexcept {
+        int32_t palette[8];
+        palette[0] = src[0];
+        palette[1] = src[1];
+        if (palette[0] > palette[1]) {
+            for (int32_t p = 1; p < 7; ++p) {
+                palette[p + 1] = ((7 - p) * palette[0] + p * palette[1]) / 7;
+            }
+        } else {
+            for (int32_t p = 1; p < 5; ++p) {
+                palette[p + 1] = ((5 - p) * palette[0] + p * palette[1]) / 5;
+            }
+            palette[6] = 0;
+            palette[7] = 255;
+        }
+
+        uint64_t indices = 0ULL;
+        for (uint32_t i = 0U; i < 6U; ++i) {
+            indices |= static_cast<uint64_t>(src[2U + i]) << (i * 8U);
+        }
+        for (uint32_t i = 0U; i < 16U; ++i) {
+            block[i * 4U + 3U] = static_cast<byte_t>(palette[(indices >> (i * 3U)) & 7U]);
+        }
+    }
+
+    /// @brief BC7 모드 6 블록을 복원합니다.
+    /// @return 모드 6 블록(true), 다른 모드(false)
+    bool decodeBC7Block(const byte_t* src, byte_t (&block)[64]) noexcept {
+        static constexpr int32_t WEIGHTS[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+        uint32_t position = 0U;
+        auto bits = [&](uint32_t count) noexcept {
+            uint32_t value = 0U;
+            for (uint32_t i = 0U; i < count; ++i, ++position) {
+                value |= ((src[position >> 3] >> (position & 7U)) & 1U) << i;
+            }
+            return value;
+        };
+
+        if (bits(7U) != (1U << 6)) {
+            return false;
+        }
+
+        uint32_t quantized[2][4];
+        for (uint32_t c = 0U; c < 4U; ++c) {
+            quantized[0][c] = bits(7U);
+            quantized[1][c] = bits(7U);
+        }
+        const uint32_t pbit[2] = { bits(1U), bits(1U) };
+
+        for (uint32_t i = 0U; i < 16U; ++i) {
+            const uint32_t index = bits(i == 0U ? 3U : 4U);
+            for (uint32_t c = 0U; c < 4U; ++c) {
+                const int32_t e0 = static_cast<int32_t>((quantized[0][c] << 1) | pbit[0]);
+                const int32_t e1 = static_cast<int32_t>((quantized[1][c] << 1) | pbit[1]);
+                block[i * 4U + c] = static_cast<byte_t>(((64 - WEIGHTS[index]) * e0 + WEIGHTS[index] * e1 + 32) >> 6);
+            }
+        }
+        return true;
+    }
+
+    /// @brief 0단계 데이터를 R8G8B8A8로 복원합니다.
+    /// @return 성공(true), 복원할 수 없는 블록이 있음(false)
+    bool decodeLevel(const byte_t* data, int32_t width, int32_t height, TextureFormat format, std::vector<byte_t>& pixels) {
+        pixels.assign(static_cast<size_t>(width) * height * 4U, 0U);
+        if (format == TextureFormat::RGBA8) {
+            std::memcpy(pixels.data(), data, pixels.size());
+            return true;
+        }
+
+        const uint32_t blockSize = (format == TextureFormat::BC1) ? 8U : 16U;
+        bool succeeded = true;
+        for (int32_t by = 0; by < height / 4; ++by) {
+            for (int32_t bx = 0; bx < width / 4; ++bx, data += blockSize) {
+                byte_t block[64];
+                if (format == TextureFormat::BC1) {
+                    decodeColorBlock(data, false, block);
+                } else if (format == TextureFormat::BC3) {
+                    decodeColorBlock(data + 8, true, block);
+                    decodeAlphaBlock(data, block);
+                } else {
+                    succeeded = decodeBC7Block(data, block) && succeeded;
+                }
+
+                for (int32_t i = 0; i < 16; ++i) {
+                    std::memcpy(pixels.data() + ((static_cast<size_t>(by) * 4 + i / 4) * width + bx * 4 + i % 4) * 4U, block + i * 4, 4U);
+                }
+            }
+        }
+        return succeeded;
+    }
+
+    /// @brief 복사한 버퍼로 디코딩합니다. (주소 검사기가 범위 밖 읽기를 잡을 수 있도록 정확한 크기로 할당)
+    bool decodeExact(const std::vector<byte_t>& data, size_t size) {
+        std::vector<byte_t> copy(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(size));
+        Image image;
+        return TextureCooker::Decode(copy.data(), copy.size(), image);
+    }
+
+    /// @brief BMP, DDS 디코딩 결과가 원본과 같은지 확인합니다.
+    void checkDecode(const Image& source) {
+        Image decoded;
+        const std::vector<byte_t> bmp24 = makeBMP(source, 24U, false);
+        Check(TextureCooker::Decode(bmp24.data(), bmp24.size(), decoded) && decoded.Width == source.Width && decoded.Height == source.Height, "24-bit BMP decodes");
+        bool same = true;
+        for (size_t i = 0U; i < decoded.Pixels.size(); ++i) {
+            same = same && decoded.Pixels[i] == ((i % 4U == 3U) ? 255U : source.Pixels[i]);
+        }
+        Check(same, "24-bit bottom-up BMP matches the source with opaque alpha");
+
+        const std::vector<byte_t> bmp32 = makeBMP(source, 32U, true);
+        Check(TextureCooker::Decode(bmp32.data(), bmp32.size(), decoded) && decoded.Pixels == source.Pixels, "32-bit top-down BMP matches the source");
+
+        Image expected;
+        const std::vector<byte_t> bmp8 = makePaletteBMP(37, 19, expected);
+        Check(TextureCooker::Decode(bmp8.data(), bmp8.size(), decoded) && decoded.Width == 37 && decoded.Pixels == expected.Pixels, "8-bit palette BMP with row padding decodes");
+
+        for (const uint32_t redMask : { 0x000000FFU, 0x00FF0000U }) {
+            std::vector<byte_t> dds = makeDDSHeader(source.Width, source.Height, 1U, nullptr, redMask);
+            for (size_t i = 0U; i < source.Pixels.size(); i += 4U) {
+                const byte_t* pixel = source.Pixels.data() + i;
+                const bool bgra = (redMask == 0x00FF0000U);
+                dds.insert(dds.end(), { bgra ? pixel[2] : pixel[0], pixel[1], bgra ? pixel[0] : pixel[2], pixel[3] });
+            }
+            Check(TextureCooker::Decode(dds.data(), dds.size(), decoded) && decoded.Pixels == source.Pixels,
+                redMask == 0x000000FFU ? "R8G8B8A8 DDS decodes" : "B8G8R8A8 DDS decodes");
+        }
+    }
+
+    /// @brief 형식별로 쿠킹한 뒤 헤더를 다시 읽고 0단계의 화질이 하한 이상인지 확인합니다.
+    void checkCook(const Image& source) {
+        const std::vector<byte_t> bmp = makeBMP(source, 32U, false);
+        for (const QualityFloor& floor : QUALITY_FLOORS) {
+            const std::string name = floor.Name;
+            TextureCookOptions options;
+            options.Compression = floor.Compression;
+
+            std::vector<byte_t> cooked;
+            CookedTextureHeader header;
+            if (!Check(TextureCooker::Cook(bmp.data(), bmp.size(), options, cooked) && TextureCooker::ReadHeader(cooked.data(), cooked.size(), header), (name + ": cooks and reads back").c_str())) {
+                continue;
+            }
+
+            TextureDesc desc;
+            desc.Width = header.Width;
+            desc.Height = header.Height;
+            desc.MipLevels = header.MipLevels;
+            desc.Format = static_cast<TextureFormat>(header.Format);
+            Check(desc.Width == source.Width && desc.Height == source.Height && desc.Format == floor.Format
+                && desc.MipLevels == GetFullMipLevels(source.Width, source.Height), (name + ": header describes the full mip chain").c_str());
+            Check(header.Key == TextureCooker::GetCacheKey(bmp.data(), bmp.size(), options) && header.DataOffset % TextureCooker::DATA_ALIGNMENT == 0U
+                && header.DataOffset + header.DataSize == cooked.size() && header.DataSize == GetTextureDataSize(desc), (name + ": header key, offset and size").c_str());
+
+            // BC1은 1비트 알파이므로 알파가 128 미만인 픽셀은 투명한 검정이 기대값
+            std::vector<byte_t> reference = source.Pixels;
+            if (desc.Format == TextureFormat::BC1) {
+                for (size_t i = 0U; i < reference.size(); i += 4U) {
+                    if (reference[i + 3U] < 128U) {
+                        std::fill_n(reference.begin() + static_cast<std::ptrdiff_t>(i), 4, 0U);
+                    } else {
+                        reference[i + 3U] = 255U;
+                    }
+                }
+            }
+
+            std::vector<byte_t> pixels;
+            const bool decoded = decodeLevel(cooked.data() + header.DataOffset, desc.Width, desc.Height, desc.Format, pixels);
+            const double psnr = computePSNR(pixels.data(), reference.data(), static_cast<size_t>(desc.Width) * desc.Height);
+            std::printf("%-6s level 0 PSNR %6.2f dB (floor %.0f dB)\n", floor.Name, std::isinf(psnr) ? 999.0 : psnr, std::min(floor.MinPSNR, 999.0));
+            Check(decoded && psnr >= floor.MinPSNR, (name + ": level 0 PSNR is above the floor").c_str());
+        }
+
+        // 이미 압축된 DDS는 다시 압축하지 않고 그대로 사용
+        std::vector<byte_t> cooked;
+        CookedTextureHeader header;
+        TextureCookOptions options;
+        options.Compression = TextureCompression::BC1;
+        options.GenerateMips = false;
+        if (TextureCooker::Cook(bmp.data(), bmp.size(), options, cooked) && TextureCooker::ReadHeader(cooked.data(), cooked.size(), header)) {
+            std::vector<byte_t> dds = makeDDSHeader(source.Width, source.Height, 1U, "DXT1", 0U);
+            dds.insert(dds.end(), cooked.begin() + static_cast<std::ptrdiff_t>(header.DataOffset), cooked.end());
+
+            std::vector<byte_t> passthrough;
+            CookedTextureHeader passthroughHeader;
+            options.Compression = TextureCompression::BC7;
+            Check(TextureCooker::Cook(dds.data(), dds.size(), options, passthrough) && TextureCooker::ReadHeader(passthrough.data(), passthrough.size(), passthroughHeader)
+                && passthroughHeader.Format == static_cast<uint32_t>(TextureFormat::BC1)
+                && std::equal(cooked.begin() + static_cast<std::ptrdiff_t>(header.DataOffset), cooked.end(), passthrough.begin() + static_cast<std::ptrdiff_t>(passthroughHeader.DataOffset)),
+                "BC1 DDS is passed through unchanged");
+        }
+    }
+
+    /// @brief 잘리거나 잘못된 헤더를 거부하는지 확인합니다.
+    /// @note 주소 검사기(-fsanitize=address)로 실행하면 범위 밖 읽기도 함께 검사됩니다.
+    void checkMalformed(const Image& source) {
+        Image expected;
+        const std::vector<byte_t> bmp8 = makePaletteBMP(16, 16, expected);
+        bool rejected = true;
+        for (size_t size = 0U; size < bmp8.size(); size += 7U) {
+            rejected = rejected && !decodeExact(bmp8, size);
+        }
+        Check(rejected, "truncated BMP is rejected");
+
+        // 헤더 크기가 크면 32비트 합(14 + 헤더 + 팔레트)이 넘쳐 작은 값이 됨
+        std::vector<byte_t> bad = bmp8;
+        write<uint32_t>(bad, 14, 0xFFFFFC00U);
+        Check(!decodeExact(bad, bad.size()), "BMP header size that wraps the palette offset is rejected");
+        write<uint32_t>(bad, 14, 12U);
+        Check(!decodeExact(bad, bad.size()), "BMP header size below BITMAPINFOHEADER is rejected");
+
+        bad = bmp8;
+        write<uint32_t>(bad, 10, static_cast<uint32_t>(bad.size()) + 1U);
+        Check(!decodeExact(bad, bad.size()), "BMP pixel offset past the end is rejected");
+
+        bad = makeBMP(source, 32U, false);
+        write<int32_t>(bad, 18, INT32_MAX);
+        write<int32_t>(bad, 22, INT32_MAX);
+        Check(!decodeExact(bad, bad.size()), "BMP size whose stride * height overflows is rejected");
+        write<int32_t>(bad, 22, INT32_MIN);
+        Check(!decodeExact(bad, bad.size()), "BMP height INT32_MIN is rejected");
+
+        std::vector<byte_t> dds = makeDDSHeader(16, 16, 1U, nullptr, 0x000000FFU);
+        dds.resize(dds.size() + 16U * 16U * 4U, 0x80U);
+        rejected = true;
+        for (size_t size = 0U; size < dds.size(); size += 5U) {
+            rejected = rejected && !decodeExact(dds, size);
+        }
+        Check(rejected, "truncated DDS is rejected");
+
+        // 행 바이트 수가 32비트를 넘는 크기는 데이터 크기 계산이 넘치므로 거부
+        bad = makeDDSHeader(1 << 30, 4, 1U, nullptr, 0x000000FFU);
+        bad.resize(bad.size() + 64U, 0U);
+        Check(!decodeExact(bad, bad.size()), "DDS wider than MAX_TEXTURE_SIZE is rejected");
+        bad = makeDDSHeader(16, 16, 40U, nullptr, 0x000000FFU);
+        bad.resize(bad.size() + 16U * 16U * 8U, 0U);
+        Check(!decodeExact(bad, bad.size()), "DDS with more mip levels than the chain is rejected");
+
+        std::vector<byte_t> cooked;
+        const std::vector<byte_t> bmp = makeBMP(source, 24U, false);
+        if (!TextureCooker::Cook(bmp.data(), bmp.size(), {}, cooked)) {
+            Check(false, "cook for header checks");
+            return;
+        }
+
+        CookedTextureHeader header;
+        rejected = true;
+        for (size_t size = 0U; size < cooked.size(); size += 97U) {
+            std::vector<byte_t> truncated(cooked.begin(), cooked.begin() + static_cast<std::ptrdiff_t>(size));
+            rejected = rejected && !TextureCooker::ReadHeader(truncated.data(), truncated.size(), header);
+        }
+        Check(rejected, "truncated cooked texture is rejected");
+
+        const auto corrupt = [&](size_t offset, auto value) {
+            std::vector<byte_t> copy = cooked;
+            write(copy, offset, value);
+            return !TextureCooker::ReadHeader(copy.data(), copy.size(), header);
+        };
+        Check(corrupt(offsetof(CookedTextureHeader, Magic), 0U) && corrupt(offsetof(CookedTextureHeader, Version), TextureCooker::VERSION + 1U), "wrong magic or version is rejected");
+        Check(corrupt(offsetof(CookedTextureHeader, Format), 99U) && corrupt(offsetof(CookedTextureHeader, MipLevels), 0U) && corrupt(offsetof(CookedTextureHeader, Width), 1 << 30),
+            "invalid format, mip count or size is rejected");
+        Check(corrupt(offsetof(CookedTextureHeader, DataOffset), uint64_t{ 1U }) && corrupt(offsetof(CookedTextureHeader, DataOffset), UINT64_MAX - 63U)
+            && corrupt(offsetof(CookedTextureHeader, DataSize), uint64_t{ 4U }), "misaligned or out-of-range data is rejected");
+    }
+
+    /// @brief 캐시 파일의 생성, 적중, 손상 복구를 확인합니다.
+    void checkCache(const Image& source) {
+        const std::filesystem::path root = std::filesystem::temp_directory_path() / "NeoXOPS_TextureCookerTest";
+        std::error_code error;
+        std::filesystem::remove_all(root, error);
+        std::filesystem::create_directories(root, error);
+
+        const std::string imagePath = (root / "image.bmp").string();
+        const std::vector<byte_t> bmp = makeBMP(source, 32U, false);
+        std::ofstream(imagePath, std::ios::binary).write(reinterpret_cast<const char*>(bmp.data()), static_cast<std::streamsize>(bmp.size()));
+
+        TextureCache cache((root / "cache").string());
+        TextureCookOptions options;
+        options.Compression = TextureCompression::BC7;
+
+        CookedTexture first;
+        CookedTexture second;
+        Check(cache.Prepare(imagePath, options, first) && cache.GetStats().Cooks == 1U, "first Prepare cooks");
+        Check(cache.Prepare(imagePath, options, second) && cache.GetStats().Hits == 1U && second.File.IsOpen(), "second Prepare maps the cache file");
+        Check(second.Desc.Format == TextureFormat::BC7 && second.Desc.Width == source.Width && second.Data
+            && std::memcmp(first.Data, second.Data, static_cast<size_t>(GetTextureDataSize(second.Desc))) == 0, "cached data matches the cooked data");
+
+        options.Compression = TextureCompression::None;
+        CookedTexture other;
+        Check(cache.Prepare(imagePath, options, other) && cache.GetStats().Cooks == 2U && other.Desc.Format == TextureFormat::RGBA8, "different options cook a separate entry");
+
+        // 캐시 파일이 잘렸으면 다시 쿠킹
+        second.File.Close();
+        other.File.Close();
+        first.File.Close();
+        options.Compression = TextureCompression::BC7;
+        for (const auto& entry : std::filesystem::directory_iterator(root / "cache")) {
+            std::filesystem::resize_file(entry.path(), 100U, error);
+        }
+        CookedTexture recooked;
+        Check(cache.Prepare(imagePath, options, recooked) && cache.GetStats().Cooks == 3U && recooked.Desc.Format == TextureFormat::BC7, "truncated cache file is cooked again");
+
+        CookedTexture missing;
+        Check(!cache.Prepare((root / "missing.bmp").string(), options, missing) && cache.GetStats().Failures == 1U, "missing source fails");
+
+        NullRenderDevice device;
+        if (Check(device.Initialize(nullptr, 64, 64, false, false), "NullRenderDevice initializes")) {
+            const TextureHandle texture = cache.Load(device, imagePath, options);
+            Check(texture.IsValid() && device.GetTotalStats().BytesUploaded == GetTextureDataSize(recooked.Desc), "Load uploads the cooked texture");
+            device.DestroyTexture(texture);
+        }
+
+        recooked.File.Close();
+        std::filesystem::remove_all(root, error);
+    }
+
+    /// @brief 형식별 쿠킹 시간을 잽니다.
+    void benchmark() {
+        const Image source = makeImage(BENCH_SIZE);
+        const std::vector<byte_t> bmp = makeBMP(source, 32U, false);
+        std::printf("benchmark (%dx%d, full mip chain)\n", BENCH_SIZE, BENCH_SIZE);
+        for (const QualityFloor& floor : QUALITY_FLOORS) {
+            TextureCookOptions options;
+            options.Compression = floor.Compression;
+            std::vector<byte_t> cooked;
+            const double time = MeasureBest(3, [&] { Consume(TextureCooker::Cook(bmp.data(), bmp.size(), options, cooked)); });
+            std::printf("  %-6s cook %8.2f ms, %7.1f KB\n", floor.Name, time * 1e3, static_cast<double>(cooked.size()) / 1024.0);
+        }
+    }
+}
+
+/// @brief TextureCooker, TextureCache 테스트 진입점
+/// @note 사용법: TextureCookerTest [--no-bench]
+int main(int argc, char* argv[]) {
+    const Image source = makeImage(IMAGE_SIZE);
+
+    checkDecode(source);
+    checkCook(source);
+    checkMalformed(source);
+    checkCache(source);
+
+    if (argc < 2 || std::string(argv[1]) != "--no-bench") {
+        benchmark();
+    }
+
+    return Finish("TextureCookerTest");
+}
\ No newline at end of file
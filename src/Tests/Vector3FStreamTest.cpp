@@ -0,0 +1,308 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "Type/Matrix4x4F.hpp"
+#include "Type/SIMD.hpp"
+#include "Type/Vector3FStream.hpp"
+#include "TestCommon.hpp"
+
+using namespace tests;
+
+namespace {
+    constexpr int32_t BENCH_REPEATS = 50;       ///< 벤치마크 반복 횟수
+    constexpr size_t BENCH_COUNT    = 10007U;   ///< 벤치마크 요소 수 (레인 수의 배수가 아니므로 나머지 경로 포함)
+
+    /// @brief 빌드된 커널 경로 이름
+    constexpr const char* PATH_NAME =
+#if defined(NEOXOPS_SIMD_AVX2)
+        "AVX2 (8 lanes)";
+#elif defined(NEOXOPS_SIMD_SSE2)
+        "SSE2 (4 lanes)";
+#elif defined(NEOXOPS_SIMD_NEON)
+        "NEON (4 lanes)";
+#else
+        "scalar (1 lane)";
+#endif
+
+    /// @brief 상대 오차 범위 안에서 같은지 확인합니다.
+    bool nearlyEqual(float lhs, float rhs) noexcept {
+        const float scale = std::max({ 1.0f, std::fabs(lhs), std::fabs(rhs) });
+        return std::fabs(lhs - rhs) <= 1e-5f * scale;
+    }
+
+    bool nearlyEqual(const Vector3F& lhs, const Vector3F& rhs) noexcept {
+        return nearlyEqual(lhs.X, rhs.X) && nearlyEqual(lhs.Y, rhs.Y) && nearlyEqual(lhs.Z, rhs.Z);
+    }
+
+    /// @brief 스칼라 기준: 점 변환 (v * M, w = 1)
+    Vector3F transformPoint(const Vector3F& v, const float* m) noexcept {
+        return {
+            v.X * m[0] + v.Y * m[4] + v.Z * m[8]  + m[12],
+            v.X * m[1] + v.Y * m[5] + v.Z * m[9]  + m[13],
+            v.X * m[2] + v.Y * m[6] + v.Z * m[10] + m[14],
+        };
+    }
+
+    /// @brief 스칼라 기준: 방향 변환 (v * M, w = 0)
+    Vector3F transformNormal(const Vector3F& v, const float* m) noexcept {
+        return {
+            v.X * m[0] + v.Y * m[4] + v.Z * m[8],
+            v.X * m[1] + v.Y * m[5] + v.Z * m[9],
+            v.X * m[2] + v.Y * m[6] + v.Z * m[10],
+        };
+    }
+
+    /// @brief 스칼라 기준: AABB 포함 판정 (경계 포함)
+    bool contains(const Vector3F& v, const Vector3F& min, const Vector3F& max) noexcept {
+        return v.X >= min.X && v.X <= max.X && v.Y >= min.Y && v.Y <= max.Y && v.Z >= min.Z && v.Z <= max.Z;
+    }
+
+    /// @brief 검사용 점을 만듭니다. (영벡터, 정규화 하한 근처의 짧은 벡터, AABB 경계 위의 점 포함)
+    std::vector<Vector3F> makePoints(size_t count, uint32_t seed) {
+        std::mt19937 random(seed);
+        std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+
+        std::vector<Vector3F> points(count);
+        for (size_t i = 0U; i < count; ++i) {
+            switch (i % 11U) {
+            case 3U:
+                points[i] = Vector3F::Zero();
+                break;
+            case 5U:
+                points[i] = { 5e-7f, 0.0f, 0.0f };
+                break;
+            case 7U:
+                points[i] = { -2.0f, 6.0f, distribution(random) };
+                break;
+            default:
+                points[i] = { distribution(random), distribution(random), distribution(random) };
+                break;
+            }
+        }
+        return points;
+    }
+
+    Vector3FStream makeStream(const std::vector<Vector3F>& points) {
+        Vector3FStream stream;
+        stream.Reserve(points.size());
+        for (const Vector3F& point : points) {
+            stream.PushBack(point);
+        }
+        return stream;
+    }
+
+    const float MATRIX[16] = {
+        0.8f,  0.1f, 0.0f, 0.0f,
+        -0.1f, 0.9f, 0.2f, 0.0f,
+        0.0f,  0.3f, 1.1f, 0.0f,
+        5.0f,  6.0f, 7.0f, 1.0f,
+    };
+    const Vector3F POINT    = { 1.0f, 2.0f, 3.0f };
+    const Vector3F AABB_MIN = { -2.0f, -3.0f, -4.0f };
+    const Vector3F AABB_MAX = { 5.0f, 6.0f, 7.0f };
+
+    /// @brief 모든 커널을 스칼라 기준과 비교합니다.
+    /// @param count 요소 수 (레인 수의 배수 전후를 모두 검사)
+    void checkKernels(size_t count) {
+        const std::vector<Vector3F> points = makePoints(count, static_cast<uint32_t>(count) + 1U);
+        const std::vector<Vector3F> others = makePoints(count, static_cast<uint32_t>(count) + 1000U);
+        const Vector3FStream stream = makeStream(points);
+        const Vector3FStream otherStream = makeStream(others);
+        const std::string suffix = " (count " + std::to_string(count) + ")";
+
+        Vector3FStream result;
+        bool matched = true;
+
+        Vector3FStream::Transform(stream, MATRIX, result);
+        for (size_t i = 0U; i < count; ++i) {
+            matched = matched && nearlyEqual(result.Get(i), transformPoint(points[i], MATRIX));
+        }
+        Check(matched && result.GetSize() == count, ("Transform matches scalar" + suffix).c_str());
+
+        matched = true;
+        Matrix4x4F matrix;
+        std::copy_n(MATRIX, 16, &matrix.M[0][0]);
+        Vector3FStream::TransformNormal(stream, matrix, result);
+        for (size_t i = 0U; i < count; ++i) {
+            matched = matched && nearlyEqual(result.Get(i), transformNormal(points[i], MATRIX));
+        }
+        Check(matched, ("TransformNormal (Matrix4x4F) matches scalar" + suffix).c_str());
+
+        // 제자리 변환
+        matched = true;
+        Vector3FStream inPlace = stream;
+        Vector3FStream::Transform(inPlace, matrix, inPlace);
+        for (size_t i = 0U; i < count; ++i) {
+            matched = matched && nearlyEqual(inPlace.Get(i), transformPoint(points[i], MATRIX));
+        }
+        Check(matched, ("in-place Transform matches scalar" + suffix).c_str());
+
+        matched = true;
+        Vector3FStream::Normalize(stream, result);
+        for (size_t i = 0U; i < count; ++i) {
+            matched = matched && nearlyEqual(result.Get(i), points[i].Normalize());
+        }
+        Check(matched, ("Normalize matches Vector3F::Normalize" + suffix).c_str());
+
+        std::vector<float> values(count);
+        matched = true;
+        Vector3FStream::Dot(stream, otherStream, values.data());
+        for (size_t i = 0U; i < count; ++i) {
+            matched = matched && nearlyEqual(values[i], Vector3F::Dot(points[i], others[i]));
+        }
+        Check(matched, ("Dot (stream) matches Vector3F::Dot" + suffix).c_str());
+
+        matched = true;
+        Vector3FStream::Dot(stream, POINT, values.data());
+        for (size_t i = 0U; i < count; ++i) {
+            matched = matched && nearlyEqual(values[i], Vector3F::Dot(points[i], POINT));
+        }
+        Check(matched, ("Dot (vector) matches Vector3F::Dot" + suffix).c_str());
+
+        matched = true;
+        Vector3FStream::DistanceSquared(stream, POINT, values.data());
+        for (size_t i = 0U; i < count; ++i) {
+            matched = matched && nearlyEqual(values[i], Vector3F::DistanceSquared(points[i], POINT));
+        }
+        Check(matched, ("DistanceSquared matches Vector3F::DistanceSquared" + suffix).c_str());
+
+        matched = true;
+        Vector3FStream accumulated = stream;
+        Vector3FStream::AddScaled(accumulated, otherStream, 0.25f);
+        for (size_t i = 0U; i < count; ++i) {
+            matched = matched && nearlyEqual(accumulated.Get(i), points[i] + others[i] * 0.25f);
+        }
+        Check(matched, ("AddScaled matches scalar" + suffix).c_str());
+
+        std::vector<byte_t> inside(count, 0xFFU);
+        const size_t insideCount = Vector3FStream::ContainedInAABB(stream, AABB_MIN, AABB_MAX, inside.data());
+        size_t expectedCount = 0U;
+        matched = true;
+        for (size_t i = 0U; i < count; ++i) {
+            const bool expected = contains(points[i], AABB_MIN, AABB_MAX);
+            expectedCount += expected ? 1U : 0U;
+            matched = matched && (inside[i] == (expected ? 1U : 0U));
+        }
+        Check(matched && insideCount == expectedCount, ("ContainedInAABB matches scalar" + suffix).c_str());
+        Check(Vector3FStream::ContainedInAABB(stream, AABB_MIN, AABB_MAX, nullptr) == expectedCount, ("ContainedInAABB counts without output" + suffix).c_str());
+    }
+
+    /// @brief 벤치마크 결과를 출력합니다.
+    void report(const char* name, double scalarTime, double streamTime) noexcept {
+        std::printf("  %-16s scalar %8.1f Melem/s  stream %8.1f Melem/s  x%.2f\n", name,
+            BENCH_COUNT / scalarTime / 1e6, BENCH_COUNT / streamTime / 1e6, scalarTime / streamTime);
+    }
+
+    /// @brief 각 커널을 Vector3F 배열(AoS) 스칼라 경로와 비교해 잽니다.
+    void benchmark() {
+        const std::vector<Vector3F> points = makePoints(BENCH_COUNT, 1U);
+        const std::vector<Vector3F> others = makePoints(BENCH_COUNT, 2U);
+        const Vector3FStream stream = makeStream(points);
+        const Vector3FStream otherStream = makeStream(others);
+
+        std::vector<Vector3F> aos(BENCH_COUNT);
+        Vector3FStream result;
+        result.Resize(BENCH_COUNT);
+        std::vector<float> values(BENCH_COUNT);
+        std::vector<byte_t> inside(BENCH_COUNT);
+
+        std::printf("benchmark (%zu elements, best of %d)\n", BENCH_COUNT, BENCH_REPEATS);
+
+        double scalar = MeasureBest(BENCH_REPEATS, [&] {
+            for (size_t i = 0U; i < BENCH_COUNT; ++i) {
+                aos[i] = transformPoint(points[i], MATRIX);
+            }
+            Consume(aos[BENCH_COUNT / 2U]);
+        });
+        double simd = MeasureBest(BENCH_REPEATS, [&] { Vector3FStream::Transform(stream, MATRIX, result); Consume(result.GetX()[BENCH_COUNT / 2U]); });
+        report("Transform", scalar, simd);
+
+        scalar = MeasureBest(BENCH_REPEATS, [&] {
+            for (size_t i = 0U; i < BENCH_COUNT; ++i) {
+                aos[i] = transformNormal(points[i], MATRIX);
+            }
+            Consume(aos[BENCH_COUNT / 2U]);
+        });
+        simd = MeasureBest(BENCH_REPEATS, [&] { Vector3FStream::TransformNormal(stream, MATRIX, result); Consume(result.GetX()[BENCH_COUNT / 2U]); });
+        report("TransformNormal", scalar, simd);
+
+        scalar = MeasureBest(BENCH_REPEATS, [&] {
+            for (size_t i = 0U; i < BENCH_COUNT; ++i) {
+                aos[i] = points[i].Normalize();
+            }
+            Consume(aos[BENCH_COUNT / 2U]);
+        });
+        simd = MeasureBest(BENCH_REPEATS, [&] { Vector3FStream::Normalize(stream, result); Consume(result.GetX()[BENCH_COUNT / 2U]); });
+        report("Normalize", scalar, simd);
+
+        scalar = MeasureBest(BENCH_REPEATS, [&] {
+            for (size_t i = 0U; i < BENCH_COUNT; ++i) {
+                values[i] = Vector3F::Dot(points[i], others[i]);
+            }
+            Consume(values[BENCH_COUNT / 2U]);
+        });
+        simd = MeasureBest(BENCH_REPEATS, [&] { Vector3FStream::Dot(stream, otherStream, values.data()); Consume(values[BENCH_COUNT / 2U]); });
+        report("Dot", scalar, simd);
+
+        scalar = MeasureBest(BENCH_REPEATS, [&] {
+            for (size_t i = 0U; i < BENCH_COUNT; ++i) {
+                values[i] = Vector3F::DistanceSquared(points[i], POINT);
+            }
+            Consume(values[BENCH_COUNT / 2U]);
+        });
+        simd = MeasureBest(BENCH_REPEATS, [&] { Vector3FStream::DistanceSquared(stream, POINT, values.data()); Consume(values[BENCH_COUNT / 2U]); });
+        report("DistanceSquared", scalar, simd);
+
+        Vector3FStream accumulated = stream;
+        std::vector<Vector3F> accumulatedAoS = points;
+        scalar = MeasureBest(BENCH_REPEATS, [&] {
+            for (size_t i = 0U; i < BENCH_COUNT; ++i) {
+                accumulatedAoS[i] += others[i] * 0.001f;
+            }
+            Consume(accumulatedAoS[BENCH_COUNT / 2U]);
+        });
+        simd = MeasureBest(BENCH_REPEATS, [&] { Vector3FStream::AddScaled(accumulated, otherStream, 0.001f); Consume(accumulated.GetX()[BENCH_COUNT / 2U]); });
+        report("AddScaled", scalar, simd);
+
+        scalar = MeasureBest(BENCH_REPEATS, [&] {
+            size_t count = 0U;
+            for (size_t i = 0U; i < BENCH_COUNT; ++i) {
+                const bool contained = contains(points[i], AABB_MIN, AABB_MAX);
+                inside[i] = contained ? 1U : 0U;
+                count += contained ? 1U : 0U;
+            }
+            Consume(count);
+        });
+        simd = MeasureBest(BENCH_REPEATS, [&] { Consume(Vector3FStream::ContainedInAABB(stream, AABB_MIN, AABB_MAX, inside.data())); });
+        report("ContainedInAABB", scalar, simd);
+    }
+}
+
+/// @brief Vector3FStream 일괄 커널 테스트 진입점
+/// @note 사용법: Vector3FStreamTest [--no-bench]
+///       커널 경로는 빌드 시점에 정해지므로 기본(SSE2), -mavx2, -DNEOXOPS_DISABLE_SIMD로 각각 빌드해 실행해야 모든 경로가 검사됩니다.
+int main(int argc, char* argv[]) {
+#if defined(NEOXOPS_SIMD_AVX2) && (defined(__GNUC__) || defined(__clang__))
+    if (!__builtin_cpu_supports("avx2")) {
+        std::printf("Vector3FStreamTest: AVX2 build skipped (CPU does not support AVX2)\n");
+        return 0;
+    }
+#endif
+
+    std::printf("kernel path: %s\n", PATH_NAME);
+
+    // 레인 수(1, 4, 8)의 배수 전후와 빈 스트림
+    const size_t counts[] = { 0U, 1U, 3U, 4U, 5U, 7U, 8U, 9U, 15U, 16U, 17U, 1000U, BENCH_COUNT };
+    for (size_t count : counts) {
+        checkKernels(count);
+    }
+
+    if (argc < 2 || std::string(argv[1]) != "--no-bench") {
+        benchmark();
+    }
+
+    return Finish("Vector3FStreamTest");
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "Type/Vector2F.hpp"
+#include "Type/Vector3F.hpp"
+#include "TestCommon.hpp"
+
+using namespace tests;
+
+namespace {
+    constexpr size_t SMALL_COUNT = 4096U;           ///< 작은 배열 요소 수
+    constexpr size_t LARGE_COUNT = 1U << 20U;       ///< 큰 배열 요소 수
+    constexpr int32_t BENCH_REPEATS = 30;           ///< 벤치마크 반복 횟수
+
+    /// @brief 자명하게 복사 가능하지 않은 비교용 타입 (예전 Vector3F처럼 사용자 정의 복사 생성자를 가짐)
+    struct NonTrivialVector3F final {
+        float X = 0.0f;
+        float Y = 0.0f;
+        float Z = 0.0f;
+
+        NonTrivialVector3F() noexcept = default;
+        NonTrivialVector3F(float x, float y, float z) noexcept : X(x), Y(y), Z(z) {}
+        NonTrivialVector3F(const NonTrivialVector3F& other) noexcept : X(other.X), Y(other.Y), Z(other.Z) {}
+        NonTrivialVector3F& operator=(const NonTrivialVector3F& other) noexcept {
+            X = other.X;
+            Y = other.Y;
+            Z = other.Z;
+            return *this;
+        }
+    };
+
+    static_assert(std::is_trivially_copyable_v<Vector2F> && std::is_trivially_copyable_v<Vector3F>);
+    static_assert(!std::is_trivially_copyable_v<NonTrivialVector3F>);
+
+    /// @brief std::vector 동작이 값과 바이트를 그대로 보존하는지 확인합니다.
+    void checkCopies() {
+        std::vector<Vector3F> grown;
+        for (size_t i = 0U; i < SMALL_COUNT; ++i) {
+            grown.push_back(Vector3F{ static_cast<float>(i), -static_cast<float>(i), 0.5f });
+        }
+        bool grownMatches = true;
+        for (size_t i = 0U; i < SMALL_COUNT; ++i) {
+            grownMatches = grownMatches && grown[i] == Vector3F{ static_cast<float>(i), -static_cast<float>(i), 0.5f };
+        }
+        Check(grownMatches, "push_back growth keeps every element");
+
+        std::vector<Vector3F> copied(SMALL_COUNT);
+        std::copy(grown.begin(), grown.end(), copied.begin());
+        Check(std::memcmp(copied.data(), grown.data(), SMALL_COUNT * sizeof(Vector3F)) == 0, "std::copy is a byte copy");
+
+        const std::vector<Vector3F> constructed(grown);
+        Check(std::memcmp(constructed.data(), grown.data(), SMALL_COUNT * sizeof(Vector3F)) == 0, "vector copy construction is a byte copy");
+
+        std::vector<Vector2F> points;
+        points.emplace_back(1.0f, 2.0f);
+        points.insert(points.begin(), Vector2F{ 3.0f, 4.0f });
+        Check(points.size() == 2U && points[0] == Vector2F{ 3.0f, 4.0f } && points[1] == Vector2F{ 1.0f, 2.0f }, "Vector2F insert shifts elements");
+    }
+
+    template <typename T>
+    double benchGrowth(size_t count, int32_t repeats) noexcept {
+        return MeasureBest(repeats, [count] {
+            std::vector<T> values;
+            for (size_t i = 0U; i < count; ++i) {
+                values.push_back(T{ static_cast<float>(i), 1.0f, 2.0f });
+            }
+            Consume(values[count / 3U].X);
+        });
+    }
+
+    template <typename T>
+    double benchCopy(size_t count, int32_t repeats) {
+        std::vector<T> src(count);
+        std::vector<T> dst(count);
+        for (size_t i = 0U; i < count; ++i) {
+            src[i] = T{ static_cast<float>(i), 1.0f, 2.0f };
+        }
+        return MeasureBest(repeats, [&] {
+            std::copy(src.begin(), src.end(), dst.begin());
+            Consume(dst[count / 2U].X);
+        });
+    }
+
+    template <typename T>
+    double benchReserve(size_t count, int32_t repeats) {
+        std::vector<T> src(count);
+        return MeasureBest(repeats, [&] {
+            std::vector<T> values(src);
+            values.reserve(count * 2U);                 // 재할당 시 기존 요소 이동
+            Consume(values[count / 2U].X);
+        });
+    }
+
+    double benchMemcpy(size_t count, int32_t repeats) {
+        std::vector<Vector3F> src(count);
+        std::vector<Vector3F> dst(count);
+        return MeasureBest(repeats, [&] {
+            std::memcpy(dst.data(), src.data(), count * sizeof(Vector3F));
+            Consume(dst[count / 2U].X);
+        });
+    }
+
+    /// @brief Vector3F 복사가 memcpy와 같은 속도인지, 사용자 정의 복사 타입과 얼마나 차이 나는지 잽니다.
+    /// @note std::copy와 재할당은 자명하게 복사 가능한 타입에서 memmove로 내려가므로 memcpy 기준선과 거의 같아야 합니다.
+    void benchmark() {
+        std::printf("benchmark (us, best of %d)\n", BENCH_REPEATS);
+        std::printf("  %-15s %9s %12s %10s\n", "elements", "memcpy", "Vector3F", "non-trivial");
+        for (const size_t count : { SMALL_COUNT, LARGE_COUNT }) {
+            const int32_t repeats = (count == SMALL_COUNT) ? BENCH_REPEATS * 10 : BENCH_REPEATS;
+            const double memcpyTime = benchMemcpy(count, repeats);
+            const double copyTime = benchCopy<Vector3F>(count, repeats);
+            const double nonTrivialCopyTime = benchCopy<NonTrivialVector3F>(count, repeats);
+            std::printf("  copy    %-7zu %9.2f %12.2f %10.2f\n", count, memcpyTime * 1e6, copyTime * 1e6, nonTrivialCopyTime * 1e6);
+
+            const double reserveTime = benchReserve<Vector3F>(count, repeats);
+            const double nonTrivialReserveTime = benchReserve<NonTrivialVector3F>(count, repeats);
+            std::printf("  reserve %-7zu %9s %12.2f %10.2f\n", count, "-", reserveTime * 1e6, nonTrivialReserveTime * 1e6);
+
+            const double growthTime = benchGrowth<Vector3F>(count, repeats);
+            const double nonTrivialGrowthTime = benchGrowth<NonTrivialVector3F>(count, repeats);
+            std::printf("  growth  %-7zu %9s %12.2f %10.2f\n", count, "-", growthTime * 1e6, nonTrivialGrowthTime * 1e6);
+        }
+    }
+}
+
+/// @brief Vector2F/Vector3F 컨테이너 복사 테스트 진입점
+/// @note 사용법: VectorCopyTest [--no-bench]
+int main(int argc, char* argv[]) {
+    checkCopies();
+
+    if (argc < 2 || std::string(argv[1]) != "--no-bench") {
+        benchmark();
+    }
+
+    return Finish("VectorCopyTest");
+}
\ No newline at end of file
@@ -0,0 +1,293 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Graphics/NullRenderDevice.hpp"
+#include "World/WorldGeometry.hpp"
+#include "TestCommon.hpp"
+
+using namespace tests;
+using namespace world;
+
+namespace {
+    constexpr uint32_t GRID_SIZE        = 8U;       ///< 상자 격자 한 변의 상자 수
+    constexpr float SPACING             = 20.0f;    ///< 상자 간격 (클러스터 크기와 같음)
+    constexpr uint32_t DEGENERATE_BLOCK = 5U;       ///< 꼭짓점이 모두 겹친 블록
+    constexpr int32_t BENCH_REPEATS     = 2000;     ///< 벤치마크 반복 횟수
+
+    /// @brief 면 텍스처 인덱스 (-1 ~ 10, 범위 밖 값 포함)
+    int32_t textureOf(uint32_t block, uint32_t face) noexcept {
+        return static_cast<int32_t>((block * 7U + face) % 12U) - 1;
+    }
+
+    /// @brief 상자가 격자로 놓인 맵을 만듭니다.
+    /// @note 상자마다 클러스터 칸 하나에 들어가며, DEGENERATE_BLOCK은 넓이가 0인 면만 가집니다.
+    void makeMap(BlockData& blocks) {
+        const uint32_t count = GRID_SIZE * GRID_SIZE;
+        std::vector<byte_t> file(BlockData::HEADER_SIZE + count * BlockData::BLOCK_SIZE, 0U);
+        const uint16_t blockCount = static_cast<uint16_t>(count);
+        std::memcpy(&file[BlockData::TEXTURE_COUNT * BlockData::TEXTURE_NAME_LENGTH], &blockCount, sizeof(blockCount));
+
+        for (uint32_t b = 0U; b < count; ++b) {
+            const float x0 = static_cast<float>(b % GRID_SIZE) * SPACING + 2.0f;
+            const float z0 = static_cast<float>(b / GRID_SIZE) * SPACING + 2.0f;
+            const float size = (b == DEGENERATE_BLOCK) ? 0.0f : 4.0f + static_cast<float>(b % 5U);
+
+            // 꼭짓점 0 ~ 3: 윗면, 4 ~ 7: 아랫면
+            float values[BlockData::BLOCK_SIZE / sizeof(float)] = {};
+            float* x = values;
+            float* y = values + BlockData::VERTEX_COUNT;
+            float* z = values + BlockData::VERTEX_COUNT * 2U;
+            const float cornerX[4] = { x0, x0 + size, x0 + size, x0 };
+            const float cornerZ[4] = { z0, z0, z0 + size, z0 + size };
+            for (uint32_t k = 0U; k < 4U; ++k) {
+                x[k] = x[k + 4U] = cornerX[k];
+                z[k] = z[k + 4U] = cornerZ[k];
+                y[k] = size;
+                y[k + 4U] = 0.0f;
+            }
+            float* u = values + BlockData::VERTEX_COUNT * 3U;
+            for (uint32_t k = 0U; k < BlockData::UV_COUNT * 2U; ++k) {
+                u[k] = static_cast<float>(k % 2U);
+            }
+            for (uint32_t f = 0U; f < BlockData::FACE_COUNT; ++f) {
+                values[BlockData::VERTEX_COUNT * 3U + BlockData::UV_COUNT * 2U + f] = static_cast<float>(textureOf(b, f));
+            }
+            std::memcpy(&file[BlockData::HEADER_SIZE + b * BlockData::BLOCK_SIZE], values, sizeof(values));
+        }
+
+        (void)blocks.Parse(file.data(), file.size());
+    }
+
+    /// @brief 보이는 면의 수를 직접 셉니다.
+    uint32_t countFaces(const BlockData& blocks, bool skipUntextured) noexcept {
+        uint32_t faces = 0U;
+        for (uint32_t b = 0U; b < blocks.GetBlockCount(); ++b) {
+            for (uint32_t f = 0U; f < BlockData::FACE_COUNT; ++f) {
+                const int32_t texture = textureOf(b, f);
+                const bool textured = texture >= 0 && texture < static_cast<int32_t>(BlockData::TEXTURE_COUNT);
+                faces += (b != DEGENERATE_BLOCK && (textured || !skipUntextured)) ? 1U : 0U;
+            }
+        }
+        return faces;
+    }
+
+    /// @brief 범위가 텍스처 순으로 인덱스 버퍼를 빈틈없이 덮고, 하위 범위가 범위를 나누는지 확인합니다.
+    bool checkRanges(const WorldGeometry& geometry) noexcept {
+        uint32_t next = 0U;
+        int32_t previous = -2;
+        for (const WorldDrawRange& range : geometry.GetRanges()) {
+            // 텍스처 없는 면(-1)은 마지막
+            const int32_t order = (range.TextureIndex < 0) ? static_cast<int32_t>(BlockData::TEXTURE_COUNT) : range.TextureIndex;
+            if (range.StartIndex != next || order <= previous || range.SubRangeCount == 0U) {
+                return false;
+            }
+            uint32_t subNext = range.StartIndex;
+            for (uint32_t i = 0U; i < range.SubRangeCount; ++i) {
+                const WorldSubRange& sub = geometry.GetSubRanges()[range.FirstSubRange + i];
+                if (sub.StartIndex != subNext || sub.IndexCount == 0U || sub.Cluster >= geometry.GetClusters().size()) {
+                    return false;
+                }
+                subNext += sub.IndexCount;
+            }
+            if (subNext != range.StartIndex + range.IndexCount) {
+                return false;
+            }
+            next += range.IndexCount;
+            previous = order;
+        }
+        return next == geometry.GetIndices().size();
+    }
+
+    /// @brief 구성 결과를 확인합니다.
+    void checkBuild(const BlockData& blocks) {
+        for (const bool skipUntextured : { false, true }) {
+            WorldGeometryOptions options;
+            options.ClusterSize = SPACING;
+            options.SkipUntextured = skipUntextured;
+
+            WorldGeometry geometry;
+            geometry.Build(blocks, options);
+            const uint32_t faces = countFaces(blocks, skipUntextured);
+            const std::string mode = skipUntextured ? "skip untextured: " : "all faces: ";
+            Check(geometry.GetVertices().size() == faces * 4U && geometry.GetIndices().size() == faces * 6U, (mode + "four vertices and six indices per non-degenerate face").c_str());
+            Check(checkRanges(geometry), (mode + "ranges are sorted by texture and sub-ranges tile them").c_str());
+            Check(geometry.GetClusters().size() == GRID_SIZE * GRID_SIZE - 1U, (mode + "one cluster per grid cell with geometry").c_str());
+            Check(skipUntextured == std::none_of(geometry.GetRanges().begin(), geometry.GetRanges().end(), [](const WorldDrawRange& range) { return range.TextureIndex < 0; }),
+                (mode + "untextured range exists only when not skipped").c_str());
+
+            // 모든 정점이 자신이 속한 클러스터의 경계 상자 안에 있어야 함
+            bool bounded = true;
+            for (const WorldSubRange& sub : geometry.GetSubRanges()) {
+                const WorldCluster& cluster = geometry.GetClusters()[sub.Cluster];
+                for (uint32_t i = sub.StartIndex; i < sub.StartIndex + sub.IndexCount; ++i) {
+                    const WorldVertex& vertex = geometry.GetVertices()[geometry.GetIndices()[i]];
+                    bounded = bounded && vertex.X >= cluster.Min.X && vertex.X <= cluster.Max.X && vertex.Y >= cluster.Min.Y && vertex.Y <= cluster.Max.Y
+                        && vertex.Z >= cluster.Min.Z && vertex.Z <= cluster.Max.Z;
+                }
+            }
+            Check(bounded, (mode + "cluster bounds contain their vertices").c_str());
+        }
+
+        WorldGeometry single;
+        single.Build(blocks);
+        Check(single.GetClusters().size() == 1U && single.GetSubRanges().size() == single.GetRanges().size(), "ClusterSize 0 builds a single cluster");
+
+        BlockData empty;
+        single.Build(empty);
+        Check(single.GetIndices().empty() && single.GetRanges().empty() && single.GetClusters().empty(), "rebuilding from an empty map clears the geometry");
+    }
+
+    /// @brief 기준 판정: 경계 상자의 꼭짓점 8개가 모두 한 절두체 평면 밖에 있으면 보이지 않음
+    bool referenceVisible(const WorldCluster& cluster, const Matrix4x4F& viewProjection) noexcept {
+        Vector4F clip[8];
+        for (uint32_t k = 0U; k < 8U; ++k) {
+            const Vector4F corner(
+                (k & 1U) ? cluster.Max.X : cluster.Min.X,
+                (k & 2U) ? cluster.Max.Y : cluster.Min.Y,
+                (k & 4U) ? cluster.Max.Z : cluster.Min.Z, 1.0f);
+            clip[k] = viewProjection.Transform(corner);
+        }
+
+        const auto allOutside = [&](auto outside) noexcept {
+            return std::all_of(std::begin(clip), std::end(clip), outside);
+        };
+        return !(allOutside([](const Vector4F& c) { return c.X < -c.W; }) || allOutside([](const Vector4F& c) { return c.X > c.W; })
+            || allOutside([](const Vector4F& c) { return c.Y < -c.W; }) || allOutside([](const Vector4F& c) { return c.Y > c.W; })
+            || allOutside([](const Vector4F& c) { return c.Z < 0.0f; }) || allOutside([](const Vector4F& c) { return c.Z > c.W; }));
+    }
+
+    /// @brief 격자 가운데에서 한 방향을 보는 카메라의 뷰 * 투영 행렬
+    Matrix4x4F makeCamera(float yaw) noexcept {
+        const float center = static_cast<float>(GRID_SIZE) * SPACING * 0.5f;
+        const Vector3F eye(center, 5.0f, center);
+        const Vector3F direction(std::sin(yaw), -0.1f, std::cos(yaw));
+        return Matrix4x4F::Multiply(Matrix4x4F::LookToLH(eye, direction, { 0.0f, 1.0f, 0.0f }), Matrix4x4F::PerspectiveFovLH(1.0f, 16.0f / 9.0f, 0.5f, 60.0f));
+    }
+
+    /// @brief 컬링 결과가 기준 판정과 같고, 보이는 클러스터의 인덱스만 그리는지 확인합니다.
+    void checkCulling(const BlockData& blocks, graphics::NullRenderDevice& device) {
+        WorldGeometryOptions options;
+        options.ClusterSize = SPACING;
+        WorldGeometry geometry;
+        geometry.Build(blocks, options);
+        if (!Check(geometry.Upload(device), "Upload succeeds")) {
+            return;
+        }
+
+        const std::vector<graphics::TextureHandle> textures(BlockData::TEXTURE_COUNT);
+        std::vector<byte_t> visible(geometry.GetClusters().size());
+        bool matches = true, drawn = true, culled = false;
+        for (int32_t step = 0; step < 16; ++step) {
+            const Matrix4x4F viewProjection = makeCamera(static_cast<float>(step) * 0.3927f);
+            geometry.CullClusters(viewProjection, visible.data());
+
+            uint64_t expectedIndices = 0ULL;
+            uint32_t visibleSubRanges = 0U;
+            for (size_t i = 0U; i < visible.size(); ++i) {
+                matches = matches && (visible[i] != 0U) == referenceVisible(geometry.GetClusters()[i], viewProjection);
+                culled = culled || visible[i] == 0U;
+            }
+            for (const WorldSubRange& sub : geometry.GetSubRanges()) {
+                if (visible[sub.Cluster]) {
+                    expectedIndices += sub.IndexCount;
+                    ++visibleSubRanges;
+                }
+            }
+
+            const graphics::RenderStats before = device.GetTotalStats();
+            const uint32_t drawCalls = geometry.Draw(device, textures.data(), visible.data());
+            const graphics::RenderStats& after = device.GetTotalStats();
+            drawn = drawn && after.Vertices - before.Vertices == expectedIndices && drawCalls == after.DrawCalls - before.DrawCalls && drawCalls <= visibleSubRanges;
+        }
+        Check(matches, "CullClusters matches the eight-corner reference");
+        Check(culled, "camera views cull some clusters");
+        Check(drawn, "Draw submits exactly the visible clusters' indices");
+
+        const graphics::RenderStats before = device.GetTotalStats();
+        Check(geometry.Draw(device, textures.data()) == geometry.GetRanges().size() && device.GetTotalStats().Vertices - before.Vertices == geometry.GetIndices().size(),
+            "drawing everything issues one draw per texture");
+        geometry.Release(device);
+    }
+
+    /// @brief 업로드한 버퍼가 이동 후에도 한 번만 해제되는지 확인합니다.
+    void checkLifetime(const BlockData& blocks, graphics::NullRenderDevice& device) {
+        const uint32_t baseline = device.GetBufferCount();
+        const std::vector<graphics::TextureHandle> textures(BlockData::TEXTURE_COUNT);
+
+        WorldGeometry source;
+        source.Build(blocks);
+        const size_t indexCount = source.GetIndices().size();
+        if (!Check(source.Upload(device) && device.GetBufferCount() == baseline + 2U, "Upload creates a vertex and an index buffer")) {
+            return;
+        }
+        Check(source.Upload(device) && device.GetBufferCount() == baseline + 2U, "uploading again replaces the buffers");
+
+        WorldGeometry moved(std::move(source));
+        Check(moved.GetIndices().size() == indexCount && source.GetIndices().empty() && source.GetRanges().empty(), "move transfers the geometry and empties the source");
+        Check(source.Draw(device, textures.data()) == 0U, "moved-from geometry draws nothing");
+
+        // 이동 전 원본의 버퍼를 해제하면 이동 대상의 버퍼가 사라짐 (이중 해제)
+        source.Release(device);
+        Check(device.GetBufferCount() == baseline + 2U && moved.Draw(device, textures.data()) > 0U, "releasing the moved-from geometry keeps the buffers");
+
+        moved.Release(device);
+        moved.Release(device);
+        Check(device.GetBufferCount() == baseline, "Release frees the buffers once");
+        Check(moved.Draw(device, textures.data()) == 0U, "released geometry draws nothing");
+
+        WorldGeometry empty;
+        empty.Build(BlockData());
+        Check(empty.Upload(device) && device.GetBufferCount() == baseline, "empty geometry uploads no buffers");
+    }
+
+    /// @brief 구성과 컬링 시간을 잽니다.
+    void benchmark(const BlockData& blocks) {
+        WorldGeometryOptions options;
+        options.ClusterSize = SPACING;
+        WorldGeometry geometry;
+        const double buildTime = MeasureBest(5, [&] { geometry.Build(blocks, options); });
+
+        std::vector<byte_t> visible(geometry.GetClusters().size());
+        const Matrix4x4F viewProjection = makeCamera(0.5f);
+        const double cullTime = MeasureBest(5, [&] {
+            for (int32_t i = 0; i < BENCH_REPEATS; ++i) {
+                geometry.CullClusters(viewProjection, visible.data());
+                Consume(visible[static_cast<size_t>(i) % visible.size()]);
+            }
+        }) / BENCH_REPEATS;
+
+        std::printf("benchmark (%u blocks, %zu clusters, %zu triangles)\n", blocks.GetBlockCount(), geometry.GetClusters().size(), geometry.GetIndices().size() / 3U);
+        std::printf("  build  %8.3f ms\n", buildTime * 1e3);
+        std::printf("  cull   %8.3f us\n", cullTime * 1e6);
+    }
+}
+
+/// @brief WorldGeometry 테스트 진입점
+/// @note 사용법: WorldGeometryTest [--no-bench]
+int main(int argc, char* argv[]) {
+    BlockData blocks;
+    makeMap(blocks);
+    if (!Check(blocks.GetBlockCount() == GRID_SIZE * GRID_SIZE, "test map parses")) {
+        return Finish("WorldGeometryTest");
+    }
+
+    graphics::NullRenderDevice device;
+    if (!Check(device.Initialize(nullptr, 640, 480, false, false), "NullRenderDevice initializes")) {
+        return Finish("WorldGeometryTest");
+    }
+
+    checkBuild(blocks);
+    checkCulling(blocks, device);
+    checkLifetime(blocks, device);
+
+    if (argc < 2 || std::string(argv[1]) != "--no-bench") {
+        benchmark(blocks);
+    }
+
+    return Finish("WorldGeometryTest");
+}
\ No newline at end of file
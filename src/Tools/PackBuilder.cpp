@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include "System/FileSystem.hpp"
+#include "Type/Hash.hpp"
+
+/// @brief 팩 빌더 진입점
+/// @note 사용법: PackBuilder <입력 디렉터리> <출력.nxpak> [--no-compress] [--store .ext] [--verify]
+///       입력 디렉터리 아래의 모든 파일을 상대 경로 이름으로 팩 하나에 담습니다. (--store로 지정한 확장자는 압축하지 않음)
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::fprintf(stderr, "usage: PackBuilder <input directory> <output.nxpak> [--no-compress] [--store .ext] [--verify]\n");
+        return 1;
+    }
+
+    const std::filesystem::path input = argv[1];
+    const std::string output = argv[2];
+    std::vector<std::string> storedExtensions;
+    bool compress = true;
+    bool verify = false;
+
+    for (int i = 3; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--no-compress") == 0) {
+            compress = false;
+        } else if (std::strcmp(argv[i], "--store") == 0 && (i + 1) < argc) {
+            std::string extension = argv[++i];
+            std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            storedExtensions.push_back(std::move(extension));
+        } else if (std::strcmp(argv[i], "--verify") == 0) {
+            verify = true;
+        }
+    }
+
+    // 같은 입력이면 같은 팩이 나오도록 경로 순서로 추가
+    std::vector<std::filesystem::path> files;
+    std::error_code error;
+    for (std::filesystem::recursive_directory_iterator it(input, error), end; !error && it != end; it.increment(error)) {
+        if (it->is_regular_file(error)) {
+            files.push_back(it->path());
+        }
+    }
+    if (error) {
+        std::fprintf(stderr, "failed to scan %s\n", input.string().c_str());
+        return 1;
+    }
+    std::sort(files.begin(), files.end());
+
+    const auto start = std::chrono::steady_clock::now();
+    system::PackWriter writer;
+    if (!writer.Create(output)) {
+        std::fprintf(stderr, "failed to create %s\n", output.c_str());
+        return 1;
+    }
+
+    for (const std::filesystem::path& file : files) {
+        const std::string name = file.lexically_relative(input).generic_string();
+        std::string extension = file.extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        const bool store = std::find(storedExtensions.begin(), storedExtensions.end(), extension) != storedExtensions.end();
+
+        // 빈 파일은 매핑할 수 없으므로 빈 내용으로 추가
+        system::MappedFile source;
+        const bool opened = source.Open(file.string());
+        if (!opened && std::filesystem::file_size(file, error) != 0U) {
+            std::fprintf(stderr, "failed to read %s\n", file.string().c_str());
+            return 1;
+        }
+        if (!writer.Add(name, source.GetData(), source.GetSize(), compress && !store)) {
+            std::fprintf(stderr, "failed to add %s (duplicate path or write error)\n", name.c_str());
+            return 1;
+        }
+    }
+
+    if (!writer.Finish()) {
+        std::fprintf(stderr, "failed to write %s\n", output.c_str());
+        return 1;
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const system::PackWriterStats& stats = writer.GetStats();
+    std::printf("files=%llu duplicates=%llu stored=%llu\n", static_cast<unsigned long long>(stats.FileCount),
+        static_cast<unsigned long long>(stats.DuplicateCount), static_cast<unsigned long long>(stats.StoredCount));
+    std::printf("size=%llu -> %llu bytes (%.1f%%), %.2f s\n", static_cast<unsigned long long>(stats.SourceBytes), static_cast<unsigned long long>(stats.PackedBytes),
+        (stats.SourceBytes != 0U) ? 100.0 * static_cast<double>(stats.PackedBytes) / static_cast<double>(stats.SourceBytes) : 100.0, seconds);
+
+    // 다시 열어 모든 파일의 내용 해시를 원본과 비교
+    if (verify) {
+        system::FileSystem fileSystem;
+        if (!fileSystem.MountPack(output)) {
+            std::fprintf(stderr, "failed to open %s\n", output.c_str());
+            return 1;
+        }
+        fileSystem.SetVerifyContent(true);
+
+        system::FileData data;
+        for (const std::filesystem::path& file : files) {
+            const std::string name = file.lexically_relative(input).generic_string();
+            system::MappedFile source;
+            (void)source.Open(file.string());
+            if (!fileSystem.Read(name, data) || data.Size != source.GetSize() || Hash64(data.Data, data.Size) != Hash64(source.GetData(), source.GetSize())) {
+                std::fprintf(stderr, "verify failed: %s\n", name.c_str());
+                return 1;
+            }
+        }
+        std::printf("verified %zu files\n", files.size());
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include "Type/Hash.hpp"
+#include <cstring>
+
+namespace {
+    constexpr uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+    constexpr uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr uint64_t PRIME3 = 0x165667B19E3779F9ULL;
+    constexpr uint64_t PRIME4 = 0x85EBCA77C2B2AE63ULL;
+    constexpr uint64_t PRIME5 = 0x27D4EB2F165667C5ULL;
+
+    inline uint64_t rotl(uint64_t v, uint32_t r) noexcept {
+        return (v << r) | (v >> (64U - r));
+    }
+
+    /// @brief 리틀 엔디언 값을 읽습니다.
+    /// @note 빌드 대상(x86, ARM)이 모두 리틀 엔디언이므로 memcpy만 사용합니다.
+    template <typename T>
+    inline T read(const byte_t* p) noexcept {
+        T value;
+        std::memcpy(&value, p, sizeof(T));
+        return value;
+    }
+
+    inline uint64_t round(uint64_t acc, uint64_t input) noexcept {
+        acc += input * PRIME2;
+        acc = rotl(acc, 31U);
+        return acc * PRIME1;
+    }
+
+    inline uint64_t mergeRound(uint64_t acc, uint64_t value) noexcept {
+        acc ^= round(0ULL, value);
+        return acc * PRIME1 + PRIME4;
+    }
+}
+
+/// @brief 64비트 해시를 계산합니다.
+/// @param data 데이터
+/// @param size 크기 (바이트 단위)
+/// @param seed 초깃값
+/// @return 해시
+uint64_t neoxops::Hash64(const void* data, size_t size, uint64_t seed) noexcept {
+    const byte_t* p = static_cast<const byte_t*>(data);
+    const byte_t* const end = p + size;
+
+    uint64_t hash;
+    if (size >= 32U) {
+        // 32바이트 단위로 독립된 누산기 4개를 돌려 명령어 수준 병렬성을 얻습니다.
+        uint64_t v1 = seed + PRIME1 + PRIME2;
+        uint64_t v2 = seed + PRIME2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - PRIME1;
+
+        const byte_t* const limit = end - 32;
+        do {
+            v1 = round(v1, read<uint64_t>(p));
+            v2 = round(v2, read<uint64_t>(p + 8));
+            v3 = round(v3, read<uint64_t>(p + 16));
+            v4 = round(v4, read<uint64_t>(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        hash = rotl(v1, 1U) + rotl(v2, 7U) + rotl(v3, 12U) + rotl(v4, 18U);
+        hash = mergeRound(hash, v1);
+        hash = mergeRound(hash, v2);
+        hash = mergeRound(hash, v3);
+        hash = mergeRound(hash, v4);
+    } else {
+        hash = seed + PRIME5;
+    }
+
+    hash += static_cast<uint64_t>(size);
+
+    while (p + 8 <= end) {
+        hash ^= round(0ULL, read<uint64_t>(p));
+        hash = rotl(hash, 27U) * PRIME1 + PRIME4;
+        p += 8;
+    }
+    if (p + 4 <= end) {
+        hash ^= static_cast<uint64_t>(read<uint32_t>(p)) * PRIME1;
+        hash = rotl(hash, 23U) * PRIME2 + PRIME3;
+        p += 4;
+    }
+    while (p < end) {
+        hash ^= static_cast<uint64_t>(*p) * PRIME5;
+        hash = rotl(hash, 11U) * PRIME1;
+        ++p;
+    }
+
+    // 마지막 비트 섞기
+    hash ^= hash >> 33;
+    hash *= PRIME2;
+    hash ^= hash >> 29;
+    hash *= PRIME3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
\ No newline at end of file
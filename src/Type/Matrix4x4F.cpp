@@ -0,0 +1,229 @@
+#include "Type/Matrix4x4F.hpp"
+#include "Type/SIMD.hpp"
+
+namespace {
+    /// @brief 2x2 소행렬식 (s: 0, 1행 / c: 2, 3행)
+    /// @note Determinant와 스칼라 Inverse가 공유합니다.
+    struct Minors final {
+        float S[6];
+        float C[6];
+    };
+
+    Minors computeMinors(const float (&m)[4][4]) noexcept {
+        Minors minors;
+        minors.S[0] = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+        minors.S[1] = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+        minors.S[2] = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+        minors.S[3] = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+        minors.S[4] = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+        minors.S[5] = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+
+        minors.C[5] = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+        minors.C[4] = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+        minors.C[3] = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+        minors.C[2] = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+        minors.C[1] = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+        minors.C[0] = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+        return minors;
+    }
+
+    float determinant(const Minors& minors) noexcept {
+        const float* s = minors.S;
+        const float* c = minors.C;
+        return s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
+    }
+
+#if defined(NEOXOPS_SIMD_SSE2)
+    // 2x2 행렬을 [m00, m01, m10, m11] 순서로 레지스터 하나에 담아 블록 단위로 역행렬을 구합니다.
+    // M = | A B |  일 때 adj(A), adj(D)를 이용해 4개의 2x2 블록을 각각 계산합니다.
+    //     | C D |
+    #define NEOXOPS_SHUFFLE(a, b, x, y, z, w) _mm_shuffle_ps((a), (b), _MM_SHUFFLE((w), (z), (y), (x)))
+
+    /// @brief 2x2 행렬 곱 (a * b)
+    __m128 mat2Mul(__m128 a, __m128 b) noexcept {
+        return _mm_add_ps(
+            _mm_mul_ps(a, NEOXOPS_SHUFFLE(b, b, 0, 3, 0, 3)),
+            _mm_mul_ps(NEOXOPS_SHUFFLE(a, a, 1, 0, 3, 2), NEOXOPS_SHUFFLE(b, b, 2, 1, 2, 1)));
+    }
+
+    /// @brief 2x2 수반 행렬 곱 (adj(a) * b)
+    __m128 mat2AdjMul(__m128 a, __m128 b) noexcept {
+        return _mm_sub_ps(
+            _mm_mul_ps(NEOXOPS_SHUFFLE(a, a, 3, 3, 0, 0), b),
+            _mm_mul_ps(NEOXOPS_SHUFFLE(a, a, 1, 1, 2, 2), NEOXOPS_SHUFFLE(b, b, 2, 3, 0, 1)));
+    }
+
+    /// @brief 2x2 행렬과 수반 행렬 곱 (a * adj(b))
+    __m128 mat2MulAdj(__m128 a, __m128 b) noexcept {
+        return _mm_sub_ps(
+            _mm_mul_ps(a, NEOXOPS_SHUFFLE(b, b, 3, 0, 3, 0)),
+            _mm_mul_ps(NEOXOPS_SHUFFLE(a, a, 1, 0, 3, 2), NEOXOPS_SHUFFLE(b, b, 2, 1, 2, 1)));
+    }
+#endif
+}
+
+using namespace neoxops;
+
+void Matrix4x4F::Multiply(const Matrix4x4F* src, const Matrix4x4F& rhs, Matrix4x4F* dst, size_t count) noexcept {
+#if defined(NEOXOPS_SIMD_SSE2)
+    const __m128 r0 = _mm_load_ps(rhs.M[0]);
+    const __m128 r1 = _mm_load_ps(rhs.M[1]);
+    const __m128 r2 = _mm_load_ps(rhs.M[2]);
+    const __m128 r3 = _mm_load_ps(rhs.M[3]);
+
+    for (size_t i = 0; i < count; ++i) {
+        for (int32_t row = 0; row < 4; ++row) {
+            __m128 vec = _mm_load_ps(src[i].M[row]);
+            __m128 result = _mm_mul_ps(_mm_shuffle_ps(vec, vec, _MM_SHUFFLE(0, 0, 0, 0)), r0);
+            result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vec, vec, _MM_SHUFFLE(1, 1, 1, 1)), r1));
+            result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vec, vec, _MM_SHUFFLE(2, 2, 2, 2)), r2));
+            result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vec, vec, _MM_SHUFFLE(3, 3, 3, 3)), r3));
+            _mm_store_ps(dst[i].M[row], result);
+        }
+    }
+#else
+    for (size_t i = 0; i < count; ++i) {
+        for (int32_t row = 0; row < 4; ++row) {
+            transformRow(src[i].M[row], rhs, dst[i].M[row]);
+        }
+    }
+#endif
+}
+
+void Matrix4x4F::Transform(const Matrix4x4F& matrix, const Vector4F* src, Vector4F* dst, size_t count) noexcept {
+#if defined(NEOXOPS_SIMD_SSE2)
+    const __m128 r0 = _mm_load_ps(matrix.M[0]);
+    const __m128 r1 = _mm_load_ps(matrix.M[1]);
+    const __m128 r2 = _mm_load_ps(matrix.M[2]);
+    const __m128 r3 = _mm_load_ps(matrix.M[3]);
+
+    for (size_t i = 0; i < count; ++i) {
+        __m128 vec = _mm_load_ps(&src[i].X);
+        __m128 result = _mm_mul_ps(_mm_shuffle_ps(vec, vec, _MM_SHUFFLE(0, 0, 0, 0)), r0);
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vec, vec, _MM_SHUFFLE(1, 1, 1, 1)), r1));
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vec, vec, _MM_SHUFFLE(2, 2, 2, 2)), r2));
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vec, vec, _MM_SHUFFLE(3, 3, 3, 3)), r3));
+        _mm_store_ps(&dst[i].X, result);
+    }
+#else
+    for (size_t i = 0; i < count; ++i) {
+        transformRow(&src[i].X, matrix, &dst[i].X);
+    }
+#endif
+}
+
+void Matrix4x4F::TransformPoints(const Matrix4x4F& matrix, const Vector3F* src, Vector3F* dst, size_t count) noexcept {
+#if defined(NEOXOPS_SIMD_SSE2)
+    const __m128 r0 = _mm_load_ps(matrix.M[0]);
+    const __m128 r1 = _mm_load_ps(matrix.M[1]);
+    const __m128 r2 = _mm_load_ps(matrix.M[2]);
+    const __m128 r3 = _mm_load_ps(matrix.M[3]);
+
+    for (size_t i = 0; i < count; ++i) {
+        // Vector3F는 12바이트라 4성분 로드/저장이 배열 끝을 넘을 수 있으므로 성분 단위로 읽고 씁니다.
+        __m128 result = _mm_mul_ps(_mm_set1_ps(src[i].X), r0);
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(src[i].Y), r1));
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(src[i].Z), r2));
+        result = _mm_add_ps(result, r3);
+        _mm_storel_pi(reinterpret_cast<__m64*>(&dst[i].X), result);
+        _mm_store_ss(&dst[i].Z, _mm_movehl_ps(result, result));
+    }
+#else
+    for (size_t i = 0; i < count; ++i) {
+        alignas(16) float vec[4] = { src[i].X, src[i].Y, src[i].Z, 1.0f };
+        transformRow(vec, matrix, vec);
+
+        dst[i].X = vec[0];
+        dst[i].Y = vec[1];
+        dst[i].Z = vec[2];
+    }
+#endif
+}
+
+float Matrix4x4F::Determinant() const noexcept {
+    return determinant(computeMinors(M));
+}
+
+bool Matrix4x4F::Inverse(Matrix4x4F& result) const noexcept {
+#if defined(NEOXOPS_SIMD_SSE2)
+    const __m128 row0 = _mm_load_ps(M[0]);
+    const __m128 row1 = _mm_load_ps(M[1]);
+    const __m128 row2 = _mm_load_ps(M[2]);
+    const __m128 row3 = _mm_load_ps(M[3]);
+
+    __m128 a = _mm_movelh_ps(row0, row1);
+    __m128 b = _mm_movehl_ps(row1, row0);
+    __m128 c = _mm_movelh_ps(row2, row3);
+    __m128 d = _mm_movehl_ps(row3, row2);
+
+    // |A|, |B|, |C|, |D|
+    __m128 detSub = _mm_sub_ps(
+        _mm_mul_ps(NEOXOPS_SHUFFLE(row0, row2, 0, 2, 0, 2), NEOXOPS_SHUFFLE(row1, row3, 1, 3, 1, 3)),
+        _mm_mul_ps(NEOXOPS_SHUFFLE(row0, row2, 1, 3, 1, 3), NEOXOPS_SHUFFLE(row1, row3, 0, 2, 0, 2)));
+    __m128 detA = NEOXOPS_SHUFFLE(detSub, detSub, 0, 0, 0, 0);
+    __m128 detB = NEOXOPS_SHUFFLE(detSub, detSub, 1, 1, 1, 1);
+    __m128 detC = NEOXOPS_SHUFFLE(detSub, detSub, 2, 2, 2, 2);
+    __m128 detD = NEOXOPS_SHUFFLE(detSub, detSub, 3, 3, 3, 3);
+
+    __m128 dc = mat2AdjMul(d, c);
+    __m128 ab = mat2AdjMul(a, b);
+
+    __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), mat2Mul(b, dc));
+    __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), mat2Mul(c, ab));
+    __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), mat2MulAdj(d, ab));
+    __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), mat2MulAdj(a, dc));
+
+    // |M| = |A||D| + |B||C| - tr(adj(A)B * adj(D)C)
+    __m128 trace = _mm_mul_ps(ab, NEOXOPS_SHUFFLE(dc, dc, 0, 2, 1, 3));
+    trace = _mm_add_ps(trace, _mm_movehl_ps(trace, trace));
+    trace = _mm_add_ss(trace, NEOXOPS_SHUFFLE(trace, trace, 1, 1, 1, 1));
+
+    float det = _mm_cvtss_f32(_mm_sub_ss(_mm_add_ss(_mm_mul_ss(detA, detD), _mm_mul_ss(detB, detC)), trace));
+    if (std::fabs(det) <= 1e-12f) {
+        return false;
+    }
+
+    __m128 invDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), _mm_set1_ps(det));
+    x = _mm_mul_ps(x, invDet);
+    y = _mm_mul_ps(y, invDet);
+    z = _mm_mul_ps(z, invDet);
+    w = _mm_mul_ps(w, invDet);
+
+    _mm_store_ps(result.M[0], NEOXOPS_SHUFFLE(x, y, 3, 1, 3, 1));
+    _mm_store_ps(result.M[1], NEOXOPS_SHUFFLE(x, y, 2, 0, 2, 0));
+    _mm_store_ps(result.M[2], NEOXOPS_SHUFFLE(z, w, 3, 1, 3, 1));
+    _mm_store_ps(result.M[3], NEOXOPS_SHUFFLE(z, w, 2, 0, 2, 0));
+    return true;
+#else
+    Minors minors = computeMinors(M);
+    float det = determinant(minors);
+    if (std::fabs(det) <= 1e-12f) {
+        return false;
+    }
+
+    const float* s = minors.S;
+    const float* c = minors.C;
+    float inv = 1.0f / det;
+
+    result = Matrix4x4F(
+        { ( M[1][1] * c[5] - M[1][2] * c[4] + M[1][3] * c[3]) * inv,
+          (-M[0][1] * c[5] + M[0][2] * c[4] - M[0][3] * c[3]) * inv,
+          ( M[3][1] * s[5] - M[3][2] * s[4] + M[3][3] * s[3]) * inv,
+          (-M[2][1] * s[5] + M[2][2] * s[4] - M[2][3] * s[3]) * inv },
+        { (-M[1][0] * c[5] + M[1][2] * c[2] - M[1][3] * c[1]) * inv,
+          ( M[0][0] * c[5] - M[0][2] * c[2] + M[0][3] * c[1]) * inv,
+          (-M[3][0] * s[5] + M[3][2] * s[2] - M[3][3] * s[1]) * inv,
+          ( M[2][0] * s[5] - M[2][2] * s[2] + M[2][3] * s[1]) * inv },
+        { ( M[1][0] * c[4] - M[1][1] * c[2] + M[1][3] * c[0]) * inv,
+          (-M[0][0] * c[4] + M[0][1] * c[2] - M[0][3] * c[0]) * inv,
+          ( M[3][0] * s[4] - M[3][1] * s[2] + M[3][3] * s[0]) * inv,
+          (-M[2][0] * s[4] + M[2][1] * s[2] - M[2][3] * s[0]) * inv },
+        { (-M[1][0] * c[3] + M[1][1] * c[1] - M[1][2] * c[0]) * inv,
+          ( M[0][0] * c[3] - M[0][1] * c[1] + M[0][2] * c[0]) * inv,
+          (-M[3][0] * s[3] + M[3][1] * s[1] - M[3][2] * s[0]) * inv,
+          ( M[2][0] * s[3] - M[2][1] * s[1] + M[2][2] * s[0]) * inv });
+    return true;
+#endif
+}
+
+#undef NEOXOPS_SHUFFLE
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "Type/QuaternionF.hpp"
+#include "Type/SIMD.hpp"
+
+namespace {
+    /// @brief 사원수 4개를 성분별(SoA)로 처리하는 레인
+    /// @note AoS 배열을 읽을 때 전치(X 4개, Y 4개, ...)하고 쓸 때 되돌립니다. AVX2 빌드도 SSE2 경로를 사용합니다.
+#if defined(NEOXOPS_SIMD_SSE2)
+    struct Lanes final {
+        static constexpr size_t COUNT = 4U;
+        using F = __m128;
+
+        static F Set(float v) noexcept { return _mm_set1_ps(v); }
+        static F Add(F a, F b) noexcept { return _mm_add_ps(a, b); }
+        static F Sub(F a, F b) noexcept { return _mm_sub_ps(a, b); }
+        static F Mul(F a, F b) noexcept { return _mm_mul_ps(a, b); }
+        static F Select(F mask, F a, F b) noexcept { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+        static F CmpLt(F a, F b) noexcept { return _mm_cmplt_ps(a, b); }
+
+        static void Load(const QuaternionF* q, F (&out)[4]) noexcept {
+            out[0] = _mm_load_ps(&q[0].X);
+            out[1] = _mm_load_ps(&q[1].X);
+            out[2] = _mm_load_ps(&q[2].X);
+            out[3] = _mm_load_ps(&q[3].X);
+            _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        }
+
+        static void Store(QuaternionF* q, F (&in)[4]) noexcept {
+            _MM_TRANSPOSE4_PS(in[0], in[1], in[2], in[3]);
+            _mm_store_ps(&q[0].X, in[0]);
+            _mm_store_ps(&q[1].X, in[1]);
+            _mm_store_ps(&q[2].X, in[2]);
+            _mm_store_ps(&q[3].X, in[3]);
+        }
+    };
+#elif defined(NEOXOPS_SIMD_NEON)
+    struct Lanes final {
+        static constexpr size_t COUNT = 4U;
+        using F = float32x4_t;
+
+        static F Set(float v) noexcept { return vdupq_n_f32(v); }
+        static F Add(F a, F b) noexcept { return vaddq_f32(a, b); }
+        static F Sub(F a, F b) noexcept { return vsubq_f32(a, b); }
+        static F Mul(F a, F b) noexcept { return vmulq_f32(a, b); }
+        static F Select(F mask, F a, F b) noexcept { return vbslq_f32(vreinterpretq_u32_f32(mask), a, b); }
+        static F CmpLt(F a, F b) noexcept { return vreinterpretq_f32_u32(vcltq_f32(a, b)); }
+
+        static void Load(const QuaternionF* q, F (&out)[4]) noexcept {
+            float32x4x4_t v = vld4q_f32(&q[0].X);
+            out[0] = v.val[0];
+            out[1] = v.val[1];
+            out[2] = v.val[2];
+            out[3] = v.val[3];
+        }
+
+        static void Store(QuaternionF* q, F (&in)[4]) noexcept {
+            float32x4x4_t v = { { in[0], in[1], in[2], in[3] } };
+            vst4q_f32(&q[0].X, v);
+        }
+    };
+#endif
+}
+
+using namespace neoxops;
+
+void QuaternionF::Slerp(const QuaternionF* start, const QuaternionF* end, float t, QuaternionF* dst, size_t count) noexcept {
+    size_t i = 0;
+
+#if defined(NEOXOPS_SIMD_SSE2) || defined(NEOXOPS_SIMD_NEON)
+    using F = Lanes::F;
+
+    // t에만 의존하는 다항식 계수는 미리 계산합니다. (스칼라 slerpWeight와 같은 값)
+    float startT = 1.0f - t;
+    float startTT = startT * startT;
+    float endTT = t * t;
+
+    F startCoef[8], endCoef[8];
+    for (int32_t k = 0; k < 8; ++k) {
+        startCoef[k] = Lanes::Set(SLERP_U[k] * startTT - SLERP_V[k]);
+        endCoef[k] = Lanes::Set(SLERP_U[k] * endTT - SLERP_V[k]);
+    }
+
+    const F zero = Lanes::Set(0.0f);
+    const F one = Lanes::Set(1.0f);
+    const F minusOne = Lanes::Set(-1.0f);
+
+    for (; i + Lanes::COUNT <= count; i += Lanes::COUNT) {
+        F a[4], b[4];
+        Lanes::Load(start + i, a);
+        Lanes::Load(end + i, b);
+
+        F cosTheta = Lanes::Add(Lanes::Add(Lanes::Add(Lanes::Mul(a[0], b[0]), Lanes::Mul(a[1], b[1])), Lanes::Mul(a[2], b[2])), Lanes::Mul(a[3], b[3]));
+        F sign = Lanes::Select(Lanes::CmpLt(cosTheta, zero), minusOne, one);
+        F cosMinusOne = Lanes::Sub(Lanes::Mul(sign, cosTheta), one);
+
+        F startWeight = one, endWeight = one;
+        for (int32_t k = 7; k >= 0; --k) {
+            startWeight = Lanes::Add(one, Lanes::Mul(Lanes::Mul(startCoef[k], cosMinusOne), startWeight));
+            endWeight = Lanes::Add(one, Lanes::Mul(Lanes::Mul(endCoef[k], cosMinusOne), endWeight));
+        }
+        startWeight = Lanes::Mul(Lanes::Set(startT), startWeight);
+        endWeight = Lanes::Mul(Lanes::Mul(Lanes::Set(t), endWeight), sign);
+
+        for (int32_t c = 0; c < 4; ++c) {
+            a[c] = Lanes::Add(Lanes::Mul(a[c], startWeight), Lanes::Mul(b[c], endWeight));
+        }
+        Lanes::Store(dst + i, a);
+    }
+#endif
+
+    for (; i < count; ++i) {
+        dst[i] = Slerp(start[i], end[i], t);
+    }
+}
\ No newline at end of file
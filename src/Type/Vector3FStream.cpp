@@ -0,0 +1,426 @@
+#include "Type/Vector3FStream.hpp"
+#include "Type/Matrix4x4F.hpp"
+#include "Type/SIMD.hpp"
+#include <cmath>
+
+namespace {
+    /// @brief 한 번에 처리하는 요소 묶음 (레인)
+    /// @note 빌드 대상에 따라 AVX2(8), SSE2(4), NEON(4), 스칼라(1) 중 하나가 선택됩니다.
+    ///       비교 결과(마스크)는 모든 비트가 1(참) 또는 0(거짓)인 F로 표현합니다.
+#if defined(NEOXOPS_SIMD_AVX2)
+    struct Lanes final {
+        static constexpr size_t COUNT = 8U;
+        using F = __m256;
+
+        static F Set(float v) noexcept { return _mm256_set1_ps(v); }
+        static F Load(const float* p) noexcept { return _mm256_loadu_ps(p); }
+        static void Store(float* p, F v) noexcept { _mm256_storeu_ps(p, v); }
+        static F Add(F a, F b) noexcept { return _mm256_add_ps(a, b); }
+        static F Sub(F a, F b) noexcept { return _mm256_sub_ps(a, b); }
+        static F Mul(F a, F b) noexcept { return _mm256_mul_ps(a, b); }
+        static F MulAdd(F a, F b, F c) noexcept { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+        static F Div(F a, F b) noexcept { return _mm256_div_ps(a, b); }
+        static F Sqrt(F a) noexcept { return _mm256_sqrt_ps(a); }
+        static F And(F a, F b) noexcept { return _mm256_and_ps(a, b); }
+        static F CmpGt(F a, F b) noexcept { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+        static F CmpGe(F a, F b) noexcept { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+        static F CmpLe(F a, F b) noexcept { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+        static uint32_t MoveMask(F a) noexcept { return static_cast<uint32_t>(_mm256_movemask_ps(a)); }
+    };
+#elif defined(NEOXOPS_SIMD_SSE2)
+    struct Lanes final {
+        static constexpr size_t COUNT = 4U;
+        using F = __m128;
+
+        static F Set(float v) noexcept { return _mm_set1_ps(v); }
+        static F Load(const float* p) noexcept { return _mm_loadu_ps(p); }
+        static void Store(float* p, F v) noexcept { _mm_storeu_ps(p, v); }
+        static F Add(F a, F b) noexcept { return _mm_add_ps(a, b); }
+        static F Sub(F a, F b) noexcept { return _mm_sub_ps(a, b); }
+        static F Mul(F a, F b) noexcept { return _mm_mul_ps(a, b); }
+        static F MulAdd(F a, F b, F c) noexcept { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+        static F Div(F a, F b) noexcept { return _mm_div_ps(a, b); }
+        static F Sqrt(F a) noexcept { return _mm_sqrt_ps(a); }
+        static F And(F a, F b) noexcept { return _mm_and_ps(a, b); }
+        static F CmpGt(F a, F b) noexcept { return _mm_cmpgt_ps(a, b); }
+        static F CmpGe(F a, F b) noexcept { return _mm_cmpge_ps(a, b); }
+        static F CmpLe(F a, F b) noexcept { return _mm_cmple_ps(a, b); }
+        static uint32_t MoveMask(F a) noexcept { return static_cast<uint32_t>(_mm_movemask_ps(a)); }
+    };
+#elif defined(NEOXOPS_SIMD_NEON)
+    struct Lanes final {
+        static constexpr size_t COUNT = 4U;
+        using F = float32x4_t;
+
+        static F Set(float v) noexcept { return vdupq_n_f32(v); }
+        static F Load(const float* p) noexcept { return vld1q_f32(p); }
+        static void Store(float* p, F v) noexcept { vst1q_f32(p, v); }
+        static F Add(F a, F b) noexcept { return vaddq_f32(a, b); }
+        static F Sub(F a, F b) noexcept { return vsubq_f32(a, b); }
+        static F Mul(F a, F b) noexcept { return vmulq_f32(a, b); }
+        static F MulAdd(F a, F b, F c) noexcept { return vaddq_f32(vmulq_f32(a, b), c); }
+#if defined(__aarch64__) || defined(_M_ARM64)
+        static F Div(F a, F b) noexcept { return vdivq_f32(a, b); }
+        static F Sqrt(F a) noexcept { return vsqrtq_f32(a); }
+#else
+        /// @note ARMv7 NEON에는 나눗셈, 제곱근 명령이 없으므로 역수 추정치를 뉴턴-랩슨 2회로 보정합니다.
+        static F Div(F a, F b) noexcept {
+            F r = vrecpeq_f32(b);
+            r = vmulq_f32(r, vrecpsq_f32(b, r));
+            r = vmulq_f32(r, vrecpsq_f32(b, r));
+            return vmulq_f32(a, r);
+        }
+        static F Sqrt(F a) noexcept {
+            F r = vrsqrteq_f32(a);
+            r = vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(a, r), r));
+            r = vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(a, r), r));
+            return vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(a, vdupq_n_f32(0.0f)), vreinterpretq_u32_f32(vmulq_f32(a, r))));
+        }
+#endif
+        static F And(F a, F b) noexcept { return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+        static F CmpGt(F a, F b) noexcept { return vreinterpretq_f32_u32(vcgtq_f32(a, b)); }
+        static F CmpGe(F a, F b) noexcept { return vreinterpretq_f32_u32(vcgeq_f32(a, b)); }
+        static F CmpLe(F a, F b) noexcept { return vreinterpretq_f32_u32(vcleq_f32(a, b)); }
+        static uint32_t MoveMask(F a) noexcept {
+            const uint32x4_t bits = vshrq_n_u32(vreinterpretq_u32_f32(a), 31);
+            return vgetq_lane_u32(bits, 0) | (vgetq_lane_u32(bits, 1) << 1) | (vgetq_lane_u32(bits, 2) << 2) | (vgetq_lane_u32(bits, 3) << 3);
+        }
+    };
+#else
+    struct Lanes final {
+        static constexpr size_t COUNT = 1U;
+        using F = float;
+
+        static F Set(float v) noexcept { return v; }
+        static F Load(const float* p) noexcept { return *p; }
+        static void Store(float* p, F v) noexcept { *p = v; }
+        static F Add(F a, F b) noexcept { return a + b; }
+        static F Sub(F a, F b) noexcept { return a - b; }
+        static F Mul(F a, F b) noexcept { return a * b; }
+        static F MulAdd(F a, F b, F c) noexcept { return a * b + c; }
+        static F Div(F a, F b) noexcept { return a / b; }
+        static F Sqrt(F a) noexcept { return std::sqrt(a); }
+        static F And(F a, F b) noexcept { return (a != 0.0f) ? b : 0.0f; }
+        static F CmpGt(F a, F b) noexcept { return (a > b) ? 1.0f : 0.0f; }
+        static F CmpGe(F a, F b) noexcept { return (a >= b) ? 1.0f : 0.0f; }
+        static F CmpLe(F a, F b) noexcept { return (a <= b) ? 1.0f : 0.0f; }
+        static uint32_t MoveMask(F a) noexcept { return (a != 0.0f) ? 1U : 0U; }
+    };
+#endif
+
+    constexpr float NORMALIZE_EPSILON = 1e-6f;      ///< Vector3F::Normalize와 같은 길이 하한
+
+    /// @brief 스트림의 크기를 원본에 맞춥니다.
+    /// @param src 원본
+    /// @param dst 대상 (src와 같을 수 있음)
+    inline void matchSize(const Vector3FStream& src, Vector3FStream& dst) noexcept {
+        if (&src != &dst) {
+            dst.Resize(src.GetSize());
+        }
+    }
+}
+
+/// @brief 점을 행렬로 일괄 변환합니다. (w = 1)
+/// @param src 원본
+/// @param matrix 행 우선 4x4 행렬 (v * M, 투영 나눗셈 없음)
+/// @param dst 결과 (src와 같아도 됨)
+void Vector3FStream::Transform(const Vector3FStream& src, const float* matrix, Vector3FStream& dst) noexcept {
+    matchSize(src, dst);
+
+    const size_t count = src.GetSize();
+    const float* sx = src.GetX();
+    const float* sy = src.GetY();
+    const float* sz = src.GetZ();
+    float* dx = dst.GetX();
+    float* dy = dst.GetY();
+    float* dz = dst.GetZ();
+
+    const Lanes::F m00 = Lanes::Set(matrix[0]),  m01 = Lanes::Set(matrix[1]),  m02 = Lanes::Set(matrix[2]);
+    const Lanes::F m10 = Lanes::Set(matrix[4]),  m11 = Lanes::Set(matrix[5]),  m12 = Lanes::Set(matrix[6]);
+    const Lanes::F m20 = Lanes::Set(matrix[8]),  m21 = Lanes::Set(matrix[9]),  m22 = Lanes::Set(matrix[10]);
+    const Lanes::F m30 = Lanes::Set(matrix[12]), m31 = Lanes::Set(matrix[13]), m32 = Lanes::Set(matrix[14]);
+
+    size_t i = 0U;
+    for (; i + Lanes::COUNT <= count; i += Lanes::COUNT) {
+        const Lanes::F x = Lanes::Load(sx + i);
+        const Lanes::F y = Lanes::Load(sy + i);
+        const Lanes::F z = Lanes::Load(sz + i);
+
+        Lanes::Store(dx + i, Lanes::MulAdd(x, m00, Lanes::MulAdd(y, m10, Lanes::MulAdd(z, m20, m30))));
+        Lanes::Store(dy + i, Lanes::MulAdd(x, m01, Lanes::MulAdd(y, m11, Lanes::MulAdd(z, m21, m31))));
+        Lanes::Store(dz + i, Lanes::MulAdd(x, m02, Lanes::MulAdd(y, m12, Lanes::MulAdd(z, m22, m32))));
+    }
+
+    for (; i < count; ++i) {
+        const float x = sx[i], y = sy[i], z = sz[i];
+        dx[i] = x * matrix[0] + (y * matrix[4] + (z * matrix[8]  + matrix[12]));
+        dy[i] = x * matrix[1] + (y * matrix[5] + (z * matrix[9]  + matrix[13]));
+        dz[i] = x * matrix[2] + (y * matrix[6] + (z * matrix[10] + matrix[14]));
+    }
+}
+
+/// @brief 방향 벡터를 행렬로 일괄 변환합니다. (w = 0, 이동 성분 무시)
+/// @param src 원본
+/// @param matrix 행 우선 4x4 행렬 (v * M)
+/// @param dst 결과 (src와 같아도 됨)
+/// @note 비균등 스케일이 있는 행렬이라면 역전치 행렬을 넘겨야 법선이 올바르게 변환됩니다.
+void Vector3FStream::TransformNormal(const Vector3FStream& src, const float* matrix, Vector3FStream& dst) noexcept {
+    matchSize(src, dst);
+
+    const size_t count = src.GetSize();
+    const float* sx = src.GetX();
+    const float* sy = src.GetY();
+    const float* sz = src.GetZ();
+    float* dx = dst.GetX();
+    float* dy = dst.GetY();
+    float* dz = dst.GetZ();
+
+    const Lanes::F m00 = Lanes::Set(matrix[0]),  m01 = Lanes::Set(matrix[1]),  m02 = Lanes::Set(matrix[2]);
+    const Lanes::F m10 = Lanes::Set(matrix[4]),  m11 = Lanes::Set(matrix[5]),  m12 = Lanes::Set(matrix[6]);
+    const Lanes::F m20 = Lanes::Set(matrix[8]),  m21 = Lanes::Set(matrix[9]),  m22 = Lanes::Set(matrix[10]);
+
+    size_t i = 0U;
+    for (; i + Lanes::COUNT <= count; i += Lanes::COUNT) {
+        const Lanes::F x = Lanes::Load(sx + i);
+        const Lanes::F y = Lanes::Load(sy + i);
+        const Lanes::F z = Lanes::Load(sz + i);
+
+        Lanes::Store(dx + i, Lanes::MulAdd(x, m00, Lanes::MulAdd(y, m10, Lanes::Mul(z, m20))));
+        Lanes::Store(dy + i, Lanes::MulAdd(x, m01, Lanes::MulAdd(y, m11, Lanes::Mul(z, m21))));
+        Lanes::Store(dz + i, Lanes::MulAdd(x, m02, Lanes::MulAdd(y, m12, Lanes::Mul(z, m22))));
+    }
+
+    for (; i < count; ++i) {
+        const float x = sx[i], y = sy[i], z = sz[i];
+        dx[i] = x * matrix[0] + (y * matrix[4] + z * matrix[8]);
+        dy[i] = x * matrix[1] + (y * matrix[5] + z * matrix[9]);
+        dz[i] = x * matrix[2] + (y * matrix[6] + z * matrix[10]);
+    }
+}
+
+/// @brief 점을 행렬로 일괄 변환합니다. (w = 1)
+/// @param src 원본
+/// @param matrix 변환 행렬
+/// @param dst 결과 (src와 같아도 됨)
+void Vector3FStream::Transform(const Vector3FStream& src, const Matrix4x4F& matrix, Vector3FStream& dst) noexcept {
+    Transform(src, matrix.GetData(), dst);
+}
+
+/// @brief 방향 벡터를 행렬로 일괄 변환합니다. (w = 0, 이동 성분 무시)
+/// @param src 원본
+/// @param matrix 변환 행렬
+/// @param dst 결과 (src와 같아도 됨)
+void Vector3FStream::TransformNormal(const Vector3FStream& src, const Matrix4x4F& matrix, Vector3FStream& dst) noexcept {
+    TransformNormal(src, matrix.GetData(), dst);
+}
+
+/// @brief 일괄 정규화합니다.
+/// @param src 원본
+/// @param dst 결과 (src와 같아도 됨)
+/// @note Vector3F::Normalize와 같이 길이가 1e-6 이하인 요소는 Zero가 됩니다.
+void Vector3FStream::Normalize(const Vector3FStream& src, Vector3FStream& dst) noexcept {
+    matchSize(src, dst);
+
+    const size_t count = src.GetSize();
+    const float* sx = src.GetX();
+    const float* sy = src.GetY();
+    const float* sz = src.GetZ();
+    float* dx = dst.GetX();
+    float* dy = dst.GetY();
+    float* dz = dst.GetZ();
+
+    const Lanes::F epsilon = Lanes::Set(NORMALIZE_EPSILON);
+
+    size_t i = 0U;
+    for (; i + Lanes::COUNT <= count; i += Lanes::COUNT) {
+        const Lanes::F x = Lanes::Load(sx + i);
+        const Lanes::F y = Lanes::Load(sy + i);
+        const Lanes::F z = Lanes::Load(sz + i);
+
+        const Lanes::F length = Lanes::Sqrt(Lanes::MulAdd(x, x, Lanes::MulAdd(y, y, Lanes::Mul(z, z))));
+        const Lanes::F valid = Lanes::CmpGt(length, epsilon);
+
+        // 짧은 벡터의 0 나눗셈 결과는 마스크로 지움
+        Lanes::Store(dx + i, Lanes::And(valid, Lanes::Div(x, length)));
+        Lanes::Store(dy + i, Lanes::And(valid, Lanes::Div(y, length)));
+        Lanes::Store(dz + i, Lanes::And(valid, Lanes::Div(z, length)));
+    }
+
+    for (; i < count; ++i) {
+        const float x = sx[i], y = sy[i], z = sz[i];
+        const float length = std::sqrt(x * x + (y * y + z * z));
+        const bool valid = (length > NORMALIZE_EPSILON);
+
+        dx[i] = valid ? x / length : 0.0f;
+        dy[i] = valid ? y / length : 0.0f;
+        dz[i] = valid ? z / length : 0.0f;
+    }
+}
+
+/// @brief 요소별 내적을 일괄 계산합니다.
+/// @param lhs 스트림
+/// @param rhs 스트림 (lhs와 같은 크기)
+/// @param out 결과 배열 (lhs.GetSize()개)
+void Vector3FStream::Dot(const Vector3FStream& lhs, const Vector3FStream& rhs, float* out) noexcept {
+    const size_t count = lhs.GetSize();
+    const float* ax = lhs.GetX();
+    const float* ay = lhs.GetY();
+    const float* az = lhs.GetZ();
+    const float* bx = rhs.GetX();
+    const float* by = rhs.GetY();
+    const float* bz = rhs.GetZ();
+
+    size_t i = 0U;
+    for (; i + Lanes::COUNT <= count; i += Lanes::COUNT) {
+        Lanes::Store(out + i, Lanes::MulAdd(Lanes::Load(ax + i), Lanes::Load(bx + i),
+                              Lanes::MulAdd(Lanes::Load(ay + i), Lanes::Load(by + i),
+                              Lanes::Mul(Lanes::Load(az + i), Lanes::Load(bz + i)))));
+    }
+
+    for (; i < count; ++i) {
+        out[i] = ax[i] * bx[i] + (ay[i] * by[i] + az[i] * bz[i]);
+    }
+}
+
+/// @brief 모든 요소와 한 벡터의 내적을 일괄 계산합니다.
+/// @param lhs 스트림
+/// @param rhs Vector3F
+/// @param out 결과 배열 (lhs.GetSize()개)
+/// @note 시야각 판정(전방 벡터와의 내적) 등에 사용합니다.
+void Vector3FStream::Dot(const Vector3FStream& lhs, const Vector3F& rhs, float* out) noexcept {
+    const size_t count = lhs.GetSize();
+    const float* ax = lhs.GetX();
+    const float* ay = lhs.GetY();
+    const float* az = lhs.GetZ();
+
+    const Lanes::F bx = Lanes::Set(rhs.X);
+    const Lanes::F by = Lanes::Set(rhs.Y);
+    const Lanes::F bz = Lanes::Set(rhs.Z);
+
+    size_t i = 0U;
+    for (; i + Lanes::COUNT <= count; i += Lanes::COUNT) {
+        Lanes::Store(out + i, Lanes::MulAdd(Lanes::Load(ax + i), bx,
+                              Lanes::MulAdd(Lanes::Load(ay + i), by,
+                              Lanes::Mul(Lanes::Load(az + i), bz))));
+    }
+
+    for (; i < count; ++i) {
+        out[i] = ax[i] * rhs.X + (ay[i] * rhs.Y + az[i] * rhs.Z);
+    }
+}
+
+/// @brief 모든 요소와 한 점 사이의 거리 제곱을 일괄 계산합니다.
+/// @param points 스트림
+/// @param point 점
+/// @param out 결과 배열 (points.GetSize()개)
+void Vector3FStream::DistanceSquared(const Vector3FStream& points, const Vector3F& point, float* out) noexcept {
+    const size_t count = points.GetSize();
+    const float* px = points.GetX();
+    const float* py = points.GetY();
+    const float* pz = points.GetZ();
+
+    const Lanes::F cx = Lanes::Set(point.X);
+    const Lanes::F cy = Lanes::Set(point.Y);
+    const Lanes::F cz = Lanes::Set(point.Z);
+
+    size_t i = 0U;
+    for (; i + Lanes::COUNT <= count; i += Lanes::COUNT) {
+        const Lanes::F dx = Lanes::Sub(Lanes::Load(px + i), cx);
+        const Lanes::F dy = Lanes::Sub(Lanes::Load(py + i), cy);
+        const Lanes::F dz = Lanes::Sub(Lanes::Load(pz + i), cz);
+
+        Lanes::Store(out + i, Lanes::MulAdd(dx, dx, Lanes::MulAdd(dy, dy, Lanes::Mul(dz, dz))));
+    }
+
+    for (; i < count; ++i) {
+        const float dx = px[i] - point.X;
+        const float dy = py[i] - point.Y;
+        const float dz = pz[i] - point.Z;
+
+        out[i] = dx * dx + (dy * dy + dz * dz);
+    }
+}
+
+/// @brief 요소별로 다른 스트림의 배수를 더합니다. (dst += src * scale)
+/// @param dst 대상
+/// @param src 더할 스트림 (dst와 같은 크기)
+/// @param scale 배수
+/// @note 위치 += 속도 * dt 같은 적분에 사용합니다.
+void Vector3FStream::AddScaled(Vector3FStream& dst, const Vector3FStream& src, float scale) noexcept {
+    const size_t count = dst.GetSize();
+    float* dx = dst.GetX();
+    float* dy = dst.GetY();
+    float* dz = dst.GetZ();
+    const float* sx = src.GetX();
+    const float* sy = src.GetY();
+    const float* sz = src.GetZ();
+
+    const Lanes::F s = Lanes::Set(scale);
+
+    size_t i = 0U;
+    for (; i + Lanes::COUNT <= count; i += Lanes::COUNT) {
+        Lanes::Store(dx + i, Lanes::MulAdd(Lanes::Load(sx + i), s, Lanes::Load(dx + i)));
+        Lanes::Store(dy + i, Lanes::MulAdd(Lanes::Load(sy + i), s, Lanes::Load(dy + i)));
+        Lanes::Store(dz + i, Lanes::MulAdd(Lanes::Load(sz + i), s, Lanes::Load(dz + i)));
+    }
+
+    for (; i < count; ++i) {
+        dx[i] = sx[i] * scale + dx[i];
+        dy[i] = sy[i] * scale + dy[i];
+        dz[i] = sz[i] * scale + dz[i];
+    }
+}
+
+/// @brief 각 요소가 AABB 안에 있는지 일괄 판정합니다.
+/// @param points 스트림
+/// @param min AABB 최솟값
+/// @param max AABB 최댓값
+/// @param out 결과 배열 (points.GetSize()개, 안(1), 밖(0), nullptr이면 개수만 셈)
+/// @return AABB 안에 있는 요소 수
+/// @note 경계 위의 점은 안으로 판정합니다.
+size_t Vector3FStream::ContainedInAABB(const Vector3FStream& points, const Vector3F& min, const Vector3F& max, byte_t* out) noexcept {
+    const size_t count = points.GetSize();
+    const float* px = points.GetX();
+    const float* py = points.GetY();
+    const float* pz = points.GetZ();
+
+    const Lanes::F minX = Lanes::Set(min.X), minY = Lanes::Set(min.Y), minZ = Lanes::Set(min.Z);
+    const Lanes::F maxX = Lanes::Set(max.X), maxY = Lanes::Set(max.Y), maxZ = Lanes::Set(max.Z);
+
+    size_t inside = 0U;
+    size_t i = 0U;
+    for (; i + Lanes::COUNT <= count; i += Lanes::COUNT) {
+        const Lanes::F x = Lanes::Load(px + i);
+        const Lanes::F y = Lanes::Load(py + i);
+        const Lanes::F z = Lanes::Load(pz + i);
+
+        Lanes::F mask = Lanes::And(Lanes::CmpGe(x, minX), Lanes::CmpLe(x, maxX));
+        mask = Lanes::And(mask, Lanes::And(Lanes::CmpGe(y, minY), Lanes::CmpLe(y, maxY)));
+        mask = Lanes::And(mask, Lanes::And(Lanes::CmpGe(z, minZ), Lanes::CmpLe(z, maxZ)));
+
+        const uint32_t bits = Lanes::MoveMask(mask);
+        if (out) {
+            for (size_t lane = 0U; lane < Lanes::COUNT; ++lane) {
+                out[i + lane] = static_cast<byte_t>((bits >> lane) & 1U);
+            }
+        }
+
+        for (uint32_t remain = bits; remain != 0U; remain &= remain - 1U) {
+            ++inside;
+        }
+    }
+
+    for (; i < count; ++i) {
+        const bool contained =
+            (px[i] >= min.X && px[i] <= max.X) &&
+            (py[i] >= min.Y && py[i] <= max.Y) &&
+            (pz[i] >= min.Z && pz[i] <= max.Z);
+
+        if (out) {
+            out[i] = contained ? 1U : 0U;
+        }
+        inside += contained ? 1U : 0U;
+    }
+
+    return inside;
+}
\ No newline at end of file
@@ -1,12 +1,23 @@
-#include "System/Application.hpp"
-
-int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
-    system::Application app;
-    if (!app.Initialize(hInstance)) {
-        return 1;
-    }
-
-    app.Run();
-
-    return 0;
-}
\ No newline at end of file
+#if defined(_WIN32)
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <cstring>
+#include "System/Application.hpp"
+
+int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR lpCmdLine, int) {
+    system::ApplicationDesc desc;
+    desc.Instance   = hInstance;
+    desc.Headless   = (lpCmdLine && std::strstr(lpCmdLine, "--headless") != nullptr);
+
+    system::Application app;
+    if (!app.Initialize(desc)) {
+        return 1;
+    }
+
+    app.Run();
+
+    return 0;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,855 @@
+#include "World/BlockCollision.hpp"
+#include "Type/SIMD.hpp"
+#include <algorithm>
+#include <bit>
+#include <cfloat>
+#include <cmath>
+
+using namespace world;
+
+namespace {
+    /// @brief 4개씩 처리하는 레인
+    /// @note BVH 노드와 리프 묶음이 4개 단위이므로 AVX2 빌드에서도 SSE2(4) 경로를 사용합니다.
+    ///       비교 결과(마스크)는 모든 비트가 1(참) 또는 0(거짓)인 F로 표현합니다.
+#if defined(NEOXOPS_SIMD_SSE2)
+    struct Lanes4 final {
+        using F = __m128;
+
+        static F Set(float v) noexcept { return _mm_set1_ps(v); }
+        static F Load(const float* p) noexcept { return _mm_load_ps(p); }
+        static void Store(float* p, F v) noexcept { _mm_store_ps(p, v); }
+        static F Add(F a, F b) noexcept { return _mm_add_ps(a, b); }
+        static F Sub(F a, F b) noexcept { return _mm_sub_ps(a, b); }
+        static F Mul(F a, F b) noexcept { return _mm_mul_ps(a, b); }
+        static F Div(F a, F b) noexcept { return _mm_div_ps(a, b); }
+        static F Min(F a, F b) noexcept { return _mm_min_ps(a, b); }
+        static F Max(F a, F b) noexcept { return _mm_max_ps(a, b); }
+        static F Abs(F a) noexcept { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+        static F And(F a, F b) noexcept { return _mm_and_ps(a, b); }
+        static F CmpGt(F a, F b) noexcept { return _mm_cmpgt_ps(a, b); }
+        static F CmpGe(F a, F b) noexcept { return _mm_cmpge_ps(a, b); }
+        static F CmpLe(F a, F b) noexcept { return _mm_cmple_ps(a, b); }
+        static F CmpLt(F a, F b) noexcept { return _mm_cmplt_ps(a, b); }
+        static uint32_t MoveMask(F a) noexcept { return static_cast<uint32_t>(_mm_movemask_ps(a)); }
+    };
+#elif defined(NEOXOPS_SIMD_NEON)
+    struct Lanes4 final {
+        using F = float32x4_t;
+
+        static F Set(float v) noexcept { return vdupq_n_f32(v); }
+        static F Load(const float* p) noexcept { return vld1q_f32(p); }
+        static void Store(float* p, F v) noexcept { vst1q_f32(p, v); }
+        static F Add(F a, F b) noexcept { return vaddq_f32(a, b); }
+        static F Sub(F a, F b) noexcept { return vsubq_f32(a, b); }
+        static F Mul(F a, F b) noexcept { return vmulq_f32(a, b); }
+#if defined(__aarch64__) || defined(_M_ARM64)
+        static F Div(F a, F b) noexcept { return vdivq_f32(a, b); }
+#else
+        /// @note ARMv7 NEON에는 나눗셈 명령이 없으므로 역수 추정치를 뉴턴-랩슨 2회로 보정합니다.
+        static F Div(F a, F b) noexcept {
+            F r = vrecpeq_f32(b);
+            r = vmulq_f32(r, vrecpsq_f32(b, r));
+            r = vmulq_f32(r, vrecpsq_f32(b, r));
+            return vmulq_f32(a, r);
+        }
+#endif
+        static F Min(F a, F b) noexcept { return vminq_f32(a, b); }
+        static F Max(F a, F b) noexcept { return vmaxq_f32(a, b); }
+        static F Abs(F a) noexcept { return vabsq_f32(a); }
+        static F And(F a, F b) noexcept { return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+        static F CmpGt(F a, F b) noexcept { return vreinterpretq_f32_u32(vcgtq_f32(a, b)); }
+        static F CmpGe(F a, F b) noexcept { return vreinterpretq_f32_u32(vcgeq_f32(a, b)); }
+        static F CmpLe(F a, F b) noexcept { return vreinterpretq_f32_u32(vcleq_f32(a, b)); }
+        static F CmpLt(F a, F b) noexcept { return vreinterpretq_f32_u32(vcltq_f32(a, b)); }
+        static uint32_t MoveMask(F a) noexcept {
+            const uint32x4_t bits = vshrq_n_u32(vreinterpretq_u32_f32(a), 31);
+            return vgetq_lane_u32(bits, 0) | (vgetq_lane_u32(bits, 1) << 1) | (vgetq_lane_u32(bits, 2) << 2) | (vgetq_lane_u32(bits, 3) << 3);
+        }
+    };
+#else
+    struct Lanes4 final {
+        struct F final {
+            float V[4];
+        };
+
+        template <typename Function>
+        static F apply(F a, F b, Function function) noexcept {
+            return { { function(a.V[0], b.V[0]), function(a.V[1], b.V[1]), function(a.V[2], b.V[2]), function(a.V[3], b.V[3]) } };
+        }
+        static float mask(bool value) noexcept { return value ? 1.0f : 0.0f; }
+
+        static F Set(float v) noexcept { return { { v, v, v, v } }; }
+        static F Load(const float* p) noexcept { return { { p[0], p[1], p[2], p[3] } }; }
+        static void Store(float* p, F v) noexcept { std::copy(v.V, v.V + 4, p); }
+        static F Add(F a, F b) noexcept { return apply(a, b, [](float x, float y) { return x + y; }); }
+        static F Sub(F a, F b) noexcept { return apply(a, b, [](float x, float y) { return x - y; }); }
+        static F Mul(F a, F b) noexcept { return apply(a, b, [](float x, float y) { return x * y; }); }
+        static F Div(F a, F b) noexcept { return apply(a, b, [](float x, float y) { return x / y; }); }
+        static F Min(F a, F b) noexcept { return apply(a, b, [](float x, float y) { return (x < y) ? x : y; }); }
+        static F Max(F a, F b) noexcept { return apply(a, b, [](float x, float y) { return (x > y) ? x : y; }); }
+        static F Abs(F a) noexcept { return apply(a, a, [](float x, float) { return std::fabs(x); }); }
+        static F And(F a, F b) noexcept { return apply(a, b, [](float x, float y) { return (x != 0.0f) ? y : 0.0f; }); }
+        static F CmpGt(F a, F b) noexcept { return apply(a, b, [](float x, float y) { return mask(x > y); }); }
+        static F CmpGe(F a, F b) noexcept { return apply(a, b, [](float x, float y) { return mask(x >= y); }); }
+        static F CmpLe(F a, F b) noexcept { return apply(a, b, [](float x, float y) { return mask(x <= y); }); }
+        static F CmpLt(F a, F b) noexcept { return apply(a, b, [](float x, float y) { return mask(x < y); }); }
+        static uint32_t MoveMask(F a) noexcept {
+            return ((a.V[0] != 0.0f) ? 1U : 0U) | ((a.V[1] != 0.0f) ? 2U : 0U) | ((a.V[2] != 0.0f) ? 4U : 0U) | ((a.V[3] != 0.0f) ? 8U : 0U);
+        }
+    };
+#endif
+
+    using L = Lanes4;
+
+    constexpr uint32_t LEAF_SIZE        = 4U;           ///< 리프당 최대 삼각형 수
+    constexpr uint32_t BIN_COUNT        = 12U;          ///< SAH 구간 수
+    constexpr float DET_EPSILON         = 1e-9f;        ///< 광선과 평행한 삼각형 판정 값
+    constexpr float DIRECTION_EPSILON   = 1e-6f;        ///< 방향 벡터 길이 하한 (Vector3F::Normalize와 같음)
+
+    /// @brief 경계 상자
+    struct Bounds final {
+        Vector3F Min = { FLT_MAX, FLT_MAX, FLT_MAX };
+        Vector3F Max = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+        void Grow(const Vector3F& point) noexcept {
+            Min = Vector3F::Min(Min, point);
+            Max = Vector3F::Max(Max, point);
+        }
+        void Grow(const Bounds& bounds) noexcept {
+            Min = Vector3F::Min(Min, bounds.Min);
+            Max = Vector3F::Max(Max, bounds.Max);
+        }
+
+        /// @brief 표면적의 절반 (SAH 비용 비교용)
+        float GetHalfArea() const noexcept {
+            if (Min.X > Max.X) {
+                return 0.0f;
+            }
+            const Vector3F extent = Max - Min;
+            return extent.X * extent.Y + extent.Y * extent.Z + extent.Z * extent.X;
+        }
+    };
+
+    /// @brief 구성 중인 삼각형
+    struct BuildTriangle final {
+        Vector3F A, B, C;                   ///< 꼭짓점
+        Vector3F Center;                    ///< 경계 상자 중심
+        Bounds Box;                         ///< 경계 상자
+        uint16_t Block;                     ///< 블록 인덱스
+        uint8_t Face;                       ///< 면 인덱스
+    };
+
+    /// @brief 벡터의 성분을 취득합니다.
+    inline float getAxis(const Vector3F& vec, uint32_t axis) noexcept {
+        return (axis == 0U) ? vec.X : ((axis == 1U) ? vec.Y : vec.Z);
+    }
+
+    /// @brief 방향 성분의 역수를 취득합니다. (0에 가까우면 부호를 유지한 큰 값)
+    inline float safeInverse(float value) noexcept {
+        return (std::fabs(value) > 1e-20f) ? 1.0f / value : std::copysign(1e20f, value);
+    }
+
+    /// @brief 4갈래 BVH 구성기
+    struct Builder final {
+        std::vector<BuildTriangle>& Triangles;
+        std::vector<BlockCollision::Node>& Nodes;
+        std::vector<BlockCollision::TriangleGroup>& Groups;
+
+        /// @brief 범위의 경계 상자를 구합니다.
+        Bounds getBounds(uint32_t begin, uint32_t end) const noexcept {
+            Bounds bounds;
+            for (uint32_t i = begin; i < end; ++i) {
+                bounds.Grow(Triangles[i].Box);
+            }
+            return bounds;
+        }
+
+        /// @brief 범위를 중심 좌표의 가운데에서 개수로 반씩 나눕니다.
+        uint32_t splitMedian(uint32_t begin, uint32_t end, uint32_t axis) noexcept {
+            const uint32_t mid = begin + (end - begin) / 2U;
+            std::nth_element(Triangles.begin() + begin, Triangles.begin() + mid, Triangles.begin() + end, [axis](const BuildTriangle& lhs, const BuildTriangle& rhs) noexcept {
+                return getAxis(lhs.Center, axis) < getAxis(rhs.Center, axis);
+            });
+            return mid;
+        }
+
+        /// @brief 범위를 SAH 비용이 가장 작은 위치에서 둘로 나눕니다.
+        /// @return 나눈 위치 (앞쪽 범위의 끝)
+        uint32_t split(uint32_t begin, uint32_t end, uint32_t depth) noexcept {
+            Bounds centers;
+            for (uint32_t i = begin; i < end; ++i) {
+                centers.Grow(Triangles[i].Center);
+            }
+            const Vector3F extent = centers.Max - centers.Min;
+            const uint32_t longest = (extent.X >= extent.Y && extent.X >= extent.Z) ? 0U : ((extent.Y >= extent.Z) ? 1U : 2U);
+            if (depth >= BlockCollision::MAX_DEPTH / 2U) {
+                return splitMedian(begin, end, longest);
+            }
+
+            float bestCost = FLT_MAX;
+            uint32_t bestAxis = 0U, bestBin = 0U;
+            for (uint32_t axis = 0U; axis < 3U; ++axis) {
+                const float axisMin = getAxis(centers.Min, axis);
+                const float axisExtent = getAxis(extent, axis);
+                if (axisExtent <= 1e-6f) {
+                    continue;
+                }
+
+                const float scale = static_cast<float>(BIN_COUNT) / axisExtent;
+                Bounds bins[BIN_COUNT];
+                uint32_t counts[BIN_COUNT] = {};
+                for (uint32_t i = begin; i < end; ++i) {
+                    const uint32_t bin = std::min(static_cast<uint32_t>((getAxis(Triangles[i].Center, axis) - axisMin) * scale), BIN_COUNT - 1U);
+                    bins[bin].Grow(Triangles[i].Box);
+                    ++counts[bin];
+                }
+
+                // 오른쪽에서부터 누적한 넓이와 개수
+                float rightArea[BIN_COUNT];
+                uint32_t rightCount[BIN_COUNT];
+                Bounds right;
+                uint32_t count = 0U;
+                for (uint32_t bin = BIN_COUNT - 1U; bin > 0U; --bin) {
+                    right.Grow(bins[bin]);
+                    count += counts[bin];
+                    rightArea[bin] = right.GetHalfArea();
+                    rightCount[bin] = count;
+                }
+
+                Bounds left;
+                count = 0U;
+                for (uint32_t bin = 1U; bin < BIN_COUNT; ++bin) {
+                    left.Grow(bins[bin - 1U]);
+                    count += counts[bin - 1U];
+                    if (count == 0U || rightCount[bin] == 0U) {
+                        continue;
+                    }
+                    const float cost = left.GetHalfArea() * static_cast<float>(count) + rightArea[bin] * static_cast<float>(rightCount[bin]);
+                    if (cost < bestCost) {
+                        bestCost = cost;
+                        bestAxis = axis;
+                        bestBin = bin;
+                    }
+                }
+            }
+
+            if (bestCost == FLT_MAX) {
+                return splitMedian(begin, end, longest);
+            }
+
+            const float axisMin = getAxis(centers.Min, bestAxis);
+            const float scale = static_cast<float>(BIN_COUNT) / getAxis(extent, bestAxis);
+            const auto middle = std::partition(Triangles.begin() + begin, Triangles.begin() + end, [=](const BuildTriangle& triangle) noexcept {
+                return std::min(static_cast<uint32_t>((getAxis(triangle.Center, bestAxis) - axisMin) * scale), BIN_COUNT - 1U) < bestBin;
+            });
+            const uint32_t mid = static_cast<uint32_t>(middle - Triangles.begin());
+            return (mid == begin || mid == end) ? splitMedian(begin, end, longest) : mid;
+        }
+
+        /// @brief 리프 삼각형 묶음을 만듭니다.
+        /// @return 묶음 인덱스
+        uint32_t makeLeaf(uint32_t begin, uint32_t end) noexcept {
+            BlockCollision::TriangleGroup group = {};
+            group.Count = end - begin;
+            for (uint32_t i = 0U; i < group.Count; ++i) {
+                const BuildTriangle& triangle = Triangles[begin + i];
+                const Vector3F e1 = triangle.B - triangle.A;
+                const Vector3F e2 = triangle.C - triangle.A;
+                group.V0X[i] = triangle.A.X;
+                group.V0Y[i] = triangle.A.Y;
+                group.V0Z[i] = triangle.A.Z;
+                group.E1X[i] = e1.X;
+                group.E1Y[i] = e1.Y;
+                group.E1Z[i] = e1.Z;
+                group.E2X[i] = e2.X;
+                group.E2Y[i] = e2.Y;
+                group.E2Z[i] = e2.Z;
+                group.Block[i] = triangle.Block;
+                group.Face[i] = triangle.Face;
+            }
+            Groups.push_back(group);
+            return static_cast<uint32_t>(Groups.size() - 1U);
+        }
+
+        /// @brief 범위로 노드를 만듭니다.
+        /// @return 노드 인덱스
+        /// @note 이진 SAH 분할을 두 번 거쳐 자식을 최대 4개 만들고, 삼각형이 LEAF_SIZE개 이하인 자식은 리프가 됩니다.
+        uint32_t build(uint32_t begin, uint32_t end, uint32_t depth) noexcept {
+            uint32_t ranges[4][2] = { { begin, end } };
+            uint32_t rangeCount = 1U;
+            while (rangeCount < 4U) {
+                // 더 나눌 수 있는 범위 중 표면적이 가장 큰 것을 나눕니다.
+                uint32_t target = 4U;
+                float targetArea = -1.0f;
+                for (uint32_t i = 0U; i < rangeCount; ++i) {
+                    if (ranges[i][1] - ranges[i][0] <= LEAF_SIZE) {
+                        continue;
+                    }
+                    const float area = getBounds(ranges[i][0], ranges[i][1]).GetHalfArea();
+                    if (area > targetArea) {
+                        targetArea = area;
+                        target = i;
+                    }
+                }
+                if (target == 4U) {
+                    break;
+                }
+
+                const uint32_t mid = split(ranges[target][0], ranges[target][1], depth);
+                ranges[rangeCount][0] = mid;
+                ranges[rangeCount][1] = ranges[target][1];
+                ranges[target][1] = mid;
+                ++rangeCount;
+            }
+
+            const uint32_t index = static_cast<uint32_t>(Nodes.size());
+            Nodes.push_back({});
+            for (uint32_t i = 0U; i < 4U; ++i) {
+                uint32_t child = BlockCollision::NO_CHILD;
+                Bounds bounds;
+                bounds.Min = bounds.Max = Vector3F::Zero();
+                if (i < rangeCount) {
+                    bounds = getBounds(ranges[i][0], ranges[i][1]);
+                    child = (ranges[i][1] - ranges[i][0] <= LEAF_SIZE) ?
+                        (BlockCollision::LEAF_FLAG | makeLeaf(ranges[i][0], ranges[i][1])) :
+                        build(ranges[i][0], ranges[i][1], depth + 1U);
+                }
+
+                BlockCollision::Node& node = Nodes[index];
+                node.MinX[i] = bounds.Min.X;
+                node.MinY[i] = bounds.Min.Y;
+                node.MinZ[i] = bounds.Min.Z;
+                node.MaxX[i] = bounds.Max.X;
+                node.MaxY[i] = bounds.Max.Y;
+                node.MaxZ[i] = bounds.Max.Z;
+                node.Child[i] = child;
+            }
+            Nodes[index].ChildCount = rangeCount;
+            return index;
+        }
+    };
+
+    /// @brief 삼각형 위에서 점과 가장 가까운 점을 구합니다.
+    /// @note Ericson, Real-Time Collision Detection 5.1.5
+    Vector3F closestPointTriangle(const Vector3F& p, const Vector3F& a, const Vector3F& b, const Vector3F& c) noexcept {
+        const Vector3F ab = b - a;
+        const Vector3F ac = c - a;
+        const Vector3F ap = p - a;
+        const float d1 = Vector3F::Dot(ab, ap);
+        const float d2 = Vector3F::Dot(ac, ap);
+        if (d1 <= 0.0f && d2 <= 0.0f) {
+            return a;
+        }
+
+        const Vector3F bp = p - b;
+        const float d3 = Vector3F::Dot(ab, bp);
+        const float d4 = Vector3F::Dot(ac, bp);
+        if (d3 >= 0.0f && d4 <= d3) {
+            return b;
+        }
+
+        const float vc = d1 * d4 - d3 * d2;
+        if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+            return a + ab * (d1 / (d1 - d3));
+        }
+
+        const Vector3F cp = p - c;
+        const float d5 = Vector3F::Dot(ab, cp);
+        const float d6 = Vector3F::Dot(ac, cp);
+        if (d6 >= 0.0f && d5 <= d6) {
+            return c;
+        }
+
+        const float vb = d5 * d2 - d1 * d6;
+        if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+            return a + ac * (d2 / (d2 - d6));
+        }
+
+        const float va = d3 * d6 - d5 * d4;
+        if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+            return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+        }
+
+        const float denominator = 1.0f / (va + vb + vc);
+        return a + ab * (vb * denominator) + ac * (vc * denominator);
+    }
+
+    /// @brief 두 선분 사이에서 가장 가까운 두 점을 구합니다.
+    /// @return 두 점 사이 거리의 제곱
+    /// @note Ericson, Real-Time Collision Detection 5.1.9
+    float closestSegmentSegment(const Vector3F& p1, const Vector3F& q1, const Vector3F& p2, const Vector3F& q2, Vector3F& c1, Vector3F& c2) noexcept {
+        const Vector3F d1 = q1 - p1;
+        const Vector3F d2 = q2 - p2;
+        const Vector3F r = p1 - p2;
+        const float a = Vector3F::Dot(d1, d1);
+        const float e = Vector3F::Dot(d2, d2);
+        const float f = Vector3F::Dot(d2, r);
+
+        float s = 0.0f, t = 0.0f;
+        if (a <= FLT_EPSILON && e <= FLT_EPSILON) {
+            c1 = p1;
+            c2 = p2;
+            return Vector3F::DistanceSquared(c1, c2);
+        }
+        if (a <= FLT_EPSILON) {
+            t = std::clamp(f / e, 0.0f, 1.0f);
+        }
+        else {
+            const float c = Vector3F::Dot(d1, r);
+            if (e <= FLT_EPSILON) {
+                s = std::clamp(-c / a, 0.0f, 1.0f);
+            }
+            else {
+                const float b = Vector3F::Dot(d1, d2);
+                const float denominator = a * e - b * b;
+                s = (denominator != 0.0f) ? std::clamp((b * f - c * e) / denominator, 0.0f, 1.0f) : 0.0f;
+                t = (b * s + f) / e;
+                if (t < 0.0f) {
+                    t = 0.0f;
+                    s = std::clamp(-c / a, 0.0f, 1.0f);
+                }
+                else if (t > 1.0f) {
+                    t = 1.0f;
+                    s = std::clamp((b - c) / a, 0.0f, 1.0f);
+                }
+            }
+        }
+
+        c1 = p1 + d1 * s;
+        c2 = p2 + d2 * t;
+        return Vector3F::DistanceSquared(c1, c2);
+    }
+
+    /// @brief 선분과 삼각형 사이에서 가장 가까운 두 점을 구합니다.
+    /// @param p 선분 시작점
+    /// @param q 선분 끝점 (p와 같으면 점)
+    /// @param segmentPoint 선분 위의 점
+    /// @param trianglePoint 삼각형 위의 점
+    /// @return 두 점 사이 거리의 제곱 (선분이 삼각형을 관통하면 0)
+    float closestSegmentTriangle(const Vector3F& p, const Vector3F& q, const Vector3F& a, const Vector3F& b, const Vector3F& c, Vector3F& segmentPoint, Vector3F& trianglePoint) noexcept {
+        segmentPoint = p;
+        trianglePoint = closestPointTriangle(p, a, b, c);
+        float best = Vector3F::DistanceSquared(p, trianglePoint);
+        if (p == q) {
+            return best;
+        }
+
+        // 선분이 평면을 지나는 점이 삼각형 안이면 관통
+        const Vector3F normal = Vector3F::Cross(b - a, c - a);
+        const float dp = Vector3F::Dot(p - a, normal);
+        const float dq = Vector3F::Dot(q - a, normal);
+        if ((dp <= 0.0f) != (dq <= 0.0f)) {
+            const Vector3F x = p + (q - p) * (dp / (dp - dq));
+            const Vector3F onTriangle = closestPointTriangle(x, a, b, c);
+            if (Vector3F::DistanceSquared(x, onTriangle) <= 1e-10f) {
+                segmentPoint = x;
+                trianglePoint = onTriangle;
+                return 0.0f;
+            }
+        }
+
+        const auto consider = [&](const Vector3F& onSegment, const Vector3F& onTriangle) noexcept {
+            const float distance = Vector3F::DistanceSquared(onSegment, onTriangle);
+            if (distance < best) {
+                best = distance;
+                segmentPoint = onSegment;
+                trianglePoint = onTriangle;
+            }
+        };
+        consider(q, closestPointTriangle(q, a, b, c));
+
+        const Vector3F* edges[3][2] = { { &a, &b }, { &b, &c }, { &c, &a } };
+        for (const auto& edge : edges) {
+            Vector3F onSegment, onTriangle;
+            closestSegmentSegment(p, q, *edge[0], *edge[1], onSegment, onTriangle);
+            consider(onSegment, onTriangle);
+        }
+        return best;
+    }
+
+    /// @brief 접촉 정보를 추가합니다.
+    /// @note 같은 면(사각형을 나눈 두 삼각형)은 더 깊은 것 하나만 남기고, 가득 차면 가장 얕은 것과 바꿉니다.
+    void addContact(const CollisionContact& contact, CollisionContact* contacts, uint32_t& count, uint32_t maxContacts) noexcept {
+        uint32_t shallowest = 0U;
+        for (uint32_t i = 0U; i < count; ++i) {
+            if (contacts[i].Block == contact.Block && contacts[i].Face == contact.Face) {
+                if (contact.Depth > contacts[i].Depth) {
+                    contacts[i] = contact;
+                }
+                return;
+            }
+            if (contacts[i].Depth < contacts[shallowest].Depth) {
+                shallowest = i;
+            }
+        }
+
+        if (count < maxContacts) {
+            contacts[count++] = contact;
+        }
+        else if (count > 0U && contact.Depth > contacts[shallowest].Depth) {
+            contacts[shallowest] = contact;
+        }
+    }
+}
+
+/// @brief 생성자
+BlockCollision::BlockCollision() noexcept : m_Nodes(), m_Groups(), m_TriangleCount(0U) {
+
+}
+
+/// @brief 블록 맵으로부터 BVH를 구성합니다.
+/// @param blocks 블록 맵
+/// @note 면마다 삼각형 (0, 1, 2), (0, 2, 3)으로 나누며(WorldGeometry와 같음), 넓이가 0인 삼각형은 제외합니다.
+void BlockCollision::Build(const BlockData& blocks) noexcept {
+    Clear();
+
+    std::vector<BuildTriangle> triangles;
+    triangles.reserve(static_cast<size_t>(blocks.GetBlockCount()) * BlockData::FACE_COUNT * 2U);
+    for (uint32_t block = 0U; block < blocks.GetBlockCount(); ++block) {
+        for (uint32_t face = 0U; face < BlockData::FACE_COUNT; ++face) {
+            Vector3F corners[4];
+            for (uint32_t k = 0U; k < BlockData::FACE_VERTEX_COUNT; ++k) {
+                corners[k] = blocks.GetVertex(block, BlockData::FACE_VERTEX_INDEX[face][k]);
+            }
+
+            for (uint32_t k = 1U; k <= 2U; ++k) {
+                BuildTriangle triangle = { corners[0], corners[k], corners[k + 1U], {}, {}, static_cast<uint16_t>(block), static_cast<uint8_t>(face) };
+                if (Vector3F::Cross(triangle.B - triangle.A, triangle.C - triangle.A).LengthSquared() <= 1e-12f) {
+                    continue;
+                }
+                triangle.Box.Grow(triangle.A);
+                triangle.Box.Grow(triangle.B);
+                triangle.Box.Grow(triangle.C);
+                triangle.Center = (triangle.Box.Min + triangle.Box.Max) * 0.5f;
+                triangles.push_back(triangle);
+            }
+        }
+    }
+
+    if (triangles.empty()) {
+        return;
+    }
+
+    m_TriangleCount = static_cast<uint32_t>(triangles.size());
+    m_Nodes.reserve(triangles.size() / 2U + 1U);
+    m_Groups.reserve(triangles.size() / 2U + 1U);
+
+    Builder builder = { triangles, m_Nodes, m_Groups };
+    builder.build(0U, m_TriangleCount, 0U);
+}
+
+/// @brief BVH를 비웁니다.
+void BlockCollision::Clear() noexcept {
+    m_Nodes.clear();
+    m_Groups.clear();
+    m_TriangleCount = 0U;
+}
+
+/// @brief 광선과 가장 가까운 면을 찾습니다.
+/// @param origin 시작점
+/// @param direction 방향 (정규화하지 않아도 됨)
+/// @param maxDistance 최대 거리
+/// @param anyHit 처음 찾은 면에서 멈출지 여부
+/// @param hit 결과
+/// @return 맞음(true), 맞지 않음(false)
+bool BlockCollision::rayCast(const Vector3F& origin, const Vector3F& direction, float maxDistance, bool anyHit, RayHit& hit) const noexcept {
+    hit.Distance = maxDistance;
+    hit.Block = NO_BLOCK;
+    hit.Face = 0U;
+
+    const float length = direction.Length();
+    if (m_Nodes.empty() || !(maxDistance > 0.0f) || length <= DIRECTION_EPSILON) {
+        hit.Position = origin;
+        hit.Normal = Vector3F::Zero();
+        return false;
+    }
+
+    const Vector3F dir = direction / length;
+    const L::F ox = L::Set(origin.X), oy = L::Set(origin.Y), oz = L::Set(origin.Z);
+    const L::F dx = L::Set(dir.X), dy = L::Set(dir.Y), dz = L::Set(dir.Z);
+    const L::F ix = L::Set(safeInverse(dir.X)), iy = L::Set(safeInverse(dir.Y)), iz = L::Set(safeInverse(dir.Z));
+    const L::F zero = L::Set(0.0f), one = L::Set(1.0f), epsilon = L::Set(DET_EPSILON);
+
+    uint32_t stack[STACK_SIZE];
+    float stackDistance[STACK_SIZE];
+    uint32_t top = 0U;
+    stack[top] = 0U;
+    stackDistance[top++] = 0.0f;
+
+    float best = maxDistance;
+    uint32_t bestGroup = NO_CHILD, bestLane = 0U;
+    alignas(16) float lanes[4];
+
+    while (top > 0U) {
+        --top;
+        if (stackDistance[top] > best) {
+            continue;
+        }
+
+        const uint32_t child = stack[top];
+        if (child & LEAF_FLAG) {
+            // Möller-Trumbore (양면)
+            const TriangleGroup& group = m_Groups[child & ~LEAF_FLAG];
+            const L::F e1x = L::Load(group.E1X), e1y = L::Load(group.E1Y), e1z = L::Load(group.E1Z);
+            const L::F e2x = L::Load(group.E2X), e2y = L::Load(group.E2Y), e2z = L::Load(group.E2Z);
+
+            const L::F px = L::Sub(L::Mul(dy, e2z), L::Mul(dz, e2y));
+            const L::F py = L::Sub(L::Mul(dz, e2x), L::Mul(dx, e2z));
+            const L::F pz = L::Sub(L::Mul(dx, e2y), L::Mul(dy, e2x));
+            const L::F det = L::Add(L::Add(L::Mul(e1x, px), L::Mul(e1y, py)), L::Mul(e1z, pz));
+            const L::F inverse = L::Div(one, det);
+
+            const L::F tx = L::Sub(ox, L::Load(group.V0X)), ty = L::Sub(oy, L::Load(group.V0Y)), tz = L::Sub(oz, L::Load(group.V0Z));
+            const L::F u = L::Mul(L::Add(L::Add(L::Mul(tx, px), L::Mul(ty, py)), L::Mul(tz, pz)), inverse);
+
+            const L::F qx = L::Sub(L::Mul(ty, e1z), L::Mul(tz, e1y));
+            const L::F qy = L::Sub(L::Mul(tz, e1x), L::Mul(tx, e1z));
+            const L::F qz = L::Sub(L::Mul(tx, e1y), L::Mul(ty, e1x));
+            const L::F v = L::Mul(L::Add(L::Add(L::Mul(dx, qx), L::Mul(dy, qy)), L::Mul(dz, qz)), inverse);
+            const L::F t = L::Mul(L::Add(L::Add(L::Mul(e2x, qx), L::Mul(e2y, qy)), L::Mul(e2z, qz)), inverse);
+
+            L::F mask = L::CmpGt(L::Abs(det), epsilon);
+            mask = L::And(mask, L::And(L::CmpGe(u, zero), L::CmpGe(v, zero)));
+            mask = L::And(mask, L::CmpLe(L::Add(u, v), one));
+            mask = L::And(mask, L::And(L::CmpGe(t, zero), L::CmpLt(t, L::Set(best))));
+
+            uint32_t bits = L::MoveMask(mask) & ((1U << group.Count) - 1U);
+            if (bits == 0U) {
+                continue;
+            }
+
+            L::Store(lanes, t);
+            for (; bits != 0U; bits &= bits - 1U) {
+                const uint32_t lane = static_cast<uint32_t>(std::countr_zero(bits));
+                if (lanes[lane] < best) {
+                    best = lanes[lane];
+                    bestGroup = child & ~LEAF_FLAG;
+                    bestLane = lane;
+                }
+            }
+            if (anyHit) {
+                break;
+            }
+            continue;
+        }
+
+        // 자식 경계 상자 4개와 슬랩 검사
+        const Node& node = m_Nodes[child];
+        const L::F x0 = L::Mul(L::Sub(L::Load(node.MinX), ox), ix), x1 = L::Mul(L::Sub(L::Load(node.MaxX), ox), ix);
+        const L::F y0 = L::Mul(L::Sub(L::Load(node.MinY), oy), iy), y1 = L::Mul(L::Sub(L::Load(node.MaxY), oy), iy);
+        const L::F z0 = L::Mul(L::Sub(L::Load(node.MinZ), oz), iz), z1 = L::Mul(L::Sub(L::Load(node.MaxZ), oz), iz);
+        const L::F nearT = L::Max(L::Max(L::Min(x0, x1), L::Min(y0, y1)), L::Max(L::Min(z0, z1), zero));
+        const L::F farT = L::Min(L::Min(L::Max(x0, x1), L::Max(y0, y1)), L::Min(L::Max(z0, z1), L::Set(best)));
+
+        uint32_t bits = L::MoveMask(L::CmpLe(nearT, farT)) & ((1U << node.ChildCount) - 1U);
+        if (bits == 0U) {
+            continue;
+        }
+
+        // 먼 자식부터 쌓아서 가까운 자식을 먼저 꺼냅니다.
+        L::Store(lanes, nearT);
+        uint32_t order[4];
+        uint32_t count = 0U;
+        for (; bits != 0U; bits &= bits - 1U) {
+            const uint32_t lane = static_cast<uint32_t>(std::countr_zero(bits));
+            uint32_t i = count++;
+            for (; i > 0U && lanes[order[i - 1U]] < lanes[lane]; --i) {
+                order[i] = order[i - 1U];
+            }
+            order[i] = lane;
+        }
+        for (uint32_t i = 0U; i < count; ++i) {
+            stack[top] = node.Child[order[i]];
+            stackDistance[top++] = lanes[order[i]];
+        }
+    }
+
+    if (bestGroup == NO_CHILD) {
+        hit.Position = origin + dir * maxDistance;
+        hit.Normal = Vector3F::Zero();
+        return false;
+    }
+
+    const TriangleGroup& group = m_Groups[bestGroup];
+    const Vector3F e1 = { group.E1X[bestLane], group.E1Y[bestLane], group.E1Z[bestLane] };
+    const Vector3F e2 = { group.E2X[bestLane], group.E2Y[bestLane], group.E2Z[bestLane] };
+    const Vector3F normal = Vector3F::Cross(e1, e2).Normalize();
+
+    hit.Distance = best;
+    hit.Position = origin + dir * best;
+    hit.Normal = (Vector3F::Dot(normal, dir) > 0.0f) ? -normal : normal;
+    hit.Block = group.Block[bestLane];
+    hit.Face = group.Face[bestLane];
+    return true;
+}
+
+/// @brief 광선이 처음 맞는 면을 찾습니다.
+/// @param origin 시작점
+/// @param direction 방향 (정규화하지 않아도 됨)
+/// @param maxDistance 최대 거리
+/// @param hit 결과
+/// @return 맞음(true), 맞지 않음(false)
+bool BlockCollision::RayCast(const Vector3F& origin, const Vector3F& direction, float maxDistance, RayHit& hit) const noexcept {
+    return rayCast(origin, direction, maxDistance, false, hit);
+}
+
+/// @brief 광선이 최대 거리 안에서 면에 막히는지 확인합니다.
+/// @param origin 시작점
+/// @param direction 방향 (정규화하지 않아도 됨)
+/// @param maxDistance 최대 거리
+/// @return 막힘(true), 막히지 않음(false)
+/// @note 가장 가까운 면을 찾지 않고 처음 찾은 면에서 멈추므로 시야 확인에는 RayCast보다 빠릅니다.
+bool BlockCollision::RayTest(const Vector3F& origin, const Vector3F& direction, float maxDistance) const noexcept {
+    RayHit hit;
+    return rayCast(origin, direction, maxDistance, true, hit);
+}
+
+/// @brief 여러 광선이 처음 맞는 면을 한 번에 찾습니다.
+/// @param origins 시작점
+/// @param directions 방향 (정규화하지 않아도 됨)
+/// @param maxDistances 광선별 최대 거리 (nullptr이면 제한 없음)
+/// @param begin 시작 광선 인덱스
+/// @param end 끝 광선 인덱스 (포함하지 않음)
+/// @param hits 결과 (광선 인덱스 위치에 기록)
+/// @return 맞은 광선 수
+/// @note 탄환처럼 한 프레임에 많은 광선을 검사할 때 사용하며, 범위를 나누어 여러 스레드에서 호출할 수 있습니다.
+uint32_t BlockCollision::RayCastBatch(const Vector3FStream& origins, const Vector3FStream& directions, const float* maxDistances, size_t begin, size_t end, RayHit* hits) const noexcept {
+    const float* ox = origins.GetX();
+    const float* oy = origins.GetY();
+    const float* oz = origins.GetZ();
+    const float* dx = directions.GetX();
+    const float* dy = directions.GetY();
+    const float* dz = directions.GetZ();
+
+    uint32_t count = 0U;
+    for (size_t i = begin; i < end; ++i) {
+        const float maxDistance = maxDistances ? maxDistances[i] : FLT_MAX;
+        if (rayCast({ ox[i], oy[i], oz[i] }, { dx[i], dy[i], dz[i] }, maxDistance, false, hits[i])) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+/// @brief 여러 광선이 최대 거리 안에서 면에 막히는지 한 번에 확인합니다.
+/// @param origins 시작점
+/// @param directions 방향 (정규화하지 않아도 됨)
+/// @param maxDistances 광선별 최대 거리 (nullptr이면 제한 없음)
+/// @param begin 시작 광선 인덱스
+/// @param end 끝 광선 인덱스 (포함하지 않음)
+/// @param results 결과 (광선 인덱스 위치에 막힘 1, 막히지 않음 0)
+/// @return 막힌 광선 수
+uint32_t BlockCollision::RayTestBatch(const Vector3FStream& origins, const Vector3FStream& directions, const float* maxDistances, size_t begin, size_t end, byte_t* results) const noexcept {
+    const float* ox = origins.GetX();
+    const float* oy = origins.GetY();
+    const float* oz = origins.GetZ();
+    const float* dx = directions.GetX();
+    const float* dy = directions.GetY();
+    const float* dz = directions.GetZ();
+
+    uint32_t count = 0U;
+    RayHit hit;
+    for (size_t i = begin; i < end; ++i) {
+        const float maxDistance = maxDistances ? maxDistances[i] : FLT_MAX;
+        const bool blocked = rayCast({ ox[i], oy[i], oz[i] }, { dx[i], dy[i], dz[i] }, maxDistance, true, hit);
+        results[i] = blocked ? 1U : 0U;
+        count += blocked ? 1U : 0U;
+    }
+    return count;
+}
+
+/// @brief 선분을 감싼 캡슐(선분이 한 점이면 구)과 겹치는 면을 찾습니다.
+/// @param a 선분 시작점
+/// @param b 선분 끝점
+/// @param radius 반지름
+/// @param contacts 접촉 정보 (maxContacts개)
+/// @param maxContacts 최대 접촉 수
+/// @return 접촉 수
+uint32_t BlockCollision::overlap(const Vector3F& a, const Vector3F& b, float radius, CollisionContact* contacts, uint32_t maxContacts) const noexcept {
+    if (m_Nodes.empty() || !(radius > 0.0f) || maxContacts == 0U) {
+        return 0U;
+    }
+
+    const Vector3F queryMin = Vector3F::Min(a, b) - radius;
+    const Vector3F queryMax = Vector3F::Max(a, b) + radius;
+    const L::F minX = L::Set(queryMin.X), minY = L::Set(queryMin.Y), minZ = L::Set(queryMin.Z);
+    const L::F maxX = L::Set(queryMax.X), maxY = L::Set(queryMax.Y), maxZ = L::Set(queryMax.Z);
+    const float radiusSquared = radius * radius;
+
+    uint32_t stack[STACK_SIZE];
+    uint32_t top = 0U;
+    stack[top++] = 0U;
+
+    uint32_t count = 0U;
+    while (top > 0U) {
+        const uint32_t child = stack[--top];
+        if (child & LEAF_FLAG) {
+            const TriangleGroup& group = m_Groups[child & ~LEAF_FLAG];
+            for (uint32_t i = 0U; i < group.Count; ++i) {
+                const Vector3F v0 = { group.V0X[i], group.V0Y[i], group.V0Z[i] };
+                const Vector3F e1 = { group.E1X[i], group.E1Y[i], group.E1Z[i] };
+                const Vector3F e2 = { group.E2X[i], group.E2Y[i], group.E2Z[i] };
+
+                Vector3F onSegment, onTriangle;
+                const float distanceSquared = closestSegmentTriangle(a, b, v0, v0 + e1, v0 + e2, onSegment, onTriangle);
+                if (distanceSquared >= radiusSquared) {
+                    continue;
+                }
+
+                CollisionContact contact;
+                contact.Position = onTriangle;
+                contact.Block = group.Block[i];
+                contact.Face = group.Face[i];
+
+                const float distance = std::sqrt(distanceSquared);
+                if (distance > DIRECTION_EPSILON) {
+                    contact.Normal = (onSegment - onTriangle) / distance;
+                    contact.Depth = radius - distance;
+                }
+                else {
+                    // 선분이 면에 닿거나 관통하면 더 많이 나와 있는 쪽으로 밀어냅니다.
+                    const Vector3F normal = Vector3F::Cross(e1, e2).Normalize();
+                    const float da = Vector3F::Dot(a - v0, normal);
+                    const float db = Vector3F::Dot(b - v0, normal);
+                    const float side = (std::fabs(da) >= std::fabs(db)) ? da : db;
+                    contact.Normal = (side < 0.0f) ? -normal : normal;
+                    contact.Depth = radius + (((da < 0.0f) != (db < 0.0f)) ? std::min(std::fabs(da), std::fabs(db)) : 0.0f);
+                }
+                addContact(contact, contacts, count, maxContacts);
+            }
+            continue;
+        }
+
+        const Node& node = m_Nodes[child];
+        L::F mask = L::And(L::CmpLe(L::Load(node.MinX), maxX), L::CmpGe(L::Load(node.MaxX), minX));
+        mask = L::And(mask, L::And(L::CmpLe(L::Load(node.MinY), maxY), L::CmpGe(L::Load(node.MaxY), minY)));
+        mask = L::And(mask, L::And(L::CmpLe(L::Load(node.MinZ), maxZ), L::CmpGe(L::Load(node.MaxZ), minZ)));
+
+        uint32_t bits = L::MoveMask(mask) & ((1U << node.ChildCount) - 1U);
+        for (; bits != 0U; bits &= bits - 1U) {
+            stack[top++] = node.Child[std::countr_zero(bits)];
+        }
+    }
+    return count;
+}
+
+/// @brief 구와 겹치는 면을 찾습니다.
+/// @param center 중심
+/// @param radius 반지름
+/// @param contacts 접촉 정보 (maxContacts개)
+/// @param maxContacts 최대 접촉 수
+/// @return 접촉 수 (면마다 하나, 가득 차면 깊은 것 우선)
+uint32_t BlockCollision::OverlapSphere(const Vector3F& center, float radius, CollisionContact* contacts, uint32_t maxContacts) const noexcept {
+    return overlap(center, center, radius, contacts, maxContacts);
+}
+
+/// @brief 캡슐과 겹치는 면을 찾습니다.
+/// @param a 캡슐 선분 시작점
+/// @param b 캡슐 선분 끝점
+/// @param radius 반지름
+/// @param contacts 접촉 정보 (maxContacts개)
+/// @param maxContacts 최대 접촉 수
+/// @return 접촉 수 (면마다 하나, 가득 차면 깊은 것 우선)
+uint32_t BlockCollision::OverlapCapsule(const Vector3F& a, const Vector3F& b, float radius, CollisionContact* contacts, uint32_t maxContacts) const noexcept {
+    return overlap(a, b, radius, contacts, maxContacts);
+}
\ No newline at end of file
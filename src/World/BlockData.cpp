@@ -0,0 +1,192 @@
+#include "World/BlockData.hpp"
+#include "System/MappedFile.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+using namespace world;
+
+namespace {
+    /// @brief 파일의 텍스처 인덱스(float)를 정수로 변환합니다.
+    /// @param value 파일 값
+    /// @return 텍스처 인덱스 (정수로 나타낼 수 없으면 -1)
+    inline int32_t toTextureIndex(float value) noexcept {
+        return (std::isfinite(value) && value > -2147483648.0f && value < 2147483648.0f) ? static_cast<int32_t>(value) : -1;
+    }
+}
+
+/// @brief 생성자
+BlockData::BlockData() noexcept {
+    std::memset(m_X, 0, sizeof(m_X));
+    std::memset(m_Y, 0, sizeof(m_Y));
+    std::memset(m_Z, 0, sizeof(m_Z));
+    std::memset(m_U, 0, sizeof(m_U));
+    std::memset(m_V, 0, sizeof(m_V));
+    std::memset(m_TextureIndex, 0, sizeof(m_TextureIndex));
+    std::memset(m_Flags, 0, sizeof(m_Flags));
+    Clear();
+}
+
+/// @brief BD1 파일을 불러옵니다.
+/// @param path 파일 경로
+/// @return 성공(true), 실패(false: 파일이 없거나 손상됨, 기존 내용은 비워짐)
+/// @note 파일을 메모리 매핑해서 블록 배열로 바로 옮기므로 중간 버퍼가 없습니다.
+bool BlockData::Load(const std::string& path) noexcept {
+    system::MappedFile file;
+    if (!file.Open(path)) {
+        Clear();
+        return false;
+    }
+
+    return Parse(file.GetData(), file.GetSize());
+}
+
+/// @brief 메모리의 BD1 내용을 해석합니다.
+/// @param data 파일 내용
+/// @param size 파일 크기
+/// @return 성공(true), 실패(false: 손상됨, 기존 내용은 비워짐)
+/// @note OpenXOPS와 같이 블록 수가 MAX_BLOCKS를 넘으면 앞의 MAX_BLOCKS개만 읽습니다.
+bool BlockData::Parse(const void* data, size_t size) noexcept {
+    Clear();
+
+    const byte_t* p = static_cast<const byte_t*>(data);
+    if (!p || size < HEADER_SIZE) {
+        return false;
+    }
+
+    uint16_t count = 0U;
+    std::memcpy(&count, p + TEXTURE_COUNT * TEXTURE_NAME_LENGTH, sizeof(count));
+
+    const uint32_t blockCount = std::min<uint32_t>(count, MAX_BLOCKS);
+    if (size - HEADER_SIZE < blockCount * BLOCK_SIZE) {
+        return false;
+    }
+
+    for (uint32_t i = 0U; i < TEXTURE_COUNT; ++i) {
+        std::memcpy(m_TextureNames[i], p + i * TEXTURE_NAME_LENGTH, TEXTURE_NAME_LENGTH);
+        m_TextureNames[i][TEXTURE_NAME_LENGTH] = '\0';
+    }
+
+    // 파일의 블록 하나: X[8], Y[8], Z[8], U[24], V[24], 텍스처 인덱스[6], 플래그 (모두 float)
+    const byte_t* block = p + HEADER_SIZE;
+    for (uint32_t i = 0U; i < blockCount; ++i, block += BLOCK_SIZE) {
+        const byte_t* field = block;
+        std::memcpy(&m_X[i * VERTEX_COUNT], field, VERTEX_COUNT * sizeof(float));
+        field += VERTEX_COUNT * sizeof(float);
+        std::memcpy(&m_Y[i * VERTEX_COUNT], field, VERTEX_COUNT * sizeof(float));
+        field += VERTEX_COUNT * sizeof(float);
+        std::memcpy(&m_Z[i * VERTEX_COUNT], field, VERTEX_COUNT * sizeof(float));
+        field += VERTEX_COUNT * sizeof(float);
+        std::memcpy(&m_U[i * UV_COUNT], field, UV_COUNT * sizeof(float));
+        field += UV_COUNT * sizeof(float);
+        std::memcpy(&m_V[i * UV_COUNT], field, UV_COUNT * sizeof(float));
+        field += UV_COUNT * sizeof(float);
+
+        float textures[FACE_COUNT];
+        std::memcpy(textures, field, sizeof(textures));
+        field += sizeof(textures);
+        for (uint32_t f = 0U; f < FACE_COUNT; ++f) {
+            m_TextureIndex[i * FACE_COUNT + f] = toTextureIndex(textures[f]);
+        }
+
+        std::memcpy(&m_Flags[i], field, sizeof(float));
+    }
+
+    m_BlockCount = blockCount;
+    return true;
+}
+
+/// @brief BD1 파일로 저장합니다.
+/// @param path 파일 경로
+/// @return 성공(true), 실패(false)
+bool BlockData::Save(const std::string& path) const noexcept {
+    std::vector<byte_t> data;
+    Serialize(data);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    return static_cast<bool>(file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size())));
+}
+
+/// @brief BD1 형식으로 직렬화합니다.
+/// @param data 결과 (HEADER_SIZE + 블록 수 * BLOCK_SIZE 바이트)
+/// @note 불러온 파일을 그대로 다시 직렬화하면 원본과 바이트 단위로 같습니다. (블록 수가 MAX_BLOCKS 이하이고 텍스처 인덱스가 정수인 경우)
+void BlockData::Serialize(std::vector<byte_t>& data) const noexcept {
+    data.assign(HEADER_SIZE + m_BlockCount * BLOCK_SIZE, 0U);
+
+    byte_t* p = data.data();
+    for (uint32_t i = 0U; i < TEXTURE_COUNT; ++i) {
+        std::memcpy(p + i * TEXTURE_NAME_LENGTH, m_TextureNames[i], TEXTURE_NAME_LENGTH);
+    }
+
+    const uint16_t count = static_cast<uint16_t>(m_BlockCount);
+    std::memcpy(p + TEXTURE_COUNT * TEXTURE_NAME_LENGTH, &count, sizeof(count));
+
+    byte_t* block = p + HEADER_SIZE;
+    for (uint32_t i = 0U; i < m_BlockCount; ++i, block += BLOCK_SIZE) {
+        byte_t* field = block;
+        std::memcpy(field, &m_X[i * VERTEX_COUNT], VERTEX_COUNT * sizeof(float));
+        field += VERTEX_COUNT * sizeof(float);
+        std::memcpy(field, &m_Y[i * VERTEX_COUNT], VERTEX_COUNT * sizeof(float));
+        field += VERTEX_COUNT * sizeof(float);
+        std::memcpy(field, &m_Z[i * VERTEX_COUNT], VERTEX_COUNT * sizeof(float));
+        field += VERTEX_COUNT * sizeof(float);
+        std::memcpy(field, &m_U[i * UV_COUNT], UV_COUNT * sizeof(float));
+        field += UV_COUNT * sizeof(float);
+        std::memcpy(field, &m_V[i * UV_COUNT], UV_COUNT * sizeof(float));
+        field += UV_COUNT * sizeof(float);
+
+        float textures[FACE_COUNT];
+        for (uint32_t f = 0U; f < FACE_COUNT; ++f) {
+            textures[f] = static_cast<float>(m_TextureIndex[i * FACE_COUNT + f]);
+        }
+        std::memcpy(field, textures, sizeof(textures));
+        field += sizeof(textures);
+
+        std::memcpy(field, &m_Flags[i], sizeof(float));
+    }
+}
+
+/// @brief 모든 블록과 텍스처 이름을 비웁니다.
+void BlockData::Clear() noexcept {
+    std::memset(m_TextureNames, 0, sizeof(m_TextureNames));
+    m_BlockCount = 0U;
+}
+
+/// @brief 블록의 경계 상자를 취득합니다.
+/// @param block 블록 인덱스
+/// @param min 최소 좌표 (결과)
+/// @param max 최대 좌표 (결과)
+void BlockData::GetBounds(uint32_t block, Vector3F& min, Vector3F& max) const noexcept {
+    const uint32_t first = block * VERTEX_COUNT;
+
+    min = GetVertex(block, 0U);
+    max = min;
+    for (uint32_t i = first + 1U; i < first + VERTEX_COUNT; ++i) {
+        min.X = std::min(min.X, m_X[i]);
+        min.Y = std::min(min.Y, m_Y[i]);
+        min.Z = std::min(min.Z, m_Z[i]);
+        max.X = std::max(max.X, m_X[i]);
+        max.Y = std::max(max.Y, m_Y[i]);
+        max.Z = std::max(max.Z, m_Z[i]);
+    }
+}
+
+/// @brief 모든 블록을 감싸는 경계 상자를 취득합니다.
+/// @param min 최소 좌표 (결과, 블록이 없으면 Zero)
+/// @param max 최대 좌표 (결과, 블록이 없으면 Zero)
+void BlockData::GetBounds(Vector3F& min, Vector3F& max) const noexcept {
+    if (m_BlockCount == 0U) {
+        min = Vector3F::Zero();
+        max = Vector3F::Zero();
+        return;
+    }
+
+    GetBounds(0U, min, max);
+    for (uint32_t block = 1U; block < m_BlockCount; ++block) {
+        Vector3F blockMin, blockMax;
+        GetBounds(block, blockMin, blockMax);
+        min = Vector3F::Min(min, blockMin);
+        max = Vector3F::Max(max, blockMax);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,226 @@
+#include "World/SpatialGrid.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+using namespace world;
+
+namespace {
+    constexpr float MAX_CELL_COORDINATE = 1073741824.0f;       ///< 칸 좌표 범위 (int32_t 넘침 방지)
+}
+
+/// @brief 생성자
+/// @param cellSize 칸 크기 (보통 가장 흔한 검색 반경의 2배 정도)
+/// @param bucketCount 버킷 수 (2의 거듭제곱으로 올림)
+SpatialGrid::SpatialGrid(float cellSize, uint32_t bucketCount) noexcept : m_Buckets(std::bit_ceil(std::max(bucketCount, 1U))), m_Proxies(), m_CellSize((cellSize > 0.0f) ? cellSize : 1.0f), m_InverseCellSize(1.0f / m_CellSize), m_BucketMask(static_cast<uint32_t>(m_Buckets.size()) - 1U), m_FreeProxy(INVALID_PROXY), m_Count(0U) {
+
+}
+
+/// @brief 좌표를 칸 좌표로 바꿉니다.
+/// @param value 좌표
+/// @return 칸 좌표
+int32_t SpatialGrid::toCell(float value) const noexcept {
+    return static_cast<int32_t>(std::clamp(std::floor(value * m_InverseCellSize), -MAX_CELL_COORDINATE, MAX_CELL_COORDINATE));
+}
+
+/// @brief 칸 좌표의 버킷을 구합니다.
+/// @param x 칸 X
+/// @param y 칸 Y
+/// @param z 칸 Z
+/// @return 버킷 인덱스
+uint32_t SpatialGrid::getBucket(int32_t x, int32_t y, int32_t z) const noexcept {
+    const uint32_t hash = (static_cast<uint32_t>(x) * 73856093U) ^ (static_cast<uint32_t>(y) * 19349663U) ^ (static_cast<uint32_t>(z) * 83492791U);
+    return hash & m_BucketMask;
+}
+
+/// @brief 위치의 버킷을 구합니다.
+/// @param position 위치
+/// @return 버킷 인덱스
+uint32_t SpatialGrid::getBucket(const Vector3F& position) const noexcept {
+    return getBucket(toCell(position.X), toCell(position.Y), toCell(position.Z));
+}
+
+/// @brief 경계 상자에 걸친 칸의 개체 중 조건을 만족하는 것을 찾습니다.
+/// @param min 경계 상자 최소 좌표
+/// @param max 경계 상자 최대 좌표
+/// @param predicate 항목 조건
+/// @param results 결과 (값)
+/// @param maxResults 최대 결과 수
+/// @return 결과 수
+/// @note 서로 다른 칸이 같은 버킷에 모일 수 있으므로 버킷은 한 번씩만 읽고, 칸이 아니라 위치로 판정합니다.
+template <typename Predicate>
+uint32_t SpatialGrid::query(const Vector3F& min, const Vector3F& max, const Predicate& predicate, uint32_t* results, uint32_t maxResults) const noexcept {
+    uint32_t count = 0U;
+    const auto scan = [&](const std::vector<Entry>& bucket) noexcept {
+        for (const Entry& entry : bucket) {
+            if (count == maxResults) {
+                return;
+            }
+            if (predicate(entry)) {
+                results[count++] = entry.UserData;
+            }
+        }
+    };
+
+    const int32_t x0 = toCell(min.X), y0 = toCell(min.Y), z0 = toCell(min.Z);
+    const int32_t x1 = toCell(max.X), y1 = toCell(max.Y), z1 = toCell(max.Z);
+    const uint64_t cells = static_cast<uint64_t>(static_cast<int64_t>(x1) - x0 + 1) * static_cast<uint64_t>(static_cast<int64_t>(y1) - y0 + 1) * static_cast<uint64_t>(static_cast<int64_t>(z1) - z0 + 1);
+
+    // 칸이 많으면 버킷을 모두 읽는 편이 빠릅니다.
+    if (cells > MAX_QUERY_CELLS || cells > m_Buckets.size()) {
+        for (const std::vector<Entry>& bucket : m_Buckets) {
+            scan(bucket);
+        }
+        return count;
+    }
+
+    uint32_t visited[MAX_QUERY_CELLS];
+    uint32_t visitedCount = 0U;
+    for (int32_t z = z0; z <= z1; ++z) {
+        for (int32_t y = y0; y <= y1; ++y) {
+            for (int32_t x = x0; x <= x1; ++x) {
+                const uint32_t bucket = getBucket(x, y, z);
+                if (std::find(visited, visited + visitedCount, bucket) != visited + visitedCount) {
+                    continue;
+                }
+                visited[visitedCount++] = bucket;
+                scan(m_Buckets[bucket]);
+            }
+        }
+    }
+    return count;
+}
+
+/// @brief 개체를 추가합니다.
+/// @param position 위치
+/// @param userData 검색 결과로 돌려줄 값 (예: 개체 인덱스)
+/// @return 개체 식별자
+uint32_t SpatialGrid::Insert(const Vector3F& position, uint32_t userData) noexcept {
+    uint32_t proxy = m_FreeProxy;
+    if (proxy != INVALID_PROXY) {
+        m_FreeProxy = m_Proxies[proxy].Index;
+    }
+    else {
+        proxy = static_cast<uint32_t>(m_Proxies.size());
+        m_Proxies.push_back({});
+    }
+
+    const uint32_t bucket = getBucket(position);
+    m_Proxies[proxy] = { bucket, static_cast<uint32_t>(m_Buckets[bucket].size()) };
+    m_Buckets[bucket].push_back({ position.X, position.Y, position.Z, userData, proxy });
+    ++m_Count;
+    return proxy;
+}
+
+/// @brief 개체를 제거합니다.
+/// @param proxy 개체 식별자
+/// @note 버킷의 마지막 항목으로 빈자리를 채우므로 O(1)입니다.
+void SpatialGrid::Remove(uint32_t proxy) noexcept {
+    if (proxy >= m_Proxies.size() || m_Proxies[proxy].Bucket == INVALID_PROXY) {
+        return;
+    }
+
+    Proxy& removed = m_Proxies[proxy];
+    std::vector<Entry>& bucket = m_Buckets[removed.Bucket];
+    bucket[removed.Index] = bucket.back();
+    m_Proxies[bucket[removed.Index].Proxy].Index = removed.Index;
+    bucket.pop_back();
+
+    removed = { INVALID_PROXY, m_FreeProxy };
+    m_FreeProxy = proxy;
+    --m_Count;
+}
+
+/// @brief 개체를 옮깁니다.
+/// @param proxy 개체 식별자
+/// @param position 새 위치
+/// @note 같은 버킷 안에서 움직이면 위치만 고칩니다.
+void SpatialGrid::Move(uint32_t proxy, const Vector3F& position) noexcept {
+    if (proxy >= m_Proxies.size() || m_Proxies[proxy].Bucket == INVALID_PROXY) {
+        return;
+    }
+
+    Proxy& moved = m_Proxies[proxy];
+    const uint32_t bucket = getBucket(position);
+    if (bucket == moved.Bucket) {
+        Entry& entry = m_Buckets[bucket][moved.Index];
+        entry.X = position.X;
+        entry.Y = position.Y;
+        entry.Z = position.Z;
+        return;
+    }
+
+    std::vector<Entry>& from = m_Buckets[moved.Bucket];
+    const uint32_t userData = from[moved.Index].UserData;
+    from[moved.Index] = from.back();
+    m_Proxies[from[moved.Index].Proxy].Index = moved.Index;
+    from.pop_back();
+
+    std::vector<Entry>& to = m_Buckets[bucket];
+    moved = { bucket, static_cast<uint32_t>(to.size()) };
+    to.push_back({ position.X, position.Y, position.Z, userData, proxy });
+}
+
+/// @brief 모든 개체를 제거합니다.
+/// @note 버킷 용량은 유지하므로 다시 채울 때 할당하지 않습니다.
+void SpatialGrid::Clear() noexcept {
+    for (std::vector<Entry>& bucket : m_Buckets) {
+        bucket.clear();
+    }
+    m_Proxies.clear();
+    m_FreeProxy = INVALID_PROXY;
+    m_Count = 0U;
+}
+
+/// @brief 구 안의 개체를 찾습니다.
+/// @param center 중심
+/// @param radius 반지름
+/// @param results 결과 (개체의 값, maxResults개)
+/// @param maxResults 최대 결과 수
+/// @return 결과 수 (maxResults에 이르면 검색을 멈춤)
+uint32_t SpatialGrid::QueryRadius(const Vector3F& center, float radius, uint32_t* results, uint32_t maxResults) const noexcept {
+    if (m_Count == 0U || maxResults == 0U || radius < 0.0f) {
+        return 0U;
+    }
+
+    const float radiusSquared = radius * radius;
+    return query(center - radius, center + radius, [&](const Entry& entry) noexcept {
+        const float dx = entry.X - center.X;
+        const float dy = entry.Y - center.Y;
+        const float dz = entry.Z - center.Z;
+        return dx * dx + dy * dy + dz * dz <= radiusSquared;
+    }, results, maxResults);
+}
+
+/// @brief 경계 상자 안의 개체를 찾습니다.
+/// @param min 최소 좌표
+/// @param max 최대 좌표
+/// @param results 결과 (개체의 값, maxResults개)
+/// @param maxResults 최대 결과 수
+/// @return 결과 수 (maxResults에 이르면 검색을 멈춤)
+uint32_t SpatialGrid::QueryAABB(const Vector3F& min, const Vector3F& max, uint32_t* results, uint32_t maxResults) const noexcept {
+    if (m_Count == 0U || maxResults == 0U || min.X > max.X || min.Y > max.Y || min.Z > max.Z) {
+        return 0U;
+    }
+
+    return query(min, max, [&](const Entry& entry) noexcept {
+        return entry.X >= min.X && entry.X <= max.X && entry.Y >= min.Y && entry.Y <= max.Y && entry.Z >= min.Z && entry.Z <= max.Z;
+    }, results, maxResults);
+}
+
+/// @brief 개체의 위치를 취득합니다.
+/// @param proxy 개체 식별자
+/// @return 위치
+Vector3F SpatialGrid::GetPosition(uint32_t proxy) const noexcept {
+    const Proxy& found = m_Proxies[proxy];
+    const Entry& entry = m_Buckets[found.Bucket][found.Index];
+    return { entry.X, entry.Y, entry.Z };
+}
+
+/// @brief 개체의 값을 취득합니다.
+/// @param proxy 개체 식별자
+/// @return 값
+uint32_t SpatialGrid::GetUserData(uint32_t proxy) const noexcept {
+    const Proxy& found = m_Proxies[proxy];
+    return m_Buckets[found.Bucket][found.Index].UserData;
+}
\ No newline at end of file
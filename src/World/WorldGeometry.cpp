@@ -0,0 +1,285 @@
+#include "World/WorldGeometry.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <unordered_map>
+#include <utility>
+
+using namespace world;
+
+namespace {
+    constexpr uint32_t UNTEXTURED_SLOT = BlockData::TEXTURE_COUNT;     ///< 텍스처 없는 면의 정렬 순서 (마지막)
+    constexpr uint32_t WHITE = 0xFFFFFFFFU;                             ///< 정점 색상
+
+    /// @brief 정렬할 면
+    struct FaceRef final {
+        uint32_t Slot;                      ///< 텍스처 정렬 순서 (0 ~ 9: 텍스처, 10: 없음)
+        uint32_t Cluster;                   ///< 클러스터 인덱스
+        uint16_t Block;                     ///< 블록 인덱스
+        uint16_t Face;                      ///< 면 인덱스
+    };
+
+    /// @brief 면의 넓이가 0인지 확인합니다.
+    /// @param corners 면의 꼭짓점 4개
+    /// @return 넓이 0(true), 아님(false)
+    bool isDegenerate(const Vector3F (&corners)[4]) noexcept {
+        const Vector3F a = Vector3F::Cross(corners[1] - corners[0], corners[2] - corners[0]);
+        const Vector3F b = Vector3F::Cross(corners[2] - corners[0], corners[3] - corners[0]);
+        return Vector3F::Dot(a, a) <= 1e-12f && Vector3F::Dot(b, b) <= 1e-12f;
+    }
+
+    /// @brief 격자 칸 좌표를 키로 묶습니다.
+    inline uint64_t cellKey(int32_t x, int32_t y, int32_t z) noexcept {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x) & 0x1FFFFFU) << 42) |
+            (static_cast<uint64_t>(static_cast<uint32_t>(y) & 0x1FFFFFU) << 21) |
+            static_cast<uint64_t>(static_cast<uint32_t>(z) & 0x1FFFFFU);
+    }
+}
+
+/// @brief 이동 생성자
+/// @param other 원본 (비고 버퍼가 없는 상태가 되므로 Release해도 대상의 버퍼는 유지됨)
+WorldGeometry::WorldGeometry(WorldGeometry&& other) noexcept :
+    m_Vertices(std::move(other.m_Vertices)),
+    m_Indices(std::move(other.m_Indices)),
+    m_Ranges(std::move(other.m_Ranges)),
+    m_SubRanges(std::move(other.m_SubRanges)),
+    m_Clusters(std::move(other.m_Clusters)),
+    m_VertexBuffer(std::exchange(other.m_VertexBuffer, {})),
+    m_IndexBuffer(std::exchange(other.m_IndexBuffer, {})) {
+    other.m_Vertices.clear();
+    other.m_Indices.clear();
+    other.m_Ranges.clear();
+    other.m_SubRanges.clear();
+    other.m_Clusters.clear();
+}
+
+/// @brief 블록 맵으로부터 지오메트리를 구성합니다.
+/// @param blocks 블록 맵
+/// @param options 구성 옵션
+/// @note 이전에 업로드한 버퍼는 유지되므로, 다시 구성했다면 Release 후 Upload해야 합니다.
+void WorldGeometry::Build(const BlockData& blocks, const WorldGeometryOptions& options) noexcept {
+    m_Vertices.clear();
+    m_Indices.clear();
+    m_Ranges.clear();
+    m_SubRanges.clear();
+    m_Clusters.clear();
+
+    // 면마다 텍스처와 클러스터를 정합니다.
+    std::vector<FaceRef> faces;
+    faces.reserve(static_cast<size_t>(blocks.GetBlockCount()) * BlockData::FACE_COUNT);
+
+    std::unordered_map<uint64_t, uint32_t> cells;
+    const bool clustered = options.ClusterSize > 0.0f;
+    const float inverseCellSize = clustered ? 1.0f / options.ClusterSize : 0.0f;
+
+    for (uint32_t block = 0U; block < blocks.GetBlockCount(); ++block) {
+        for (uint32_t face = 0U; face < BlockData::FACE_COUNT; ++face) {
+            const int32_t texture = blocks.GetTextureIndex(block, face);
+            const bool textured = texture >= 0 && texture < static_cast<int32_t>(BlockData::TEXTURE_COUNT);
+            if (!textured && options.SkipUntextured) {
+                continue;
+            }
+
+            Vector3F corners[4];
+            for (uint32_t k = 0U; k < BlockData::FACE_VERTEX_COUNT; ++k) {
+                corners[k] = blocks.GetVertex(block, BlockData::FACE_VERTEX_INDEX[face][k]);
+            }
+            if (isDegenerate(corners)) {
+                continue;
+            }
+
+            uint32_t cluster = 0U;
+            if (clustered) {
+                const Vector3F center = (corners[0] + corners[1] + corners[2] + corners[3]) * 0.25f;
+                const uint64_t key = cellKey(
+                    static_cast<int32_t>(std::floor(center.X * inverseCellSize)),
+                    static_cast<int32_t>(std::floor(center.Y * inverseCellSize)),
+                    static_cast<int32_t>(std::floor(center.Z * inverseCellSize)));
+                cluster = cells.try_emplace(key, static_cast<uint32_t>(cells.size())).first->second;
+            }
+
+            faces.push_back({ textured ? static_cast<uint32_t>(texture) : UNTEXTURED_SLOT, cluster, static_cast<uint16_t>(block), static_cast<uint16_t>(face) });
+        }
+    }
+
+    if (faces.empty()) {
+        return;
+    }
+
+    // (텍스처, 클러스터) 순으로 정렬하고, 같은 칸 안에서는 블록 순서를 유지합니다.
+    std::sort(faces.begin(), faces.end(), [](const FaceRef& lhs, const FaceRef& rhs) noexcept {
+        if (lhs.Slot != rhs.Slot) {
+            return lhs.Slot < rhs.Slot;
+        }
+        if (lhs.Cluster != rhs.Cluster) {
+            return lhs.Cluster < rhs.Cluster;
+        }
+        return (lhs.Block != rhs.Block) ? lhs.Block < rhs.Block : lhs.Face < rhs.Face;
+    });
+
+    m_Clusters.resize(clustered ? cells.size() : 1U, { { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX } });
+    m_Vertices.reserve(faces.size() * BlockData::FACE_VERTEX_COUNT);
+    m_Indices.reserve(faces.size() * 6U);
+
+    const float* u = blocks.GetU();
+    const float* v = blocks.GetV();
+    uint32_t slot = UINT32_MAX;
+    for (const FaceRef& face : faces) {
+        // 텍스처 또는 클러스터가 바뀌면 새 범위를 엽니다.
+        if (face.Slot != slot) {
+            slot = face.Slot;
+            const int32_t texture = (slot == UNTEXTURED_SLOT) ? -1 : static_cast<int32_t>(slot);
+            m_Ranges.push_back({ texture, static_cast<uint32_t>(m_Indices.size()), 0U, static_cast<uint32_t>(m_SubRanges.size()), 0U });
+        }
+        WorldDrawRange& range = m_Ranges.back();
+        if (range.SubRangeCount == 0U || m_SubRanges.back().Cluster != face.Cluster) {
+            m_SubRanges.push_back({ face.Cluster, static_cast<uint32_t>(m_Indices.size()), 0U });
+            ++range.SubRangeCount;
+        }
+
+        const uint16_t base = static_cast<uint16_t>(m_Vertices.size());
+        WorldCluster& cluster = m_Clusters[face.Cluster];
+        for (uint32_t k = 0U; k < BlockData::FACE_VERTEX_COUNT; ++k) {
+            const Vector3F position = blocks.GetVertex(face.Block, BlockData::FACE_VERTEX_INDEX[face.Face][k]);
+            const uint32_t uv = face.Block * BlockData::UV_COUNT + face.Face * BlockData::FACE_VERTEX_COUNT + k;
+            m_Vertices.push_back({ position.X, position.Y, position.Z, WHITE, u[uv], v[uv] });
+
+            cluster.Min = Vector3F::Min(cluster.Min, position);
+            cluster.Max = Vector3F::Max(cluster.Max, position);
+        }
+
+        // 사각형 (0, 1, 2, 3) -> 삼각형 (0, 1, 2), (0, 2, 3)
+        const uint16_t quad[6] = { base, static_cast<uint16_t>(base + 1U), static_cast<uint16_t>(base + 2U), base, static_cast<uint16_t>(base + 2U), static_cast<uint16_t>(base + 3U) };
+        m_Indices.insert(m_Indices.end(), quad, quad + 6);
+
+        range.IndexCount += 6U;
+        m_SubRanges.back().IndexCount += 6U;
+    }
+}
+
+/// @brief 정점, 인덱스 버퍼를 생성합니다.
+/// @param device 렌더 디바이스
+/// @return 성공(true), 실패(false)
+bool WorldGeometry::Upload(graphics::IRenderDevice& device) noexcept {
+    Release(device);
+    if (m_Indices.empty()) {
+        return true;
+    }
+
+    graphics::BufferDesc vertexDesc;
+    vertexDesc.Type     = graphics::BufferType::Vertex;
+    vertexDesc.Usage    = graphics::BufferUsage::Immutable;
+    vertexDesc.Size     = static_cast<uint32_t>(m_Vertices.size() * sizeof(WorldVertex));
+    vertexDesc.Stride   = sizeof(WorldVertex);
+
+    graphics::BufferDesc indexDesc;
+    indexDesc.Type      = graphics::BufferType::Index;
+    indexDesc.Usage     = graphics::BufferUsage::Immutable;
+    indexDesc.Size      = static_cast<uint32_t>(m_Indices.size() * sizeof(uint16_t));
+
+    m_VertexBuffer  = device.CreateBuffer(vertexDesc, m_Vertices.data());
+    m_IndexBuffer   = device.CreateBuffer(indexDesc, m_Indices.data());
+    if (!m_VertexBuffer.IsValid() || !m_IndexBuffer.IsValid()) {
+        Release(device);
+        return false;
+    }
+    return true;
+}
+
+/// @brief 정점, 인덱스 버퍼를 해제합니다.
+/// @param device 렌더 디바이스
+void WorldGeometry::Release(graphics::IRenderDevice& device) noexcept {
+    if (m_VertexBuffer.IsValid()) {
+        device.DestroyBuffer(m_VertexBuffer);
+        m_VertexBuffer = {};
+    }
+    if (m_IndexBuffer.IsValid()) {
+        device.DestroyBuffer(m_IndexBuffer);
+        m_IndexBuffer = {};
+    }
+}
+
+/// @brief 시야 절두체 밖의 클러스터를 골라냅니다.
+/// @param viewProjection 뷰 * 투영 행렬 (Matrix4x4F 규약, 클립 공간 깊이 0 ~ w)
+/// @param visible 결과 (클러스터마다 보임 1, 안 보임 0)
+/// @note 경계 상자를 절두체의 여섯 평면과 비교하므로, 경계에 걸친 클러스터는 보이는 것으로 판정됩니다.
+void WorldGeometry::CullClusters(const Matrix4x4F& viewProjection, byte_t* visible) const noexcept {
+    const auto& m = viewProjection.M;
+
+    // 행 벡터 규약에서 클립 좌표 c_j = dot(v, 열 j) 이므로 평면은 열의 조합입니다.
+    float planes[6][4];
+    for (uint32_t r = 0U; r < 4U; ++r) {
+        planes[0][r] = m[r][3] + m[r][0];      // 왼쪽
+        planes[1][r] = m[r][3] - m[r][0];      // 오른쪽
+        planes[2][r] = m[r][3] + m[r][1];      // 아래
+        planes[3][r] = m[r][3] - m[r][1];      // 위
+        planes[4][r] = m[r][2];                // 가까운 면
+        planes[5][r] = m[r][3] - m[r][2];      // 먼 면
+    }
+
+    for (size_t i = 0U; i < m_Clusters.size(); ++i) {
+        const WorldCluster& cluster = m_Clusters[i];
+
+        bool inside = true;
+        for (uint32_t p = 0U; p < 6U && inside; ++p) {
+            // 평면 법선 방향으로 가장 먼 꼭짓점이 평면 뒤에 있으면 밖
+            const float x = (planes[p][0] >= 0.0f) ? cluster.Max.X : cluster.Min.X;
+            const float y = (planes[p][1] >= 0.0f) ? cluster.Max.Y : cluster.Min.Y;
+            const float z = (planes[p][2] >= 0.0f) ? cluster.Max.Z : cluster.Min.Z;
+            inside = (planes[p][0] * x + planes[p][1] * y + planes[p][2] * z + planes[p][3]) >= 0.0f;
+        }
+        visible[i] = inside ? 1U : 0U;
+    }
+}
+
+/// @brief 지오메트리를 그립니다.
+/// @param device 렌더 디바이스
+/// @param textures 블록 맵의 텍스처 인덱스(0 ~ 9)별 텍스처 핸들 (BlockData::TEXTURE_COUNT개)
+/// @param visible 클러스터별 보임 여부 (nullptr이면 전부 보임)
+/// @return 드로우 호출 수
+/// @note 버퍼와 토폴로지는 한 번만 바인딩하고, 텍스처마다 보이는 클러스터의 연속 구간을 하나의 드로우로 합칩니다.
+uint32_t WorldGeometry::Draw(graphics::IRenderDevice& device, const graphics::TextureHandle* textures, const byte_t* visible) const noexcept {
+    if (!m_VertexBuffer.IsValid() || !m_IndexBuffer.IsValid()) {
+        return 0U;
+    }
+
+    device.SetVertexBuffer(m_VertexBuffer);
+    device.SetIndexBuffer(m_IndexBuffer, graphics::IndexFormat::UInt16);
+    device.SetPrimitiveTopology(graphics::PrimitiveTopology::TriangleList);
+
+    uint32_t drawCalls = 0U;
+    for (const WorldDrawRange& range : m_Ranges) {
+        const graphics::TextureHandle texture = (range.TextureIndex >= 0) ? textures[range.TextureIndex] : graphics::TextureHandle{};
+        bool bound = false;
+        uint32_t start = 0U, count = 0U;
+
+        const auto flush = [&]() noexcept {
+            if (count == 0U) {
+                return;
+            }
+            if (!bound) {
+                device.SetTexture(0U, texture);
+                bound = true;
+            }
+            device.DrawIndexed(count, start, 0);
+            ++drawCalls;
+            count = 0U;
+        };
+
+        // 하위 범위는 인덱스 순으로 이어져 있으므로, 보이는 것끼리 이어지는 동안 하나로 합칩니다.
+        for (uint32_t i = 0U; i < range.SubRangeCount; ++i) {
+            const WorldSubRange& sub = m_SubRanges[range.FirstSubRange + i];
+            if (visible && !visible[sub.Cluster]) {
+                flush();
+                continue;
+            }
+            if (count == 0U) {
+                start = sub.StartIndex;
+            }
+            count += sub.IndexCount;
+        }
+        flush();
+    }
+
+    return drawCalls;
+}
\ No newline at end of file